@@ -25,14 +25,19 @@ static auto& all_fly_strings()
     return *table;
 }
 
+static size_t s_fly_string_lookup_hits { 0 };
+static size_t s_fly_string_lookup_misses { 0 };
+
 ErrorOr<FlyString> FlyString::from_utf8(StringView string)
 {
     if (string.is_empty())
         return FlyString {};
     if (string.length() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { TRY(String::from_utf8(string)) };
-    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
+    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end()) {
+        ++s_fly_string_lookup_hits;
         return FlyString { Detail::StringBase(**it) };
+    }
     return FlyString { TRY(String::from_utf8(string)) };
 }
 
@@ -42,8 +47,10 @@ FlyString FlyString::from_utf8_without_validation(ReadonlyBytes string)
         return FlyString {};
     if (string.size() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { String::from_utf8_without_validation(string) };
-    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
+    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end()) {
+        ++s_fly_string_lookup_hits;
         return FlyString { Detail::StringBase(**it) };
+    }
     return FlyString { String::from_utf8_without_validation(string) };
 }
 
@@ -63,10 +70,12 @@ FlyString::FlyString(String const& string)
 
     auto it = all_fly_strings().find(string.m_impl.data);
     if (it == all_fly_strings().end()) {
+        ++s_fly_string_lookup_misses;
         m_data = string;
         all_fly_strings().set(string.m_impl.data);
         string.m_impl.data->set_fly_string(true);
     } else {
+        ++s_fly_string_lookup_hits;
         m_data.m_impl.data = *it;
         m_data.m_impl.data->ref();
     }
@@ -119,6 +128,19 @@ size_t FlyString::number_of_fly_strings()
     return all_fly_strings().size();
 }
 
+FlyString::Statistics FlyString::statistics()
+{
+    Statistics statistics;
+    statistics.count = all_fly_strings().size();
+    statistics.lookup_hits = s_fly_string_lookup_hits;
+    statistics.lookup_misses = s_fly_string_lookup_misses;
+
+    for (auto const* string : all_fly_strings())
+        statistics.byte_count += string->byte_count();
+
+    return statistics;
+}
+
 unsigned Traits<FlyString>::hash(FlyString const& fly_string)
 {
     return fly_string.hash();
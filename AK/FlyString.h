@@ -55,6 +55,17 @@ public:
     // This is primarily interesting to unit tests.
     [[nodiscard]] static size_t number_of_fly_strings();
 
+    // Describes the table of interned strings. Short strings are stored inline and never enter the table, so they are
+    // not accounted for here. A lookup is either a hit, which found an existing interned string, or a miss, which
+    // interned a new one.
+    struct Statistics {
+        size_t count { 0 };
+        size_t byte_count { 0 };
+        size_t lookup_hits { 0 };
+        size_t lookup_misses { 0 };
+    };
+    [[nodiscard]] static Statistics statistics();
+
     template<typename T>
     requires(IsSame<RemoveCVReference<T>, StringView>)
     static ErrorOr<String> from_deprecated_fly_string(T&&) = delete;
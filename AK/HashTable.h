@@ -584,10 +584,16 @@ private:
             return nullptr;
 
         hash %= m_capacity;
-        for (;;) {
+        for (size_t probe_length = 0;; ++probe_length) {
             auto* bucket = &m_buckets[hash];
             if (bucket->state == BucketState::Free)
                 return nullptr;
+
+            // Robin hood: buckets are traversed in order of probe length, so once we reach a bucket that is closer to
+            // its ideal index than we are to ours, the value we're looking for cannot be stored any further along.
+            if (probe_length > used_bucket_probe_length(*bucket))
+                return nullptr;
+
             if (predicate(*bucket->slot()))
                 return bucket;
             if (++hash == m_capacity) [[unlikely]]
@@ -129,6 +129,11 @@ void AllocatingMemoryStream::peek_some(Bytes bytes) const
     }
 }
 
+ReadonlyBytes AllocatingMemoryStream::peek_some_contiguous() const
+{
+    return MUST(next_read_range(m_read_offset));
+}
+
 ErrorOr<Bytes> AllocatingMemoryStream::read_some(Bytes bytes)
 {
     size_t read_bytes = 0;
@@ -93,6 +93,10 @@ public:
 
     void peek_some(Bytes) const;
 
+    /// Returns the next contiguous range of unread data without copying it. This may be shorter than the full amount
+    /// of buffered data; it stays valid until the stream is next written to or read from.
+    ReadonlyBytes peek_some_contiguous() const;
+
     virtual ErrorOr<Bytes> read_some(Bytes) override;
     virtual ErrorOr<size_t> write_some(ReadonlyBytes) override;
     virtual ErrorOr<void> discard(size_t) override;
@@ -21,6 +21,9 @@ static auto& all_utf16_fly_strings()
     return *table;
 }
 
+static size_t s_utf16_fly_string_lookup_hits { 0 };
+static size_t s_utf16_fly_string_lookup_misses { 0 };
+
 namespace Detail {
 
 void did_destroy_utf16_fly_string_data(Badge<Detail::Utf16StringData>, Detail::Utf16StringData const& data)
@@ -44,8 +47,10 @@ Optional<Utf16FlyString> Utf16FlyString::create_fly_string_from_cache(ViewType c
             return Utf16String::from_utf16(string);
     }
 
-    if (auto it = all_utf16_fly_strings().find(string.hash(), [&](auto const& entry) { return *entry == string; }); it != all_utf16_fly_strings().end())
+    if (auto it = all_utf16_fly_strings().find(string.hash(), [&](auto const& entry) { return *entry == string; }); it != all_utf16_fly_strings().end()) {
+        ++s_utf16_fly_string_lookup_hits;
         return Utf16FlyString { Detail::Utf16StringBase(**it) };
+    }
 
     return {};
 }
@@ -86,11 +91,13 @@ Utf16FlyString::Utf16FlyString(Utf16String const& string)
     }
 
     if (auto it = all_utf16_fly_strings().find(data); it == all_utf16_fly_strings().end()) {
+        ++s_utf16_fly_string_lookup_misses;
         m_data = string;
 
         all_utf16_fly_strings().set(data);
         data->mark_as_fly_string({});
     } else {
+        ++s_utf16_fly_string_lookup_hits;
         m_data.set_data({}, *it);
     }
 }
@@ -100,4 +107,19 @@ size_t Utf16FlyString::number_of_utf16_fly_strings()
     return all_utf16_fly_strings().size();
 }
 
+Utf16FlyString::Statistics Utf16FlyString::statistics()
+{
+    Statistics statistics;
+    statistics.count = all_utf16_fly_strings().size();
+    statistics.lookup_hits = s_utf16_fly_string_lookup_hits;
+    statistics.lookup_misses = s_utf16_fly_string_lookup_misses;
+
+    for (auto const* string : all_utf16_fly_strings()) {
+        auto code_unit_size = string->has_ascii_storage() ? sizeof(char) : sizeof(char16_t);
+        statistics.byte_count += string->length_in_code_units() * code_unit_size;
+    }
+
+    return statistics;
+}
+
 }
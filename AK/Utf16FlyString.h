@@ -139,6 +139,15 @@ public:
     // This is primarily interesting to unit tests.
     [[nodiscard]] static size_t number_of_utf16_fly_strings();
 
+    // Describes the table of interned strings, in the same way as FlyString::Statistics.
+    struct Statistics {
+        size_t count { 0 };
+        size_t byte_count { 0 };
+        size_t lookup_hits { 0 };
+        size_t lookup_misses { 0 };
+    };
+    [[nodiscard]] static Statistics statistics();
+
 private:
     ALWAYS_INLINE explicit Utf16FlyString(Detail::Utf16StringBase data)
         : m_data(move(data))
@@ -268,6 +268,32 @@ Optional<size_t> Utf16View::find_code_unit_offset(char16_t needle, size_t start_
     return result - start + start_offset;
 }
 
+// OPTIMIZATION: Rather than comparing the needle at every offset, we use the vectorized search for a single code unit
+//               to skip ahead to each occurrence of the needle's first code unit, and only compare the needle there.
+Optional<size_t> Utf16View::find_code_unit_offset_of_non_empty_needle(Utf16View const& needle, size_t start_offset) const
+{
+    auto needle_length = needle.length_in_code_units();
+    VERIFY(needle_length > 0);
+    VERIFY(start_offset + needle_length <= length_in_code_units());
+
+    auto last_possible_offset = length_in_code_units() - needle_length;
+    auto first_code_unit = needle.code_unit_at(0);
+    auto last_code_unit = needle.code_unit_at(needle_length - 1);
+
+    for (auto offset = start_offset; offset <= last_possible_offset;) {
+        auto candidate = find_code_unit_offset(first_code_unit, offset);
+        if (!candidate.has_value() || *candidate > last_possible_offset)
+            return {};
+
+        if (code_unit_at(*candidate + needle_length - 1) == last_code_unit && substring_view(*candidate, needle_length) == needle)
+            return candidate;
+
+        offset = *candidate + 1;
+    }
+
+    return {};
+}
+
 Vector<Utf16View> Utf16View::split_view(char16_t separator, SplitBehavior split_behavior) const
 {
     Utf16View seperator_view { &separator, 1 };
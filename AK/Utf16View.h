@@ -488,11 +488,6 @@ public:
 
     constexpr Optional<size_t> find_code_unit_offset(Utf16View const& needle, size_t start_offset = 0) const
     {
-        if (has_ascii_storage() && needle.has_ascii_storage())
-            return ascii_span().index_of(needle.ascii_span(), start_offset);
-        if (!has_ascii_storage() && !needle.has_ascii_storage())
-            return utf16_span().index_of(needle.utf16_span(), start_offset);
-
         Checked maximum_offset { start_offset };
         maximum_offset += needle.length_in_code_units();
         if (maximum_offset.has_overflow() || maximum_offset.value() > length_in_code_units())
@@ -501,6 +496,14 @@ public:
         if (needle.is_empty())
             return start_offset;
 
+        if (!is_constant_evaluated())
+            return find_code_unit_offset_of_non_empty_needle(needle, start_offset);
+
+        if (has_ascii_storage() && needle.has_ascii_storage())
+            return ascii_span().index_of(needle.ascii_span(), start_offset);
+        if (!has_ascii_storage() && !needle.has_ascii_storage())
+            return utf16_span().index_of(needle.utf16_span(), start_offset);
+
         for (size_t index = start_offset; index <= length_in_code_units() - needle.length_in_code_units();) {
             auto slice = substring_view(index, needle.length_in_code_units());
             if (slice == needle)
@@ -665,6 +668,7 @@ private:
     }
 
     [[nodiscard]] size_t calculate_length_in_code_points() const;
+    [[nodiscard]] Optional<size_t> find_code_unit_offset_of_non_empty_needle(Utf16View const& needle, size_t start_offset) const;
 
     union {
         char const* ascii;
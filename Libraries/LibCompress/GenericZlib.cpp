@@ -201,6 +201,29 @@ void GenericZlibCompressor::close()
 {
 }
 
+ErrorOr<void> GenericZlibCompressor::flush()
+{
+    VERIFY(m_zstream->avail_in == 0);
+
+    // If the parameter flush is set to Z_SYNC_FLUSH, all pending output is flushed to the output buffer and the output is aligned on a
+    // byte boundary, so that the decompressor can get all input data available so far. If deflate returns with avail_out == 0, this
+    // function must be called again with the same value of the flush parameter and more output space (updated avail_out), until the
+    // flush is complete (deflate returns with non-zero avail_out).
+    do {
+        m_zstream->avail_out = m_buffer.size();
+        m_zstream->next_out = m_buffer.data();
+
+        auto ret = deflate(m_zstream, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        auto have = m_buffer.size() - m_zstream->avail_out;
+        TRY(m_stream->write_until_depleted(m_buffer.span().slice(0, have)));
+    } while (m_zstream->avail_out == 0);
+
+    return {};
+}
+
 ErrorOr<void> GenericZlibCompressor::finish()
 {
     VERIFY(m_zstream->avail_in == 0);
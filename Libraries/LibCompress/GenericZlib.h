@@ -61,6 +61,11 @@ public:
     virtual bool is_eof() const override;
     virtual bool is_open() const override;
     virtual void close() override;
+
+    // Writes out all pending output, aligned to a byte boundary, without ending the compressed stream. The compression
+    // state is kept, so further input may refer back to the input written so far.
+    ErrorOr<void> flush();
+
     ErrorOr<void> finish();
 
 protected:
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/BitStream.h>
+#include <AK/ByteBuffer.h>
 #include <AK/Concepts.h>
 #include <AK/Debug.h>
 #include <AK/Format.h>
@@ -87,14 +88,24 @@ protected:
 
 }
 
+// Rather than keeping a copy of every string in the code table, the decompressor takes advantage of the fact that each
+// string it adds to the table is the previously output string followed by one more byte, which is always the byte that
+// was output right after it. So every table entry is simply a slice of the output produced so far, and decoding a code
+// is a single copy from earlier in the output.
 template<InputBitStream InputStream>
-class LzwDecompressor : private Details::LzwState {
+class LzwDecompressor {
 public:
     explicit LzwDecompressor(MaybeOwned<InputStream> lzw_stream, u8 min_code_size, i32 offset_for_size_change = 0)
-        : LzwState(min_code_size, offset_for_size_change)
-        , m_bit_stream(move(lzw_stream))
-
+        : m_bit_stream(move(lzw_stream))
+        , m_code_size(min_code_size)
+        , m_original_code_size(min_code_size)
+        , m_table_capacity(AK::exp2<u32>(min_code_size))
+        , m_offset_for_size_change(offset_for_size_change)
     {
+        m_entries.resize(max_table_size);
+        m_root_code_count = min(m_table_capacity, static_cast<u32>(max_table_size));
+        m_table_size = m_root_code_count;
+        m_original_table_size = m_table_size;
     }
 
     static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes bytes, u8 initial_code_size, i32 offset_for_size_change = 0)
@@ -119,58 +130,125 @@ public:
             if (code == end_of_data_code)
                 break;
 
-            TRY(decompressed.try_append(lzw_decompressor.get_output()));
+            TRY(lzw_decompressor.decode_current_code_into(decompressed));
         }
 
         return decompressed;
     }
 
+    u16 add_control_code()
+    {
+        VERIFY(m_table_size < max_table_size);
+        u16 const control_code = m_table_size;
+        m_entries[m_table_size++] = {};
+        ++m_original_table_size;
+        if (m_table_size >= m_table_capacity && m_code_size < max_code_size) {
+            ++m_code_size;
+            ++m_original_code_size;
+            m_table_capacity *= 2;
+        }
+        return control_code;
+    }
+
     void reset()
     {
-        LzwState::reset();
-        m_output.clear();
+        m_table_size = m_original_table_size;
+        m_code_size = m_original_code_size;
+        m_table_capacity = AK::exp2<u32>(m_code_size);
+        m_previous_output = {};
     }
 
     ErrorOr<u16> next_code()
     {
         m_current_code = TRY(m_bit_stream->template read_bits<u16>(m_code_size));
 
-        if (m_current_code > m_code_table.size()) {
+        if (m_current_code > m_table_size) {
             dbgln_if(LZW_DEBUG, "Corrupted LZW stream, invalid code: {}, code table size: {}",
                 m_current_code,
-                m_code_table.size());
+                m_table_size);
             return Error::from_string_literal("Corrupted LZW stream, invalid code");
-        } else if (m_current_code == m_code_table.size() && m_output.is_empty()) {
+        } else if (m_current_code == m_table_size && m_previous_output.length == 0) {
             dbgln_if(LZW_DEBUG, "Corrupted LZW stream, valid new code but output buffer is empty: {}, code table size: {}",
                 m_current_code,
-                m_code_table.size());
+                m_table_size);
             return Error::from_string_literal("Corrupted LZW stream, valid new code but output buffer is empty");
         }
 
         return m_current_code;
     }
 
-    Vector<u8>& get_output()
+    // Appends the string for the code last returned by next_code() to the output.
+    ErrorOr<void> decode_current_code_into(ByteBuffer& output)
     {
-        VERIFY(m_current_code <= m_code_table.size());
-        if (m_current_code < m_code_table.size()) {
-            Vector<u8> new_entry = m_output;
-            m_output = m_code_table.at(m_current_code);
-            new_entry.append(m_output[0]);
-            extend_code_table(new_entry);
-        } else if (m_current_code == m_code_table.size()) {
-            VERIFY(!m_output.is_empty());
-            m_output.append(m_output[0]);
-            extend_code_table(m_output);
+        VERIFY(m_current_code <= m_table_size);
+
+        auto const output_offset = output.size();
+
+        if (m_current_code < m_root_code_count) {
+            TRY(output.try_append(static_cast<u8>(m_current_code)));
+            extend_code_table_with_previous_output();
+            m_previous_output = { output_offset, 1 };
+            return {};
+        }
+
+        if (m_current_code < m_table_size) {
+            auto const entry = m_entries[m_current_code];
+            auto destination = TRY(output.get_bytes_for_writing(entry.length));
+            // NOTE: The entry always lies entirely before the bytes we're writing, so the ranges can't overlap.
+            memcpy(destination.data(), output.data() + entry.offset, entry.length);
+            extend_code_table_with_previous_output();
+            m_previous_output = { output_offset, entry.length };
+            return {};
         }
-        return m_output;
+
+        // The code is the one about to be added to the table: the previous output followed by its own first byte.
+        auto const previous = m_previous_output;
+        auto destination = TRY(output.get_bytes_for_writing(previous.length + 1));
+        memcpy(destination.data(), output.data() + previous.offset, previous.length);
+        destination[previous.length] = output[previous.offset];
+        extend_code_table_with_previous_output();
+        m_previous_output = { output_offset, static_cast<u16>(previous.length + 1) };
+        return {};
     }
 
 private:
+    static constexpr int max_code_size = 12;
+    static constexpr int max_table_size = 1 << max_code_size;
+
+    struct Entry {
+        size_t offset { 0 };
+        u16 length { 0 };
+    };
+
+    // The new entry is the previous output followed by the first byte of the current output. Since the current output
+    // has just been appended right after the previous one, that is a slice of the output as well.
+    void extend_code_table_with_previous_output()
+    {
+        if (m_previous_output.length == 0 || m_table_size >= max_table_size)
+            return;
+
+        m_entries[m_table_size++] = { m_previous_output.offset, static_cast<u16>(m_previous_output.length + 1) };
+        if (m_table_size >= (m_table_capacity + m_offset_for_size_change) && m_code_size < max_code_size) {
+            ++m_code_size;
+            m_table_capacity *= 2;
+        }
+    }
+
     MaybeOwned<InputStream> m_bit_stream;
 
+    Vector<Entry> m_entries;
+    u32 m_root_code_count { 0 };
+    u32 m_table_size { 0 };
+    u32 m_original_table_size { 0 };
+
+    u8 m_code_size { 0 };
+    u8 m_original_code_size { 0 };
+
+    u32 m_table_capacity { 0 };
+    i32 m_offset_for_size_change {};
+
     u16 m_current_code { 0 };
-    Vector<u8> m_output {};
+    Entry m_previous_output {};
 };
 
 class LzwCompressor : private Details::LzwState {
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/BinaryHeap.h>
 #include <AK/Singleton.h>
 #include <AK/TemporaryChange.h>
@@ -20,6 +21,20 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+// Where available, notifiers are watched with epoll or kqueue, so that waiting for events doesn't cost time
+// proportional to the number of notifiers. Otherwise, we fall back to poll().
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_USES_EPOLL
+#    include <sys/epoll.h>
+#elif defined(AK_OS_MACOS) || defined(AK_OS_IOS) || defined(AK_OS_FREEBSD) || defined(AK_OS_NETBSD) || defined(AK_OS_OPENBSD) || defined(AK_OS_DRAGONFLY)
+#    define EVENT_LOOP_USES_KQUEUE
+#    include <sys/event.h>
+#endif
+
+#if defined(EVENT_LOOP_USES_EPOLL) || defined(EVENT_LOOP_USES_KQUEUE)
+#    define EVENT_LOOP_USES_POLLER
+#endif
+
 namespace Core {
 
 namespace {
@@ -34,6 +49,99 @@ static pthread_rwlock_t* s_thread_data_lock = nullptr;
 thread_local pthread_t s_thread_id;
 thread_local OwnPtr<ThreadData> s_this_thread_data;
 
+bool has_flag(int value, int flag)
+{
+    return (value & flag) == flag;
+}
+
+#ifdef EVENT_LOOP_USES_POLLER
+int create_poller()
+{
+#    ifdef EVENT_LOOP_USES_EPOLL
+    int poller_fd = epoll_create1(EPOLL_CLOEXEC);
+#    else
+    int poller_fd = kqueue();
+    if (poller_fd >= 0)
+        fcntl(poller_fd, F_SETFD, FD_CLOEXEC);
+#    endif
+
+    if (poller_fd < 0) {
+        perror("EventLoopImplementationUnix: create poller");
+        VERIFY_NOT_REACHED();
+    }
+    return poller_fd;
+}
+
+// Changes the events that the poller watches the file descriptor for from the previous type to the new one, where an
+// empty type means that the file descriptor is not watched. Returns false if the file descriptor can't be watched.
+bool update_poller(int poller_fd, int fd, Optional<NotificationType> previous_type, Optional<NotificationType> type)
+{
+#    ifdef EVENT_LOOP_USES_EPOLL
+    if (!type.has_value()) {
+        // NOTE: This fails if the file descriptor has already been closed, which removes it from the poller anyway.
+        (void)epoll_ctl(poller_fd, EPOLL_CTL_DEL, fd, nullptr);
+        return true;
+    }
+
+    // NOTE: Hang-ups and errors are always reported, and notifiers are level-triggered, like they are with poll().
+    struct epoll_event event {};
+    if (has_flag(*type, NotificationType::Read))
+        event.events |= EPOLLIN;
+    if (has_flag(*type, NotificationType::Write))
+        event.events |= EPOLLOUT;
+    event.data.fd = fd;
+
+    auto operation = previous_type.has_value() ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    if (epoll_ctl(poller_fd, operation, fd, &event) == 0)
+        return true;
+
+    // The file descriptor may have been closed and reopened since it was last added, or may still be watched from
+    // before a previous removal failed.
+    if (errno == ENOENT && epoll_ctl(poller_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+        return true;
+    if (errno == EEXIST && epoll_ctl(poller_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+        return true;
+
+    // Regular files and directories can't be watched, but poll() would always report them as ready.
+    if (errno == EPERM)
+        return false;
+
+    perror("EventLoopImplementationUnix: epoll_ctl");
+    VERIFY_NOT_REACHED();
+#    else
+    // NOTE: kqueue only reports hang-ups and errors as part of the read and write filters, so notifiers that are only
+    //       interested in those are watched for reading.
+    auto wants_read = [](Optional<NotificationType> type) {
+        return type.has_value() && (has_flag(*type, NotificationType::Read) || !has_flag(*type, NotificationType::Write));
+    };
+    auto wants_write = [](Optional<NotificationType> type) {
+        return type.has_value() && has_flag(*type, NotificationType::Write);
+    };
+
+    Array<struct kevent, 2> changes;
+    int change_count = 0;
+
+    if (wants_read(type) != wants_read(previous_type))
+        EV_SET(&changes[change_count++], fd, EVFILT_READ, wants_read(type) ? EV_ADD : EV_DELETE, 0, 0, nullptr);
+    if (wants_write(type) != wants_write(previous_type))
+        EV_SET(&changes[change_count++], fd, EVFILT_WRITE, wants_write(type) ? EV_ADD : EV_DELETE, 0, 0, nullptr);
+
+    if (change_count == 0 || kevent(poller_fd, changes.data(), change_count, nullptr, 0, nullptr) == 0)
+        return true;
+
+    // NOTE: Removals fail if the file descriptor has already been closed, which removes it from the kqueue anyway.
+    if (!type.has_value())
+        return true;
+
+    // Some kinds of file descriptors don't support the write filter, but poll() would always report them as ready.
+    if (errno == EINVAL)
+        return false;
+
+    perror("EventLoopImplementationUnix: kevent");
+    VERIFY_NOT_REACHED();
+#    endif
+}
+#else
 short notification_type_to_poll_events(NotificationType type)
 {
     short events = 0;
@@ -43,11 +151,7 @@ short notification_type_to_poll_events(NotificationType type)
         events |= POLLOUT;
     return events;
 }
-
-bool has_flag(int value, int flag)
-{
-    return (value & flag) == flag;
-}
+#endif
 
 class EventLoopTimeout {
 public:
@@ -220,6 +324,14 @@ struct ThreadData {
             pthread_key_create(&s_thread_key, [](void*) {
                 s_this_thread_data.clear();
             });
+#ifdef EVENT_LOOP_USES_POLLER
+            // A child process shares the poller with its parent (epoll) or doesn't have one at all (kqueue), so the
+            // event loop of the forking thread needs a poller of its own.
+            pthread_atfork(nullptr, nullptr, [] {
+                if (s_this_thread_data)
+                    s_this_thread_data->recreate_poller();
+            });
+#endif
         }
 
         if (s_thread_id == 0)
@@ -259,8 +371,13 @@ struct ThreadData {
         wake_pipe_fds = result.release_value();
 
         // The wake pipe informs us of POSIX signals as well as manual calls to wake()
+#ifdef EVENT_LOOP_USES_POLLER
+        poller_fd = create_poller();
+        VERIFY(update_poller(poller_fd, wake_pipe_fds[0], {}, NotificationType::Read));
+#else
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifiers.append(nullptr);
+#endif
     }
 
     ~ThreadData()
@@ -268,14 +385,72 @@ struct ThreadData {
         pthread_rwlock_wrlock(&*s_thread_data_lock);
         s_thread_data.remove(s_thread_id);
         pthread_rwlock_unlock(&*s_thread_data_lock);
+
+#ifdef EVENT_LOOP_USES_POLLER
+        close(poller_fd);
+#endif
     }
 
+#ifdef EVENT_LOOP_USES_POLLER
+    void recreate_poller()
+    {
+        close(poller_fd);
+        poller_fd = create_poller();
+
+        VERIFY(update_poller(poller_fd, wake_pipe_fds[0], {}, NotificationType::Read));
+        for (auto& it : notifiers_by_fd) {
+            if (it.value.watched_type.has_value())
+                (void)update_poller(poller_fd, it.key, {}, it.value.watched_type);
+        }
+    }
+
+    // Watches the file descriptor for the events that any of its notifiers are interested in.
+    void update_watched_fd(int fd)
+    {
+        auto it = notifiers_by_fd.find(fd);
+        VERIFY(it != notifiers_by_fd.end());
+        auto& notifiers_for_fd = it->value;
+
+        Optional<NotificationType> type;
+        for (auto* notifier : notifiers_for_fd.notifiers)
+            type = type.value_or(NotificationType::None) | notifier->type();
+
+        if (update_poller(poller_fd, fd, notifiers_for_fd.watched_type, type)) {
+            notifiers_for_fd.watched_type = type;
+            always_ready_fds.remove(fd);
+        } else {
+            notifiers_for_fd.watched_type = {};
+            always_ready_fds.set(fd);
+        }
+
+        if (notifiers_for_fd.notifiers.is_empty())
+            notifiers_by_fd.remove(it);
+    }
+#endif
+
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
+#ifdef EVENT_LOOP_USES_POLLER
+    struct NotifiersForFd {
+        Vector<Notifier*, 2> notifiers;
+
+        // The events that the poller watches the file descriptor for, if it watches it at all.
+        Optional<NotificationType> watched_type;
+    };
+
+    HashMap<int, NotifiersForFd> notifiers_by_fd;
+
+    // File descriptors that can't be watched by the poller, such as regular files. Like poll() does, we always report
+    // them as ready.
+    HashTable<int> always_ready_fds;
+
+    int poller_fd { -1 };
+#else
     HashMap<Notifier*, size_t> notifier_to_index;
     Vector<Notifier*, 32> notifiers;
     Vector<pollfd, 32> poll_fds;
+#endif
 
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
@@ -355,8 +530,51 @@ retry:
         }
     }
 
+#ifdef EVENT_LOOP_USES_POLLER
+    // File descriptors that can't be watched are always ready, so don't wait for anything else.
+    if (!thread_data.always_ready_fds.is_empty()) {
+        timeout = 0;
+        should_wait_forever = false;
+    }
+
+#    ifdef EVENT_LOOP_USES_EPOLL
+    Array<struct epoll_event, 64> poller_events;
+#    else
+    Array<struct kevent, 64> poller_events;
+#    endif
+#endif
+
 try_select_again:
     // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+#ifdef EVENT_LOOP_USES_EPOLL
+    int marked_fd_count = epoll_wait(thread_data.poller_fd, poller_events.data(), poller_events.size(), should_wait_forever ? -1 : timeout);
+#elif defined(EVENT_LOOP_USES_KQUEUE)
+    struct timespec timeout_spec { .tv_sec = timeout / 1000, .tv_nsec = (timeout % 1000) * 1'000'000 };
+    int marked_fd_count = kevent(thread_data.poller_fd, nullptr, 0, poller_events.data(), poller_events.size(), should_wait_forever ? nullptr : &timeout_spec);
+#endif
+#ifdef EVENT_LOOP_USES_POLLER
+    auto time_after_poll = MonotonicTime::now_coarse();
+    // Because POSIX, we might spuriously return with EINTR; just wait again.
+    if (marked_fd_count < 0) {
+        if (errno == EINTR)
+            goto try_select_again;
+        perror("EventLoopImplementationUnix::wait_for_events");
+        VERIFY_NOT_REACHED();
+    }
+
+    auto poller_events_span = poller_events.span().trim(marked_fd_count);
+    auto event_fd = [](auto const& event) {
+#    ifdef EVENT_LOOP_USES_EPOLL
+        return event.data.fd;
+#    else
+        return static_cast<int>(event.ident);
+#    endif
+    };
+
+    bool wake_pipe_is_readable = any_of(poller_events_span, [&](auto const& event) {
+        return event_fd(event) == thread_data.wake_pipe_fds[0];
+    });
+#else
     auto error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
     auto time_after_poll = MonotonicTime::now_coarse();
     // Because POSIX, we might spuriously return from select() with EINTR; just select again.
@@ -367,9 +585,12 @@ try_select_again:
         VERIFY_NOT_REACHED();
     }
 
+    bool wake_pipe_is_readable = has_flag(thread_data.poll_fds[0].revents, POLLIN);
+#endif
+
     // We woke up due to a call to wake() or a POSIX signal.
     // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    if (wake_pipe_is_readable) {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -398,15 +619,61 @@ try_select_again:
             goto retry;
     }
 
+#ifdef EVENT_LOOP_USES_POLLER
+    // Handle file system notifiers by making them normal events.
+    auto post_notifier_events = [&](int fd, NotificationType type) {
+        auto it = thread_data.notifiers_by_fd.find(fd);
+        if (it == thread_data.notifiers_by_fd.end())
+            return;
+
+        for (auto* notifier : it->value.notifiers) {
+            auto notifier_type = type & notifier->type();
+            if (notifier_type != NotificationType::None)
+                ThreadEventQueue::current().post_event(*notifier, make<NotifierActivationEvent>(fd, notifier_type));
+        }
+    };
+
+    for (auto const& event : poller_events_span) {
+        auto fd = event_fd(event);
+        if (fd == thread_data.wake_pipe_fds[0])
+            continue;
+
+        NotificationType type = NotificationType::None;
+#    ifdef EVENT_LOOP_USES_EPOLL
+        if (has_flag(event.events, EPOLLIN))
+            type |= NotificationType::Read;
+        if (has_flag(event.events, EPOLLOUT))
+            type |= NotificationType::Write;
+        if (has_flag(event.events, EPOLLHUP))
+            type |= NotificationType::Read | NotificationType::HangUp;
+        if (has_flag(event.events, EPOLLERR))
+            type |= NotificationType::Error;
+#    else
+        if (event.filter == EVFILT_READ)
+            type |= NotificationType::Read;
+        if (event.filter == EVFILT_WRITE)
+            type |= NotificationType::Write;
+        if (has_flag(event.flags, EV_EOF))
+            type |= NotificationType::Read | NotificationType::HangUp;
+        if (has_flag(event.flags, EV_ERROR))
+            type |= NotificationType::Error;
+#    endif
+
+        post_notifier_events(fd, type);
+    }
+
+    for (auto fd : thread_data.always_ready_fds)
+        post_notifier_events(fd, NotificationType::Read | NotificationType::Write);
+#else
     if (error_or_marked_fd_count.value() != 0) {
         // Handle file system notifiers by making them normal events.
         for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
             auto& notifier = *thread_data.notifiers[i];
 
-#ifdef AK_OS_ANDROID
+#    ifdef AK_OS_ANDROID
             // FIXME: Make the check work under Android, perhaps use ALooper.
             ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), notifier.type()));
-#else
+#    else
             auto revents = thread_data.poll_fds[i].revents;
 
             NotificationType type = NotificationType::None;
@@ -423,9 +690,10 @@ try_select_again:
 
             if (type != NotificationType::None)
                 ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), type));
-#endif
+#    endif
         }
     }
+#endif
 
     // Handle expired timers.
     thread_data.timeouts.fire_expired(time_after_poll);
@@ -644,11 +912,16 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
 {
     auto& thread_data = ThreadData::the();
 
+#ifdef EVENT_LOOP_USES_POLLER
+    thread_data.notifiers_by_fd.ensure(notifier.fd()).notifiers.append(&notifier);
+    thread_data.update_watched_fd(notifier.fd());
+#else
     thread_data.notifier_to_index.set(&notifier, thread_data.poll_fds.size());
     thread_data.notifiers.append(&notifier);
 
     auto events = notification_type_to_poll_events(notifier.type());
     thread_data.poll_fds.append({ .fd = notifier.fd(), .events = events, .revents = 0 });
+#endif
 
     notifier.set_owner_thread(s_thread_id);
 }
@@ -659,6 +932,12 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
     if (!thread_data)
         return;
 
+#ifdef EVENT_LOOP_USES_POLLER
+    auto it = thread_data->notifiers_by_fd.find(notifier.fd());
+    VERIFY(it != thread_data->notifiers_by_fd.end());
+    it->value.notifiers.remove_first_matching([&](auto* other) { return other == &notifier; });
+    thread_data->update_watched_fd(notifier.fd());
+#else
     auto notifier_index = thread_data->notifier_to_index.take(&notifier).release_value();
 
     if (notifier_index + 1 < thread_data->poll_fds.size()) {
@@ -671,6 +950,7 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
 
     thread_data->notifiers.take_last();
     thread_data->poll_fds.take_last();
+#endif
 }
 
 void EventLoopManagerUnix::did_post_event()
@@ -26,6 +26,7 @@ class File;
 class LocalServer;
 class LocalSocket;
 class MappedFile;
+class MemoryPressureWatcher;
 class MimeData;
 class NetworkJob;
 class NetworkResponse;
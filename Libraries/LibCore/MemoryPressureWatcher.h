@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+
+namespace Core {
+
+// Notifies us when the system (or the group of processes we are limited to) is running low on memory, so that we can
+// release memory we don't need before the system starts killing processes.
+class MemoryPressureWatcher {
+    AK_MAKE_NONCOPYABLE(MemoryPressureWatcher);
+
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> create();
+    virtual ~MemoryPressureWatcher() = default;
+
+    Function<void()> on_memory_pressure;
+
+protected:
+    MemoryPressureWatcher() = default;
+};
+
+}
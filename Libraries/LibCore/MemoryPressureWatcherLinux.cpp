@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/Platform.h>
+#include <LibCore/File.h>
+#include <LibCore/FileWatcher.h>
+#include <LibCore/MemoryPressureWatcher.h>
+
+#if !defined(AK_OS_LINUX)
+static_assert(false, "This file must only be used for Linux");
+#endif
+
+namespace Core {
+
+// The events file of our cgroup (v2) memory controller. The kernel notifies watchers of this file whenever one of its
+// counters changes. See https://docs.kernel.org/admin-guide/cgroup-v2.html#memory-interface-files
+static ErrorOr<ByteString> memory_events_path()
+{
+    auto file = TRY(File::open("/proc/self/cgroup"sv, File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    // The unified (v2) hierarchy is listed as "0::<path>".
+    for (auto line : StringView { contents }.split_view('\n')) {
+        if (!line.starts_with("0::"sv))
+            continue;
+
+        auto path = line.substring_view(3);
+
+        // NOTE: The root cgroup doesn't have a memory controller of its own.
+        if (path == "/"sv)
+            break;
+
+        return ByteString::formatted("/sys/fs/cgroup{}/memory.events", path);
+    }
+
+    return Error::from_errno(ENOTSUP);
+}
+
+// Returns the number of times the cgroup's memory usage was throttled for exceeding its high limit, reached its maximum,
+// or ran out of memory.
+static ErrorOr<u64> read_memory_pressure_event_count(StringView path)
+{
+    auto file = TRY(File::open(path, File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    u64 count = 0;
+
+    for (auto line : StringView { contents }.split_view('\n')) {
+        auto parts = line.split_view(' ');
+        if (parts.size() != 2 || !parts[0].is_one_of("high"sv, "max"sv, "oom"sv))
+            continue;
+        count += parts[1].to_number<u64>().value_or(0);
+    }
+
+    return count;
+}
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto path = TRY(memory_events_path());
+        auto event_count = TRY(read_memory_pressure_event_count(path));
+
+        auto file_watcher = TRY(FileWatcher::create());
+        TRY(file_watcher->add_watch(path, FileWatcherEvent::Type::ContentModified));
+
+        return adopt_own(*new MemoryPressureWatcherImpl(move(path), event_count, move(file_watcher)));
+    }
+
+private:
+    MemoryPressureWatcherImpl(ByteString path, u64 event_count, NonnullRefPtr<FileWatcher> file_watcher)
+        : m_path(move(path))
+        , m_event_count(event_count)
+        , m_file_watcher(move(file_watcher))
+    {
+        m_file_watcher->on_change = [this](Core::FileWatcherEvent const&) {
+            auto event_count = read_memory_pressure_event_count(m_path);
+            if (event_count.is_error())
+                return;
+
+            // NOTE: The file also changes for events that don't indicate any pressure, like reclaiming memory that is
+            //       protected by the low limit, so we only notify about the events we count.
+            if (event_count.value() == m_event_count)
+                return;
+            m_event_count = event_count.value();
+
+            if (on_memory_pressure)
+                on_memory_pressure();
+        };
+    }
+
+    ByteString m_path;
+    u64 m_event_count { 0 };
+    NonnullRefPtr<FileWatcher> m_file_watcher;
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
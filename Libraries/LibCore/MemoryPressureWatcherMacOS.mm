@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Platform.h>
+#include <LibCore/MemoryPressureWatcher.h>
+
+#if !defined(AK_OS_MACOS)
+static_assert(false, "This file must only be used for macOS");
+#endif
+
+#include <dispatch/dispatch.h>
+
+namespace Core {
+
+static constexpr auto memory_pressure_mask = DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL;
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, memory_pressure_mask, dispatch_get_main_queue());
+        if (!source)
+            return Error::from_string_literal("Unable to create memory pressure dispatch source");
+
+        return adopt_own(*new MemoryPressureWatcherImpl(source));
+    }
+
+    virtual ~MemoryPressureWatcherImpl() override
+    {
+        dispatch_source_cancel(m_source);
+        dispatch_release(m_source);
+    }
+
+private:
+    explicit MemoryPressureWatcherImpl(dispatch_source_t source)
+        : m_source(source)
+    {
+        dispatch_set_context(m_source, this);
+        dispatch_source_set_event_handler_f(m_source, memory_pressure_changed);
+        dispatch_resume(m_source);
+    }
+
+    static void memory_pressure_changed(void* context)
+    {
+        auto const& memory_pressure_watcher = *static_cast<MemoryPressureWatcherImpl*>(context);
+
+        // NOTE: We are also notified once the memory pressure goes back to normal.
+        if ((dispatch_source_get_data(memory_pressure_watcher.m_source) & memory_pressure_mask) == 0)
+            return;
+
+        if (memory_pressure_watcher.on_memory_pressure)
+            memory_pressure_watcher.on_memory_pressure();
+    }
+
+    dispatch_source_t m_source;
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/ByteString.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/Environment.h>
+#include <LibCore/File.h>
+#include <LibCore/Process.h>
+#include <LibCore/System.h>
+#include <LibCore/TraceEvent.h>
+#include <stdlib.h>
+
+namespace Core {
+
+namespace {
+
+struct TraceEvent {
+    StringView category;
+    StringView name;
+    i64 start_in_nanoseconds { 0 };
+    i64 end_in_nanoseconds { 0 };
+};
+
+struct ThreadTraceBuffer {
+    static constexpr size_t capacity = 32 * KiB;
+
+    u32 thread_id { 0 };
+    ThreadTraceBuffer* next { nullptr };
+
+    // Only the thread that owns the buffer writes to it, and publishes the events it wrote by advancing the count.
+    Atomic<size_t> recorded_event_count { 0 };
+    Array<TraceEvent, capacity> events;
+};
+
+}
+
+static Optional<ByteString> trace_directory()
+{
+    auto directory = Environment::get("LADYBIRD_TRACE_DIRECTORY"sv);
+    if (!directory.has_value() || directory->is_empty())
+        return {};
+    return ByteString { *directory };
+}
+
+bool TraceEvents::s_enabled = trace_directory().has_value();
+
+[[maybe_unused]] static int const s_flush_on_exit = [] {
+    if (TraceEvents::is_enabled())
+        atexit(TraceEvents::flush);
+    return 0;
+}();
+
+// NOTE: Buffers are never freed, so that the events of threads that have exited can still be written out.
+static Atomic<ThreadTraceBuffer*> s_thread_buffers { nullptr };
+static Atomic<u32> s_next_thread_id { 1 };
+static thread_local ThreadTraceBuffer* s_current_thread_buffer { nullptr };
+
+static ThreadTraceBuffer& current_thread_buffer()
+{
+    if (s_current_thread_buffer) [[likely]]
+        return *s_current_thread_buffer;
+
+    auto* buffer = new ThreadTraceBuffer;
+    buffer->thread_id = s_next_thread_id.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+
+    auto* head = s_thread_buffers.load(AK::MemoryOrder::memory_order_relaxed);
+    do {
+        buffer->next = head;
+    } while (!s_thread_buffers.compare_exchange_strong(head, buffer, AK::MemoryOrder::memory_order_release));
+
+    s_current_thread_buffer = buffer;
+    return *buffer;
+}
+
+void TraceEvents::record(StringView category, StringView name, MonotonicTime start, MonotonicTime end)
+{
+    auto& buffer = current_thread_buffer();
+
+    auto index = buffer.recorded_event_count.load(AK::MemoryOrder::memory_order_relaxed);
+    buffer.events[index % ThreadTraceBuffer::capacity] = { category, name, start.nanoseconds(), end.nanoseconds() };
+    buffer.recorded_event_count.store(index + 1, AK::MemoryOrder::memory_order_release);
+}
+
+void TraceEvents::flush()
+{
+    auto directory = trace_directory();
+    if (!directory.has_value())
+        return;
+
+    auto process_id = System::getpid();
+    auto process_name = Process::get_name().value_or("Ladybird"_string);
+
+    StringBuilder builder;
+    builder.append("{\"traceEvents\":["sv);
+
+    builder.append("{\"name\":\"process_name\",\"ph\":\"M\","sv);
+    builder.appendff("\"pid\":{},\"args\":{{\"name\":\"", process_id);
+    builder.append_escaped_for_json(process_name);
+    builder.append("\"}}"sv);
+
+    for (auto* buffer = s_thread_buffers.load(AK::MemoryOrder::memory_order_acquire); buffer; buffer = buffer->next) {
+        auto end = buffer->recorded_event_count.load(AK::MemoryOrder::memory_order_acquire);
+        auto begin = end > ThreadTraceBuffer::capacity ? end - ThreadTraceBuffer::capacity : 0;
+
+        for (auto index = begin; index < end; ++index) {
+            auto const& event = buffer->events[index % ThreadTraceBuffer::capacity];
+            auto start_in_microseconds = event.start_in_nanoseconds / 1000.0;
+            auto duration_in_microseconds = (event.end_in_nanoseconds - event.start_in_nanoseconds) / 1000.0;
+
+            builder.append(",{\"cat\":\""sv);
+            builder.append_escaped_for_json(event.category);
+            builder.append("\",\"name\":\""sv);
+            builder.append_escaped_for_json(event.name);
+            builder.appendff("\",\"ph\":\"X\",\"ts\":{:.3},\"dur\":{:.3},\"pid\":{},\"tid\":{}}}", start_in_microseconds, duration_in_microseconds, process_id, buffer->thread_id);
+        }
+    }
+
+    builder.append("]}\n"sv);
+
+    auto path = ByteString::formatted("{}/{}.{}.json", *directory, process_name, process_id);
+    auto write_trace = [&]() -> ErrorOr<void> {
+        auto file = TRY(File::open(path, File::OpenMode::Write));
+        TRY(file->write_until_depleted(builder.string_view().bytes()));
+        return {};
+    };
+
+    if (auto result = write_trace(); result.is_error())
+        warnln("Unable to write trace events to {}: {}", path, result.error());
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <AK/Time.h>
+
+namespace Core {
+
+// Records how long the phases of interest in a process take, so that they can be inspected on a timeline.
+//
+// Tracing is enabled by setting the LADYBIRD_TRACE_DIRECTORY environment variable to a directory. Helper processes
+// inherit it, so every process writes its own trace to that directory when it exits, in the Chrome trace event format
+// read by Perfetto and chrome://tracing. The timestamps of all processes are taken from the same monotonic clock, so
+// their traces can be combined by concatenating their "traceEvents" arrays.
+//
+// Each thread records its events into a ring buffer of its own, so recording never takes a lock. Once a buffer is
+// full, its oldest events are overwritten.
+class TraceEvents {
+public:
+    static bool is_enabled() { return s_enabled; }
+
+    // The category and name must be string literals, or otherwise outlive the process.
+    static void record(StringView category, StringView name, MonotonicTime start, MonotonicTime end);
+
+    // Writes all events recorded so far to the trace file of this process. This happens automatically on exit.
+    static void flush();
+
+private:
+    static bool s_enabled;
+};
+
+class ScopedTraceEvent {
+    AK_MAKE_NONCOPYABLE(ScopedTraceEvent);
+    AK_MAKE_NONMOVABLE(ScopedTraceEvent);
+
+public:
+    ScopedTraceEvent(StringView category, StringView name)
+    {
+        if (TraceEvents::is_enabled()) [[unlikely]] {
+            m_category = category;
+            m_name = name;
+            m_start = MonotonicTime::now();
+        }
+    }
+
+    ~ScopedTraceEvent()
+    {
+        if (m_start.has_value()) [[unlikely]]
+            TraceEvents::record(m_category, m_name, *m_start, MonotonicTime::now());
+    }
+
+private:
+    StringView m_category;
+    StringView m_name;
+    Optional<MonotonicTime> m_start;
+};
+
+}
+
+#define __TRACE_EVENT_VARIABLE_NAME(line) __trace_event_##line
+#define _TRACE_EVENT_VARIABLE_NAME(line) __TRACE_EVENT_VARIABLE_NAME(line)
+
+// Records the time from here to the end of the enclosing scope, e.g. TRACE_EVENT("layout", "BlockFormattingContext::run").
+#define TRACE_EVENT(category, name) \
+    ::Core::ScopedTraceEvent _TRACE_EVENT_VARIABLE_NAME(__LINE__) { category##sv, name##sv }
@@ -58,6 +58,13 @@ static Vector<Messages::Records::DNSKEY> s_root_zone_dnskeys = {
 
 class Resolver;
 
+// https://www.rfc-editor.org/rfc/rfc8767#section-5
+// NOTE: Expired records are kept around for this long, so that we can answer with them while refreshing them.
+static constexpr auto maximum_stale_record_duration = AK::Duration::from_seconds(24 * 60 * 60);
+
+// https://www.rfc-editor.org/rfc/rfc2308#section-5
+static constexpr u32 maximum_negative_cache_ttl = 3 * 60 * 60;
+
 class LookupResult : public AtomicRefCounted<LookupResult>
     , public Weakable<LookupResult> {
 public:
@@ -89,9 +96,15 @@ public:
             return;
 
         auto now = AK::UnixDateTime::now();
+
+        if (m_nonexistent_until.has_value() && m_nonexistent_until.value() < now) {
+            dbgln_if(DNS_DEBUG, "DNS: Negative cache entry for {} expired", m_name.to_string());
+            m_nonexistent_until.clear();
+        }
+
         for (size_t i = 0; i < m_cached_records.size();) {
             auto& record = m_cached_records[i];
-            if (record.expiration.has_value() && record.expiration.value() < now) {
+            if (record.expiration.has_value() && record.expiration.value() + maximum_stale_record_duration < now) {
                 dbgln_if(DNS_DEBUG, "DNS: Removing expired record for {}", m_name.to_string());
                 m_cached_records.remove(i);
             } else {
@@ -101,17 +114,47 @@ public:
             }
         }
 
-        if (m_cached_records.is_empty() && m_request_done)
+        if (m_cached_records.is_empty() && !m_nonexistent_until.has_value() && m_request_done)
             m_valid = false;
     }
 
+    bool has_stale_records() const
+    {
+        auto now = AK::UnixDateTime::now();
+        for (auto const& re : m_cached_records) {
+            if (re.expiration.has_value() && re.expiration.value() < now)
+                return true;
+        }
+        return false;
+    }
+
     void add_record(Messages::ResourceRecord record)
     {
-        m_valid = true;
         auto expiration = record.ttl > 0 ? Optional<AK::UnixDateTime>(AK::UnixDateTime::now() + AK::Duration::from_seconds(record.ttl)) : OptionalNone();
+        add_record(move(record), move(expiration));
+    }
+
+    void add_record(Messages::ResourceRecord record, Optional<AK::UnixDateTime> expiration)
+    {
+        m_valid = true;
         m_cached_records.append({ move(record), move(expiration) });
     }
 
+    // https://www.rfc-editor.org/rfc/rfc2308#section-5
+    void set_name_does_not_exist(u32 negative_ttl)
+    {
+        m_valid = true;
+        m_nonexistent_until = AK::UnixDateTime::now() + AK::Duration::from_seconds(min(negative_ttl, maximum_negative_cache_ttl));
+    }
+
+    bool is_known_to_not_exist() const
+    {
+        return m_nonexistent_until.has_value() && m_nonexistent_until.value() >= AK::UnixDateTime::now();
+    }
+
+    void did_use() const { m_use_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed); }
+    u32 use_count() const { return m_use_count.load(AK::MemoryOrder::memory_order_relaxed); }
+
     Vector<Messages::ResourceRecord> records() const
     {
         Vector<Messages::ResourceRecord> result;
@@ -196,7 +239,22 @@ private:
         Optional<AK::UnixDateTime> expiration;
     };
 
+    void serialize_cached_addresses(StringBuilder& builder, StringView name) const
+    {
+        for (auto const& re : m_cached_records) {
+            auto expiration = re.expiration.has_value() ? re.expiration->seconds_since_epoch() : 0;
+            re.record.record.visit(
+                [&](Messages::Records::A const& a) { builder.appendff("{} A {} {}\n", name, a.address.to_byte_string(), expiration); },
+                [&](Messages::Records::AAAA const& aaaa) { builder.appendff("{} AAAA {} {}\n", name, MUST(aaaa.address.to_string()), expiration); },
+                [](auto&) {});
+        }
+    }
+
+    friend class Resolver;
+
     Vector<RecordWithExpiration> m_cached_records;
+    Optional<AK::UnixDateTime> m_nonexistent_until;
+    mutable Atomic<u32> m_use_count { 0 };
     HashTable<Messages::ResourceType> m_desired_types;
     Vector<Messages::Records::DNSKEY> m_used_dnskeys {};
     HashTable<u16> m_seen_key_tags;
@@ -299,15 +357,102 @@ public:
                 return {};
 
             auto& result = *it->value;
+            if (result.is_known_to_not_exist()) {
+                result.did_use();
+                return result;
+            }
+
             for (auto const& type : desired_types) {
                 if (!result.has_record_of_type(type))
                     return {};
             }
 
+            result.did_use();
             return result;
         });
     }
 
+    // Returns the address records of (at most) the given number of most used cache entries, one per line, in the
+    // format understood by load_serialized_entries().
+    ByteString serialize_frequently_used_entries(size_t max_entries)
+    {
+        return m_cache.with_read_locked([&](auto& cache) {
+            struct Entry {
+                StringView name;
+                LookupResult const* result { nullptr };
+            };
+
+            Vector<Entry> entries;
+            for (auto const& [name, result] : cache) {
+                if (result->is_done() && result->has_cached_addresses() && !result->is_known_to_not_exist())
+                    entries.append({ name, result.ptr() });
+            }
+
+            quick_sort(entries, [](auto const& a, auto const& b) {
+                return a.result->use_count() > b.result->use_count();
+            });
+
+            StringBuilder builder;
+            for (size_t i = 0; i < min(entries.size(), max_entries); ++i)
+                entries[i].result->serialize_cached_addresses(builder, entries[i].name);
+            return builder.to_byte_string();
+        });
+    }
+
+    // NOTE: This lets us start out with the addresses we knew about last time. Entries that have expired since are
+    //       still used (as stale entries), but get refreshed in the background the first time they are looked up.
+    void load_serialized_entries(StringView serialized_entries)
+    {
+        auto now = AK::UnixDateTime::now();
+
+        m_cache.with_write_locked([&](auto& cache) {
+            HashTable<ByteString> loaded_names;
+
+            serialized_entries.for_each_split_view('\n', SplitBehavior::Nothing, [&](StringView line) {
+                auto parts = line.split_view(' ');
+                if (parts.size() != 4)
+                    return;
+
+                auto name = parts[0].to_byte_string();
+                auto expiration_seconds = parts[3].to_number<i64>();
+                if (!expiration_seconds.has_value())
+                    return;
+
+                Optional<AK::UnixDateTime> expiration;
+                if (*expiration_seconds != 0) {
+                    expiration = AK::UnixDateTime::from_seconds_since_epoch(*expiration_seconds);
+                    if (*expiration + maximum_stale_record_duration < now)
+                        return;
+                }
+
+                auto record = [&] -> Optional<Messages::ResourceRecord> {
+                    if (parts[1] == "A"sv) {
+                        if (auto address = IPv4Address::from_string(parts[2]); address.has_value())
+                            return Messages::ResourceRecord { .name = {}, .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::A { *address }, .raw = {} };
+                    } else if (parts[1] == "AAAA"sv) {
+                        if (auto address = IPv6Address::from_string(parts[2]); address.has_value())
+                            return Messages::ResourceRecord { .name = {}, .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = 0, .record = Messages::Records::AAAA { *address }, .raw = {} };
+                    }
+                    return {};
+                }();
+                if (!record.has_value())
+                    return;
+
+                // NOTE: Never replace an entry we already have, it is at least as fresh as the serialized one.
+                if (!loaded_names.contains(name) && cache.contains(name))
+                    return;
+
+                auto& result = cache.ensure(name, [&] {
+                    loaded_names.set(name);
+                    auto result = make_ref_counted<LookupResult>(Messages::DomainName::from_string(name));
+                    result->finished_request();
+                    return result;
+                });
+                result->add_record(record.release_value(), expiration);
+            });
+        });
+    }
+
     NonnullRefPtr<Core::Promise<NonnullRefPtr<LookupResult const>>> lookup(ByteString name, Messages::Class class_, Vector<Vector<Messages::ResourceType>> desired_types, LookupOptions options = LookupOptions::default_())
     {
         using ResultPromise = Core::Promise<NonnullRefPtr<LookupResult const>>;
@@ -386,6 +531,18 @@ public:
             dbgln_if(DNS_DEBUG, "DNS: Resolving {} from cache...", name);
             if (!options.validate_dnssec_locally || result->is_dnssec_validated()) {
                 dbgln_if(DNS_DEBUG, "DNS: Resolved {} from cache", name);
+
+                // https://www.rfc-editor.org/rfc/rfc8767#section-5
+                // NOTE: We answer with stale records right away, and refresh them in the background for the next lookup.
+                if (result->has_stale_records() && has_connection()) {
+                    dbgln_if(DNS_DEBUG, "DNS: Refreshing stale cache entry for {}", name);
+                    m_cache.with_write_locked([&](auto& cache) {
+                        if (auto it = cache.find(name); it != cache.end() && it->value.ptr() == result.ptr())
+                            cache.remove(it);
+                    });
+                    (void)lookup(name, class_, desired_types, { .validate_dnssec_locally = options.validate_dnssec_locally });
+                }
+
                 promise->resolve(result.release_nonnull());
                 return promise;
             }
@@ -675,6 +832,19 @@ private:
                 for (auto& record : message.answers)
                     result->add_record(move(record));
 
+                // https://www.rfc-editor.org/rfc/rfc2308#section-5
+                // The TTL of this record is set from the minimum of the MINIMUM field of the SOA record and the TTL of the
+                // SOA itself, and indicates how long a resolver may cache the negative answer.
+                if (message.header.options.response_code() == Messages::Options::ResponseCode::NameError) {
+                    for (auto const& authority : message.authorities) {
+                        if (auto const* soa = authority.record.get_pointer<Messages::Records::SOA>()) {
+                            dbgln_if(DNS_DEBUG, "DNS: Caching nonexistence of {} for {}s", lookup->name, min(authority.ttl, soa->minimum));
+                            result->set_name_does_not_exist(min(authority.ttl, soa->minimum));
+                            break;
+                        }
+                    }
+                }
+
                 result->finished_request();
                 lookup->promise->resolve(*result);
                 lookups->remove(message.header.id);
@@ -32,6 +32,7 @@ namespace GC {
 
 BlockAllocator::~BlockAllocator()
 {
+    m_blocks.extend(move(m_unreleased_blocks));
     for (auto* block : m_blocks) {
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
 #if !defined(AK_OS_WINDOWS)
@@ -50,6 +51,16 @@ BlockAllocator::~BlockAllocator()
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
+    // OPTIMIZATION: Prefer a block that still has its physical memory, so we don't fault it back in.
+    if (!m_unreleased_blocks.is_empty()) {
+        // To reduce predictability, take a random block from the cache.
+        size_t random_index = get_random_uniform(m_unreleased_blocks.size());
+        auto* block = m_unreleased_blocks.unstable_take(random_index);
+        ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
+        LSAN_REGISTER_ROOT_REGION(block, HeapBlock::block_size);
+        return block;
+    }
+
     if (!m_blocks.is_empty()) {
         // To reduce predictability, take a random block from the cache.
         size_t random_index = get_random_uniform(m_blocks.size());
@@ -74,6 +85,23 @@ void BlockAllocator::deallocate_block(void* block)
 {
     VERIFY(block);
 
+    // NOTE: Releasing the physical memory costs a syscall per block, and freshly emptied blocks
+    //       are often needed again before the next collection. So we only poison the block here
+    //       and leave the rest to release_unused_blocks().
+    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
+    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
+    m_unreleased_blocks.append(block);
+}
+
+void BlockAllocator::release_unused_blocks()
+{
+    for (auto* block : m_unreleased_blocks)
+        release_block(block);
+    m_blocks.extend(move(m_unreleased_blocks));
+}
+
+void BlockAllocator::release_block(void* block)
+{
 #if defined(AK_OS_WINDOWS)
     DWORD ret = DiscardVirtualMemory(block, HeapBlock::block_size);
     if (ret != ERROR_SUCCESS) {
@@ -101,10 +129,6 @@ void BlockAllocator::deallocate_block(void* block)
         VERIFY_NOT_REACHED();
     }
 #endif
-
-    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
-    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
-    m_blocks.append(block);
 }
 
 }
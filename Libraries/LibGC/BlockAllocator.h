@@ -19,8 +19,16 @@ public:
     void* allocate_block(char const* name);
     void deallocate_block(void*);
 
+    // Returns the physical memory of blocks that were deallocated but not reused since the last call.
+    void release_unused_blocks();
+
 private:
+    static void release_block(void*);
+
     Vector<void*> m_blocks;
+
+    // Blocks that were deallocated but whose physical memory is still committed.
+    Vector<void*> m_unreleased_blocks;
 };
 
 }
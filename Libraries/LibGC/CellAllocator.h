@@ -19,6 +19,11 @@
 #define GC_DEFINE_ALLOCATOR(ClassName) \
     GC::TypeIsolatingCellAllocator<ClassName> ClassName::cell_allocator { #ClassName }
 
+// Use this instead of GC_DEFINE_ALLOCATOR for types whose cells must never share a HeapBlock with other types,
+// even when the heap shares blocks between same-size types.
+#define GC_DEFINE_STRICTLY_ISOLATED_ALLOCATOR(ClassName) \
+    GC::TypeIsolatingCellAllocator<ClassName> ClassName::cell_allocator { #ClassName, GC::TypeIsolation::Strict }
+
 namespace GC {
 
 class GC_API CellAllocator {
@@ -27,6 +32,9 @@ public:
     ~CellAllocator() = default;
 
     size_t cell_size() const { return m_cell_size; }
+    char const* class_name() const { return m_class_name; }
+
+    size_t block_count() const { return m_full_blocks.size_slow() + m_usable_blocks.size_slow(); }
 
     Cell* allocate_cell(Heap&);
 
@@ -67,17 +75,26 @@ private:
     FlatPtr m_max_block_address { 0 };
 };
 
+enum class TypeIsolation {
+    // Cells get their own blocks, unless the heap shares blocks between same-size types.
+    Relaxed,
+    // Cells always get their own blocks.
+    Strict,
+};
+
 template<typename T>
 class GC_API TypeIsolatingCellAllocator {
 public:
     using CellType = T;
 
-    TypeIsolatingCellAllocator(char const* class_name)
+    TypeIsolatingCellAllocator(char const* class_name, TypeIsolation isolation = TypeIsolation::Relaxed)
         : allocator(sizeof(T), class_name)
+        , isolation(isolation)
     {
     }
 
     NeverDestroyed<CellAllocator> allocator;
+    TypeIsolation const isolation;
 };
 
 }
@@ -6,6 +6,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/BuiltinWrappers.h>
 #include <AK/Debug.h>
 #include <AK/Function.h>
 #include <AK/HashTable.h>
@@ -13,8 +14,10 @@
 #include <AK/JsonObject.h>
 #include <AK/Platform.h>
 #include <AK/StackInfo.h>
+#include <AK/Stream.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
@@ -51,16 +54,112 @@ void Heap::will_allocate(size_t size)
 {
     if (should_collect_on_every_allocation()) {
         m_allocated_bytes_since_last_gc = 0;
-        collect_garbage();
+        collect_garbage(CollectionType::CollectGarbage, CollectionReason::EveryAllocation, false);
     } else if (m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold) {
         m_allocated_bytes_since_last_gc = 0;
-        collect_garbage();
+        collect_garbage(CollectionType::CollectGarbage, CollectionReason::AllocationThreshold, false);
     }
 
     m_allocated_bytes_since_last_gc += size;
+    m_allocated_bytes_since_last_collection += size;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+StringView Heap::collection_reason_name(CollectionReason reason)
+{
+    switch (reason) {
+    case CollectionReason::AllocationThreshold:
+        return "allocation_threshold"sv;
+    case CollectionReason::EveryAllocation:
+        return "every_allocation"sv;
+    case CollectionReason::Explicit:
+        return "explicit"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void Heap::set_growth_factor(double growth_factor)
+{
+    VERIFY(growth_factor > 0);
+    m_growth_factor = growth_factor;
+    update_collection_threshold(m_collection_statistics.live_bytes_after_last_collection);
+}
+
+void Heap::set_minimum_collection_threshold(size_t threshold)
+{
+    m_minimum_collection_threshold = threshold;
+    update_collection_threshold(m_collection_statistics.live_bytes_after_last_collection);
+}
+
+void Heap::update_collection_threshold(size_t live_bytes)
+{
+    auto threshold = static_cast<size_t>(static_cast<double>(live_bytes) * m_growth_factor);
+    m_gc_bytes_threshold = max(threshold, m_minimum_collection_threshold);
+}
+
+// A snapshot of the addresses of all live HeapBlocks, taken at the start of a collection.
+// Conservative scanning checks every candidate word against it, so membership has to be cheap.
+// In the usual case where blocks are clustered within a few GiB of address space, it's a single bit test.
+class LiveHeapBlockSet {
+    AK_MAKE_NONCOPYABLE(LiveHeapBlockSet);
+
+public:
+    LiveHeapBlockSet(FlatPtr min_block_address, FlatPtr max_block_address)
+        : m_min_block_address(min_block_address)
+        , m_max_block_address(max_block_address)
+        , m_block_size_shift(count_trailing_zeroes(HeapBlock::block_size))
+    {
+        if (m_min_block_address >= m_max_block_address)
+            return;
+        auto bit_count = (m_max_block_address - m_min_block_address) >> m_block_size_shift;
+        if (bit_count > max_bitmap_bit_count)
+            return;
+        m_bitmap.resize(ceil_div(bit_count, bits_per_word));
+        m_uses_bitmap = true;
+    }
+
+    LiveHeapBlockSet(LiveHeapBlockSet&&) = default;
+
+    void add(HeapBlock& block)
+    {
+        if (!m_uses_bitmap) {
+            m_fallback_set.set(&block);
+            return;
+        }
+        auto index = bit_index(bit_cast<FlatPtr>(&block));
+        m_bitmap[index / bits_per_word] |= static_cast<u64>(1) << (index % bits_per_word);
+    }
+
+    ALWAYS_INLINE bool contains(HeapBlock* block) const
+    {
+        auto address = bit_cast<FlatPtr>(block);
+        if (address < m_min_block_address || address >= m_max_block_address)
+            return false;
+        if (!m_uses_bitmap)
+            return m_fallback_set.contains(block);
+        auto index = bit_index(address);
+        return m_bitmap[index / bits_per_word] & (static_cast<u64>(1) << (index % bits_per_word));
+    }
+
+    FlatPtr min_block_address() const { return m_min_block_address; }
+    FlatPtr max_block_address() const { return m_max_block_address; }
+
+private:
+    static constexpr size_t bits_per_word = 64;
+
+    // Bitmaps covering more address space than this would cost more to clear than the hashing they save.
+    static constexpr size_t max_bitmap_bit_count = 1 * MiB;
+
+    ALWAYS_INLINE size_t bit_index(FlatPtr address) const { return (address - m_min_block_address) >> m_block_size_shift; }
+
+    FlatPtr m_min_block_address { 0 };
+    FlatPtr m_max_block_address { 0 };
+    size_t m_block_size_shift { 0 };
+    bool m_uses_bitmap { false };
+    Vector<u64> m_bitmap;
+    HashTable<HeapBlock*> m_fallback_set;
+};
+
+static ALWAYS_INLINE Optional<FlatPtr> possible_pointer_from_value(FlatPtr data, FlatPtr min_block_address, FlatPtr max_block_address)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
         // Because NanBoxedValue stores pointers in non-canonical form we have to check if the top bytes
@@ -72,18 +171,24 @@ static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, Fl
         else
             possible_pointer = data;
         if (possible_pointer < min_block_address || possible_pointer > max_block_address)
-            return;
-        possible_pointers.set(possible_pointer, move(origin));
+            return {};
+        return possible_pointer;
     } else {
         static_assert((sizeof(NanBoxedValue) % sizeof(FlatPtr*)) == 0);
         if (data < min_block_address || data > max_block_address)
-            return;
+            return {};
         // In the 32-bit case we will look at the top and bottom part of NanBoxedValue separately we just
         // add both the upper and lower bytes as possible pointers.
-        possible_pointers.set(data, move(origin));
+        return data;
     }
 }
 
+static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, LiveHeapBlockSet const& all_live_heap_blocks)
+{
+    if (auto possible_pointer = possible_pointer_from_value(data, all_live_heap_blocks.min_block_address(), all_live_heap_blocks.max_block_address()); possible_pointer.has_value())
+        possible_pointers.set(*possible_pointer, move(origin));
+}
+
 void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address)
 {
     min_address = explode_byte(0xff);
@@ -94,31 +199,47 @@ void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_a
     }
 }
 
+static ALWAYS_INLINE Cell* cell_from_possible_pointer(LiveHeapBlockSet const& all_live_heap_blocks, FlatPtr possible_pointer)
+{
+    if (!possible_pointer)
+        return nullptr;
+    auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
+    if (!all_live_heap_blocks.contains(possible_heap_block))
+        return nullptr;
+    return possible_heap_block->cell_from_possible_pointer(possible_pointer);
+}
+
 template<typename Callback>
-static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
+static void for_each_cell_among_possible_pointers(LiveHeapBlockSet const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
 {
     for (auto possible_pointer : possible_pointers.keys()) {
-        if (!possible_pointer)
-            continue;
-        auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
-            continue;
-        if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
+        if (auto* cell = cell_from_possible_pointer(all_live_heap_blocks, possible_pointer))
             callback(cell, possible_pointer);
-        }
+    }
+}
+
+static void add_possible_root(HashMap<Cell*, HeapRoot>& roots, FlatPtr data, HeapRoot origin, LiveHeapBlockSet const& all_live_heap_blocks)
+{
+    auto possible_pointer = possible_pointer_from_value(data, all_live_heap_blocks.min_block_address(), all_live_heap_blocks.max_block_address());
+    if (!possible_pointer.has_value())
+        return;
+    auto* cell = cell_from_possible_pointer(all_live_heap_blocks, *possible_pointer);
+    if (!cell)
+        return;
+    if (cell->state() == Cell::State::Live) {
+        dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
+        roots.set(cell, move(origin));
+    } else {
+        dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
     }
 }
 
 class GraphConstructorVisitor final : public Cell::Visitor {
 public:
-    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
         : m_heap(heap)
+        , m_all_live_heap_blocks(all_live_heap_blocks)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
         m_work_queue.ensure_capacity(roots.size());
 
         for (auto& [root, root_origin] : roots) {
@@ -147,7 +268,7 @@ public:
 
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
         for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
+            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_all_live_heap_blocks);
 
         for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
             if (m_node_being_visited)
@@ -223,24 +344,346 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
+    LiveHeapBlockSet const& m_all_live_heap_blocks;
 };
 
 AK::JsonObject Heap::dump_graph()
 {
+    auto all_live_heap_blocks = gather_live_heap_blocks();
     HashMap<Cell*, HeapRoot> roots;
-    gather_roots(roots);
-    GraphConstructorVisitor visitor(*this, roots);
+    gather_roots(roots, all_live_heap_blocks);
+    GraphConstructorVisitor visitor(*this, roots, all_live_heap_blocks);
     visitor.visit_all_cells();
-    return visitor.dump();
+    auto graph = visitor.dump();
+    if (m_shares_blocks_between_types)
+        graph.set("size_class_statistics"sv, dump_size_class_statistics());
+    return graph;
+}
+
+AK::JsonObject Heap::dump_size_class_statistics()
+{
+    size_t shared_block_count = 0;
+    size_t isolated_block_count = 0;
+
+    for (auto& allocator : m_size_class_cell_allocators) {
+        if (!allocator)
+            continue;
+
+        size_t cells_per_block = 0;
+        HashMap<StringView, size_t> live_cell_count_per_type;
+        allocator->for_each_block([&](auto& block) {
+            ++shared_block_count;
+            cells_per_block = block.cell_count();
+            block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+                ++live_cell_count_per_type.ensure(cell->class_name(), [] { return 0; });
+            });
+            return IterationDecision::Continue;
+        });
+
+        // Estimate how many blocks the same cells would occupy if every type had its own allocator.
+        for (auto const& it : live_cell_count_per_type)
+            isolated_block_count += ceil_div(it.value, cells_per_block);
+    }
+
+    auto recovered_block_count = isolated_block_count > shared_block_count ? isolated_block_count - shared_block_count : 0;
+
+    AK::JsonObject statistics;
+    statistics.set("shared_blocks"sv, shared_block_count);
+    statistics.set("blocks_needed_with_type_isolation"sv, isolated_block_count);
+    statistics.set("recovered_bytes"sv, recovered_block_count * HeapBlock::block_size);
+    return statistics;
+}
+
+AK::JsonObject Heap::dump_memory_usage()
+{
+    struct ClassUsage {
+        size_t cell_count { 0 };
+        size_t byte_count { 0 };
+    };
+    HashMap<StringView, ClassUsage> usage_per_class;
+    size_t block_count = 0;
+    size_t live_byte_count = 0;
+
+    for_each_block([&](auto& block) {
+        ++block_count;
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            auto& usage = usage_per_class.ensure(cell->class_name());
+            ++usage.cell_count;
+            usage.byte_count += block.cell_size();
+            live_byte_count += block.cell_size();
+        });
+        return IterationDecision::Continue;
+    });
+
+    AK::JsonObject classes;
+    for (auto const& it : usage_per_class) {
+        AK::JsonObject usage;
+        usage.set("cells"sv, it.value.cell_count);
+        usage.set("bytes"sv, it.value.byte_count);
+        classes.set(it.key, move(usage));
+    }
+
+    AK::JsonObject memory_usage;
+    memory_usage.set("blocks"sv, block_count);
+    memory_usage.set("block_bytes"sv, block_count * HeapBlock::block_size);
+    memory_usage.set("live_bytes"sv, live_byte_count);
+    memory_usage.set("allocated_bytes_since_last_gc"sv, m_allocated_bytes_since_last_gc);
+    memory_usage.set("classes"sv, move(classes));
+    memory_usage.set("collections"sv, dump_collection_statistics());
+    return memory_usage;
+}
+
+AK::JsonObject Heap::dump_collection_statistics()
+{
+    auto const& statistics = m_collection_statistics;
+
+    AK::JsonObject collections_per_reason;
+    for (size_t i = 0; i < collection_reason_count; ++i)
+        collections_per_reason.set(collection_reason_name(static_cast<CollectionReason>(i)), statistics.collection_count_per_reason[i]);
+
+    AK::JsonObject pause_time_histogram;
+    for (size_t i = 0; i < statistics.pause_time_histogram.size(); ++i) {
+        auto bucket_name = i < CollectionStatistics::pause_time_bucket_limits_in_milliseconds.size()
+            ? MUST(String::formatted("under_{}ms", CollectionStatistics::pause_time_bucket_limits_in_milliseconds[i]))
+            : MUST(String::formatted("over_{}ms", CollectionStatistics::pause_time_bucket_limits_in_milliseconds.last()));
+        pause_time_histogram.set(bucket_name, statistics.pause_time_histogram[i]);
+    }
+
+    AK::JsonArray allocators;
+    for (auto& allocator : m_all_cell_allocators) {
+        auto block_count = allocator.block_count();
+        if (block_count == 0)
+            continue;
+
+        AK::JsonObject allocator_statistics;
+        allocator_statistics.set("class"sv, allocator.class_name() ? StringView { allocator.class_name(), strlen(allocator.class_name()) } : "(size-based)"sv);
+        allocator_statistics.set("cell_size"sv, allocator.cell_size());
+        allocator_statistics.set("blocks"sv, block_count);
+        allocators.must_append(move(allocator_statistics));
+    }
+
+    AK::JsonObject collection_statistics;
+    collection_statistics.set("count"sv, statistics.collection_count);
+    collection_statistics.set("count_per_reason"sv, move(collections_per_reason));
+    collection_statistics.set("total_time_ms"sv, m_total_garbage_collection_time.to_milliseconds());
+    collection_statistics.set("longest_pause_ms"sv, statistics.longest_pause.to_milliseconds());
+    collection_statistics.set("pause_time_histogram"sv, move(pause_time_histogram));
+    collection_statistics.set("bytes_allocated_before_last_collection"sv, statistics.bytes_allocated_before_last_collection);
+    collection_statistics.set("live_bytes_after_last_collection"sv, statistics.live_bytes_after_last_collection);
+    collection_statistics.set("growth_factor"sv, m_growth_factor);
+    collection_statistics.set("minimum_threshold_bytes"sv, m_minimum_collection_threshold);
+    collection_statistics.set("current_threshold_bytes"sv, m_gc_bytes_threshold);
+    collection_statistics.set("allocators"sv, move(allocators));
+    return collection_statistics;
+}
+
+static StringView heap_root_type_name(HeapRoot::Type type)
+{
+    switch (type) {
+    case HeapRoot::Type::HeapFunctionCapturedPointer:
+        return "HeapFunctionCapturedPointer"sv;
+    case HeapRoot::Type::Root:
+        return "Root"sv;
+    case HeapRoot::Type::RootVector:
+        return "RootVector"sv;
+    case HeapRoot::Type::RootHashMap:
+        return "RootHashMap"sv;
+    case HeapRoot::Type::ConservativeVector:
+        return "ConservativeVector"sv;
+    case HeapRoot::Type::RegisterPointer:
+        return "RegisterPointer"sv;
+    case HeapRoot::Type::StackPointer:
+        return "StackPointer"sv;
+    case HeapRoot::Type::VM:
+        return "VM"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Builds the compact graph needed for a V8 .heapsnapshot: nodes are numbered in the order they're
+// discovered and visited breadth-first, so each node's outgoing edges end up contiguous and in node order,
+// which is what the format requires. Node 0 is the synthetic "(GC roots)" node.
+class HeapSnapshotBuilder final : public Cell::Visitor {
+public:
+    HeapSnapshotBuilder(HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
+        : m_all_live_heap_blocks(all_live_heap_blocks)
+    {
+        m_nodes.append({ .cell = nullptr, .name_index = string_index("(GC roots)"sv) });
+        for (auto& [root, root_origin] : roots) {
+            StringBuilder name;
+            name.append(heap_root_type_name(root_origin.type));
+            if (root_origin.location)
+                name.appendff(" {} {}:{}", root_origin.location->function_name(), root_origin.location->filename(), root_origin.location->line_number());
+            add_edge(EdgeType::Internal, string_index(name.string_view()), *root);
+        }
+    }
+
+    virtual void visit_impl(Cell& cell) override
+    {
+        add_edge(EdgeType::Element, m_nodes[m_node_being_visited].edge_count, cell);
+    }
+
+    virtual void visit_possible_values(ReadonlyBytes bytes) override
+    {
+        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            auto possible_pointer = possible_pointer_from_value(raw_pointer_sized_values[i], m_all_live_heap_blocks.min_block_address(), m_all_live_heap_blocks.max_block_address());
+            if (!possible_pointer.has_value())
+                continue;
+            auto* cell = cell_from_possible_pointer(m_all_live_heap_blocks, *possible_pointer);
+            if (!cell || cell->state() != Cell::State::Live)
+                continue;
+            add_edge(EdgeType::Hidden, m_nodes[m_node_being_visited].edge_count, *cell);
+        }
+    }
+
+    void visit_all_cells()
+    {
+        // NOTE: m_nodes grows while we iterate over it, which is what makes this a breadth-first traversal.
+        for (m_node_being_visited = 1; m_node_being_visited < m_nodes.size(); ++m_node_being_visited)
+            m_nodes[m_node_being_visited].cell->visit_edges(*this);
+    }
+
+    ErrorOr<void> write(Stream& stream)
+    {
+        StringBuilder builder;
+        auto flush_if_needed = [&](bool force = false) -> ErrorOr<void> {
+            if (!force && builder.length() < 64 * KiB)
+                return {};
+            TRY(stream.write_until_depleted(builder.string_view().bytes()));
+            builder.clear();
+            return {};
+        };
+
+        builder.append(R"~~~({"snapshot":{"meta":{)~~~"sv);
+        builder.append(R"~~~("node_fields":["type","name","id","self_size","edge_count","trace_node_id","detachedness"],)~~~"sv);
+        builder.append(R"~~~("node_types":[["hidden","array","string","object","code","closure","regexp","number","native","synthetic","concatenated string","sliced string","symbol","bigint","object shape"],"string","number","number","number","number","number"],)~~~"sv);
+        builder.append(R"~~~("edge_fields":["type","name_or_index","to_node"],)~~~"sv);
+        builder.append(R"~~~("edge_types":[["context","element","property","internal","hidden","shortcut","weak"],"string_or_number","node"],)~~~"sv);
+        builder.append(R"~~~("trace_function_info_fields":[],"trace_node_fields":[],"sample_fields":[],"location_fields":[]},)~~~"sv);
+        builder.appendff(R"~~~("node_count":{},"edge_count":{},"trace_function_count":0}},)~~~", m_nodes.size(), m_edges.size());
+
+        builder.append(R"~~~("nodes":[)~~~"sv);
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            auto const& node = m_nodes[i];
+            auto type = node.cell ? NodeType::Object : NodeType::Synthetic;
+            auto self_size = node.cell ? HeapBlock::from_cell(node.cell)->cell_size() : 0;
+            // NOTE: V8 uses odd IDs for heap objects, so we do the same to keep tooling happy.
+            builder.appendff("{}{},{},{},{},{},0,0", i ? "," : "", to_underlying(type), node.name_index, i * 2 + 1, self_size, node.edge_count);
+            TRY(flush_if_needed());
+        }
+
+        builder.append(R"~~~(],"edges":[)~~~"sv);
+        for (size_t i = 0; i < m_edges.size(); ++i) {
+            auto const& edge = m_edges[i];
+            builder.appendff("{}{},{},{}", i ? "," : "", to_underlying(edge.type), edge.name_or_index, edge.to_node * node_field_count);
+            TRY(flush_if_needed());
+        }
+
+        builder.append(R"~~~(],"trace_function_infos":[],"trace_tree":[],"samples":[],"locations":[],"strings":[)~~~"sv);
+        for (size_t i = 0; i < m_strings.size(); ++i) {
+            if (i)
+                builder.append(',');
+            builder.append('"');
+            builder.append_escaped_for_json(m_strings[i]);
+            builder.append('"');
+            TRY(flush_if_needed());
+        }
+        builder.append("]}"sv);
+
+        return flush_if_needed(true);
+    }
+
+private:
+    static constexpr size_t node_field_count = 7;
+
+    enum class NodeType : u8 {
+        Object = 3,
+        Synthetic = 9,
+    };
+
+    enum class EdgeType : u8 {
+        Element = 1,
+        Internal = 3,
+        Hidden = 4,
+    };
+
+    struct Node {
+        Cell* cell { nullptr };
+        u32 name_index { 0 };
+        u32 edge_count { 0 };
+    };
+
+    struct Edge {
+        EdgeType type;
+        u32 name_or_index { 0 };
+        u32 to_node { 0 };
+    };
+
+    u32 string_index(StringView string)
+    {
+        if (auto index = m_string_indices.get(string); index.has_value())
+            return *index;
+        auto index = static_cast<u32>(m_strings.size());
+        m_strings.append(string);
+        m_string_indices.set(m_strings.last(), index);
+        return index;
+    }
+
+    u32 node_index(Cell& cell)
+    {
+        if (auto index = m_node_indices.get(&cell); index.has_value())
+            return *index;
+        auto index = static_cast<u32>(m_nodes.size());
+        m_nodes.append({ .cell = &cell, .name_index = string_index(cell.class_name()) });
+        m_node_indices.set(&cell, index);
+        return index;
+    }
+
+    void add_edge(EdgeType type, u32 name_or_index, Cell& cell)
+    {
+        auto to_node = node_index(cell);
+        m_edges.append({ .type = type, .name_or_index = name_or_index, .to_node = to_node });
+        ++m_nodes[m_node_being_visited].edge_count;
+    }
+
+    LiveHeapBlockSet const& m_all_live_heap_blocks;
+    size_t m_node_being_visited { 0 };
+    Vector<Node> m_nodes;
+    Vector<Edge> m_edges;
+    HashMap<Cell*, u32> m_node_indices;
+    Vector<ByteString> m_strings;
+    HashMap<StringView, u32> m_string_indices;
+};
+
+ErrorOr<void> Heap::write_heap_snapshot(Stream& stream)
+{
+    auto all_live_heap_blocks = gather_live_heap_blocks();
+    HashMap<Cell*, HeapRoot> roots;
+    gather_roots(roots, all_live_heap_blocks);
+    HeapSnapshotBuilder builder(roots, all_live_heap_blocks);
+    builder.visit_all_cells();
+    return builder.write(stream);
 }
 
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
+{
+    collect_garbage(collection_type, CollectionReason::Explicit, print_report);
+}
+
+void Heap::release_unused_blocks()
+{
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.block_allocator().release_unused_blocks();
+}
+
+void Heap::collect_garbage(CollectionType collection_type, CollectionReason reason, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
 
+    TRACE_EVENT("gc", "Heap::collect_garbage");
+
+    auto collection_start_time = MonotonicTime::now();
     {
         TemporaryChange change(m_collecting_garbage, true);
 
@@ -251,16 +694,37 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         if (collection_type == CollectionType::CollectGarbage) {
             if (m_gc_deferrals) {
                 m_should_gc_when_deferral_ends = true;
+                m_deferred_collection_reason = reason;
                 return;
             }
+            // NOTE: No blocks are allocated or freed until sweeping, so one snapshot of the live blocks
+            //       serves both conservative root scanning and marking.
+            auto all_live_heap_blocks = gather_live_heap_blocks();
             HashMap<Cell*, HeapRoot> roots;
-            gather_roots(roots);
-            mark_live_cells(roots);
+            gather_roots(roots, all_live_heap_blocks);
+            mark_live_cells(roots, all_live_heap_blocks);
         }
         finalize_unmarked_cells();
         sweep_dead_cells(print_report, collection_measurement_timer);
     }
 
+    auto pause_time = MonotonicTime::now() - collection_start_time;
+    m_total_garbage_collection_time += pause_time;
+
+    auto& statistics = m_collection_statistics;
+    ++statistics.collection_count;
+    ++statistics.collection_count_per_reason[to_underlying(reason)];
+    statistics.longest_pause = max(statistics.longest_pause, pause_time);
+    statistics.bytes_allocated_before_last_collection = exchange(m_allocated_bytes_since_last_collection, 0);
+
+    size_t bucket = 0;
+    while (bucket < CollectionStatistics::pause_time_bucket_limits_in_milliseconds.size() && pause_time.to_milliseconds() >= CollectionStatistics::pause_time_bucket_limits_in_milliseconds[bucket])
+        ++bucket;
+    ++statistics.pause_time_histogram[bucket];
+
+    dbgln_if(HEAP_DEBUG, "Collected garbage ({}) in {}us, {} bytes were allocated since the last collection, {} bytes are live",
+        collection_reason_name(reason), pause_time.to_microseconds(), statistics.bytes_allocated_before_last_collection, statistics.live_bytes_after_last_collection);
+
     auto tasks = move(m_post_gc_tasks);
     for (auto& task : tasks)
         task();
@@ -271,10 +735,23 @@ void Heap::enqueue_post_gc_task(AK::Function<void()> task)
     m_post_gc_tasks.append(move(task));
 }
 
-void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
+LiveHeapBlockSet Heap::gather_live_heap_blocks()
+{
+    FlatPtr min_block_address, max_block_address;
+    find_min_and_max_block_addresses(min_block_address, max_block_address);
+
+    LiveHeapBlockSet all_live_heap_blocks { min_block_address, max_block_address };
+    for_each_block([&](auto& block) {
+        all_live_heap_blocks.add(block);
+        return IterationDecision::Continue;
+    });
+    return all_live_heap_blocks;
+}
+
+void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, LiveHeapBlockSet const& all_live_heap_blocks)
 {
     m_gather_embedder_roots(roots);
-    gather_conservative_roots(roots);
+    gather_conservative_roots(roots, all_live_heap_blocks);
 
     for (auto& root : m_roots)
         roots.set(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
@@ -293,7 +770,7 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
 }
 
 #ifdef HAS_ADDRESS_SANITIZER
-NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
+NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>& roots, FlatPtr addr, LiveHeapBlockSet const& all_live_heap_blocks)
 {
     void* begin = nullptr;
     void* end = nullptr;
@@ -304,17 +781,17 @@ NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, Hea
             void const* real_address = *real_stack_addr;
             if (real_address == nullptr)
                 continue;
-            add_possible_value(possible_pointers, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
+            add_possible_root(roots, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer }, all_live_heap_blocks);
         }
     }
 }
 #else
-void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr, FlatPtr)
+void Heap::gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>&, FlatPtr, LiveHeapBlockSet const&)
 {
 }
 #endif
 
-NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots)
+NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots, LiveHeapBlockSet const& all_live_heap_blocks)
 {
     FlatPtr dummy;
 
@@ -323,57 +800,32 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     jmp_buf buf;
     setjmp(buf);
 
-    HashMap<FlatPtr, HeapRoot> possible_pointers;
-
     auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
 
-    FlatPtr min_block_address, max_block_address;
-    find_min_and_max_block_addresses(min_block_address, max_block_address);
-
     for (size_t i = 0; i < ((size_t)sizeof(buf)) / sizeof(FlatPtr); ++i)
-        add_possible_value(possible_pointers, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer }, min_block_address, max_block_address);
+        add_possible_root(roots, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer }, all_live_heap_blocks);
 
     auto stack_reference = bit_cast<FlatPtr>(&dummy);
 
     for (FlatPtr stack_address = stack_reference; stack_address < m_stack_info.top(); stack_address += sizeof(FlatPtr)) {
         auto data = *reinterpret_cast<FlatPtr*>(stack_address);
-        add_possible_value(possible_pointers, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
-        gather_asan_fake_stack_roots(possible_pointers, data, min_block_address, max_block_address);
+        add_possible_root(roots, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, all_live_heap_blocks);
+        gather_asan_fake_stack_roots(roots, data, all_live_heap_blocks);
     }
 
     for (auto& vector : m_conservative_vectors) {
         for (auto possible_value : vector.possible_values()) {
-            add_possible_value(possible_pointers, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector }, min_block_address, max_block_address);
+            add_possible_root(roots, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector }, all_live_heap_blocks);
         }
     }
-
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
-        if (cell->state() == Cell::State::Live) {
-            dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
-            roots.set(cell, *possible_pointers.get(possible_pointer));
-        } else {
-            dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
-        }
-    });
 }
 
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
         : m_heap(heap)
+        , m_all_live_heap_blocks(all_live_heap_blocks)
     {
-        m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
-
         for (auto* root : roots.keys()) {
             visit(root);
         }
@@ -391,20 +843,21 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
+        // NOTE: Unlike the graph dump, marking doesn't care about the origin of each pointer,
+        //       so we can check each value directly instead of collecting them in a HashMap first.
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            auto possible_pointer = possible_pointer_from_value(raw_pointer_sized_values[i], m_all_live_heap_blocks.min_block_address(), m_all_live_heap_blocks.max_block_address());
+            if (!possible_pointer.has_value())
+                continue;
+            auto* cell = cell_from_possible_pointer(m_all_live_heap_blocks, *possible_pointer);
+            if (!cell || cell->is_marked())
+                continue;
             if (cell->state() != Cell::State::Live)
-                return;
+                continue;
             cell->set_marked(true);
             m_work_queue.append(*cell);
-        });
+        }
     }
 
     void mark_all_live_cells()
@@ -417,16 +870,14 @@ public:
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
-    FlatPtr m_min_block_address;
-    FlatPtr m_max_block_address;
+    LiveHeapBlockSet const& m_all_live_heap_blocks;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
+void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, LiveHeapBlockSet const& all_live_heap_blocks)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
-    MarkingVisitor visitor(*this, roots);
+    MarkingVisitor visitor(*this, roots, all_live_heap_blocks);
 
     visitor.mark_all_live_cells();
 
@@ -499,6 +950,11 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
+    // Blocks that have stayed unused for a whole GC cycle are unlikely to be needed again soon,
+    // so give their memory back before returning this cycle's empty blocks to the allocators.
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.block_allocator().release_unused_blocks();
+
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
         block->cell_allocator().block_did_become_empty({}, *block);
@@ -516,7 +972,8 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    m_collection_statistics.live_bytes_after_last_collection = live_cell_bytes;
+    update_collection_threshold(live_cell_bytes);
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
@@ -549,7 +1006,7 @@ void Heap::undefer_gc()
 
     if (!m_gc_deferrals) {
         if (m_should_gc_when_deferral_ends)
-            collect_garbage();
+            collect_garbage(CollectionType::CollectGarbage, m_deferred_collection_reason, false);
         m_should_gc_when_deferral_ends = false;
     }
 }
@@ -6,14 +6,17 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/Function.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -30,6 +33,8 @@
 
 namespace GC {
 
+class LiveHeapBlockSet;
+
 class GC_API Heap : public HeapBase {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -53,12 +58,37 @@ public:
         CollectEverything,
     };
 
+    enum class CollectionReason : u8 {
+        // The bytes allocated since the last collection exceeded the threshold.
+        AllocationThreshold,
+        // The heap collects garbage on every allocation.
+        EveryAllocation,
+        // An embedder asked for the collection.
+        Explicit,
+    };
+    static constexpr size_t collection_reason_count = 3;
+    static StringView collection_reason_name(CollectionReason);
+
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
+
+    // Gives the memory of all blocks that are not in use back to the system, instead of keeping them around for reuse.
+    void release_unused_blocks();
     AK::JsonObject dump_graph();
 
+    // Reports how much of the heap is in use, in total and by the class of the live cells.
+    AK::JsonObject dump_memory_usage();
+
+    // Writes the reachable heap in the V8 .heapsnapshot format, as understood by Chrome DevTools.
+    ErrorOr<void> write_heap_snapshot(Stream&);
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
+    // When enabled, cells of types that don't require strict type isolation are allocated from
+    // size class allocators shared by all such types of the same size, instead of their own.
+    bool shares_blocks_between_types() const { return m_shares_blocks_between_types; }
+    void set_shares_blocks_between_types(bool b) { m_shares_blocks_between_types = b; }
+
     void did_create_root(Badge<RootImpl>, RootImpl&);
     void did_destroy_root(Badge<RootImpl>, RootImpl&);
 
@@ -82,6 +112,39 @@ public:
 
     void enqueue_post_gc_task(AK::Function<void()>);
 
+    // The time spent collecting garbage over the lifetime of this heap.
+    AK::Duration total_garbage_collection_time() const { return m_total_garbage_collection_time; }
+
+    struct CollectionStatistics {
+        // The upper bounds of the pause time histogram buckets, in milliseconds. Every longer pause is counted in
+        // the last bucket.
+        static constexpr Array<i64, 8> pause_time_bucket_limits_in_milliseconds { 1, 2, 4, 8, 16, 32, 64, 128 };
+
+        size_t collection_count { 0 };
+        Array<size_t, collection_reason_count> collection_count_per_reason {};
+        Array<size_t, pause_time_bucket_limits_in_milliseconds.size() + 1> pause_time_histogram {};
+        AK::Duration longest_pause;
+
+        size_t bytes_allocated_before_last_collection { 0 };
+        size_t live_bytes_after_last_collection { 0 };
+    };
+    CollectionStatistics const& collection_statistics() const { return m_collection_statistics; }
+
+    // Reports the collection statistics, along with the blocks used by every cell allocator.
+    AK::JsonObject dump_collection_statistics();
+
+    // After every collection, the next one is scheduled once the bytes allocated since exceed the live bytes times
+    // the growth factor, but never fewer than the minimum threshold. A higher factor or threshold trades memory for
+    // fewer pauses.
+    static constexpr double default_growth_factor = 1.0;
+    static constexpr size_t default_minimum_collection_threshold = 4 * MiB;
+
+    double growth_factor() const { return m_growth_factor; }
+    void set_growth_factor(double);
+
+    size_t minimum_collection_threshold() const { return m_minimum_collection_threshold; }
+    void set_minimum_collection_threshold(size_t);
+
 private:
     friend class MarkingVisitor;
     friend class GraphConstructorVisitor;
@@ -99,6 +162,10 @@ private:
         will_allocate(sizeof(T));
         if constexpr (requires { T::cell_allocator.allocator.get().allocate_cell(*this); }) {
             if constexpr (IsSame<T, typename decltype(T::cell_allocator)::CellType>) {
+                if constexpr (sizeof(T) <= max_size_class_cell_size) {
+                    if (m_shares_blocks_between_types && T::cell_allocator.isolation == TypeIsolation::Relaxed)
+                        return size_class_allocator_for_size(sizeof(T)).allocate_cell(*this);
+                }
                 return T::cell_allocator.allocator.get().allocate_cell(*this);
             }
         }
@@ -106,12 +173,17 @@ private:
     }
 
     void will_allocate(size_t);
+    void collect_garbage(CollectionType, CollectionReason, bool print_report);
+    void update_collection_threshold(size_t live_bytes);
+
+    AK::JsonObject dump_size_class_statistics();
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
-    void gather_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
+    LiveHeapBlockSet gather_live_heap_blocks();
+    void gather_roots(HashMap<Cell*, HeapRoot>&, LiveHeapBlockSet const&);
+    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, LiveHeapBlockSet const&);
+    void gather_asan_fake_stack_roots(HashMap<Cell*, HeapRoot>&, FlatPtr, LiveHeapBlockSet const&);
+    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, LiveHeapBlockSet const&);
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
 
@@ -126,6 +198,17 @@ private:
         VERIFY_NOT_REACHED();
     }
 
+    static constexpr size_t size_class_granularity = 16;
+    static constexpr size_t max_size_class_cell_size = 1024;
+
+    ALWAYS_INLINE CellAllocator& size_class_allocator_for_size(size_t cell_size)
+    {
+        auto index = ceil_div(cell_size, size_class_granularity) - 1;
+        if (!m_size_class_cell_allocators[index]) [[unlikely]]
+            m_size_class_cell_allocators[index] = make<CellAllocator>((index + 1) * size_class_granularity, "Size class");
+        return *m_size_class_cell_allocators[index];
+    }
+
     template<typename Callback>
     void for_each_block(Callback callback)
     {
@@ -135,13 +218,19 @@ private:
         }
     }
 
-    static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
-    size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
+    double m_growth_factor { default_growth_factor };
+    size_t m_minimum_collection_threshold { default_minimum_collection_threshold };
+    size_t m_gc_bytes_threshold { default_minimum_collection_threshold };
+    AK::Duration m_total_garbage_collection_time;
     size_t m_allocated_bytes_since_last_gc { 0 };
+    size_t m_allocated_bytes_since_last_collection { 0 };
+    CollectionStatistics m_collection_statistics;
 
     bool m_should_collect_on_every_allocation { false };
+    bool m_shares_blocks_between_types { false };
 
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
+    AK::Array<OwnPtr<CellAllocator>, max_size_class_cell_size / size_class_granularity> m_size_class_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
     RootImpl::List m_roots;
@@ -154,6 +243,7 @@ private:
 
     size_t m_gc_deferrals { 0 };
     bool m_should_gc_when_deferral_ends { false };
+    CollectionReason m_deferred_collection_reason { CollectionReason::Explicit };
 
     bool m_collecting_garbage { false };
     StackInfo m_stack_info;
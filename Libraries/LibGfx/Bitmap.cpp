@@ -6,8 +6,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Bitmap.h>
 #include <AK/Checked.h>
+#include <AK/SIMDExtras.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ShareableBitmap.h>
 #include <errno.h>
@@ -88,6 +90,7 @@ Bitmap::Bitmap(BitmapFormat format, AlphaType alpha_type, IntSize size, BackingS
     m_destruction_callback = [data = m_data, size_in_bytes = this->size_in_bytes()] {
         kfree_sized(data, size_in_bytes);
     };
+    did_create();
 }
 
 ErrorOr<NonnullRefPtr<Bitmap>> Bitmap::create_wrapper(BitmapFormat format, AlphaType alpha_type, IntSize size, size_t pitch, void* data, Function<void()>&& destruction_callback)
@@ -108,6 +111,7 @@ Bitmap::Bitmap(BitmapFormat format, AlphaType alpha_type, IntSize size, size_t p
     VERIFY(pitch >= minimum_pitch(size.width(), format));
     VERIFY(!size_would_overflow(format, size));
     // FIXME: assert that `data` is actually long enough!
+    did_create();
 }
 
 ErrorOr<NonnullRefPtr<Bitmap>> Bitmap::create_with_anonymous_buffer(BitmapFormat format, AlphaType alpha_type, Core::AnonymousBuffer buffer, IntSize size)
@@ -127,6 +131,26 @@ Bitmap::Bitmap(BitmapFormat format, AlphaType alpha_type, Core::AnonymousBuffer
     , m_buffer(move(buffer))
 {
     VERIFY(!size_would_overflow(format, size));
+    did_create();
+}
+
+static Atomic<size_t> s_live_bitmap_count { 0 };
+static Atomic<size_t> s_live_bitmap_size_in_bytes { 0 };
+
+void Bitmap::did_create()
+{
+    s_live_bitmap_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    s_live_bitmap_size_in_bytes.fetch_add(size_in_bytes(), AK::MemoryOrder::memory_order_relaxed);
+}
+
+size_t Bitmap::live_bitmap_count()
+{
+    return s_live_bitmap_count.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+size_t Bitmap::live_bitmap_size_in_bytes()
+{
+    return s_live_bitmap_size_in_bytes.load(AK::MemoryOrder::memory_order_relaxed);
 }
 
 ErrorOr<NonnullRefPtr<Gfx::Bitmap>> Bitmap::clone() const
@@ -194,6 +218,9 @@ ErrorOr<NonnullRefPtr<Bitmap>> Bitmap::to_bitmap_backed_by_anonymous_buffer() co
 
 Bitmap::~Bitmap()
 {
+    s_live_bitmap_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+    s_live_bitmap_size_in_bytes.fetch_sub(size_in_bytes(), AK::MemoryOrder::memory_order_relaxed);
+
     if (m_destruction_callback)
         m_destruction_callback();
     m_data = nullptr;
@@ -275,21 +302,83 @@ Bitmap::DiffResult Bitmap::diff(Bitmap const& other) const
     return result;
 }
 
+// NOTE: The alpha channel is the most significant byte of a pixel in all of our formats with an alpha channel, and the
+//       color channels are all (un)premultiplied the same way, so we don't need to care about their order here. These
+//       work on a single pixel in a u32, or on four pixels at once in a u32x4.
+template<typename T>
+ALWAYS_INLINE static T premultiply_pixels(T pixels)
+{
+    auto alpha = pixels >> 24;
+    auto channel_0 = (pixels & 0xff) * alpha / 255;
+    auto channel_1 = ((pixels >> 8) & 0xff) * alpha / 255;
+    auto channel_2 = ((pixels >> 16) & 0xff) * alpha / 255;
+    return (alpha << 24) | (channel_2 << 16) | (channel_1 << 8) | channel_0;
+}
+
+ALWAYS_INLINE static AK::SIMD::u32x4 unpremultiply_pixels(AK::SIMD::u32x4 pixels)
+{
+    using AK::SIMD::f32x4;
+    using AK::SIMD::u32x4;
+
+    auto alpha = pixels >> 24;
+
+    // NOTE: Fully transparent pixels are left as they are, which dividing by 255 instead of their alpha does for us.
+    auto divisor = __builtin_convertvector(alpha | (__builtin_convertvector(alpha == 0, u32x4) & 0xff), f32x4);
+
+    // NOTE: Both operands are small integers, so the float division truncates to the same value as an integer division.
+    auto unpremultiply = [&](u32x4 channel) {
+        return __builtin_convertvector(__builtin_convertvector(channel * 255, f32x4) / divisor, u32x4) & 0xff;
+    };
+
+    auto channel_0 = unpremultiply(pixels & 0xff);
+    auto channel_1 = unpremultiply((pixels >> 8) & 0xff);
+    auto channel_2 = unpremultiply((pixels >> 16) & 0xff);
+    return (alpha << 24) | (channel_2 << 16) | (channel_1 << 8) | channel_0;
+}
+
+ALWAYS_INLINE static u32 unpremultiply_pixels(u32 pixel)
+{
+    auto alpha = pixel >> 24;
+    if (alpha == 0)
+        return pixel;
+
+    auto channel_0 = ((pixel & 0xff) * 255 / alpha) & 0xff;
+    auto channel_1 = (((pixel >> 8) & 0xff) * 255 / alpha) & 0xff;
+    auto channel_2 = (((pixel >> 16) & 0xff) * 255 / alpha) & 0xff;
+    return (alpha << 24) | (channel_2 << 16) | (channel_1 << 8) | channel_0;
+}
+
+template<typename Callback>
+ALWAYS_INLINE static void for_each_pixel_vector_in_scanline(ARGB32* pixels, size_t count, Callback callback)
+{
+    static constexpr size_t pixels_per_vector = AK::SIMD::vector_length<AK::SIMD::u32x4>;
+
+    size_t x = 0;
+    for (; x + pixels_per_vector <= count; x += pixels_per_vector)
+        AK::SIMD::store_unaligned(pixels + x, callback(AK::SIMD::load_unaligned<AK::SIMD::u32x4>(pixels + x)));
+    for (; x < count; ++x)
+        pixels[x] = callback(static_cast<u32>(pixels[x]));
+}
+
 void Bitmap::set_alpha_type_destructive(AlphaType alpha_type)
 {
     if (alpha_type == m_alpha_type)
         return;
 
+    // NOTE: Pixels of bitmaps without an alpha channel are opaque, so they are the same with either alpha type.
+    if (!has_alpha_channel()) {
+        m_alpha_type = alpha_type;
+        return;
+    }
+
+    // OPTIMIZATION: Bitmaps are converted when they are turned into immutable bitmaps, which happens for every decoded
+    //               image, so we work on the raw pixels of whole scanlines here instead of going through Color.
     if (m_alpha_type == AlphaType::Unpremultiplied) {
-        for (auto y = 0; y < height(); ++y) {
-            for (auto x = 0; x < width(); ++x)
-                set_pixel(x, y, get_pixel(x, y).to_premultiplied());
-        }
+        for (auto y = 0; y < height(); ++y)
+            for_each_pixel_vector_in_scanline(scanline(y), width(), [](auto pixels) { return premultiply_pixels(pixels); });
     } else if (m_alpha_type == AlphaType::Premultiplied) {
-        for (auto y = 0; y < height(); ++y) {
-            for (auto x = 0; x < width(); ++x)
-                set_pixel(x, y, get_pixel(x, y).to_unpremultiplied());
-        }
+        for (auto y = 0; y < height(); ++y)
+            for_each_pixel_vector_in_scanline(scanline(y), width(), [](auto pixels) { return unpremultiply_pixels(pixels); });
     } else {
         VERIFY_NOT_REACHED();
     }
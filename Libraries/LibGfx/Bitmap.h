@@ -78,6 +78,10 @@ public:
 
     [[nodiscard]] ShareableBitmap to_shareable_bitmap() const;
 
+    // The number of bitmaps alive in this process, and the size of their pixel data. Used for memory reports.
+    [[nodiscard]] static size_t live_bitmap_count();
+    [[nodiscard]] static size_t live_bitmap_size_in_bytes();
+
     enum class MaskKind {
         Alpha,
         Luminance
@@ -171,6 +175,8 @@ private:
 
     static ErrorOr<BackingStore> allocate_backing_store(BitmapFormat format, IntSize size);
 
+    void did_create();
+
     IntSize m_size;
     void* m_data { nullptr };
     size_t m_pitch { 0 };
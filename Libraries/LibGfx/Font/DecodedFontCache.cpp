@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/Font/DecodedFontCache.h>
+
+namespace Gfx {
+
+// NOTE: Decoded fonts are much larger than the files they were decoded from, so we only keep a few around.
+static constexpr size_t max_entry_count = 32;
+
+DecodedFontCache& DecodedFontCache::the()
+{
+    static DecodedFontCache cache;
+    return cache;
+}
+
+ErrorOr<NonnullRefPtr<Typeface>> DecodedFontCache::get_or_decode(ReadonlyBytes encoded_bytes, unsigned ttc_index, Decoder const& decode)
+{
+    auto hash = Traits<ReadonlyBytes>::hash(encoded_bytes);
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto const& entry = m_entries[i];
+        if (entry.hash != hash || entry.ttc_index != ttc_index || entry.encoded_bytes.bytes() != encoded_bytes)
+            continue;
+
+        auto typeface = entry.typeface;
+        if (i != m_entries.size() - 1)
+            m_entries.append(m_entries.take(i));
+        return typeface;
+    }
+
+    auto typeface = TRY(decode());
+
+    auto encoded_bytes_copy = ByteBuffer::copy(encoded_bytes);
+    if (encoded_bytes_copy.is_error())
+        return typeface;
+
+    remove_entries_to_make_room();
+    m_entries.append({ hash, ttc_index, encoded_bytes_copy.release_value(), typeface });
+    return typeface;
+}
+
+void DecodedFontCache::remove_entries_to_make_room()
+{
+    if (m_entries.size() < max_entry_count)
+        return;
+
+    // Prefer dropping typefaces that nobody else is using anymore, as dropping those actually frees their memory.
+    if (m_entries.remove_first_matching([](auto const& entry) { return entry.typeface->ref_count() == 1; }))
+        return;
+
+    m_entries.take_first();
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/Font/Typeface.h>
+
+namespace Gfx {
+
+// Typefaces decoded from compressed font files (like WOFF and WOFF2), keyed by the contents of those files. Pages often
+// load the same web fonts again, so this lets us skip decompressing them every time they are loaded.
+class DecodedFontCache {
+public:
+    static DecodedFontCache& the();
+
+    using Decoder = Function<ErrorOr<NonnullRefPtr<Typeface>>()>;
+
+    // Returns the typeface previously decoded from the given bytes, or decodes and caches it with the given decoder.
+    ErrorOr<NonnullRefPtr<Typeface>> get_or_decode(ReadonlyBytes encoded_bytes, unsigned ttc_index, Decoder const&);
+
+    void clear() { m_entries.clear(); }
+
+private:
+    DecodedFontCache() = default;
+
+    void remove_entries_to_make_room();
+
+    struct Entry {
+        unsigned hash { 0 };
+        unsigned ttc_index { 0 };
+        ByteBuffer encoded_bytes;
+        NonnullRefPtr<Typeface> typeface;
+    };
+
+    // NOTE: Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+};
+
+}
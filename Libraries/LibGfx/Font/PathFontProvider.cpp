@@ -5,17 +5,138 @@
  */
 
 #include <AK/Format.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
 #include <AK/LexicalPath.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
 #include <LibCore/Resource.h>
+#include <LibCore/System.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 
 namespace Gfx {
 
+static constexpr i64 FONT_INDEX_VERSION = 1;
+
 PathFontProvider::PathFontProvider() = default;
 PathFontProvider::~PathFontProvider() = default;
 
+static bool is_font_file(LexicalPath const& path)
+{
+    return path.has_extension(".ttf"sv) || path.has_extension(".ttc"sv) || path.has_extension(".otf"sv) || path.has_extension(".woff"sv);
+}
+
+static ErrorOr<NonnullRefPtr<Typeface>> load_typeface(Core::Resource const& resource)
+{
+    auto uri = resource.uri();
+    if (LexicalPath(uri.bytes_as_string_view()).has_extension(".woff"sv))
+        return WOFF::try_load_from_resource(resource);
+    return Typeface::try_load_from_resource(resource);
+}
+
+void PathFontProvider::load_font_index(ByteString path)
+{
+    m_font_index_path = move(path);
+
+    auto file = Core::File::open(*m_font_index_path, Core::File::OpenMode::Read);
+    if (file.is_error())
+        return;
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error())
+        return;
+
+    auto json = JsonValue::from_string(contents.value());
+    if (json.is_error() || !json.value().is_object())
+        return;
+
+    auto const& index = json.value().as_object();
+    if (index.get_integer<i64>("version"sv) != FONT_INDEX_VERSION)
+        return;
+
+    auto fonts = index.get_object("fonts"sv);
+    if (!fonts.has_value())
+        return;
+
+    fonts->for_each_member([&](String const& uri, JsonValue const& value) {
+        if (!value.is_object())
+            return;
+        auto const& font = value.as_object();
+
+        auto modified_time = font.get_integer<i64>("modifiedTime"sv);
+        if (!modified_time.has_value())
+            return;
+
+        FontIndexEntry entry { .modified_time = *modified_time };
+        if (auto family = font.get_string("family"sv); family.has_value()) {
+            entry.family = FlyString { *family };
+            entry.weight = font.get_u16("weight"sv).value_or(0);
+            entry.width = font.get_u16("width"sv).value_or(0);
+            entry.slope = font.get_u8("slope"sv).value_or(0);
+        }
+
+        m_font_index.set(uri, move(entry));
+    });
+}
+
+void PathFontProvider::save_font_index()
+{
+    if (!m_font_index_path.has_value())
+        return;
+
+    // Forget about font files that no longer exist.
+    m_font_index.remove_all_matching([&](String const& uri, FontIndexEntry const&) {
+        if (m_font_files_seen.contains(uri))
+            return false;
+        m_font_index_changed = true;
+        return true;
+    });
+
+    if (!m_font_index_changed)
+        return;
+
+    JsonObject fonts;
+    for (auto const& [uri, entry] : m_font_index) {
+        JsonObject font;
+        font.set("modifiedTime"sv, entry.modified_time);
+        if (entry.family.has_value()) {
+            font.set("family"sv, entry.family->to_string());
+            font.set("weight"sv, entry.weight);
+            font.set("width"sv, entry.width);
+            font.set("slope"sv, entry.slope);
+        }
+        fonts.set(uri, move(font));
+    }
+
+    JsonObject index;
+    index.set("version"sv, FONT_INDEX_VERSION);
+    index.set("fonts"sv, move(fonts));
+
+    // NOTE: Several processes may save the index at the same time, so we write it to a file of our own first, and
+    //       then replace the index with it in one go.
+    auto write_index = [&]() -> ErrorOr<void> {
+        auto const& index_path = *m_font_index_path;
+        TRY(Core::Directory::create(LexicalPath { index_path }.parent(), Core::Directory::CreateDirectories::Yes));
+
+        auto temporary_path = ByteString::formatted("{}.{}", index_path, Core::System::getpid());
+        {
+            auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(index.serialized()));
+        }
+        TRY(Core::System::rename(temporary_path, index_path));
+        return {};
+    };
+
+    if (auto result = write_index(); result.is_error()) {
+        dbgln("PathFontProvider: Unable to save the font index to '{}': {}", *m_font_index_path, result.error());
+        return;
+    }
+
+    m_font_index_changed = false;
+}
+
 void PathFontProvider::load_all_fonts_from_uri(StringView uri)
 {
     auto root_or_error = Core::Resource::load_from_uri(uri);
@@ -30,36 +151,86 @@ void PathFontProvider::load_all_fonts_from_uri(StringView uri)
 
     root->for_each_descendant_file([this](Core::Resource const& resource) -> IterationDecision {
         auto uri = resource.uri();
-        auto path = LexicalPath(uri.bytes_as_string_view());
-        if (path.has_extension(".ttf"sv) || path.has_extension(".ttc"sv) || path.has_extension(".otf"sv)) {
-            if (auto font_or_error = Typeface::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
-        } else if (path.has_extension(".woff"sv)) {
-            if (auto font_or_error = WOFF::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
-        }
+        if (is_font_file(LexicalPath(uri.bytes_as_string_view())))
+            add_font_file(resource);
         return IterationDecision::Continue;
     });
 }
 
+void PathFontProvider::add_font_file(Core::Resource const& resource)
+{
+    auto uri = resource.uri();
+    auto modified_time = static_cast<i64>(resource.modified_time().value_or(0));
+
+    auto add_typeface = [&](FlyString const& family, TypefaceEntry entry) {
+        m_typeface_by_family.ensure(family, [] {
+            return Vector<TypefaceEntry> {};
+        }).append(move(entry));
+    };
+
+    // If the font file hasn't changed since it was indexed, we don't need to load it until its family is needed.
+    if (m_font_index_path.has_value()) {
+        m_font_files_seen.set(uri);
+
+        if (auto entry = m_font_index.get(uri); entry.has_value() && entry->modified_time == modified_time) {
+            if (entry->family.has_value())
+                add_typeface(*entry->family, { .uri = move(uri), .weight = entry->weight, .width = entry->width, .slope = entry->slope });
+            return;
+        }
+    }
+
+    auto typeface_or_error = load_typeface(resource);
+
+    if (m_font_index_path.has_value()) {
+        FontIndexEntry entry { .modified_time = modified_time };
+        if (!typeface_or_error.is_error()) {
+            auto const& typeface = *typeface_or_error.value();
+            entry.family = typeface.family();
+            entry.weight = typeface.weight();
+            entry.width = typeface.width();
+            entry.slope = typeface.slope();
+        }
+        m_font_index.set(uri, move(entry));
+        m_font_index_changed = true;
+    }
+
+    if (typeface_or_error.is_error())
+        return;
+
+    auto typeface = typeface_or_error.release_value();
+    add_typeface(typeface->family(), { .uri = move(uri), .weight = typeface->weight(), .width = typeface->width(), .slope = typeface->slope(), .typeface = typeface });
+}
+
+RefPtr<Typeface> PathFontProvider::typeface_for_entry(TypefaceEntry& entry)
+{
+    if (entry.typeface || entry.failed_to_load)
+        return entry.typeface;
+
+    auto typeface_or_error = [&]() -> ErrorOr<NonnullRefPtr<Typeface>> {
+        auto resource = TRY(Core::Resource::load_from_uri(entry.uri));
+        return load_typeface(*resource);
+    }();
+
+    if (typeface_or_error.is_error()) {
+        dbgln("PathFontProvider: Unable to load indexed font '{}': {}", entry.uri, typeface_or_error.error());
+        entry.failed_to_load = true;
+        return nullptr;
+    }
+
+    entry.typeface = typeface_or_error.release_value();
+    return entry.typeface;
+}
+
 RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope)
 {
     auto it = m_typeface_by_family.find(family);
     if (it == m_typeface_by_family.end())
         return nullptr;
-    for (auto const& typeface : it->value) {
-        if (typeface->weight() == weight && typeface->width() == width && typeface->slope() == slope)
-            return typeface->font(point_size);
+    for (auto& entry : it->value) {
+        if (entry.weight == weight && entry.width == width && entry.slope == slope) {
+            if (auto typeface = typeface_for_entry(entry))
+                return typeface->font(point_size);
+        }
     }
     return nullptr;
 }
@@ -69,8 +240,9 @@ void PathFontProvider::for_each_typeface_with_family_name(FlyString const& famil
     auto it = m_typeface_by_family.find(family_name);
     if (it == m_typeface_by_family.end())
         return;
-    for (auto const& typeface : it->value) {
-        callback(*typeface);
+    for (auto& entry : it->value) {
+        if (auto typeface = typeface_for_entry(entry))
+            callback(*typeface);
     }
 }
 
@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <LibCore/Forward.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/Typeface.h>
 
@@ -24,6 +27,12 @@ public:
 
     void set_name_but_fixme_should_create_custom_system_font_provider(String name) { m_name = move(name); }
 
+    // The font index remembers the family and style of the font files that have been loaded before. Font files found
+    // in the index are only loaded once a typeface of their family is needed. The index is shared by every process
+    // that uses the same index file, and should be saved once all fonts have been loaded.
+    void load_font_index(ByteString path);
+    void save_font_index();
+
     void load_all_fonts_from_uri(StringView);
 
     virtual RefPtr<Gfx::Font> get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope) override;
@@ -31,8 +40,37 @@ public:
     virtual StringView name() const override { return m_name.bytes_as_string_view(); }
 
 private:
-    HashMap<FlyString, Vector<NonnullRefPtr<Typeface>>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
+    struct TypefaceEntry {
+        String uri;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+
+        // Null until the font file has been loaded.
+        RefPtr<Typeface> typeface;
+        bool failed_to_load { false };
+    };
+
+    struct FontIndexEntry {
+        i64 modified_time { 0 };
+
+        // Empty if the font file could not be loaded.
+        Optional<FlyString> family;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+    };
+
+    void add_font_file(Core::Resource const&);
+    RefPtr<Typeface> typeface_for_entry(TypefaceEntry&);
+
+    HashMap<FlyString, Vector<TypefaceEntry>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
     String m_name { "Path"_string };
+
+    Optional<ByteString> m_font_index_path;
+    HashMap<String, FontIndexEntry> m_font_index;
+    HashTable<String> m_font_files_seen;
+    bool m_font_index_changed { false };
 };
 
 }
@@ -10,6 +10,7 @@
 
 #include <core/SkData.h>
 #include <core/SkFontMgr.h>
+#include <core/SkGraphics.h>
 #include <core/SkTypeface.h>
 #ifndef AK_OS_ANDROID
 #    include <ports/SkFontMgr_fontconfig.h>
@@ -56,6 +57,11 @@ ErrorOr<NonnullRefPtr<TypefaceSkia>> TypefaceSkia::load_from_buffer(AK::Readonly
     return adopt_ref(*new TypefaceSkia { make<TypefaceSkia::Impl>(skia_typeface), buffer, ttc_index });
 }
 
+void TypefaceSkia::purge_glyph_caches()
+{
+    SkGraphics::PurgeFontCache();
+}
+
 SkTypeface const* TypefaceSkia::sk_typeface() const
 {
     return impl().skia_typeface.get();
@@ -16,6 +16,9 @@ class TypefaceSkia : public Gfx::Typeface {
 public:
     static ErrorOr<NonnullRefPtr<TypefaceSkia>> load_from_buffer(ReadonlyBytes, int index = 0);
 
+    // Drops the glyphs Skia has rasterized for all typefaces. They are rasterized again as needed.
+    static void purge_glyph_caches();
+
     virtual u32 glyph_count() const override;
     virtual u16 units_per_em() const override;
     virtual u32 glyph_id_for_code_point(u32 code_point) const override;
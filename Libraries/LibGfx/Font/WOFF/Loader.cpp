@@ -9,6 +9,7 @@
 #include <AK/IntegralMath.h>
 #include <LibCompress/Zlib.h>
 #include <LibCore/Resource.h>
+#include <LibGfx/Font/DecodedFontCache.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 #include <LibGfx/FourCC.h>
 
@@ -102,7 +103,7 @@ struct [[gnu::packed]] TableRecord {
 };
 static_assert(AssertSize<TableRecord, 16>());
 
-ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes buffer, unsigned int index)
+static ErrorOr<NonnullRefPtr<Gfx::Typeface>> decode(ReadonlyBytes buffer, unsigned int index)
 {
     FixedMemoryStream stream(buffer);
     auto header = TRY(stream.read_value<Header>());
@@ -190,4 +191,9 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes buffer,
     return TRY(Gfx::Typeface::try_load_from_font_data(move(font_data), index));
 }
 
+ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes buffer, unsigned int index)
+{
+    return Gfx::DecodedFontCache::the().get_or_decode(buffer, index, [&] { return decode(buffer, index); });
+}
+
 }
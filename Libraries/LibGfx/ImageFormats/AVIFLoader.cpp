@@ -5,14 +5,19 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Error.h>
+#include <LibCore/System.h>
 #include <LibGfx/ImageFormats/AVIFLoader.h>
 
 #include <avif/avif.h>
 
 namespace Gfx {
 
+// The number of AVIF images being decoded in this process, used to split the available threads between them.
+static Atomic<u32> s_live_context_count { 0 };
+
 class AVIFLoadingContext {
     AK_MAKE_NONMOVABLE(AVIFLoadingContext);
     AK_MAKE_NONCOPYABLE(AVIFLoadingContext);
@@ -39,11 +44,17 @@ public:
 
     Vector<ImageFrameDescriptor> frame_descriptors;
 
-    AVIFLoadingContext() = default;
+    AVIFLoadingContext()
+    {
+        s_live_context_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+    }
+
     ~AVIFLoadingContext()
     {
         avifDecoderDestroy(decoder);
         decoder = nullptr;
+
+        s_live_context_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
     }
 };
 
@@ -73,6 +84,11 @@ static ErrorOr<void> decode_avif_header(AVIFLoadingContext& context)
         // Reason for this is that older versions of ImageMagick do not set this property, which leads to
         // broken web content if the error is not ignored.
         context.decoder->strictFlags &= ~AVIF_STRICT_PIXI_REQUIRED;
+
+        // The AV1 decoder runs its own threads, so give each image that is decoded at the same time its share of the
+        // hardware threads rather than letting every one of them start a thread per hardware thread.
+        auto live_context_count = max(s_live_context_count.load(AK::MemoryOrder::memory_order_relaxed), 1u);
+        context.decoder->maxThreads = static_cast<int>(max(Core::System::hardware_concurrency() / live_context_count, 1u));
     }
 
     avifResult result = avifDecoderSetIOMemory(context.decoder, context.data.data(), context.data.size());
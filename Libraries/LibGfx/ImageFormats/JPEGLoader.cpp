@@ -31,14 +31,30 @@ struct JPEGLoadingContext {
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode(Optional<IntSize> ideal_size);
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+// libjpeg can scale the image down by 1/2, 1/4 or 1/8 while performing the inverse DCT, which is much cheaper than
+// decoding at full size and scaling afterwards. Pick the smallest of those scales that still covers the ideal size.
+static unsigned scale_denominator_for_ideal_size(jpeg_decompress_struct const& cinfo, IntSize ideal_size)
+{
+    if (ideal_size.is_empty())
+        return 1;
+
+    for (unsigned denominator : { 8u, 4u, 2u }) {
+        auto scaled_width = ceil_div(static_cast<unsigned>(cinfo.image_width), denominator);
+        auto scaled_height = ceil_div(static_cast<unsigned>(cinfo.image_height), denominator);
+        if (scaled_width >= static_cast<unsigned>(ideal_size.width()) && scaled_height >= static_cast<unsigned>(ideal_size.height()))
+            return denominator;
+    }
+    return 1;
+}
+
+ErrorOr<void> JPEGLoadingContext::decode(Optional<IntSize> ideal_size)
 {
     struct jpeg_decompress_struct cinfo;
     ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
@@ -89,6 +105,11 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    if (ideal_size.has_value()) {
+        cinfo.scale_num = 1;
+        cinfo.scale_denom = scale_denominator_for_ideal_size(cinfo, *ideal_size);
+    }
+
     jpeg_start_decompress(&cinfo);
     bool could_read_all_scanlines = true;
 
@@ -200,7 +221,7 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -209,7 +230,7 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
     if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
+        if (auto result = m_context->decode(ideal_size); result.is_error()) {
             m_context->state = JPEGLoadingContext::State::Error;
             return result.release_error();
         }
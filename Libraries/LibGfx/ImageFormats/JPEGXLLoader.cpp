@@ -4,12 +4,38 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Error.h>
 #include <LibGfx/ImageFormats/JPEGXLLoader.h>
+#include <LibThreading/ThreadPool.h>
 #include <jxl/decode.h>
 
 namespace Gfx {
 
+// Runs the parallel parts of decoding on the thread pool shared by the process, so that concurrent decodes share its
+// workers instead of each starting threads of their own.
+static JxlParallelRetCode run_on_thread_pool(void*, void* jpegxl_opaque, JxlParallelRunInit init, JxlParallelRunFunction function, u32 start_range, u32 end_range)
+{
+    if (start_range >= end_range)
+        return JXL_PARALLEL_RET_SUCCESS;
+
+    auto& thread_pool = Threading::ThreadPool::the();
+
+    // NOTE: libjxl gives every thread ID its own scratch memory, so each of our tasks acts as one thread. The tasks take
+    //       the next value in the range until none are left, so that a slow value does not hold up the others.
+    auto task_count = min<size_t>(thread_pool.worker_count() + 1, end_range - start_range);
+    if (auto result = init(jpegxl_opaque, task_count); result != JXL_PARALLEL_RET_SUCCESS)
+        return result;
+
+    Atomic<u32> next_value { start_range };
+    thread_pool.parallel_for(task_count, [&](size_t task_index) {
+        for (auto value = next_value.fetch_add(1); value < end_range; value = next_value.fetch_add(1))
+            function(jpegxl_opaque, value, task_index);
+    });
+
+    return JXL_PARALLEL_RET_SUCCESS;
+}
+
 class JPEGXLLoadingContext {
     AK_MAKE_NONCOPYABLE(JPEGXLLoadingContext);
     AK_MAKE_NONMOVABLE(JPEGXLLoadingContext);
@@ -216,6 +242,9 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGXLImageDecoderPlugin::create(Read
     if (auto res = JxlDecoderSubscribeEvents(decoder, events); res == JXL_DEC_ERROR)
         return Error::from_string_literal("JPEGXLImageDecoderPlugin: Unable to subscribe to events.");
 
+    if (auto res = JxlDecoderSetParallelRunner(decoder, run_on_thread_pool, nullptr); res == JXL_DEC_ERROR)
+        return Error::from_string_literal("JPEGXLImageDecoderPlugin: Unable to set parallel runner.");
+
     if (auto res = JxlDecoderSetInput(decoder, data.data(), data.size()); res == JXL_DEC_ERROR)
         return Error::from_string_literal("JPEGXLImageDecoderPlugin: Unable to set decoder input.");
 
@@ -11,6 +11,7 @@
 #include <AK/NonnullOwnPtr.h>
 #include <AK/RefPtr.h>
 #include <LibGfx/Color.h>
+#include <LibGfx/Point.h>
 #include <LibGfx/Size.h>
 #include <LibGfx/SkiaBackendContext.h>
 
@@ -39,8 +40,8 @@ public:
     static NonnullRefPtr<PaintingSurface> create_from_iosurface(Core::IOSurfaceHandle&&, NonnullRefPtr<SkiaBackendContext>, Origin = Origin::TopLeft);
 #endif
 
-    void read_into_bitmap(Bitmap&);
-    void write_from_bitmap(Bitmap const&);
+    void read_into_bitmap(Bitmap&, IntPoint source_position = {});
+    void write_from_bitmap(Bitmap const&, IntPoint destination_position = {});
 
     void notify_content_will_change();
 
@@ -79,7 +79,10 @@ RefPtr<SkiaBackendContext> SkiaBackendContext::create_vulkan_context(Gfx::Vulkan
     backend_context.fVkExtensions = extensions.ptr();
 
     sk_sp<GrDirectContext> ctx = GrDirectContexts::MakeVulkan(backend_context);
-    VERIFY(ctx);
+    if (!ctx) {
+        dbgln("Failed to create Skia Vulkan context, falling back to CPU painting");
+        return {};
+    }
     return adopt_ref(*new SkiaVulkanBackendContext(ctx, move(extensions)));
 }
 #endif
@@ -120,6 +123,10 @@ RefPtr<SkiaBackendContext> SkiaBackendContext::create_metal_context(NonnullRefPt
     backend_context.fDevice.retain(metal_context->device());
     backend_context.fQueue.retain(metal_context->queue());
     sk_sp<GrDirectContext> ctx = GrDirectContexts::MakeMetal(backend_context);
+    if (!ctx) {
+        dbgln("Failed to create Skia Metal context, falling back to CPU painting");
+        return {};
+    }
     return adopt_ref(*new SkiaMetalBackendContext(move(ctx), move(metal_context)));
 }
 #endif
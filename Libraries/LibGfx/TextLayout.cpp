@@ -7,6 +7,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteBuffer.h>
+#include <AK/HashTable.h>
+#include <AK/StringHash.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
 #include <LibGfx/Point.h>
@@ -58,22 +61,92 @@ Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, UnicodeVie
 template Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint, Utf8View const&, FontCascadeList const&);
 template Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint, Utf16View const&, FontCascadeList const&);
 
+// The input handed to HarfBuzz: either UTF-8 (or ASCII) bytes, or UTF-16 code units.
+struct ShapingInput {
+    ReadonlyBytes bytes;
+    bool is_utf16 { false };
+};
+
 template<typename UnicodeView>
-static hb_buffer_t* setup_text_shaping(UnicodeView const& string, Font const& font, ShapeFeatures const& features)
+static ShapingInput shaping_input_for(UnicodeView const& string)
 {
-    static hb_buffer_t* buffer = hb_buffer_create();
-    hb_buffer_reset(buffer);
-
     if constexpr (IsSame<UnicodeView, Utf8View>) {
-        hb_buffer_add_utf8(buffer, reinterpret_cast<char const*>(string.bytes()), string.byte_length(), 0, -1);
+        return { { string.bytes(), string.byte_length() }, false };
     } else if constexpr (IsSame<UnicodeView, Utf16View>) {
         if (string.has_ascii_storage())
-            hb_buffer_add_utf8(buffer, string.ascii_span().data(), string.length_in_code_units(), 0, -1);
-        else
-            hb_buffer_add_utf16(buffer, reinterpret_cast<u16 const*>(string.utf16_span().data()), string.length_in_code_units(), 0, -1);
+            return { string.bytes(), false };
+        auto code_units = string.utf16_span();
+        return { { reinterpret_cast<u8 const*>(code_units.data()), code_units.size() * sizeof(char16_t) }, true };
     } else {
         static_assert(DependentFalse<UnicodeView>);
     }
+}
+
+struct ShapedGlyph {
+    u32 glyph_id { 0 };
+    hb_position_t x_offset { 0 };
+    hb_position_t y_offset { 0 };
+    hb_position_t x_advance { 0 };
+    hb_position_t y_advance { 0 };
+};
+
+// Shaping results are reused across layouts, e.g. when the whole document is laid out again after a viewport resize.
+// As text is shaped one word at a time by the inline layout, only short runs of text are cached, and the cache is
+// simply cleared when it becomes full.
+static constexpr size_t MAXIMUM_CACHED_TEXT_BYTE_LENGTH = 64;
+static constexpr size_t MAXIMUM_SHAPING_CACHE_SIZE = 8192;
+
+struct ShapingCacheEntry {
+    unsigned hash { 0 };
+    NonnullRefPtr<Font const> font;
+    ShapeFeatures features;
+    ByteBuffer text;
+    bool text_is_utf16 { false };
+    Vector<ShapedGlyph> glyphs;
+
+    bool matches(Font const& other_font, ShapeFeatures const& other_features, ShapingInput const& input) const
+    {
+        if (font.ptr() != &other_font || text_is_utf16 != input.is_utf16 || text.bytes() != input.bytes)
+            return false;
+        if (features.size() != other_features.size())
+            return false;
+        for (size_t i = 0; i < features.size(); ++i) {
+            if (__builtin_memcmp(features[i].tag, other_features[i].tag, sizeof(features[i].tag)) != 0 || features[i].value != other_features[i].value)
+                return false;
+        }
+        return true;
+    }
+};
+
+struct ShapingCacheEntryTraits : public DefaultTraits<NonnullOwnPtr<ShapingCacheEntry>> {
+    static unsigned hash(NonnullOwnPtr<ShapingCacheEntry> const& entry) { return entry->hash; }
+    static bool equals(NonnullOwnPtr<ShapingCacheEntry> const& a, NonnullOwnPtr<ShapingCacheEntry> const& b)
+    {
+        return a->hash == b->hash && a->matches(*b->font, b->features, { b->text.bytes(), b->text_is_utf16 });
+    }
+};
+
+static unsigned shaping_cache_hash(Font const& font, ShapeFeatures const& features, ShapingInput const& input)
+{
+    auto hash = pair_int_hash(ptr_hash(&font), string_hash(reinterpret_cast<char const*>(input.bytes.data()), input.bytes.size()));
+    hash = pair_int_hash(hash, input.is_utf16);
+    for (auto const& feature : features) {
+        hash = pair_int_hash(hash, HB_TAG(feature.tag[0], feature.tag[1], feature.tag[2], feature.tag[3]));
+        hash = pair_int_hash(hash, feature.value);
+    }
+    return hash;
+}
+
+static void shape_into(Vector<ShapedGlyph>& glyphs, ShapingInput const& input, Font const& font, ShapeFeatures const& features)
+{
+    // NOTE: The buffer is per thread, so that text can be shaped on several threads at once.
+    static thread_local hb_buffer_t* buffer = hb_buffer_create();
+    hb_buffer_reset(buffer);
+
+    if (input.is_utf16)
+        hb_buffer_add_utf16(buffer, reinterpret_cast<u16 const*>(input.bytes.data()), input.bytes.size() / sizeof(char16_t), 0, -1);
+    else
+        hb_buffer_add_utf8(buffer, reinterpret_cast<char const*>(input.bytes.data()), input.bytes.size(), 0, -1);
 
     hb_buffer_guess_segment_properties(buffer);
 
@@ -95,27 +168,67 @@ static hb_buffer_t* setup_text_shaping(UnicodeView const& string, Font const& fo
 
     hb_shape(hb_font, buffer, hb_features_data, features.size());
 
-    return buffer;
+    u32 glyph_count;
+    auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
+    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
+
+    glyphs.clear_with_capacity();
+    glyphs.ensure_capacity(glyph_count);
+    for (size_t i = 0; i < glyph_count; ++i)
+        glyphs.unchecked_append({ glyph_info[i].codepoint, positions[i].x_offset, positions[i].y_offset, positions[i].x_advance, positions[i].y_advance });
 }
 
+// NOTE: The returned glyphs are only valid until text is shaped again on the same thread.
 template<typename UnicodeView>
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+static ReadonlySpan<ShapedGlyph> shape_glyphs(UnicodeView const& string, Font const& font, ShapeFeatures const& features)
 {
-    auto* buffer = setup_text_shaping(string, font, features);
+    auto input = shaping_input_for(string);
 
-    u32 glyph_count;
-    auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
-    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
+    if (input.bytes.size() > MAXIMUM_CACHED_TEXT_BYTE_LENGTH) {
+        static thread_local auto* uncached_glyphs = new Vector<ShapedGlyph>;
+        shape_into(*uncached_glyphs, input, font, features);
+        return uncached_glyphs->span();
+    }
+
+    static thread_local auto* cache = new HashTable<NonnullOwnPtr<ShapingCacheEntry>, ShapingCacheEntryTraits>;
+
+    auto hash = shaping_cache_hash(font, features, input);
+    auto it = cache->find(hash, [&](auto const& entry) { return entry->matches(font, features, input); });
+    if (it != cache->end())
+        return (*it)->glyphs.span();
+
+    if (cache->size() >= MAXIMUM_SHAPING_CACHE_SIZE)
+        cache->clear();
+
+    auto entry = adopt_own(*new ShapingCacheEntry {
+        .hash = hash,
+        .font = font,
+        .features = features,
+        .text = MUST(ByteBuffer::copy(input.bytes)),
+        .text_is_utf16 = input.is_utf16,
+        .glyphs = {},
+    });
+    shape_into(entry->glyphs, input, font, features);
+
+    auto& glyphs = entry->glyphs;
+    cache->set(move(entry));
+    return glyphs.span();
+}
+
+template<typename UnicodeView>
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+{
+    auto shaped_glyphs = shape_glyphs(string, font, features);
 
     Vector<DrawGlyph> glyph_run;
-    glyph_run.ensure_capacity(glyph_count);
+    glyph_run.ensure_capacity(shaped_glyphs.size());
     FloatPoint point = baseline_start;
-    for (size_t i = 0; i < glyph_count; ++i) {
+    for (auto const& shaped_glyph : shaped_glyphs) {
         auto position = point
             - FloatPoint { 0, font.pixel_metrics().ascent }
-            + FloatPoint { positions[i].x_offset, positions[i].y_offset } / text_shaping_resolution;
-        glyph_run.unchecked_append({ position, glyph_info[i].codepoint });
-        point += FloatPoint { positions[i].x_advance, positions[i].y_advance } / text_shaping_resolution;
+            + FloatPoint { shaped_glyph.x_offset, shaped_glyph.y_offset } / text_shaping_resolution;
+        glyph_run.unchecked_append({ position, shaped_glyph.glyph_id });
+        point += FloatPoint { shaped_glyph.x_advance, shaped_glyph.y_advance } / text_shaping_resolution;
 
         // NOTE: The spec says that we "really should not" apply letter-spacing to the trailing edge of a line but
         //       other browsers do so we will as well. https://drafts.csswg.org/css-text/#example-7880704e
@@ -131,14 +244,9 @@ template NonnullRefPtr<GlyphRun> shape_text(FloatPoint, float, Utf16View const&,
 template<typename UnicodeView>
 float measure_text_width(UnicodeView const& string, Font const& font, ShapeFeatures const& features)
 {
-    auto* buffer = setup_text_shaping(string, font, features);
-
-    u32 glyph_count;
-    auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
-
     hb_position_t point_x = 0;
-    for (size_t i = 0; i < glyph_count; ++i)
-        point_x += positions[i].x_advance;
+    for (auto const& shaped_glyph : shape_glyphs(string, font, features))
+        point_x += shaped_glyph.x_advance;
 
     return point_x / text_shaping_resolution;
 }
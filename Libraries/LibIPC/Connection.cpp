@@ -6,15 +6,131 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
+#include <AK/HashMap.h>
+#include <AK/IntegralMath.h>
+#include <AK/QuickSort.h>
+#include <AK/Time.h>
 #include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
 #include <LibCore/Socket.h>
+#include <LibCore/System.h>
 #include <LibCore/Timer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibIPC/Connection.h>
 #include <LibIPC/Message.h>
 #include <LibIPC/Stub.h>
+#include <LibThreading/Mutex.h>
+
+#ifndef AK_OS_WINDOWS
+#    include <signal.h>
+#endif
 
 namespace IPC {
 
+// NOTE: With IPC_STATISTICS_DEBUG enabled, every connection in the process records per-message statistics, which are
+//       written to the debug log whenever the process receives SIGUSR1.
+struct MessageStatistics {
+    static constexpr size_t histogram_bucket_count = 16;
+
+    StringView name;
+    u64 sent_count { 0 };
+    u64 sent_bytes { 0 };
+    u64 received_count { 0 };
+    u64 received_bytes { 0 };
+    AK::Duration encode_time;
+    AK::Duration decode_time;
+    AK::Duration queue_delay;
+    AK::Duration handle_time;
+
+    // Bucket N counts the messages that waited less than 2^N microseconds (the last bucket counts everything else).
+    AK::Array<u64, histogram_bucket_count> queue_delay_histogram {};
+};
+
+static Threading::Mutex s_message_statistics_mutex;
+static HashMap<u64, MessageStatistics> s_message_statistics;
+static HashMap<Message const*, MonotonicTime> s_message_receive_times;
+
+static MessageStatistics& message_statistics_for(u32 endpoint_magic, int message_id)
+{
+    return s_message_statistics.ensure((static_cast<u64>(endpoint_magic) << 32) | static_cast<u32>(message_id));
+}
+
+static void record_sent_message(MessageBuffer const& buffer, AK::Duration encode_time)
+{
+    u32 endpoint_magic = 0;
+    int message_id = 0;
+    if (buffer.data().size() < sizeof(endpoint_magic) + sizeof(message_id))
+        return;
+    memcpy(&endpoint_magic, buffer.data().data(), sizeof(endpoint_magic));
+    memcpy(&message_id, buffer.data().data() + sizeof(endpoint_magic), sizeof(message_id));
+
+    Threading::MutexLocker locker(s_message_statistics_mutex);
+    auto& statistics = message_statistics_for(endpoint_magic, message_id);
+    statistics.sent_count++;
+    statistics.sent_bytes += buffer.data().size();
+    statistics.encode_time += encode_time;
+}
+
+static void record_received_message(Message const& message, size_t size_in_bytes, AK::Duration decode_time)
+{
+    Threading::MutexLocker locker(s_message_statistics_mutex);
+    auto& statistics = message_statistics_for(message.endpoint_magic(), message.message_id());
+    statistics.name = { message.message_name(), strlen(message.message_name()) };
+    statistics.received_count++;
+    statistics.received_bytes += size_in_bytes;
+    statistics.decode_time += decode_time;
+    s_message_receive_times.set(&message, MonotonicTime::now());
+}
+
+static void record_handled_message(u32 endpoint_magic, int message_id, Message const* message, MonotonicTime handle_start_time)
+{
+    Threading::MutexLocker locker(s_message_statistics_mutex);
+    auto& statistics = message_statistics_for(endpoint_magic, message_id);
+    statistics.handle_time += MonotonicTime::now() - handle_start_time;
+
+    auto receive_time = s_message_receive_times.take(message);
+    if (!receive_time.has_value())
+        return;
+
+    auto queue_delay = handle_start_time - *receive_time;
+    statistics.queue_delay += queue_delay;
+
+    auto microseconds = max<i64>(queue_delay.to_microseconds(), 1);
+    auto bucket = min(static_cast<size_t>(AK::ceil_log2(static_cast<u64>(microseconds))), MessageStatistics::histogram_bucket_count - 1);
+    statistics.queue_delay_histogram[bucket]++;
+}
+
+static void forget_message_receive_time(Message const& message)
+{
+    Threading::MutexLocker locker(s_message_statistics_mutex);
+    s_message_receive_times.remove(&message);
+}
+
+static void dump_message_statistics()
+{
+    Threading::MutexLocker locker(s_message_statistics_mutex);
+
+    Vector<MessageStatistics const*> entries;
+    for (auto const& it : s_message_statistics)
+        entries.append(&it.value);
+    quick_sort(entries, [](auto const* a, auto const* b) {
+        return (a->decode_time + a->handle_time + a->encode_time) > (b->decode_time + b->handle_time + b->encode_time);
+    });
+
+    dbgln("IPC message statistics for pid {}:", Core::System::getpid());
+    for (auto const* statistics : entries) {
+        dbgln("  {}: sent {} ({} bytes, {}us encoding), received {} ({} bytes, {}us decoding, {}us queued, {}us handling)",
+            statistics->name.is_empty() ? "(unknown)"sv : statistics->name,
+            statistics->sent_count, statistics->sent_bytes, statistics->encode_time.to_microseconds(),
+            statistics->received_count, statistics->received_bytes, statistics->decode_time.to_microseconds(),
+            statistics->queue_delay.to_microseconds(), statistics->handle_time.to_microseconds());
+
+        if (statistics->received_count > 0)
+            dbgln("    queue delay histogram (<2^N us): {}", statistics->queue_delay_histogram.span());
+    }
+}
+
 ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> transport, u32 local_endpoint_magic)
     : m_local_stub(local_stub)
     , m_transport(move(transport))
@@ -22,6 +138,14 @@ ConnectionBase::ConnectionBase(IPC::Stub& local_stub, NonnullOwnPtr<Transport> t
 {
     m_responsiveness_timer = Core::Timer::create_single_shot(3000, [this] { may_have_become_unresponsive(); });
 
+#ifndef AK_OS_WINDOWS
+    if constexpr (IPC_STATISTICS_DEBUG) {
+        static bool s_did_register_statistics_signal_handler = false;
+        if (!exchange(s_did_register_statistics_signal_handler, true))
+            Core::EventLoop::register_signal(SIGUSR1, [](int) { dump_message_statistics(); });
+    }
+#endif
+
     m_transport->set_up_read_hook([this] {
         NonnullRefPtr protect = *this;
         // FIXME: Do something about errors.
@@ -39,10 +163,27 @@ bool ConnectionBase::is_open() const
 
 ErrorOr<void> ConnectionBase::post_message(Message const& message)
 {
-    return post_message(TRY(message.encode()));
+    Core::ScopedTraceEvent trace_event { "ipc.send"sv, Core::TraceEvents::is_enabled() ? StringView { message.message_name(), strlen(message.message_name()) } : StringView {} };
+
+    if constexpr (IPC_STATISTICS_DEBUG) {
+        auto encode_start_time = MonotonicTime::now();
+        auto buffer = TRY(message.encode());
+        record_sent_message(buffer, MonotonicTime::now() - encode_start_time);
+        return post_message_without_recording_statistics(move(buffer));
+    }
+
+    return post_message_without_recording_statistics(TRY(message.encode()));
 }
 
 ErrorOr<void> ConnectionBase::post_message(MessageBuffer buffer)
+{
+    if constexpr (IPC_STATISTICS_DEBUG)
+        record_sent_message(buffer, {});
+
+    return post_message_without_recording_statistics(move(buffer));
+}
+
+ErrorOr<void> ConnectionBase::post_message_without_recording_statistics(MessageBuffer buffer)
 {
     // NOTE: If this connection is being shut down, but has not yet been destroyed,
     //       the socket will be closed. Don't try to send more messages.
@@ -72,7 +213,19 @@ void ConnectionBase::handle_messages()
     auto messages = move(m_unprocessed_messages);
     for (auto& message : messages) {
         if (message->endpoint_magic() == m_local_endpoint_magic) {
+            Optional<MonotonicTime> handle_start_time;
+            [[maybe_unused]] auto message_id = message->message_id();
+            [[maybe_unused]] auto const* message_pointer = message.ptr();
+            if constexpr (IPC_STATISTICS_DEBUG)
+                handle_start_time = MonotonicTime::now();
+
+            Core::ScopedTraceEvent trace_event { "ipc.receive"sv, Core::TraceEvents::is_enabled() ? StringView { message->message_name(), strlen(message->message_name()) } : StringView {} };
+
             auto handler_result = m_local_stub.handle(move(message));
+
+            if constexpr (IPC_STATISTICS_DEBUG)
+                record_handled_message(m_local_endpoint_magic, message_id, message_pointer, *handle_start_time);
+
             if (handler_result.is_error()) {
                 dbgln("IPC::ConnectionBase::handle_messages: {}", handler_result.error());
                 continue;
@@ -95,7 +248,13 @@ void ConnectionBase::wait_for_transport_to_become_readable()
 ErrorOr<void> ConnectionBase::drain_messages_from_peer()
 {
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
+        Optional<MonotonicTime> decode_start_time;
+        if constexpr (IPC_STATISTICS_DEBUG)
+            decode_start_time = MonotonicTime::now();
+
         if (auto message = try_parse_message(raw_message.bytes, raw_message.fds)) {
+            if constexpr (IPC_STATISTICS_DEBUG)
+                record_received_message(*message, raw_message.bytes.size(), MonotonicTime::now() - *decode_start_time);
             m_unprocessed_messages.append(message.release_nonnull());
         } else {
             dbgln("Failed to parse IPC message {:hex-dump}", raw_message.bytes);
@@ -128,8 +287,11 @@ OwnPtr<IPC::Message> ConnectionBase::wait_for_specific_endpoint_message_impl(u32
             auto& message = m_unprocessed_messages[i];
             if (message->endpoint_magic() != endpoint_magic)
                 continue;
-            if (message->message_id() == message_id)
+            if (message->message_id() == message_id) {
+                if constexpr (IPC_STATISTICS_DEBUG)
+                    forget_message_receive_time(*message);
                 return m_unprocessed_messages.take(i);
+            }
         }
 
         if (!is_open())
@@ -47,6 +47,8 @@ protected:
 
     void handle_messages();
 
+    ErrorOr<void> post_message_without_recording_statistics(MessageBuffer);
+
     IPC::Stub& m_local_stub;
 
     NonnullOwnPtr<Transport> m_transport;
@@ -12,10 +12,12 @@
 
 namespace IPC {
 
-void SendQueue::enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds)
+void SendQueue::enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, Vector<int>&& fds)
 {
     Threading::MutexLocker locker(m_mutex);
-    VERIFY(MUST(m_stream.write_some(bytes.span())) == bytes.size());
+    VERIFY(MUST(m_stream.write_some(header)) == header.size());
+    if (!payload.is_empty())
+        VERIFY(MUST(m_stream.write_some(payload)) == payload.size());
     m_fds.append(fds.data(), fds.size());
     m_condition.signal();
 }
@@ -67,7 +69,7 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
             if (send_queue->block_until_message_enqueued() == SendQueue::Running::No)
                 break;
 
-            auto [bytes, fds] = send_queue->peek(4096);
+            auto [bytes, fds] = send_queue->peek(SOCKET_BUFFER_SIZE);
             ReadonlyBytes remaining_bytes_to_send = bytes;
 
             if (transfer_data(remaining_bytes_to_send, fds) == TransferState::SocketClosed)
@@ -152,27 +154,18 @@ struct MessageHeader {
     u32 payload_size { 0 };
     u32 fd_count { 0 };
 
-    static Vector<u8> encode_with_payload(MessageHeader header, ReadonlyBytes payload)
-    {
-        Vector<u8> message_buffer;
-        message_buffer.resize(sizeof(MessageHeader) + payload.size());
-        memcpy(message_buffer.data(), &header, sizeof(MessageHeader));
-        memcpy(message_buffer.data() + sizeof(MessageHeader), payload.data(), payload.size());
-        return message_buffer;
-    }
+    ReadonlyBytes bytes() const { return { reinterpret_cast<u8 const*>(this), sizeof(MessageHeader) }; }
 };
 
 void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
 {
     auto num_fds_to_transfer = fds.size();
 
-    auto message_buffer = MessageHeader::encode_with_payload(
-        {
-            .type = MessageHeader::Type::Payload,
-            .payload_size = static_cast<u32>(bytes_to_write.size()),
-            .fd_count = static_cast<u32>(num_fds_to_transfer),
-        },
-        bytes_to_write);
+    MessageHeader header {
+        .type = MessageHeader::Type::Payload,
+        .payload_size = static_cast<u32>(bytes_to_write.size()),
+        .fd_count = static_cast<u32>(num_fds_to_transfer),
+    };
 
     for (auto const& fd : fds)
         m_fds_retained_until_received_by_peer.enqueue(fd);
@@ -185,7 +178,8 @@ void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Nonn
         }
     }
 
-    m_send_queue->enqueue_message(move(message_buffer), move(raw_fds));
+    // NOTE: The header and payload go straight into the send queue, without assembling them in a temporary buffer first.
+    m_send_queue->enqueue_message(header.bytes(), bytes_to_write, move(raw_fds));
 }
 
 ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyBytes& bytes_to_write, Vector<int>& unowned_fds)
@@ -242,6 +236,11 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
     if (!m_socket->is_open())
         return TransferState::SocketClosed;
 
+    // OPTIMIZATION: Only wait for the socket to become writable if it couldn't take everything we had. Otherwise we go
+    //               straight back to the send queue, which picks up everything that was enqueued in the meantime as one batch.
+    if (bytes.is_empty() && fds.is_empty())
+        return TransferState::Continue;
+
     {
         Vector<struct pollfd, 1> pollfds;
         pollfds.append({ .fd = m_socket->fd().value(), .events = POLLOUT, .revents = 0 });
@@ -261,9 +260,12 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
 
     bool should_shutdown = false;
     while (is_open()) {
-        u8 buffer[4096];
+        // OPTIMIZATION: Receive straight into the unprocessed bytes buffer, instead of going through a small buffer on the stack.
+        auto unprocessed_byte_count = m_unprocessed_bytes.size();
+        auto buffer = m_unprocessed_bytes.must_get_bytes_for_writing(64 * KiB);
         auto received_fds = Vector<int> {};
-        auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
+        auto maybe_bytes_read = m_socket->receive_message(buffer, MSG_DONTWAIT, received_fds);
+        m_unprocessed_bytes.set_size(unprocessed_byte_count + (maybe_bytes_read.is_error() ? 0 : maybe_bytes_read.value().size()));
         if (maybe_bytes_read.is_error()) {
             auto error = maybe_bytes_read.release_error();
 
@@ -286,7 +288,6 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
             break;
         }
 
-        m_unprocessed_bytes.append(bytes_read.data(), bytes_read.size());
         for (auto const& fd : received_fds) {
             m_unprocessed_fds.enqueue(File::adopt_fd(fd));
         }
@@ -307,7 +308,7 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
             received_fd_count += header.fd_count;
             for (size_t i = 0; i < header.fd_count; ++i)
                 message.fds.enqueue(m_unprocessed_fds.dequeue());
-            message.bytes.append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.payload_size);
+            message.bytes = m_unprocessed_bytes.span().slice(index + sizeof(MessageHeader), header.payload_size);
             callback(move(message));
         } else if (header.type == MessageHeader::Type::FileDescriptorAcknowledgement) {
             VERIFY(header.payload_size == 0);
@@ -329,21 +330,21 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
     }
 
     if (received_fd_count > 0) {
-        Vector<u8> message_buffer;
-        message_buffer.resize(sizeof(MessageHeader));
         MessageHeader header;
         header.payload_size = 0;
         header.fd_count = received_fd_count;
         header.type = MessageHeader::Type::FileDescriptorAcknowledgement;
-        memcpy(message_buffer.data(), &header, sizeof(MessageHeader));
-        m_send_queue->enqueue_message(move(message_buffer), {});
+        m_send_queue->enqueue_message(header.bytes(), {}, {});
     }
 
-    if (index < m_unprocessed_bytes.size()) {
-        auto remaining_bytes = MUST(ByteBuffer::copy(m_unprocessed_bytes.span().slice(index)));
-        m_unprocessed_bytes = move(remaining_bytes);
-    } else {
+    if (index >= m_unprocessed_bytes.size()) {
         m_unprocessed_bytes.clear();
+    } else if (index > 0) {
+        // NOTE: Move the remainder to the front in place. When a large message arrives over many reads, this avoids
+        //       reallocating and copying everything received so far every time we get woken up.
+        auto remaining_byte_count = m_unprocessed_bytes.size() - index;
+        memmove(m_unprocessed_bytes.data(), m_unprocessed_bytes.data() + index, remaining_byte_count);
+        m_unprocessed_bytes.trim(remaining_byte_count, false);
     }
 
     return ShouldShutdown::No;
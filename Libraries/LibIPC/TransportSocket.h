@@ -28,7 +28,7 @@ public:
     Running block_until_message_enqueued();
     void stop();
 
-    void enqueue_message(Vector<u8>&& bytes, Vector<int>&& fds);
+    void enqueue_message(ReadonlyBytes header, ReadonlyBytes payload, Vector<int>&& fds);
     struct BytesAndFds {
         Vector<u8> bytes;
         Vector<int> fds;
@@ -69,7 +69,8 @@ public:
         Yes,
     };
     struct Message {
-        Vector<u8> bytes;
+        // NOTE: This points into the transport's receive buffer, and is only valid until the callback returns.
+        ReadonlyBytes bytes;
         Queue<File> fds;
     };
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
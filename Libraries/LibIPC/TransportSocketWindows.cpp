@@ -189,7 +189,7 @@ TransportSocketWindows::ShouldShutdown TransportSocketWindows::read_as_many_mess
         if (header.size + sizeof(MessageHeader) > m_unprocessed_bytes.size() - index)
             break;
         Message message;
-        message.bytes.append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.size);
+        message.bytes = m_unprocessed_bytes.span().slice(index + sizeof(MessageHeader), header.size);
         callback(move(message));
         index += header.size + sizeof(MessageHeader);
     }
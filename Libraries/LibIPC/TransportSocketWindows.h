@@ -35,7 +35,8 @@ public:
         Yes,
     };
     struct Message {
-        Vector<u8> bytes;
+        // NOTE: This points into the transport's receive buffer, and is only valid until the callback returns.
+        ReadonlyBytes bytes;
         Queue<File> fds; // always empty, present to avoid OS #ifdefs in Connection.cpp
     };
     ShouldShutdown read_as_many_messages_as_possible_without_blocking(Function<void(Message&&)>&&);
@@ -22,7 +22,7 @@ void Client::die()
     m_pending_decoded_images.clear();
 }
 
-NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool first_frame_only)
 {
     auto promise = Core::Promise<DecodedImage>::construct();
     if (on_resolved)
@@ -45,7 +45,7 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
 
     memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
 
-    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type);
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type, first_frame_only);
     if (!response) {
         dbgln("ImageDecoder disconnected trying to decode image");
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
@@ -501,7 +501,7 @@ static Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> arguments_to_arr
 
     auto first_spread = find_if(arguments.begin(), arguments.end(), [](auto el) { return el.is_spread; });
 
-    Vector<ScopedOperand> args;
+    Vector<ScopedOperand, 8> args;
     args.ensure_capacity(first_spread.index());
     for (auto it = arguments.begin(); it != first_spread; ++it) {
         VERIFY(!it->is_spread);
@@ -1226,7 +1226,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> ArrayExpression::genera
 
     auto first_spread = find_if(m_elements.begin(), m_elements.end(), [](auto el) { return el && is<SpreadExpression>(*el); });
 
-    Vector<ScopedOperand> args;
+    Vector<ScopedOperand, 8> args;
     args.ensure_capacity(m_elements.size());
     for (auto it = m_elements.begin(); it != first_spread; ++it) {
         if (*it) {
@@ -1779,7 +1779,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
         auto arguments = TRY(arguments_to_array_for_call(generator, this->arguments())).value();
         generator.emit<Bytecode::Op::CallWithArgumentArray>(call_type, dst, callee, this_value, arguments, expression_string_index);
     } else {
-        Vector<ScopedOperand> argument_operands;
+        Vector<ScopedOperand, 8> argument_operands;
         argument_operands.ensure_capacity(arguments().size());
         for (auto const& argument : arguments()) {
             auto argument_value = TRY(argument.value->generate_bytecode(generator)).value();
@@ -11,15 +11,25 @@ namespace JS::Bytecode {
 
 Optional<Builtin> get_builtin(MemberExpression const& expression)
 {
-    if (expression.is_computed() || !expression.object().is_identifier() || !expression.property().is_identifier())
+    if (expression.is_computed() || !expression.property().is_identifier())
         return {};
-    auto base_name = static_cast<Identifier const&>(expression.object()).string();
     auto property_name = static_cast<Identifier const&>(expression.property()).string();
+
+    if (expression.object().is_identifier()) {
+        auto base_name = static_cast<Identifier const&>(expression.object()).string();
 #define CHECK_MEMBER_BUILTIN(name, snake_case_name, base, property, ...) \
     if (base_name == #base##sv && property_name == #property##sv)        \
         return Builtin::name;
-    JS_ENUMERATE_BUILTINS(CHECK_MEMBER_BUILTIN)
+        JS_ENUMERATE_BUILTINS(CHECK_MEMBER_BUILTIN)
 #undef CHECK_MEMBER_BUILTIN
+    }
+
+#define CHECK_PROTOTYPE_METHOD_BUILTIN(name, snake_case_name, base, property, ...) \
+    if (property_name == #property##sv)                                            \
+        return Builtin::name;
+    JS_ENUMERATE_PROTOTYPE_METHOD_BUILTINS(CHECK_PROTOTYPE_METHOD_BUILTIN)
+#undef CHECK_PROTOTYPE_METHOD_BUILTIN
+
     return {};
 }
 
@@ -8,6 +8,7 @@
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
 
@@ -39,11 +40,21 @@ Executable::Executable(
     global_variable_caches.resize(number_of_global_variable_caches);
 }
 
-Executable::~Executable() = default;
+Executable::~Executable()
+{
+    if (m_list_node.is_in_list())
+        m_list_node.remove();
+}
 
 void Executable::dump() const
 {
     warnln("\033[37;1mJS bytecode executable\033[0m \"{}\"", name);
+
+    size_t instruction_count = 0;
+    for (InstructionStreamIterator it(bytecode, this); !it.at_end(); ++it)
+        ++instruction_count;
+    warnln("{} instructions ({} before optimization)", instruction_count, unoptimized_instruction_count);
+
     InstructionStreamIterator it(bytecode, this);
 
     size_t basic_block_offset_index = 0;
@@ -84,6 +95,33 @@ void Executable::dump() const
     warnln("");
 }
 
+void Executable::dump_profile(StringBuilder& builder) const
+{
+    Optional<u32> source_start_offset;
+    for (auto const& it : source_map) {
+        if (!source_start_offset.has_value() || it.value.source_start_offset < *source_start_offset)
+            source_start_offset = it.value.source_start_offset;
+    }
+
+    builder.appendff("\"{}\"", name.is_empty() ? "<anonymous>"_utf16_fly_string : name);
+    if (source_start_offset.has_value()) {
+        auto range = source_code->range_from_offsets(*source_start_offset, *source_start_offset);
+        builder.appendff(" ({}:{}:{})", source_code->filename(), range.start.line, range.start.column);
+    }
+    builder.appendff(": {} invocations, {} back edges\n", invocation_count, back_edge_count);
+
+    auto dump_cache = [&](StringView kind, size_t index, PropertyLookupCache const& cache) {
+        auto lookups = cache.hit_count + cache.miss_count;
+        if (lookups == 0)
+            return;
+        builder.appendff("    {} cache #{}: {} hits, {} misses ({:.1}% hit rate)\n", kind, index, cache.hit_count, cache.miss_count, 100.0 * cache.hit_count / lookups);
+    };
+    for (size_t i = 0; i < property_lookup_caches.size(); ++i)
+        dump_cache("Property lookup"sv, i, property_lookup_caches[i]);
+    for (size_t i = 0; i < global_variable_caches.size(); ++i)
+        dump_cache("Global variable"sv, i, global_variable_caches[i]);
+}
+
 void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -115,4 +153,28 @@ UnrealizedSourceRange Executable::source_range_at(size_t offset) const
     };
 }
 
+Optional<u32> MegamorphicPropertyLookupCache::lookup(Shape const& shape, Utf16FlyString const& property_name)
+{
+    auto& set = set_for(shape, property_name);
+    for (size_t i = 0; i < ways_per_set; ++i) {
+        auto& entry = set[i];
+        if (&shape != entry.shape.ptr() || entry.property_name != property_name)
+            continue;
+        auto property_offset = entry.property_offset;
+        // Keep the most recently used entry first so that insert() evicts the least recently used one.
+        if (i != 0)
+            swap(set[0], set[i]);
+        return property_offset;
+    }
+    return {};
+}
+
+void MegamorphicPropertyLookupCache::insert(Shape& shape, Utf16FlyString const& property_name, u32 property_offset)
+{
+    auto& set = set_for(shape, property_name);
+    for (size_t i = ways_per_set - 1; i >= 1; --i)
+        set[i] = move(set[i - 1]);
+    set[0] = { shape, property_name, property_offset };
+}
+
 }
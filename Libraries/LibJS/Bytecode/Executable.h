@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
 #include <AK/Utf16FlyString.h>
@@ -34,6 +35,10 @@ struct PropertyLookupCache {
         WeakPtr<PrototypeChainValidity> prototype_chain_validity;
     };
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    // Profiling counters, reported by Executable::dump_profile().
+    u32 hit_count { 0 };
+    u32 miss_count { 0 };
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -43,6 +48,33 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// A small set-associative (shape, property name) -> property offset table shared by all executables.
+// Sites that have seen more shapes than their PropertyLookupCache can remember fall back to this
+// before doing a full property lookup. Each set is kept in least-recently-used order.
+class MegamorphicPropertyLookupCache {
+public:
+    static constexpr size_t number_of_sets = 1024;
+    static constexpr size_t ways_per_set = 2;
+
+    Optional<u32> lookup(Shape const&, Utf16FlyString const& property_name);
+    void insert(Shape&, Utf16FlyString const& property_name, u32 property_offset);
+
+private:
+    struct Entry {
+        WeakPtr<Shape> shape;
+        Utf16FlyString property_name;
+        u32 property_offset { 0 };
+    };
+    using Set = AK::Array<Entry, ways_per_set>;
+
+    Set& set_for(Shape const& shape, Utf16FlyString const& property_name)
+    {
+        return m_sets[pair_int_hash(ptr_hash(&shape), property_name.hash()) % number_of_sets];
+    }
+
+    AK::Array<Set, number_of_sets> m_sets;
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -80,6 +112,10 @@ public:
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
 
+    // Hotness counters, meant to drive tier-up decisions and bytecode profiling reports.
+    u64 invocation_count { 0 };
+    u64 back_edge_count { 0 };
+
     struct ExceptionHandlers {
         size_t start_offset;
         size_t end_offset;
@@ -98,6 +134,9 @@ public:
 
     Optional<IdentifierTableIndex> length_identifier;
 
+    // Only computed when dumping bytecode, to show the effect of the optimization passes.
+    size_t unoptimized_instruction_count { 0 };
+
     Utf16String const& get_string(StringTableIndex index) const { return string_table->get(index); }
     Utf16FlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
 
@@ -113,9 +152,15 @@ public:
     [[nodiscard]] UnrealizedSourceRange source_range_at(size_t offset) const;
 
     void dump() const;
+    void dump_profile(StringBuilder&) const;
 
 private:
     virtual void visit_edges(Visitor&) override;
+
+    IntrusiveListNode<Executable> m_list_node;
+
+public:
+    using List = IntrusiveList<&Executable::m_list_node>;
 };
 
 }
@@ -10,6 +10,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -215,6 +216,78 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(E
     return {};
 }
 
+static Optional<Label> forwarding_target(BasicBlock const& block)
+{
+    // NOTE: Jump is a terminator, so a block that starts with one consists of nothing else.
+    InstructionStreamIterator it(block.instruction_stream());
+    if (it.at_end() || (*it).type() != Instruction::Type::Jump)
+        return {};
+    return static_cast<Op::Jump const&>(*it).target();
+}
+
+// Pass: Retarget labels that point at blocks consisting of nothing but an unconditional jump.
+static void thread_jumps(Vector<NonnullOwnPtr<BasicBlock>>& basic_blocks)
+{
+    for (auto& block : basic_blocks) {
+        InstructionStreamIterator it(block->instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                // NOTE: The hop limit protects us against cycles of jump-only blocks (e.g. `for (;;) {}`).
+                for (size_t hops = 0; hops < basic_blocks.size(); ++hops) {
+                    auto target = forwarding_target(*basic_blocks[label.basic_block_index()]);
+                    if (!target.has_value() || target->basic_block_index() == label.basic_block_index())
+                        break;
+                    label = *target;
+                }
+            });
+            ++it;
+        }
+    }
+}
+
+// Pass: Find the blocks that can be reached from the entry block, either through a label or by being an exception handler.
+static Vector<bool> find_reachable_blocks(Vector<NonnullOwnPtr<BasicBlock>> const& basic_blocks)
+{
+    Vector<bool> reachable;
+    reachable.resize(basic_blocks.size());
+
+    Vector<size_t> worklist;
+    auto mark_reachable = [&](size_t index) {
+        if (reachable[index])
+            return;
+        reachable[index] = true;
+        worklist.append(index);
+    };
+    mark_reachable(0);
+
+    while (!worklist.is_empty()) {
+        auto& block = *basic_blocks[worklist.take_last()];
+        if (block.handler())
+            mark_reachable(block.handler()->index());
+        if (block.finalizer())
+            mark_reachable(block.finalizer()->index());
+
+        InstructionStreamIterator it(block.instruction_stream());
+        while (!it.at_end()) {
+            const_cast<Instruction&>(*it).visit_labels([&](Label& label) {
+                mark_reachable(label.basic_block_index());
+            });
+            ++it;
+        }
+    }
+
+    return reachable;
+}
+
+static size_t count_instructions(ReadonlyBytes instruction_stream)
+{
+    size_t count = 0;
+    for (InstructionStreamIterator it(instruction_stream); !it.at_end(); ++it)
+        ++count;
+    return count;
+}
+
 CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<ECMAScriptFunctionObject const> function, MustPropagateCompletion must_propagate_completion, Vector<LocalVariable> local_variable_names)
 {
     Generator generator(vm, function, must_propagate_completion);
@@ -304,6 +377,18 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         }
     }
 
+    size_t unoptimized_instruction_count = 0;
+    if (g_dump_bytecode) {
+        for (auto& block : generator.m_root_basic_blocks)
+            unoptimized_instruction_count += count_instructions(block->instruction_stream());
+    }
+
+    Vector<bool> reachable_blocks;
+    if (g_optimize_bytecode) {
+        thread_jumps(generator.m_root_basic_blocks);
+        reachable_blocks = find_reachable_blocks(generator.m_root_basic_blocks);
+    }
+
     auto number_of_registers = generator.m_next_register;
     auto number_of_constants = generator.m_constants.size();
     auto number_of_locals = function ? function->local_variables_names().size() : 0;
@@ -341,6 +426,10 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         undefined_constant.value().operand().offset_index_by(number_of_registers);
 
     for (auto& block : generator.m_root_basic_blocks) {
+        // OPTIMIZATION: Nothing can jump to unreachable blocks, so we don't have to emit them at all.
+        if (!reachable_blocks.is_empty() && !reachable_blocks[block->index()])
+            continue;
+
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
             unlinked_exception_handlers.append({
@@ -454,6 +543,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         generator.m_next_global_variable_cache,
         generator.m_next_register,
         is_strict_mode);
+    vm.bytecode_interpreter().did_create_executable({}, *executable);
 
     Vector<Executable::ExceptionHandlers> linked_exception_handlers;
 
@@ -476,6 +566,8 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     executable->local_index_base = number_of_registers + number_of_constants;
     executable->argument_index_base = number_of_registers + number_of_constants + number_of_locals;
     executable->length_identifier = generator.m_length_identifier;
+    if (g_dump_bytecode)
+        executable->unoptimized_instruction_count = unoptimized_instruction_count;
 
     generator.m_finished = true;
 
@@ -555,25 +647,30 @@ Label Generator::nearest_continuable_scope() const
 
 bool Generator::emit_block_declaration_instantiation(ScopeNode const& scope_node)
 {
-    bool needs_block_declaration_instantiation = false;
+    bool has_function_declarations = false;
+    bool needs_environment = false;
     MUST(scope_node.for_each_lexically_scoped_declaration([&](Declaration const& declaration) {
-        if (declaration.is_function_declaration()) {
-            needs_block_declaration_instantiation = true;
-            return;
-        }
+        if (declaration.is_function_declaration())
+            has_function_declarations = true;
         MUST(declaration.for_each_bound_identifier([&](auto const& id) {
             if (!id.is_local())
-                needs_block_declaration_instantiation = true;
+                needs_environment = true;
         }));
     }));
 
-    if (!needs_block_declaration_instantiation)
+    // OPTIMIZATION: If every binding of the block is a local, its environment would always stay empty. Functions declared
+    //               in the block can't refer to any of its bindings either, since a binding captured by a nested function
+    //               is never a local, so we let them close over the surrounding environment instead.
+    if (!needs_environment) {
+        if (has_function_declarations)
+            emit<Bytecode::Op::BlockDeclarationInstantiation>(scope_node, false);
         return false;
+    }
 
     // FIXME: Generate the actual bytecode for block declaration instantiation
     //        and get rid of the BlockDeclarationInstantiation instruction.
     start_boundary(BlockBoundaryType::LeaveLexicalEnvironment);
-    emit<Bytecode::Op::BlockDeclarationInstantiation>(scope_node);
+    emit<Bytecode::Op::BlockDeclarationInstantiation>(scope_node, true);
     return true;
 }
 
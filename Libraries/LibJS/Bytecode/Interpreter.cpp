@@ -7,6 +7,7 @@
 
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <AK/TemporaryChange.h>
 #include <LibGC/RootHashMap.h>
 #include <LibJS/AST.h>
@@ -20,6 +21,7 @@
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayPrototype.h>
 #include <LibJS/Runtime/BigInt.h>
 #include <LibJS/Runtime/CompletionCell.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
@@ -33,10 +35,13 @@
 #include <LibJS/Runtime/MathObject.h>
 #include <LibJS/Runtime/ModuleEnvironment.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/ObjectConstructor.h>
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -71,6 +76,7 @@ struct Traits<JS::PropertyKeyAndEnumerableFlag> : public DefaultTraits<JS::Prope
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_optimize_bytecode = true;
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -226,7 +232,11 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
     Completion result = instantiation_result.is_throw_completion() ? instantiation_result.throw_completion() : normal_completion(js_undefined());
 
     GC::Ptr<Executable> executable;
-    if (result.type() == Completion::Type::Normal) {
+    if (result.type() == Completion::Type::Normal && script.bytecode_executable()) {
+        // OPTIMIZATION: Parse trees can be shared between scripts (see Script::parse), in which case we can reuse
+        //               the bytecode generated the first time around.
+        executable = script.bytecode_executable();
+    } else if (result.type() == Completion::Type::Normal) {
         auto executable_result = JS::Bytecode::Generator::generate_from_ast_node(vm, script, {});
 
         if (executable_result.is_error()) {
@@ -238,6 +248,7 @@ ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environ
                 result = vm.template throw_completion<JS::InternalError>(error_string.release_value());
         } else {
             executable = executable_result.release_value();
+            const_cast<Program&>(script).set_bytecode_executable(executable);
 
             if (g_dump_bytecode)
                 executable->dump();
@@ -366,6 +377,18 @@ NEVER_INLINE Interpreter::HandleExceptionResponse Interpreter::handle_exception(
 #    define FLATTEN_ON_CLANG
 #endif
 
+ALWAYS_INLINE void Interpreter::take_sample_if_requested()
+{
+    if (m_sampling_profiler && m_sampling_profiler->is_sample_requested()) [[unlikely]]
+        m_sampling_profiler->take_sample();
+}
+
+ALWAYS_INLINE void Interpreter::count_op(Instruction::Type type)
+{
+    if constexpr (JS_BYTECODE_OP_COUNTS_DEBUG)
+        ++m_op_counts[to_underlying(type)];
+}
+
 FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 {
     if (vm().did_reach_stack_space_limit()) [[unlikely]] {
@@ -373,6 +396,8 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         return;
     }
 
+    take_sample_if_requested();
+
     auto& running_execution_context = this->running_execution_context();
     auto& executable = current_executable();
     auto const* bytecode = executable.bytecode.data();
@@ -397,12 +422,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         else                                                                                        \
             program_counter += sizeof(Op::name);                                                    \
         auto& next_instruction = *reinterpret_cast<Instruction const*>(&bytecode[program_counter]); \
+        count_op(next_instruction.type());                                                          \
         goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
     } while (0)
 
     for (;;) {
     start:
         for (;;) {
+            count_op((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type());
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
         handle_Mov: {
@@ -417,36 +444,42 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             return;
         }
 
+    // Every loop iteration ends with a jump to an earlier offset, which makes backward jumps
+    // a cheap way to measure how hot the loops in this executable are.
+#define JUMP_TO(target_address)            \
+    do {                                   \
+        auto target = (target_address);    \
+        if (target <= program_counter) {   \
+            ++executable.back_edge_count;  \
+            take_sample_if_requested();    \
+        }                                  \
+        program_counter = target;          \
+        goto start;                        \
+    } while (0)
+
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
-            goto start;
+            JUMP_TO(instruction.target().address());
         }
 
         handle_JumpIf: {
             auto& instruction = *reinterpret_cast<Op::JumpIf const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).to_boolean())
-                program_counter = instruction.true_target().address();
-            else
-                program_counter = instruction.false_target().address();
-            goto start;
+                JUMP_TO(instruction.true_target().address());
+            JUMP_TO(instruction.false_target().address());
         }
 
         handle_JumpTrue: {
             auto& instruction = *reinterpret_cast<Op::JumpTrue const*>(&bytecode[program_counter]);
-            if (get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpTrue);
         }
 
         handle_JumpFalse: {
             auto& instruction = *reinterpret_cast<Op::JumpFalse const*>(&bytecode[program_counter]);
-            if (!get(instruction.condition()).to_boolean()) {
-                program_counter = instruction.target().address();
-                goto start;
-            }
+            if (!get(instruction.condition()).to_boolean())
+                JUMP_TO(instruction.target().address());
             DISPATCH_NEXT(JumpFalse);
         }
 
@@ -472,8 +505,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             } else {                                                                                                    \
                 result = lhs.as_double() numeric_operator rhs.as_double();                                              \
             }                                                                                                           \
-            program_counter = result ? instruction.true_target().address() : instruction.false_target().address();      \
-            goto start;                                                                                                 \
+            JUMP_TO(result ? instruction.true_target().address() : instruction.false_target().address());               \
         }                                                                                                               \
         auto result = op_snake_case(vm(), get(instruction.lhs()), get(instruction.rhs()));                              \
         if (result.is_error()) [[unlikely]] {                                                                           \
@@ -481,15 +513,12 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
                 return;                                                                                                 \
             goto start;                                                                                                 \
         }                                                                                                               \
-        if (result.value())                                                                                             \
-            program_counter = instruction.true_target().address();                                                      \
-        else                                                                                                            \
-            program_counter = instruction.false_target().address();                                                     \
-        goto start;                                                                                                     \
+        JUMP_TO(result.value() ? instruction.true_target().address() : instruction.false_target().address());           \
     }
 
             JS_ENUMERATE_COMPARISON_OPS(HANDLE_COMPARISON_OP)
 #undef HANDLE_COMPARISON_OP
+#undef JUMP_TO
 
         handle_JumpUndefined: {
             auto& instruction = *reinterpret_cast<Op::JumpUndefined const*>(&bytecode[program_counter]);
@@ -575,7 +604,79 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         DISPATCH_NEXT(name);                                                                \
     }
 
-            HANDLE_INSTRUCTION(Add);
+#define HANDLE_SLOW_PATH(name)                                                                                          \
+    do {                                                                                                                \
+        auto result = instruction.execute_impl(*this);                                                                  \
+        if (result.is_error()) [[unlikely]] {                                                                           \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable) \
+                return;                                                                                                 \
+            goto start;                                                                                                 \
+        }                                                                                                               \
+        DISPATCH_NEXT(name);                                                                                            \
+    } while (0)
+
+        // OPTIMIZATION: Handle the int32 cases of the hottest arithmetic and comparison ops directly in the
+        //               dispatch loop, so they don't pay for a call and a ThrowCompletionOr round trip
+        //               on compilers where we don't flatten this function.
+#define HANDLE_ARITHMETIC_OP_WITH_INT32_FAST_PATH(name, overflow_check, numeric_operator)   \
+    handle_##name:                                                                          \
+    {                                                                                       \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]); \
+        auto lhs = get(instruction.lhs());                                                  \
+        auto rhs = get(instruction.rhs());                                                  \
+        if (lhs.is_int32() && rhs.is_int32()) [[likely]] {                                  \
+            if (!Checked<i32>::overflow_check(lhs.as_i32(), rhs.as_i32())) [[likely]] {     \
+                set(instruction.dst(), Value(lhs.as_i32() numeric_operator rhs.as_i32()));  \
+                DISPATCH_NEXT(name);                                                        \
+            }                                                                               \
+        }                                                                                   \
+        HANDLE_SLOW_PATH(name);                                                             \
+    }
+
+#define HANDLE_COMPARISON_OP_WITH_INT32_FAST_PATH(name, numeric_operator)                   \
+    handle_##name:                                                                          \
+    {                                                                                       \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]); \
+        auto lhs = get(instruction.lhs());                                                  \
+        auto rhs = get(instruction.rhs());                                                  \
+        if (lhs.is_int32() && rhs.is_int32()) [[likely]] {                                  \
+            set(instruction.dst(), Value(lhs.as_i32() numeric_operator rhs.as_i32()));      \
+            DISPATCH_NEXT(name);                                                            \
+        }                                                                                   \
+        HANDLE_SLOW_PATH(name);                                                             \
+    }
+
+            HANDLE_ARITHMETIC_OP_WITH_INT32_FAST_PATH(Add, addition_would_overflow, +);
+            HANDLE_ARITHMETIC_OP_WITH_INT32_FAST_PATH(Sub, subtraction_would_overflow, -);
+            HANDLE_COMPARISON_OP_WITH_INT32_FAST_PATH(LessThan, <);
+            HANDLE_COMPARISON_OP_WITH_INT32_FAST_PATH(LessThanEquals, <=);
+            HANDLE_COMPARISON_OP_WITH_INT32_FAST_PATH(GreaterThan, >);
+            HANDLE_COMPARISON_OP_WITH_INT32_FAST_PATH(GreaterThanEquals, >=);
+
+#undef HANDLE_ARITHMETIC_OP_WITH_INT32_FAST_PATH
+#undef HANDLE_COMPARISON_OP_WITH_INT32_FAST_PATH
+
+        handle_GetById: {
+            auto& instruction = *reinterpret_cast<Op::GetById const*>(&bytecode[program_counter]);
+            // OPTIMIZATION: Inline the monomorphic own-property case of the PropertyLookupCache.
+            //               Everything else (prototype chain hits, accessors, misses) goes through get_by_id().
+            if (auto base_value = get(instruction.base()); base_value.is_object()) {
+                auto& object = base_value.as_object();
+                auto const& cache_entry = executable.property_lookup_caches[instruction.cache_index()].entries[0];
+                if (&object.shape() == cache_entry.shape && !cache_entry.prototype) {
+                    auto value = object.get_direct(cache_entry.property_offset.value());
+                    if (!value.is_accessor()) {
+                        set(instruction.dst(), value);
+                        ++executable.property_lookup_caches[instruction.cache_index()].hit_count;
+                        DISPATCH_NEXT(GetById);
+                    }
+                }
+            }
+            HANDLE_SLOW_PATH(GetById);
+        }
+
+#undef HANDLE_SLOW_PATH
+
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(AddPrivateName);
             HANDLE_INSTRUCTION(ArrayAppend);
             HANDLE_INSTRUCTION(AsyncIteratorClose);
@@ -608,7 +709,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(Dump);
             HANDLE_INSTRUCTION(EnterObjectEnvironment);
             HANDLE_INSTRUCTION(Exp);
-            HANDLE_INSTRUCTION(GetById);
             HANDLE_INSTRUCTION(GetByIdWithThis);
             HANDLE_INSTRUCTION(GetByValue);
             HANDLE_INSTRUCTION(GetByValueWithThis);
@@ -627,8 +727,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(GetPrivateById);
             HANDLE_INSTRUCTION(GetBinding);
             HANDLE_INSTRUCTION(GetInitializedBinding);
-            HANDLE_INSTRUCTION(GreaterThan);
-            HANDLE_INSTRUCTION(GreaterThanEquals);
             HANDLE_INSTRUCTION(HasPrivateId);
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
@@ -645,8 +743,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(LeavePrivateEnvironment);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(LeaveUnwindContext);
             HANDLE_INSTRUCTION(LeftShift);
-            HANDLE_INSTRUCTION(LessThan);
-            HANDLE_INSTRUCTION(LessThanEquals);
             HANDLE_INSTRUCTION(LooselyEquals);
             HANDLE_INSTRUCTION(LooselyInequals);
             HANDLE_INSTRUCTION(Mod);
@@ -678,7 +774,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(SetVariableBinding);
             HANDLE_INSTRUCTION(StrictlyEquals);
             HANDLE_INSTRUCTION(StrictlyInequals);
-            HANDLE_INSTRUCTION(Sub);
             HANDLE_INSTRUCTION(SuperCallWithArgumentArray);
             HANDLE_INSTRUCTION(Throw);
             HANDLE_INSTRUCTION(ThrowIfNotObject);
@@ -745,6 +840,10 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
 
     running_execution_context.executable = &executable;
 
+    // NOTE: Generators and async functions re-enter their executable with an entry point; only count fresh invocations.
+    if (!entry_point.has_value())
+        ++executable.invocation_count;
+
     auto* registers_and_constants_and_locals_and_arguments = running_execution_context.registers_and_constants_and_locals_and_arguments();
     for (size_t i = 0; i < executable.constants.size(); ++i) {
         registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
@@ -778,6 +877,49 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
     return { return_value, registers_and_constants_and_locals_and_arguments[0] };
 }
 
+void Interpreter::dump_profile(StringBuilder& builder, size_t max_number_of_executables)
+{
+    Vector<Executable*> executables;
+    for (auto& executable : m_executables) {
+        if (executable.invocation_count > 0 || executable.back_edge_count > 0)
+            executables.append(&executable);
+    }
+
+    quick_sort(executables, [](Executable const* a, Executable const* b) {
+        return a->invocation_count + a->back_edge_count > b->invocation_count + b->back_edge_count;
+    });
+
+    builder.appendff("Bytecode profile: {} of {} executables have run\n", executables.size(), m_executables.size_slow());
+    for (size_t i = 0; i < min(executables.size(), max_number_of_executables); ++i)
+        executables[i]->dump_profile(builder);
+}
+
+void Interpreter::dump_op_counts(StringBuilder& builder) const
+{
+    static constexpr AK::Array op_names {
+#define __BYTECODE_OP(op) #op##sv,
+        ENUMERATE_BYTECODE_OPS(__BYTECODE_OP)
+#undef __BYTECODE_OP
+    };
+
+    Vector<size_t> op_types;
+    u64 total_count = 0;
+    for (size_t i = 0; i < m_op_counts.size(); ++i) {
+        if (m_op_counts[i] == 0)
+            continue;
+        op_types.append(i);
+        total_count += m_op_counts[i];
+    }
+
+    quick_sort(op_types, [&](size_t a, size_t b) { return m_op_counts[a] > m_op_counts[b]; });
+
+    builder.appendff("Bytecode op counts: {} instructions of {} types have run\n", total_count, op_types.size());
+    for (auto op_type : op_types) {
+        auto share = static_cast<double>(m_op_counts[op_type]) / static_cast<double>(total_count) * 100;
+        builder.appendff("{:>14} {:>6.2}% {}\n", m_op_counts[op_type], share, op_names[op_type]);
+    }
+}
+
 void Interpreter::enter_unwind_context()
 {
     running_execution_context().unwind_contexts.empend(
@@ -1006,6 +1148,7 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
                 return true;
             }();
             if (can_use_cache) {
+                ++cache.hit_count;
                 auto value = cache_entry.prototype->get_direct(cache_entry.property_offset.value());
                 if (value.is_accessor())
                     return TRY(call(vm, value.as_accessor().getter(), this_value));
@@ -1013,6 +1156,7 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
             }
         } else if (&shape == cache_entry.shape) {
             // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+            ++cache.hit_count;
             auto value = base_obj->get_direct(cache_entry.property_offset.value());
             if (value.is_accessor())
                 return TRY(call(vm, value.as_accessor().getter(), this_value));
@@ -1020,8 +1164,25 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
         }
     }
 
+    auto const& property_name = executable.get_identifier(property);
+
+    // OPTIMIZATION: If this site has already seen more shapes than it can remember, it's megamorphic.
+    //               Try the cache shared by all executables before doing a full property lookup.
+    bool is_megamorphic = cache.entries.last().shape;
+    if (is_megamorphic) {
+        if (auto property_offset = vm.bytecode_interpreter().megamorphic_get_cache().lookup(shape, property_name); property_offset.has_value()) {
+            ++cache.hit_count;
+            auto value = base_obj->get_direct(*property_offset);
+            if (value.is_accessor())
+                return TRY(call(vm, value.as_accessor().getter(), this_value));
+            return value;
+        }
+    }
+
+    ++cache.miss_count;
+
     CacheablePropertyMetadata cacheable_metadata;
-    auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
+    auto value = TRY(base_obj->internal_get(property_name, this_value, &cacheable_metadata));
 
     // If internal_get() caused object's shape change, we can no longer be sure
     // that collected metadata is valid, e.g. if getter in prototype chain added
@@ -1034,7 +1195,9 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
             cache.entries[0] = {};
             return cache.entries[0];
         };
-        if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
+        if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty && is_megamorphic) {
+            vm.bytecode_interpreter().megamorphic_get_cache().insert(shape, property_name, cacheable_metadata.property_offset.value());
+        } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
             auto& entry = get_cache_slot();
             entry.shape = shape;
             entry.property_offset = cacheable_metadata.property_offset.value();
@@ -1143,6 +1306,7 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         // OPTIMIZATION: For global var bindings, if the shape of the global object hasn't changed,
         //               we can use the cached property offset.
         if (&shape == cache.entries[0].shape) {
+            ++cache.hit_count;
             auto value = binding_object.get_direct(cache.entries[0].property_offset.value());
             if (value.is_accessor())
                 return TRY(call(vm, value.as_accessor().getter(), js_undefined()));
@@ -1152,6 +1316,7 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         // OPTIMIZATION: For global lexical bindings, if the global declarative environment hasn't changed,
         //               we can use the cached environment binding index.
         if (cache.has_environment_binding_index) {
+            ++cache.hit_count;
             if (cache.in_module_environment) {
                 auto module = vm.running_execution_context().script_or_module.get_pointer<GC::Ref<Module>>();
                 return (*module)->environment()->get_binding_value_direct(vm, cache.environment_binding_index);
@@ -1160,6 +1325,7 @@ inline ThrowCompletionOr<Value> get_global(Interpreter& interpreter, IdentifierT
         }
     }
 
+    ++cache.miss_count;
     cache.environment_serial_number = declarative_record.environment_serial_number();
 
     auto& identifier = interpreter.current_executable().get_identifier(identifier_index);
@@ -1250,11 +1416,13 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     if (can_use_cache) {
                         auto value_in_prototype = cache.prototype->get_direct(cache.property_offset.value());
                         if (value_in_prototype.is_accessor()) {
+                            ++caches->hit_count;
                             TRY(call(vm, value_in_prototype.as_accessor().setter(), this_value, value));
                             return {};
                         }
                     }
                 } else if (cache.shape == &object->shape()) {
+                    ++caches->hit_count;
                     auto value_in_object = object->get_direct(cache.property_offset.value());
                     if (value_in_object.is_accessor()) {
                         TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
@@ -1264,8 +1432,27 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                     return {};
                 }
             }
+
+            // OPTIMIZATION: If this site has already seen more shapes than it can remember, it's megamorphic.
+            //               Try the cache shared by all executables before doing a full property lookup.
+            if (caches->entries.last().shape && name.is_string()) {
+                if (auto property_offset = vm.bytecode_interpreter().megamorphic_put_cache().lookup(shape, name.as_string()); property_offset.has_value()) {
+                    ++caches->hit_count;
+                    auto value_in_object = object->get_direct(*property_offset);
+                    if (value_in_object.is_accessor()) {
+                        TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
+                    } else {
+                        object->put_direct(*property_offset, value);
+                    }
+                    return {};
+                }
+            }
+
+            ++caches->miss_count;
         }
 
+        bool is_megamorphic = caches && caches->entries.last().shape;
+
         CacheablePropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
@@ -1280,11 +1467,14 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
                 caches->entries[0] = {};
                 return caches->entries[0];
             };
-            auto& cache = get_cache_slot();
-            if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
+            if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty && is_megamorphic && name.is_string()) {
+                vm.bytecode_interpreter().megamorphic_put_cache().insert(shape, name.as_string(), cacheable_metadata.property_offset.value());
+            } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
+                auto& cache = get_cache_slot();
                 cache.shape = object->shape();
                 cache.property_offset = cacheable_metadata.property_offset.value();
             } else if (cacheable_metadata.type == CacheablePropertyMetadata::Type::InPrototypeChain) {
+                auto& cache = get_cache_slot();
                 cache.shape = object->shape();
                 cache.property_offset = cacheable_metadata.property_offset.value();
                 cache.prototype = *cacheable_metadata.prototype;
@@ -2388,6 +2578,7 @@ ThrowCompletionOr<void> SetGlobal::execute_impl(Bytecode::Interpreter& interpret
         // OPTIMIZATION: For global var bindings, if the shape of the global object hasn't changed,
         //               we can use the cached property offset.
         if (&shape == cache.entries[0].shape) {
+            ++cache.hit_count;
             auto value = binding_object.get_direct(cache.entries[0].property_offset.value());
             if (value.is_accessor())
                 TRY(call(vm, value.as_accessor().setter(), &binding_object, src));
@@ -2399,6 +2590,7 @@ ThrowCompletionOr<void> SetGlobal::execute_impl(Bytecode::Interpreter& interpret
         // OPTIMIZATION: For global lexical bindings, if the global declarative environment hasn't changed,
         //               we can use the cached environment binding index.
         if (cache.has_environment_binding_index) {
+            ++cache.hit_count;
             if (cache.in_module_environment) {
                 auto module = vm.running_execution_context().script_or_module.get_pointer<GC::Ref<Module>>();
                 TRY((*module)->environment()->set_mutable_binding_direct(vm, cache.environment_binding_index, src, vm.in_strict_mode()));
@@ -2409,6 +2601,7 @@ ThrowCompletionOr<void> SetGlobal::execute_impl(Bytecode::Interpreter& interpret
         }
     }
 
+    ++cache.miss_count;
     cache.environment_serial_number = declarative_record.environment_serial_number();
 
     auto& identifier = interpreter.current_executable().get_identifier(m_identifier);
@@ -2796,7 +2989,7 @@ void GetImportMeta::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), interpreter.vm().get_import_meta());
 }
 
-static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, ReadonlySpan<Operand> arguments)
+static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, Value this_value, ReadonlySpan<Operand> arguments)
 {
     switch (builtin) {
     case Builtin::MathAbs:
@@ -2829,40 +3022,52 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
     case Builtin::MapIteratorPrototypeNext:
     case Builtin::SetIteratorPrototypeNext:
     case Builtin::StringIteratorPrototypeNext:
+    case Builtin::GeneratorPrototypeNext:
         VERIFY_NOT_REACHED();
+    case Builtin::ObjectHasOwn:
+        return TRY(ObjectConstructor::has_own_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::ArrayPrototypePush: {
+        auto item = interpreter.get(arguments[0]);
+        return TRY(ArrayPrototype::push_impl(interpreter.vm(), this_value, { &item, 1 }));
+    }
+    case Builtin::StringPrototypeCharCodeAt:
+        return TRY(StringPrototype::char_code_at_impl(interpreter.vm(), this_value, interpreter.get(arguments[0])));
     case Bytecode::Builtin::__Count:
         VERIFY_NOT_REACHED();
     }
     VERIFY_NOT_REACHED();
 }
 
-ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
+static ThrowCompletionOr<Value> call_with_arguments_in_operands(Bytecode::Interpreter& interpreter, FunctionObject& function, Value this_value, ReadonlySpan<Operand> arguments)
 {
-    auto callee = interpreter.get(m_callee);
-
-    if (!callee.is_function()) [[unlikely]] {
-        return throw_type_error_for_callee(interpreter, callee, "function"sv, m_expression_string);
-    }
-
-    auto& function = callee.as_function();
-
     ExecutionContext* callee_context = nullptr;
     size_t registers_and_constants_and_locals_count = 0;
-    size_t argument_count = m_argument_count;
+    size_t argument_count = arguments.size();
     TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
-    ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, registers_and_constants_and_locals_count, max(m_argument_count, argument_count));
+    ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, registers_and_constants_and_locals_count, max(arguments.size(), argument_count));
 
     auto* callee_context_argument_values = callee_context->arguments.data();
     auto const callee_context_argument_count = callee_context->arguments.size();
-    auto const insn_argument_count = m_argument_count;
+    auto const insn_argument_count = arguments.size();
 
     for (size_t i = 0; i < insn_argument_count; ++i)
-        callee_context_argument_values[i] = interpreter.get(m_arguments[i]);
+        callee_context_argument_values[i] = interpreter.get(arguments[i]);
     for (size_t i = insn_argument_count; i < callee_context_argument_count; ++i)
         callee_context_argument_values[i] = js_undefined();
     callee_context->passed_argument_count = insn_argument_count;
 
-    auto retval = TRY(function.internal_call(*callee_context, interpreter.get(m_this_value)));
+    return function.internal_call(*callee_context, this_value);
+}
+
+ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto callee = interpreter.get(m_callee);
+
+    if (!callee.is_function()) [[unlikely]] {
+        return throw_type_error_for_callee(interpreter, callee, "function"sv, m_expression_string);
+    }
+
+    auto retval = TRY(call_with_arguments_in_operands(interpreter, callee.as_function(), interpreter.get(m_this_value), { m_arguments, m_argument_count }));
     interpreter.set(m_dst, retval);
     return {};
 }
@@ -2900,15 +3105,13 @@ ThrowCompletionOr<void> CallBuiltin::execute_impl(Bytecode::Interpreter& interpr
     TRY(throw_if_needed_for_call(interpreter, callee, CallType::Call, expression_string()));
 
     if (m_argument_count == Bytecode::builtin_argument_count(m_builtin) && callee.is_object() && interpreter.realm().get_builtin_value(m_builtin) == &callee.as_object()) {
-        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, { m_arguments, m_argument_count })));
+        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, interpreter.get(m_this_value), { m_arguments, m_argument_count })));
 
         return {};
     }
 
-    auto argument_values = interpreter.allocate_argument_values(m_argument_count);
-    for (size_t i = 0; i < m_argument_count; ++i)
-        argument_values[i] = interpreter.get(m_arguments[i]);
-    interpreter.set(dst(), TRY(perform_call(interpreter, interpreter.get(m_this_value), CallType::Call, callee, argument_values)));
+    // NOTE: Calls to prototype method builtins are recognized by the property name alone, so this is not unlikely.
+    interpreter.set(dst(), TRY(call_with_arguments_in_operands(interpreter, callee.as_function(), interpreter.get(m_this_value), { m_arguments, m_argument_count })));
     return {};
 }
 
@@ -3280,6 +3483,10 @@ void BlockDeclarationInstantiation::execute_impl(Bytecode::Interpreter& interpre
     auto& vm = interpreter.vm();
     auto old_environment = interpreter.running_execution_context().lexical_environment;
     auto& running_execution_context = interpreter.running_execution_context();
+    if (!m_creates_environment) {
+        m_scope_node.block_declaration_instantiation(vm, old_environment);
+        return;
+    }
     running_execution_context.saved_lexical_environments.append(old_environment);
     running_execution_context.lexical_environment = new_declarative_environment(*old_environment);
     m_scope_node.block_declaration_instantiation(vm, running_execution_context.lexical_environment);
@@ -4044,6 +4251,8 @@ ByteString TypeofBinding::to_byte_string_impl(Bytecode::Executable const& execut
 
 ByteString BlockDeclarationInstantiation::to_byte_string_impl(Bytecode::Executable const&) const
 {
+    if (!m_creates_environment)
+        return "BlockDeclarationInstantiation (without environment)"sv;
     return "BlockDeclarationInstantiation"sv;
 }
 
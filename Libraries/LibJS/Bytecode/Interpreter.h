@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Debug.h>
 #include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/Label.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Export.h>
@@ -85,6 +88,22 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    void did_create_executable(Badge<Generator>, Executable& executable) { m_executables.append(executable); }
+
+    MegamorphicPropertyLookupCache& megamorphic_get_cache() { return m_megamorphic_get_cache; }
+    MegamorphicPropertyLookupCache& megamorphic_put_cache() { return m_megamorphic_put_cache; }
+
+    // Writes the hotness and inline cache counters of the most frequently run executables to the builder.
+    void dump_profile(StringBuilder&, size_t max_number_of_executables = 100);
+
+    void set_sampling_profiler(Badge<SamplingProfiler>, SamplingProfiler* profiler) { m_sampling_profiler = profiler; }
+
+    // Counting the executed instructions of every type slows down the dispatch loop, so the counters are only kept
+    // when LibJS is built with JS_BYTECODE_OP_COUNTS_DEBUG.
+    static constexpr bool has_op_counts() { return JS_BYTECODE_OP_COUNTS_DEBUG; }
+    void dump_op_counts(StringBuilder&) const;
+    void reset_op_counts() { m_op_counts.fill(0); }
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -94,6 +113,9 @@ private:
     };
     [[nodiscard]] HandleExceptionResponse handle_exception(size_t& program_counter, Value exception);
 
+    void take_sample_if_requested();
+    void count_op(Instruction::Type);
+
     VM& m_vm;
     Optional<size_t> m_scheduled_jump;
     GC::Ptr<Executable> m_current_executable { nullptr };
@@ -103,9 +125,19 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     Vector<Value> m_argument_values_buffer;
     ExecutionContext* m_running_execution_context { nullptr };
+    Executable::List m_executables;
+    MegamorphicPropertyLookupCache m_megamorphic_get_cache;
+    MegamorphicPropertyLookupCache m_megamorphic_put_cache;
+    SamplingProfiler* m_sampling_profiler { nullptr };
+
+#define __BYTECODE_OP(op) +1
+    static constexpr size_t number_of_op_types = 0 ENUMERATE_BYTECODE_OPS(__BYTECODE_OP);
+#undef __BYTECODE_OP
+    AK::Array<u64, number_of_op_types> m_op_counts {};
 };
 
 JS_API extern bool g_dump_bytecode;
+JS_API extern bool g_optimize_bytecode;
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, Utf16FlyString const& name);
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
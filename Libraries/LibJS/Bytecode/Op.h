@@ -2157,9 +2157,10 @@ private:
 
 class BlockDeclarationInstantiation final : public Instruction {
 public:
-    explicit BlockDeclarationInstantiation(ScopeNode const& scope_node)
+    BlockDeclarationInstantiation(ScopeNode const& scope_node, bool creates_environment)
         : Instruction(Type::BlockDeclarationInstantiation)
         , m_scope_node(scope_node)
+        , m_creates_environment(creates_environment)
     {
     }
 
@@ -2167,9 +2168,11 @@ public:
     ByteString to_byte_string_impl(Bytecode::Executable const&) const;
 
     ScopeNode const& scope_node() const { return m_scope_node; }
+    bool creates_environment() const { return m_creates_environment; }
 
 private:
     ScopeNode const& m_scope_node;
+    bool m_creates_environment { true };
 };
 
 class Return final : public Instruction {
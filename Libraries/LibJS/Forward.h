@@ -208,6 +208,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
@@ -279,6 +280,9 @@ class Intl;
 class IntlObject;
 class MathematicalValue;
 
+enum class OptionDefaults;
+enum class OptionRequired;
+
 // Not included in JS_ENUMERATE_INTL_OBJECTS due to missing distinct constructor
 class Segments;
 class SegmentsPrototype;
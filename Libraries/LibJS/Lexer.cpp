@@ -14,7 +14,56 @@
 
 namespace JS {
 
-HashMap<Utf16FlyString, TokenType> Lexer::s_keywords;
+// NOTE: This is a function-local static so that initialization is thread-safe, and no Lexer has to check
+//       whether it's the first one.
+static HashMap<Utf16FlyString, TokenType> const& keywords()
+{
+    static auto const keywords = [] {
+        HashMap<Utf16FlyString, TokenType> keywords;
+        keywords.set("async"_utf16_fly_string, TokenType::Async);
+        keywords.set("await"_utf16_fly_string, TokenType::Await);
+        keywords.set("break"_utf16_fly_string, TokenType::Break);
+        keywords.set("case"_utf16_fly_string, TokenType::Case);
+        keywords.set("catch"_utf16_fly_string, TokenType::Catch);
+        keywords.set("class"_utf16_fly_string, TokenType::Class);
+        keywords.set("const"_utf16_fly_string, TokenType::Const);
+        keywords.set("continue"_utf16_fly_string, TokenType::Continue);
+        keywords.set("debugger"_utf16_fly_string, TokenType::Debugger);
+        keywords.set("default"_utf16_fly_string, TokenType::Default);
+        keywords.set("delete"_utf16_fly_string, TokenType::Delete);
+        keywords.set("do"_utf16_fly_string, TokenType::Do);
+        keywords.set("else"_utf16_fly_string, TokenType::Else);
+        keywords.set("enum"_utf16_fly_string, TokenType::Enum);
+        keywords.set("export"_utf16_fly_string, TokenType::Export);
+        keywords.set("extends"_utf16_fly_string, TokenType::Extends);
+        keywords.set("false"_utf16_fly_string, TokenType::BoolLiteral);
+        keywords.set("finally"_utf16_fly_string, TokenType::Finally);
+        keywords.set("for"_utf16_fly_string, TokenType::For);
+        keywords.set("function"_utf16_fly_string, TokenType::Function);
+        keywords.set("if"_utf16_fly_string, TokenType::If);
+        keywords.set("import"_utf16_fly_string, TokenType::Import);
+        keywords.set("in"_utf16_fly_string, TokenType::In);
+        keywords.set("instanceof"_utf16_fly_string, TokenType::Instanceof);
+        keywords.set("let"_utf16_fly_string, TokenType::Let);
+        keywords.set("new"_utf16_fly_string, TokenType::New);
+        keywords.set("null"_utf16_fly_string, TokenType::NullLiteral);
+        keywords.set("return"_utf16_fly_string, TokenType::Return);
+        keywords.set("super"_utf16_fly_string, TokenType::Super);
+        keywords.set("switch"_utf16_fly_string, TokenType::Switch);
+        keywords.set("this"_utf16_fly_string, TokenType::This);
+        keywords.set("throw"_utf16_fly_string, TokenType::Throw);
+        keywords.set("true"_utf16_fly_string, TokenType::BoolLiteral);
+        keywords.set("try"_utf16_fly_string, TokenType::Try);
+        keywords.set("typeof"_utf16_fly_string, TokenType::Typeof);
+        keywords.set("var"_utf16_fly_string, TokenType::Var);
+        keywords.set("void"_utf16_fly_string, TokenType::Void);
+        keywords.set("while"_utf16_fly_string, TokenType::While);
+        keywords.set("with"_utf16_fly_string, TokenType::With);
+        keywords.set("yield"_utf16_fly_string, TokenType::Yield);
+        return keywords;
+    }();
+    return keywords;
+}
 
 static constexpr TokenType parse_two_char_token(Utf16View const& view)
 {
@@ -256,49 +305,6 @@ Lexer::Lexer(Utf16String source, StringView filename, size_t line_number, size_t
     , m_line_column(line_column)
     , m_parsed_identifiers(adopt_ref(*new ParsedIdentifiers))
 {
-    if (s_keywords.is_empty()) {
-        s_keywords.set("async"_utf16_fly_string, TokenType::Async);
-        s_keywords.set("await"_utf16_fly_string, TokenType::Await);
-        s_keywords.set("break"_utf16_fly_string, TokenType::Break);
-        s_keywords.set("case"_utf16_fly_string, TokenType::Case);
-        s_keywords.set("catch"_utf16_fly_string, TokenType::Catch);
-        s_keywords.set("class"_utf16_fly_string, TokenType::Class);
-        s_keywords.set("const"_utf16_fly_string, TokenType::Const);
-        s_keywords.set("continue"_utf16_fly_string, TokenType::Continue);
-        s_keywords.set("debugger"_utf16_fly_string, TokenType::Debugger);
-        s_keywords.set("default"_utf16_fly_string, TokenType::Default);
-        s_keywords.set("delete"_utf16_fly_string, TokenType::Delete);
-        s_keywords.set("do"_utf16_fly_string, TokenType::Do);
-        s_keywords.set("else"_utf16_fly_string, TokenType::Else);
-        s_keywords.set("enum"_utf16_fly_string, TokenType::Enum);
-        s_keywords.set("export"_utf16_fly_string, TokenType::Export);
-        s_keywords.set("extends"_utf16_fly_string, TokenType::Extends);
-        s_keywords.set("false"_utf16_fly_string, TokenType::BoolLiteral);
-        s_keywords.set("finally"_utf16_fly_string, TokenType::Finally);
-        s_keywords.set("for"_utf16_fly_string, TokenType::For);
-        s_keywords.set("function"_utf16_fly_string, TokenType::Function);
-        s_keywords.set("if"_utf16_fly_string, TokenType::If);
-        s_keywords.set("import"_utf16_fly_string, TokenType::Import);
-        s_keywords.set("in"_utf16_fly_string, TokenType::In);
-        s_keywords.set("instanceof"_utf16_fly_string, TokenType::Instanceof);
-        s_keywords.set("let"_utf16_fly_string, TokenType::Let);
-        s_keywords.set("new"_utf16_fly_string, TokenType::New);
-        s_keywords.set("null"_utf16_fly_string, TokenType::NullLiteral);
-        s_keywords.set("return"_utf16_fly_string, TokenType::Return);
-        s_keywords.set("super"_utf16_fly_string, TokenType::Super);
-        s_keywords.set("switch"_utf16_fly_string, TokenType::Switch);
-        s_keywords.set("this"_utf16_fly_string, TokenType::This);
-        s_keywords.set("throw"_utf16_fly_string, TokenType::Throw);
-        s_keywords.set("true"_utf16_fly_string, TokenType::BoolLiteral);
-        s_keywords.set("try"_utf16_fly_string, TokenType::Try);
-        s_keywords.set("typeof"_utf16_fly_string, TokenType::Typeof);
-        s_keywords.set("var"_utf16_fly_string, TokenType::Var);
-        s_keywords.set("void"_utf16_fly_string, TokenType::Void);
-        s_keywords.set("while"_utf16_fly_string, TokenType::While);
-        s_keywords.set("with"_utf16_fly_string, TokenType::With);
-        s_keywords.set("yield"_utf16_fly_string, TokenType::Yield);
-    }
-
     consume();
 }
 
@@ -782,8 +788,9 @@ Token Lexer::next()
         identifier = builder.to_utf16_string();
         m_parsed_identifiers->identifiers.set(*identifier);
 
-        auto it = s_keywords.find(identifier->hash(), [&](auto& entry) { return entry.key == identifier; });
-        if (it == s_keywords.end())
+        auto const& keywords = JS::keywords();
+        auto it = keywords.find(identifier->hash(), [&](auto& entry) { return entry.key == identifier; });
+        if (it == keywords.end())
             token_type = TokenType::Identifier;
         else
             token_type = has_escaped_character ? TokenType::EscapedKeyword : it->value;
@@ -77,8 +77,6 @@ private:
 
     bool m_allow_html_comments { true };
 
-    static HashMap<Utf16FlyString, TokenType> s_keywords;
-
     struct ParsedIdentifiers : public RefCounted<ParsedIdentifiers> {
         // Resolved identifiers must be kept alive for the duration of the parsing stage, otherwise
         // the only references to these strings are deleted by the Token destructor.
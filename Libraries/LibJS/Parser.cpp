@@ -1159,10 +1159,10 @@ RefPtr<FunctionExpression const> Parser::try_parse_arrow_function_expression(boo
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length_in_code_units();
 
-    auto source_text = m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset);
+    SourceText source_text { m_source_code, static_cast<u32>(function_start_offset), static_cast<u32>(function_end_offset) };
 
     return create_ast_node<FunctionExpression>(
-        { m_source_code, rule_start.position(), position() }, nullptr, MUST(source_text.to_byte_string()),
+        { m_source_code, rule_start.position(), position() }, nullptr, move(source_text),
         move(body), move(parameters), function_length, function_kind, body->in_strict_mode(),
         parsing_insights, move(local_variables_names), /* is_arrow_function */ true);
 }
@@ -1663,7 +1663,7 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
             parsing_insights.uses_this_from_environment = true;
             parsing_insights.uses_this = true;
             constructor = create_ast_node<FunctionExpression>(
-                { m_source_code, rule_start.position(), position() }, class_name, "",
+                { m_source_code, rule_start.position(), position() }, class_name, SourceText {},
                 move(constructor_body), FunctionParameters::create(Vector { FunctionParameter { move(argument_name), nullptr, true } }), 0, FunctionKind::Normal,
                 /* is_strict_mode */ true, parsing_insights, /* local_variables_names */ Vector<LocalVariable> {});
         } else {
@@ -1671,7 +1671,7 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
             parsing_insights.uses_this_from_environment = true;
             parsing_insights.uses_this = true;
             constructor = create_ast_node<FunctionExpression>(
-                { m_source_code, rule_start.position(), position() }, class_name, "",
+                { m_source_code, rule_start.position(), position() }, class_name, SourceText {},
                 move(constructor_body), FunctionParameters::empty(), 0, FunctionKind::Normal,
                 /* is_strict_mode */ true, parsing_insights, /* local_variables_names */ Vector<LocalVariable> {});
         }
@@ -1691,9 +1691,9 @@ NonnullRefPtr<ClassExpression const> Parser::parse_class_expression(bool expect_
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length_in_code_units();
 
-    auto source_text = m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset);
+    SourceText source_text { m_source_code, static_cast<u32>(function_start_offset), static_cast<u32>(function_end_offset) };
 
-    return create_ast_node<ClassExpression>({ m_source_code, rule_start.position(), position() }, move(class_name), MUST(source_text.to_byte_string()), move(constructor), move(super_class), move(elements));
+    return create_ast_node<ClassExpression>({ m_source_code, rule_start.position(), position() }, move(class_name), move(source_text), move(constructor), move(super_class), move(elements));
 }
 
 Parser::PrimaryExpressionParseResult Parser::parse_primary_expression()
@@ -3021,7 +3021,7 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
 
     auto function_start_offset = rule_start.position().offset;
     auto function_end_offset = position().offset - m_state.current_token.trivia().length_in_code_units();
-    auto source_text = m_state.lexer.source().substring_view(function_start_offset, function_end_offset - function_start_offset);
+    SourceText source_text { m_source_code, static_cast<u32>(function_start_offset), static_cast<u32>(function_end_offset) };
 
     parsing_insights.might_need_arguments_object = m_state.function_might_need_arguments_object;
     if (parse_options & FunctionNodeParseOptions::IsConstructor) {
@@ -3030,7 +3030,7 @@ NonnullRefPtr<FunctionNodeType> Parser::parse_function_node(u16 parse_options, O
     }
     return create_ast_node<FunctionNodeType>(
         { m_source_code, rule_start.position(), position() },
-        name, MUST(source_text.to_byte_string()), move(body), parameters.release_nonnull(), function_length,
+        name, move(source_text), move(body), parameters.release_nonnull(), function_length,
         function_kind, has_strict_directive, parsing_insights,
         move(local_variables_names));
 }
@@ -6,10 +6,12 @@
  */
 
 #include <AK/Function.h>
+#include <LibJS/AST.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayPrototype.h>
 #include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -52,12 +54,11 @@ GC::Ref<Array> Array::create_from(Realm& realm, ReadonlySpan<Value> elements)
 
     // 2. Let n be 0.
     // 3. For each element e of elements, do
-    for (u32 n = 0; n < elements.size(); ++n) {
-        // a. Perform ! CreateDataPropertyOrThrow(array, ! ToString(𝔽(n)), e).
-        MUST(array->create_data_property_or_throw(n, elements[n]));
-
-        // b. Set n to n + 1.
-    }
+    //     a. Perform ! CreateDataPropertyOrThrow(array, ! ToString(𝔽(n)), e).
+    //     b. Set n to n + 1.
+    // OPTIMIZATION: A new array has no elements and an ordinary prototype, so creating its data properties one by one
+    //               is equivalent to storing all of the elements at once, which only needs a single allocation.
+    array->set_indexed_property_elements(Vector<Value> { elements });
 
     // 4. Return array.
     return array;
@@ -209,11 +210,8 @@ ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object
 
     // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
 
-    // Perform sorting by merge sort. This isn't as efficient compared to quick sort, but
-    // quicksort can't be used in all cases because the spec requires Array.prototype.sort()
-    // to be stable. FIXME: when initially scanning through the array, maintain a flag
-    // for if an unstable sort would be indistinguishable from a stable sort (such as just
-    // just strings or numbers), and in that case use quick sort instead for better performance.
+    // NOTE: The spec requires Array.prototype.sort() to be stable, so we use a merge sort (TimSort), which also makes
+    //       few comparisons for lists that are already partially sorted.
     TRY(array_merge_sort(vm, sort_compare, items));
 
     // 5. Return items.
@@ -249,6 +247,17 @@ ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, Funct
         return value_number.as_double();
     }
 
+    // OPTIMIZATION: Strings are their own ToString, so we can compare them without creating new strings.
+    if (x.is_string() && y.is_string()) {
+        auto x_string = x.as_string().utf16_string_view();
+        auto y_string = y.as_string().utf16_string_view();
+        if (x_string.is_code_unit_less_than(y_string))
+            return -1;
+        if (y_string.is_code_unit_less_than(x_string))
+            return 1;
+        return 0;
+    }
+
     // 5. Let xString be ? ToString(x).
     auto x_string = PrimitiveString::create(vm, TRY(x.to_string(vm)));
 
@@ -273,6 +282,57 @@ ThrowCompletionOr<double> compare_array_elements(VM& vm, Value x, Value y, Funct
     return 0;
 }
 
+Optional<SubtractionComparator> as_subtraction_comparator(FunctionObject const& function)
+{
+    auto const* ecmascript_function = as_if<ECMAScriptFunctionObject>(function);
+    if (!ecmascript_function || ecmascript_function->kind() != FunctionKind::Normal || ecmascript_function->is_class_constructor())
+        return {};
+
+    auto const& parameters = ecmascript_function->formal_parameters().parameters();
+    if (parameters.size() != 2 || !ecmascript_function->has_simple_parameter_list())
+        return {};
+
+    auto const& first_parameter = parameters[0].binding.get<NonnullRefPtr<Identifier const>>()->string();
+    auto const& second_parameter = parameters[1].binding.get<NonnullRefPtr<Identifier const>>()->string();
+    if (first_parameter == second_parameter)
+        return {};
+
+    // NOTE: The body of an arrow function with an expression body is a synthesized return statement.
+    auto const* body = as_if<ScopeNode>(ecmascript_function->ecmascript_code());
+    if (!body || body->children().size() != 1)
+        return {};
+
+    auto const* return_statement = as_if<ReturnStatement>(*body->children().first());
+    if (!return_statement || !return_statement->argument())
+        return {};
+
+    auto const* subtraction = as_if<BinaryExpression>(*return_statement->argument());
+    if (!subtraction || subtraction->op() != BinaryOp::Subtraction)
+        return {};
+
+    auto const* lhs = as_if<Identifier>(subtraction->lhs());
+    auto const* rhs = as_if<Identifier>(subtraction->rhs());
+    if (!lhs || !rhs)
+        return {};
+
+    if (lhs->string() == first_parameter && rhs->string() == second_parameter)
+        return SubtractionComparator::Ascending;
+    if (lhs->string() == second_parameter && rhs->string() == first_parameter)
+        return SubtractionComparator::Descending;
+    return {};
+}
+
+double compare_with_subtraction_comparator(SubtractionComparator comparator, Value x, Value y)
+{
+    VERIFY(x.is_number() && y.is_number());
+
+    // NOTE: This is what CompareArrayElements and CompareTypedArrayElements would return after calling the comparator.
+    auto difference = comparator == SubtractionComparator::Ascending ? x.as_double() - y.as_double() : y.as_double() - x.as_double();
+    if (isnan(difference))
+        return 0;
+    return difference;
+}
+
 // NON-STANDARD: Used to return the value of the ephemeral length property
 ThrowCompletionOr<Optional<PropertyDescriptor>> Array::internal_get_own_property(PropertyKey const& property_key) const
 {
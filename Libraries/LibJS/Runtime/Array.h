@@ -88,4 +88,14 @@ enum class Holes {
 ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes);
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 
+enum class SubtractionComparator {
+    Ascending,
+    Descending,
+};
+
+// Returns whether the function is a comparator like `(a, b) => a - b`, which returns the difference of its arguments
+// without any side effects. Sorts may then compute the difference of two Numbers themselves rather than calling it.
+Optional<SubtractionComparator> as_subtraction_comparator(FunctionObject const&);
+double compare_with_subtraction_comparator(SubtractionComparator, Value x, Value y);
+
 }
@@ -11,7 +11,7 @@
 
 namespace JS {
 
-GC_DEFINE_ALLOCATOR(ArrayBuffer);
+GC_DEFINE_STRICTLY_ISOLATED_ALLOCATOR(ArrayBuffer);
 
 static GC::Ref<Object> prototype_for_shared_state(Realm& realm, DataBlock::Shared is_shared)
 {
@@ -84,6 +84,17 @@ public:
 
     void detach_buffer() { m_data_block.byte_buffer = Empty {}; }
 
+    // NOTE: Only buffers that own their data block (i.e. not ones aliasing external memory) can hand it over.
+    Optional<ByteBuffer> take_owned_buffer_and_detach()
+    {
+        auto* buffer = m_data_block.byte_buffer.get_pointer<ByteBuffer>();
+        if (!buffer || m_data_block.is_shared == DataBlock::Shared::Yes)
+            return {};
+        auto owned_buffer = move(*buffer);
+        detach_buffer();
+        return owned_buffer;
+    }
+
     // 25.1.3.4 IsDetachedBuffer ( arrayBuffer ), https://tc39.es/ecma262/#sec-isdetachedbuffer
     bool is_detached() const
     {
@@ -9,6 +9,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashTable.h>
+#include <AK/QuickSort.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -63,7 +64,7 @@ void ArrayPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.lastIndexOf, last_index_of, 1, attr);
     define_native_function(realm, vm.names.map, map, 1, attr);
     define_native_function(realm, vm.names.pop, pop, 0, attr);
-    define_native_function(realm, vm.names.push, push, 1, attr);
+    define_native_function(realm, vm.names.push, push, 1, attr, Bytecode::Builtin::ArrayPrototypePush);
     define_native_function(realm, vm.names.reduce, reduce, 1, attr);
     define_native_function(realm, vm.names.reduceRight, reduce_right, 1, attr);
     define_native_function(realm, vm.names.reverse, reverse, 0, attr);
@@ -344,6 +345,56 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::every)
     return Value(true);
 }
 
+// OPTIMIZATION: Returns the packed elements of an Array whose indexed properties can be accessed without going through
+//               [[Get]] and friends: it isn't a proxy target, its prototype chain is intact (so holes read as undefined) and
+//               its storage is simple (so all elements are plain writable data properties).
+static SimpleIndexedPropertyStorage const* simple_storage_of_ordinary_array(Object const& object, u64 length)
+{
+    auto const* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || !array->default_prototype_chain_intact())
+        return nullptr;
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage() || storage->array_like_size() != length)
+        return nullptr;
+    return static_cast<SimpleIndexedPropertyStorage const*>(storage);
+}
+
+// Returns the value of a Number if it can be equal to an element of Int32 storage.
+static Optional<i32> number_as_i32(Value value)
+{
+    if (value.is_int32())
+        return value.as_i32();
+    auto number = value.as_double();
+    if (number < NumericLimits<i32>::min() || number > NumericLimits<i32>::max())
+        return {};
+    auto integer = static_cast<i32>(number);
+    if (integer != number)
+        return {};
+    return integer;
+}
+
+// The decimal string of an Int32 element, as compared by the default SortCompare.
+struct Int32SortKey {
+    explicit Int32SortKey(i32 value)
+        : value(value)
+    {
+        auto magnitude = value < 0 ? -static_cast<u32>(value) : static_cast<u32>(value);
+        offset = characters.size();
+        do {
+            characters[--offset] = '0' + (magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0)
+            characters[--offset] = '-';
+    }
+
+    StringView string() const { return { characters.data() + offset, characters.size() - offset }; }
+
+    i32 value { 0 };
+    u8 offset { 0 };
+    AK::Array<char, 11> characters;
+};
+
 // 23.1.3.7 Array.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-array.prototype.fill
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::fill)
 {
@@ -379,6 +430,14 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::fill)
     else
         to = min(relative_end, length);
 
+    // OPTIMIZATION: Writable data properties can be overwritten in place, and filling holes can't hit a setter.
+    if (simple_storage_of_ordinary_array(this_object, length) && TRY(this_object->is_extensible())) {
+        auto& indexed_properties = static_cast<Array&>(*this_object).indexed_properties();
+        for (u64 i = from; i < to; i++)
+            indexed_properties.put(i, vm.argument(0));
+        return this_object;
+    }
+
     for (u64 i = from; i < to; i++)
         TRY(this_object->set(i, vm.argument(0), Object::ShouldThrowExceptions::Yes));
 
@@ -742,6 +801,37 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Scan the packed elements directly, using the element kind to skip per-element type checks.
+    if (auto const* storage = simple_storage_of_ordinary_array(this_object, length)) {
+        auto const* elements = storage->elements().data();
+        auto element_kind = storage->element_kind();
+
+        if (element_kind != SimpleIndexedPropertyStorage::ElementKind::Generic) {
+            // Only a hole can match a search element that isn't a Number.
+            if (!value_to_find.is_number() && !value_to_find.is_undefined())
+                return Value(false);
+        }
+
+        if (element_kind == SimpleIndexedPropertyStorage::ElementKind::Int32 && value_to_find.is_number()) {
+            auto integer_to_find = number_as_i32(value_to_find);
+            if (!integer_to_find.has_value())
+                return Value(false);
+            for (u64 i = from_index; i < length; ++i) {
+                if (elements[i].is_int32() && elements[i].as_i32() == *integer_to_find)
+                    return Value(true);
+            }
+            return Value(false);
+        }
+
+        for (u64 i = from_index; i < length; ++i) {
+            auto element = elements[i].is_special_empty_value() ? js_undefined() : elements[i];
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+        return Value(false);
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +885,32 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Scan the packed elements directly, using the element kind to skip per-element type checks.
+    if (auto const* storage = simple_storage_of_ordinary_array(object, length)) {
+        auto const* elements = storage->elements().data();
+        auto element_kind = storage->element_kind();
+
+        if (element_kind != SimpleIndexedPropertyStorage::ElementKind::Generic && !search_element.is_number())
+            return Value(-1);
+
+        if (element_kind == SimpleIndexedPropertyStorage::ElementKind::Int32) {
+            auto integer_to_find = number_as_i32(search_element);
+            if (!integer_to_find.has_value())
+                return Value(-1);
+            for (; k < length; ++k) {
+                if (elements[k].is_int32() && elements[k].as_i32() == *integer_to_find)
+                    return Value(k);
+            }
+            return Value(-1);
+        }
+
+        for (; k < length; ++k) {
+            if (!elements[k].is_special_empty_value() && is_strictly_equal(search_element, elements[k]))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -999,14 +1115,19 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::pop)
 // 23.1.3.23 Array.prototype.push ( ...items ), https://tc39.es/ecma262/#sec-array.prototype.push
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
 {
-    auto this_object = TRY(vm.this_value().to_object(vm));
+    return push_impl(vm, vm.this_value(), vm.running_execution_context().arguments);
+}
+
+ThrowCompletionOr<Value> ArrayPrototype::push_impl(VM& vm, Value this_value, ReadonlySpan<Value> items)
+{
+    auto this_object = TRY(this_value.to_object(vm));
     auto length = TRY(length_of_array_like(vm, this_object));
-    auto argument_count = vm.argument_count();
+    auto argument_count = items.size();
     auto new_length = length + argument_count;
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
     for (size_t i = 0; i < argument_count; ++i)
-        TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
+        TRY(this_object->set(length + i, items[i], Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
     TRY(this_object->set(vm.names.length, new_length_value, Object::ShouldThrowExceptions::Yes));
     return new_length_value;
@@ -1352,60 +1473,250 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     return Value(false);
 }
 
-ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
-{
-    // FIXME: it would probably be better to switch to insertion sort for small arrays for
-    // better performance
-    if (arr_to_sort.size() <= 1)
+namespace {
+
+// A TimSort, as first written for CPython: https://github.com/python/cpython/blob/main/Objects/listsort.txt
+//
+// The list is split into runs which are already in order (reversing descending ones), and short runs are extended to a
+// minimum length with a binary insertion sort. Runs are pushed onto a stack and merged with their neighbours whenever
+// their lengths become unbalanced, so that merges stay cheap. Input which is already (mostly) in order, as it is very
+// often in practice, is sorted with O(n) comparisons. All merges share a single buffer of at most n/2 elements.
+//
+// FIXME: Implement "galloping", which speeds up merges of runs that only interleave in long stretches.
+class TimSort {
+public:
+    using CompareFunction = Function<ThrowCompletionOr<double>(Value, Value)>;
+
+    TimSort(VM& vm, CompareFunction const& compare, GC::RootVector<Value>& values)
+        : m_compare(compare)
+        , m_values(values)
+        , m_buffer(vm.heap())
+    {
+        m_buffer.ensure_capacity(values.size() / 2);
+    }
+
+    ThrowCompletionOr<void> sort()
+    {
+        auto size = m_values.size();
+        auto minimum_run_length = compute_minimum_run_length(size);
+
+        for (size_t start = 0; start < size;) {
+            auto run_length = TRY(count_run_and_make_ascending(start));
+
+            // Extend short runs to the minimum run length.
+            if (run_length < minimum_run_length) {
+                auto extended_run_length = min(minimum_run_length, size - start);
+                TRY(binary_insertion_sort(start, start + extended_run_length, start + run_length));
+                run_length = extended_run_length;
+            }
+
+            m_runs.append({ start, run_length });
+            TRY(merge_collapse());
+
+            start += run_length;
+        }
+
+        TRY(merge_force_collapse());
+        VERIFY(m_runs.size() == 1);
         return {};
+    }
 
-    GC::RootVector<Value> left(vm.heap());
-    GC::RootVector<Value> right(vm.heap());
+private:
+    struct Run {
+        size_t base { 0 };
+        size_t length { 0 };
+    };
 
-    left.ensure_capacity(arr_to_sort.size() / 2);
-    right.ensure_capacity(arr_to_sort.size() / 2 + (arr_to_sort.size() & 1));
+    // Lists shorter than this do not need any merging.
+    static constexpr size_t minimum_merge_length = 64;
 
-    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
-        if (i < arr_to_sort.size() / 2) {
-            left.append(arr_to_sort[i]);
+    static size_t compute_minimum_run_length(size_t size)
+    {
+        // Picks a length in [32, 64] such that size / length is a power of two, or close to but less than one.
+        size_t remainder = 0;
+        while (size >= minimum_merge_length) {
+            remainder |= size & 1;
+            size >>= 1;
+        }
+        return size + remainder;
+    }
+
+    ThrowCompletionOr<bool> is_less_than(Value x, Value y)
+    {
+        return TRY(m_compare(x, y)) < 0;
+    }
+
+    // Returns the length of the run which begins at the start. A descending run is reversed in place, which is only
+    // done for strictly descending runs, so that the sort stays stable.
+    ThrowCompletionOr<size_t> count_run_and_make_ascending(size_t start)
+    {
+        auto end = start + 1;
+        if (end == m_values.size())
+            return 1;
+
+        if (TRY(is_less_than(m_values[end], m_values[start]))) {
+            ++end;
+            while (end < m_values.size() && TRY(is_less_than(m_values[end], m_values[end - 1])))
+                ++end;
+
+            for (size_t low = start, high = end - 1; low < high; ++low, --high)
+                swap(m_values[low], m_values[high]);
         } else {
-            right.append(arr_to_sort[i]);
+            ++end;
+            while (end < m_values.size() && !TRY(is_less_than(m_values[end], m_values[end - 1])))
+                ++end;
         }
+
+        return end - start;
     }
 
-    TRY(array_merge_sort(vm, compare_func, left));
-    TRY(array_merge_sort(vm, compare_func, right));
+    // Sorts [start, end), of which [start, sorted_end) is already in order.
+    ThrowCompletionOr<void> binary_insertion_sort(size_t start, size_t end, size_t sorted_end)
+    {
+        for (auto i = sorted_end; i < end; ++i) {
+            auto pivot = m_values[i];
 
-    arr_to_sort.clear();
+            // Find the position after all elements that are not greater than the pivot, to keep equal elements in order.
+            auto low = start;
+            auto high = i;
+            while (low < high) {
+                auto middle = low + (high - low) / 2;
+                if (TRY(is_less_than(pivot, m_values[middle])))
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
 
-    size_t left_index = 0, right_index = 0;
+            for (auto j = i; j > low; --j)
+                m_values[j] = m_values[j - 1];
+            m_values[low] = pivot;
+        }
 
-    while (left_index < left.size() && right_index < right.size()) {
-        auto x = left[left_index];
-        auto y = right[right_index];
+        return {};
+    }
+
+    // Merges runs until the run lengths on the stack satisfy the invariants below, which keep the stack short and the
+    // merges balanced. These are checked for the top four runs, as three are not enough:
+    // https://web.archive.org/web/20150716000631/http://envisage-project.eu/proving-android-java-and-python-sorting-algorithm-is-broken-and-how-to-fix-it/
+    //
+    //     runs[n-2].length > runs[n-1].length + runs[n].length
+    //     runs[n-1].length > runs[n].length
+    ThrowCompletionOr<void> merge_collapse()
+    {
+        while (m_runs.size() > 1) {
+            auto n = m_runs.size() - 2;
+
+            if ((n > 0 && m_runs[n - 1].length <= m_runs[n].length + m_runs[n + 1].length)
+                || (n > 1 && m_runs[n - 2].length <= m_runs[n - 1].length + m_runs[n].length)) {
+                if (m_runs[n - 1].length < m_runs[n + 1].length)
+                    --n;
+            } else if (m_runs[n].length > m_runs[n + 1].length) {
+                break;
+            }
 
-        double comparison_result = TRY(compare_func(x, y));
+            TRY(merge_at(n));
+        }
 
-        if (comparison_result <= 0) {
-            arr_to_sort.append(x);
-            left_index++;
-        } else {
-            arr_to_sort.append(y);
-            right_index++;
+        return {};
+    }
+
+    ThrowCompletionOr<void> merge_force_collapse()
+    {
+        while (m_runs.size() > 1) {
+            auto n = m_runs.size() - 2;
+            if (n > 0 && m_runs[n - 1].length < m_runs[n + 1].length)
+                --n;
+            TRY(merge_at(n));
         }
+
+        return {};
     }
 
-    while (left_index < left.size()) {
-        arr_to_sort.append(left[left_index]);
-        left_index++;
+    // Merges the runs at the index and the one after it.
+    ThrowCompletionOr<void> merge_at(size_t index)
+    {
+        auto first = m_runs[index];
+        auto second = m_runs[index + 1];
+        VERIFY(first.base + first.length == second.base);
+
+        m_runs[index].length += second.length;
+        m_runs.remove(index + 1);
+
+        // If the last element of the first run is not greater than the first element of the second, they are in order.
+        if (!TRY(is_less_than(m_values[second.base], m_values[second.base - 1])))
+            return {};
+
+        // Copy the shorter run into the buffer, so that it never needs more than n/2 elements.
+        if (first.length <= second.length)
+            return merge_low(first, second);
+        return merge_high(first, second);
+    }
+
+    // Merges from the front, with the first run moved into the buffer.
+    ThrowCompletionOr<void> merge_low(Run first, Run second)
+    {
+        m_buffer.clear_with_capacity();
+        for (size_t i = 0; i < first.length; ++i)
+            m_buffer.unchecked_append(m_values[first.base + i]);
+
+        size_t buffer_index = 0;
+        auto second_index = second.base;
+        auto second_end = second.base + second.length;
+        auto destination = first.base;
+
+        // NOTE: If a comparison throws, the values that are left in the buffer are lost along with the sorted list.
+        while (buffer_index < first.length && second_index < second_end) {
+            if (TRY(is_less_than(m_values[second_index], m_buffer[buffer_index])))
+                m_values[destination++] = m_values[second_index++];
+            else
+                m_values[destination++] = m_buffer[buffer_index++];
+        }
+
+        while (buffer_index < first.length)
+            m_values[destination++] = m_buffer[buffer_index++];
+
+        return {};
     }
 
-    while (right_index < right.size()) {
-        arr_to_sort.append(right[right_index]);
-        right_index++;
+    // Merges from the back, with the second run moved into the buffer.
+    ThrowCompletionOr<void> merge_high(Run first, Run second)
+    {
+        m_buffer.clear_with_capacity();
+        for (size_t i = 0; i < second.length; ++i)
+            m_buffer.unchecked_append(m_values[second.base + i]);
+
+        // NOTE: These are one past the elements that are merged next, as the first run may be drained completely.
+        auto buffer_index = second.length;
+        auto first_index = first.base + first.length;
+        auto destination = second.base + second.length;
+
+        while (buffer_index > 0 && first_index > first.base) {
+            if (TRY(is_less_than(m_buffer[buffer_index - 1], m_values[first_index - 1])))
+                m_values[--destination] = m_values[--first_index];
+            else
+                m_values[--destination] = m_buffer[--buffer_index];
+        }
+
+        while (buffer_index > 0)
+            m_values[--destination] = m_buffer[--buffer_index];
+
+        return {};
     }
 
-    return {};
+    CompareFunction const& m_compare;
+    GC::RootVector<Value>& m_values;
+    GC::RootVector<Value> m_buffer;
+    Vector<Run, 64> m_runs;
+};
+
+}
+
+ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
+{
+    if (arr_to_sort.size() <= 1)
+        return {};
+
+    return TimSort { vm, compare_func, arr_to_sort }.sort();
 }
 
 // 23.1.3.30 Array.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-array.prototype.sort
@@ -1422,8 +1733,32 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     // 3. Let len be ? LengthOfArrayLike(obj).
     auto length = TRY(length_of_array_like(vm, object));
 
+    // OPTIMIZATION: The default SortCompare orders Int32 elements by their decimal strings. Equal strings mean equal
+    //               integers, so an unstable sort is indistinguishable, and the strings can be built without allocating.
+    if (auto const* storage = simple_storage_of_ordinary_array(object, length); storage && comparefn.is_undefined() && storage->element_kind() == SimpleIndexedPropertyStorage::ElementKind::Int32 && !storage->has_empty_elements()) {
+        Vector<Int32SortKey> keys;
+        keys.ensure_capacity(length);
+        for (size_t i = 0; i < length; ++i)
+            keys.unchecked_append(Int32SortKey { storage->elements()[i].as_i32() });
+
+        quick_sort(keys, [](auto const& a, auto const& b) { return a.string() < b.string(); });
+
+        auto& indexed_properties = static_cast<Array&>(*object).indexed_properties();
+        for (size_t i = 0; i < length; ++i)
+            indexed_properties.put(i, Value(keys[i].value));
+        return object;
+    }
+
+    Optional<SubtractionComparator> subtraction_comparator;
+    if (!comparefn.is_undefined())
+        subtraction_comparator = as_subtraction_comparator(comparefn.as_function());
+
     // 4. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
+        // OPTIMIZATION: Comparators like `(a, b) => a - b` do not need to be called to compare two Numbers.
+        if (subtraction_comparator.has_value() && x.is_number() && y.is_number())
+            return compare_with_subtraction_comparator(*subtraction_comparator, x, y);
+
         // a. Return ? CompareArrayElements(x, y, comparefn).
         return TRY(compare_array_elements(vm, x, y, comparefn.is_undefined() ? nullptr : &comparefn.as_function()));
     };
@@ -1730,8 +2065,16 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     // 4. Let A be ? ArrayCreate(𝔽(len)).
     auto array = TRY(Array::create(realm, length));
 
+    Optional<SubtractionComparator> subtraction_comparator;
+    if (!comparefn.is_undefined())
+        subtraction_comparator = as_subtraction_comparator(comparefn.as_function());
+
     // 5. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
+        // OPTIMIZATION: Comparators like `(a, b) => a - b` do not need to be called to compare two Numbers.
+        if (subtraction_comparator.has_value() && x.is_number() && y.is_number())
+            return compare_with_subtraction_comparator(*subtraction_comparator, x, y);
+
         // a. Return ? CompareArrayElements(x, y, comparefn).
         return TRY(compare_array_elements(vm, x, y, comparefn.is_undefined() ? nullptr : &comparefn.as_function()));
     };
@@ -19,6 +19,8 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~ArrayPrototype() override = default;
 
+    static ThrowCompletionOr<Value> push_impl(VM&, Value this_value, ReadonlySpan<Value> items);
+
 private:
     explicit ArrayPrototype(Realm&);
 
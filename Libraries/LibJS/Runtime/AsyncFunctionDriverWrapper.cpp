@@ -10,6 +10,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
+#include <LibJS/Runtime/PromiseReaction.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -75,8 +76,13 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     };
 
     // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
-    if (!m_on_fulfilled)
-        m_on_fulfilled = NativeFunction::create(realm, move(fulfilled_closure), 1);
+    // OPTIMIZATION: The closures are the same for every await of this async function, as are the reactions that
+    //               PerformPromiseThen creates for them, so we only create them once and reuse them. This leaves
+    //               awaiting a (native) promise without any allocations until the promise is settled.
+    if (!m_fulfill_reaction) {
+        auto on_fulfilled = NativeFunction::create(realm, move(fulfilled_closure), 1);
+        m_fulfill_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Fulfill, {}, vm.host_make_job_callback(on_fulfilled));
+    }
 
     // 5. Let rejectedClosure be a new Abstract Closure with parameters (reason) that captures asyncContext and performs the
     //    following steps when called:
@@ -104,12 +110,14 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     };
 
     // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
-    if (!m_on_rejected)
-        m_on_rejected = NativeFunction::create(realm, move(rejected_closure), 1);
+    if (!m_reject_reaction) {
+        auto on_rejected = NativeFunction::create(realm, move(rejected_closure), 1);
+        m_reject_reaction = PromiseReaction::create(vm, PromiseReaction::Type::Reject, {}, vm.host_make_job_callback(on_rejected));
+    }
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
     m_current_promise = as<Promise>(promise_object);
-    m_current_promise->perform_then(m_on_fulfilled, m_on_rejected, {});
+    m_current_promise->perform_then(*m_fulfill_reaction, *m_reject_reaction);
 
     // NOTE: None of these are necessary. 8-12 are handled by step d of the above lambdas.
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
@@ -178,8 +186,8 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
         visitor.visit(m_current_promise);
     if (m_suspended_execution_context)
         m_suspended_execution_context->visit_edges(visitor);
-    visitor.visit(m_on_fulfilled);
-    visitor.visit(m_on_rejected);
+    visitor.visit(m_fulfill_reaction);
+    visitor.visit(m_reject_reaction);
 }
 
 }
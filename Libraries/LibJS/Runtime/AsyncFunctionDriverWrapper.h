@@ -35,8 +35,8 @@ private:
     GC::Ptr<Promise> m_current_promise { nullptr };
     OwnPtr<ExecutionContext> m_suspended_execution_context;
 
-    GC::Ptr<NativeFunction> m_on_fulfilled;
-    GC::Ptr<NativeFunction> m_on_rejected;
+    GC::Ptr<PromiseReaction> m_fulfill_reaction;
+    GC::Ptr<PromiseReaction> m_reject_reaction;
 };
 
 }
@@ -8,7 +8,7 @@
 
 namespace JS {
 
-GC_DEFINE_ALLOCATOR(DataView);
+GC_DEFINE_STRICTLY_ISOLATED_ALLOCATOR(DataView);
 
 GC::Ref<DataView> DataView::create(Realm& realm, ArrayBuffer* viewed_buffer, ByteLength byte_length, size_t byte_offset)
 {
@@ -414,6 +414,51 @@ Vector<Crypto::SignedBigInteger> get_named_time_zone_epoch_nanoseconds(StringVie
     return result;
 }
 
+static Optional<String> cached_system_time_zone_identifier;
+
+// OPTIMIZATION: Looking up a time zone offset through ICU is expensive, and Date operations repeatedly look up offsets of
+//               the system time zone for nearby times. So we cache the intervals between the offset transitions of the
+//               system time zone that we have looked up, which are sorted and disjoint, and binary search them instead.
+static Vector<Unicode::TimeZoneOffsetInterval> cached_system_time_zone_offset_intervals;
+static constexpr size_t max_cached_system_time_zone_offset_intervals = 256;
+
+static Unicode::TimeZoneOffset named_time_zone_offset(StringView time_zone_identifier, UnixDateTime time)
+{
+    if (!cached_system_time_zone_identifier.has_value() || time_zone_identifier != *cached_system_time_zone_identifier) {
+        auto offset = Unicode::time_zone_offset(time_zone_identifier, time);
+        VERIFY(offset.has_value());
+
+        return offset.release_value();
+    }
+
+    auto& intervals = cached_system_time_zone_offset_intervals;
+
+    // Find the first interval that ends after the given time.
+    size_t low = 0;
+    size_t high = intervals.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (intervals[middle].end <= time)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    if (low < intervals.size() && intervals[low].start <= time)
+        return intervals[low].offset;
+
+    auto interval = Unicode::time_zone_offset_interval(time_zone_identifier, time);
+    VERIFY(interval.has_value());
+
+    if (intervals.size() >= max_cached_system_time_zone_offset_intervals) {
+        intervals.clear_with_capacity();
+        low = 0;
+    }
+    intervals.insert(low, *interval);
+
+    return interval->offset;
+}
+
 // 21.4.1.21 GetNamedTimeZoneOffsetNanoseconds ( timeZoneIdentifier, epochNanoseconds ), https://tc39.es/ecma262/#sec-getnamedtimezoneoffsetnanoseconds
 Unicode::TimeZoneOffset get_named_time_zone_offset_nanoseconds(StringView time_zone_identifier, Crypto::SignedBigInteger const& epoch_nanoseconds)
 {
@@ -422,10 +467,7 @@ Unicode::TimeZoneOffset get_named_time_zone_offset_nanoseconds(StringView time_z
     auto seconds = epoch_nanoseconds.divided_by(Temporal::NANOSECONDS_PER_SECOND).quotient;
     auto time = UnixDateTime::from_seconds_since_epoch(clip_bigint_to_sane_time(seconds));
 
-    auto offset = Unicode::time_zone_offset(time_zone_identifier, time);
-    VERIFY(offset.has_value());
-
-    return offset.release_value();
+    return named_time_zone_offset(time_zone_identifier, time);
 }
 
 // 21.4.1.21 GetNamedTimeZoneOffsetNanoseconds ( timeZoneIdentifier, epochNanoseconds ), https://tc39.es/ecma262/#sec-getnamedtimezoneoffsetnanoseconds
@@ -435,14 +477,9 @@ Unicode::TimeZoneOffset get_named_time_zone_offset_milliseconds(StringView time_
     auto seconds = epoch_milliseconds / 1000.0;
     auto time = UnixDateTime::from_seconds_since_epoch(clip_double_to_sane_time(seconds));
 
-    auto offset = Unicode::time_zone_offset(time_zone_identifier, time);
-    VERIFY(offset.has_value());
-
-    return offset.release_value();
+    return named_time_zone_offset(time_zone_identifier, time);
 }
 
-static Optional<String> cached_system_time_zone_identifier;
-
 // 21.4.1.24 SystemTimeZoneIdentifier ( ), https://tc39.es/ecma262/#sec-systemtimezoneidentifier
 String system_time_zone_identifier()
 {
@@ -472,6 +509,7 @@ String system_time_zone_identifier()
 void clear_system_time_zone_cache()
 {
     cached_system_time_zone_identifier.clear();
+    cached_system_time_zone_offset_intervals.clear();
 }
 
 // 21.4.1.25 LocalTime ( t ), https://tc39.es/ecma262/#sec-localtime
@@ -168,7 +168,7 @@ JS_DEFINE_NATIVE_FUNCTION(FunctionPrototype::to_string)
     // 2. If Type(func) is Object and func has a [[SourceText]] internal slot and func.[[SourceText]] is a sequence of Unicode code points and HostHasSourceTextAvailable(func) is true, then
     if (is<ECMAScriptFunctionObject>(function)) {
         // a. Return CodePointsToString(func.[[SourceText]]).
-        return PrimitiveString::create(vm, static_cast<ECMAScriptFunctionObject&>(function).source_text());
+        return static_cast<ECMAScriptFunctionObject&>(function).source_text().to_primitive_string(vm);
     }
 
     // 3. If func is a built-in function object, return an implementation-defined String source code representation of func. The representation must have the syntax of a NativeFunction. Additionally, if func has an [[InitialName]] internal slot and func.[[InitialName]] is a String, the portion of the returned String that would be matched by NativeFunctionAccessor[opt] PropertyName must be the value of func.[[InitialName]].
@@ -21,7 +21,7 @@ void GeneratorPrototype::initialize(Realm& realm)
     auto& vm = this->vm();
     Base::initialize(realm);
     u8 attr = Attribute::Writable | Attribute::Configurable;
-    define_native_function(realm, vm.names.next, next, 1, attr);
+    define_native_function(realm, vm.names.next, next, 1, attr, Bytecode::Builtin::GeneratorPrototypeNext);
     define_native_function(realm, vm.names.return_, return_, 1, attr);
     define_native_function(realm, vm.names.throw_, throw_, 1, attr);
 
@@ -17,6 +17,8 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : IndexedPropertyStorage(IsSimpleStorage::Yes, initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements)
+        widen_element_kind_for(value);
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -59,6 +61,7 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     if (value.is_special_empty_value()) {
         ++m_number_of_empty_elements;
     }
+    widen_element_kind_for(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
@@ -62,6 +62,14 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // Describes every non-empty element in the storage. Kinds only ever widen, from Int32 to Number to Generic,
+    // which lets builtins scan the packed elements without having to look at the type of each one.
+    enum class ElementKind : u8 {
+        Int32,
+        Number,
+        Generic,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes)
     {
@@ -95,13 +103,23 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void widen_element_kind_for(Value value)
+    {
+        if (m_element_kind == ElementKind::Generic || value.is_int32() || value.is_special_empty_value())
+            return;
+        m_element_kind = value.is_number() ? ElementKind::Number : ElementKind::Generic;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::Int32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
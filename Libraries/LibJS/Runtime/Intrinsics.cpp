@@ -30,6 +30,7 @@
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/DataViewConstructor.h>
 #include <LibJS/Runtime/DataViewPrototype.h>
+#include <LibJS/Runtime/Date.h>
 #include <LibJS/Runtime/DateConstructor.h>
 #include <LibJS/Runtime/DatePrototype.h>
 #include <LibJS/Runtime/DisposableStackConstructor.h>
@@ -46,6 +47,7 @@
 #include <LibJS/Runtime/Intl/Collator.h>
 #include <LibJS/Runtime/Intl/CollatorConstructor.h>
 #include <LibJS/Runtime/Intl/CollatorPrototype.h>
+#include <LibJS/Runtime/Intl/DateTimeFormat.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatConstructor.h>
 #include <LibJS/Runtime/Intl/DateTimeFormatPrototype.h>
 #include <LibJS/Runtime/Intl/DisplayNamesConstructor.h>
@@ -57,6 +59,7 @@
 #include <LibJS/Runtime/Intl/ListFormatPrototype.h>
 #include <LibJS/Runtime/Intl/LocaleConstructor.h>
 #include <LibJS/Runtime/Intl/LocalePrototype.h>
+#include <LibJS/Runtime/Intl/NumberFormat.h>
 #include <LibJS/Runtime/Intl/NumberFormatConstructor.h>
 #include <LibJS/Runtime/Intl/NumberFormatPrototype.h>
 #include <LibJS/Runtime/Intl/PluralRulesConstructor.h>
@@ -480,6 +483,10 @@ void Intrinsics::visit_edges(Visitor& visitor)
 #undef __JS_ENUMERATE
 
     visitor.visit(m_default_collator);
+    visitor.visit(m_default_number_format);
+    visitor.visit(m_default_date_time_format);
+    visitor.visit(m_default_date_format);
+    visitor.visit(m_default_time_format);
 }
 
 GC::Ref<Intl::Collator> Intrinsics::default_collator()
@@ -490,6 +497,44 @@ GC::Ref<Intl::Collator> Intrinsics::default_collator()
     return *m_default_collator;
 }
 
+GC::Ref<Intl::NumberFormat> Intrinsics::default_number_format()
+{
+    if (!m_default_number_format) {
+        m_default_number_format = as<Intl::NumberFormat>(*MUST(construct(this->vm(), intl_number_format_constructor(), js_undefined(), js_undefined())));
+    }
+    return *m_default_number_format;
+}
+
+GC::Ref<Intl::DateTimeFormat> Intrinsics::default_date_time_format()
+{
+    return get_or_create_default_date_time_format(m_default_date_time_format, Intl::OptionRequired::Any, Intl::OptionDefaults::All);
+}
+
+GC::Ref<Intl::DateTimeFormat> Intrinsics::default_date_format()
+{
+    return get_or_create_default_date_time_format(m_default_date_format, Intl::OptionRequired::Date, Intl::OptionDefaults::Date);
+}
+
+GC::Ref<Intl::DateTimeFormat> Intrinsics::default_time_format()
+{
+    return get_or_create_default_date_time_format(m_default_time_format, Intl::OptionRequired::Time, Intl::OptionDefaults::Time);
+}
+
+GC::Ref<Intl::DateTimeFormat> Intrinsics::get_or_create_default_date_time_format(GC::Ptr<Intl::DateTimeFormat>& date_time_format, Intl::OptionRequired required, Intl::OptionDefaults defaults)
+{
+    // The formats resolve the system time zone when they are created, so they have to be recreated if it changes.
+    if (auto time_zone = system_time_zone_identifier(); time_zone != m_default_date_time_formats_time_zone) {
+        m_default_date_time_format = nullptr;
+        m_default_date_format = nullptr;
+        m_default_time_format = nullptr;
+        m_default_date_time_formats_time_zone = move(time_zone);
+    }
+
+    if (!date_time_format)
+        date_time_format = MUST(Intl::create_date_time_format(this->vm(), intl_date_time_format_constructor(), js_undefined(), js_undefined(), required, defaults));
+    return *date_time_format;
+}
+
 // 10.2.4 AddRestrictedFunctionProperties ( F, realm ), https://tc39.es/ecma262/#sec-addrestrictedfunctionproperties
 void add_restricted_function_properties(FunctionObject& function, Realm& realm)
 {
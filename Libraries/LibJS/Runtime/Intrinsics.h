@@ -126,6 +126,10 @@ public:
 #undef __JS_ENUMERATE
 
     [[nodiscard]] GC::Ref<Intl::Collator> default_collator();
+    [[nodiscard]] GC::Ref<Intl::NumberFormat> default_number_format();
+    [[nodiscard]] GC::Ref<Intl::DateTimeFormat> default_date_time_format();
+    [[nodiscard]] GC::Ref<Intl::DateTimeFormat> default_date_format();
+    [[nodiscard]] GC::Ref<Intl::DateTimeFormat> default_time_format();
 
 private:
     Intrinsics(Realm& realm)
@@ -137,6 +141,8 @@ private:
 
     void initialize_intrinsics(Realm&);
 
+    GC::Ref<Intl::DateTimeFormat> get_or_create_default_date_time_format(GC::Ptr<Intl::DateTimeFormat>&, Intl::OptionRequired, Intl::OptionDefaults);
+
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
     void initialize_##snake_name();
     JS_ENUMERATE_BUILTIN_TYPES
@@ -250,6 +256,13 @@ private:
 #undef __JS_ENUMERATE
 
     GC::Ptr<Intl::Collator> m_default_collator;
+    GC::Ptr<Intl::NumberFormat> m_default_number_format;
+
+    // NOTE: These are only valid for the system time zone they were created with.
+    GC::Ptr<Intl::DateTimeFormat> m_default_date_time_format;
+    GC::Ptr<Intl::DateTimeFormat> m_default_date_format;
+    GC::Ptr<Intl::DateTimeFormat> m_default_time_format;
+    String m_default_date_time_formats_time_zone;
 };
 
 void add_restricted_function_properties(FunctionObject&, Realm&);
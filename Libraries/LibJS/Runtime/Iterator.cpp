@@ -10,7 +10,9 @@
 #include <LibJS/Runtime/AsyncFromSyncIteratorPrototype.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/FunctionObject.h>
+#include <LibJS/Runtime/GeneratorObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -202,6 +204,14 @@ ThrowCompletionOr<Value> iterator_value(VM& vm, Object& iterator_result)
     return TRY(iterator_result.get(vm.names.value));
 }
 
+static bool is_generator_prototype_next(Value next_method)
+{
+    if (!next_method.is_object())
+        return false;
+    auto const* native_function = as_if<NativeFunction>(next_method.as_object());
+    return native_function && native_function->is_generator_prototype_next_builtin();
+}
+
 // 7.4.9 IteratorStep ( iteratorRecord ), https://tc39.es/ecma262/#sec-iteratorstep
 ThrowCompletionOr<IterationResultOrDone> iterator_step(VM& vm, IteratorRecord& iterator_record)
 {
@@ -216,6 +226,19 @@ ThrowCompletionOr<IterationResultOrDone> iterator_step(VM& vm, IteratorRecord& i
         return ThrowCompletionOr<IterationResultOrDone> { IterationResult { done, value } };
     }
 
+    // OPTIMIZATION: If this is a generator whose "next" method hasn't been redefined, resume it directly instead of
+    //               calling %GeneratorPrototype%.next, which would allocate an iterator result object for every step.
+    if (auto* generator = as_if<GeneratorObject>(*iterator_record.iterator); generator && is_generator_prototype_next(iterator_record.next_method)) {
+        auto result = generator->resume(vm, js_undefined(), {});
+        if (result.is_error() || result.value().done) {
+            iterator_record.done = true;
+            if (result.is_error())
+                return result.release_error();
+            return ThrowCompletionOr<IterationResultOrDone> { IterationDone {} };
+        }
+        return ThrowCompletionOr<IterationResultOrDone> { IterationResult { Value(false), result.value().value } };
+    }
+
     // 1. Let result be ? IteratorNext(iteratorRecord).
     auto result = TRY(iterator_next(vm, iterator_record));
 
@@ -10,6 +10,7 @@
 #include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
 #include <AK/TypeCasts.h>
+#include <AK/UnicodeUtils.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
 #include <LibJS/Runtime/AbstractOperations.h>
@@ -137,6 +138,12 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
     // 1. Let value be ? Get(holder, key).
     auto value = TRY(holder->get(key));
 
+    return serialize_json_property_value(vm, state, key, holder, value);
+}
+
+// Steps 2 and onward of SerializeJSONProperty, for callers that have already performed Get(holder, key).
+ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property_value(VM& vm, StringifyState& state, PropertyKey const& key, Object* holder, Value value)
+{
     // 2. If Type(value) is Object or BigInt, then
     if (value.is_object() || value.is_bigint()) {
         // a. Let toJSON be ? GetV(value, "toJSON").
@@ -230,6 +237,43 @@ ThrowCompletionOr<Optional<String>> JSONObject::serialize_json_property(VM& vm,
     return Optional<String> {};
 }
 
+// OPTIMIZATION: The enumerable own property keys of an ordinary object without indexed properties are the enumerable
+//               string keys of its shape, in the order of its property table. As non-dictionary shapes never change, we
+//               can cache these keys for each shape, along with their quoted form, and read their values directly from
+//               the property storage of the objects using the shape.
+JSONObject::ShapeJSONProperties const* JSONObject::shape_json_properties(StringifyState& state, Object& object)
+{
+    // NOTE: Exotic objects either interfere with indexed property access, or (like platform objects) have a prototype
+    //       other than %Object.prototype%, so we only consider objects created by object literals, JSON.parse(),
+    //       Object.create() and the like.
+    if (object.may_interfere_with_indexed_property_access() || object.is_array_exotic_object() || object.has_intrinsic_accessors())
+        return nullptr;
+    if (!object.indexed_properties().is_empty())
+        return nullptr;
+
+    auto& shape = object.shape();
+    if (shape.is_dictionary())
+        return nullptr;
+    if (auto const* prototype = shape.prototype(); prototype && prototype != shape.realm().intrinsics().object_prototype())
+        return nullptr;
+
+    auto& entry = state.shape_properties.ensure(&shape);
+
+    // NOTE: The shape we cached the properties for may have been garbage collected, and its address reused.
+    if (entry.shape.ptr() != &shape) {
+        entry.shape = shape.make_weak_ptr<Shape>();
+        entry.properties.clear_with_capacity();
+
+        for (auto const& [key, metadata] : shape.property_table()) {
+            if (!key.is_string() || !metadata.attributes.is_enumerable())
+                continue;
+            entry.properties.append({ key, metadata.offset, quote_json_string(key.as_string().view()) });
+        }
+    }
+
+    return &entry;
+}
+
 // 25.5.2.4 SerializeJSONObject ( state, value ), https://tc39.es/ecma262/#sec-serializejsonobject
 ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifyState& state, Object& object)
 {
@@ -239,19 +283,39 @@ ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifySta
     state.seen_objects.set(&object);
     String previous_indent = state.indent;
     state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
-    Vector<String> property_strings;
+
+    StringBuilder builder;
+    bool first = true;
+
+    auto append_property = [&](StringView quoted_key, String const& serialized_property_string) {
+        if (first) {
+            builder.append('{');
+            if (!state.gap.is_empty()) {
+                builder.append('\n');
+                builder.append(state.indent);
+            }
+            first = false;
+        } else {
+            builder.append(',');
+            if (!state.gap.is_empty()) {
+                builder.append('\n');
+                builder.append(state.indent);
+            }
+        }
+
+        builder.append(quoted_key);
+        builder.append(':');
+        if (!state.gap.is_empty())
+            builder.append(' ');
+        builder.append(serialized_property_string);
+    };
 
     auto process_property = [&](PropertyKey const& key) -> ThrowCompletionOr<void> {
         if (key.is_symbol())
             return {};
         auto serialized_property_string = TRY(serialize_json_property(vm, state, key, &object));
-        if (serialized_property_string.has_value()) {
-            property_strings.append(MUST(String::formatted(
-                "{}:{}{}",
-                quote_json_string(key.to_string()),
-                state.gap.is_empty() ? "" : " ",
-                serialized_property_string)));
-        }
+        if (serialized_property_string.has_value())
+            append_property(quote_json_string(key.to_string()), *serialized_property_string);
         return {};
     };
 
@@ -259,34 +323,39 @@ ThrowCompletionOr<String> JSONObject::serialize_json_object(VM& vm, StringifySta
         auto property_list = state.property_list.value();
         for (auto& property : property_list)
             TRY(process_property(property));
+    } else if (auto const* shape_properties = shape_json_properties(state, object)) {
+        auto& shape = *shape_properties->shape;
+
+        // NOTE: Serializing a property may run arbitrary code (for example a toJSON() method) which may change the
+        //       properties of the object, so we copy the keys first, and only read values directly from the storage
+        //       while the object still has the same shape.
+        auto properties = shape_properties->properties;
+
+        for (auto const& property : properties) {
+            Optional<Value> value;
+            if (&object.shape() == &shape)
+                value = object.get_direct(property.offset);
+
+            if (value.has_value() && !value->is_accessor()) {
+                auto serialized_property_string = TRY(serialize_json_property_value(vm, state, property.key, &object, *value));
+                if (serialized_property_string.has_value())
+                    append_property(property.quoted_key, *serialized_property_string);
+            } else {
+                auto serialized_property_string = TRY(serialize_json_property(vm, state, property.key, &object));
+                if (serialized_property_string.has_value())
+                    append_property(property.quoted_key, *serialized_property_string);
+            }
+        }
     } else {
         auto property_list = TRY(object.enumerable_own_property_names(PropertyKind::Key));
         for (auto& property : property_list)
             TRY(process_property(property.as_string().utf16_string()));
     }
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
+
+    if (first) {
         builder.append("{}"sv);
     } else {
-        bool first = true;
-        builder.append('{');
-        if (state.gap.is_empty()) {
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-        } else {
-            builder.append('\n');
-            builder.append(state.indent);
-            auto separator = MUST(String::formatted(",\n{}", state.indent));
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
+        if (!state.gap.is_empty()) {
             builder.append('\n');
             builder.append(previous_indent);
         }
@@ -307,52 +376,46 @@ ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyStat
     state.seen_objects.set(&object);
     String previous_indent = state.indent;
     state.indent = MUST(String::formatted("{}{}", state.indent, state.gap));
-    Vector<String> property_strings;
 
     auto length = TRY(length_of_array_like(vm, object));
 
-    // Optimization
-    property_strings.ensure_capacity(length);
+    // OPTIMIZATION: The elements of an ordinary array are read directly from its indexed property storage, unless
+    //               they are holes or accessors, which need to go through [[Get]].
+    auto* array = object.is_array_exotic_object() && !object.may_interfere_with_indexed_property_access() ? &object : nullptr;
+
+    StringBuilder builder;
+    builder.append('[');
 
     for (size_t i = 0; i < length; ++i) {
-        auto serialized_property_string = TRY(serialize_json_property(vm, state, i, &object));
-        if (!serialized_property_string.has_value()) {
-            property_strings.append("null"_string);
-        } else {
-            property_strings.append(serialized_property_string.release_value());
+        if (i > 0)
+            builder.append(',');
+        if (!state.gap.is_empty()) {
+            builder.append('\n');
+            builder.append(state.indent);
         }
+
+        Optional<String> serialized_property_string;
+
+        Optional<ValueAndAttributes> element;
+        if (array && i <= NumericLimits<u32>::max())
+            element = array->indexed_properties().get(static_cast<u32>(i));
+
+        if (element.has_value() && !element->value.is_accessor())
+            serialized_property_string = TRY(serialize_json_property_value(vm, state, i, &object, element->value));
+        else
+            serialized_property_string = TRY(serialize_json_property(vm, state, i, &object));
+
+        if (serialized_property_string.has_value())
+            builder.append(*serialized_property_string);
+        else
+            builder.append("null"sv);
     }
 
-    StringBuilder builder;
-    if (property_strings.is_empty()) {
-        builder.append("[]"sv);
-    } else {
-        if (state.gap.is_empty()) {
-            builder.append('[');
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(',');
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append(']');
-        } else {
-            builder.append("[\n"sv);
-            builder.append(state.indent);
-            auto separator = MUST(String::formatted(",\n{}", state.indent));
-            bool first = true;
-            for (auto& property_string : property_strings) {
-                if (!first)
-                    builder.append(separator);
-                first = false;
-                builder.append(property_string);
-            }
-            builder.append('\n');
-            builder.append(previous_indent);
-            builder.append(']');
-        }
+    if (length > 0 && !state.gap.is_empty()) {
+        builder.append('\n');
+        builder.append(previous_indent);
     }
+    builder.append(']');
 
     state.seen_objects.remove(&object);
     state.indent = previous_indent;
@@ -362,15 +425,18 @@ ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyStat
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
 String JSONObject::quote_json_string(Utf16View const& string)
 {
-    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
     StringBuilder builder;
-    builder.append('"');
+    quote_json_string(builder, string);
+    return builder.to_string_without_validation();
+}
 
-    // 2. For each code point C of StringToCodePoints(value), do
-    for (auto code_point : string) {
+// 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
+void JSONObject::quote_json_string(StringBuilder& builder, Utf16View const& string)
+{
+    auto append_escaped_code_unit = [&](char16_t code_unit) {
         // a. If C is listed in the “Code Point” column of Table 70, then
         // i. Set product to the string-concatenation of product and the escape sequence for C as specified in the “Escape Sequence” column of the corresponding row.
-        switch (code_point) {
+        switch (code_unit) {
         case '\b':
             builder.append("\\b"sv);
             break;
@@ -394,24 +460,65 @@ String JSONObject::quote_json_string(Utf16View const& string)
             break;
         default:
             // b. Else if C has a numeric value less than 0x0020 (SPACE), or if C has the same numeric value as a leading surrogate or trailing surrogate, then
-            if (code_point < 0x20 || is_unicode_surrogate(code_point)) {
-                // i. Let unit be the code unit whose numeric value is that of C.
-                // ii. Set product to the string-concatenation of product and UnicodeEscape(unit).
-                builder.appendff("\\u{:04x}", code_point);
-            }
-            // c. Else,
-            else {
-                // i. Set product to the string-concatenation of product and UTF16EncodeCodePoint(C).
-                builder.append_code_point(code_point);
+            // i. Let unit be the code unit whose numeric value is that of C.
+            // ii. Set product to the string-concatenation of product and UnicodeEscape(unit).
+            builder.appendff("\\u{:04x}", static_cast<u16>(code_unit));
+            break;
+        }
+    };
+
+    auto needs_escaping = [](char16_t code_unit) {
+        return code_unit < 0x20 || code_unit == '"' || code_unit == '\\' || is_unicode_surrogate(code_unit);
+    };
+
+    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
+    builder.append('"');
+
+    // 2. For each code point C of StringToCodePoints(value), do
+    // OPTIMIZATION: Most code points are neither escaped nor part of a lone surrogate, so we append each run of such
+    //               code points at once (c. Set product to the string-concatenation of product and UTF16EncodeCodePoint(C)),
+    //               rather than one code point at a time.
+    if (string.has_ascii_storage()) {
+        auto characters = string.ascii_span();
+        size_t run_start = 0;
+
+        for (size_t i = 0; i < characters.size(); ++i) {
+            if (!needs_escaping(characters[i]))
+                continue;
+
+            builder.append(characters.data() + run_start, i - run_start);
+            append_escaped_code_unit(characters[i]);
+            run_start = i + 1;
+        }
+
+        builder.append(characters.data() + run_start, characters.size() - run_start);
+    } else {
+        auto code_units = string.utf16_span();
+        size_t run_start = 0;
+
+        for (size_t i = 0; i < code_units.size(); ++i) {
+            auto code_unit = code_units[i];
+            if (!needs_escaping(code_unit))
+                continue;
+
+            // NOTE: A leading surrogate followed by a trailing surrogate is a single code point that is not escaped.
+            if (AK::UnicodeUtils::is_utf16_high_surrogate(code_unit) && i + 1 < code_units.size() && AK::UnicodeUtils::is_utf16_low_surrogate(code_units[i + 1])) {
+                ++i;
+                continue;
             }
+
+            builder.append(string.substring_view(run_start, i - run_start));
+            append_escaped_code_unit(code_unit);
+            run_start = i + 1;
         }
+
+        builder.append(string.substring_view(run_start));
     }
 
     // 3. Set product to the string-concatenation of product and the code unit 0x0022 (QUOTATION MARK).
     builder.append('"');
 
     // 4. Return product.
-    return builder.to_string_without_validation();
 }
 
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
@@ -447,21 +554,325 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// A JSON parser that builds JS values directly from the source text, without going through an AK::JsonValue tree first.
+class JSONParser {
+public:
+    JSONParser(VM& vm, StringView text)
+        : m_vm(vm)
+        , m_realm(*vm.current_realm())
+        , m_text(text)
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto value = TRY(parse_value());
+        skip_whitespace();
+        if (!at_end())
+            return syntax_error();
+        return value;
+    }
+
+private:
+    ThrowCompletionOr<Value> syntax_error() const
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    bool at_end() const { return m_position >= m_text.length(); }
+    char peek() const { return at_end() ? '\0' : m_text[m_position]; }
+
+    bool consume_specific(char ch)
+    {
+        if (peek() != ch)
+            return false;
+        ++m_position;
+        return true;
+    }
+
+    bool consume_specific(StringView literal)
+    {
+        if (!m_text.substring_view(m_position).starts_with(literal))
+            return false;
+        m_position += literal.length();
+        return true;
+    }
+
+    void skip_whitespace()
+    {
+        while (!at_end()) {
+            auto ch = m_text[m_position];
+            if (ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r')
+                break;
+            ++m_position;
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        skip_whitespace();
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"': {
+            auto string = TRY(parse_string());
+            return string.visit(
+                [&](StringView view) -> Value { return PrimitiveString::create(m_vm, Utf16String::from_utf8_without_validation(view)); },
+                [&](Utf16String& string) -> Value { return PrimitiveString::create(m_vm, move(string)); });
+        }
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return parse_number();
+        case 't':
+            if (consume_specific("true"sv))
+                return Value(true);
+            break;
+        case 'f':
+            if (consume_specific("false"sv))
+                return Value(false);
+            break;
+        case 'n':
+            if (consume_specific("null"sv))
+                return js_null();
+            break;
+        }
+        return syntax_error();
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        VERIFY(consume_specific('{'));
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+
+        skip_whitespace();
+        if (consume_specific('}'))
+            return object;
+
+        for (;;) {
+            skip_whitespace();
+            if (peek() != '"')
+                return syntax_error();
+            auto key = TRY(parse_property_key());
+
+            skip_whitespace();
+            if (!consume_specific(':'))
+                return syntax_error();
+
+            auto value = TRY(parse_value());
+            object->define_direct_property(key, value, default_attributes);
+
+            skip_whitespace();
+            if (consume_specific('}'))
+                return object;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        VERIFY(consume_specific('['));
+        auto array = MUST(Array::create(m_realm, 0));
+
+        skip_whitespace();
+        if (consume_specific(']'))
+            return array;
+
+        for (;;) {
+            auto value = TRY(parse_value());
+            array->indexed_properties().append(value);
+
+            skip_whitespace();
+            if (consume_specific(']'))
+                return array;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    // OPTIMIZATION: Arrays of records repeat the same handful of keys over and over. Keys without escape sequences
+    //               are views into the source text, so we can remember the PropertyKey we made for each of them,
+    //               and skip both the UTF-16 conversion and the interning the next time they come up.
+    ThrowCompletionOr<PropertyKey> parse_property_key()
+    {
+        auto key = TRY(parse_string());
+        if (auto* string = key.get_pointer<Utf16String>())
+            return PropertyKey { move(*string) };
+
+        auto view = key.get<StringView>();
+        if (auto cached_key = m_property_key_cache.get(view); cached_key.has_value())
+            return *cached_key;
+
+        PropertyKey property_key { Utf16String::from_utf8_without_validation(view) };
+        m_property_key_cache.set(view, property_key);
+        return property_key;
+    }
+
+    // Returns a view into the source text if the string contains no escape sequences.
+    ThrowCompletionOr<Variant<StringView, Utf16String>> parse_string()
+    {
+        VERIFY(consume_specific('"'));
+
+        auto literal_start = m_position;
+        Optional<StringBuilder> builder;
+
+        for (;;) {
+            while (!at_end()) {
+                auto ch = static_cast<u8>(m_text[m_position]);
+                if (ch == '"' || ch == '\\' || ch < 0x20)
+                    break;
+                ++m_position;
+            }
+            if (at_end())
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+
+            auto literal = m_text.substring_view(literal_start, m_position - literal_start);
+            auto ch = m_text[m_position++];
+
+            if (ch == '"') {
+                if (!builder.has_value())
+                    return literal;
+                builder->append(literal);
+                return builder->to_utf16_string();
+            }
+
+            // The control characters U+0000 to U+001F must be escaped.
+            if (ch != '\\')
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+
+            if (!builder.has_value())
+                builder.emplace(StringBuilder::Mode::UTF16);
+            builder->append(literal);
+
+            switch (peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                builder->append(m_text[m_position]);
+                break;
+            case 'b':
+                builder->append('\b');
+                break;
+            case 'f':
+                builder->append('\f');
+                break;
+            case 'n':
+                builder->append('\n');
+                break;
+            case 'r':
+                builder->append('\r');
+                break;
+            case 't':
+                builder->append('\t');
+                break;
+            case 'u': {
+                u16 code_unit = 0;
+                for (size_t i = 1; i <= 4; ++i) {
+                    auto digit = m_position + i < m_text.length() ? m_text[m_position + i] : '\0';
+                    if (!is_ascii_hex_digit(digit))
+                        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+                    code_unit = (code_unit << 4) | parse_ascii_hex_digit(digit);
+                }
+                // NOTE: Lone surrogates are valid in JSON strings, and are kept as-is in the resulting JS string.
+                builder->append_code_unit(code_unit);
+                m_position += 4;
+                break;
+            }
+            default:
+                return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+            }
+
+            ++m_position;
+            literal_start = m_position;
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = m_position;
+        consume_specific('-');
+
+        auto consume_digits = [&] {
+            auto digits_start = m_position;
+            while (is_ascii_digit(peek()))
+                ++m_position;
+            return m_position - digits_start;
+        };
+
+        // Leading zeros are not allowed.
+        if (consume_specific('0')) {
+            if (is_ascii_digit(peek()))
+                return syntax_error();
+        } else if (consume_digits() == 0) {
+            return syntax_error();
+        }
+        auto integer_end = m_position;
+
+        bool is_integer = true;
+        if (consume_specific('.')) {
+            is_integer = false;
+            if (consume_digits() == 0)
+                return syntax_error();
+        }
+        if (consume_specific('e') || consume_specific('E')) {
+            is_integer = false;
+            if (!consume_specific('+'))
+                consume_specific('-');
+            if (consume_digits() == 0)
+                return syntax_error();
+        }
+
+        auto number_text = m_text.substring_view(start, m_position - start);
+
+        // OPTIMIZATION: Most numbers in JSON are small integers, which we can convert without a full floating point parse.
+        //               Negative zero is excluded since it has to become a double.
+        if (is_integer && number_text != "-0"sv && (integer_end - start) <= 10) {
+            if (auto integer = number_text.to_number<i32>(TrimWhitespace::No); integer.has_value())
+                return Value(*integer);
+        }
+
+        auto result = parse_first_number<double>(number_text, TrimWhitespace::No);
+        VERIFY(result.has_value() && result->characters_parsed == number_text.length());
+        return Value(result->value);
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringView m_text;
+    size_t m_position { 0 };
+    HashMap<StringView, PropertyKey> m_property_key_cache;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: The parser works on the UTF-8 text, and hands out views into it, so we validate it once up front.
+    if (!Utf8View { text }.validate())
+        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    auto result = TRY(JSONParser { vm, text }.parse());
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
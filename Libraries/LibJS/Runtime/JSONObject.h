@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/WeakPtr.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Shape.h>
 
 namespace JS {
 
@@ -29,19 +32,35 @@ public:
 private:
     explicit JSONObject(Realm&);
 
+    // The enumerable string-keyed properties of a shape, along with their quoted keys.
+    struct ShapeJSONProperties {
+        struct Property {
+            PropertyKey key;
+            u32 offset { 0 };
+            String quoted_key;
+        };
+
+        WeakPtr<Shape> shape;
+        Vector<Property> properties;
+    };
+
     struct StringifyState {
         GC::Ptr<FunctionObject> replacer_function;
         HashTable<GC::Ptr<Object>> seen_objects;
         String indent;
         String gap;
         Optional<Vector<Utf16String>> property_list;
+        HashMap<Shape const*, ShapeJSONProperties> shape_properties;
     };
 
     // Stringify helpers
     static ThrowCompletionOr<Optional<String>> serialize_json_property(VM&, StringifyState&, PropertyKey const& key, Object* holder);
+    static ThrowCompletionOr<Optional<String>> serialize_json_property_value(VM&, StringifyState&, PropertyKey const& key, Object* holder, Value);
     static ThrowCompletionOr<String> serialize_json_object(VM&, StringifyState&, Object&);
     static ThrowCompletionOr<String> serialize_json_array(VM&, StringifyState&, Object&);
+    static ShapeJSONProperties const* shape_json_properties(StringifyState&, Object&);
     static String quote_json_string(Utf16View const&);
+    static void quote_json_string(StringBuilder&, Utf16View const&);
 
     // Parse helpers
     static Object* parse_json_object(VM&, JsonObject const&);
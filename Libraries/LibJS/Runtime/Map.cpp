@@ -23,71 +23,101 @@ Map::Map(Object& prototype)
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
     m_entries.clear();
+    m_indices.clear();
+    m_removed_entry_count = 0;
+
+    // NOTE: Iterators find their place again by insertion ID, which puts them before any entries added from now on.
+    ++m_compaction_count;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
+    auto index = m_indices.take(key);
     if (!index.has_value())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
+    // NOTE: The entry is only marked as removed, so that the indices of the other entries stay the same.
+    auto& entry = m_entries[*index].entry;
+    entry.key = js_special_empty_value();
+    entry.value = js_special_empty_value();
+    ++m_removed_entry_count;
+
+    compact_if_needed();
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto index = m_indices.get(key); index.has_value())
+        return m_entries[*index].entry.value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return m_indices.contains(key);
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
-    }
+    auto result = m_indices.ensure(key, [&] {
+        m_entries.append({ { key, value }, m_next_insertion_id++ });
+        return m_entries.size() - 1;
+    });
+    m_entries[result].entry.value = value;
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_indices.size();
+}
+
+size_t Map::index_of_first_entry_inserted_since(u64 insertion_id) const
+{
+    // NOTE: Entries are stored in the order of their insertion IDs, so the first one that is not below the given ID
+    //       can be found with a binary search.
+    size_t low = 0;
+    size_t high = m_entries.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (m_entries[middle].insertion_id < insertion_id)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+void Map::compact_if_needed()
+{
+    static constexpr size_t minimum_removed_entry_count_to_compact = 16;
+
+    if (m_removed_entry_count < minimum_removed_entry_count_to_compact || m_removed_entry_count * 2 < m_entries.size())
+        return;
+
+    m_entries.remove_all_matching([](auto const& entry) { return entry.entry.key.is_special_empty_value(); });
+    m_removed_entry_count = 0;
+
+    for (size_t i = 0; i < m_entries.size(); ++i)
+        m_indices.set(m_entries[i].entry.key, i);
+
+    ++m_compaction_count;
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& stored_entry : m_entries) {
+        visitor.visit(stored_entry.entry.key);
+        visitor.visit(stored_entry.entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
+    // NOTE: The keys in m_indices are already visited by the walk over m_entries above.
+    visitor.ignore(m_indices);
 }
 
 }
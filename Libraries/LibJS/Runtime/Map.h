@@ -7,7 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -32,36 +32,47 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    struct Entry {
+        Value key;
+        Value value;
+    };
+
     struct EndIterator {
     };
 
+    // Iterators stay valid while the map is modified: they skip removed entries and visit entries appended after them,
+    // as required for iterating a Map while it is being mutated.
     template<bool IsConst>
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_next_element();
+            return m_index >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
         {
-            ++m_index;
+            ensure_next_element();
+            if (m_index < m_map->m_entries.size()) {
+                ++m_index;
+                m_insertion_id = m_index < m_map->m_entries.size() ? m_map->m_entries[m_index].insertion_id : m_map->m_next_insertion_id;
+            }
             return *this;
         }
 
         decltype(auto) operator*()
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return entry_at_index();
         }
 
         decltype(auto) operator*() const
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return entry_at_index();
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const { return m_insertion_id == other.m_insertion_id && m_map.ptr() == other.m_map.ptr(); }
         bool operator==(EndIterator const&) const { return is_end(); }
 
     private:
@@ -70,34 +81,39 @@ public:
         requires(IsConst)
             : m_map(map)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
         {
-            ensure_index();
         }
 
-        void ensure_index() const
+        auto& entry_at_index() const
         {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
+            return m_map->m_entries[m_index].entry;
         }
 
+        // Moves to the first entry which has not been removed, starting at the entry we were at. If the entries have
+        // been compacted since we last looked at them, our entry is found again by its insertion ID.
         void ensure_next_element() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            if (m_compaction_count != m_map->m_compaction_count) {
+                m_index = m_map->index_of_first_entry_inserted_since(m_insertion_id);
+                m_compaction_count = m_map->m_compaction_count;
+            }
+
+            auto const& entries = m_map->m_entries;
+            while (m_index < entries.size() && entries[m_index].entry.key.is_special_empty_value())
+                ++m_index;
+
+            m_insertion_id = m_index < entries.size() ? entries[m_index].insertion_id : m_map->m_next_insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
         mutable size_t m_index { 0 };
+        mutable u64 m_insertion_id { 0 };
+        mutable u64 m_compaction_count { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -111,9 +127,22 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
-    size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    // An ordered hash table: the entries are stored in a vector in insertion order, and a hash table maps every key to
+    // the index of its entry. Removed entries are left in place with an empty key, so that lookups and iteration stay
+    // cheap, and are compacted away once they make up half of the vector.
+    struct StoredEntry {
+        Entry entry;
+        u64 insertion_id { 0 };
+    };
+
+    size_t index_of_first_entry_inserted_since(u64 insertion_id) const;
+    void compact_if_needed();
+
+    Vector<StoredEntry> m_entries;
+    HashMap<Value, size_t, ValueTraits> m_indices;
+    size_t m_removed_entry_count { 0 };
+    u64 m_next_insertion_id { 0 };
+    u64 m_compaction_count { 0 };
 };
 
 }
@@ -271,10 +271,15 @@ JS_DEFINE_NATIVE_FUNCTION(NumberPrototype::to_locale_string)
     auto number_value = TRY(this_number_value(vm, vm.this_value()));
 
     // 2. Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
-    auto* number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
+    // OPTIMIZATION: If both locales and options are undefined, we can use a cached default-constructed NumberFormat.
+    GC::Ptr<Object> number_format;
+    if (locales.is_undefined() && options.is_undefined())
+        number_format = realm.intrinsics().default_number_format();
+    else
+        number_format = TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options));
 
     // 3. Return ? FormatNumeric(numberFormat, x).
-    auto formatted = Intl::format_numeric(*number_format, number_value);
+    auto formatted = Intl::format_numeric(static_cast<Intl::NumberFormat&>(*number_format), number_value);
     return PrimitiveString::create(vm, move(formatted));
 }
 
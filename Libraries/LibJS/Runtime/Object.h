@@ -246,6 +246,7 @@ public:
     void set_prototype(Object*);
 
     [[nodiscard]] bool has_magical_length_property() const { return m_has_magical_length_property; }
+    [[nodiscard]] bool has_intrinsic_accessors() const { return m_has_intrinsic_accessors; }
 
     [[nodiscard]] bool is_typed_array() const { return m_is_typed_array; }
     void set_is_typed_array() { m_is_typed_array = true; }
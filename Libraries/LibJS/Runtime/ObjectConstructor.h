@@ -22,6 +22,8 @@ public:
     virtual ThrowCompletionOr<Value> call() override;
     virtual ThrowCompletionOr<GC::Ref<Object>> construct(FunctionObject& new_target) override;
 
+    static ThrowCompletionOr<Value> has_own_impl(VM&, Value object, Value property);
+
 private:
     explicit ObjectConstructor(Realm&);
 
@@ -46,6 +46,10 @@ public:
     void reject(Value reason);
     Value perform_then(Value on_fulfilled, Value on_rejected, GC::Ptr<PromiseCapability> result_capability);
 
+    // Performs steps 9-12 of PerformPromiseThen with reactions that were created ahead of time. As reactions are never
+    // modified, callers that repeatedly wait for promises with the same handlers may create them once and reuse them.
+    void perform_then(GC::Ref<PromiseReaction> fulfill_reaction, GC::Ref<PromiseReaction> reject_reaction);
+
     bool is_handled() const { return m_is_handled; }
     void set_is_handled() { m_is_handled = true; }
 
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibCore/System.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+NonnullOwnPtr<SamplingProfiler> SamplingProfiler::create(VM& vm, u32 interval_in_milliseconds)
+{
+    return adopt_own(*new SamplingProfiler(vm, interval_in_milliseconds));
+}
+
+SamplingProfiler::SamplingProfiler(VM& vm, u32 interval_in_milliseconds)
+    : m_vm(vm)
+    , m_interval_in_milliseconds(max(interval_in_milliseconds, 1u))
+{
+    m_stack_nodes.append({});
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start()
+{
+    if (is_running())
+        return;
+
+    m_should_stop.store(false);
+    m_sampler_thread = Threading::Thread::construct([this] {
+        while (!m_should_stop.load(AK::MemoryOrder::memory_order_relaxed)) {
+            (void)Core::System::sleep_ms(m_interval_in_milliseconds);
+            m_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed);
+        }
+        return 0;
+    },
+        "JS Sampler"sv);
+    m_sampler_thread->start();
+
+    m_vm.bytecode_interpreter().set_sampling_profiler({}, this);
+}
+
+void SamplingProfiler::stop()
+{
+    if (!is_running())
+        return;
+
+    m_vm.bytecode_interpreter().set_sampling_profiler({}, nullptr);
+
+    m_should_stop.store(true);
+    (void)m_sampler_thread->join();
+    m_sampler_thread = nullptr;
+    m_sample_requested.store(false);
+}
+
+u32 SamplingProfiler::frame_index_for(ExecutionContext const& context)
+{
+    auto add_frame = [&](Frame frame) {
+        m_frames.append(move(frame));
+        return static_cast<u32>(m_frames.size() - 1);
+    };
+
+    if (auto* function = as_if<ECMAScriptFunctionObject>(context.function.ptr())) {
+        auto const& code = function->ecmascript_code();
+        return m_function_frame_indices.ensure(&code, [&] {
+            auto source_range = code.source_range();
+            auto name = function->name().is_empty() ? "(anonymous)"_string : function->name().view().to_utf8_but_should_be_ported_to_utf16();
+            return add_frame({ .name = move(name), .filename = source_range.code->filename(), .line = source_range.start.line, .column = source_range.start.column, .function_code = code });
+        });
+    }
+
+    if (context.executable) {
+        auto const& source_code = *context.executable->source_code;
+        return m_script_frame_indices.ensure(&source_code, [&] {
+            return add_frame({ .name = "(top-level)"_string, .filename = source_code.filename(), .script_code = source_code });
+        });
+    }
+
+    auto name = context.function_name ? context.function_name->utf8_string() : "(native)"_string;
+    return m_native_frame_indices.ensure(name, [&] {
+        return add_frame({ .name = name });
+    });
+}
+
+void SamplingProfiler::take_sample()
+{
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    u32 node_index = 0;
+    for (auto const* context : m_vm.execution_context_stack()) {
+        // Contexts without a function or an executable are only pushed by the host to run its own steps.
+        if (!context->function && !context->executable)
+            continue;
+
+        auto frame_index = frame_index_for(*context);
+        if (auto child_index = m_stack_nodes[node_index].children_by_frame_index.get(frame_index); child_index.has_value()) {
+            node_index = *child_index;
+            continue;
+        }
+
+        auto child_index = static_cast<u32>(m_stack_nodes.size());
+        m_stack_nodes[node_index].children_by_frame_index.set(frame_index, child_index);
+        m_stack_nodes.append({ .frame_index = frame_index });
+        node_index = child_index;
+    }
+
+    ++m_stack_nodes[node_index].self_sample_count;
+    ++m_sample_count;
+}
+
+void SamplingProfiler::write_folded_stacks(StringBuilder& builder) const
+{
+    StringBuilder stack;
+    write_folded_stacks(builder, stack, 0);
+}
+
+// Semicolons separate the frames of a stack, and the number of samples follows the last space of the line.
+static ByteString escape_for_folded_stacks(String const& text)
+{
+    return text.bytes_as_string_view().replace(";"sv, ":"sv, ReplaceMode::All).replace(" "sv, "_"sv, ReplaceMode::All);
+}
+
+void SamplingProfiler::write_folded_stacks(StringBuilder& builder, StringBuilder& stack, u32 node_index) const
+{
+    auto const& node = m_stack_nodes[node_index];
+    auto stack_length = stack.length();
+
+    if (node.frame_index.has_value()) {
+        auto const& frame = m_frames[*node.frame_index];
+        if (stack_length != 0)
+            stack.append(';');
+
+        stack.append(escape_for_folded_stacks(frame.name));
+        if (!frame.filename.is_empty())
+            stack.appendff("_[{}:{}:{}]", escape_for_folded_stacks(frame.filename), frame.line, frame.column);
+    }
+
+    if (node.self_sample_count > 0 && node.frame_index.has_value())
+        builder.appendff("{} {}\n", stack.string_view(), node.self_sample_count);
+
+    for (auto child_index : node.children_by_frame_index)
+        write_folded_stacks(builder, stack, child_index.value);
+
+    stack.trim(stack.length() - stack_length);
+}
+
+}
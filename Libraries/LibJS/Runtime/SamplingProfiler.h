@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibThreading/Forward.h>
+
+namespace JS {
+
+// A sampling profiler for the JavaScript running on a VM.
+//
+// A sampler thread requests a sample once every interval. The interpreter takes the sample the next time it enters a
+// function or jumps back to the start of a loop, by walking the execution context stack. Sampling at those points
+// keeps the stack consistent without stopping the thread, but time spent in a long-running native function is
+// attributed to it once it returns to JavaScript.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static NonnullOwnPtr<SamplingProfiler> create(VM&, u32 interval_in_milliseconds = 1);
+    ~SamplingProfiler();
+
+    void start();
+    void stop();
+    bool is_running() const { return m_sampler_thread; }
+
+    u32 interval_in_milliseconds() const { return m_interval_in_milliseconds; }
+    size_t sample_count() const { return m_sample_count; }
+
+    // Writes one line for every distinct stack that was sampled, in the "folded stacks" format read by flame graph
+    // tools: the frames from the outermost to the innermost separated by semicolons, then the number of samples.
+    void write_folded_stacks(StringBuilder&) const;
+
+    bool is_sample_requested() const { return m_sample_requested.load(AK::MemoryOrder::memory_order_relaxed); }
+    void take_sample();
+
+private:
+    struct Frame {
+        String name;
+        String filename;
+        size_t line { 0 };
+        size_t column { 0 };
+
+        // Keeps the key of the frame alive, so that its address can't be reused by another function.
+        RefPtr<ASTNode const> function_code;
+        RefPtr<SourceCode const> script_code;
+    };
+
+    // The samples are stored as a tree of call stacks, rooted at an empty stack.
+    struct StackNode {
+        Optional<u32> frame_index;
+        size_t self_sample_count { 0 };
+        HashMap<u32, u32> children_by_frame_index;
+    };
+
+    SamplingProfiler(VM&, u32 interval_in_milliseconds);
+
+    u32 frame_index_for(ExecutionContext const&);
+    void write_folded_stacks(StringBuilder&, StringBuilder& stack, u32 node_index) const;
+
+    VM& m_vm;
+    u32 m_interval_in_milliseconds { 1 };
+
+    RefPtr<Threading::Thread> m_sampler_thread;
+    Atomic<bool> m_sample_requested { false };
+    Atomic<bool> m_should_stop { false };
+
+    Vector<Frame> m_frames;
+    HashMap<ASTNode const*, u32> m_function_frame_indices;
+    HashMap<SourceCode const*, u32> m_script_frame_indices;
+    HashMap<String, u32> m_native_frame_indices;
+
+    Vector<StackNode> m_stack_nodes;
+    size_t m_sample_count { 0 };
+};
+
+}
@@ -53,6 +53,11 @@ GC::Ptr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const
 {
     if (m_is_prototype_shape)
         return nullptr;
+    if (m_single_forward_transition) {
+        auto& shape = *m_single_forward_transition;
+        if (*shape.m_property_key == key.property_key && shape.m_attributes == key.attributes)
+            return &shape;
+    }
     if (!m_forward_transitions)
         return nullptr;
     auto it = m_forward_transitions->find(key);
@@ -66,6 +71,23 @@ GC::Ptr<Shape> Shape::get_or_prune_cached_forward_transition(TransitionKey const
     return it->value.ptr();
 }
 
+void Shape::cache_forward_transition(TransitionKey const& key, GC::Ref<Shape> new_shape)
+{
+    if (!m_single_forward_transition && !m_forward_transitions) {
+        m_single_forward_transition = new_shape.ptr();
+        return;
+    }
+    if (!m_forward_transitions) {
+        m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
+        if (m_single_forward_transition) {
+            auto& shape = *m_single_forward_transition;
+            m_forward_transitions->set({ *shape.m_property_key, shape.m_attributes }, m_single_forward_transition);
+        }
+        m_single_forward_transition = nullptr;
+    }
+    m_forward_transitions->set(key, new_shape.ptr());
+}
+
 GC::Ptr<Shape> Shape::get_or_prune_cached_delete_transition(PropertyKey const& key)
 {
     if (m_is_prototype_shape)
@@ -107,11 +129,8 @@ GC::Ref<Shape> Shape::create_put_transition(PropertyKey const& property_key, Pro
         return *existing_shape;
     auto new_shape = heap().allocate<Shape>(*this, property_key, attributes, TransitionType::Put);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        cache_forward_transition(key, new_shape);
     return new_shape;
 }
 
@@ -122,11 +141,8 @@ GC::Ref<Shape> Shape::create_configure_transition(PropertyKey const& property_ke
         return *existing_shape;
     auto new_shape = heap().allocate<Shape>(*this, property_key, attributes, TransitionType::Configure);
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
-    if (!m_is_prototype_shape) {
-        if (!m_forward_transitions)
-            m_forward_transitions = make<HashMap<TransitionKey, WeakPtr<Shape>>>();
-        m_forward_transitions->set(key, new_shape.ptr());
-    }
+    if (!m_is_prototype_shape)
+        cache_forward_transition(key, new_shape);
     return new_shape;
 }
 
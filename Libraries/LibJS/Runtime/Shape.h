@@ -118,6 +118,7 @@ private:
     virtual void visit_edges(Visitor&) override;
 
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_forward_transition(TransitionKey const&);
+    void cache_forward_transition(TransitionKey const&, GC::Ref<Shape>);
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_prototype_transition(Object* prototype);
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_delete_transition(PropertyKey const&);
 
@@ -127,6 +128,10 @@ private:
 
     mutable OwnPtr<OrderedHashMap<PropertyKey, PropertyMetadata>> m_property_table;
 
+    // NOTE: Most shapes only ever transition to a single other shape, so we keep the first forward transition inline.
+    //       Its key doesn't need to be stored, since it's the property key and attributes of the target shape.
+    //       The hash map is only allocated once a shape has more than one forward transition.
+    WeakPtr<Shape> m_single_forward_transition;
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GC::Ptr<Object>, WeakPtr<Shape>>> m_prototype_transitions;
     OwnPtr<HashMap<PropertyKey, WeakPtr<Shape>>> m_delete_transitions;
@@ -48,21 +48,6 @@ static ThrowCompletionOr<GC::Ref<PrimitiveString>> primitive_string_from(VM& vm)
     return TRY(this_value.to_primitive_string(vm));
 }
 
-// 22.1.3.21.1 SplitMatch ( S, q, R ), https://tc39.es/ecma262/#sec-splitmatch
-// FIXME: This no longer exists in the spec!
-static Optional<size_t> split_match(Utf16View const& haystack, size_t start, Utf16View const& needle)
-{
-    auto r = needle.length_in_code_units();
-    auto s = haystack.length_in_code_units();
-    if (start + r > s)
-        return {};
-    for (size_t i = 0; i < r; ++i) {
-        if (haystack.code_unit_at(start + i) != needle.code_unit_at(i))
-            return {};
-    }
-    return start + r;
-}
-
 // 6.1.4.1 StringIndexOf ( string, searchValue, fromIndex ), https://tc39.es/ecma262/#sec-stringindexof
 Optional<size_t> string_index_of(Utf16View const& string, Utf16View const& search_value, size_t from_index)
 {
@@ -81,17 +66,12 @@ Optional<size_t> string_index_of(Utf16View const& string, Utf16View const& searc
         return {};
 
     // 4. For each integer i such that fromIndex ≤ i ≤ len - searchLen, in ascending order, do
-    for (size_t i = from_index; i <= string_length - search_length; ++i) {
-        // a. Let candidate be the substring of string from i to i + searchLen.
-        auto candidate = string.substring_view(i, search_length);
-
-        // b. If candidate is searchValue, return i.
-        if (candidate == search_value)
-            return i;
-    }
-
+    //     a. Let candidate be the substring of string from i to i + searchLen.
+    //     b. If candidate is searchValue, return i.
     // 5. Return -1.
-    return {};
+    // OPTIMIZATION: Utf16View only compares the candidates that start with the first code unit of searchValue, which
+    //               it finds with a vectorized search.
+    return string.find_code_unit_offset(search_value, from_index);
 }
 
 // 7.2.9 Static Semantics: IsStringWellFormedUnicode ( string )
@@ -156,7 +136,7 @@ void StringPrototype::initialize(Realm& realm)
     // 22.1.3 Properties of the String Prototype Object, https://tc39.es/ecma262/#sec-properties-of-the-string-prototype-object
     define_native_function(realm, vm.names.at, at, 1, attr);
     define_native_function(realm, vm.names.charAt, char_at, 1, attr);
-    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr);
+    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr, Bytecode::Builtin::StringPrototypeCharCodeAt);
     define_native_function(realm, vm.names.codePointAt, code_point_at, 1, attr);
     define_native_function(realm, vm.names.concat, concat, 1, attr);
     define_native_function(realm, vm.names.endsWith, ends_with, 1, attr);
@@ -282,13 +262,18 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_at)
 
 // 22.1.3.3 String.prototype.charCodeAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.charcodeat
 JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
+{
+    return char_code_at_impl(vm, vm.this_value(), vm.argument(0));
+}
+
+ThrowCompletionOr<Value> StringPrototype::char_code_at_impl(VM& vm, Value this_value, Value position_value)
 {
     // 1. Let O be ? RequireObjectCoercible(this value).
     // 2. Let S be ? ToString(O).
-    auto string = TRY(primitive_string_from(vm));
+    auto string = TRY(TRY(require_object_coercible(vm, this_value)).to_primitive_string(vm));
 
     // 3. Let position be ? ToIntegerOrInfinity(pos).
-    auto position = TRY(vm.argument(0).to_integer_or_infinity(vm));
+    auto position = TRY(position_value.to_integer_or_infinity(vm));
 
     // 4. Let size be the length of S.
     // 5. If position < 0 or position ≥ size, return NaN.
@@ -502,30 +487,31 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::last_index_of)
     // 8. Let searchLen be the length of searchStr.
     auto search_length = search_string->length_in_utf16_code_units();
 
+    // OPTIMIZATION: If the needle is longer than the haystack, don't bother searching :^)
+    if (search_length > string_length)
+        return Value(-1);
+
     // 9. Let start be the result of clamping pos between 0 and len - searchLen.
-    size_t start = clamp(pos, static_cast<double>(0), static_cast<double>(string_length));
-    Optional<size_t> last_index;
+    size_t start = clamp(pos, static_cast<double>(0), static_cast<double>(string_length - search_length));
 
     // 10. If searchStr is the empty String, return 𝔽(start).
-    // 11. For each integer i such that 0 ≤ i ≤ start, in descending order, do
-    for (size_t k = 0; (k <= start) && (k + search_length <= string_length); ++k) {
-        bool is_match = true;
+    if (search_length == 0)
+        return Value(start);
 
-        // a. Let candidate be the substring of S from i to i + searchLen.
-        for (size_t j = 0; j < search_length; ++j) {
-            if (string->utf16_string_view().code_unit_at(k + j) != search_string->utf16_string_view().code_unit_at(j)) {
-                is_match = false;
-                break;
-            }
-        }
+    auto string_view = string->utf16_string_view();
+    auto search_view = search_string->utf16_string_view();
+    auto first_code_unit = search_view.code_unit_at(0);
 
+    // 11. For each integer i such that 0 ≤ i ≤ start, in descending order, do
+    for (size_t i = start + 1; i-- > 0;) {
+        // a. Let candidate be the substring of S from i to i + searchLen.
         // b. If candidate is searchStr, return 𝔽(i).
-        if (is_match)
-            last_index = k;
+        if (string_view.code_unit_at(i) == first_code_unit && string_view.substring_view(i, search_length) == search_view)
+            return Value(i);
     }
 
     // 12. Return -1𝔽.
-    return last_index.has_value() ? Value(*last_index) : Value(-1);
+    return Value(-1);
 }
 
 // 22.1.3.12 String.prototype.localeCompare ( that [ , reserved1 [ , reserved2 ] ] ), https://tc39.es/ecma262/#sec-string.prototype.localecompare
@@ -1072,10 +1058,6 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
     // 3. Let S be ? ToString(O).
     auto string = TRY(object.to_primitive_string(vm));
 
-    // 11. Let substrings be a new empty List.
-    auto array = MUST(Array::create(realm, 0));
-    size_t array_length = 0;
-
     // 4. If limit is undefined, let lim be 232 - 1; else let lim be ℝ(? ToUint32(limit)).
     auto limit = NumericLimits<u32>::max();
     if (!limit_argument.is_undefined())
@@ -1087,67 +1069,78 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::split)
     // 6. If lim = 0, then
     if (limit == 0) {
         // a. Return CreateArrayFromList(« »).
-        return array;
+        return Array::create_from(realm, ReadonlySpan<Value> {});
     }
 
-    auto string_length = string->length_in_utf16_code_units();
-
     // 7. If separator is undefined, then
     if (separator_argument.is_undefined()) {
         // a. Return CreateArrayFromList(« S »).
-        MUST(array->create_data_property_or_throw(0, string));
-        return array;
+        return Array::create_from(realm, { Value(string) });
     }
 
+    auto string_view = string->utf16_string_view();
+    auto separator_view = separator->utf16_string_view();
+
     // 8. Let separatorLength be the length of R.
-    auto separator_length = separator->length_in_utf16_code_units();
+    auto separator_length = separator_view.length_in_code_units();
+
+    // 9. If separatorLength = 0, then
+    if (separator_length == 0) {
+        // a. Let strLen be the length of S.
+        // b. Let outLen be the result of clamping lim between 0 and strLen.
+        auto out_length = min<size_t>(limit, string_view.length_in_code_units());
+
+        // c. Let head be the substring of S from 0 to outLen.
+        // d. Let codeUnits be a List consisting of the sequence of code units that are the elements of head.
+        GC::RootVector<Value> code_units { vm.heap() };
+        code_units.ensure_capacity(out_length);
+        for (size_t i = 0; i < out_length; ++i)
+            code_units.unchecked_append(PrimitiveString::create(vm, string_view.substring_view(i, 1)));
+
+        // e. Return CreateArrayFromList(codeUnits).
+        return Array::create_from(realm, code_units);
+    }
 
     // 10. If S is the empty String, return CreateArrayFromList(« S »).
-    if (string_length == 0) {
-        if (separator_length > 0)
-            MUST(array->create_data_property_or_throw(0, string));
-        return array;
-    }
+    if (string_view.is_empty())
+        return Array::create_from(realm, { Value(string) });
+
+    // 11. Let substrings be a new empty List.
+    GC::RootVector<Value> substrings { vm.heap() };
 
     // 12. Let i be 0.
     size_t start = 0;
 
     // 13. Let j be StringIndexOf(S, R, 0).
-    auto position = start;
+    auto position = string_index_of(string_view, separator_view, 0);
 
     // 14. Repeat, while j ≠ -1,
-    while (position != string_length) {
+    while (position.has_value()) {
         // a. Let T be the substring of S from i to j.
-        auto match = split_match(string->utf16_string_view(), position, separator->utf16_string_view());
-        if (!match.has_value() || match.value() == start) {
-            ++position;
-            continue;
-        }
-        auto segment = string->utf16_string_view().substring_view(start, position - start);
+        auto segment = string_view.substring_view(start, *position - start);
 
         // b. Append T to substrings.
-        MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, segment)));
-        ++array_length;
+        substrings.append(PrimitiveString::create(vm, segment));
 
         // c. If the number of elements in substrings is lim, return CreateArrayFromList(substrings).
-        if (array_length == limit)
-            return array;
+        if (substrings.size() == limit)
+            return Array::create_from(realm, substrings);
 
         // d. Set i to j + separatorLength.
-        start = match.value();
+        start = *position + separator_length;
 
         // e. Set j to StringIndexOf(S, R, i).
-        position = start;
+        position = string_index_of(string_view, separator_view, start);
     }
 
     // 15. Let T be the substring of S from i.
-    auto rest = string->utf16_string_view().substring_view(start);
+    auto rest = string_view.substring_view(start);
 
     // 16. Append T to substrings.
-    MUST(array->create_data_property_or_throw(array_length, PrimitiveString::create(vm, rest)));
+    substrings.append(PrimitiveString::create(vm, rest));
 
     // 17. Return CreateArrayFromList(substrings).
-    return array;
+    return Array::create_from(realm, substrings);
 }
 
 // 22.1.3.24 String.prototype.startsWith ( searchString [ , position ] ), https://tc39.es/ecma262/#sec-string.prototype.startswith
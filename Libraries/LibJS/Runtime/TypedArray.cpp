@@ -446,7 +446,7 @@ void TypedArrayBase::visit_edges(Visitor& visitor)
 }
 
 #define JS_DEFINE_TYPED_ARRAY(ClassName, snake_name, PrototypeName, ConstructorName, Type)                                  \
-    GC_DEFINE_ALLOCATOR(ClassName);                                                                                         \
+    GC_DEFINE_STRICTLY_ISOLATED_ALLOCATOR(ClassName);                                                                       \
     GC_DEFINE_ALLOCATOR(PrototypeName);                                                                                     \
     GC_DEFINE_ALLOCATOR(ConstructorName);                                                                                   \
                                                                                                                             \
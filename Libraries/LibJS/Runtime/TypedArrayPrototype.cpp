@@ -6,6 +6,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/QuickSort.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -488,32 +490,17 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::every)
     return true;
 }
 
-// NOTE: This function assumes that the index is valid within the TypedArray,
-//       and that the TypedArray is not detached.
-template<typename T>
-inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 end, T value)
+// Copies the bytes of the first element to all of the other elements.
+static void fill_with_first_element(Bytes elements, size_t element_size)
 {
-    Checked<size_t> computed_begin = begin;
-    computed_begin *= sizeof(T);
-    computed_begin += typed_array.byte_offset();
-
-    Checked<size_t> computed_end = end;
-    computed_end *= sizeof(T);
-    computed_end += typed_array.byte_offset();
-
-    if (computed_begin.has_overflow() || computed_end.has_overflow()) [[unlikely]] {
-        return;
-    }
-
-    if (computed_begin.value() >= typed_array.viewed_array_buffer()->byte_length()
-        || computed_end.value() > typed_array.viewed_array_buffer()->byte_length()) [[unlikely]] {
+    if (element_size == 1) {
+        memset(elements.data() + 1, elements[0], elements.size() - 1);
         return;
     }
 
-    auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(computed_begin.value()));
-    for (auto i = begin; i < end; ++i)
-        *(slot++) = value;
+    // Double the number of filled elements until all of them are filled.
+    for (size_t filled = element_size; filled < elements.size(); filled *= 2)
+        memcpy(elements.data() + filled, elements.data(), min(filled, elements.size() - filled));
 }
 
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
@@ -584,33 +571,23 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
-    if (value.is_int32()) {
+    // OPTIMIZATION: Rather than converting the value for every element, only set the first element and copy its bytes to
+    //               the others. The elements are within the bounds of the buffer, as the TypedArray is not out of bounds.
+    if (k < final && !typed_array->viewed_array_buffer()->is_shared_array_buffer()) {
+        CanonicalIndex canonical_index { CanonicalIndex::Type::Index, k };
         switch (typed_array->kind()) {
-        case TypedArrayBase::Kind::Uint8Array:
-            fast_typed_array_fill<u8>(*typed_array, k, final, static_cast<u8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint16Array:
-            fast_typed_array_fill<u16>(*typed_array, k, final, static_cast<u16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint32Array:
-            fast_typed_array_fill<u32>(*typed_array, k, final, static_cast<u32>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int8Array:
-            fast_typed_array_fill<i8>(*typed_array, k, final, static_cast<i8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int16Array:
-            fast_typed_array_fill<i16>(*typed_array, k, final, static_cast<i16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int32Array:
-            fast_typed_array_fill<i32>(*typed_array, k, final, value.as_i32());
-            return typed_array;
-        case TypedArrayBase::Kind::Uint8ClampedArray:
-            fast_typed_array_fill<u8>(*typed_array, k, final, clamp(value.as_i32(), 0, 255));
-            return typed_array;
-        default:
-            // FIXME: Support more TypedArray kinds.
-            break;
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        MUST(typed_array_set_element<Type>(*typed_array, canonical_index, value));   \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
         }
+
+        auto element_size = typed_array->element_size();
+        auto elements = typed_array->viewed_array_buffer()->buffer().bytes().slice(typed_array->byte_offset() + k * element_size, (final - k) * element_size);
+        fill_with_first_element(elements, element_size);
+        return typed_array;
     }
 
     // 18. Repeat, while k < final,
@@ -884,6 +861,80 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::for_each)
     return js_undefined();
 }
 
+enum class MatchNaN {
+    No,
+    Yes,
+};
+
+template<typename T>
+static Optional<u32> find_number_in_typed_array_elements(ReadonlySpan<T> elements, u32 k, Direction direction, double search_element, MatchNaN match_nan)
+{
+    if (elements.is_empty())
+        return {};
+
+    if (direction == Direction::Ascending && k >= elements.size())
+        return {};
+    if (direction == Direction::Descending)
+        k = min<u32>(k, elements.size() - 1);
+
+    auto find = [&](auto matches) -> Optional<u32> {
+        if (direction == Direction::Ascending) {
+            for (u32 i = k; i < elements.size(); ++i) {
+                if (matches(elements[i]))
+                    return i;
+            }
+        } else {
+            for (u32 i = k + 1; i-- > 0;) {
+                if (matches(elements[i]))
+                    return i;
+            }
+        }
+        return {};
+    };
+
+    if constexpr (IsIntegral<T> && sizeof(T) == 8) {
+        // NOTE: BigInt elements are never equal to a Number.
+        VERIFY_NOT_REACHED();
+    } else if constexpr (IsIntegral<T>) {
+        // An integral element can only be equal to an integral Number within the range of its type.
+        if (!(search_element >= static_cast<double>(NumericLimits<T>::min()) && search_element <= static_cast<double>(NumericLimits<T>::max())))
+            return {};
+
+        auto value = static_cast<T>(search_element);
+        if (static_cast<double>(value) != search_element)
+            return {};
+
+        return find([value](T element) { return element == value; });
+    } else {
+        if (isnan(search_element)) {
+            if (match_nan == MatchNaN::No)
+                return {};
+            return find([](T element) { return isnan(static_cast<double>(element)); });
+        }
+
+        return find([search_element](T element) { return static_cast<double>(element) == search_element; });
+    }
+}
+
+// OPTIMIZATION: Searching for a Number in a TypedArray with Number elements can compare the raw elements with the Number,
+//               rather than converting every element to a Value. Elements that have gone out of bounds since the length
+//               of the TypedArray was determined are undefined, so they can't be equal to a Number and are skipped.
+static Optional<u32> find_number_in_typed_array(TypedArrayBase const& typed_array, u32 k, Direction direction, double search_element, MatchNaN match_nan)
+{
+    VERIFY(typed_array.content_type() == TypedArrayBase::ContentType::Number);
+
+    switch (typed_array.kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type)                                  \
+    case TypedArrayBase::Kind::ClassName:                                                                            \
+        return find_number_in_typed_array_elements(static_cast<ClassName const&>(typed_array).data(), k, direction, \
+            search_element, match_nan);
+        JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
 // 23.2.3.16 %TypedArray%.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
 {
@@ -936,6 +987,11 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
         k = relative_k;
     }
 
+    if (search_element.is_number() && typed_array->content_type() == TypedArrayBase::ContentType::Number) {
+        auto index = find_number_in_typed_array(*typed_array, k, Direction::Ascending, search_element.as_double(), MatchNaN::Yes);
+        return Value { index.has_value() && *index < length };
+    }
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -1005,6 +1061,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    if (search_element.is_number() && typed_array->content_type() == TypedArrayBase::ContentType::Number) {
+        auto index = find_number_in_typed_array(*typed_array, k, Direction::Ascending, search_element.as_double(), MatchNaN::No);
+        if (index.has_value() && *index < length)
+            return Value { *index };
+        return Value { -1 };
+    }
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1142,6 +1205,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::last_index_of)
         k = relative_k;
     }
 
+    if (search_element.is_number() && typed_array->content_type() == TypedArrayBase::ContentType::Number) {
+        if (k < 0)
+            return Value { -1 };
+        auto index = find_number_in_typed_array(*typed_array, k, Direction::Descending, search_element.as_double(), MatchNaN::No);
+        return index.has_value() ? Value { *index } : Value { -1 };
+    }
+
     // 9. Repeat, while k ≥ 0,
     while (k >= 0) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1369,6 +1439,23 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reverse)
     // 3. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Swapping the raw elements is equivalent to getting and setting them as Values, since the elements are
+    //               converted to the same type they were converted from.
+    if (!typed_array->viewed_array_buffer()->is_shared_array_buffer()) {
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName: {                                         \
+        auto elements = static_cast<ClassName&>(*typed_array).data();              \
+        for (size_t lower = 0, upper = elements.size(); lower + 1 < upper;)         \
+            swap(elements[lower++], elements[--upper]);                            \
+        break;                                                                      \
+    }
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+        return typed_array;
+    }
+
     // 4. Let middle be floor(len / 2).
     auto middle = length / 2;
 
@@ -1472,6 +1559,20 @@ static ThrowCompletionOr<void> set_typed_array_from_typed_array(VM& vm, TypedArr
 
     size_t source_byte_index = 0;
 
+    // OPTIMIZATION: If the elements are copied within the same non-shared buffer without conversion, moving them is
+    //               equivalent to copying them from a clone of the source elements.
+    if (source_buffer == target_buffer && !source_buffer->is_shared_array_buffer() && source.element_name() == target.element_name()) {
+        Checked<size_t> target_byte_index = static_cast<size_t>(target_offset);
+        target_byte_index *= target_element_size;
+        target_byte_index += target_byte_offset;
+        if (target_byte_index.has_overflow())
+            return vm.throw_completion<RangeError>(ErrorType::TypedArrayOverflow, "target byte index");
+
+        auto& buffer = target_buffer->buffer();
+        memmove(buffer.data() + target_byte_index.value(), buffer.data() + source_byte_offset, typed_array_byte_length(source_record));
+        return {};
+    }
+
     // 19. If SameValue(srcBuffer, targetBuffer) is true or sameSharedArrayBuffer is true, then
     if (same_shared_array_buffer || same_value(source_buffer, target_buffer)) {
         // a. Let srcByteLength be TypedArrayByteLength(srcRecord).
@@ -1749,6 +1850,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::slice)
                 return array;
             }
 
+            // OPTIMIZATION: Copy the bytes at once if the buffers are distinct and not shared. The range of the source
+            //               is within its buffer, as O is not out of bounds, and A has at least count elements.
+            if (&source_buffer != &target_buffer && !source_buffer.is_shared_array_buffer() && !target_buffer.is_shared_array_buffer()) {
+                memcpy(target_buffer.buffer().data() + target_byte_index, source_buffer.buffer().data() + source_byte_index.value(), limit.value() - target_byte_index);
+                return array;
+            }
+
             // ix. Repeat, while targetByteIndex < limit,
             while (target_byte_index < limit) {
                 // 1. Let value be GetValueFromBuffer(srcBuffer, srcByteIndex, uint8, true, unordered).
@@ -1833,6 +1941,43 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::some)
     return false;
 }
 
+// Sorts the elements in the order of CompareTypedArrayElements without a comparator. Elements which compare as equal are
+// indistinguishable, so the sort does not need to be stable.
+template<typename T>
+static void sort_typed_array_elements(Span<T> elements)
+{
+    if constexpr (sizeof(T) == 1) {
+        // A counting sort, as there are only 256 possible values.
+        constexpr u8 sign_bit = IsSigned<T> ? 0x80 : 0;
+
+        AK::Array<size_t, 256> counts {};
+        for (auto element : elements)
+            ++counts[bit_cast<u8>(element) ^ sign_bit];
+
+        size_t index = 0;
+        for (size_t key = 0; key < counts.size(); ++key) {
+            auto value = bit_cast<T>(static_cast<u8>(key ^ sign_bit));
+            for (size_t i = 0; i < counts[key]; ++i)
+                elements[index++] = value;
+        }
+    } else if constexpr (IsIntegral<T>) {
+        quick_sort(elements);
+    } else {
+        // NaNs are sorted last, and -0 before +0.
+        quick_sort(elements, [](T a, T b) {
+            auto x = static_cast<double>(a);
+            auto y = static_cast<double>(b);
+            if (isnan(x))
+                return false;
+            if (isnan(y))
+                return true;
+            if (x != y)
+                return x < y;
+            return signbit(x) && !signbit(y);
+        });
+    }
+}
+
 // 23.2.3.29 %TypedArray%.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
 {
@@ -1851,11 +1996,30 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Without a comparator, sort the elements in place rather than as a list of Values.
+    if (compare_function.is_undefined()) {
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        sort_typed_array_elements(static_cast<ClassName&>(*typed_array).data());    \
+        break;
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+        return typed_array;
+    }
+
+    auto subtraction_comparator = as_subtraction_comparator(compare_function.as_function());
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
+        // OPTIMIZATION: Comparators like `(a, b) => a - b` do not need to be called to compare two Numbers.
+        if (subtraction_comparator.has_value() && x.is_number())
+            return compare_with_subtraction_comparator(*subtraction_comparator, x, y);
+
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
-        return TRY(compare_typed_array_elements(vm, x, y, compare_function.is_undefined() ? nullptr : &compare_function.as_function()));
+        return TRY(compare_typed_array_elements(vm, x, y, &compare_function.as_function()));
     };
 
     // 7. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
@@ -2089,10 +2253,32 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // OPTIMIZATION: Without a comparator, copy the elements and sort them in place rather than as a list of Values.
+    if (compare_function.is_undefined()) {
+        switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName: {                                         \
+        auto elements = static_cast<ClassName&>(*array).data();                     \
+        static_cast<ClassName&>(*typed_array).data().copy_to(elements);             \
+        sort_typed_array_elements(elements);                                        \
+        break;                                                                      \
+    }
+            JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+        }
+        return array;
+    }
+
+    auto subtraction_comparator = as_subtraction_comparator(compare_function.as_function());
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
+        // OPTIMIZATION: Comparators like `(a, b) => a - b` do not need to be called to compare two Numbers.
+        if (subtraction_comparator.has_value() && x.is_number())
+            return compare_with_subtraction_comparator(*subtraction_comparator, x, y);
+
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
-        return TRY(compare_typed_array_elements(vm, x, y, compare_function.is_undefined() ? nullptr : &compare_function.as_function()));
+        return TRY(compare_typed_array_elements(vm, x, y, &compare_function.as_function()));
     };
 
     // 8. Let sortedList be ? SortIndexedProperties(O, len, SortCompare, read-through-holes).
@@ -779,4 +779,45 @@ Vector<StackTraceElement> VM::stack_trace() const
     return stack_trace;
 }
 
+static constexpr size_t script_cache_minimum_source_length = 4 * KiB;
+static constexpr size_t script_cache_maximum_size_in_bytes = 16 * MiB;
+
+RefPtr<Program> VM::find_cached_script(StringView source_text, StringView filename, size_t line_number_offset)
+{
+    if (source_text.length() < script_cache_minimum_source_length)
+        return {};
+
+    for (size_t i = 0; i < m_script_cache.size(); ++i) {
+        auto& entry = m_script_cache[i];
+        if (entry.line_number_offset != line_number_offset || entry.filename != filename || entry.source_text != source_text)
+            continue;
+
+        auto cached_script = m_script_cache.take(i);
+        auto parse_node = cached_script.parse_node;
+        m_script_cache.append(move(cached_script));
+        return parse_node;
+    }
+
+    return {};
+}
+
+void VM::cache_script(StringView source_text, StringView filename, size_t line_number_offset, NonnullRefPtr<Program> parse_node)
+{
+    if (source_text.length() < script_cache_minimum_source_length || source_text.length() > script_cache_maximum_size_in_bytes)
+        return;
+
+    m_script_cache_size_in_bytes += source_text.length();
+    m_script_cache.append({
+        .source_text = source_text,
+        .filename = filename,
+        .line_number_offset = line_number_offset,
+        .parse_node = move(parse_node),
+    });
+
+    while (m_script_cache_size_in_bytes > script_cache_maximum_size_in_bytes) {
+        auto evicted_script = m_script_cache.take_first();
+        m_script_cache_size_in_bytes -= evicted_script.source_text.length();
+    }
+}
+
 }
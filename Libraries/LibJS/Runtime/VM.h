@@ -302,6 +302,9 @@ public:
 
     Vector<StackTraceElement> stack_trace() const;
 
+    RefPtr<Program> find_cached_script(StringView source_text, StringView filename, size_t line_number_offset);
+    void cache_script(StringView source_text, StringView filename, size_t line_number_offset, NonnullRefPtr<Program>);
+
 private:
     using ErrorMessages = AK::Array<Utf16String, to_underlying(ErrorMessage::__Count)>;
 
@@ -355,6 +358,17 @@ private:
 
     Vector<StoredModule> m_loaded_modules;
 
+    struct CachedScript {
+        ByteString source_text;
+        ByteString filename;
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> parse_node;
+    };
+
+    // NOTE: Ordered from least to most recently used.
+    Vector<CachedScript> m_script_cache;
+    size_t m_script_cache_size_in_bytes { 0 };
+
     WellKnownSymbols m_well_known_symbols;
 
     u32 m_execution_generation { 0 };
@@ -17,6 +17,14 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    auto& vm = realm.vm();
+
+    // OPTIMIZATION: Pages tend to evaluate the same large scripts over and over (e.g. when they are reloaded, or
+    //               loaded into multiple frames). Since parse trees (and the bytecode generated from them) don't
+    //               depend on the realm, we can skip parsing entirely if we've seen this exact source text before.
+    if (auto cached_parse_node = vm.find_cached_script(source_text, filename, line_number_offset))
+        return realm.heap().allocate<Script>(realm, filename, cached_parse_node.release_nonnull(), host_defined);
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -25,6 +33,8 @@ Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_tex
     if (parser.has_errors())
         return parser.errors();
 
+    vm.cache_script(source_text, filename, line_number_offset, script);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
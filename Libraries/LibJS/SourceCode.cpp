@@ -6,6 +6,7 @@
 
 #include <AK/BinarySearch.h>
 #include <AK/Utf8View.h>
+#include <LibJS/Runtime/PrimitiveString.h>
 #include <LibJS/SourceCode.h>
 #include <LibJS/SourceRange.h>
 #include <LibJS/Token.h>
@@ -23,6 +24,13 @@ SourceCode::SourceCode(String filename, Utf16String code)
 {
 }
 
+GC::Ref<PrimitiveString> SourceText::to_primitive_string(VM& vm) const
+{
+    if (m_source_code)
+        return PrimitiveString::create(vm, m_source_code->code().substring_view(m_start_offset, m_end_offset - m_start_offset));
+    return PrimitiveString::create(vm, m_text);
+}
+
 void SourceCode::fill_position_cache() const
 {
     constexpr size_t predicted_minimum_cached_positions = 8;
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/String.h>
 #include <AK/Utf16String.h>
 #include <AK/Vector.h>
+#include <LibGC/Ptr.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Position.h>
@@ -37,4 +39,32 @@ private:
     Vector<Position> mutable m_cached_positions;
 };
 
+// The [[SourceText]] of a function or class. Functions and classes that were parsed from source code refer to the range
+// of that source code they were parsed from, as nested functions would otherwise each hold a copy of the same text.
+class JS_API SourceText {
+public:
+    SourceText() = default;
+
+    SourceText(ByteString text)
+        : m_text(move(text))
+    {
+    }
+
+    SourceText(NonnullRefPtr<SourceCode const> source_code, u32 start_offset, u32 end_offset)
+        : m_source_code(move(source_code))
+        , m_start_offset(start_offset)
+        , m_end_offset(end_offset)
+    {
+    }
+
+    GC::Ref<PrimitiveString> to_primitive_string(VM&) const;
+
+private:
+    ByteString m_text;
+
+    RefPtr<SourceCode const> m_source_code;
+    u32 m_start_offset { 0 };
+    u32 m_end_offset { 0 };
+};
+
 }
@@ -0,0 +1,52 @@
+"use strict";
+
+test("functions declared in a block with only local bindings", () => {
+    const results = [];
+    for (let i = 0; i < 3; ++i) {
+        let doubled = i * 2;
+        function double(value) {
+            return value * 2;
+        }
+        results.push(double(i) === doubled);
+    }
+    expect(results).toEqual([true, true, true]);
+});
+
+test("functions declared in a block can still see the surrounding bindings", () => {
+    let outer = 1;
+    {
+        function getOuter() {
+            return outer;
+        }
+        outer = 2;
+        expect(getOuter()).toBe(2);
+    }
+});
+
+test("functions declared in a block can still capture its bindings", () => {
+    const functions = [];
+    for (let i = 0; i < 3; ++i) {
+        let captured = i;
+        function getCaptured() {
+            return captured;
+        }
+        functions.push(getCaptured);
+    }
+    expect(functions.map(f => f())).toEqual([0, 1, 2]);
+});
+
+test("functions declared in a switch case", () => {
+    function classify(value) {
+        switch (value) {
+            case 0:
+                function zero() {
+                    return "zero";
+                }
+                return zero();
+            default:
+                return "other";
+        }
+    }
+    expect(classify(0)).toBe("zero");
+    expect(classify(1)).toBe("other");
+});
@@ -17,6 +17,28 @@ test("basic functionality", () => {
     expect(array.includes("friends", 100)).toBeFalse();
 });
 
+test("arrays of numbers", () => {
+    var integers = [1, 2, 3, -4];
+    expect(integers.includes(3)).toBeTrue();
+    expect(integers.includes(3.0)).toBeTrue();
+    expect(integers.includes(3.5)).toBeFalse();
+    expect(integers.includes(-4)).toBeTrue();
+    expect(integers.includes("3")).toBeFalse();
+    expect(integers.includes(undefined)).toBeFalse();
+
+    var numbers = [1.5, NaN, 0];
+    expect(numbers.includes(NaN)).toBeTrue();
+    expect(numbers.includes(-0)).toBeTrue();
+    expect(numbers.includes(1.5, 1)).toBeFalse();
+
+    var holey = [1, , 3];
+    expect(holey.includes(undefined)).toBeTrue();
+    expect(holey.includes(null)).toBeFalse();
+
+    integers.push("5");
+    expect(integers.includes("5")).toBeTrue();
+});
+
 test("is unscopable", () => {
     expect(Array.prototype[Symbol.unscopables].includes).toBeTrue();
     const array = [];
@@ -18,6 +18,9 @@ describe("Array.prototype.sort", () => {
         arr = [205, -123, 22, 200, 3, -20, -2, -1, 25, 2, 0, 1];
         expect(arr.sort()).toEqual([-1, -123, -2, -20, 0, 1, 2, 200, 205, 22, 25, 3]);
 
+        arr = [2147483647, -2147483648, 10, 9, -9, 100, 9];
+        expect(arr.sort()).toEqual([-2147483648, -9, 10, 100, 2147483647, 9, 9]);
+
         // mix of data, including empty slots and undefined
         arr = ["2", Infinity, null, null, , undefined, 5, , undefined, null, 54, "5"];
         expect(arr.sort()).toEqual([
@@ -115,6 +118,41 @@ describe("Array.prototype.sort", () => {
         expect(arr[2].other_property == 2);
     });
 
+    test("that it is stable for long arrays with sorted runs", () => {
+        const length = 1000;
+        const keyOf = i => (i < length / 2 ? i % 50 : length - i) % 37;
+
+        arr = [];
+        for (let i = 0; i < length; ++i) arr.push({ key: keyOf(i), index: i });
+        arr.sort((a, b) => a.key - b.key);
+
+        for (let i = 1; i < length; ++i) {
+            expect(arr[i - 1].key <= arr[i].key).toBeTrue();
+            if (arr[i - 1].key === arr[i].key) expect(arr[i - 1].index < arr[i].index).toBeTrue();
+        }
+
+        arr = [];
+        for (let i = 0; i < length; ++i) arr.push(String(length - i).padStart(4, "0"));
+        arr.sort();
+        for (let i = 0; i < length; ++i) expect(arr[i]).toBe(String(i + 1).padStart(4, "0"));
+    });
+
+    test("that subtraction comparators behave like they are called", () => {
+        expect([3, 1, 2].sort((a, b) => b - a)).toEqual([3, 2, 1]);
+        expect([3, undefined, 1].sort((a, b) => a - b)).toEqual([1, 3, undefined]);
+        expect(["10", 9, "8"].sort((a, b) => a - b)).toEqual(["8", 9, "10"]);
+
+        let valueOfCalls = 0;
+        const object = {
+            valueOf() {
+                ++valueOfCalls;
+                return 2;
+            },
+        };
+        expect([3, object, 1].sort((a, b) => a - b)).toEqual([1, object, 3]);
+        expect(valueOfCalls).toBeGreaterThan(0);
+    });
+
     test("that it makes no unnecessary calls to compare function", () => {
         expectNoCallCompareFunction = function (a, b) {
             expect().fail();
@@ -74,3 +74,48 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("string escapes", () => {
+    expect(JSON.parse('"\\"\\\\\\/\\b\\f\\n\\r\\t"')).toBe('"\\/\b\f\n\r\t');
+    expect(JSON.parse('"\\u0041\\u00e9"')).toBe("Aé");
+    expect(JSON.parse('"\\uD834\\uDD1E"')).toBe("\u{1D11E}");
+    expect(JSON.parse('"\\uD800"')).toBe("\uD800");
+    expect(JSON.parse('"caf\u00e9 \\n ok"')).toBe("café \n ok");
+
+    ['"\\x41"', '"\\u12"', '"\\u12G4"', '"unterminated', '"tab\tinside"'].forEach(test => {
+        expect(() => {
+            JSON.parse(test);
+        }).toThrow(SyntaxError);
+    });
+});
+
+test("repeated keys across records", () => {
+    const records = JSON.parse('[{"id":1,"name":"a"},{"id":2,"name":"b"},{"name":"c","id":3}]');
+    expect(records).toEqual([
+        { id: 1, name: "a" },
+        { id: 2, name: "b" },
+        { name: "c", id: 3 },
+    ]);
+    expect(Object.keys(records[2])).toEqual(["name", "id"]);
+
+    const escapedKey = JSON.parse('{"\\u0069d":1,"id":2}');
+    expect(Object.keys(escapedKey)).toEqual(["id"]);
+    expect(escapedKey.id).toBe(2);
+
+    const numericKeys = JSON.parse('{"1":"b","0":"a"}');
+    expect(Object.keys(numericKeys)).toEqual(["0", "1"]);
+});
+
+test("numbers", () => {
+    expect(JSON.parse("-12")).toBe(-12);
+    expect(JSON.parse("1.5e3")).toBe(1500);
+    expect(JSON.parse("1E-2")).toBe(0.01);
+    expect(JSON.parse("-2147483648")).toBe(-2147483648);
+    expect(JSON.parse("1e400")).toBe(Infinity);
+
+    ["01", "1.", ".5", "-", "1e", "1e+", "+1", "0x10"].forEach(test => {
+        expect(() => {
+            JSON.parse(test);
+        }).toThrow(SyntaxError);
+    });
+});
@@ -71,6 +71,60 @@ describe("correct behavior", () => {
         expect(JSON.stringify("\ud83d\ud83d\ude04\ud83d\ude04\ude04")).toBe('"\\ud83d😄😄\\ude04"');
         expect(JSON.stringify("\ude04\ud83d\ude04\ud83d\ude04\ud83d")).toBe('"\\ude04😄😄\\ud83d"');
     });
+
+    test("escape control characters, quotes and backslashes in strings", () => {
+        expect(JSON.stringify('foo"bar\\baz\n\u0001')).toBe('"foo\\"bar\\\\baz\\n\\u0001"');
+        expect(JSON.stringify('😄"\b\u001f😄')).toBe('"😄\\"\\b\\u001f😄"');
+        expect(JSON.stringify({ 'a"b': 1, "c\nd": 2 })).toBe('{"a\\"b":1,"c\\nd":2}');
+    });
+
+    test("objects with the same shape", () => {
+        let objects = [];
+        for (let i = 0; i < 3; ++i) objects.push({ foo: i, bar: [i, "baz"] });
+        expect(JSON.stringify(objects)).toBe(
+            '[{"foo":0,"bar":[0,"baz"]},{"foo":1,"bar":[1,"baz"]},{"foo":2,"bar":[2,"baz"]}]'
+        );
+    });
+
+    test("properties changed while serializing", () => {
+        let o = {
+            foo: {
+                toJSON() {
+                    delete o.bar;
+                    o.baz = 3;
+                    return 1;
+                },
+            },
+            bar: 2,
+            qux: 4,
+        };
+        expect(JSON.stringify(o)).toBe('{"foo":1,"qux":4}');
+
+        let a = [
+            {
+                toJSON() {
+                    a[1] = "changed";
+                    return 1;
+                },
+            },
+            2,
+        ];
+        expect(JSON.stringify(a)).toBe('[1,"changed"]');
+    });
+
+    test("accessors and holes", () => {
+        let o = { foo: 1 };
+        Object.defineProperty(o, "bar", { get: () => 2, enumerable: true });
+        expect(JSON.stringify(o)).toBe('{"foo":1,"bar":2}');
+
+        let a = [1, , 3];
+        Object.defineProperty(a, 3, { get: () => 4, enumerable: true });
+        expect(JSON.stringify(a)).toBe("[1,null,3,4]");
+
+        Array.prototype[1] = "from prototype";
+        expect(JSON.stringify(a)).toBe('[1,"from prototype",3,4]');
+        delete Array.prototype[1];
+    });
 });
 
 describe("errors", () => {
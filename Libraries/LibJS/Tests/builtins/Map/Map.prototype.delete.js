@@ -82,4 +82,26 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
         expect(iterator.next()).toBeIteratorResultDone();
     });
+
+    test("iterators keep their place when many elements are deleted", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        expect(iterator.next()).toBeIteratorResultWithValue(0);
+        expect(iterator.next()).toBeIteratorResultWithValue(1);
+
+        for (let i = 0; i < 90; ++i) {
+            if (i !== 50) map.delete(i);
+        }
+        map.set(100, 100);
+
+        expect(iterator.next()).toBeIteratorResultWithValue(50);
+        for (let i = 90; i <= 100; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+        expect(iterator.next()).toBeIteratorResultDone();
+
+        expect(map).toHaveSize(12);
+        expect(map.get(91)).toBe(91);
+        expect(map.has(0)).toBeFalse();
+    });
 });
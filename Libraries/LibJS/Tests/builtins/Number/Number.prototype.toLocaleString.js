@@ -13,6 +13,13 @@ describe("correct behavior", () => {
     test("length", () => {
         expect(Number.prototype.toLocaleString).toHaveLength(0);
     });
+
+    test("default formatting is not affected by other calls", () => {
+        expect((1234.5).toLocaleString()).toBe("1,234.5");
+        expect((1234.5).toLocaleString("de")).toBe("1.234,5");
+        expect((1234.5).toLocaleString(undefined, { maximumFractionDigits: 0 })).toBe("1,235");
+        expect((1234.5).toLocaleString()).toBe("1,234.5");
+    });
 });
 
 describe("special values", () => {
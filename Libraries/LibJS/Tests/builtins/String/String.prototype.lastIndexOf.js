@@ -19,6 +19,10 @@ test("basic functionality", () => {
     expect("hello friends serenity".lastIndexOf("l", 4)).toBe(3);
     expect("hello friends serenity".lastIndexOf("s", 13)).toBe(12);
     expect("hello".lastIndexOf("serenity")).toBe(-1);
+    expect("aaaa".lastIndexOf("aa")).toBe(2);
+    expect("aaaa".lastIndexOf("aa", 1)).toBe(1);
+    expect("aaaa".lastIndexOf("", 10)).toBe(4);
+    expect("abc".lastIndexOf("c", -5)).toBe(-1);
 });
 
 test("UTF-16", () => {
@@ -32,6 +32,16 @@ test("limits", () => {
     expect("a b c d".split(" ", 1)).toEqual(["a"]);
     expect("a b c d".split(" ", 3)).toEqual(["a", "b", "c"]);
     expect("a b c d".split(" ", 100)).toEqual(["a", "b", "c", "d"]);
+    expect("abcd".split("", 2)).toEqual(["a", "b"]);
+    expect("abcd".split("", 100)).toEqual(["a", "b", "c", "d"]);
+    expect("".split("")).toEqual([]);
+    expect("".split(",")).toEqual([""]);
+});
+
+test("overlapping separators", () => {
+    expect("aaaa".split("aa")).toEqual(["", "", ""]);
+    expect("aaaaa".split("aa")).toEqual(["", "", "a"]);
+    expect("abababc".split("abc")).toEqual(["abab", ""]);
 });
 
 test("regex split", () => {
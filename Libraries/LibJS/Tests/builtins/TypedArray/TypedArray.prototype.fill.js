@@ -76,3 +76,22 @@ test("basic functionality", () => {
         expect(typedArray[2]).toBe(0n);
     });
 });
+
+test("values are converted to the element type once", () => {
+    expect(new Uint8Array(5).fill(257)).toEqual(new Uint8Array([1, 1, 1, 1, 1]));
+    expect(new Uint8ClampedArray(3).fill(300)).toEqual(new Uint8ClampedArray([255, 255, 255]));
+    expect(new Int16Array(4).fill(-2, 1)).toEqual(new Int16Array([0, -2, -2, -2]));
+    expect(new Float32Array(7).fill(1.5, 2, -1)).toEqual(new Float32Array([0, 0, 1.5, 1.5, 1.5, 1.5, 0]));
+    expect(new Float64Array(3).fill(NaN).every(Number.isNaN)).toBeTrue();
+    expect(new BigInt64Array(3).fill(-1n)).toEqual(new BigInt64Array([-1n, -1n, -1n]));
+
+    let conversions = 0;
+    const value = {
+        valueOf() {
+            ++conversions;
+            return 7;
+        },
+    };
+    expect(new Int32Array(9).fill(value)).toEqual(new Int32Array(9).map(() => 7));
+    expect(conversions).toBe(1);
+});
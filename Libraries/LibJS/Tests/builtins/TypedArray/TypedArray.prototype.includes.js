@@ -63,3 +63,37 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("Numbers that can't be represented by the element type", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T([1, 2, 3]);
+        expect(typedArray.includes(1.5)).toBeFalse();
+        expect(typedArray.includes(257)).toBeFalse();
+        expect(typedArray.includes(-1)).toBeFalse();
+        expect(typedArray.includes(NaN)).toBeFalse();
+        expect(typedArray.includes(-0)).toBeFalse();
+        expect(typedArray.includes(3, 2)).toBeTrue();
+        expect(typedArray.includes(1, 1)).toBeFalse();
+    });
+
+    expect(new Int8Array([-1]).includes(255)).toBeFalse();
+    expect(new Int8Array([-1]).includes(-1)).toBeTrue();
+    expect(new Float32Array([NaN]).includes(NaN)).toBeTrue();
+    expect(new Float64Array([-0]).includes(0)).toBeTrue();
+    expect(new Float32Array([0.1]).includes(0.1)).toBeFalse();
+});
+
+test("elements that went out of bounds while converting fromIndex", () => {
+    const arrayBuffer = new ArrayBuffer(4, { maxByteLength: 8 });
+    const typedArray = new Uint8Array(arrayBuffer);
+    typedArray[3] = 1;
+
+    const fromIndex = {
+        valueOf() {
+            arrayBuffer.resize(2);
+            return 0;
+        },
+    };
+    expect(typedArray.includes(1, fromIndex)).toBeFalse();
+    expect(typedArray.includes(undefined, fromIndex)).toBeTrue();
+});
@@ -103,6 +103,19 @@ describe("normal behavior", () => {
         BIGINT_TYPED_ARRAYS.forEach(T => argumentTests(T));
     });
 
+    test("set works when source and target overlap in the same buffer", () => {
+        const typedArray = new Uint16Array([1, 2, 3, 4, 5]);
+        typedArray.set(typedArray.subarray(0, 3), 2);
+        expect(typedArray).toEqual(new Uint16Array([1, 2, 1, 2, 3]));
+
+        typedArray.set(typedArray.subarray(2, 5), 0);
+        expect(typedArray).toEqual(new Uint16Array([1, 2, 3, 2, 3]));
+
+        const bytes = new Uint8Array(typedArray.buffer);
+        bytes.set(new Uint16Array(typedArray.buffer, 2, 2), 0);
+        expect(bytes.slice(0, 2)).toEqual(new Uint8Array([2, 3]));
+    });
+
     test("set works when source is Array", () => {
         function argumentTests({ array, maxUnsignedInteger }) {
             const firstTypedArray = new array(1);
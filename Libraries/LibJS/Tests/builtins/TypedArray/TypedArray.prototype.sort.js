@@ -90,3 +90,33 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("numeric order without a comparator", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([NaN, 1, 0, -Infinity, -0, NaN, Infinity, -1]);
+        typedArray.sort();
+        expect(Array.from(typedArray)).toEqual([-Infinity, -1, -0, 0, 1, Infinity, NaN, NaN]);
+        expect(Object.is(typedArray[2], -0)).toBeTrue();
+        expect(Object.is(typedArray[3], 0)).toBeTrue();
+    });
+
+    TYPED_ARRAYS.forEach(T => {
+        const values = [];
+        for (let i = 0; i < 300; ++i) values.push((i * 37) % 101);
+
+        const typedArray = new T(values);
+        const sorted = typedArray.toSorted();
+        expect(sorted).not.toBe(typedArray);
+        expect(Array.from(typedArray)).toEqual(values);
+
+        typedArray.sort();
+        for (let i = 1; i < typedArray.length; ++i) {
+            expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+            expect(sorted[i]).toBe(typedArray[i]);
+        }
+    });
+
+    const signed = new Int8Array([127, -128, 0, -1, 1]);
+    signed.sort();
+    expect(Array.from(signed)).toEqual([-128, -1, 0, 1, 127]);
+});
@@ -0,0 +1,49 @@
+test("methods with the name of a builtin are called normally", () => {
+    const object = {
+        push(value) {
+            return `push ${value}`;
+        },
+        charCodeAt(position) {
+            return `charCodeAt ${position}`;
+        },
+    };
+    expect(object.push(1)).toBe("push 1");
+    expect(object.charCodeAt(2)).toBe("charCodeAt 2");
+});
+
+test("builtins are called with the correct this value", () => {
+    const array = [1];
+    expect(array.push(2)).toBe(2);
+    expect(array).toEqual([1, 2]);
+
+    const arrayLike = { length: 1 };
+    arrayLike.push = Array.prototype.push;
+    expect(arrayLike.push("a")).toBe(2);
+    expect(arrayLike[1]).toBe("a");
+
+    expect("abc".charCodeAt(1)).toBe(98);
+    expect(new String("abc").charCodeAt(2)).toBe(99);
+    expect((123).toString().charCodeAt(0)).toBe(49);
+});
+
+test("builtins throw as usual", () => {
+    expect(() => String.prototype.charCodeAt.call(null, 0)).toThrow(TypeError);
+
+    const charCodeAt = String.prototype.charCodeAt;
+    const object = { charCodeAt };
+    expect(object.charCodeAt(0)).toBe(91);
+
+    expect(() => Object.hasOwn(null, "a")).toThrow(TypeError);
+    expect(Object.hasOwn({ a: 1 }, "a")).toBeTrue();
+    expect(Object.hasOwn({ a: 1 }, "b")).toBeFalse();
+});
+
+test("redefined builtins are respected", () => {
+    const originalHasOwn = Object.hasOwn;
+    Object.hasOwn = () => "redefined";
+    try {
+        expect(Object.hasOwn({}, "a")).toBe("redefined");
+    } finally {
+        Object.hasOwn = originalHasOwn;
+    }
+});
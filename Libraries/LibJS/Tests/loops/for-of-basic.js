@@ -23,6 +23,52 @@ describe("correct behavior", () => {
         expect(a).toEqual(["h", "e", "l", "l", "o"]);
     });
 
+    test("iterate through generator", () => {
+        let finallyRan = false;
+        function* generator() {
+            try {
+                yield 1;
+                yield 2;
+                yield 3;
+            } finally {
+                finallyRan = true;
+            }
+        }
+
+        const a = [];
+        for (const num of generator()) {
+            a.push(num);
+        }
+        expect(a).toEqual([1, 2, 3]);
+        expect(finallyRan).toBeTrue();
+
+        finallyRan = false;
+        for (const num of generator()) {
+            if (num === 2) break;
+        }
+        expect(finallyRan).toBeTrue();
+
+        const [first, ...rest] = generator();
+        expect(first).toBe(1);
+        expect(rest).toEqual([2, 3]);
+    });
+
+    test("respects redefined generator next method", () => {
+        function* generator() {
+            yield 1;
+        }
+
+        const iterator = generator();
+        let count = 0;
+        iterator.next = () => ({ value: count, done: count++ >= 2 });
+
+        const a = [];
+        for (const num of iterator) {
+            a.push(num);
+        }
+        expect(a).toEqual([0, 1]);
+    });
+
     test("use already-declared variable", () => {
         var char;
         for (char of "abc");
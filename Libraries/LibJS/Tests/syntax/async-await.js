@@ -292,3 +292,30 @@ describe("await observably looks up constructor of Promise objects", () => {
     runQueuedPromiseJobs();
     expect(calls).toBe(4);
 });
+
+test("repeatedly awaiting in one async function", () => {
+    const values = [];
+    let caught;
+
+    async function test() {
+        for (let i = 0; i < 5; ++i) values.push(await i);
+        values.push(await Promise.resolve("resolved"));
+        try {
+            await Promise.reject("rejected");
+        } catch (error) {
+            caught = error;
+        }
+        values.push(await new Promise(resolve => resolve("pending")));
+        return values.length;
+    }
+
+    let result;
+    test().then(length => {
+        result = length;
+    });
+    runQueuedPromiseJobs();
+
+    expect(values).toEqual([0, 1, 2, 3, 4, "resolved", "pending"]);
+    expect(caught).toBe("rejected");
+    expect(result).toBe(7);
+});
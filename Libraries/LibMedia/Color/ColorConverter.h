@@ -8,6 +8,7 @@
 
 #include <AK/Array.h>
 #include <AK/Function.h>
+#include <AK/SIMDExtras.h>
 #include <LibGfx/Color.h>
 #include <LibGfx/Matrix4x4.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
@@ -103,6 +104,88 @@ private:
         return value * scale;
     }
 
+    // The fixed-point factors used by the fast 8-bit YUV to full-range RGB conversion.
+    struct SimpleYUVToRGBFactors {
+        i32 y_offset;
+        i32 uv_offset;
+        i32 y_scale;
+        i32 red_v;
+        i32 green_u;
+        i32 green_v;
+        i32 blue_u;
+        i32 maximum_component;
+        i32 output_shift;
+    };
+
+    template<MatrixCoefficients MC, VideoFullRangeFlag FR>
+    static consteval SimpleYUVToRGBFactors simple_yuv_to_rgb_factors()
+    {
+        constexpr i32 bit_depth = 8;
+        constexpr i32 maximum_value = (1 << bit_depth) - 1;
+        constexpr i32 one_shift = 14;
+        constexpr i32 one = 1 << one_shift;
+        constexpr auto fraction = [](i32 numerator, i32 denominator) {
+            auto temp = static_cast<i64>(numerator) * one;
+            return static_cast<i32>(temp / denominator);
+        };
+        constexpr auto coef = [](i32 hundred_thousandths) {
+            return static_cast<i32>(static_cast<i64>(hundred_thousandths) * one / 100'000);
+        };
+        constexpr auto multiply = [](i32 a, i32 b) {
+            return (a * b) / one;
+        };
+
+        i32 min = 0;
+        i32 y_max = 255;
+        i32 uv_max = 255;
+
+        if constexpr (FR == VideoFullRangeFlag::Studio) {
+            min = 16;
+            y_max = 235;
+            uv_max = 240;
+        }
+
+        SimpleYUVToRGBFactors factors {};
+        factors.y_offset = -min * maximum_value / 255;
+        factors.uv_offset = -((min + uv_max) * maximum_value) / (255 * 2);
+
+        // The factors below will have the following effects:
+        //  - Scale the Y, U and V values into the range 0...maximum_value*one for these fixed-point operations.
+        //  - Scale the values by the color range defined by VideoFullRangeFlag.
+        //  - Scale the U and V values by 2 to put them in the actual YCbCr coordinate space.
+        //  - Multiply by the YCbCr coefficients to convert to RGB.
+        factors.y_scale = multiply(fraction(255, y_max - min), fraction(255, maximum_value));
+        auto uv_scale = multiply(fraction(255, uv_max - min) * 2, fraction(255, maximum_value));
+
+        if constexpr (MC == MatrixCoefficients::BT709) {
+            factors.red_v = multiply(coef(78740), uv_scale);
+            factors.green_u = multiply(coef(-9366), uv_scale);
+            factors.green_v = multiply(coef(-23406), uv_scale);
+            factors.blue_u = multiply(coef(92780), uv_scale);
+        } else if constexpr (MC == MatrixCoefficients::BT601) {
+            factors.red_v = multiply(coef(70100), uv_scale);
+            factors.green_u = multiply(coef(-17207), uv_scale);
+            factors.green_v = multiply(coef(-35707), uv_scale);
+            factors.blue_u = multiply(coef(88600), uv_scale);
+        } else if constexpr (MC == MatrixCoefficients::BT2020ConstantLuminance) {
+            factors.red_v = multiply(coef(73730), uv_scale);
+            factors.green_u = multiply(coef(-8228), uv_scale);
+            factors.green_v = multiply(coef(-28568), uv_scale);
+            factors.blue_u = multiply(coef(94070), uv_scale);
+        } else {
+            VERIFY_NOT_REACHED();
+        }
+
+        factors.maximum_component = maximum_value * one;
+
+        // Dividing by this fraction brings the components back into the 0...255 range. With an 8-bit maximum value
+        // it is exactly one, so we can shift instead.
+        static_assert(fraction(maximum_value, 255) == one);
+        factors.output_shift = one_shift;
+
+        return factors;
+    }
+
 public:
     static DecoderErrorOr<ColorConverter> create(u8 bit_depth, CodingIndependentCodePoints input_cicp, CodingIndependentCodePoints output_cicp);
 
@@ -154,93 +237,70 @@ public:
     template<MatrixCoefficients MC, VideoFullRangeFlag FR, Unsigned T>
     static ALWAYS_INLINE Gfx::Color convert_simple_yuv_to_rgb(T y_in, T u_in, T v_in)
     {
-        static constexpr i32 bit_depth = 8;
-        static constexpr i32 maximum_value = (1 << bit_depth) - 1;
-        static constexpr i32 one = 1 << 14;
-        static constexpr auto fraction = [](i32 numerator, i32 denominator) constexpr {
-            auto temp = static_cast<i64>(numerator) * one;
-            return static_cast<i32>(temp / denominator);
-        };
-        static constexpr auto coef = [](i32 hundred_thousandths) constexpr {
-            return fraction(hundred_thousandths, 100'000);
-        };
-        static constexpr auto multiply = [](i32 a, i32 b) constexpr {
-            return (a * b) / one;
-        };
+        constexpr auto factors = simple_yuv_to_rgb_factors<MC, FR>();
 
-        struct RangeFactors {
-            i32 y_offset, y_scale;
-            i32 uv_offset, uv_scale;
-        };
-
-        constexpr auto range_factors = [] {
-            RangeFactors range_factors;
+        i32 y = y_in + factors.y_offset;
+        i32 u = u_in + factors.uv_offset;
+        i32 v = v_in + factors.uv_offset;
 
-            i32 min = 0;
-            i32 y_max = 255;
-            i32 uv_max = 255;
+        i32 red = y * factors.y_scale + v * factors.red_v;
+        i32 green = y * factors.y_scale + u * factors.green_u + v * factors.green_v;
+        i32 blue = y * factors.y_scale + u * factors.blue_u;
 
-            if constexpr (FR == VideoFullRangeFlag::Studio) {
-                min = 16;
-                y_max = 235;
-                uv_max = 240;
-            }
+        red = clamp(red, 0, factors.maximum_component);
+        green = clamp(green, 0, factors.maximum_component);
+        blue = clamp(blue, 0, factors.maximum_component);
 
-            range_factors.y_offset = -min * maximum_value / 255;
-            range_factors.y_scale = fraction(255, y_max - min);
-            range_factors.uv_offset = -((min + uv_max) * maximum_value) / (255 * 2);
-            range_factors.uv_scale = fraction(255, uv_max - min) * 2;
+        red >>= factors.output_shift;
+        green >>= factors.output_shift;
+        blue >>= factors.output_shift;
 
-            range_factors.y_scale = multiply(range_factors.y_scale, fraction(255, maximum_value));
-            range_factors.uv_scale = multiply(range_factors.uv_scale, fraction(255, maximum_value));
-
-            return range_factors;
-        }();
-
-        i32 y = y_in + range_factors.y_offset;
-        i32 u = u_in + range_factors.uv_offset;
-        i32 v = v_in + range_factors.uv_offset;
-
-        i32 red;
-        i32 green;
-        i32 blue;
+        return Gfx::Color(u8(red), u8(green), u8(blue));
+    }
 
-        constexpr i32 y_scale = range_factors.y_scale;
-        constexpr i32 uv_scale = range_factors.uv_scale;
+    // Fast conversion of a row of 8-bit YUV to full-range RGB. This produces the same results as
+    // convert_simple_yuv_to_rgb(), but converts a vector of pixels at a time.
+    template<MatrixCoefficients MC, VideoFullRangeFlag FR, Unsigned T>
+    static ALWAYS_INLINE void convert_simple_yuv_to_rgb_row(T const* y_row, T const* u_row, T const* v_row, u32* output, size_t width)
+    {
+        using AK::SIMD::f32x4;
+        using AK::SIMD::i32x4;
+        using AK::SIMD::u32x4;
+        using InputVector = Conditional<IsSame<T, u8>, AK::SIMD::u8x4, AK::SIMD::u16x4>;
+        static constexpr size_t vector_length = AK::SIMD::vector_length<i32x4>;
+        static constexpr auto factors = simple_yuv_to_rgb_factors<MC, FR>();
+
+        // OPTIMIZATION: Vectorized 32-bit integer multiplication is not available on baseline x86-64, so the fixed-point
+        //               sums are calculated with floats instead. All of the intermediate values are integers below 2^24,
+        //               which floats represent exactly, so the results are identical to the integer calculations.
+        auto load = [](T const* row, i32 offset) {
+            auto integers = __builtin_convertvector(AK::SIMD::load_unaligned<InputVector>(row), i32x4);
+            return __builtin_convertvector(integers + offset, f32x4);
+        };
+        auto clamp_and_shift = [](f32x4 sum) {
+            auto value = __builtin_convertvector(sum, i32x4);
+            value &= value > 0;
+            auto exceeds_maximum = value > factors.maximum_component;
+            value = (value & ~exceeds_maximum) | (factors.maximum_component & exceeds_maximum);
+            return __builtin_convertvector(value >> factors.output_shift, u32x4);
+        };
 
-        // The equations below will have the following effects:
-        //  - Scale the Y, U and V values into the range 0...maximum_value*one for these fixed-point operations.
-        //  - Scale the values by the color range defined by VideoFullRangeFlag.
-        //  - Scale the U and V values by 2 to put them in the actual YCbCr coordinate space.
-        //  - Multiply by the YCbCr coefficients to convert to RGB.
-        if constexpr (MC == MatrixCoefficients::BT709) {
-            red = y * y_scale + v * multiply(coef(78740), uv_scale);
-            green = y * y_scale + u * multiply(coef(-9366), uv_scale) + v * multiply(coef(-23406), uv_scale);
-            blue = y * y_scale + u * multiply(coef(92780), uv_scale);
-        }
+        size_t column = 0;
+        for (; column + vector_length <= width; column += vector_length) {
+            auto y = load(y_row + column, factors.y_offset) * static_cast<float>(factors.y_scale);
+            auto u = load(u_row + column, factors.uv_offset);
+            auto v = load(v_row + column, factors.uv_offset);
 
-        if constexpr (MC == MatrixCoefficients::BT601) {
-            red = y * y_scale + v * multiply(coef(70100), uv_scale);
-            green = y * y_scale + u * multiply(coef(-17207), uv_scale) + v * multiply(coef(-35707), uv_scale);
-            blue = y * y_scale + u * multiply(coef(88600), uv_scale);
-        }
+            auto red = clamp_and_shift(y + v * static_cast<float>(factors.red_v));
+            auto green = clamp_and_shift(y + u * static_cast<float>(factors.green_u) + v * static_cast<float>(factors.green_v));
+            auto blue = clamp_and_shift(y + u * static_cast<float>(factors.blue_u));
 
-        if constexpr (MC == MatrixCoefficients::BT2020ConstantLuminance) {
-            red = y * y_scale + v * multiply(coef(73730), uv_scale);
-            green = y * y_scale + u * multiply(coef(-8228), uv_scale) + v * multiply(coef(-28568), uv_scale);
-            blue = y * y_scale + u * multiply(coef(94070), uv_scale);
+            u32x4 pixels = 0xff000000 | (red << 16) | (green << 8) | blue;
+            AK::SIMD::store_unaligned(output + column, pixels);
         }
 
-        red = clamp(red, 0, maximum_value * one);
-        green = clamp(green, 0, maximum_value * one);
-        blue = clamp(blue, 0, maximum_value * one);
-
-        // This compiles down to a bit shift if maximum_value == 255
-        red /= fraction(maximum_value, 255);
-        green /= fraction(maximum_value, 255);
-        blue /= fraction(maximum_value, 255);
-
-        return Gfx::Color(u8(red), u8(green), u8(blue));
+        for (; column < width; column++)
+            output[column] = convert_simple_yuv_to_rgb<MC, FR>(y_row[column], u_row[column], v_row[column]).value();
     }
 
 private:
@@ -1135,4 +1135,155 @@ ErrorOr<void> Streamer::seek_to_position(size_t position)
     return {};
 }
 
+// An element ID is at most 4 octets long, and an element data size is at most 8 octets long.
+static constexpr size_t MAXIMUM_ELEMENT_HEADER_SIZE = 4 + 8;
+
+DecoderErrorOr<ByteStreamParser::ParsedData> ByteStreamParser::append(ByteBuffer&& data)
+{
+    // The appended data only needs to be copied if it continues an element that the previous append left incomplete.
+    if (!m_pending_data.is_empty()) {
+        DECODER_TRY_ALLOC(m_pending_data.try_append(data));
+        data = move(m_pending_data);
+        m_pending_data = {};
+    }
+    auto chunk = ByteStreamChunk::create(move(data));
+
+    ParsedData parsed_data;
+    Streamer streamer { chunk->bytes() };
+
+    while (streamer.has_octet()) {
+        auto element_position = streamer.position();
+        auto result = TRY(parse_next_element(streamer, chunk, parsed_data));
+
+        if (result == ElementParseResult::NeedsMoreData) {
+            dbgln_if(MATROSKA_TRACE_DEBUG, "Byte stream element at {} is incomplete, keeping {} octets for the next append", element_position, chunk->bytes().size() - element_position);
+            m_pending_data = DECODER_TRY_ALLOC(ByteBuffer::copy(chunk->bytes().slice(element_position)));
+            break;
+        }
+    }
+
+    return parsed_data;
+}
+
+void ByteStreamParser::reset()
+{
+    m_pending_data.clear();
+    m_cluster_timestamp.clear();
+}
+
+DecoderErrorOr<ByteStreamParser::ElementParseResult> ByteStreamParser::parse_next_element(Streamer& streamer, NonnullRefPtr<ByteStreamChunk> const& chunk, ParsedData& parsed_data)
+{
+    auto element_header_is_incomplete = streamer.remaining() < MAXIMUM_ELEMENT_HEADER_SIZE;
+
+    auto element_id_or_error = streamer.read_variable_size_integer(false);
+    if (element_id_or_error.is_error()) {
+        if (element_header_is_incomplete)
+            return ElementParseResult::NeedsMoreData;
+        return DecoderError::corrupted("Failed to read a byte stream element ID"sv);
+    }
+    auto element_id = element_id_or_error.release_value();
+
+    auto size_position = streamer.position();
+    auto element_size_or_error = streamer.read_variable_size_integer();
+    if (element_size_or_error.is_error()) {
+        if (element_header_is_incomplete)
+            return ElementParseResult::NeedsMoreData;
+        return DecoderError::corrupted("Failed to read a byte stream element size"sv);
+    }
+    auto element_size = element_size_or_error.release_value();
+    auto element_size_length = streamer.position() - size_position;
+    auto element_size_is_unknown = element_size == (1ull << (7 * element_size_length)) - 1;
+
+    // Segments and Clusters are entered instead of being parsed as a whole, so that their children can be parsed
+    // as they arrive. Live streams generally don't know the sizes of these elements in advance.
+    if (element_id == SEGMENT_ELEMENT_ID || element_id == CLUSTER_ELEMENT_ID) {
+        dbgln_if(MATROSKA_DEBUG, "Entering byte stream {} element", element_id == SEGMENT_ELEMENT_ID ? "Segment"sv : "Cluster"sv);
+        m_cluster_timestamp.clear();
+        return ElementParseResult::Parsed;
+    }
+
+    if (element_size_is_unknown)
+        return DecoderError::format(DecoderErrorCategory::Corrupted, "Byte stream element {:#010x} has an unknown size", element_id);
+    if (streamer.remaining() < element_size)
+        return ElementParseResult::NeedsMoreData;
+
+    // The functions parsing the element read its size again.
+    TRY_READ(streamer.seek_to_position(size_position));
+
+    switch (element_id) {
+    case EBML_MASTER_ELEMENT_ID: {
+        auto header = TRY(parse_ebml_header(streamer));
+        if (header.doc_type != "webm"sv && header.doc_type != "matroska"sv)
+            return DecoderError::format(DecoderErrorCategory::Invalid, "Byte stream has unsupported DocType {}", header.doc_type);
+        break;
+    }
+    case SEGMENT_INFORMATION_ELEMENT_ID:
+        m_segment_information = TRY(parse_information(streamer));
+        break;
+    case TRACK_ELEMENT_ID: {
+        if (!m_segment_information.has_value())
+            return DecoderError::corrupted("Tracks element was received before the Segment Information element"sv);
+
+        InitializationSegment initialization_segment { m_segment_information.value(), {} };
+        m_tracks.clear();
+
+        TRY(parse_master_element(streamer, "Tracks"sv, [&](u64 child_element_id) -> DecoderErrorOr<IterationDecision> {
+            if (child_element_id == TRACK_ENTRY_ID) {
+                auto track_entry = TRY(parse_track_entry(streamer));
+                dbgln_if(MATROSKA_DEBUG, "Parsed byte stream track {}", track_entry->track_number());
+                DECODER_TRY_ALLOC(m_tracks.try_set(track_entry->track_number(), track_entry));
+                DECODER_TRY_ALLOC(initialization_segment.tracks.try_append(track_entry));
+            } else {
+                TRY_READ(streamer.read_unknown_element());
+            }
+
+            return IterationDecision::Continue;
+        }));
+
+        parsed_data.initialization_segment = move(initialization_segment);
+        break;
+    }
+    case TIMESTAMP_ID: {
+        if (!m_segment_information.has_value())
+            return DecoderError::corrupted("Cluster was received before the Segment Information element"sv);
+
+        auto timestamp = TRY_READ(streamer.read_u64());
+        m_cluster_timestamp = AK::Duration::from_nanoseconds(timestamp * m_segment_information->timestamp_scale());
+        break;
+    }
+    case SIMPLE_BLOCK_ID: {
+        if (m_tracks.is_empty())
+            return DecoderError::corrupted("Media segment was received before an initialization segment"sv);
+        if (!m_cluster_timestamp.has_value())
+            return DecoderError::corrupted("SimpleBlock was received before its Cluster's timestamp"sv);
+
+        // Peek at the block's track number to find the track that it belongs to.
+        Streamer track_number_streamer { chunk->bytes() };
+        TRY_READ(track_number_streamer.seek_to_position(size_position));
+        TRY_READ(track_number_streamer.read_variable_size_integer());
+        auto track_number = TRY_READ(track_number_streamer.read_variable_size_integer());
+
+        auto track = m_tracks.get(track_number);
+        if (!track.has_value()) {
+            TRY_READ(streamer.read_unknown_element());
+            break;
+        }
+
+        auto block = TRY(parse_simple_block(streamer, m_cluster_timestamp.value(), m_segment_information->timestamp_scale(), *track.value()));
+
+        // FIXME: The frames of a laced block should have timestamps spread over the block's duration.
+        for (auto const& frame : block.frames())
+            DECODER_TRY_ALLOC(parsed_data.coded_frames.try_append({ chunk, frame, block.track_number(), block.timestamp(), block.only_keyframes() }));
+        break;
+    }
+    default:
+        // FIXME: Parse the Blocks in BlockGroup elements.
+        dbgln_if(MATROSKA_TRACE_DEBUG, "Skipping byte stream element with ID {:#010x}", element_id);
+        TRY_READ(streamer.read_unknown_element());
+        break;
+    }
+
+    return ElementParseResult::Parsed;
+}
+
 }
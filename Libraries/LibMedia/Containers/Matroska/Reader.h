@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/Optional.h>
@@ -166,4 +168,69 @@ private:
     Vector<size_t> m_octets_read { 0 };
 };
 
+// A piece of a byte stream that was appended to a ByteStreamParser. The coded frames that are parsed from it keep it
+// alive, so that their data doesn't have to be copied out of it.
+class ByteStreamChunk final : public AtomicRefCounted<ByteStreamChunk> {
+public:
+    static NonnullRefPtr<ByteStreamChunk> create(ByteBuffer&& data)
+    {
+        return adopt_ref(*new ByteStreamChunk(move(data)));
+    }
+
+    ReadonlyBytes bytes() const { return m_data; }
+
+private:
+    explicit ByteStreamChunk(ByteBuffer&& data)
+        : m_data(move(data))
+    {
+    }
+
+    ByteBuffer m_data;
+};
+
+struct CodedFrame {
+    NonnullRefPtr<ByteStreamChunk> chunk;
+    ReadonlyBytes data;
+    u64 track_number { 0 };
+    AK::Duration timestamp;
+    bool is_keyframe { false };
+};
+
+// Incrementally parses a WebM byte stream which is received in arbitrarily sized pieces, as it is by a SourceBuffer.
+// https://w3c.github.io/mse-byte-stream-format-webm/
+class ByteStreamParser {
+public:
+    struct InitializationSegment {
+        SegmentInformation segment_information;
+        Vector<NonnullRefPtr<TrackEntry>> tracks;
+    };
+
+    struct ParsedData {
+        Optional<InitializationSegment> initialization_segment;
+        Vector<CodedFrame> coded_frames;
+    };
+
+    // Parses as much of the byte stream as is available. An element that is only partially available is kept until the
+    // rest of it is appended.
+    DecoderErrorOr<ParsedData> append(ByteBuffer&&);
+
+    // Discards any partially appended element, so that the next append starts at a new element. The last
+    // initialization segment remains in effect.
+    void reset();
+
+private:
+    enum class ElementParseResult {
+        Parsed,
+        NeedsMoreData,
+    };
+
+    DecoderErrorOr<ElementParseResult> parse_next_element(Streamer&, NonnullRefPtr<ByteStreamChunk> const&, ParsedData&);
+
+    ByteBuffer m_pending_data;
+
+    Optional<SegmentInformation> m_segment_information;
+    HashMap<u64, NonnullRefPtr<TrackEntry>> m_tracks;
+    Optional<AK::Duration> m_cluster_timestamp;
+};
+
 }
@@ -226,6 +226,13 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
             auto* destination = frame->get_raw_plane_data(plane);
             VERIFY(destination != nullptr);
 
+            // OPTIMIZATION: FFmpeg pads its lines for alignment, but for common video sizes the padding is empty, so the
+            //               plane can be copied in one go.
+            if (output_line_size == static_cast<size_t>(m_frame->linesize[plane])) {
+                memcpy(destination, source, output_line_size * plane_size.height());
+                continue;
+            }
+
             for (size_t row = 0; row < plane_size.height(); row++) {
                 memcpy(destination, source, output_line_size);
                 source += m_frame->linesize[plane];
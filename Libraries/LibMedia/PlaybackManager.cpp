@@ -27,6 +27,17 @@ namespace Media {
         _fatal_expression.release_value();                                                           \
     })
 
+// The decoder thread always stays at least this many frames ahead of presentation.
+static constexpr size_t minimum_buffered_frame_count = 4;
+// One slot in the frame queue must remain empty to tell a full queue apart from an empty one.
+static constexpr size_t maximum_buffered_frame_count = frame_buffer_count - 1;
+// The amount of playback that the queued frames should cover, in addition to a few frames' worth of decode time.
+static constexpr auto minimum_buffered_duration = AK::Duration::from_milliseconds(100);
+// Each time playback runs out of frames, the decoder thread queues this many more frames ahead.
+static constexpr size_t buffer_underrun_frame_count_increase = 2;
+// Bounds the memory used by the decoded frames waiting in the queue.
+static constexpr size_t maximum_buffered_frame_bytes = 256 * MiB;
+
 DecoderErrorOr<NonnullOwnPtr<PlaybackManager>> PlaybackManager::from_data(ReadonlyBytes data)
 {
     auto stream = make<FixedMemoryStream>(data);
@@ -47,6 +58,7 @@ PlaybackManager::PlaybackManager(NonnullOwnPtr<Demuxer>& demuxer, Track video_tr
     , m_frame_queue(move(frame_queue))
     , m_decoder(move(decoder))
     , m_decode_wait_condition(m_decode_wait_mutex)
+    , m_target_buffered_frame_count(minimum_buffered_frame_count)
 {
 }
 
@@ -131,6 +143,7 @@ void PlaybackManager::dispatch_decoder_error(DecoderError error)
 
 void PlaybackManager::dispatch_new_frame(RefPtr<Gfx::Bitmap> frame)
 {
+    m_presented_frames++;
     if (on_video_frame)
         on_video_frame(move(frame));
 }
@@ -193,11 +206,58 @@ void PlaybackManager::restart_playback()
     seek_to_timestamp(AK::Duration::zero());
 }
 
+void PlaybackManager::update_target_buffered_frame_count(FrameQueueItem const& item, AK::Duration decode_time)
+{
+    if (!item.is_frame())
+        return;
+
+    // Smooth out the decode time, since keyframes tend to take much longer to decode than the frames that follow them.
+    if (m_average_decode_time.is_zero())
+        m_average_decode_time = decode_time;
+    else
+        m_average_decode_time = AK::Duration::from_nanoseconds((m_average_decode_time.to_nanoseconds() * 7 + decode_time.to_nanoseconds()) / 8);
+
+    // Timestamps jump around after seeking, so only accept plausible differences between consecutive frames.
+    if (m_last_decoded_frame_timestamp.has_value()) {
+        auto frame_duration = item.timestamp() - *m_last_decoded_frame_timestamp;
+        if (frame_duration > AK::Duration::zero() && frame_duration <= AK::Duration::from_seconds(1))
+            m_frame_duration = frame_duration;
+    }
+    m_last_decoded_frame_timestamp = item.timestamp();
+
+    if (m_frame_duration.is_zero())
+        return;
+
+    // Queue enough frames to cover a short stretch of playback, plus a few frames' worth of decode time. The slower the
+    // decoder is compared to the frame rate, the more a slow frame will eat into the queued frames.
+    auto buffered_duration = minimum_buffered_duration + AK::Duration::from_nanoseconds(m_average_decode_time.to_nanoseconds() * 4);
+    auto frame_count = ceil_div(buffered_duration.to_nanoseconds(), m_frame_duration.to_nanoseconds());
+    auto target = max(static_cast<size_t>(frame_count), minimum_buffered_frame_count);
+
+    // Each time we have run out of frames during playback, decode a bit further ahead.
+    target += m_buffer_underrun_count.load() * buffer_underrun_frame_count_increase;
+
+    // Don't let large frames take up an unreasonable amount of memory.
+    auto frame_bytes = max(item.bitmap()->size_in_bytes(), 1uz);
+    target = min(target, max(maximum_buffered_frame_bytes / frame_bytes, minimum_buffered_frame_count));
+
+    target = min(target, maximum_buffered_frame_count);
+    if (target != m_target_buffered_frame_count.load()) {
+        dbgln_if(PLAYBACK_MANAGER_DEBUG, "Media Decoder: Average decode time is {}ms for {}ms frames, buffering {} frames ahead", m_average_decode_time.to_milliseconds(), m_frame_duration.to_milliseconds(), target);
+        m_target_buffered_frame_count.store(target);
+    }
+}
+
+void PlaybackManager::did_run_out_of_buffered_frames()
+{
+    auto underrun_count = m_buffer_underrun_count.load();
+    if (minimum_buffered_frame_count + (underrun_count * buffer_underrun_frame_count_increase) < maximum_buffered_frame_count)
+        m_buffer_underrun_count.store(underrun_count + 1);
+}
+
 void PlaybackManager::decode_and_queue_one_sample()
 {
-#if PLAYBACK_MANAGER_DEBUG
     auto start_time = MonotonicTime::now();
-#endif
 
     FrameQueueItem item_to_enqueue;
 
@@ -275,9 +335,10 @@ void PlaybackManager::decode_and_queue_one_sample()
     }
 
     VERIFY(!item_to_enqueue.is_empty());
-#if PLAYBACK_MANAGER_DEBUG
-    dbgln("Media Decoder: Sample at {}ms took {}ms to decode, queue contains ~{} items", item_to_enqueue.timestamp().to_milliseconds(), (MonotonicTime::now() - start_time).to_milliseconds(), m_frame_queue.weak_used());
-#endif
+    auto decode_time = MonotonicTime::now() - start_time;
+    dbgln_if(PLAYBACK_MANAGER_DEBUG, "Media Decoder: Sample at {}ms took {}ms to decode, queue contains ~{} items", item_to_enqueue.timestamp().to_milliseconds(), decode_time.to_milliseconds(), m_frame_queue.weak_used());
+
+    update_target_buffered_frame_count(item_to_enqueue, decode_time);
 
     auto wait = [&] {
         auto wait_locker = Threading::MutexLocker(m_decode_wait_mutex);
@@ -286,7 +347,7 @@ void PlaybackManager::decode_and_queue_one_sample()
 
     bool had_error = item_to_enqueue.is_error();
     while (true) {
-        if (m_frame_queue.can_enqueue()) {
+        if (m_frame_queue.weak_used() < m_target_buffered_frame_count.load() && m_frame_queue.can_enqueue()) {
             MUST(m_frame_queue.enqueue(move(item_to_enqueue)));
             break;
         }
@@ -408,6 +469,7 @@ private:
     ErrorOr<void> buffer() override
     {
         manager().m_last_present_in_media_time = current_time();
+        manager().did_run_out_of_buffered_frames();
         return replace_handler_and_delete_this<BufferingStateHandler>(true);
     }
 
@@ -87,7 +87,9 @@ private:
     AK::Duration m_timestamp { no_timestamp };
 };
 
-static constexpr size_t frame_buffer_count = 4;
+// The capacity of the frame queue. How many of these slots the decoder thread fills ahead of presentation is adjusted
+// at runtime, see PlaybackManager::update_target_buffered_frame_count().
+static constexpr size_t frame_buffer_count = 32;
 using VideoFrameQueue = Core::SharedSingleProducerCircularQueue<FrameQueueItem, frame_buffer_count>;
 
 enum class PlaybackState {
@@ -131,6 +133,7 @@ public:
     }
 
     u64 number_of_skipped_frames() const { return m_skipped_frames; }
+    u64 number_of_presented_frames() const { return m_presented_frames; }
 
     AK::Duration current_playback_time();
     AK::Duration duration();
@@ -162,6 +165,9 @@ private:
     void set_state_update_timer(int delay_ms);
 
     void decode_and_queue_one_sample();
+    // This must only be called from the decoder thread.
+    void update_target_buffered_frame_count(FrameQueueItem const&, AK::Duration decode_time);
+    void did_run_out_of_buffered_frames();
 
     void dispatch_decoder_error(DecoderError error);
     void dispatch_new_frame(RefPtr<Gfx::Bitmap> frame);
@@ -187,10 +193,20 @@ private:
     Threading::ConditionVariable m_decode_wait_condition;
     Atomic<bool> m_buffer_is_full { false };
 
+    // The number of frames the decoder thread keeps queued ahead of presentation.
+    Atomic<size_t> m_target_buffered_frame_count;
+    // How many times playback had to pause to buffer, each of which grows the target buffered frame count.
+    Atomic<u32> m_buffer_underrun_count { 0 };
+    // These are only accessed by the decoder thread.
+    AK::Duration m_average_decode_time { AK::Duration::zero() };
+    AK::Duration m_frame_duration { AK::Duration::zero() };
+    Optional<AK::Duration> m_last_decoded_frame_timestamp;
+
     OwnPtr<PlaybackStateHandler> m_playback_handler;
     Optional<FrameQueueItem> m_next_frame;
 
     u64 m_skipped_frames { 0 };
+    u64 m_presented_frames { 0 };
 
     // This is a nested class to allow private access.
     class PlaybackStateHandler {
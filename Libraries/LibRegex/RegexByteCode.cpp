@@ -444,6 +444,13 @@ ALWAYS_INLINE ExecutionResult OpCode_Compare::execute(MatchInput const& input, M
     auto argument_count = arguments_count();
     auto has_single_argument = argument_count == 1;
 
+    // OPTIMIZATION: Most compares check a single character, range or class. Those can't involve inversion or
+    //               disjunctions, so skip setting up the state for them.
+    if (has_single_argument) {
+        if (auto result = execute_single_character_compare(input, state); result.has_value())
+            return *result;
+    }
+
     bool inverse { false };
     bool temporary_inverse { false };
     bool reset_temp_inverse { false };
@@ -728,6 +735,44 @@ ALWAYS_INLINE ExecutionResult OpCode_Compare::execute(MatchInput const& input, M
     return ExecutionResult::Continue;
 }
 
+ALWAYS_INLINE Optional<ExecutionResult> OpCode_Compare::execute_single_character_compare(MatchInput const& input, MatchState& state) const
+{
+    size_t offset = state.instruction_position + 3;
+    auto compare_type = (CharacterCompareType)m_bytecode->at(offset++);
+    if (compare_type != CharacterCompareType::Char && compare_type != CharacterCompareType::CharRange && compare_type != CharacterCompareType::CharClass)
+        return {};
+
+    state.string_position_before_match = state.string_position;
+    if (input.view.length() <= state.string_position || input.view.length_in_code_units() <= state.string_position_in_code_units)
+        return ExecutionResult::Failed_ExecuteLowPrioForks;
+
+    auto string_position = state.string_position;
+    bool inverse_matched = false;
+
+    switch (compare_type) {
+    case CharacterCompareType::Char:
+        compare_char(input, state, m_bytecode->at(offset), false, inverse_matched);
+        break;
+    case CharacterCompareType::CharRange: {
+        auto range = (CharRange)m_bytecode->at(offset);
+        auto ch = input.view.unicode_aware_code_point_at(state.string_position_in_code_units);
+        compare_character_range(input, state, range.from, range.to, ch, false, inverse_matched);
+        break;
+    }
+    case CharacterCompareType::CharClass: {
+        auto ch = input.view.unicode_aware_code_point_at(state.string_position_in_code_units);
+        compare_character_class(input, state, (CharClass)m_bytecode->at(offset), ch, false, inverse_matched);
+        break;
+    }
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+    if (string_position == state.string_position || state.string_position > input.view.length())
+        return ExecutionResult::Failed_ExecuteLowPrioForks;
+    return ExecutionResult::Continue;
+}
+
 ALWAYS_INLINE void OpCode_Compare::compare_char(MatchInput const& input, MatchState& state, u32 ch1, bool inverse, bool& inverse_matched)
 {
     if (state.string_position == input.view.length())
@@ -859,6 +859,7 @@ public:
     static bool matches_character_class(CharClass, u32, bool insensitive);
 
 private:
+    ALWAYS_INLINE Optional<ExecutionResult> execute_single_character_compare(MatchInput const& input, MatchState& state) const;
     ALWAYS_INLINE static void compare_char(MatchInput const& input, MatchState& state, u32 ch1, bool inverse, bool& inverse_matched);
     ALWAYS_INLINE static bool compare_string(MatchInput const& input, MatchState& state, RegexStringView str, bool& had_zero_length_match);
     ALWAYS_INLINE static void compare_character_class(MatchInput const& input, MatchState& state, CharClass character_class, u32 ch, bool inverse, bool& inverse_matched);
@@ -245,6 +245,15 @@ public:
             });
     }
 
+    // Returns the code unit offset of the next occurrence of the given ASCII character at or after start_offset.
+    Optional<size_t> find_ascii(char character, size_t start_offset = 0) const
+    {
+        VERIFY(is_ascii(character));
+        return m_view.visit(
+            [&](StringView view) { return view.find(character, start_offset); },
+            [&](Utf16View const& view) { return view.find_code_unit_offset(static_cast<char16_t>(character), start_offset); });
+    }
+
     bool operator==(char const* cstring) const
     {
         return m_view.visit(
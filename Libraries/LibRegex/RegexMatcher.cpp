@@ -89,10 +89,21 @@ Regex<Parser>::Regex(ByteString pattern, typename ParserTraits<Parser>::OptionsT
 template<class Parser>
 Regex<Parser>::Regex(regex::Parser::Result parse_result, ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options)
     : pattern_value(move(pattern))
-    , parser_result(move(parse_result))
 {
-    parser_result.bytecode.flatten();
-    run_optimization_passes();
+    // NOTE: Patterns that were parsed ahead of time (like JS regex literals) are still optimized for every Regex that is
+    //       created from them, so we share the optimized result through the parser cache as well.
+    if (auto cache_entry = s_parser_cache<Parser>.get({ pattern_value, regex_options }); cache_entry.has_value()) {
+        parser_result = cache_entry.value();
+    } else {
+        parser_result = move(parse_result);
+        parser_result.bytecode.flatten();
+
+        run_optimization_passes();
+
+        if (parser_result.error == regex::Error::NoError)
+            cache_parse_result<Parser>(parser_result, { pattern_value, regex_options });
+    }
+
     if (parser_result.error == regex::Error::NoError)
         matcher = make<Matcher<Parser>>(this, regex_options | static_cast<decltype(regex_options.value())>(parser_result.options.value()));
 }
@@ -142,6 +153,30 @@ ByteString Regex<Parser>::error_string(Optional<ByteString> message) const
     return eb.to_byte_string();
 }
 
+static Optional<size_t> find_literal_prefix(RegexStringView view, StringView prefix, size_t start_offset)
+{
+    auto view_length = view.length_in_code_units();
+    while (start_offset + prefix.length() <= view_length) {
+        // Let the view find the first character with a vectorized scan, then check the rest in place.
+        auto candidate = view.find_ascii(prefix[0], start_offset);
+        if (!candidate.has_value() || *candidate + prefix.length() > view_length)
+            return {};
+
+        bool matches = true;
+        for (size_t i = 1; i < prefix.length(); ++i) {
+            if (view.unicode_aware_code_point_at(*candidate + i) != static_cast<u32>(prefix[i])) {
+                matches = false;
+                break;
+            }
+        }
+        if (matches)
+            return candidate;
+
+        start_offset = *candidate + 1;
+    }
+    return {};
+}
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -228,6 +263,15 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         return -1;
     };
 
+    // Jumping straight to the next occurrence of the literal prefix is only meaningful when every position would be tried
+    // anyway, and when positions are code units.
+    auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+    auto const can_skip_to_literal_prefix = !literal_prefix.is_empty()
+        && continue_search
+        && !only_start_of_line
+        && !unicode
+        && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+
     for (auto const& view : views) {
         if (lines_to_skip != 0) {
             ++input.line;
@@ -284,6 +328,13 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             //        the remaining string length from the current path. The value though
             //        has to be filled in reverse. That implies a second run over bytecode
             //        after generation has finished.
+            if (can_skip_to_literal_prefix) {
+                auto next_candidate = find_literal_prefix(input.view, literal_prefix, view_index);
+                if (!next_candidate.has_value())
+                    break;
+                view_index = *next_candidate;
+            }
+
             auto const match_length_minimum = m_pattern->parser_result.match_length_minimum;
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
@@ -475,6 +526,9 @@ private:
     Node* m_last { nullptr };
 };
 
+// Don't bother switching to the linear matcher for attempts that backtracked a little, as it has a higher constant cost.
+static constexpr size_t LinearMatcherMinimumOperationLimit = 100'000;
+
 struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
     static constexpr unsigned hash(u64 value)
     {
@@ -493,9 +547,25 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
 
     auto& bytecode = m_pattern->parser_result.bytecode;
 
+    // Backtracking can take exponential time on patterns like (a|aa)*b. When the pattern allows it, keep the initial
+    // state around so that we can start over in the linear matcher once we've spent more operations than it
+    // could possibly need.
+    Optional<MatchState> initial_state;
+    size_t operation_limit = NumericLimits<size_t>::max();
+    if (m_pattern->parser_result.optimization_data.can_use_linear_matcher) {
+        initial_state = state;
+        auto remaining_length = input.view.length() - min(state.string_position, input.view.length());
+        operation_limit = operations + max(LinearMatcherMinimumOperationLimit, (remaining_length + 1) * bytecode.size());
+    }
+
     for (;;) {
         auto& opcode = bytecode.get_opcode(state);
-        ++operations;
+        if (++operations > operation_limit) {
+            dbgln_if(REGEX_DEBUG, "Backtracking exceeded {} operations, switching to the linear matcher", operation_limit);
+            state = initial_state.release_value();
+            input.fork_to_replace.clear();
+            return execute_linear(input, state, operations);
+        }
 
 #if REGEX_DEBUG
         s_regex_dbg.print_opcode("VM", opcode, state, recursion_level, false);
@@ -603,6 +673,107 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
     VERIFY_NOT_REACHED();
 }
 
+struct LinearMatcherThread {
+    MatchState state;
+    bool succeeded { false };
+};
+
+// A Pike VM: instead of trying one path at a time, all threads live in a list ordered by priority, and advance through
+// the input together, one character per step. Threads that reach an instruction that an earlier (higher priority)
+// thread already reached in the same step are dropped, which bounds the work per step by the size of the bytecode.
+template<class Parser>
+bool Matcher<Parser>::execute_linear(MatchInput const& input, MatchState& state, size_t& operations) const
+{
+    auto& bytecode = m_pattern->parser_result.bytecode;
+
+    Vector<LinearMatcherThread> current_threads;
+    Vector<LinearMatcherThread> next_threads;
+    Vector<MatchState> pending_states;
+
+    // The step in which each instruction was last reached, offset by one so that zero means "never".
+    Vector<size_t> instruction_visited_in_step;
+    instruction_visited_in_step.resize(bytecode.size() + 1);
+    size_t step = 1;
+
+    auto add_thread = [&](Vector<LinearMatcherThread>& threads, MatchState&& thread_state) {
+        pending_states.append(move(thread_state));
+        while (!pending_states.is_empty()) {
+            auto thread = pending_states.take_last();
+            for (;;) {
+                auto& visited_in_step = instruction_visited_in_step[min(thread.instruction_position, bytecode.size())];
+                if (visited_in_step == step)
+                    break;
+                visited_in_step = step;
+
+                auto& opcode = bytecode.get_opcode(thread);
+                if (opcode.opcode_id() == OpCodeId::Compare) {
+                    threads.append({ move(thread) });
+                    break;
+                }
+
+                ++operations;
+                auto result = opcode.execute(input, thread);
+                thread.instruction_position += opcode.size();
+
+                // Atomic rewrites only drop paths that can't lead to a different result, so we can treat them as plain forks.
+                input.fork_to_replace.clear();
+
+                if (result == ExecutionResult::Continue)
+                    continue;
+
+                if (result == ExecutionResult::Fork_PrioHigh) {
+                    pending_states.append(thread);
+                    thread.instruction_position = thread.fork_at_position;
+                    continue;
+                }
+
+                if (result == ExecutionResult::Fork_PrioLow) {
+                    pending_states.append(thread);
+                    pending_states.last().instruction_position = thread.fork_at_position;
+                    continue;
+                }
+
+                if (result == ExecutionResult::Succeeded)
+                    threads.append({ move(thread), true });
+                break;
+            }
+        }
+    };
+
+    add_thread(current_threads, MatchState { state });
+
+    Optional<MatchState> best_match;
+    while (!current_threads.is_empty()) {
+        ++step;
+        for (auto& thread : current_threads) {
+            // Every thread after this one has a lower priority than the match it found, so there's no need to run them.
+            if (thread.succeeded) {
+                best_match = move(thread.state);
+                break;
+            }
+
+            auto position = thread.state.string_position;
+            auto& opcode = bytecode.get_opcode(thread.state);
+            ++operations;
+            if (opcode.execute(input, thread.state) != ExecutionResult::Continue)
+                continue;
+
+            VERIFY(thread.state.string_position == position + 1);
+            thread.state.instruction_position += opcode.size();
+            add_thread(next_threads, move(thread.state));
+        }
+
+        swap(current_threads, next_threads);
+        next_threads.clear_with_capacity();
+    }
+
+    if (!best_match.has_value())
+        return false;
+
+    state = best_match.release_value();
+    return true;
+}
+
 template class Matcher<PosixBasicParser>;
 template class Regex<PosixBasicParser>;
 
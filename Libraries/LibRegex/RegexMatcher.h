@@ -72,6 +72,7 @@ public:
 
 private:
     bool execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    bool execute_linear(MatchInput const& input, MatchState& state, size_t& operations) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
@@ -232,6 +233,8 @@ private:
     void attempt_rewrite_loops_as_atomic_groups(BasicBlockList const&);
     bool attempt_rewrite_entire_match_as_substring_search(BasicBlockList const&);
     void fill_optimization_data(BasicBlockList const&);
+    bool is_supported_by_linear_matcher() const;
+    void fill_literal_prefix();
 };
 
 // free standing functions for match, search and has_match
@@ -31,16 +31,106 @@ void Regex<Parser>::run_optimization_passes()
     rewrite_with_useless_jumps_removed();
 
     auto blocks = split_basic_blocks(parser_result.bytecode);
-    if (attempt_rewrite_entire_match_as_substring_search(blocks))
+    if (attempt_rewrite_entire_match_as_substring_search(blocks)) {
+        fill_literal_prefix();
         return;
+    }
 
     // Rewrite fork loops as atomic groups
     // e.g. a*b -> (ATOMIC a*)b
     attempt_rewrite_loops_as_atomic_groups(blocks);
 
     fill_optimization_data(split_basic_blocks(parser_result.bytecode));
+    fill_literal_prefix();
 
     parser_result.bytecode.flatten();
+
+    parser_result.optimization_data.can_use_linear_matcher = is_supported_by_linear_matcher();
+}
+
+template<typename Parser>
+void Regex<Parser>::fill_literal_prefix()
+{
+    auto const& bytecode = parser_result.bytecode;
+
+    // Follow the straight-line code at the start of the pattern for as long as it only compares single characters,
+    // as every match has to begin with those.
+    StringBuilder prefix;
+    auto state = MatchState::only_for_enumeration();
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            auto flat_compares = static_cast<OpCode_Compare const&>(opcode).flat_compares();
+            if (flat_compares.size() != 1 || flat_compares.first().type != CharacterCompareType::Char || !is_ascii(flat_compares.first().value))
+                break;
+            prefix.append(static_cast<char>(flat_compares.first().value));
+            state.instruction_position += opcode.size();
+            continue;
+        }
+        case OpCodeId::Checkpoint:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+            // These do not 'match' anything, so look through them.
+            state.instruction_position += opcode.size();
+            continue;
+        default:
+            break;
+        }
+        break;
+    }
+
+    parser_result.optimization_data.literal_prefix = prefix.to_byte_string();
+}
+
+template<typename Parser>
+bool Regex<Parser>::is_supported_by_linear_matcher() const
+{
+    auto const& bytecode = parser_result.bytecode;
+
+    // The linear matcher runs all threads in lock-step over the input, so every compare must consume exactly one
+    // character, and no thread may depend on state other than its position and capture groups.
+    auto state = MatchState::only_for_enumeration();
+    while (state.instruction_position < bytecode.size()) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+            for (auto const& compare : static_cast<OpCode_Compare const&>(opcode).flat_compares()) {
+                if (compare.type == CharacterCompareType::String || compare.type == CharacterCompareType::Reference)
+                    return false;
+            }
+            break;
+        case OpCodeId::Jump:
+        case OpCodeId::JumpNonEmpty:
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceJump:
+        case OpCodeId::ForkReplaceStay:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+        case OpCodeId::Checkpoint:
+        case OpCodeId::Exit:
+            break;
+        case OpCodeId::FailForks:
+        case OpCodeId::PopSaved:
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::Repeat:
+        case OpCodeId::ResetRepeat:
+            return false;
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    return true;
 }
 
 struct StaticallyInterpretedCompares {
@@ -68,6 +68,11 @@ public:
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
             bool only_start_of_line = false;
+            // If non-empty, every match starts with these ASCII characters (compared case-sensitively).
+            ByteString literal_prefix;
+            // If set, the bytecode has no backreferences, lookarounds or counted repetitions, so the matcher may
+            // switch to the linear-time thread-list executor once backtracking gets too expensive.
+            bool can_use_linear_matcher = false;
         } optimization_data {};
     };
 
@@ -56,10 +56,13 @@ void WebSocket::did_open(Badge<RequestClient>)
         on_open();
 }
 
-void WebSocket::did_receive(Badge<RequestClient>, ByteBuffer data, bool is_text)
+void WebSocket::did_receive(Badge<RequestClient>, Vector<Message> messages)
 {
-    if (on_message)
-        on_message(WebSocket::Message { move(data), is_text });
+    for (auto& message : messages) {
+        if (!on_message)
+            return;
+        on_message(move(message));
+    }
 }
 
 void WebSocket::did_error(Badge<RequestClient>, i32 error_code)
@@ -398,6 +398,37 @@ ErrorOr<String> UTF16LEDecoder::to_utf8(StringView input)
     return String::from_utf16_le_with_replacement_character(input.bytes());
 }
 
+// OPTIMIZATION: Single-byte encodings map every byte to a code point on its own, so we can decode them in bulk: runs
+//               of ASCII bytes decode to themselves and are copied to the output as a whole, and only the remaining
+//               bytes have to be translated and appended one code point at a time.
+template<typename TranslateNonASCIIByte>
+static ErrorOr<String> decode_single_byte_encoding_to_utf8(StringView input, TranslateNonASCIIByte translate_non_ascii_byte)
+{
+    if (input.is_ascii())
+        return String::from_utf8_without_validation(input.bytes());
+
+    auto bytes = input.bytes();
+    StringBuilder builder(bytes.size());
+    size_t ascii_run_start = 0;
+
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        auto byte = bytes[i];
+        if (byte < 0x80)
+            continue;
+
+        if (i != ascii_run_start)
+            TRY(builder.try_append(StringView { bytes.slice(ascii_run_start, i - ascii_run_start) }));
+        TRY(builder.try_append_code_point(translate_non_ascii_byte(byte)));
+
+        ascii_run_start = i + 1;
+    }
+
+    if (ascii_run_start != bytes.size())
+        TRY(builder.try_append(StringView { bytes.slice(ascii_run_start) }));
+
+    return builder.to_string_without_validation();
+}
+
 ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     for (u8 ch : input) {
@@ -408,6 +439,12 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    // Latin1 is the same as the first 256 Unicode code points, so no mapping is needed, just UTF-8 encoding.
+    return decode_single_byte_encoding_to_utf8(input, [](u8 byte) -> u32 { return byte; });
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -502,6 +539,14 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    return decode_single_byte_encoding_to_utf8(input, [this](u8 byte) -> u32 {
+        return m_translation_table[byte - 0x80];
+    });
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
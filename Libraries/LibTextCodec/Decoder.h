@@ -59,6 +59,7 @@ public:
     }
 
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
 
 private:
     Array<ArrayType, 128> m_translation_table;
@@ -67,6 +68,7 @@ private:
 class Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<String> to_utf8(StringView) override;
     virtual bool validate(StringView) override { return true; }
 };
 
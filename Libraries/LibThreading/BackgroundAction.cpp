@@ -6,6 +6,7 @@
  */
 
 #include <AK/Queue.h>
+#include <AK/Vector.h>
 #include <LibThreading/BackgroundAction.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
@@ -13,7 +14,8 @@
 static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t s_condition = PTHREAD_COND_INITIALIZER;
 static Queue<Function<void()>>* s_all_actions;
-static Threading::Thread* s_background_thread;
+static Vector<Threading::Thread*>* s_background_threads;
+static size_t s_background_thread_count = 1;
 static Atomic<bool> s_background_thread_should_run = true;
 
 static intptr_t background_thread_func()
@@ -25,8 +27,14 @@ static intptr_t background_thread_func()
         while (s_all_actions->is_empty() && s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire))
             pthread_cond_wait(&s_condition, &s_mutex);
 
-        while (!s_all_actions->is_empty())
+        // With a single background thread, we take every queued action at once. Otherwise, each thread takes one
+        // action at a time, so that the queued work is spread across all threads.
+        if (s_background_thread_count == 1) {
+            while (!s_all_actions->is_empty())
+                actions.append(s_all_actions->dequeue());
+        } else if (!s_all_actions->is_empty()) {
             actions.append(s_all_actions->dequeue());
+        }
 
         pthread_mutex_unlock(&s_mutex);
 
@@ -42,13 +50,25 @@ static intptr_t background_thread_func()
 static void init()
 {
     s_all_actions = new Queue<Function<void()>>;
-    s_background_thread = &Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
-    s_background_thread->start();
+    s_background_threads = new Vector<Threading::Thread*>;
+
+    for (size_t i = 0; i < s_background_thread_count; ++i) {
+        auto& thread = Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
+        thread.start();
+        s_background_threads->append(&thread);
+    }
+}
+
+void Threading::set_background_thread_count(size_t count)
+{
+    VERIFY(count > 0);
+    VERIFY(!s_background_threads);
+    s_background_thread_count = count;
 }
 
 void Threading::quit_background_thread()
 {
-    if (!s_background_thread)
+    if (!s_background_threads)
         return;
 
     s_background_thread_should_run.store(false, AK::MemoryOrder::memory_order_release);
@@ -57,21 +77,24 @@ void Threading::quit_background_thread()
     pthread_cond_broadcast(&s_condition);
     pthread_mutex_unlock(&s_mutex);
 
-    MUST(s_background_thread->join());
+    for (auto* thread : *s_background_threads) {
+        MUST(thread->join());
+        thread->unref();
+    }
 
     delete s_all_actions;
-    s_background_thread->unref();
+    delete s_background_threads;
     s_all_actions = nullptr;
-    s_background_thread = nullptr;
+    s_background_threads = nullptr;
 
     s_background_thread_should_run.store(true, AK::MemoryOrder::memory_order_release);
 }
 
 Threading::Thread& Threading::BackgroundActionBase::background_thread()
 {
-    if (s_background_thread == nullptr)
+    if (s_background_threads == nullptr)
         init();
-    return *s_background_thread;
+    return *s_background_threads->first();
 }
 
 void Threading::BackgroundActionBase::enqueue_work(Function<void()> work)
@@ -123,6 +123,11 @@ private:
     bool m_canceled { false };
 };
 
+// By default, all background actions run on a single thread, in the order they were enqueued. Processes whose actions
+// are independent of each other may instead allow up to this many actions to run concurrently. This must be called
+// before the first action is enqueued.
+void set_background_thread_count(size_t);
+
 void quit_background_thread();
 
 }
@@ -9,6 +9,8 @@
 
 namespace Threading {
 
+class Thread;
+
 template<typename ErrorType>
 class WorkerThread;
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace Threading {
+
+struct CurrentWorker {
+    ThreadPool const* pool { nullptr };
+    size_t index { 0 };
+};
+
+static thread_local CurrentWorker s_current_worker;
+
+ThreadPool& ThreadPool::the()
+{
+    static ThreadPool* s_the = create(max(Core::System::hardware_concurrency(), 1u)).leak_ptr();
+    return *s_the;
+}
+
+NonnullOwnPtr<ThreadPool> ThreadPool::create(size_t worker_count, StringView worker_name)
+{
+    VERIFY(worker_count > 0);
+
+    auto pool = adopt_own(*new ThreadPool);
+    pool->m_workers.ensure_capacity(worker_count);
+
+    for (size_t i = 0; i < worker_count; ++i)
+        pool->m_workers.unchecked_append(make<Worker>());
+
+    for (size_t i = 0; i < worker_count; ++i) {
+        auto& worker = *pool->m_workers[i];
+        worker.thread = Thread::construct([&pool = *pool, i] {
+            pool.run_worker(i);
+            return 0;
+        },
+            worker_name);
+        worker.thread->start();
+    }
+
+    return pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        MutexLocker locker(m_mutex);
+        m_should_exit = true;
+        m_condition.broadcast();
+    }
+
+    for (auto& worker : m_workers)
+        (void)worker->thread->join();
+}
+
+void ThreadPool::submit(Task task, Priority priority)
+{
+    // Tasks submitted from one of our workers go to its own queue. Others are spread across all workers.
+    size_t index = 0;
+    if (s_current_worker.pool == this)
+        index = s_current_worker.index;
+    else
+        index = m_next_worker_index.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) % m_workers.size();
+
+    // NOTE: The count is raised before the task is queued, so that it never drops below the number of queued tasks.
+    //       An idle worker that wakes up in between will find the task once it has been queued.
+    m_queued_task_count.fetch_add(1, AK::MemoryOrder::memory_order_release);
+
+    auto& worker = *m_workers[index];
+    {
+        MutexLocker locker(worker.mutex);
+        worker.queues[to_underlying(priority)].append(move(task));
+    }
+
+    MutexLocker locker(m_mutex);
+    m_condition.signal();
+}
+
+ThreadPool::Task ThreadPool::take_task(Optional<size_t> current_worker_index)
+{
+    for (auto& queue_index : { to_underlying(Priority::High), to_underlying(Priority::Normal) }) {
+        // Run the newest task of our own queue first, as its data is the most likely to still be in our caches.
+        if (current_worker_index.has_value()) {
+            auto& worker = *m_workers[*current_worker_index];
+            MutexLocker locker(worker.mutex);
+
+            if (auto& queue = worker.queues[queue_index]; !queue.is_empty()) {
+                m_queued_task_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+                return queue.take_last();
+            }
+        }
+
+        // Otherwise, steal the oldest task of another worker, as it is the least likely to be in their caches.
+        auto first_index = current_worker_index.value_or(0) + 1;
+        for (size_t i = 0; i < m_workers.size(); ++i) {
+            auto index = (first_index + i) % m_workers.size();
+            if (index == current_worker_index)
+                continue;
+
+            auto& worker = *m_workers[index];
+            MutexLocker locker(worker.mutex);
+
+            if (auto& queue = worker.queues[queue_index]; !queue.is_empty()) {
+                m_queued_task_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+                return queue.take_first();
+            }
+        }
+    }
+
+    return {};
+}
+
+bool ThreadPool::run_queued_task()
+{
+    Optional<size_t> current_worker_index;
+    if (s_current_worker.pool == this)
+        current_worker_index = s_current_worker.index;
+
+    auto task = take_task(current_worker_index);
+    if (!task)
+        return false;
+
+    task();
+    return true;
+}
+
+void ThreadPool::run_worker(size_t index)
+{
+    s_current_worker = { this, index };
+
+    while (true) {
+        if (run_queued_task())
+            continue;
+
+        MutexLocker locker(m_mutex);
+        while (m_queued_task_count.load(AK::MemoryOrder::memory_order_acquire) == 0 && !m_should_exit)
+            m_condition.wait();
+
+        if (m_queued_task_count.load(AK::MemoryOrder::memory_order_acquire) == 0 && m_should_exit)
+            return;
+    }
+}
+
+void ThreadPool::parallel_for(size_t count, Function<void(size_t)> const& callback, Priority priority)
+{
+    if (count == 0)
+        return;
+
+    // Split the indices into a few more chunks than there are threads to run them, so that threads which finish their
+    // chunks early can take over those of slower ones.
+    auto chunk_size = ceil_div(count, (m_workers.size() + 1) * 4);
+    auto chunk_count = ceil_div(count, chunk_size);
+
+    Mutex mutex;
+    ConditionVariable condition { mutex };
+    size_t remaining_chunk_count = chunk_count;
+
+    auto run_chunk = [&](size_t chunk) {
+        auto end = min((chunk + 1) * chunk_size, count);
+        for (auto i = chunk * chunk_size; i < end; ++i)
+            callback(i);
+
+        MutexLocker locker(mutex);
+        if (--remaining_chunk_count == 0)
+            condition.broadcast();
+    };
+
+    for (size_t chunk = 1; chunk < chunk_count; ++chunk)
+        submit([&run_chunk, chunk] { run_chunk(chunk); }, priority);
+
+    run_chunk(0);
+
+    // Rather than blocking right away, help with the queued tasks, which are most likely our own chunks. This also
+    // keeps nested calls from a task from waiting on chunks that no idle worker is left to run.
+    while (true) {
+        {
+            MutexLocker locker(mutex);
+            if (remaining_chunk_count == 0)
+                return;
+        }
+
+        if (!run_queued_task())
+            break;
+    }
+
+    // The remaining chunks are being run by other threads, so wait for them to finish.
+    MutexLocker locker(mutex);
+    while (remaining_chunk_count > 0)
+        condition.wait();
+}
+
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Span.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+// A pool of worker threads for running short, independent tasks in parallel.
+//
+// Each worker has its own queue of tasks for every priority. Tasks submitted from a worker are added to that worker's
+// queue, and the worker runs the newest of them first, as their data is the most likely to still be in its caches.
+// Tasks submitted from other threads are spread across all workers. A worker whose queues are empty steals the oldest
+// task from the queue of another worker. High priority tasks are always taken before normal priority tasks.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    enum class Priority : u8 {
+        High,
+        Normal,
+    };
+
+    using Task = Function<void()>;
+
+    // The pool shared by the whole process, with one worker for every hardware thread.
+    static ThreadPool& the();
+
+    static NonnullOwnPtr<ThreadPool> create(size_t worker_count, StringView worker_name = "Pool Worker"sv);
+
+    // Queued tasks are run before the workers exit.
+    ~ThreadPool();
+
+    size_t worker_count() const { return m_workers.size(); }
+
+    void submit(Task, Priority = Priority::Normal);
+
+    // Runs the task in the pool, then invokes the completion callback with its result on the event loop of the thread
+    // that submitted it.
+    template<typename Callback>
+    void submit(Callback task, ESCAPING Function<void(InvokeResult<Callback>)> on_complete, Priority priority = Priority::Normal)
+    {
+        submit([task = move(task), on_complete = move(on_complete), origin_event_loop = &Core::EventLoop::current()]() mutable {
+            origin_event_loop->deferred_invoke([result = task(), on_complete = move(on_complete)]() mutable {
+                on_complete(move(result));
+            });
+            origin_event_loop->wake();
+        },
+            priority);
+    }
+
+    // Invokes the callback for every index below the count, spread across the workers, and returns once it has been
+    // invoked for all of them. The calling thread runs queued tasks while it waits, so this may be called from a task.
+    void parallel_for(size_t count, Function<void(size_t)> const& callback, Priority = Priority::Normal);
+
+    template<typename T, typename Callback>
+    void parallel_for(Span<T> span, Callback callback, Priority priority = Priority::Normal)
+    {
+        parallel_for(span.size(), [&](size_t index) { callback(span[index]); }, priority);
+    }
+
+private:
+    struct Worker {
+        RefPtr<Thread> thread;
+
+        Mutex mutex;
+        Array<Vector<Task>, 2> queues;
+    };
+
+    ThreadPool() = default;
+
+    void run_worker(size_t index);
+
+    // Takes and runs a queued task, and returns whether there was one.
+    bool run_queued_task();
+
+    Task take_task(Optional<size_t> current_worker_index);
+
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    Atomic<size_t> m_next_worker_index { 0 };
+
+    // Used by idle workers to wait for tasks to be queued.
+    Mutex m_mutex;
+    ConditionVariable m_condition { m_mutex };
+    Atomic<size_t> m_queued_task_count { 0 };
+    bool m_should_exit { false };
+};
+
+}
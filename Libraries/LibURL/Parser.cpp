@@ -718,6 +718,106 @@ static String remove_ascii_tab_or_newline(StringView input)
     return MUST(output.to_string());
 }
 
+// OPTIMIZATION: Most URLs we parse are absolute URLs with a special scheme that are already in their canonical form,
+//               where the basic URL parser would only copy each component into the URL as-is. This parses such URLs by
+//               slicing their components from the input directly, and returns nothing for any URL that it cannot
+//               guarantee to parse the same way as the basic URL parser does. Those go through the basic URL parser.
+Optional<URL> Parser::try_parse_canonical_special_url(StringView input)
+{
+    // Reject anything that could need removing, percent-encoding, percent-decoding or IDNA processing. This also
+    // rejects backslashes, which special URLs treat as slashes.
+    auto is_canonical_code_unit = [](char code_unit) {
+        if (code_unit <= 0x20 || code_unit >= 0x7f)
+            return false;
+        switch (code_unit) {
+        case '"':
+        case '%':
+        case '\'':
+        case '<':
+        case '>':
+        case '\\':
+        case '^':
+        case '`':
+        case '{':
+        case '}':
+            return false;
+        default:
+            return true;
+        }
+    };
+    if (!all_of(input, is_canonical_code_unit))
+        return {};
+
+    // The scheme must be a lowercase special scheme other than "file", followed by "//".
+    auto scheme_end = input.find("://"sv);
+    if (!scheme_end.has_value())
+        return {};
+
+    auto scheme = input.substring_view(0, *scheme_end);
+    if (scheme == "file"sv || !is_special_scheme(scheme))
+        return {};
+
+    auto remaining = input.substring_view(*scheme_end + 3);
+
+    // The authority must consist of a lowercase ASCII domain, optionally followed by a port. It must not contain any
+    // credentials or IPv6 address.
+    auto authority_end = remaining.find_any_of("/?#"sv).value_or(remaining.length());
+    auto authority = remaining.substring_view(0, authority_end);
+    remaining = remaining.substring_view(authority_end);
+
+    auto domain = authority;
+    Optional<u16> port;
+    if (auto port_start = authority.find(':'); port_start.has_value()) {
+        domain = authority.substring_view(0, *port_start);
+
+        auto port_string = authority.substring_view(*port_start + 1);
+        if (port_string.is_empty() || !all_of(port_string, is_ascii_digit))
+            return {};
+
+        port = port_string.to_number<u16>(TrimWhitespace::No);
+        if (!port.has_value())
+            return {};
+        if (port == default_port_for_scheme(scheme))
+            port = {};
+    }
+
+    if (domain.is_empty() || !all_of(domain, [](char code_unit) { return is_ascii_lower_alpha(code_unit) || is_ascii_digit(code_unit) || code_unit == '-' || code_unit == '.' || code_unit == '_'; }))
+        return {};
+    if (domain.starts_with("xn--"sv) || domain.contains(".xn--"sv) || ends_in_a_number_checker(domain))
+        return {};
+
+    URL url;
+    url.m_data->scheme = String::from_utf8_without_validation(scheme.bytes());
+    url.m_data->host = String::from_utf8_without_validation(domain.bytes());
+    url.m_data->port = port;
+
+    // Single-dot and double-dot path segments need the path to be shortened, so they are left to the basic URL parser.
+    auto path_end = remaining.find_any_of("?#"sv).value_or(remaining.length());
+    auto path = remaining.substring_view(0, path_end);
+    remaining = remaining.substring_view(path_end);
+
+    if (path.is_empty()) {
+        url.append_slash();
+    } else {
+        for (auto segment : path.substring_view(1).split_view('/', SplitBehavior::KeepEmpty)) {
+            if (segment == "."sv || segment == ".."sv)
+                return {};
+            url.m_data->paths.append(String::from_utf8_without_validation(segment.bytes()));
+        }
+    }
+
+    if (remaining.starts_with('?')) {
+        auto query_end = remaining.find('#').value_or(remaining.length());
+        url.m_data->query = String::from_utf8_without_validation(remaining.substring_view(1, query_end - 1).bytes());
+        remaining = remaining.substring_view(query_end);
+    }
+
+    if (remaining.starts_with('#'))
+        url.m_data->fragment = String::from_utf8_without_validation(remaining.substring_view(1).bytes());
+
+    return url;
+}
+
 // https://url.spec.whatwg.org/#concept-basic-url-parser
 Optional<URL> Parser::basic_parse(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
 {
@@ -754,6 +854,11 @@ Optional<URL> Parser::basic_parse(StringView raw_input, Optional<URL const&> bas
 
     raw_input = raw_input.substring_view(start_index, end_index - start_index);
 
+    if (url == &url_buffer && !state_override.has_value()) {
+        if (auto canonical_url = try_parse_canonical_special_url(raw_input); canonical_url.has_value())
+            return canonical_url.release_value();
+    }
+
     // NOTE: URL Parsing expects a well formed UTF-8 'scalar' string but we may be passed through a String with lone surrogates.
     auto processed_input = String::from_utf8_with_replacement_character(raw_input, String::WithBOMHandling::No);
 
@@ -12,6 +12,7 @@
 
 #include <unicode/basictz.h>
 #include <unicode/timezone.h>
+#include <unicode/tztrans.h>
 #include <unicode/ucal.h>
 
 namespace Unicode {
@@ -172,6 +173,32 @@ Optional<TimeZoneOffset> time_zone_offset(StringView time_zone, UnixDateTime tim
     };
 }
 
+Optional<TimeZoneOffsetInterval> time_zone_offset_interval(StringView time_zone, UnixDateTime time)
+{
+    auto offset = time_zone_offset(time_zone, time);
+    if (!offset.has_value())
+        return {};
+
+    auto time_zone_data = TimeZoneData::for_time_zone(time_zone);
+    if (!time_zone_data.has_value())
+        return {};
+
+    auto& basic_time_zone = as<icu::BasicTimeZone>(time_zone_data->time_zone());
+    auto icu_time = to_icu_time(time);
+
+    // NOTE: Times which are clamped by to_icu_time() lie beyond the first and last transitions, so they are still
+    //       correctly covered by the interval we find for the clamped time.
+    TimeZoneOffsetInterval interval { .start = UnixDateTime::earliest(), .end = UnixDateTime::latest(), .offset = *offset };
+    icu::TimeZoneTransition transition;
+
+    if (basic_time_zone.getPreviousTransition(icu_time, true, transition))
+        interval.start = UnixDateTime::from_milliseconds_since_epoch(static_cast<i64>(transition.getTime()));
+    if (basic_time_zone.getNextTransition(icu_time, false, transition))
+        interval.end = UnixDateTime::from_milliseconds_since_epoch(static_cast<i64>(transition.getTime()));
+
+    return interval;
+}
+
 Vector<TimeZoneOffset> disambiguated_time_zone_offsets(StringView time_zone, UnixDateTime time)
 {
     UErrorCode status = U_ZERO_ERROR;
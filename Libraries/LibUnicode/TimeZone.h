@@ -24,6 +24,13 @@ struct TimeZoneOffset {
     InDST in_dst { InDST::No };
 };
 
+// The range of time, from start (inclusive) to end (exclusive), during which a time zone has the same offset.
+struct TimeZoneOffsetInterval {
+    UnixDateTime start;
+    UnixDateTime end;
+    TimeZoneOffset offset;
+};
+
 String current_time_zone();
 ErrorOr<void> set_current_time_zone(StringView);
 void clear_system_time_zone_cache();
@@ -31,6 +38,7 @@ Vector<String> const& available_time_zones();
 Vector<String> available_time_zones_in_region(StringView region);
 Optional<String> resolve_primary_time_zone(StringView time_zone);
 Optional<TimeZoneOffset> time_zone_offset(StringView time_zone, UnixDateTime time);
+Optional<TimeZoneOffsetInterval> time_zone_offset_interval(StringView time_zone, UnixDateTime time);
 Vector<TimeZoneOffset> disambiguated_time_zone_offsets(StringView time_zone, UnixDateTime time);
 
 }
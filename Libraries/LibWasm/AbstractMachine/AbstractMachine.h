@@ -571,6 +571,8 @@ public:
     DataInstance* get(DataAddress);
     ElementInstance* get(ElementAddress);
 
+    Vector<MemoryInstance> const& memories() const { return m_memories; }
+
 private:
     Vector<FunctionInstance> m_functions;
     Vector<TableInstance> m_tables;
@@ -64,6 +64,9 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
 {
     m_trap = Empty {};
     auto& expression = configuration.frame().expression();
+    if (configuration.ip() == 0)
+        expression.compile_instructions_if_needed();
+
     auto const should_limit_instruction_count = configuration.should_limit_instruction_count();
     if (!expression.compiled_instructions.dispatches.is_empty()) {
         if (should_limit_instruction_count)
@@ -2240,7 +2243,7 @@ bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instructio
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
-    auto slice = memory->data().bytes().slice(instance_address, sizeof(ReadType));
+    auto slice = ReadonlyBytes { memory->data().data() + instance_address, sizeof(ReadType) };
     entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
     return false;
 }
@@ -2266,7 +2269,7 @@ bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instru
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M * N / 8);
+    auto slice = ReadonlyBytes { memory->data().data() + instance_address, M * N / 8 };
     using V64 = NativeVectorType<M, N, SetSign>;
     using V128 = NativeVectorType<M * 2, N, SetSign>;
 
@@ -2294,7 +2297,7 @@ bool BytecodeInterpreter::load_and_push_lane_n(Configuration& configuration, Ins
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
+    auto slice = ReadonlyBytes { memory->data().data() + instance_address, N / 8 };
     auto dst = bit_cast<u8*>(&vector) + memarg_and_lane.lane * N / 8;
     memcpy(dst, slice.data(), N / 8);
     configuration.push_to_destination(Value(vector));
@@ -2314,7 +2317,7 @@ bool BytecodeInterpreter::load_and_push_zero_n(Configuration& configuration, Ins
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
+    auto slice = ReadonlyBytes { memory->data().data() + instance_address, N / 8 };
     u128 vector = 0;
     memcpy(&vector, slice.data(), N / 8);
     configuration.push_to_destination(Value(vector));
@@ -2336,7 +2339,7 @@ bool BytecodeInterpreter::load_and_push_m_splat(Configuration& configuration, In
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-splat({} : {}) -> stack", instance_address, M / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M / 8);
+    auto slice = ReadonlyBytes { memory->data().data() + instance_address, M / 8 };
     auto value = read_value<NativeIntegralType<M>>(slice);
     set_top_m_splat<M, NativeIntegralType>(configuration, value);
     return false;
@@ -2499,15 +2502,15 @@ bool BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruct
     auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
     auto memory = configuration.store().get(address);
     u64 instance_address = static_cast<u64>(base) + arg.offset;
-    Checked addition { instance_address };
-    addition += data.size();
-    if (addition.has_overflow() || addition.value() > memory->size()) {
+    // NOTE: Both the base and the offset are 32-bit, so this can't overflow.
+    if (instance_address + data.size() > memory->size()) {
         m_trap = Trap::from_string("Memory access out of bounds");
         dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected 0 <= {} and {} <= {})", instance_address, instance_address + data.size(), memory->size());
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "temporary({}b) -> store({})", data.size(), instance_address);
-    data.copy_to(memory->data().bytes().slice(instance_address, data.size()));
+    // NOTE: The access has been bounds checked above, so there's no need to go through a checked slice here.
+    __builtin_memcpy(memory->data().data() + instance_address, data.data(), data.size());
     return false;
 }
 
@@ -2535,7 +2538,17 @@ double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
     return bit_cast<double>(read_value<u64>(data));
 }
 
-CompiledInstructions try_compile_instructions(Expression const& expression, Span<FunctionType const>)
+void Expression::compile_instructions_if_needed() const
+{
+    if (m_has_compiled_instructions)
+        return;
+    m_has_compiled_instructions = true;
+
+    // The expression has been validated at this point, so try to compile it down to a list of labels to help dispatch.
+    compiled_instructions = try_compile_instructions(*this);
+}
+
+CompiledInstructions try_compile_instructions(Expression const& expression)
 {
     CompiledInstructions result;
     result.dispatches.ensure_capacity(expression.instructions().size());
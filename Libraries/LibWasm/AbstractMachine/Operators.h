@@ -51,6 +51,14 @@ DEFINE_BINARY_OPERATOR(BitXor, ^);
 
 #undef DEFINE_BINARY_OPERATOR
 
+// NOTE: These operators act lane-wise when applied to whole vector values, which lets the compiler
+//       lower them to a single native SIMD instruction instead of a loop over the lanes.
+template<typename Op>
+constexpr bool is_lane_wise_arithmetic_operator = IsOneOf<Op, Add, Subtract, Multiply>;
+
+template<typename Op>
+constexpr bool is_lane_wise_comparison_operator = IsOneOf<Op, Equals, NotEquals, GreaterThan, LessThan, LessThanOrEquals, GreaterThanOrEquals>;
+
 struct Divide {
     template<typename Lhs, typename Rhs>
     auto operator()(Lhs lhs, Rhs rhs) const
@@ -336,6 +344,11 @@ struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
         using ElementType = NativeIntegralType<128 / VectorSize>;
+        if constexpr (is_lane_wise_comparison_operator<Op>) {
+            // Vector comparisons produce all-ones lanes for true and all-zeroes lanes for false, just like Wasm.
+            using VectorType = Native128ByteVectorOf<SetSign<ElementType>, SetSign>;
+            return bit_cast<u128>(Op {}(bit_cast<VectorType>(c1), bit_cast<VectorType>(c2)));
+        }
         auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
         auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
         Op op;
@@ -370,6 +383,8 @@ struct VectorFloatCmpOp {
     {
         auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
         auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
+        if constexpr (is_lane_wise_comparison_operator<Op>)
+            return bit_cast<u128>(Op {}(first, other));
         using ElementType = NativeIntegralType<128 / VectorSize>;
         Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
@@ -689,6 +704,12 @@ template<size_t VectorSize, typename Op, template<typename> typename SetSign = M
 struct VectorIntegerBinaryOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
+        if constexpr (is_lane_wise_arithmetic_operator<Op>) {
+            // NOTE: Wasm integer arithmetic wraps, so do it on unsigned lanes to stay clear of signed overflow.
+            using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            return bit_cast<u128>(Op {}(bit_cast<UnsignedVectorType>(lhs), bit_cast<UnsignedVectorType>(rhs)));
+        }
+
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
@@ -834,6 +855,10 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
+        if constexpr (IsSame<Op, Divide>)
+            return bit_cast<u128>(first / second);
+        else if constexpr (is_lane_wise_arithmetic_operator<Op>)
+            return bit_cast<u128>(Op {}(first, second));
         VectorType result;
         Op op;
         for (size_t i = 0; i < VectorSize; ++i) {
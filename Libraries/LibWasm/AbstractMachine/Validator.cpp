@@ -3738,9 +3738,6 @@ ErrorOr<Validator::ExpressionTypeResult, ValidationError> Validator::validate(Ex
 
     expression.set_stack_usage_hint(stack.max_known_size());
 
-    // Now that we're in happy land, try to compile the expression down to a list of labels to help dispatch.
-    expression.compiled_instructions = try_compile_instructions(expression, m_context.functions.span());
-
     return ExpressionTypeResult { stack.release_vector(), is_constant_expression };
 }
 
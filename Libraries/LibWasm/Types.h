@@ -757,11 +757,16 @@ public:
 
     void set_stack_usage_hint(size_t value) const { m_stack_usage_hint = value; }
     auto stack_usage_hint() const { return m_stack_usage_hint; }
+
+    // NOTE: Expressions are only compiled down to register-allocated dispatches right before they first run, so that
+    //       large modules don't pay for the functions they never call.
+    void compile_instructions_if_needed() const;
     mutable CompiledInstructions compiled_instructions;
 
 private:
     Vector<Instruction> m_instructions;
     mutable Optional<size_t> m_stack_usage_hint;
+    mutable bool m_has_compiled_instructions { false };
 };
 
 class GlobalSection {
@@ -1104,6 +1109,6 @@ private:
     Optional<ByteString> m_validation_error;
 };
 
-CompiledInstructions try_compile_instructions(Expression const&, Span<FunctionType const> functions);
+CompiledInstructions try_compile_instructions(Expression const&);
 
 }
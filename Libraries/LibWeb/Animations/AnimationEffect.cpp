@@ -634,20 +634,14 @@ void AnimationEffect::visit_edges(JS::Cell::Visitor& visitor)
 static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& new_properties)
 {
     CSS::RequiredInvalidationAfterStyleChange invalidation;
-    auto old_and_new_properties = MUST(Bitmap::create(to_underlying(CSS::last_property_id) + 1, 0));
-    for (auto const& [property_id, _] : old_properties)
-        old_and_new_properties.set(to_underlying(property_id), 1);
-    for (auto const& [property_id, _] : new_properties)
-        old_and_new_properties.set(to_underlying(property_id), 1);
-    for (auto i = to_underlying(CSS::first_property_id); i <= to_underlying(CSS::last_property_id); ++i) {
-        if (!old_and_new_properties.get(i))
-            continue;
-        auto property_id = static_cast<CSS::PropertyID>(i);
-        auto const* old_value = old_properties.get(property_id).value_or({});
+    // NOTE: This only visits the animated properties themselves, as this runs for every animated element on every frame.
+    for (auto const& [property_id, old_value] : old_properties) {
         auto const* new_value = new_properties.get(property_id).value_or({});
-        if (!old_value && !new_value)
-            continue;
-        invalidation |= compute_property_invalidation(property_id, old_value, new_value);
+        invalidation |= compute_property_invalidation(property_id, old_value.ptr(), new_value);
+    }
+    for (auto const& [property_id, new_value] : new_properties) {
+        if (!old_properties.contains(property_id))
+            invalidation |= compute_property_invalidation(property_id, nullptr, new_value.ptr());
     }
     return invalidation;
 }
@@ -697,7 +691,15 @@ AnimationUpdateContext::~AnimationUpdateContext()
         }
         if (invalidation.repaint) {
             element.document().set_needs_display();
-            element.document().set_needs_to_resolve_paint_only_properties();
+
+            // OPTIMIZATION: Animations of properties like transform and opacity only affect the paint-only properties of
+            //               the animated subtree, so avoid resolving them for the whole document on every frame. A layout
+            //               update resolves them for the whole document anyway.
+            // NOTE: Paintables of ::backdrop are generated outside of the originating element's layout subtree.
+            if (invalidation.relayout || invalidation.rebuild_layout_tree || element.pseudo_element() == CSS::PseudoElement::Backdrop)
+                element.document().set_needs_to_resolve_paint_only_properties();
+            else
+                element.document().set_needs_to_resolve_paint_only_properties_of_subtree(target);
         }
         if (invalidation.rebuild_stacking_context_tree)
             element.document().invalidate_stacking_context_tree();
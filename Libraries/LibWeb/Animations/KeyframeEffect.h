@@ -11,6 +11,8 @@
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Bindings/KeyframeEffectPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/CSS/Enums.h>
+#include <LibWeb/CSS/Length.h>
 #include <LibWeb/CSS/PropertyID.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleValues/StyleValue.h>
@@ -72,6 +74,24 @@ public:
     };
     static void generate_initial_and_final_frames(RefPtr<KeyFrameSet>, HashTable<CSS::PropertyID> const& animated_properties);
 
+    // OPTIMIZATION: When an animation is refreshed, the computed values of the two keyframes it is between only depend on
+    //               the keyframes, the fonts of the target and the root element, the viewport, and the writing mode of
+    //               the target (unless the keyframes contain values that depend on the target's style, which we don't
+    //               cache). So we keep them while the animation progresses between the same keyframes.
+    struct ComputedKeyframeValues {
+        RefPtr<KeyFrameSet const> key_frame_set;
+        u64 start_key { 0 };
+        u64 end_key { 0 };
+        CSS::Length::FontMetrics font_metrics;
+        CSS::Length::FontMetrics root_font_metrics;
+        CSSPixelRect viewport_rect;
+        CSS::WritingMode writing_mode;
+        CSS::Direction direction;
+
+        HashMap<CSS::PropertyID, RefPtr<CSS::StyleValue const>> start_values;
+        HashMap<CSS::PropertyID, RefPtr<CSS::StyleValue const>> end_values;
+    };
+
     static int composite_order(GC::Ref<KeyframeEffect>, GC::Ref<KeyframeEffect>);
 
     static GC::Ref<KeyframeEffect> create(JS::Realm&);
@@ -107,6 +127,8 @@ public:
 
     virtual void update_computed_properties(AnimationUpdateContext&) override;
 
+    Optional<ComputedKeyframeValues>& cached_computed_keyframe_values(Badge<CSS::StyleComputer>) { return m_cached_computed_keyframe_values; }
+
     Optional<CSS::AnimationPlayState> last_css_animation_play_state() const { return m_last_css_animation_play_state; }
     void set_last_css_animation_play_state(CSS::AnimationPlayState state) { m_last_css_animation_play_state = state; }
 
@@ -134,6 +156,8 @@ private:
 
     RefPtr<KeyFrameSet const> m_key_frame_set {};
 
+    Optional<ComputedKeyframeValues> m_cached_computed_keyframe_values;
+
     Optional<CSS::AnimationPlayState> m_last_css_animation_play_state;
 };
 
@@ -48,6 +48,24 @@ ComputedProperties::ComputedProperties() = default;
 
 ComputedProperties::~ComputedProperties() = default;
 
+GC::Ref<ComputedProperties> ComputedProperties::clone(GC::Heap& heap) const
+{
+    auto clone = heap.allocate<ComputedProperties>();
+    clone->m_animation_name_source = m_animation_name_source;
+    clone->m_transition_property_source = m_transition_property_source;
+    clone->m_property_values = m_property_values;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_first_available_computed_font = m_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_font_size = m_font_size;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
 void ComputedProperties::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -55,6 +73,58 @@ void ComputedProperties::visit_edges(Visitor& visitor)
     visitor.visit(m_transition_property_source);
 }
 
+RefPtr<StyleValue const> const& ComputedProperties::property_slot(PropertyID property_id) const
+{
+    static RefPtr<StyleValue const> const s_no_value;
+
+    auto [group, index] = property_location(property_id);
+    auto const& values = m_property_values[to_underlying(group)];
+    if (!values)
+        return s_no_value;
+    return values->values[index];
+}
+
+RefPtr<StyleValue const>& ComputedProperties::mutable_property_slot(PropertyID property_id)
+{
+    auto [group, index] = property_location(property_id);
+    auto& values = m_property_values[to_underlying(group)];
+    if (!values) {
+        Vector<RefPtr<StyleValue const>> new_values;
+        new_values.resize(property_group_size(group));
+        values = adopt_ref(*new PropertyValues(move(new_values)));
+    } else if (values->ref_count() > 1) {
+        values = adopt_ref(*new PropertyValues(values->values));
+    }
+    return values->values[index];
+}
+
+bool ComputedProperties::PropertyValues::has_identical_values(PropertyValues const& other) const
+{
+    VERIFY(values.size() == other.values.size());
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto const& value = values[i];
+        auto const& other_value = other.values[i];
+        if (value == other_value)
+            continue;
+        if (!value || !other_value || *value != *other_value)
+            return false;
+    }
+    return true;
+}
+
+void ComputedProperties::share_property_values_if_identical(ComputedProperties const& other)
+{
+    for (size_t group = 0; group < number_of_property_groups; ++group) {
+        auto& values = m_property_values[group];
+        auto const& other_values = other.m_property_values[group];
+        if (!values || !other_values || values == other_values)
+            continue;
+        if (values->has_identical_values(*other_values))
+            values = other_values;
+    }
+}
+
 bool ComputedProperties::is_property_important(PropertyID property_id) const
 {
     size_t n = to_underlying(property_id);
@@ -87,14 +157,14 @@ void ComputedProperties::set_property_inherited(PropertyID property_id, Inherite
 
 void ComputedProperties::set_property(PropertyID id, NonnullRefPtr<StyleValue const> value, Inherited inherited, Important important)
 {
-    m_property_values[to_underlying(id)] = move(value);
+    mutable_property_slot(id) = move(value);
     set_property_important(id, important);
     set_property_inherited(id, inherited);
 }
 
 void ComputedProperties::revert_property(PropertyID id, ComputedProperties const& style_for_revert)
 {
-    m_property_values[to_underlying(id)] = style_for_revert.m_property_values[to_underlying(id)];
+    mutable_property_slot(id) = style_for_revert.property_slot(id);
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -117,14 +187,14 @@ StyleValue const& ComputedProperties::property(PropertyID property_id, WithAnima
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id)];
+    return *property_slot(property_id);
 }
 
 StyleValue const* ComputedProperties::maybe_null_property(PropertyID property_id) const
 {
     if (auto animated_value = m_animated_property_values.get(property_id); animated_value.has_value())
         return animated_value.value();
-    return m_property_values[to_underlying(property_id)];
+    return property_slot(property_id);
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -760,12 +830,9 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    if (m_property_values.size() != other.m_property_values.size())
-        return false;
-
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    for (size_t i = 0; i < number_of_properties; ++i) {
+        auto const& my_style = property_slot(static_cast<PropertyID>(i));
+        auto const& other_style = other.property_slot(static_cast<PropertyID>(i));
         if (!my_style) {
             if (other_style)
                 return false;
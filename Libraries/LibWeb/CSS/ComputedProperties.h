@@ -9,6 +9,8 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -34,12 +36,14 @@ public:
 
     virtual ~ComputedProperties() override;
 
+    [[nodiscard]] GC::Ref<ComputedProperties> clone(GC::Heap&) const;
+
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback((PropertyID)i, *m_property_values[i]);
+        for (size_t i = 0; i < number_of_properties; ++i) {
+            if (auto const& value = property_slot(static_cast<PropertyID>(i)))
+                callback(static_cast<PropertyID>(i), *value);
         }
     }
 
@@ -66,6 +70,9 @@ public:
     StyleValue const* maybe_null_property(PropertyID) const;
     void revert_property(PropertyID, ComputedProperties const& style_for_revert);
 
+    // Makes us share the property values of the given style, for each group of properties whose values are identical.
+    void share_property_values_if_identical(ComputedProperties const&);
+
     GC::Ptr<CSSStyleDeclaration const> animation_name_source() const { return m_animation_name_source; }
     void set_animation_name_source(GC::Ptr<CSSStyleDeclaration const> declaration) { m_animation_name_source = declaration; }
 
@@ -260,10 +267,65 @@ private:
     Overflow overflow(PropertyID) const;
     Vector<ShadowData> shadow(PropertyID, Layout::Node const&) const;
 
+    // Our property values are stored in groups that follow the order of property IDs: shorthands (which are only
+    // stored in resolved values), inherited longhands and non-inherited longhands. Groups are shared by reference
+    // between styles with identical values, such as between an element and its parent for inherited properties, and are
+    // copied before being written to while they are shared. A group without any values set is not allocated at all.
+    enum class PropertyGroup : u8 {
+        Shorthands,
+        InheritedLonghands,
+        NonInheritedLonghands,
+    };
+    static constexpr size_t number_of_property_groups = 3;
+
+    static_assert(first_inherited_longhand_property_id == first_longhand_property_id);
+    static_assert(last_longhand_property_id == last_property_id);
+
+    struct PropertyLocation {
+        PropertyGroup group;
+        size_t index;
+    };
+
+    static constexpr PropertyLocation property_location(PropertyID property_id)
+    {
+        if (property_id < first_longhand_property_id)
+            return { PropertyGroup::Shorthands, to_underlying(property_id) };
+        if (property_id <= last_inherited_longhand_property_id)
+            return { PropertyGroup::InheritedLonghands, static_cast<size_t>(to_underlying(property_id) - to_underlying(first_inherited_longhand_property_id)) };
+        return { PropertyGroup::NonInheritedLonghands, static_cast<size_t>(to_underlying(property_id) - to_underlying(last_inherited_longhand_property_id) - 1) };
+    }
+
+    static constexpr size_t property_group_size(PropertyGroup group)
+    {
+        switch (group) {
+        case PropertyGroup::Shorthands:
+            return to_underlying(first_longhand_property_id);
+        case PropertyGroup::InheritedLonghands:
+            return to_underlying(last_inherited_longhand_property_id) - to_underlying(first_inherited_longhand_property_id) + 1;
+        case PropertyGroup::NonInheritedLonghands:
+            return to_underlying(last_longhand_property_id) - to_underlying(last_inherited_longhand_property_id);
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    struct PropertyValues : public RefCounted<PropertyValues> {
+        explicit PropertyValues(Vector<RefPtr<StyleValue const>> values)
+            : values(move(values))
+        {
+        }
+
+        bool has_identical_values(PropertyValues const&) const;
+
+        Vector<RefPtr<StyleValue const>> values;
+    };
+
+    RefPtr<StyleValue const> const& property_slot(PropertyID) const;
+    RefPtr<StyleValue const>& mutable_property_slot(PropertyID);
+
     GC::Ptr<CSSStyleDeclaration const> m_animation_name_source;
     GC::Ptr<CSSStyleDeclaration const> m_transition_property_source;
 
-    Array<RefPtr<StyleValue const>, number_of_properties> m_property_values;
+    Array<RefPtr<PropertyValues>, number_of_property_groups> m_property_values;
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_inherited {};
 
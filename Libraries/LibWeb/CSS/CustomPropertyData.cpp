@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/CSS/CustomPropertyData.h>
+#include <LibWeb/CSS/StyleValues/StyleValue.h>
+
+namespace Web::CSS {
+
+RefPtr<CustomPropertyData const> CustomPropertyData::create(HashMap<FlyString, StyleProperty> values)
+{
+    if (values.is_empty())
+        return nullptr;
+    return adopt_ref(*new CustomPropertyData(move(values)));
+}
+
+HashMap<FlyString, StyleProperty> const& CustomPropertyData::empty_values()
+{
+    static HashMap<FlyString, StyleProperty> const s_empty_values;
+    return s_empty_values;
+}
+
+bool CustomPropertyData::equals(CustomPropertyData const* a, CustomPropertyData const* b)
+{
+    if (a == b)
+        return true;
+    if (!a || !b)
+        return false;
+    return a->m_values == b->m_values;
+}
+
+}
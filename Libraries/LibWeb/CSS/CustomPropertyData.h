@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <LibWeb/CSS/StyleProperty.h>
+
+namespace Web::CSS {
+
+// The custom properties specified for an element. These are immutable, so elements with the same custom properties
+// (like siblings sharing their style) share them by reference, and they are only copied when an element's values differ.
+class CustomPropertyData : public RefCounted<CustomPropertyData> {
+public:
+    // NOTE: Elements without any custom properties don't store any CustomPropertyData, so this returns null for them.
+    static RefPtr<CustomPropertyData const> create(HashMap<FlyString, StyleProperty>);
+
+    static HashMap<FlyString, StyleProperty> const& empty_values();
+    static bool equals(CustomPropertyData const*, CustomPropertyData const*);
+
+    HashMap<FlyString, StyleProperty> const& values() const { return m_values; }
+
+private:
+    explicit CustomPropertyData(HashMap<FlyString, StyleProperty> values)
+        : m_values(move(values))
+    {
+    }
+
+    HashMap<FlyString, StyleProperty> m_values;
+};
+
+}
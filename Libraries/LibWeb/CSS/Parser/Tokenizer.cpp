@@ -165,9 +165,15 @@ Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
         auto decoded_input = MUST(decoder->to_utf8(input));
 
         // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering
+        // NOTE: This scans the UTF-8 bytes directly, as every filterable code point is either a single ASCII byte, or a
+        //       surrogate, whose encoding starts with 0xED followed by a byte of 0xA0 or above.
         bool const contains_filterable = [&] {
-            for (auto code_point : decoded_input.code_points()) {
-                if (code_point == '\r' || code_point == '\f' || code_point == 0x00 || is_unicode_surrogate(code_point))
+            auto bytes = decoded_input.bytes();
+            for (size_t i = 0; i < bytes.size(); ++i) {
+                auto byte = bytes[i];
+                if (byte == '\r' || byte == '\f' || byte == 0x00)
+                    return true;
+                if (byte == 0xED && i + 1 < bytes.size() && bytes[i + 1] >= 0xA0)
                     return true;
             }
             return false;
@@ -232,9 +238,11 @@ Vector<Token> Tokenizer::tokenize()
         auto token_start = m_position;
         auto token = consume_a_token();
         token.set_position_range({}, token_start, m_position);
-        tokens.append(token);
 
-        if (token.is(Token::Type::EndOfFile)) {
+        auto is_end_of_file = token.is(Token::Type::EndOfFile);
+        tokens.append(move(token));
+
+        if (is_end_of_file) {
             return tokens;
         }
     }
@@ -79,10 +79,12 @@
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/HTML/HTMLBRElement.h>
 #include <LibWeb/HTML/HTMLHtmlElement.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/TagNames.h>
 #include <LibWeb/Layout/Node.h>
 #include <LibWeb/MimeSniff/MimeType.h>
 #include <LibWeb/MimeSniff/Resource.h>
@@ -180,7 +182,94 @@ OwnFontFaceKey::operator FontFaceKey() const
         && slope == other.slope;
 }
 
-static DOM::Element const* element_to_inherit_style_from(DOM::Element const*, Optional<CSS::PseudoElement>);
+static static constexpr size_t maximum_matched_properties_cache_size = 1024;
+
+bool StyleComputer::MatchedPropertiesCacheKey::operator==(MatchedPropertiesCacheKey const& other) const
+{
+    return rules == other.rules
+        && logical_alias_mapping_context.writing_mode == other.logical_alias_mapping_context.writing_mode
+        && logical_alias_mapping_context.direction == other.logical_alias_mapping_context.direction;
+}
+
+unsigned StyleComputer::MatchedPropertiesCacheKeyTraits::hash(MatchedPropertiesCacheKey const& key)
+{
+    auto hash = pair_int_hash(to_underlying(key.logical_alias_mapping_context.writing_mode), to_underlying(key.logical_alias_mapping_context.direction));
+    for (auto const* rule : key.rules)
+        hash = pair_int_hash(hash, ptr_hash(rule));
+    return hash;
+}
+
+static bool has_unresolved_values(Vector<MatchingRule const*> const& rules)
+{
+    for (auto const* rule : rules) {
+        for (auto const& property : rule->declaration().properties()) {
+            if (property.value->is_unresolved() || property.value->is_pending_substitution())
+                return true;
+        }
+    }
+    return false;
+}
+
+static bool cascade_depends_on_element(DOM::Element const& element)
+{
+    // Inline style is cascaded along with the author rules.
+    if (element.inline_style() || element.has_attribute(HTML::AttributeNames::style))
+        return true;
+
+    // SVG presentation attributes may contain custom properties, and are resolved against the element.
+    if (!element.is_html_element())
+        return true;
+
+    // The presentational hints of these elements are not only derived from their own attributes.
+    if (element.local_name().is_one_of(HTML::TagNames::body, HTML::TagNames::td, HTML::TagNames::th))
+        return true;
+
+    if (element.supports_dimension_attributes()
+        && (element.has_attribute(HTML::AttributeNames::width) || element.has_attribute(HTML::AttributeNames::height)))
+        return true;
+
+    bool has_presentational_hints = false;
+    element.for_each_attribute([&](auto const& name, auto const&) {
+        if (element.is_presentational_hint(name))
+            has_presentational_hints = true;
+    });
+    return has_presentational_hints;
+}
+
+// OPTIMIZATION: Elements that match the exact same rules usually end up with the exact same cascaded values, so we
+//               cache those by the list of matched rules and skip the cascade when we've seen the list before.
+GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values_using_matched_properties_cache(DOM::Element& element, MatchingRuleSet const& matching_rule_set, LogicalAliasMappingContext logical_alias_mapping_context) const
+{
+    auto compute_uncached = [&] {
+        return compute_cascaded_values(element, {}, false, ComputeStyleMode::Normal, matching_rule_set, logical_alias_mapping_context, {});
+    };
+
+    if (cascade_depends_on_element(element))
+        return compute_uncached();
+
+    MatchedPropertiesCacheKey key { {}, logical_alias_mapping_context };
+    auto append_rules = [&](Vector<MatchingRule const*> const& rules) {
+        key.rules.extend(rules);
+        return !has_unresolved_values(rules);
+    };
+    if (!append_rules(matching_rule_set.user_agent_rules) || !append_rules(matching_rule_set.user_rules))
+        return compute_uncached();
+    for (auto const& layer : matching_rule_set.author_rules) {
+        if (!append_rules(layer.rules))
+            return compute_uncached();
+    }
+
+    if (auto cached_properties = m_matched_properties_cache.get(key); cached_properties.has_value())
+        return *cached_properties;
+
+    auto cascaded_properties = compute_uncached();
+    if (m_matched_properties_cache.size() >= maximum_matched_properties_cache_size)
+        m_matched_properties_cache.clear();
+    m_matched_properties_cache.set(move(key), cascaded_properties);
+    return cascaded_properties;
+}
+
+DOM::Element const* element_to_inherit_style_from(DOM::Element const*, Optional<CSS::PseudoElement>);
 
 StyleComputer::StyleComputer(DOM::Document& document)
     : m_document(document)
@@ -199,6 +288,8 @@ void StyleComputer::visit_edges(Visitor& visitor)
     visitor.visit(m_document);
     visitor.visit(m_loaded_fonts);
     visitor.visit(m_user_style_sheet);
+    for (auto& it : m_matched_properties_cache)
+        visitor.visit(it.value);
 }
 
 FontLoader::FontLoader(StyleComputer& style_computer, GC::Ptr<CSSStyleSheet> parent_style_sheet, FlyString family_name, Vector<Gfx::UnicodeRange> unicode_ranges, Vector<URL> urls, Function<void(RefPtr<Gfx::Typeface const>)> on_load)
@@ -1040,12 +1131,12 @@ void StyleComputer::collect_animation_into(DOM::Element& element, Optional<CSS::
         return potential_match;
     }();
     auto keyframe_start = static_cast<i64>(keyframe_start_it.key());
-    auto keyframe_values = *keyframe_start_it;
+    auto const& keyframe_values = *keyframe_start_it;
 
     auto keyframe_end_it = ++keyframe_start_it;
     VERIFY(!keyframe_end_it.is_end());
     auto keyframe_end = static_cast<i64>(keyframe_end_it.key());
-    auto keyframe_end_values = *keyframe_end_it;
+    auto const& keyframe_end_values = *keyframe_end_it;
 
     auto progress_in_keyframe
         = static_cast<float>(key - keyframe_start) / static_cast<float>(keyframe_end - keyframe_start);
@@ -1056,7 +1147,14 @@ void StyleComputer::collect_animation_into(DOM::Element& element, Optional<CSS::
     }
 
     // FIXME: Follow https://drafts.csswg.org/web-animations-1/#ref-for-computed-keyframes in whatever the right place is.
-    auto compute_keyframe_values = [refresh, &computed_properties, &element, &pseudo_element, this](auto const& keyframe_values) {
+    compute_font(computed_properties, &element, pseudo_element);
+    absolutize_values(computed_properties, element);
+    Length::FontMetrics font_metrics {
+        computed_properties.font_size(),
+        computed_properties.first_available_computed_font().pixel_metrics()
+    };
+
+    auto compute_keyframe_values = [refresh, &computed_properties, &element, &pseudo_element, &font_metrics, this](auto const& keyframe_values) {
         HashMap<PropertyID, RefPtr<StyleValue const>> result;
         HashMap<PropertyID, PropertyID> longhands_set_by_property_id;
         auto property_is_set_by_use_initial = MUST(Bitmap::create(to_underlying(last_longhand_property_id) - to_underlying(first_longhand_property_id) + 1, false));
@@ -1098,12 +1196,6 @@ void StyleComputer::collect_animation_into(DOM::Element& element, Optional<CSS::
             return camel_case_string_from_property_id(a) < camel_case_string_from_property_id(b);
         };
 
-        compute_font(computed_properties, &element, pseudo_element);
-        absolutize_values(computed_properties, element);
-        Length::FontMetrics font_metrics {
-            computed_properties.font_size(),
-            computed_properties.first_available_computed_font().pixel_metrics()
-        };
         for (auto const& [property_id, value] : keyframe_values.properties) {
             bool is_use_initial = false;
 
@@ -1154,8 +1246,51 @@ void StyleComputer::collect_animation_into(DOM::Element& element, Optional<CSS::
         }
         return result;
     };
-    HashMap<PropertyID, RefPtr<StyleValue const>> computed_start_values = compute_keyframe_values(keyframe_values);
-    HashMap<PropertyID, RefPtr<StyleValue const>> computed_end_values = compute_keyframe_values(keyframe_end_values);
+    // Values that are resolved against the target's style can't be cached, as the style may change between refreshes.
+    auto keyframe_depends_on_target_style = [](auto const& keyframe_values) {
+        for (auto const& [property_id, value] : keyframe_values.properties) {
+            auto const* style_value = value.template get_pointer<NonnullRefPtr<StyleValue const>>();
+            if (style_value && ((*style_value)->is_revert() || (*style_value)->is_revert_layer() || (*style_value)->is_unresolved()))
+                return true;
+        }
+        return false;
+    };
+
+    auto& cached_values = effect->cached_computed_keyframe_values({});
+    auto is_cached_value_usable = [&] {
+        return cached_values.has_value()
+            && cached_values->key_frame_set == effect->key_frame_set()
+            && cached_values->start_key == static_cast<u64>(keyframe_start)
+            && cached_values->end_key == static_cast<u64>(keyframe_end)
+            && cached_values->font_metrics == font_metrics
+            && cached_values->root_font_metrics == m_root_element_font_metrics
+            && cached_values->viewport_rect == viewport_rect()
+            && cached_values->writing_mode == computed_properties.writing_mode()
+            && cached_values->direction == computed_properties.direction();
+    };
+
+    if (refresh == AnimationRefresh::No || !is_cached_value_usable()) {
+        auto start_values = compute_keyframe_values(keyframe_values);
+        auto end_values = compute_keyframe_values(keyframe_end_values);
+
+        // NOTE: Values that can't be cached are stored without a keyframe set, so they are never reused.
+        auto is_cacheable = refresh == AnimationRefresh::Yes && !keyframe_depends_on_target_style(keyframe_values) && !keyframe_depends_on_target_style(keyframe_end_values);
+        cached_values = Animations::KeyframeEffect::ComputedKeyframeValues {
+            .key_frame_set = is_cacheable ? effect->key_frame_set() : nullptr,
+            .start_key = static_cast<u64>(keyframe_start),
+            .end_key = static_cast<u64>(keyframe_end),
+            .font_metrics = font_metrics,
+            .root_font_metrics = m_root_element_font_metrics,
+            .viewport_rect = viewport_rect(),
+            .writing_mode = computed_properties.writing_mode(),
+            .direction = computed_properties.direction(),
+            .start_values = move(start_values),
+            .end_values = move(end_values),
+        };
+    }
+
+    auto const& computed_start_values = cached_values->start_values;
+    auto const& computed_end_values = cached_values->end_values;
 
     for (auto const& it : computed_start_values) {
         auto resolved_start_property = it.value;
@@ -1688,7 +1823,7 @@ NonnullRefPtr<StyleValue const> StyleComputer::get_inherit_value(CSS::PropertyID
 
 void StyleComputer::compute_defaulted_property_value(ComputedProperties& style, DOM::Element const* element, CSS::PropertyID property_id, Optional<CSS::PseudoElement> pseudo_element) const
 {
-    auto& value_slot = style.m_property_values[to_underlying(property_id)];
+    auto& value_slot = style.mutable_property_slot(property_id);
     if (!value_slot) {
         if (is_inherited_property(property_id)) {
             style.set_property(
@@ -2231,7 +2366,7 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     };
 
     // "A percentage value specifies an absolute font size relative to the parent element’s computed font-size. Negative percentages are invalid."
-    auto& font_size_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::FontSize)];
+    auto& font_size_value_slot = style.mutable_property_slot(CSS::PropertyID::FontSize);
     if (font_size_value_slot && font_size_value_slot->is_percentage()) {
         auto parent_font_size = get_inherit_value(CSS::PropertyID::FontSize, element)->as_length().length().to_px(viewport_rect(), font_metrics, m_root_element_font_metrics);
         font_size_value_slot = LengthStyleValue::create(
@@ -2246,7 +2381,7 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     //       We have to resolve them right away, so that the *computed* line-height is ready for inheritance.
     //       We can't simply absolutize *all* percentage values against the font size,
     //       because most percentages are relative to containing block metrics.
-    auto& line_height_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::LineHeight)];
+    auto& line_height_value_slot = style.mutable_property_slot(CSS::PropertyID::LineHeight);
     if (line_height_value_slot && line_height_value_slot->is_percentage()) {
         line_height_value_slot = LengthStyleValue::create(
             Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value_slot->as_percentage().percentage().as_fraction()))));
@@ -2259,10 +2394,11 @@ void StyleComputer::absolutize_values(ComputedProperties& style, GC::Ptr<DOM::El
     if (line_height_value_slot && line_height_value_slot->is_length())
         line_height_value_slot = LengthStyleValue::create(Length::make_px(line_height));
 
-    for (size_t i = 0; i < style.m_property_values.size(); ++i) {
-        auto& value_slot = style.m_property_values[i];
-        if (!value_slot)
+    for (size_t i = 0; i < ComputedProperties::number_of_properties; ++i) {
+        auto property_id = static_cast<PropertyID>(i);
+        if (!style.property_slot(property_id))
             continue;
+        auto& value_slot = style.mutable_property_slot(property_id);
         value_slot = value_slot->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
     }
 
@@ -2499,13 +2635,18 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
 
     ScopeGuard guard { [&element]() { element.set_needs_style_update(false); } };
 
+    if (!pseudo_element.has_value() && mode == ComputeStyleMode::Normal) {
+        if (auto shared_style = share_style_with_sibling_if_possible(element, did_change_custom_properties))
+            return shared_style;
+    }
+
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
     auto matching_rule_set = build_matching_rule_set(element, pseudo_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode);
 
     DOM::AbstractElement abstract_element { element, pseudo_element };
-    auto old_custom_properties = abstract_element.custom_properties();
+    auto old_custom_property_data = abstract_element.custom_property_data();
 
     // Resolve all the CSS custom properties ("variables") for this element:
     // FIXME: Also resolve !important custom properties, in a second cascade.
@@ -2518,7 +2659,9 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
     }
 
     auto logical_alias_mapping_context = compute_logical_alias_mapping_context(element, pseudo_element, mode, matching_rule_set);
-    auto cascaded_properties = compute_cascaded_values(element, pseudo_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+    auto cascaded_properties = !pseudo_element.has_value() && mode == ComputeStyleMode::Normal
+        ? compute_cascaded_values_using_matched_properties_cache(element, matching_rule_set, logical_alias_mapping_context)
+        : compute_cascaded_values(element, pseudo_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
     element.set_cascaded_properties(pseudo_element, cascaded_properties);
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
@@ -2553,13 +2696,185 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
     auto computed_properties = compute_properties(element, pseudo_element, cascaded_properties);
     computed_properties->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
 
-    if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties) {
+    if (did_change_custom_properties.has_value() && !CustomPropertyData::equals(abstract_element.custom_property_data(), old_custom_property_data)) {
         *did_change_custom_properties = true;
     }
 
     return computed_properties;
 }
 
+// The number of preceding siblings we look at when trying to share an element's style.
+static constexpr size_t maximum_style_sharing_candidates = 4;
+
+static bool can_share_style_given_attempted_pseudo_class_matches(ComputedProperties const& style)
+{
+    // NOTE: These pseudo-classes only depend on the element's tag name and attributes, and on its ancestors, all of
+    //       which are the same for siblings that we share style between. The user action pseudo-classes don't match
+    //       either of them, as we don't share style between elements affected by user actions.
+    static constexpr Array shareable_pseudo_classes {
+        PseudoClass::Active,
+        PseudoClass::AnyLink,
+        PseudoClass::Focus,
+        PseudoClass::FocusVisible,
+        PseudoClass::FocusWithin,
+        PseudoClass::Heading,
+        PseudoClass::Hover,
+        PseudoClass::Is,
+        PseudoClass::Lang,
+        PseudoClass::Link,
+        PseudoClass::LocalLink,
+        PseudoClass::Not,
+        PseudoClass::Root,
+        PseudoClass::Target,
+        PseudoClass::Visited,
+        PseudoClass::Where,
+    };
+
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<PseudoClass>(i);
+        if (style.has_attempted_match_against_pseudo_class(pseudo_class) && !shareable_pseudo_classes.contains_slow(pseudo_class))
+            return false;
+    }
+    return true;
+}
+
+static bool has_same_attributes(DOM::Element const& element, DOM::Element const& other)
+{
+    if (element.attribute_list_size() != other.attribute_list_size())
+        return false;
+
+    bool has_same_attributes = true;
+    element.for_each_attribute([&](FlyString const& name, String const& value) {
+        if (has_same_attributes && other.get_attribute(name) != value)
+            has_same_attributes = false;
+    });
+    return has_same_attributes;
+}
+
+static bool is_affected_by_user_action(DOM::Element const& element)
+{
+    auto const& document = element.document();
+
+    if (element.is_active() || element.is_target())
+        return true;
+
+    if (auto const* hovered_node = document.hovered_node(); hovered_node && (hovered_node == &element || element.is_shadow_including_ancestor_of(*hovered_node)))
+        return true;
+
+    if (auto const* focused_element = document.focused_element(); focused_element && element.is_inclusive_ancestor_of(*focused_element))
+        return true;
+
+    return false;
+}
+
+static bool may_have_style_affected_by_element_state(DOM::Element const& element)
+{
+    // NOTE: The style of these elements may depend on state that is not reflected in their attributes, either through
+    //       presentational hints or through adjust_computed_style().
+    return element.namespace_uri() != Namespace::HTML
+        || element.local_name().is_one_of(
+            HTML::TagNames::audio,
+            HTML::TagNames::button,
+            HTML::TagNames::canvas,
+            HTML::TagNames::details,
+            HTML::TagNames::dialog,
+            HTML::TagNames::embed,
+            HTML::TagNames::frame,
+            HTML::TagNames::frameset,
+            HTML::TagNames::iframe,
+            HTML::TagNames::input,
+            HTML::TagNames::meter,
+            HTML::TagNames::object,
+            HTML::TagNames::optgroup,
+            HTML::TagNames::option,
+            HTML::TagNames::progress,
+            HTML::TagNames::select,
+            HTML::TagNames::slot,
+            HTML::TagNames::template_,
+            HTML::TagNames::textarea,
+            HTML::TagNames::video);
+}
+
+bool StyleComputer::can_share_style_with(DOM::Element const& element, DOM::Element const& candidate) const
+{
+    if (candidate.needs_style_update() || candidate.use_pseudo_element().has_value())
+        return false;
+
+    auto candidate_style = candidate.computed_properties();
+    if (!candidate_style || !candidate.cascaded_properties({}))
+        return false;
+
+    if (candidate.local_name() != element.local_name() || candidate.namespace_uri() != element.namespace_uri())
+        return false;
+
+    // NOTE: Matching id selectors and the inline style are unique to an element, so we don't share style between
+    //       elements that have either.
+    if (candidate.id().has_value() || candidate.has_attribute(HTML::AttributeNames::style) || candidate.inline_style())
+        return false;
+
+    if (candidate.is_shadow_host() || candidate.rendered_in_top_layer() || candidate.has_associated_animations() || is_affected_by_user_action(candidate))
+        return false;
+
+    if (!has_same_attributes(element, candidate))
+        return false;
+
+    // NOTE: Both of these are set if the corresponding property was declared at all, so we'd have to start animations
+    //       or transitions for the element.
+    if (candidate_style->animation_name_source() || candidate_style->transition_property_source() || !candidate_style->animated_property_values().is_empty())
+        return false;
+
+    return can_share_style_given_attempted_pseudo_class_matches(*candidate_style);
+}
+
+// OPTIMIZATION: Repeated content like table rows, list items or cards tends to consist of siblings that end up with the
+//               exact same style. If the element is styled exactly like a preceding sibling, we clone the sibling's
+//               style instead of matching selectors and running the cascade again.
+GC::Ptr<ComputedProperties> StyleComputer::share_style_with_sibling_if_possible(DOM::Element& element, Optional<bool&> did_change_custom_properties) const
+{
+    // Selectors with sibling combinators or :has() may match siblings with the same attributes differently.
+    if (!m_selector_insights || m_selector_insights->has_has_selectors || m_selector_insights->has_sibling_combinators)
+        return {};
+
+    if (element.use_pseudo_element().has_value() || element.is_document_element())
+        return {};
+
+    if (element.id().has_value() || element.has_attribute(HTML::AttributeNames::style) || element.inline_style())
+        return {};
+
+    if (element.is_shadow_host() || element.rendered_in_top_layer() || element.has_associated_animations() || is_affected_by_user_action(element))
+        return {};
+
+    if (may_have_style_affected_by_element_state(element))
+        return {};
+
+    // NOTE: Children of a shadow host may be assigned to different slots, and thus inherit from different elements.
+    auto parent = element.parent_element();
+    if (!parent || parent->is_shadow_host())
+        return {};
+
+    auto* candidate = element.previous_element_sibling();
+    for (size_t i = 0; candidate && i < maximum_style_sharing_candidates; ++i, candidate = candidate->previous_element_sibling()) {
+        if (!can_share_style_with(element, *candidate))
+            continue;
+
+        auto old_custom_property_data = element.custom_property_data({});
+        element.set_custom_property_data({}, candidate->custom_property_data({}));
+        element.set_cascaded_properties({}, candidate->cascaded_properties({}));
+
+        if (candidate->style_uses_attr_css_function())
+            element.set_style_uses_attr_css_function();
+        if (candidate->style_uses_var_css_function())
+            element.set_style_uses_var_css_function();
+
+        if (did_change_custom_properties.has_value() && !CustomPropertyData::equals(element.custom_property_data({}), old_custom_property_data))
+            *did_change_custom_properties = true;
+
+        return candidate->computed_properties()->clone(document().heap());
+    }
+
+    return {};
+}
+
 static bool is_monospace(StyleValue const& value)
 {
     if (value.to_keyword() == Keyword::Monospace)
@@ -2791,6 +3106,16 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::Element& elem
         start_needed_transitions(*previous_style, computed_style, element, pseudo_element);
     }
 
+    // 10. Share property values with our parent and previous sibling where they are identical
+    // OPTIMIZATION: Inherited properties usually have the same values as our parent's, and non-inherited properties often
+    //               have the same values as a sibling of the same kind, so this avoids storing the same values many times.
+    if (auto inheritance_parent = element_to_inherit_style_from(&element, pseudo_element); inheritance_parent && inheritance_parent->computed_properties())
+        computed_style->share_property_values_if_identical(*inheritance_parent->computed_properties());
+    if (!pseudo_element.has_value()) {
+        if (auto previous_sibling = element.previous_element_sibling(); previous_sibling && previous_sibling->computed_properties())
+            computed_style->share_property_values_if_identical(*previous_sibling->computed_properties());
+    }
+
     return computed_style;
 }
 
@@ -2840,6 +3165,8 @@ static Optional<SimplifiedSelectorForBucketing> is_roundabout_selector_bucketabl
 void StyleComputer::collect_selector_insights(Selector const& selector, SelectorInsights& insights)
 {
     for (auto const& compound_selector : selector.compound_selectors()) {
+        if (first_is_one_of(compound_selector.combinator, Selector::Combinator::NextSibling, Selector::Combinator::SubsequentSibling))
+            insights.has_sibling_combinators = true;
         for (auto const& simple_selector : compound_selector.simple_selectors) {
             if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
                 if (simple_selector.pseudo_class().type == PseudoClass::Has) {
@@ -3097,6 +3424,9 @@ void StyleComputer::invalidate_rule_cache()
 
     m_pseudo_class_rule_cache = {};
     m_style_invalidation_data = nullptr;
+
+    // NOTE: The matched properties cache is keyed by the rules we're throwing away.
+    m_matched_properties_cache.clear();
 }
 
 void StyleComputer::did_load_font(FlyString const&)
@@ -3210,15 +3540,37 @@ void StyleComputer::compute_custom_properties(ComputedProperties&, DOM::Abstract
     // https://drafts.csswg.org/css-variables/#propdef-
     // The computed value of a custom property is its specified value with any arbitrary-substitution functions replaced.
     // FIXME: These should probably be part of ComputedProperties.
-    auto custom_properties = abstract_element.custom_properties();
-    decltype(custom_properties) resolved_custom_properties;
+    auto custom_property_data = abstract_element.custom_property_data();
+    if (!custom_property_data)
+        return;
+
+    auto const& custom_properties = custom_property_data->values();
+
+    Vector<NonnullRefPtr<StyleValue const>> computed_values;
+    computed_values.ensure_capacity(custom_properties.size());
+    bool did_change_any_value = false;
+
+    for (auto const& [name, style_property] : custom_properties) {
+        auto computed_value = compute_value_of_custom_property(abstract_element, name);
+        if (computed_value != style_property.value)
+            did_change_any_value = true;
+        computed_values.unchecked_append(move(computed_value));
+    }
+
+    // OPTIMIZATION: If none of the values changed, we keep sharing our custom properties instead of copying them.
+    if (!did_change_any_value)
+        return;
+
+    HashMap<FlyString, StyleProperty> resolved_custom_properties;
+    resolved_custom_properties.ensure_capacity(custom_properties.size());
 
+    size_t index = 0;
     for (auto const& [name, style_property] : custom_properties) {
         resolved_custom_properties.set(name,
             StyleProperty {
                 .important = style_property.important,
                 .property_id = style_property.property_id,
-                .value = compute_value_of_custom_property(abstract_element, name),
+                .value = move(computed_values[index++]),
                 .custom_name = style_property.custom_name,
             });
     }
@@ -3293,20 +3645,32 @@ static void for_each_element_hash(DOM::Element const& element, auto callback)
 void StyleComputer::reset_ancestor_filter()
 {
     m_ancestor_filter->clear();
+    m_ancestor_filter_hashes.clear_with_capacity();
+    m_ancestor_filter_hash_counts.clear_with_capacity();
 }
 
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
+    // NOTE: We remember the hashes we added for each ancestor, so that popping it doesn't need to hash its local name,
+    //       classes and attributes all over again, and removes exactly what was added.
+    size_t hash_count = 0;
     for_each_element_hash(element, [&](u32 hash) {
         m_ancestor_filter->increment(hash);
+        m_ancestor_filter_hashes.append(hash);
+        ++hash_count;
     });
+    m_ancestor_filter_hash_counts.append(hash_count);
 }
 
-void StyleComputer::pop_ancestor(DOM::Element const& element)
+void StyleComputer::pop_ancestor(DOM::Element const&)
 {
-    for_each_element_hash(element, [&](u32 hash) {
-        m_ancestor_filter->decrement(hash);
-    });
+    // NOTE: The filter may have been reset since this ancestor was pushed, in which case there's nothing to remove.
+    if (m_ancestor_filter_hash_counts.is_empty())
+        return;
+
+    auto hash_count = m_ancestor_filter_hash_counts.take_last();
+    for (size_t i = 0; i < hash_count; ++i)
+        m_ancestor_filter->decrement(m_ancestor_filter_hashes.take_last());
 }
 
 size_t StyleComputer::number_of_css_font_faces_with_loading_in_progress() const
@@ -223,7 +223,10 @@ private:
 
     LogicalAliasMappingContext compute_logical_alias_mapping_context(DOM::Element&, Optional<CSS::PseudoElement>, ComputeStyleMode, MatchingRuleSet const&) const;
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_style_impl(DOM::Element&, Optional<CSS::PseudoElement>, ComputeStyleMode, Optional<bool&> did_change_custom_properties) const;
+    [[nodiscard]] GC::Ptr<ComputedProperties> share_style_with_sibling_if_possible(DOM::Element&, Optional<bool&> did_change_custom_properties) const;
+    [[nodiscard]] bool can_share_style_with(DOM::Element const&, DOM::Element const& candidate) const;
     [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::Element&, Optional<CSS::PseudoElement>, bool did_match_any_pseudo_element_rules, ComputeStyleMode, MatchingRuleSet const&, Optional<LogicalAliasMappingContext>, ReadonlySpan<PropertyID> properties_to_cascade) const;
+    [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values_using_matched_properties_cache(DOM::Element&, MatchingRuleSet const&, LogicalAliasMappingContext) const;
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_ascending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_descending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
     RefPtr<Gfx::FontCascadeList const> font_matching_algorithm(FlyString const& family_name, int weight, int slope, float font_size_in_pt) const;
@@ -264,6 +267,7 @@ private:
 
     struct SelectorInsights {
         bool has_has_selectors { false };
+        bool has_sibling_combinators { false };
     };
 
     struct RuleCaches {
@@ -301,6 +305,23 @@ private:
     CSSPixelRect m_viewport_rect;
 
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
+    Vector<u32> m_ancestor_filter_hashes;
+    Vector<size_t> m_ancestor_filter_hash_counts;
+
+    // The result of the cascade only depends on the matched rules for elements without inline style, presentational
+    // hints or var()/attr() substitutions, so such elements can share their cascaded properties.
+    struct MatchedPropertiesCacheKey {
+        Vector<MatchingRule const*> rules;
+        LogicalAliasMappingContext logical_alias_mapping_context;
+
+        bool operator==(MatchedPropertiesCacheKey const&) const;
+    };
+
+    struct MatchedPropertiesCacheKeyTraits : public DefaultTraits<MatchedPropertiesCacheKey> {
+        static unsigned hash(MatchedPropertiesCacheKey const&);
+    };
+
+    mutable HashMap<MatchedPropertiesCacheKey, GC::Ref<CascadedProperties>, MatchedPropertiesCacheKeyTraits> m_matched_properties_cache;
 };
 
 class FontLoader final : public GC::Cell {
@@ -11,17 +11,25 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Compression/CompressionStream.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Streams/TransformStream.h>
 #include <LibWeb/Streams/TransformStreamOperations.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Compression {
 
 GC_DEFINE_ALLOCATOR(CompressionStream);
 
+// Chunks at least this large are compressed on a background thread, so that compressing a lot of data doesn't block
+// the event loop.
+static constexpr size_t MINIMUM_CHUNK_SIZE_FOR_BACKGROUND_COMPRESSION = 64 * KiB;
+
 // https://compression.spec.whatwg.org/#dom-compressionstream-compressionstream
 WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
 {
@@ -55,12 +63,13 @@ WebIDL::ExceptionOr<GC::Ref<CompressionStream>> CompressionStream::construct_imp
         auto& realm = stream->realm();
         auto& vm = realm.vm();
 
-        if (auto result = stream->compress_and_enqueue_chunk(chunk); result.is_error()) {
+        auto result = stream->compress_and_enqueue_chunk(chunk);
+        if (result.is_error()) {
             auto throw_completion = Bindings::exception_to_throw_completion(vm, result.exception());
             return WebIDL::create_rejected_promise(realm, throw_completion.release_value());
         }
 
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return result.release_value();
     });
 
     // 4. Let flushAlgorithm be an algorithm which takes no argument and runs the compress flush and enqueue algorithm with this.
@@ -105,7 +114,7 @@ void CompressionStream::visit_edges(JS::Cell::Visitor& visitor)
 }
 
 // https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
-WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Value chunk)
+WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> CompressionStream::compress_and_enqueue_chunk(JS::Value chunk)
 {
     auto& realm = this->realm();
 
@@ -113,15 +122,29 @@ WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Valu
     if (!WebIDL::is_buffer_source_type(chunk))
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Chunk is not a BufferSource type"sv };
 
+    auto chunk_buffer = WebIDL::get_buffer_source_copy(chunk.as_object());
+    if (chunk_buffer.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", chunk_buffer.error())) };
+
+    // OPTIMIZATION: Compress large chunks on a background thread. The transform stream doesn't hand us another chunk
+    //               (or flush) until the returned promise settles, so the compressor is only ever used by one thread
+    //               at a time.
+    if (chunk_buffer.value().size() >= MINIMUM_CHUNK_SIZE_FOR_BACKGROUND_COMPRESSION)
+        return compress_and_enqueue_chunk_on_background_thread(chunk_buffer.release_value());
+
     // 2. Let buffer be the result of compressing chunk with cs's format and context.
-    auto maybe_buffer = [&]() -> ErrorOr<ByteBuffer> {
-        auto chunk_buffer = TRY(WebIDL::get_buffer_source_copy(chunk.as_object()));
-        return compress(move(chunk_buffer), Finish::No);
-    }();
+    auto maybe_buffer = compress(chunk_buffer.value(), Finish::No);
     if (maybe_buffer.is_error())
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", maybe_buffer.error())) };
 
-    auto buffer = maybe_buffer.release_value();
+    TRY(enqueue_compressed_chunk(maybe_buffer.release_value()));
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+}
+
+// Steps 3 to 5 of https://compression.spec.whatwg.org/#compress-and-enqueue-a-chunk
+WebIDL::ExceptionOr<void> CompressionStream::enqueue_compressed_chunk(ByteBuffer buffer)
+{
+    auto& realm = this->realm();
 
     // 3. If buffer is empty, return.
     if (buffer.is_empty())
@@ -136,6 +159,55 @@ WebIDL::ExceptionOr<void> CompressionStream::compress_and_enqueue_chunk(JS::Valu
     return {};
 }
 
+GC::Ref<WebIDL::Promise> CompressionStream::compress_and_enqueue_chunk_on_background_thread(ByteBuffer chunk_buffer)
+{
+    auto& realm = this->realm();
+    auto promise = WebIDL::create_promise(realm);
+
+    // NOTE: Errors are carried in the result rather than reported through the job's error callback, so that the only
+    //       GC roots held by the job belong to the completion callback, which always runs on the main thread.
+    struct CompressedChunk {
+        ErrorOr<ByteBuffer> buffer;
+    };
+
+    using CompressJob = Threading::BackgroundAction<CompressedChunk>;
+    CompressJob::construct(
+        [this, chunk_buffer = move(chunk_buffer)](auto&) -> ErrorOr<CompressedChunk> {
+            return CompressedChunk { compress(chunk_buffer, Finish::No) };
+        },
+        [stream = GC::make_root(*this), promise = GC::make_root(promise)](CompressedChunk compressed_chunk) mutable -> ErrorOr<void> {
+            // NOTE: The job may be destroyed on the background thread, so we make sure that nothing that must only be
+            //       touched on the main thread outlives this callback.
+            auto strong_stream = move(stream);
+            auto strong_promise = move(promise);
+
+            auto& realm = strong_stream->realm();
+
+            HTML::queue_global_task(HTML::Task::Source::Unspecified, realm.global_object(), GC::create_function(realm.heap(), [stream = GC::Ref { *strong_stream }, promise = GC::Ref { *strong_promise }, buffer = move(compressed_chunk.buffer)]() mutable {
+                auto& realm = stream->realm();
+                HTML::TemporaryExecutionContext context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+                auto result = [&]() -> WebIDL::ExceptionOr<void> {
+                    if (buffer.is_error())
+                        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to compress chunk: {}", buffer.error())) };
+                    return stream->enqueue_compressed_chunk(buffer.release_value());
+                }();
+
+                if (result.is_error()) {
+                    auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), result.exception());
+                    WebIDL::reject_promise(realm, *promise, throw_completion.release_value());
+                    return;
+                }
+
+                WebIDL::resolve_promise(realm, *promise, JS::js_undefined());
+            }));
+
+            return {};
+        });
+
+    return promise;
+}
+
 // https://compression.spec.whatwg.org/#compress-flush-and-enqueue
 WebIDL::ExceptionOr<void> CompressionStream::compress_flush_and_enqueue()
 {
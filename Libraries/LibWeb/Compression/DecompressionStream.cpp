@@ -11,17 +11,25 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/DecompressionStreamPrototype.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Compression/DecompressionStream.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Streams/TransformStream.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::Compression {
 
 GC_DEFINE_ALLOCATOR(DecompressionStream);
 
+// If at least this much compressed input is left when flushing, it is decompressed on a background thread, so that
+// decompressing a lot of data doesn't block the event loop.
+static constexpr size_t MINIMUM_INPUT_SIZE_FOR_BACKGROUND_DECOMPRESSION = 64 * KiB;
+
 // https://compression.spec.whatwg.org/#dom-decompressionstream-decompressionstream
 WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct_impl(JS::Realm& realm, Bindings::CompressionFormat format)
 {
@@ -68,12 +76,13 @@ WebIDL::ExceptionOr<GC::Ref<DecompressionStream>> DecompressionStream::construct
         auto& realm = stream->realm();
         auto& vm = realm.vm();
 
-        if (auto result = stream->decompress_flush_and_enqueue(); result.is_error()) {
+        auto result = stream->decompress_flush_and_enqueue();
+        if (result.is_error()) {
             auto throw_completion = Bindings::exception_to_throw_completion(vm, result.exception());
             return WebIDL::create_rejected_promise(realm, throw_completion.release_value());
         }
 
-        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+        return result.release_value();
     });
 
     // 6. Set up this's transform with transformAlgorithm set to transformAlgorithm and flushAlgorithm set to flushAlgorithm.
@@ -144,26 +153,46 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_and_enqueue_chunk(JS::
 }
 
 // https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
-WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
+WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> DecompressionStream::decompress_flush_and_enqueue()
 {
     auto& realm = this->realm();
 
+    // OPTIMIZATION: Most of the input is only decompressed here, as each chunk only decompresses a bounded amount of
+    //               data. If there's a lot of it, do the work on a background thread. The transform stream doesn't call
+    //               us again until the returned promise settles, so the decompressor is only used by one thread at a time.
+    if (m_input_stream->used_buffer_size() >= MINIMUM_INPUT_SIZE_FOR_BACKGROUND_DECOMPRESSION)
+        return decompress_flush_and_enqueue_on_background_thread();
+
     // 1. Let buffer be the result of decompressing an empty input with ds's format and context, with the finish flag.
-    auto maybe_buffer = m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
-        return TRY(decompressor->read_until_eof());
-    });
+    auto maybe_buffer = decompress_flush();
     if (maybe_buffer.is_error())
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress flush: {}", maybe_buffer.error())) };
 
-    auto buffer = maybe_buffer.release_value();
+    enqueue_decompressed_flush(maybe_buffer.release_value());
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+}
+
+ErrorOr<ByteBuffer> DecompressionStream::decompress_flush()
+{
+    auto buffer = TRY(m_decompressor.visit([&](auto const& decompressor) -> ErrorOr<ByteBuffer> {
+        return TRY(decompressor->read_until_eof());
+    }));
 
     // Note: LibCompress already throws an error if we call read_until_eof and no more progress can be made
     // 2. If the end of the compressed input has not been reached, then throw a TypeError.
     VERIFY(m_decompressor.visit([](auto const& decompressor) { return decompressor->is_eof(); }));
 
+    return buffer;
+}
+
+// Steps 3 to 5 of https://compression.spec.whatwg.org/#decompress-flush-and-enqueue
+void DecompressionStream::enqueue_decompressed_flush(ByteBuffer buffer)
+{
+    auto& realm = this->realm();
+
     // 3. If buffer is empty, return.
     if (buffer.is_empty())
-        return {};
+        return;
 
     // 4. Split buffer into one or more non-empty pieces and convert them into Uint8Arrays.
     auto array_buffer = JS::ArrayBuffer::create(realm, move(buffer));
@@ -171,7 +200,51 @@ WebIDL::ExceptionOr<void> DecompressionStream::decompress_flush_and_enqueue()
 
     // 5. For each Uint8Array array, enqueue array in ds's transform.
     m_transform->enqueue(array);
-    return {};
+}
+
+GC::Ref<WebIDL::Promise> DecompressionStream::decompress_flush_and_enqueue_on_background_thread()
+{
+    auto& realm = this->realm();
+    auto promise = WebIDL::create_promise(realm);
+
+    // NOTE: Errors are carried in the result rather than reported through the job's error callback, so that the only
+    //       GC roots held by the job belong to the completion callback, which always runs on the main thread.
+    struct DecompressedFlush {
+        ErrorOr<ByteBuffer> buffer;
+    };
+
+    using DecompressJob = Threading::BackgroundAction<DecompressedFlush>;
+    DecompressJob::construct(
+        [this](auto&) -> ErrorOr<DecompressedFlush> {
+            return DecompressedFlush { decompress_flush() };
+        },
+        [stream = GC::make_root(*this), promise = GC::make_root(promise)](DecompressedFlush decompressed_flush) mutable -> ErrorOr<void> {
+            // NOTE: The job may be destroyed on the background thread, so we make sure that nothing that must only be
+            //       touched on the main thread outlives this callback.
+            auto strong_stream = move(stream);
+            auto strong_promise = move(promise);
+
+            auto& realm = strong_stream->realm();
+
+            HTML::queue_global_task(HTML::Task::Source::Unspecified, realm.global_object(), GC::create_function(realm.heap(), [stream = GC::Ref { *strong_stream }, promise = GC::Ref { *strong_promise }, buffer = move(decompressed_flush.buffer)]() mutable {
+                auto& realm = stream->realm();
+                HTML::TemporaryExecutionContext context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+                if (buffer.is_error()) {
+                    WebIDL::Exception exception = WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, MUST(String::formatted("Unable to decompress flush: {}", buffer.error())) };
+                    auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), move(exception));
+                    WebIDL::reject_promise(realm, *promise, throw_completion.release_value());
+                    return;
+                }
+
+                stream->enqueue_decompressed_flush(buffer.release_value());
+                WebIDL::resolve_promise(realm, *promise, JS::js_undefined());
+            }));
+
+            return {};
+        });
+
+    return promise;
 }
 
 }
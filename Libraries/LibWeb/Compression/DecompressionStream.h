@@ -42,7 +42,10 @@ private:
     virtual void visit_edges(Cell::Visitor&) override;
 
     WebIDL::ExceptionOr<void> decompress_and_enqueue_chunk(JS::Value);
-    WebIDL::ExceptionOr<void> decompress_flush_and_enqueue();
+    WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> decompress_flush_and_enqueue();
+    ErrorOr<ByteBuffer> decompress_flush();
+    void enqueue_decompressed_flush(ByteBuffer);
+    GC::Ref<WebIDL::Promise> decompress_flush_and_enqueue_on_background_thread();
 
     Decompressor m_decompressor;
     NonnullOwnPtr<AllocatingMemoryStream> m_input_stream;
@@ -78,6 +78,13 @@ static Vector<Bindings::KeyUsage> usage_intersection(ReadonlySpan<Bindings::KeyU
 // Out of line to ensure this class has a key function
 AlgorithmMethods::~AlgorithmMethods() = default;
 
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> BackgroundOperation::create_result(JS::Realm& realm, ErrorOr<ByteBuffer> result) const
+{
+    if (result.is_error())
+        return WebIDL::OperationError::create(realm, Utf16String::from_utf8(failure_message));
+    return JS::ArrayBuffer::create(realm, result.release_value());
+}
+
 // https://w3c.github.io/webcrypto/#big-integer
 static ::Crypto::UnsignedBigInteger big_integer_from_api_big_integer(GC::Ptr<JS::Uint8Array> const& big_integer)
 {
@@ -3626,34 +3633,55 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
     return key;
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+WebIDL::ExceptionOr<::Crypto::Hash::HashKind> SHA::hash_kind(AlgorithmParams const& algorithm) const
 {
     auto& algorithm_name = algorithm.name;
 
-    ::Crypto::Hash::HashKind hash_kind;
-    if (algorithm_name == "SHA-1") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA1;
-    } else if (algorithm_name == "SHA-256") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA256;
-    } else if (algorithm_name == "SHA-384") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA384;
-    } else if (algorithm_name == "SHA-512") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA512;
-    } else {
-        return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
-    }
+    if (algorithm_name == "SHA-1")
+        return ::Crypto::Hash::HashKind::SHA1;
+    if (algorithm_name == "SHA-256")
+        return ::Crypto::Hash::HashKind::SHA256;
+    if (algorithm_name == "SHA-384")
+        return ::Crypto::Hash::HashKind::SHA384;
+    if (algorithm_name == "SHA-512")
+        return ::Crypto::Hash::HashKind::SHA512;
+    return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
+}
 
+static ErrorOr<ByteBuffer> compute_digest(::Crypto::Hash::HashKind hash_kind, ReadonlyBytes data)
+{
     ::Crypto::Hash::Manager hash { hash_kind };
     hash.update(data);
 
     auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+    return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+}
+
+static constexpr auto digest_failure_message = "Failed to create result buffer"sv;
+
+WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+{
+    auto hash_kind = TRY(this->hash_kind(algorithm));
+
+    auto result_buffer = compute_digest(hash_kind, data);
     if (result_buffer.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_utf16);
+        return WebIDL::OperationError::create(m_realm, Utf16String::from_utf8(digest_failure_message));
 
     return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
 }
 
+WebIDL::ExceptionOr<Optional<BackgroundOperation>> SHA::digest_in_background(AlgorithmParams const& algorithm, ByteBuffer& data)
+{
+    auto hash_kind = TRY(this->hash_kind(algorithm));
+
+    return BackgroundOperation {
+        .compute_result = [hash_kind, data = move(data)] {
+            return compute_digest(hash_kind, data);
+        },
+        .failure_message = digest_failure_message,
+    };
+}
+
 // https://w3c.github.io/webcrypto/#ecdsa-operations
 WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> ECDSA::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
 {
@@ -6743,6 +6771,13 @@ WebIDL::ExceptionOr<JS::Value> HKDF::get_key_length(AlgorithmParams const&)
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
 WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+{
+    auto operation = TRY(derive_bits_in_background(params, key, length_optional));
+    return operation->create_result(m_realm, operation->compute_result());
+}
+
+// https://w3c.github.io/webcrypto/#pbkdf2-operations
+WebIDL::ExceptionOr<Optional<BackgroundOperation>> PBKDF2::derive_bits_in_background(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto& realm = *m_realm;
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
@@ -6781,15 +6816,16 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", hash_algorithm));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
-
     // 5. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(realm, "Failed to derive key"_utf16);
-
     // 6. Return result
-    return JS::ArrayBuffer::create(realm, maybe_result.release_value());
+    // NOTE: The key derivation is performed by the returned operation, and its failure turns into an OperationError.
+    return BackgroundOperation {
+        .compute_result = [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes] {
+            ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+            return pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+        },
+        .failure_message = "Failed to derive key"sv,
+    };
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AK/EnumBits.h>
+#include <AK/Function.h>
 #include <AK/String.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
 #include <LibGC/Ptr.h>
@@ -297,6 +298,17 @@ struct HmacKeyGenParams : public AlgorithmParams {
     static JS::ThrowCompletionOr<NonnullOwnPtr<AlgorithmParams>> from_value(JS::VM&, JS::Value);
 };
 
+// The part of an operation that computes the bytes of its result. It does not touch any GC-allocated objects, so that it
+// can be performed off the main thread.
+struct BackgroundOperation {
+    WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> create_result(JS::Realm&, ErrorOr<ByteBuffer>) const;
+
+    Function<ErrorOr<ByteBuffer>()> compute_result;
+
+    // The message of the OperationError that is thrown if computing the result fails.
+    StringView failure_message;
+};
+
 class AlgorithmMethods {
 public:
     virtual ~AlgorithmMethods();
@@ -326,11 +338,24 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "digest is not supported"_utf16);
     }
 
+    // Returns the part of the digest operation that can be performed off the main thread, if this algorithm supports it.
+    // The data is only moved from if an operation is returned.
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> digest_in_background(AlgorithmParams const&, ByteBuffer&)
+    {
+        return OptionalNone {};
+    }
+
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
     {
         return WebIDL::NotSupportedError::create(m_realm, "deriveBits is not supported"_utf16);
     }
 
+    // Returns the part of the derive bits operation that can be performed off the main thread, if this algorithm supports it.
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> derive_bits_in_background(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
+    {
+        return OptionalNone {};
+    }
+
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&)
     {
         return WebIDL::NotSupportedError::create(m_realm, "importKey is not supported"_utf16);
@@ -520,6 +545,7 @@ class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> derive_bits_in_background(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new PBKDF2(realm)); }
@@ -534,6 +560,7 @@ private:
 class SHA : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<Optional<BackgroundOperation>> digest_in_background(AlgorithmParams const&, ByteBuffer&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
@@ -542,6 +569,8 @@ private:
         : AlgorithmMethods(realm)
     {
     }
+
+    WebIDL::ExceptionOr<::Crypto::Hash::HashKind> hash_kind(AlgorithmParams const&) const;
 };
 
 class ECDSA : public AlgorithmMethods {
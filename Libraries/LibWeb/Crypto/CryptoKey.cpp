@@ -145,12 +145,10 @@ WebIDL::ExceptionOr<void> CryptoKey::serialization_steps(HTML::TransferDataEncod
     serialized.encode(m_extractable);
 
     // 3. Set serialized.[[Algorithm]] to the sub-serialization of the [[algorithm]] internal slot of value.
-    auto serialized_algorithm = TRY(HTML::structured_serialize_internal(vm, m_algorithm, for_storage, memory));
-    serialized.append(move(serialized_algorithm));
+    TRY(HTML::structured_serialize_internal(vm, serialized, m_algorithm, for_storage, memory));
 
     // 4. Set serialized.[[Usages]] to the sub-serialization of the [[usages]] internal slot of value.
-    auto serialized_usages = TRY(HTML::structured_serialize_internal(vm, m_usages, for_storage, memory));
-    serialized.append(move(serialized_usages));
+    TRY(HTML::structured_serialize_internal(vm, serialized, m_usages, for_storage, memory));
 
     // FIXME: 5. Set serialized.[[Handle]] to the [[handle]] internal slot of value.
 
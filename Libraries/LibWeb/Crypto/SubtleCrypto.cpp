@@ -12,6 +12,7 @@
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
@@ -30,6 +31,27 @@ static void normalize_key_usages(Vector<Bindings::KeyUsage>& key_usages)
 {
     quick_sort(key_usages);
 }
+
+// Performs the operation on the thread pool, so that expensive operations (like hashing a lot of data or deriving bits
+// with many iterations) don't block the event loop, and then settles the promise with its result on the current thread.
+static void perform_in_background(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise, BackgroundOperation operation)
+{
+    auto compute_result = move(operation.compute_result);
+
+    Threading::ThreadPool::the().submit(
+        move(compute_result),
+        [realm = GC::make_root(realm), promise = GC::make_root(promise), operation = move(operation)](ErrorOr<ByteBuffer> bytes) mutable {
+            HTML::TemporaryExecutionContext context(*realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+            auto result = operation.create_result(*realm, move(bytes));
+            if (result.is_exception()) {
+                WebIDL::reject_promise(*realm, *promise, Bindings::exception_to_throw_completion(realm->vm(), result.release_error()).release_value());
+                return;
+            }
+
+            WebIDL::resolve_promise(*realm, *promise, result.release_value());
+        });
+}
 struct RegisteredAlgorithm {
     NonnullOwnPtr<AlgorithmMethods> (*create_methods)(JS::Realm&) = nullptr;
     JS::ThrowCompletionOr<NonnullOwnPtr<AlgorithmParams>> (*parameter_from_value)(JS::VM&, JS::Value) = nullptr;
@@ -275,12 +297,24 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     auto promise = WebIDL::create_promise(realm);
 
     // 6. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 7. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
         // FIXME: Need spec reference to https://webidl.spec.whatwg.org/#reject
 
         // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
+        // OPTIMIZATION: The digest is computed off the main thread if the algorithm supports it.
+        auto background_operation = algorithm_object.methods->digest_in_background(*algorithm_object.parameter, data_buffer);
+        if (background_operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), background_operation.release_error()).release_value());
+            return;
+        }
+        if (background_operation.value().has_value()) {
+            // 9. Resolve promise with result.
+            perform_in_background(realm, promise, background_operation.release_value().release_value());
+            return;
+        }
+
         auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
 
         if (result.is_exception()) {
@@ -632,6 +666,18 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
         }
 
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
+        // OPTIMIZATION: The bits are derived off the main thread if the algorithm supports it.
+        auto background_operation = normalized_algorithm.methods->derive_bits_in_background(*normalized_algorithm.parameter, base_key, length_optional);
+        if (background_operation.is_exception()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), background_operation.release_error()).release_value());
+            return;
+        }
+        if (background_operation.value().has_value()) {
+            // 10. Resolve promise with result.
+            perform_in_background(realm, promise, background_operation.release_value().release_value());
+            return;
+        }
+
         auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
         if (result.is_error()) {
             WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
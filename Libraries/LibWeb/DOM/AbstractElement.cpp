@@ -88,21 +88,34 @@ void AbstractElement::set_custom_properties(HashMap<FlyString, CSS::StylePropert
     m_element->set_custom_properties(m_pseudo_element, move(custom_properties));
 }
 
+void AbstractElement::set_custom_property_data(RefPtr<CSS::CustomPropertyData const> custom_property_data)
+{
+    m_element->set_custom_property_data(m_pseudo_element, move(custom_property_data));
+}
+
+RefPtr<CSS::CustomPropertyData const> AbstractElement::custom_property_data() const
+{
+    return m_element->custom_property_data(m_pseudo_element);
+}
+
 RefPtr<CSS::StyleValue const> AbstractElement::get_custom_property(FlyString const& name) const
 {
     // FIXME: We should be producing computed values for custom properties, just like regular properties.
     if (m_pseudo_element.has_value()) {
-        auto const& custom_properties = m_element->custom_properties(*m_pseudo_element);
-        if (auto it = custom_properties.find(name); it != custom_properties.end()) {
-            return it->value.value;
+        if (auto custom_property_data = m_element->custom_property_data(*m_pseudo_element)) {
+            if (auto it = custom_property_data->values().find(name); it != custom_property_data->values().end())
+                return it->value.value;
         }
     }
 
+    // NOTE: Custom properties are inherited by looking them up in our ancestors, rather than by copying them into
+    //       every element. Most elements don't specify any custom properties, and thus don't have any data to look at.
     for (auto const* current_element = m_element.ptr(); current_element; current_element = current_element->parent_or_shadow_host_element()) {
-        auto const& custom_properties = current_element->custom_properties({});
-        if (auto it = custom_properties.find(name); it != custom_properties.end()) {
+        auto custom_property_data = current_element->custom_property_data({});
+        if (!custom_property_data)
+            continue;
+        if (auto it = custom_property_data->values().find(name); it != custom_property_data->values().end())
             return it->value.value;
-        }
     }
     return nullptr;
 }
@@ -35,6 +35,8 @@ public:
 
     void set_custom_properties(HashMap<FlyString, CSS::StyleProperty>&& custom_properties);
     [[nodiscard]] HashMap<FlyString, CSS::StyleProperty> const& custom_properties() const;
+    void set_custom_property_data(RefPtr<CSS::CustomPropertyData const>);
+    [[nodiscard]] RefPtr<CSS::CustomPropertyData const> custom_property_data() const;
     RefPtr<CSS::StyleValue const> get_custom_property(FlyString const& name) const;
 
     bool has_non_empty_counters_set() const;
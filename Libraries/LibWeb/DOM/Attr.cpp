@@ -33,10 +33,19 @@ GC::Ref<Attr> Attr::clone(Document& document) const
     return realm().create<Attr>(document, m_qualified_name, m_value, nullptr);
 }
 
+static FlyString lowercase_attribute_name(FlyString const& name)
+{
+    // OPTIMIZATION: Attribute names are nearly always ASCII, and usually already lowercase. Avoid full Unicode case
+    //               mapping (and allocating a new string) for those.
+    if (name.is_ascii())
+        return name.to_ascii_lowercase();
+    return MUST(name.to_string().to_lowercase());
+}
+
 Attr::Attr(Document& document, QualifiedName qualified_name, String value, Element* owner_element)
     : Node(document, NodeType::ATTRIBUTE_NODE)
     , m_qualified_name(move(qualified_name))
-    , m_lowercase_name(MUST(String(m_qualified_name.as_string()).to_lowercase()))
+    , m_lowercase_name(lowercase_attribute_name(m_qualified_name.as_string()))
     , m_value(move(value))
     , m_owner_element(owner_element)
 {
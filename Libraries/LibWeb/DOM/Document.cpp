@@ -20,6 +20,7 @@
 #include <AK/Utf8View.h>
 #include <LibCore/DateTime.h>
 #include <LibCore/Timer.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGC/RootVector.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
@@ -608,6 +609,8 @@ void Document::visit_edges(Cell::Visitor& visitor)
 
     visitor.visit(m_adopted_style_sheets);
     visitor.visit(m_script_blocking_style_sheet_set);
+    visitor.visit(m_elements_needing_paint_only_properties_resolved);
+    visitor.visit(m_map_of_preloaded_resources);
 
     visitor.visit(m_top_layer_elements);
     visitor.visit(m_top_layer_pending_removals);
@@ -1091,6 +1094,7 @@ void Document::tear_down_layout_tree()
     m_layout_root = nullptr;
     m_paintable = nullptr;
     m_needs_full_layout_tree_update = true;
+    ++m_layout_tree_version;
 }
 
 Color Document::background_color() const
@@ -1310,6 +1314,24 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
     overflow_origin_computed_values.set_overflow_y(CSS::Overflow::Visible);
 }
 
+static u64 s_layout_generation = 0;
+static u64 s_geometry_generation = 0;
+
+u64 Document::layout_generation()
+{
+    return s_layout_generation;
+}
+
+u64 Document::geometry_generation()
+{
+    return s_geometry_generation;
+}
+
+void Document::did_change_geometry()
+{
+    ++s_geometry_generation;
+}
+
 void Document::update_layout(UpdateLayoutReason reason)
 {
     auto navigable = this->navigable();
@@ -1326,6 +1348,8 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (m_layout_root && !m_layout_root->needs_layout_update())
         return;
 
+    TRACE_EVENT("layout", "Document::update_layout");
+
     // NOTE: If this is a document hosting <template> contents, layout is unnecessary.
     if (m_created_for_appropriate_template_contents)
         return;
@@ -1344,6 +1368,7 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
         Layout::TreeBuilder tree_builder;
         m_layout_root = as<Layout::Viewport>(*tree_builder.build(*this));
+        ++m_layout_tree_version;
 
         if (document_element && document_element->layout_node()) {
             propagate_overflow_to_viewport(*document_element, *m_layout_root);
@@ -1357,24 +1382,25 @@ void Document::update_layout(UpdateLayoutReason reason)
         }
     }
 
+    // OPTIMIZATION: This is done in a single pre-order traversal of the layout tree, which visits every containing block
+    //               before the boxes it contains. So by the time we get to an absolutely positioned box, the containing
+    //               blocks we walk through are up to date, and the box we add it to has already had its list cleared.
     m_layout_root->for_each_in_inclusive_subtree([&](auto& layout_node) {
         layout_node.recompute_containing_block({});
-        return TraversalDecision::Continue;
-    });
 
-    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        if (child.needs_layout_update()) {
-            child.reset_cached_intrinsic_sizes();
-        }
-        child.clear_contained_abspos_children();
-        return TraversalDecision::Continue;
-    });
+        auto* box = as_if<Layout::Box>(layout_node);
+        if (!box)
+            return TraversalDecision::Continue;
+
+        if (box->needs_layout_update())
+            box->reset_cached_intrinsic_sizes();
+        box->clear_contained_abspos_children();
 
-    // Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout
-    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        if (!child.is_absolutely_positioned())
+        // Assign each box that establishes a formatting context a list of absolutely positioned children it should
+        // take care of during layout.
+        if (!box->is_absolutely_positioned())
             return TraversalDecision::Continue;
-        if (auto containing_block = child.containing_block()) {
+        if (auto containing_block = box->containing_block()) {
             auto closest_box_that_establishes_formatting_context = containing_block;
             while (closest_box_that_establishes_formatting_context) {
                 if (closest_box_that_establishes_formatting_context == m_layout_root)
@@ -1385,7 +1411,7 @@ void Document::update_layout(UpdateLayoutReason reason)
                 closest_box_that_establishes_formatting_context = closest_box_that_establishes_formatting_context->containing_block();
             }
             VERIFY(closest_box_that_establishes_formatting_context);
-            closest_box_that_establishes_formatting_context->add_contained_abspos_child(child);
+            closest_box_that_establishes_formatting_context->add_contained_abspos_child(*box);
         }
         return TraversalDecision::Continue;
     });
@@ -1413,6 +1439,9 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     layout_state.commit(*m_layout_root);
 
+    ++s_layout_generation;
+    did_change_geometry();
+
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     inform_all_viewport_clients_about_the_current_viewport_rect();
 
@@ -1534,6 +1563,8 @@ void Document::update_style()
     if (!browsing_context())
         return;
 
+    TRACE_EVENT("style", "Document::update_style");
+
     update_animated_style_if_needed();
 
     // Associated with each top-level browsing context is a current transition generation that is incremented on each
@@ -1586,17 +1617,55 @@ void Document::update_animated_style_if_needed()
     m_needs_animated_style_update = false;
 }
 
+// Resolves the paint-only properties of the paintables generated by the element and its descendants, returning false
+// if they can't all be found from the element's layout subtree.
+static bool resolve_paint_only_properties_of_subtree(Element& element)
+{
+    auto layout_node = element.layout_node();
+    if (!layout_node || !layout_node->first_paintable())
+        return false;
+
+    bool found_all_paintables = true;
+    layout_node->for_each_in_inclusive_subtree([&](Layout::Node& node) {
+        // NOTE: Inline nodes that were split by a block have continuations outside of this subtree.
+        if (auto const* node_with_box_model_metrics = as_if<Layout::NodeWithStyleAndBoxModelMetrics>(node); node_with_box_model_metrics && node_with_box_model_metrics->continuation_of_node()) {
+            found_all_paintables = false;
+            return TraversalDecision::Break;
+        }
+        for (auto& paintable : node.paintables())
+            paintable.resolve_paint_properties();
+        return TraversalDecision::Continue;
+    });
+    return found_all_paintables;
+}
+
 void Document::update_paint_and_hit_testing_properties_if_needed()
 {
     if (auto* paintable = this->paintable()) {
         paintable->refresh_scroll_state();
     }
 
+    // OPTIMIZATION: If only some elements had their paint-only inputs changed, avoid resolving the paint-only
+    //               properties of the whole document.
+    if (!m_needs_to_resolve_paint_only_properties && !m_elements_needing_paint_only_properties_resolved.is_empty()) {
+        auto elements = move(m_elements_needing_paint_only_properties_resolved);
+        for (auto& element : elements) {
+            if (!resolve_paint_only_properties_of_subtree(element)) {
+                m_needs_to_resolve_paint_only_properties = true;
+                break;
+            }
+        }
+        if (!m_needs_to_resolve_paint_only_properties)
+            did_change_geometry();
+    }
+
     if (!m_needs_to_resolve_paint_only_properties)
         return;
     m_needs_to_resolve_paint_only_properties = false;
+    m_elements_needing_paint_only_properties_resolved.clear();
     if (auto* paintable = this->paintable()) {
         paintable->resolve_paint_only_properties();
+        did_change_geometry();
     }
 }
 
@@ -1960,7 +2029,7 @@ GC::Ref<NodeList> Document::get_elements_by_name(FlyString const& name)
 GC::Ref<HTMLCollection> Document::applets()
 {
     if (!m_applets)
-        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](auto&) { return false; });
+        m_applets = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](auto&) { return false; }, HTMLCollection::FilterDependencies::TreeStructure);
     return *m_applets;
 }
 
@@ -1970,7 +2039,7 @@ GC::Ref<HTMLCollection> Document::anchors()
     if (!m_anchors) {
         m_anchors = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLAnchorElement>(element) && element.name().has_value();
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructureAndAttributes);
     }
     return *m_anchors;
 }
@@ -1981,7 +2050,7 @@ GC::Ref<HTMLCollection> Document::images()
     if (!m_images) {
         m_images = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLImageElement>(element);
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_images;
 }
@@ -1992,7 +2061,7 @@ GC::Ref<HTMLCollection> Document::embeds()
     if (!m_embeds) {
         m_embeds = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLEmbedElement>(element);
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_embeds;
 }
@@ -2009,7 +2078,7 @@ GC::Ref<HTMLCollection> Document::links()
     if (!m_links) {
         m_links = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return (is<HTML::HTMLAnchorElement>(element) || is<HTML::HTMLAreaElement>(element)) && element.has_attribute(HTML::AttributeNames::href);
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructureAndAttributes);
     }
     return *m_links;
 }
@@ -2020,7 +2089,7 @@ GC::Ref<HTMLCollection> Document::forms()
     if (!m_forms) {
         m_forms = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLFormElement>(element);
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_forms;
 }
@@ -2031,7 +2100,7 @@ GC::Ref<HTMLCollection> Document::scripts()
     if (!m_scripts) {
         m_scripts = HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLScriptElement>(element);
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_scripts;
 }
@@ -4301,7 +4370,8 @@ void Document::unload(GC::Ptr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    // NOTE: We only do so if another document replaces oldDocument in its navigable, and not when the navigable is closed.
+    auto intend_to_store_in_bfcache = new_document && is_eligible_for_back_forward_cache();
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -4359,6 +4429,7 @@ void Document::unload(GC::Ptr<Document>)
     if (!m_salvageable) {
         // NOTE: Document is destroyed from Document::unload_a_document_and_its_descendants()
     }
+    // NOTE: Otherwise, Document::unload_a_document_and_its_descendants() stores it in the back/forward cache.
 
     // 20. Decrease oldDocument's unload counter by 1.
     m_unload_counter -= 1;
@@ -4397,6 +4468,7 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
     IGNORE_USE_IN_ESCAPING_LAMBDA size_t number_unloaded = 0;
 
     auto navigable = this->navigable();
+    auto document_state = navigable->active_session_history_entry()->document_state();
 
     Vector<GC::Root<HTML::Navigable>> descendant_navigables;
     for (auto& other_navigable : HTML::all_navigables()) {
@@ -4422,9 +4494,47 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
         return number_unloaded == unloaded_documents_count;
     }));
 
+    // NOTE: We only intend to keep documents without descendants in the back/forward cache, so if unloading left this
+    //       document salvageable, it stays alive in its session history entry instead of being destroyed.
+    if (m_salvageable) {
+        VERIFY(descendant_navigables.is_empty());
+        navigable->traversable_navigable()->store_in_back_forward_cache(*document_state);
+
+        if (after_all_unloads)
+            after_all_unloads->function()();
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
+// NOTE: Whether we intend to keep a document in the back/forward cache is implementation-defined. We only keep documents
+//       that are easy to suspend and restore: those that have finished loading, are not embedding other documents, and
+//       are not holding on to connections that would keep receiving data while the document is suspended.
+bool Document::is_eligible_for_back_forward_cache()
+{
+    if (!m_salvageable || is_initial_about_blank())
+        return false;
+
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable())
+        return false;
+
+    if (m_readiness != HTML::DocumentReadyState::Complete || !document_tree_child_navigables().is_empty())
+        return false;
+
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+
+    // NOTE: Pages that listen for unload events expect them to be fired, which never happens for cached documents.
+    if (window.has_event_listener(HTML::EventNames::unload))
+        return false;
+
+    if (window.has_registered_web_sockets() || window.has_registered_event_sources())
+        return false;
+
+    return true;
+}
+
 // https://html.spec.whatwg.org/multipage/iframe-embed-object.html#allowed-to-use
 bool Document::is_allowed_to_use_feature(PolicyControlledFeature feature) const
 {
@@ -4500,6 +4610,19 @@ GC::Ref<DOM::Document> Document::appropriate_template_contents_owner_document()
 
 String Document::dump_accessibility_tree_as_json()
 {
+    Optional<UniqueNodeID> focused_element_id;
+    if (m_focused_element)
+        focused_element_id = m_focused_element->unique_id();
+
+    if (m_accessibility_tree_cache.has_value()) {
+        auto const& cache = *m_accessibility_tree_cache;
+        if (cache.dom_tree_version == m_dom_tree_version
+            && cache.character_data_version == m_character_data_version
+            && cache.layout_tree_version == m_layout_tree_version
+            && cache.focused_element_id == focused_element_id)
+            return cache.json;
+    }
+
     StringBuilder builder;
     auto accessibility_tree = AccessibilityTreeNode::create(this, nullptr);
     build_accessibility_tree(*&accessibility_tree);
@@ -4514,7 +4637,16 @@ String Document::dump_accessibility_tree_as_json()
     }
 
     MUST(json.finish());
-    return MUST(builder.to_string());
+
+    auto result = MUST(builder.to_string());
+    m_accessibility_tree_cache = AccessibilityTreeCache {
+        .dom_tree_version = m_dom_tree_version,
+        .character_data_version = m_character_data_version,
+        .layout_tree_version = m_layout_tree_version,
+        .focused_element_id = focused_element_id,
+        .json = result,
+    };
+    return result;
 }
 
 // https://dom.spec.whatwg.org/#dom-document-createattribute
@@ -4612,6 +4744,8 @@ void Document::unregister_viewport_client(ViewportClient& client)
 
 void Document::inform_all_viewport_clients_about_the_current_viewport_rect()
 {
+    did_change_geometry();
+
     for (auto* client : m_viewport_clients)
         client->did_set_viewport_rect(viewport_rect());
 }
@@ -4746,6 +4880,13 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
     auto intersection_observers = GC::RootVector { heap(), m_intersection_observers.values() };
 
     for (auto& observer : intersection_observers) {
+        // OPTIMIZATION: If nothing was laid out, scrolled or moved, and no target was added since we last ran these
+        //               steps for this observer, every target would get the same thresholdIndex and isIntersecting as
+        //               last time, so no entries would be queued.
+        if (!observer->needs_to_update_observations())
+            continue;
+        observer->did_update_observations({});
+
         // 1. Let rootBounds be observer’s root intersection rectangle.
         auto root_bounds = observer->root_intersection_rectangle();
 
@@ -5224,8 +5365,50 @@ void Document::update_for_history_step_application(GC::Ref<HTML::SessionHistoryE
     // 9. Otherwise, if documentsEntryChanged is false and doNotReactivate is false, then:
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
-        // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 1. Assert: entriesForNavigationAPI is given.
+        VERIFY(entries_for_navigation_api.has_value());
+
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate(entry, *entries_for_navigation_api);
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& entries_for_navigation_api)
+{
+    // NOTE: The document is being restored from the back/forward cache, so it must not be evicted from it anymore.
+    if (auto navigable = this->navigable())
+        navigable->traversable_navigable()->remove_from_back_forward_cache(*this);
+
+    // NOTE: Our layout tree was torn down when we were suspended, so we need to be laid out and painted again.
+    set_needs_display();
+
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset algorithm for formControl.
+
+    // FIXME: 2. If document's suspended timer handles is not empty:
+    //           1. Assert: document's suspension time is not zero.
+    //           2. Let suspendDuration be the current high resolution time minus document's suspension time.
+    //           3. Let activeTimers be document's relevant global object's map of active timers.
+    //           4. For each handle in document's suspended timer handles, if activeTimers[handle] exists, then increase activeTimers[handle] by suspendDuration.
+    // NOTE: Timers keep running while the document is suspended, but the tasks they queue only run once it is fully active again.
+
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+
+    // 3. Update the navigation API entries for reactivation given document's relevant global object's navigation API, entriesForNavigationAPI, and reactivatedEntry.
+    window.navigation()->update_the_navigation_api_entries_for_reactivation(entries_for_navigation_api, reactivated_entry);
+
+    // 4. If document's current document readiness is "complete", and document's page showing is false, then:
+    if (m_readiness == HTML::DocumentReadyState::Complete && !m_page_showing) {
+        // 1. Set document's page showing to true.
+        set_page_showing(true);
+
+        // FIXME: 2. Set document's has been revealed to false.
+
+        // 3. Update the visibility state of document to "visible".
+        update_the_visibility_state(HTML::VisibilityState::Visible);
+
+        // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+        window.fire_a_page_transition_event(HTML::EventNames::pageshow, true);
     }
 }
 
@@ -5883,15 +6066,15 @@ size_t Document::broadcast_active_resize_observations()
             switch (observation->observed_box()) {
             case Bindings::ResizeObserverBoxOptions::BorderBox:
                 // Matching sizes are entry.borderBoxSize if observation.observedBox is "border-box"
-                observation->last_reported_sizes() = entry->border_box_size();
+                observation->set_last_reported_sizes(entry->border_box_size());
                 break;
             case Bindings::ResizeObserverBoxOptions::ContentBox:
                 // Matching sizes are entry.contentBoxSize if observation.observedBox is "content-box"
-                observation->last_reported_sizes() = entry->content_box_size();
+                observation->set_last_reported_sizes(entry->content_box_size());
                 break;
             case Bindings::ResizeObserverBoxOptions::DevicePixelContentBox:
                 // Matching sizes are entry.devicePixelContentBoxSize if observation.observedBox is "device-pixel-content-box"
-                observation->last_reported_sizes() = entry->device_pixel_content_box_size();
+                observation->set_last_reported_sizes(entry->device_pixel_content_box_size());
                 break;
             default:
                 VERIFY_NOT_REACHED();
@@ -6187,6 +6370,9 @@ GC::Ptr<HTML::HTMLElement> Document::topmost_auto_or_hint_popover()
 
 void Document::set_needs_to_refresh_scroll_state(bool b)
 {
+    if (b)
+        did_change_geometry();
+
     if (auto* paintable = this->paintable())
         paintable->set_needs_to_refresh_scroll_state(b);
 }
@@ -6437,11 +6623,59 @@ void Document::invalidate_display_list()
     if (!navigable)
         return;
 
+    // NOTE: Our display list is embedded in the one of our container's document, which only needs to point to our new
+    //       display list once it has been recorded.
     if (auto container = navigable->container()) {
-        container->document().invalidate_display_list();
+        container->document().invalidate_nested_display_lists();
     }
 }
 
+void Document::invalidate_nested_display_lists()
+{
+    m_needs_nested_display_list_update = true;
+
+    auto navigable = this->navigable();
+    if (!navigable)
+        return;
+
+    if (auto container = navigable->container()) {
+        container->document().invalidate_nested_display_lists();
+    }
+}
+
+void Document::did_record_nested_display_list(Document& hosted_document, Painting::DisplayList& display_list, HTML::PaintConfig paint_config)
+{
+    m_nested_display_lists.append({ hosted_document, display_list, move(paint_config) });
+}
+
+void Document::update_nested_display_lists()
+{
+    m_needs_nested_display_list_update = false;
+    if (!m_cached_display_list)
+        return;
+
+    HashMap<Painting::DisplayList const*, NonnullRefPtr<Painting::DisplayList>> replaced_display_lists;
+    for (auto& nested_display_list : m_nested_display_lists) {
+        RefPtr<Painting::DisplayList> display_list;
+        if (nested_display_list.hosted_document)
+            display_list = nested_display_list.hosted_document->record_display_list(nested_display_list.paint_config);
+
+        // If a nested navigable went away, our display list has to be recorded again.
+        if (!display_list) {
+            m_cached_display_list.clear();
+            return;
+        }
+
+        if (display_list == nested_display_list.display_list)
+            continue;
+        replaced_display_lists.set(nested_display_list.display_list.ptr(), *display_list);
+        nested_display_list.display_list = display_list.release_nonnull();
+    }
+
+    if (!replaced_display_lists.is_empty())
+        m_cached_display_list = m_cached_display_list->with_nested_display_lists_replaced(replaced_display_lists);
+}
+
 RefPtr<Painting::DisplayList> Document::cached_display_list() const
 {
     return m_cached_display_list;
@@ -6450,9 +6684,17 @@ RefPtr<Painting::DisplayList> Document::cached_display_list() const
 RefPtr<Painting::DisplayList> Document::record_display_list(HTML::PaintConfig config)
 {
     if (m_cached_display_list && m_cached_display_list_paint_config == config) {
-        return m_cached_display_list;
+        if (m_needs_nested_display_list_update)
+            update_nested_display_lists();
+        if (m_cached_display_list)
+            return m_cached_display_list;
     }
 
+    TRACE_EVENT("paint", "Document::record_display_list");
+
+    m_nested_display_lists.clear();
+    m_needs_nested_display_list_update = false;
+
     auto display_list = Painting::DisplayList::create(page().client().device_pixels_per_css_pixel());
     Painting::DisplayListRecorder display_list_recorder(display_list);
 
@@ -6617,6 +6859,26 @@ ElementByIdMap& Document::element_by_id() const
     return *m_element_by_id;
 }
 
+// Scripts tend to query the same handful of selectors over and over, so this is plenty.
+static constexpr size_t MAXIMUM_PARSED_QUERY_SELECTORS = 256;
+
+Optional<CSS::SelectorList> Document::parse_selector_for_query(StringView selector_text) const
+{
+    if (auto selectors = m_parsed_query_selectors.get(selector_text); selectors.has_value())
+        return selectors.copy();
+
+    auto selectors = parse_selector(CSS::Parser::ParsingParams { *this }, selector_text);
+    if (!selectors.has_value())
+        return {};
+
+    // NOTE: Rather than tracking which entries were used least recently, we simply start over once the cache is full.
+    if (m_parsed_query_selectors.size() >= MAXIMUM_PARSED_QUERY_SELECTORS)
+        m_parsed_query_selectors.clear();
+    m_parsed_query_selectors.set(MUST(String::from_utf8(selector_text)), *selectors);
+
+    return selectors;
+}
+
 String Document::dump_display_list()
 {
     update_layout(UpdateLayoutReason::DumpDisplayList);
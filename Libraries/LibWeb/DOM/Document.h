@@ -36,10 +36,12 @@
 #include <LibWeb/HTML/History.h>
 #include <LibWeb/HTML/LazyLoadingElement.h>
 #include <LibWeb/HTML/NavigationType.h>
+#include <LibWeb/HTML/Preload.h>
 #include <LibWeb/HTML/SandboxingFlagSet.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/VisibilityState.h>
 #include <LibWeb/InvalidateDisplayList.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
 #include <LibWeb/TrustedTypes/InjectionSink.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -56,6 +58,7 @@ enum class QuirksMode {
 #define ENUMERATE_INVALIDATE_LAYOUT_TREE_REASONS(X)       \
     X(DocumentAddAnElementToTheTopLayer)                  \
     X(DocumentRequestAnElementToBeRemovedFromTheTopLayer) \
+    X(InternalsMeasureRendering)                          \
     X(ShadowRootSetInnerHTML)
 
 enum class InvalidateLayoutTreeReason {
@@ -109,6 +112,7 @@ enum class InvalidateLayoutTreeReason {
     X(HTMLInputElementHeight)              \
     X(HTMLInputElementWidth)               \
     X(InternalsHitTest)                    \
+    X(InternalsMeasureRendering)           \
     X(MediaQueryListMatches)               \
     X(NodeNameOrDescription)               \
     X(RangeGetClientRects)                 \
@@ -195,6 +199,11 @@ public:
     u64 character_data_version() const { return m_character_data_version; }
     void bump_character_data_version() { ++m_character_data_version; }
 
+    // AD-HOC: Set once a live collection that keeps its cache across unrelated DOM mutations is rooted in this document,
+    //         so that DOM mutations only need to look for such collections in documents that have them.
+    bool has_scoped_live_collections() const { return m_has_scoped_live_collections; }
+    void set_has_scoped_live_collections() { m_has_scoped_live_collections = true; }
+
     WebIDL::ExceptionOr<void> populate_with_html_head_and_body();
 
     GC::Ptr<Selection::Selection> get_selection() const;
@@ -655,6 +664,9 @@ public:
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document-and-its-descendants
     void unload_a_document_and_its_descendants(GC::Ptr<Document> new_document, GC::Ptr<GC::Function<void()>> after_all_unloads = {});
 
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate(GC::Ref<HTML::SessionHistoryEntry> reactivated_entry, Vector<GC::Ref<HTML::SessionHistoryEntry>> const& entries_for_navigation_api);
+
     // https://html.spec.whatwg.org/multipage/dom.html#active-parser
     GC::Ptr<HTML::HTMLParser> active_parser();
 
@@ -684,6 +696,8 @@ public:
 
     void did_stop_being_active_document_in_navigable();
 
+    bool is_eligible_for_back_forward_cache();
+
     String dump_accessibility_tree_as_json();
 
     void make_active();
@@ -703,6 +717,17 @@ public:
 
     void run_the_update_intersection_observations_steps(HighResolutionTime::DOMHighResTimeStamp time);
 
+    // OPTIMIZATION: These are incremented whenever the layout of any document is updated, and whenever anything may have
+    //               moved without a layout update (by scrolling, resizing the viewport or changing paint-only properties
+    //               such as transforms). Observers compare them to the values they last saw, so they can skip recomputing
+    //               observations of targets whose size or position can't have changed.
+    static u64 layout_generation();
+    static u64 geometry_generation();
+    static void did_change_geometry();
+
+    // https://w3c.github.io/long-animation-frames/#current-frame-timing-info
+    Optional<LongAnimationFrames::FrameTimingInfo>& current_frame_timing_info() { return m_current_frame_timing_info; }
+
     void start_intersection_observing_a_lazy_loading_element(Element&);
     void stop_intersection_observing_a_lazy_loading_element(Element&);
 
@@ -766,6 +791,9 @@ public:
     GC::Ptr<Element const> scrolling_element() const;
 
     void set_needs_to_resolve_paint_only_properties() { m_needs_to_resolve_paint_only_properties = true; }
+    // Only resolves the paint-only properties of the paintables generated by the element and its descendants, which
+    // is enough when nothing but their own paint-only inputs have changed.
+    void set_needs_to_resolve_paint_only_properties_of_subtree(Element& element) { m_elements_needing_paint_only_properties_resolved.set(element); }
     void set_needs_animated_style_update() { m_needs_animated_style_update = true; }
 
     virtual JS::Value named_item_value(FlyString const& name) const override;
@@ -839,6 +867,7 @@ public:
     RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig);
 
     void invalidate_display_list();
+    void did_record_nested_display_list(Document& hosted_document, Painting::DisplayList&, HTML::PaintConfig);
 
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
@@ -904,9 +933,15 @@ public:
 
     ElementByIdMap& element_by_id() const;
 
+    // Parses the selectors passed to querySelector(), matches() and friends, reusing the result for selector text that
+    // was parsed before.
+    Optional<CSS::SelectorList> parse_selector_for_query(StringView selector_text) const;
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
+    auto& map_of_preloaded_resources() { return m_map_of_preloaded_resources; }
+
     String dump_display_list();
 
     StyleInvalidator& style_invalidator() { return m_style_invalidator; }
@@ -976,6 +1011,7 @@ private:
     GC::Ptr<HTML::BrowsingContext> m_browsing_context;
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
+    mutable HashMap<String, CSS::SelectorList> m_parsed_query_selectors;
 
     GC::Ptr<HTML::Window> m_window;
 
@@ -1056,6 +1092,9 @@ private:
     // https://html.spec.whatwg.org/multipage/semantics.html#script-blocking-style-sheet-set
     HashTable<GC::Ref<DOM::Element>> m_script_blocking_style_sheet_set;
 
+    // https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+    HashMap<HTML::PreloadKey, GC::Ref<HTML::PreloadEntry>> m_map_of_preloaded_resources;
+
     GC::Ptr<HTML::History> m_history;
 
     size_t m_number_of_things_delaying_the_load_event { 0 };
@@ -1123,6 +1162,9 @@ private:
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#completely-loaded-time
     Optional<AK::UnixDateTime> m_completely_loaded_time;
 
+    // https://w3c.github.io/long-animation-frames/#current-frame-timing-info
+    Optional<LongAnimationFrames::FrameTimingInfo> m_current_frame_timing_info;
+
     // https://html.spec.whatwg.org/multipage/dom.html#concept-document-navigation-id
     Optional<String> m_navigation_id;
 
@@ -1204,6 +1246,7 @@ private:
     bool m_design_mode_enabled { false };
 
     bool m_needs_to_resolve_paint_only_properties { true };
+    HashTable<GC::Ref<Element>> m_elements_needing_paint_only_properties_resolved;
 
     mutable GC::Ptr<WebIDL::ObservableArray> m_adopted_style_sheets;
 
@@ -1216,6 +1259,23 @@ private:
     u64 m_dom_tree_version { 0 };
     u64 m_character_data_version { 0 };
 
+    // AD-HOC: This number increments whenever the layout tree is built or torn down, as the accessibility tree depends
+    //         on which elements have layout nodes.
+    u64 m_layout_tree_version { 0 };
+
+    // OPTIMIZATION: The accessibility tree is requested repeatedly while it is being inspected, but it only changes when
+    //               the DOM, the layout tree, or the focused element does. So we keep the last serialized tree around
+    //               along with the state it was built from, and only walk the document again once that state changes.
+    struct AccessibilityTreeCache {
+        u64 dom_tree_version { 0 };
+        u64 character_data_version { 0 };
+        u64 layout_tree_version { 0 };
+        Optional<UniqueNodeID> focused_element_id;
+        String json;
+    };
+    Optional<AccessibilityTreeCache> m_accessibility_tree_cache;
+    bool m_has_scoped_live_collections { false };
+
     // https://drafts.csswg.org/css-position-4/#document-top-layer
     // Documents have a top layer, an ordered set containing elements from the document.
     // Elements in the top layer do not lay out normally based on their position in the document;
@@ -1247,9 +1307,22 @@ private:
 
     bool m_enable_cookies_on_file_domains { false };
 
+    void invalidate_nested_display_lists();
+    void update_nested_display_lists();
+
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
 
+    // The display lists of nested navigables that are embedded in our cached display list. When only these change, the
+    // cached display list is updated to point to their new display lists, instead of being recorded again.
+    struct NestedDisplayList {
+        WeakPtr<Document> hosted_document;
+        NonnullRefPtr<Painting::DisplayList> display_list;
+        HTML::PaintConfig paint_config;
+    };
+    Vector<NestedDisplayList> m_nested_display_lists;
+    bool m_needs_nested_display_list_update { false };
+
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
 
@@ -10,6 +10,7 @@
 #include <AK/LexicalPath.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/DocumentLoading.h>
 #include <LibWeb/HTML/HTMLHeadElement.h>
@@ -25,6 +26,9 @@
 
 namespace Web {
 
+// Documents at least this large are decoded on a background thread before being handed to the HTML parser.
+static constexpr size_t MINIMUM_SIZE_FOR_BACKGROUND_DECODING = 64 * KiB;
+
 // Replaces a document's content with a simple error message.
 static void convert_to_xml_error_document(DOM::Document& document, Utf16String error_string)
 {
@@ -93,6 +97,31 @@ static WebIDL::ExceptionOr<GC::Ref<DOM::Document>> load_html_document(HTML::Navi
     else {
         // FIXME: Parse as we receive the document data, instead of waiting for the whole document to be fetched first.
         auto process_body = GC::create_function(document->heap(), [document, url = navigation_params.response->url().value(), mime_type = navigation_params.response->header_list()->extract_mime_type()](ByteBuffer data) {
+            // OPTIMIZATION: Decoding a large document takes a while, and doesn't depend on anything the main thread does.
+            //               So we do that on a background thread, leaving only tokenization and tree construction (which
+            //               are tied to script execution) for the main thread.
+            if (data.size() >= MINIMUM_SIZE_FOR_BACKGROUND_DECODING) {
+                auto encoding = HTML::HTMLParser::encoding_for_uncertain_input(document, data, mime_type);
+
+                using DecodeJob = Threading::BackgroundAction<HTML::HTMLTokenizer::DecodedInput>;
+                DecodeJob::construct(
+                    [data = move(data), encoding = ByteString { encoding.view() }](auto&) -> ErrorOr<HTML::HTMLTokenizer::DecodedInput> {
+                        return HTML::HTMLTokenizer::decode_input(data, encoding);
+                    },
+                    [document = GC::make_root(document), url = url, encoding = move(encoding)](HTML::HTMLTokenizer::DecodedInput decoded_input) mutable -> ErrorOr<void> {
+                        // NOTE: The job may be destroyed on the background thread, so we make sure that nothing that
+                        //       must only be touched on the main thread outlives this callback.
+                        auto parser_document = move(document);
+                        auto parser_url = move(url);
+                        auto parser_encoding = move(encoding);
+
+                        auto parser = HTML::HTMLParser::create_with_decoded_input(*parser_document, move(decoded_input), parser_encoding);
+                        parser->run(parser_url);
+                        return {};
+                    });
+                return;
+            }
+
             Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(document->heap(), [document = document, data = move(data), url = url, mime_type] {
                 auto parser = HTML::HTMLParser::create_with_uncertain_encoding(document, data, mime_type);
                 parser->run(url);
@@ -659,6 +659,9 @@ GC::Ptr<Layout::NodeWithStyle> Element::create_layout_node_for_display_type(DOM:
 
 void Element::run_attribute_change_steps(FlyString const& local_name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_)
 {
+    if (old_value != value)
+        notify_live_collections_about_attribute_change({}, local_name);
+
     attribute_changed(local_name, old_value, value, namespace_);
 
     if (old_value != value) {
@@ -765,8 +768,13 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
     if (invalidation.is_none())
         return invalidation;
 
-    if (invalidation.repaint)
-        document().set_needs_to_resolve_paint_only_properties();
+    if (invalidation.repaint) {
+        // NOTE: Paintables of our ::backdrop are generated outside of our layout subtree.
+        if (invalidation.relayout || invalidation.rebuild_layout_tree || m_rendered_in_top_layer)
+            document().set_needs_to_resolve_paint_only_properties();
+        else
+            document().set_needs_to_resolve_paint_only_properties_of_subtree(*this);
+    }
 
     if (!invalidation.rebuild_layout_tree && layout_node()) {
         // If we're keeping the layout tree, we can just apply the new style to the existing layout tree.
@@ -976,7 +984,7 @@ GC::Ptr<ShadowRoot> Element::shadow_root_for_bindings() const
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -996,7 +1004,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_query(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -2034,9 +2042,47 @@ bool Element::is_actually_disabled() const
     return false;
 }
 
+// Returns whether the HTML fragment parsing algorithm would produce nothing but a single Text node containing markup (or
+// nothing at all, if markup is empty) for the given context element.
+static bool html_fragment_parses_as_plain_text(Element const& context, StringView markup)
+{
+    // Anything that could start a tag, a comment or a character reference, as well as anything that is changed by the
+    // preprocessing of the input stream, requires the full parser.
+    for (auto byte : markup.bytes()) {
+        if (byte == '<' || byte == '&' || byte == '\r' || byte == '\0')
+            return false;
+    }
+    if (markup.starts_with("\xEF\xBB\xBF"sv))
+        return false;
+
+    if (context.namespace_uri() != Namespace::HTML)
+        return false;
+
+    // The insertion modes these context elements reset the parser to don't insert character tokens as children of the
+    // root element.
+    return !context.local_name().is_one_of(
+        HTML::TagNames::html,
+        HTML::TagNames::frameset,
+        HTML::TagNames::table,
+        HTML::TagNames::tbody,
+        HTML::TagNames::thead,
+        HTML::TagNames::tfoot,
+        HTML::TagNames::tr,
+        HTML::TagNames::colgroup);
+}
+
 // https://html.spec.whatwg.org/multipage/dynamic-markup-insertion.html#fragment-parsing-algorithm-steps
 WebIDL::ExceptionOr<GC::Ref<DOM::DocumentFragment>> Element::parse_fragment(StringView markup)
 {
+    // OPTIMIZATION: Frameworks frequently set innerHTML to plain text. The result of parsing that is known without
+    //               creating a temporary document and running the tokenizer and tree builder over it.
+    if (!document().is_xml_document() && html_fragment_parses_as_plain_text(*this, markup)) {
+        auto fragment = realm().create<DOM::DocumentFragment>(document());
+        if (!markup.is_empty())
+            TRY(fragment->append_child(document().create_text_node(Utf16String::from_utf8(markup))));
+        return fragment;
+    }
+
     // 1. Let algorithm be the HTML fragment parsing algorithm.
     auto algorithm = HTML::HTMLParser::parse_html_fragment;
 
@@ -3047,9 +3093,21 @@ PseudoElement& Element::ensure_pseudo_element(CSS::PseudoElement type) const
 }
 
 void Element::set_custom_properties(Optional<CSS::PseudoElement> pseudo_element, HashMap<FlyString, CSS::StyleProperty> custom_properties)
+{
+    set_custom_property_data(pseudo_element, CSS::CustomPropertyData::create(move(custom_properties)));
+}
+
+HashMap<FlyString, CSS::StyleProperty> const& Element::custom_properties(Optional<CSS::PseudoElement> pseudo_element) const
+{
+    if (auto custom_property_data = this->custom_property_data(pseudo_element))
+        return custom_property_data->values();
+    return CSS::CustomPropertyData::empty_values();
+}
+
+void Element::set_custom_property_data(Optional<CSS::PseudoElement> pseudo_element, RefPtr<CSS::CustomPropertyData const> custom_property_data)
 {
     if (!pseudo_element.has_value()) {
-        m_custom_properties = move(custom_properties);
+        m_custom_property_data = move(custom_property_data);
         return;
     }
 
@@ -3057,20 +3115,18 @@ void Element::set_custom_properties(Optional<CSS::PseudoElement> pseudo_element,
         return;
     }
 
-    ensure_pseudo_element(pseudo_element.value()).set_custom_properties(move(custom_properties));
+    ensure_pseudo_element(pseudo_element.value()).set_custom_property_data(move(custom_property_data));
 }
 
-HashMap<FlyString, CSS::StyleProperty> const& Element::custom_properties(Optional<CSS::PseudoElement> pseudo_element) const
+RefPtr<CSS::CustomPropertyData const> Element::custom_property_data(Optional<CSS::PseudoElement> pseudo_element) const
 {
-    static HashMap<FlyString, CSS::StyleProperty> s_empty_custom_properties;
-
     if (!pseudo_element.has_value())
-        return m_custom_properties;
+        return m_custom_property_data;
 
     if (!CSS::Selector::PseudoElementSelector::is_known_pseudo_element_type(pseudo_element.value()))
-        return s_empty_custom_properties;
+        return nullptr;
 
-    return ensure_pseudo_element(pseudo_element.value()).custom_properties();
+    return ensure_pseudo_element(pseudo_element.value()).custom_property_data();
 }
 
 // https://drafts.csswg.org/cssom-view/#dom-element-scroll
@@ -3228,11 +3284,9 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
     }
 
     // 5. If the contentVisibilityAuto dictionary member of options is true and an ancestor of this in the flat tree skips its contents due to content-visibility: auto, return false.
-    // FIXME: Currently we do not skip any content if content-visibility is auto: https://drafts.csswg.org/css-contain-2/#proximity-to-the-viewport
-    auto const skipped_contents_due_to_content_visibility_auto = false;
-    if (options->content_visibility_auto && skipped_contents_due_to_content_visibility_auto) {
-        for (auto* element = this; element; element = element->parent_element()) {
-            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto)
+    if (options->content_visibility_auto) {
+        for (auto element = parent_element(); element; element = element->parent_element()) {
+            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto && element->skips_its_contents())
                 return false;
         }
     }
@@ -3254,8 +3308,13 @@ void Element::determine_proximity_to_the_viewport()
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
     // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+    if (paintable_box()->absolute_rect().intersects(viewport_rect)) {
+        // NOTE: If we skipped the contents of this element so far, its layout subtree has to be built now.
+        if (m_proximity_to_the_viewport != ProximityToTheViewport::CloseToTheViewport && !m_has_rendered_content_visibility_auto_contents)
+            set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::ContentVisibilityAutoProximityChange);
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+        return;
+    }
 
     // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
     //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
@@ -3286,7 +3345,7 @@ bool Element::is_relevant_to_the_user()
         return true;
 
     // Either the element or its contents are selected, where selection is described in the selection API.
-    if (document().get_selection()->contains_node(*this, true))
+    if (auto selection = document().get_selection(); selection && selection->contains_node(*this, true))
         return true;
 
     // Either the element or its contents are placed in the top layer.
@@ -3318,8 +3377,16 @@ bool Element::skips_its_contents()
 
     // https://drafts.csswg.org/css-contain-2/#valdef-content-visibility-auto
     // If the element is not relevant to the user, it also skips its contents.
-    if (computed_properties()->content_visibility() == CSS::ContentVisibility::Auto && !this->is_relevant_to_the_user()) {
-        return true;
+    if (computed_properties()->content_visibility() == CSS::ContentVisibility::Auto) {
+        // AD-HOC: We don't support contain-intrinsic-size yet, so an element that skips its contents collapses to
+        //         the size of an empty box. If elements that have already been rendered started skipping their
+        //         contents again once they are far away from the viewport, they would shift the content around them,
+        //         so we only skip the contents of elements that have not been relevant to the user yet.
+        if (m_has_rendered_content_visibility_auto_contents)
+            return false;
+        if (!is_relevant_to_the_user())
+            return true;
+        m_has_rendered_content_visibility_auto_contents = true;
     }
 
     return false;
@@ -3476,6 +3543,15 @@ IntersectionObserver::IntersectionObserverRegistration& Element::get_intersectio
     return *registration_iterator;
 }
 
+bool Element::has_intersection_observer_registration(IntersectionObserver::IntersectionObserver const& observer) const
+{
+    if (!m_registered_intersection_observers)
+        return false;
+    return m_registered_intersection_observers->first_matching([&observer](IntersectionObserver::IntersectionObserverRegistration const& entry) {
+        return entry.observer.ptr() == &observer;
+    }).has_value();
+}
+
 CSSPixelPoint Element::scroll_offset(Optional<CSS::PseudoElement> pseudo_element_type) const
 {
     if (pseudo_element_type.has_value()) {
@@ -16,6 +16,7 @@
 #include <LibWeb/Bindings/ShadowRootPrototype.h>
 #include <LibWeb/CSS/CascadedProperties.h>
 #include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/CustomPropertyData.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleInvalidation.h>
 #include <LibWeb/CSS/StyleProperty.h>
@@ -81,7 +82,7 @@ struct CustomElementCallbackReaction {
 
 // https://dom.spec.whatwg.org/#concept-element-custom-element-state
 // An element’s custom element state is one of "undefined", "failed", "uncustomized", "precustomized", or "custom".
-enum class CustomElementState {
+enum class CustomElementState : u8 {
     Undefined,
     Failed,
     Uncustomized,
@@ -91,7 +92,7 @@ enum class CustomElementState {
 
 // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
 // An element that has content-visibility: auto is in one of three states when it comes to its proximity to the viewport:
-enum class ProximityToTheViewport {
+enum class ProximityToTheViewport : u8 {
     // - The element is close to the viewport:
     CloseToTheViewport,
     // - The element is far away from the viewport:
@@ -257,6 +258,8 @@ public:
 
     void set_custom_properties(Optional<CSS::PseudoElement>, HashMap<FlyString, CSS::StyleProperty> custom_properties);
     [[nodiscard]] HashMap<FlyString, CSS::StyleProperty> const& custom_properties(Optional<CSS::PseudoElement>) const;
+    void set_custom_property_data(Optional<CSS::PseudoElement>, RefPtr<CSS::CustomPropertyData const>);
+    [[nodiscard]] RefPtr<CSS::CustomPropertyData const> custom_property_data(Optional<CSS::PseudoElement>) const;
 
     bool style_uses_attr_css_function() const { return m_style_uses_attr_css_function; }
     void set_style_uses_attr_css_function() { m_style_uses_attr_css_function = true; }
@@ -380,6 +383,7 @@ public:
     void register_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserverRegistration);
     void unregister_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, GC::Ref<IntersectionObserver::IntersectionObserver>);
     IntersectionObserver::IntersectionObserverRegistration& get_intersection_observer_registration(Badge<DOM::Document>, IntersectionObserver::IntersectionObserver const&);
+    bool has_intersection_observer_registration(IntersectionObserver::IntersectionObserver const&) const;
 
     CSSPixelPoint scroll_offset(Optional<CSS::PseudoElement> type) const;
     void set_scroll_offset(Optional<CSS::PseudoElement> type, CSSPixelPoint offset);
@@ -390,7 +394,7 @@ public:
     };
     TranslationMode translation_mode() const;
 
-    enum class Dir {
+    enum class Dir : u8 {
         Ltr,
         Rtl,
         Auto,
@@ -573,16 +577,13 @@ private:
 
     GC::Ptr<CSS::CascadedProperties> m_cascaded_properties;
     GC::Ptr<CSS::ComputedProperties> m_computed_properties;
-    HashMap<FlyString, CSS::StyleProperty> m_custom_properties;
+    RefPtr<CSS::CustomPropertyData const> m_custom_property_data;
 
     using PseudoElementData = HashMap<CSS::PseudoElement, GC::Ref<PseudoElement>>;
     mutable OwnPtr<PseudoElementData> m_pseudo_element_data;
     PseudoElement& ensure_pseudo_element(CSS::PseudoElement) const;
 
-    Optional<CSS::PseudoElement> m_use_pseudo_element;
-
     Vector<FlyString> m_classes;
-    Optional<Dir> m_dir;
 
     Optional<FlyString> m_id;
     Optional<FlyString> m_name;
@@ -592,9 +593,6 @@ private:
     // NOTE: See the structs at the top of this header.
     OwnPtr<CustomElementReactionQueue> m_custom_element_reaction_queue;
 
-    // https://dom.spec.whatwg.org/#concept-element-custom-element-state
-    CustomElementState m_custom_element_state { CustomElementState::Undefined };
-
     // https://dom.spec.whatwg.org/#concept-element-custom-element-definition
     GC::Ptr<HTML::CustomElementDefinition> m_custom_element_definition;
 
@@ -615,6 +613,33 @@ private:
 
     CSSPixelPoint m_scroll_offset;
 
+    size_t m_sibling_invalidation_distance { 0 };
+
+    OwnPtr<CSS::CountersSet> m_counters_set;
+
+    // https://html.spec.whatwg.org/multipage/grouping-content.html#ordinal-value
+    Optional<i32> m_ordinal_value;
+
+    // NOTE: The small members below are kept together at the end to avoid padding between them and the larger ones.
+
+    // https://dom.spec.whatwg.org/#concept-element-custom-element-state
+    CustomElementState m_custom_element_state { CustomElementState::Undefined };
+
+    // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
+    ProximityToTheViewport m_proximity_to_the_viewport { ProximityToTheViewport::NotDetermined };
+
+    Optional<CSS::PseudoElement> m_use_pseudo_element;
+    Optional<Dir> m_dir;
+
+    // https://w3c.github.io/webappsec-csp/#is-element-nonceable
+    // AD-HOC: We need to know the element had a duplicate attribute when it was created from the HTML parser.
+    //         However, there currently isn't any specified way to do this, so we store a flag on the token, which is
+    //         then passed down to here. This is used by Content Security Policy to disable the nonce attribute if this
+    //         flag is set.
+    bool m_had_duplicate_attribute_during_tokenization { false };
+
+    bool m_is_contained_in_list_subtree { false };
+
     bool m_in_top_layer : 1 { false };
     bool m_rendered_in_top_layer : 1 { false };
     bool m_style_uses_attr_css_function : 1 { false };
@@ -626,24 +651,7 @@ private:
     bool m_affected_by_sibling_position_or_count_pseudo_class : 1 { false };
     bool m_affected_by_nth_child_pseudo_class : 1 { false };
     bool m_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator : 1 { false };
-
-    size_t m_sibling_invalidation_distance { 0 };
-
-    // https://w3c.github.io/webappsec-csp/#is-element-nonceable
-    // AD-HOC: We need to know the element had a duplicate attribute when it was created from the HTML parser.
-    //         However, there currently isn't any specified way to do this, so we store a flag on the token, which is
-    //         then passed down to here. This is used by Content Security Policy to disable the nonce attribute if this
-    //         flag is set.
-    bool m_had_duplicate_attribute_during_tokenization { false };
-
-    OwnPtr<CSS::CountersSet> m_counters_set;
-
-    // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
-    ProximityToTheViewport m_proximity_to_the_viewport { ProximityToTheViewport::NotDetermined };
-
-    // https://html.spec.whatwg.org/multipage/grouping-content.html#ordinal-value
-    Optional<i32> m_ordinal_value;
-    bool m_is_contained_in_list_subtree { false };
+    bool m_has_rendered_content_visibility_auto_contents : 1 { false };
 };
 
 template<>
@@ -17,6 +17,21 @@ public:
     void remove(FlyString const& element_id, Element&);
     GC::Ptr<Element> get(FlyString const& element_id) const;
 
+    // Invokes the callback for each live element with the given ID, in tree order.
+    template<typename Callback>
+    void for_each_element_with_id(FlyString const& element_id, Callback callback) const
+    {
+        auto maybe_elements_with_id = m_map.get(element_id);
+        if (!maybe_elements_with_id.has_value())
+            return;
+        for (auto const& element : *maybe_elements_with_id) {
+            if (!element.has_value())
+                continue;
+            if (callback(*element) == IterationDecision::Break)
+                return;
+        }
+    }
+
 private:
     HashMap<FlyString, Vector<WeakPtr<Element>>> m_map;
 };
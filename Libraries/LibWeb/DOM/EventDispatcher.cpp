@@ -121,6 +121,20 @@ bool EventDispatcher::inner_invoke(Event& event, Vector<GC::Root<DOM::DOMEventLi
     return found;
 }
 
+// The legacy event types from the table in step 9.2 of https://dom.spec.whatwg.org/#concept-event-listener-invoke
+static Optional<FlyString> legacy_event_type(FlyString const& type)
+{
+    if (type == HTML::EventNames::animationend)
+        return HTML::EventNames::webkitAnimationEnd;
+    if (type == HTML::EventNames::animationiteration)
+        return HTML::EventNames::webkitAnimationIteration;
+    if (type == HTML::EventNames::animationstart)
+        return HTML::EventNames::webkitAnimationStart;
+    if (type == HTML::EventNames::transitionend)
+        return HTML::EventNames::webkitTransitionEnd;
+    return {};
+}
+
 // https://dom.spec.whatwg.org/#concept-event-listener-invoke
 void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Phase phase, bool& legacy_output_did_listeners_throw)
 {
@@ -147,9 +161,17 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
     // 5. Initialize event’s currentTarget attribute to struct’s invocation target.
     event.set_current_target(struct_.invocation_target.ptr());
 
+    // NOTE: Only trusted events are retried with a legacy type, see step 9.
+    Optional<FlyString> legacy_type;
+    if (event.is_trusted())
+        legacy_type = legacy_event_type(event.type());
+
     // 6. Let listeners be a clone of event’s currentTarget attribute value’s event listener list.
     // NOTE: This avoids event listeners added after this point from being run. Note that removal still has an effect due to the removed field.
-    auto listeners = event.current_target()->event_listener_list();
+    // OPTIMIZATION: Inner invoke skips all listeners whose type doesn't match the event's type, so we leave out those
+    //               that match neither its type nor its legacy type. This avoids rooting every listener of every target
+    //               in the event path, e.g. for each pointermove event.
+    auto listeners = event.current_target()->event_listener_list_for_type(event.type(), legacy_type);
 
     // 7. Let invocationTargetInShadowTree be struct’s invocation-target-in-shadow-tree.
     bool invocation_target_in_shadow_tree = struct_.invocation_target_in_shadow_tree;
@@ -164,16 +186,9 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
 
         // 2. If event’s type attribute value is a match for any of the strings in the first column in the following table,
         //    set event’s type attribute value to the string in the second column on the same row as the matching string, and return otherwise.
-        if (event.type() == HTML::EventNames::animationend)
-            event.set_type(HTML::EventNames::webkitAnimationEnd);
-        else if (event.type() == HTML::EventNames::animationiteration)
-            event.set_type(HTML::EventNames::webkitAnimationIteration);
-        else if (event.type() == HTML::EventNames::animationstart)
-            event.set_type(HTML::EventNames::webkitAnimationStart);
-        else if (event.type() == HTML::EventNames::transitionend)
-            event.set_type(HTML::EventNames::webkitTransitionEnd);
-        else
+        if (!legacy_type.has_value())
             return;
+        event.set_type(legacy_type.release_value());
 
         // 3. Inner invoke with event, listeners, phase, invocationTargetInShadowTree, and legacyOutputDidListenersThrowFlag if given.
         inner_invoke(event, listeners, phase, invocation_target_in_shadow_tree, legacy_output_did_listeners_throw);
@@ -92,6 +92,20 @@ Vector<GC::Root<DOMEventListener>> EventTarget::event_listener_list()
     return list;
 }
 
+// Like event_listener_list(), but only clones the listeners that are registered for the given type, or for the legacy
+// type that a trusted event may be retried with.
+Vector<GC::Root<DOMEventListener>> EventTarget::event_listener_list_for_type(FlyString const& type, Optional<FlyString> const& legacy_type)
+{
+    Vector<GC::Root<DOMEventListener>> list;
+    if (!m_data)
+        return list;
+    for (auto& listener : m_data->event_listener_list) {
+        if (listener->type == type || listener->type == legacy_type)
+            list.append(*listener);
+    }
+    return list;
+}
+
 // https://dom.spec.whatwg.org/#concept-flatten-options
 static bool flatten_event_listener_options(Variant<EventListenerOptions, bool> const& options)
 {
@@ -44,6 +44,7 @@ public:
     void remove_an_event_listener(DOMEventListener&);
 
     Vector<GC::Root<DOMEventListener>> event_listener_list();
+    Vector<GC::Root<DOMEventListener>> event_listener_list_for_type(FlyString const& type, Optional<FlyString> const& legacy_type = {});
 
     virtual bool has_activation_behavior() const;
     virtual void activation_behavior(Event const&);
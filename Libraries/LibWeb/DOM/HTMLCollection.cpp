@@ -11,28 +11,33 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/ParentNode.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/Namespace.h>
 
 namespace Web::DOM {
 
 GC_DEFINE_ALLOCATOR(HTMLCollection);
 
-GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Function<bool(Element const&)> filter, FilterDependencies filter_dependencies)
 {
-    return root.realm().create<HTMLCollection>(root, scope, move(filter));
+    return root.realm().create<HTMLCollection>(root, scope, move(filter), filter_dependencies);
 }
 
-HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter, FilterDependencies filter_dependencies)
     : PlatformObject(root.realm())
     , m_root(root)
     , m_filter(move(filter))
     , m_scope(scope)
+    , m_filter_dependencies(filter_dependencies)
 {
     m_legacy_platform_object_flags = LegacyPlatformObjectFlags {
         .supports_indexed_properties = true,
         .supports_named_properties = true,
         .has_legacy_unenumerable_named_properties_interface_extended_attribute = true,
     };
+
+    if (m_filter_dependencies != FilterDependencies::Unknown)
+        root.register_live_collection({}, *this);
 }
 
 HTMLCollection::~HTMLCollection() = default;
@@ -76,9 +81,13 @@ void HTMLCollection::update_name_to_element_mappings_if_needed() const
 
 void HTMLCollection::update_cache_if_needed() const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    // Nothing to do, the DOM hasn't updated in a way that affects us since we last built the cache.
+    if (m_filter_dependencies == FilterDependencies::Unknown) {
+        if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+            return;
+    } else if (m_cache_is_valid) {
         return;
+    }
 
     m_cached_elements.clear();
     m_cached_name_to_element_mappings = nullptr;
@@ -96,6 +105,67 @@ void HTMLCollection::update_cache_if_needed() const
         });
     }
     m_cached_dom_tree_version = root()->document().dom_tree_version();
+    m_cache_is_valid = true;
+}
+
+// Returns whether nothing in the collection's subtree comes after the given descendant of the root in tree order.
+bool HTMLCollection::is_at_end_of_collection_subtree(Node const& node) const
+{
+    for (auto const* ancestor = &node; ancestor != m_root.ptr(); ancestor = ancestor->parent()) {
+        if (ancestor->next_sibling())
+            return false;
+    }
+    return true;
+}
+
+void HTMLCollection::did_change_children(Badge<Node>, Node const& parent, Node const& child)
+{
+    // Only elements are part of the collection, and the filter doesn't depend on any other kind of node. Any other node
+    // that is inserted or removed can't have element descendants either.
+    if (!child.is_element())
+        return;
+
+    if (m_scope == Scope::Children && &parent != m_root.ptr())
+        return;
+
+    if (!m_cache_is_valid)
+        return;
+
+    // OPTIMIZATION: An element that was inserted at the very end of our subtree comes after everything we have cached,
+    //               and since the filter only looks at elements and their ancestors, no cached element is affected by
+    //               it. This is the common case of appending while parsing or building a list, so we can simply extend
+    //               the cache instead of rebuilding it from scratch.
+    if (child.parent() == &parent && is_at_end_of_collection_subtree(child)) {
+        auto& element = const_cast<Element&>(as<Element>(child));
+        if (m_scope == Scope::Descendants) {
+            element.for_each_in_inclusive_subtree_of_type<Element>([&](auto& descendant) {
+                if (m_filter(descendant))
+                    m_cached_elements.append(descendant);
+                return TraversalDecision::Continue;
+            });
+        } else if (m_filter(element)) {
+            m_cached_elements.append(element);
+        }
+        m_cached_name_to_element_mappings = nullptr;
+        return;
+    }
+
+    m_cache_is_valid = false;
+}
+
+void HTMLCollection::did_change_attribute(Badge<Node>, Element const& element, FlyString const& local_name)
+{
+    if (m_scope == Scope::Children && element.parent() != m_root.ptr())
+        return;
+
+    if (m_filter_dependencies == FilterDependencies::TreeStructureAndAttributes) {
+        m_cache_is_valid = false;
+        return;
+    }
+
+    // The elements in the collection are unaffected, but named properties are looked up by ID and name.
+    if (local_name == HTML::AttributeNames::id || local_name == HTML::AttributeNames::name)
+        m_cached_name_to_element_mappings = nullptr;
 }
 
 GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() const
@@ -30,7 +30,19 @@ public:
         Children,
         Descendants,
     };
-    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+
+    // Describes what the filter's answer for an element depends on. This lets collections keep their cache across DOM
+    // mutations that cannot affect them, instead of rebuilding it after any mutation in the document.
+    enum class FilterDependencies : u8 {
+        // The filter may depend on anything, including state that changes without a DOM mutation.
+        Unknown,
+        // The filter only depends on the element's type and on its ancestors within the collection's subtree.
+        TreeStructure,
+        // Same as TreeStructure, but the filter may also depend on attributes of those elements.
+        TreeStructureAndAttributes,
+    };
+
+    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter, FilterDependencies = FilterDependencies::Unknown);
 
     virtual ~HTMLCollection() override;
 
@@ -45,8 +57,11 @@ public:
     virtual Vector<FlyString> supported_property_names() const override;
     virtual bool is_supported_property_name(FlyString const&) const override;
 
+    void did_change_children(Badge<Node>, Node const& parent, Node const& child);
+    void did_change_attribute(Badge<Node>, Element const&, FlyString const& local_name);
+
 protected:
-    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter, FilterDependencies = FilterDependencies::Unknown);
 
     virtual void initialize(JS::Realm&) override;
 
@@ -58,8 +73,10 @@ private:
 
     void update_cache_if_needed() const;
     void update_name_to_element_mappings_if_needed() const;
+    bool is_at_end_of_collection_subtree(Node const&) const;
 
     mutable u64 m_cached_dom_tree_version { 0 };
+    mutable bool m_cache_is_valid { false };
     mutable Vector<GC::Ref<Element>> m_cached_elements;
     mutable OwnPtr<OrderedHashMap<FlyString, GC::Ref<Element>>> m_cached_name_to_element_mappings;
 
@@ -67,6 +84,7 @@ private:
     Function<bool(Element const&)> m_filter;
 
     Scope m_scope { Scope::Descendants };
+    FilterDependencies m_filter_dependencies { FilterDependencies::Unknown };
 };
 
 }
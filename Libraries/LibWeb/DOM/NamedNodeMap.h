@@ -67,7 +67,9 @@ private:
     void remove_attribute_at_index(size_t attribute_index);
 
     GC::Ref<DOM::Element> m_element;
-    Vector<GC::Ref<Attr>> m_attributes;
+
+    // NOTE: Most elements only have a handful of attributes, which can then be stored without a separate allocation.
+    Vector<GC::Ref<Attr>, 4> m_attributes;
 };
 
 }
@@ -26,6 +26,7 @@
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventDispatcher.h>
+#include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/IDLEventListener.h>
 #include <LibWeb/DOM/LiveNodeList.h>
 #include <LibWeb/DOM/MutationType.h>
@@ -492,6 +493,22 @@ void Node::invalidate_style(StyleInvalidationReason reason)
         ancestor->m_child_needs_style_update = true;
 }
 
+// Like invalidate_style() for an inserted or removed node, but for a node whose siblings and ancestors have already been
+// invalidated for the same change, e.g. because the node was inserted together with other nodes.
+void Node::invalidate_style_of_subtree_next_to_invalidated_siblings()
+{
+    if (is_character_data())
+        return;
+
+    if (document().style_computer().may_have_has_selectors())
+        document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
+
+    if (document().needs_full_style_update())
+        return;
+
+    set_entire_subtree_needs_style_update(true);
+}
+
 void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::InvalidationSet::Property> const& properties, StyleInvalidationOptions options)
 {
     if (is_character_data())
@@ -691,6 +708,11 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     else
         previous_sibling = last_child();
 
+    // OPTIMIZATION: All nodes are inserted next to each other, so invalidating the style of one of them also takes care
+    //               of the siblings around them and of their ancestors. The others then only need their own subtree
+    //               invalidated, which avoids walking all siblings again for each node of a large DocumentFragment.
+    bool has_invalidated_siblings_of_inserted_nodes = false;
+
     // 7. For each node in nodes, in tree order:
     // FIXME: In tree order
     for (auto& node_to_insert : nodes) {
@@ -724,7 +746,12 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         // 6. Run assign slottables for a tree with node’s root.
         assign_slottables_for_a_tree(node_to_insert->root());
 
-        node_to_insert->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
+        if (has_invalidated_siblings_of_inserted_nodes) {
+            node_to_insert->invalidate_style_of_subtree_next_to_invalidated_siblings();
+        } else {
+            node_to_insert->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
+            has_invalidated_siblings_of_inserted_nodes = !node_to_insert->is_character_data();
+        }
 
         // 7. For each shadow-including inclusive descendant inclusiveDescendant of node, in shadow-including tree order:
         node_to_insert->for_each_shadow_including_inclusive_descendant([&](Node& inclusive_descendant) {
@@ -898,6 +925,11 @@ void Node::live_range_pre_remove()
 
 // https://dom.spec.whatwg.org/#concept-node-remove
 void Node::remove(bool suppress_observers)
+{
+    remove(suppress_observers, ShouldInvalidateStyle::Yes);
+}
+
+void Node::remove(bool suppress_observers, ShouldInvalidateStyle should_invalidate_style)
 {
     // 1. Let parent be node’s parent
     auto* parent = this->parent();
@@ -928,7 +960,8 @@ void Node::remove(bool suppress_observers)
     if (is_connected()) {
         // Since the tree structure is about to change, we need to invalidate both style and layout.
         // In the future, we should find a way to only invalidate the parts that actually need it.
-        invalidate_style(StyleInvalidationReason::NodeRemove);
+        if (should_invalidate_style == ShouldInvalidateStyle::Yes)
+            invalidate_style(StyleInvalidationReason::NodeRemove);
 
         // NOTE: If we didn't have a layout node before, rebuilding the layout tree isn't gonna give us one
         //       after we've been removed from the DOM.
@@ -1520,6 +1553,9 @@ void Node::set_document(Document& document)
 
     m_document = &document;
 
+    if (m_live_collections)
+        document.set_has_scoped_live_collections();
+
     if (needs_style_update() || child_needs_style_update()) {
         // NOTE: We unset and reset the "needs style update" flag here.
         //       This ensures that there's a pending style update in the new document
@@ -1764,8 +1800,15 @@ Vector<GC::Root<Node>> Node::children_as_vector() const
 
 void Node::remove_all_children(bool suppress_observers)
 {
-    while (GC::Ptr<Node> child = first_child())
-        child->remove(suppress_observers);
+    // OPTIMIZATION: Removing a child invalidates the style of its parent's other children and of its ancestors. All of
+    //               those children are about to be removed as well, so this only has to happen for one of them, instead
+    //               of walking all remaining siblings for each removed child.
+    auto should_invalidate_style = ShouldInvalidateStyle::Yes;
+    while (GC::Ptr<Node> child = first_child()) {
+        child->remove(suppress_observers, should_invalidate_style);
+        if (!child->is_character_data())
+            should_invalidate_style = ShouldInvalidateStyle::No;
+    }
 }
 
 // https://dom.spec.whatwg.org/#dom-node-comparedocumentposition
@@ -2588,6 +2631,7 @@ void Node::append_child_impl(GC::Ref<Node> node)
         return;
 
     TreeNode::append_child(node);
+    notify_live_collections_about_children_change(node);
 }
 
 void Node::insert_before_impl(GC::Ref<Node> node, GC::Ptr<Node> child)
@@ -2595,11 +2639,13 @@ void Node::insert_before_impl(GC::Ref<Node> node, GC::Ptr<Node> child)
     if (!child)
         return append_child_impl(move(node));
     TreeNode::insert_before(node, child);
+    notify_live_collections_about_children_change(node);
 }
 
 void Node::remove_child_impl(GC::Ref<Node> node)
 {
     TreeNode::remove_child(node);
+    notify_live_collections_about_children_change(node);
 }
 
 void Node::build_accessibility_tree(AccessibilityTreeNode& parent)
@@ -3130,6 +3176,52 @@ void Node::add_registered_observer(RegisteredObserver& registered_observer)
     m_registered_observer_list->append(registered_observer);
 }
 
+void Node::register_live_collection(Badge<HTMLCollection>, HTMLCollection& collection)
+{
+    if (!m_live_collections)
+        m_live_collections = make<Vector<WeakPtr<HTMLCollection>>>();
+
+    // Remove all collections that were deallocated.
+    m_live_collections->remove_all_matching([](auto& collection) {
+        return !collection.has_value();
+    });
+    m_live_collections->append(collection);
+
+    document().set_has_scoped_live_collections();
+}
+
+template<typename Callback>
+void Node::for_each_live_collection_rooted_at_inclusive_ancestor(Callback callback)
+{
+    for (auto* node = this; node; node = node->parent()) {
+        if (!node->m_live_collections)
+            continue;
+        for (auto& collection : *node->m_live_collections) {
+            if (collection.has_value())
+                callback(*collection);
+        }
+    }
+}
+
+void Node::notify_live_collections_about_children_change(Node& child)
+{
+    if (!document().has_scoped_live_collections())
+        return;
+    for_each_live_collection_rooted_at_inclusive_ancestor([&](HTMLCollection& collection) {
+        collection.did_change_children({}, *this, child);
+    });
+}
+
+void Node::notify_live_collections_about_attribute_change(Badge<Element>, FlyString const& local_name)
+{
+    // NOTE: A collection never contains its own root, so only collections rooted at ancestors are affected.
+    if (!parent() || !document().has_scoped_live_collections())
+        return;
+    parent()->for_each_live_collection_rooted_at_inclusive_ancestor([&](HTMLCollection& collection) {
+        collection.did_change_attribute({}, as<Element>(*this), local_name);
+    });
+}
+
 bool Node::has_inclusive_ancestor_with_display_none()
 {
     for (auto* ancestor = this; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
@@ -12,6 +12,7 @@
 #include <AK/JsonObjectSerializer.h>
 #include <AK/TypeCasts.h>
 #include <AK/Vector.h>
+#include <AK/WeakPtr.h>
 #include <LibWeb/CSS/InvalidationSet.h>
 #include <LibWeb/DOM/AccessibilityTreeNode.h>
 #include <LibWeb/DOM/EventTarget.h>
@@ -70,6 +71,7 @@ enum class ShouldComputeRole {
     X(HTMLObjectElementUpdateLayoutAndChildObjects) \
     X(HTMLOptionElementSelectedChange)              \
     X(HTMLSelectElementSetIsOpen)                   \
+    X(InternalsMeasureRendering)                    \
     X(MediaListSetMediaText)                        \
     X(MediaListAppendMedium)                        \
     X(MediaListDeleteMedium)                        \
@@ -115,6 +117,7 @@ enum class SetNeedsLayoutReason {
 [[nodiscard]] StringView to_string(SetNeedsLayoutReason);
 
 #define ENUMERATE_SET_NEEDS_LAYOUT_TREE_UPDATE_REASONS(X) \
+    X(ContentVisibilityAutoProximityChange)               \
     X(ElementSetInnerHTML)                                \
     X(DetailsElementOpenedOrClosed)                       \
     X(HTMLInputElementSrcAttribute)                       \
@@ -364,6 +367,7 @@ public:
     void set_entire_subtree_needs_style_update(bool b) { m_entire_subtree_needs_style_update = b; }
 
     void invalidate_style(StyleInvalidationReason);
+    void invalidate_style_of_subtree_next_to_invalidated_siblings();
     struct StyleInvalidationOptions {
         bool invalidate_self { false };
     };
@@ -419,6 +423,9 @@ public:
 
     void add_registered_observer(RegisteredObserver&);
 
+    void register_live_collection(Badge<HTMLCollection>, HTMLCollection&);
+    void notify_live_collections_about_attribute_change(Badge<Element>, FlyString const& local_name);
+
     void queue_mutation_record(FlyString const& type, Optional<FlyString> const& attribute_name, Optional<FlyString> const& attribute_namespace, Optional<String> const& old_value, Vector<GC::Root<Node>> added_nodes, Vector<GC::Root<Node>> removed_nodes, Node* previous_sibling, Node* next_sibling);
 
     // https://dom.spec.whatwg.org/#concept-shadow-including-inclusive-descendant
@@ -489,6 +496,9 @@ protected:
     // "Nodes have a strong reference to registered observers in their registered observer list." https://dom.spec.whatwg.org/#garbage-collection
     OwnPtr<Vector<GC::Ref<RegisteredObserver>>> m_registered_observer_list;
 
+    // The live collections rooted at this node that keep their cache across unrelated DOM mutations.
+    OwnPtr<Vector<WeakPtr<HTMLCollection>>> m_live_collections;
+
     void build_accessibility_tree(AccessibilityTreeNode& parent);
 
     ErrorOr<String> name_or_description(NameOrDescription, Document const&, HashTable<UniqueNodeID>&, IsDescendant = IsDescendant::No, ShouldComputeRole = ShouldComputeRole::Yes) const;
@@ -502,6 +512,16 @@ private:
     void append_child_impl(GC::Ref<Node>);
     void remove_child_impl(GC::Ref<Node>);
 
+    void notify_live_collections_about_children_change(Node& child);
+
+    enum class ShouldInvalidateStyle {
+        No,
+        Yes,
+    };
+    void remove(bool suppress_observers, ShouldInvalidateStyle);
+    template<typename Callback>
+    void for_each_live_collection_rooted_at_inclusive_ancestor(Callback);
+
     static Optional<StringView> first_valid_id(StringView, Document const&);
 
     GC::Ptr<NodeList> m_child_nodes;
@@ -47,12 +47,38 @@ enum class ReturnMatches {
     First,
     All,
 };
+// If the selector list consists of a lone ID selector, returns that ID.
+static Optional<FlyString const&> lone_id_selector(CSS::SelectorList const& selectors)
+{
+    if (selectors.size() != 1)
+        return {};
+    auto const& compound_selectors = selectors.first()->compound_selectors();
+    if (compound_selectors.size() != 1)
+        return {};
+    auto const& simple_selectors = compound_selectors.first().simple_selectors;
+    if (simple_selectors.size() != 1 || simple_selectors.first().type != CSS::Selector::SimpleSelector::Type::Id)
+        return {};
+    return simple_selectors.first().name();
+}
+
+static ElementByIdMap const* element_by_id_map_for_connected_node(ParentNode const& node)
+{
+    if (!node.is_connected())
+        return nullptr;
+    auto const& root = node.root();
+    if (root.is_document())
+        return &static_cast<Document const&>(root).element_by_id();
+    if (root.is_shadow_root())
+        return &static_cast<ShadowRoot const&>(root).element_by_id();
+    return nullptr;
+}
+
 // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
 static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_match_a_selectors_string(ParentNode& node, StringView selector_text, ReturnMatches return_matches)
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = node.document().parse_selector_for_query(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -67,6 +93,28 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
+
+    // OPTIMIZATION: A lone ID selector only matches elements with that ID, which a connected node's root already keeps
+    //               track of in tree order. This avoids walking the whole subtree for the common querySelector("#id").
+    if (auto id = lone_id_selector(selectors); id.has_value()) {
+        if (auto const* element_by_id = element_by_id_map_for_connected_node(node)) {
+            element_by_id->for_each_element_with_id(*id, [&](Element& element) {
+                if (element.id() != *id || !element.is_descendant_of(node))
+                    return IterationDecision::Continue;
+                if (return_matches == ReturnMatches::First) {
+                    single_result = &element;
+                    return IterationDecision::Break;
+                }
+                results.append(element);
+                return IterationDecision::Continue;
+            });
+
+            if (return_matches == ReturnMatches::First)
+                return { single_result };
+            return { StaticNodeList::create(node.realm(), move(results)) };
+        }
+    }
+
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
     node.for_each_in_subtree_of_type<Element>([&](auto& element) {
         for (auto& selector : selectors) {
@@ -138,7 +186,7 @@ GC::Ref<HTMLCollection> ParentNode::children()
     if (!m_children) {
         m_children = HTMLCollection::create(*this, HTMLCollection::Scope::Children, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_children;
 }
@@ -151,7 +199,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
     if (qualified_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
 
     // 2. Otherwise, if root’s node document is an HTML document, return a HTMLCollection rooted at root, whose filter matches the following descendant elements:
@@ -164,13 +212,13 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
 
             // - Whose namespace is not the HTML namespace and whose qualified name is qualifiedName.
             return element.qualified_name() == qualified_name;
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
 
     // 3. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose qualified name is qualifiedName.
     return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name](Element const& element) {
         return element.qualified_name() == qualified_name;
-    });
+    }, HTMLCollection::FilterDependencies::TreeStructure);
 }
 
 // https://dom.spec.whatwg.org/#concept-getelementsbytagnamens
@@ -185,27 +233,27 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name_ns(Optional<FlyStri
     if (namespace_ == "*" && local_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
             return true;
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
 
     // 3. Otherwise, if namespace is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose local name is localName.
     if (namespace_ == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [local_name](Element const& element) {
             return element.local_name() == local_name;
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
 
     // 4. Otherwise, if localName is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace.
     if (local_name == "*") {
         return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_](Element const& element) {
             return element.namespace_uri() == namespace_;
-        });
+        }, HTMLCollection::FilterDependencies::TreeStructure);
     }
 
     // 5. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace and local name is localName.
     return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_, local_name](Element const& element) {
         return element.namespace_uri() == namespace_ && element.local_name() == local_name;
-    });
+    }, HTMLCollection::FilterDependencies::TreeStructure);
 }
 
 // https://dom.spec.whatwg.org/#dom-parentnode-prepend
@@ -273,7 +321,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_class_name(StringView class_
                 return false;
         }
         return !list_of_class_names.is_empty();
-    });
+    }, HTMLCollection::FilterDependencies::TreeStructureAndAttributes);
 }
 
 GC::Ptr<Element> ParentNode::get_element_by_id(FlyString const& id) const
@@ -9,7 +9,7 @@
 #include <AK/OwnPtr.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
-#include <LibWeb/CSS/StyleProperty.h>
+#include <LibWeb/CSS/CustomPropertyData.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/PixelUnits.h>
 #include <LibWeb/TreeNode.h>
@@ -29,8 +29,8 @@ class PseudoElement : public JS::Cell {
     GC::Ptr<CSS::ComputedProperties> computed_properties() const { return m_computed_properties; }
     void set_computed_properties(GC::Ptr<CSS::ComputedProperties> value) { m_computed_properties = value; }
 
-    HashMap<FlyString, CSS::StyleProperty> const& custom_properties() const { return m_custom_properties; }
-    void set_custom_properties(HashMap<FlyString, CSS::StyleProperty> value) { m_custom_properties = move(value); }
+    RefPtr<CSS::CustomPropertyData const> const& custom_property_data() const { return m_custom_property_data; }
+    void set_custom_property_data(RefPtr<CSS::CustomPropertyData const> value) { m_custom_property_data = move(value); }
 
     bool has_non_empty_counters_set() const { return m_counters_set; }
     Optional<CSS::CountersSet const&> counters_set() const;
@@ -46,7 +46,7 @@ private:
     GC::Ptr<Layout::NodeWithStyle> m_layout_node;
     GC::Ptr<CSS::CascadedProperties> m_cascaded_properties;
     GC::Ptr<CSS::ComputedProperties> m_computed_properties;
-    HashMap<FlyString, CSS::StyleProperty> m_custom_properties;
+    RefPtr<CSS::CustomPropertyData const> m_custom_property_data;
     OwnPtr<CSS::CountersSet> m_counters_set;
     CSSPixelPoint m_scroll_offset {};
 };
@@ -71,15 +71,34 @@ WebIDL::ExceptionOr<String> TextDecoder::decode(Optional<GC::Root<WebIDL::Buffer
     if (!input.has_value())
         return TRY_OR_THROW_OOM(vm(), m_decoder.to_utf8({}));
 
+    auto decode_bytes = [&](ReadonlyBytes bytes) -> WebIDL::ExceptionOr<String> {
+        auto result = TRY_OR_THROW_OOM(vm(), m_decoder.to_utf8(bytes));
+        if (this->fatal() && result.contains(0xfffd))
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Decoding failed"sv };
+        return result;
+    };
+
+    // OPTIMIZATION: Decoding cannot run any script, so we can decode straight from the bytes held by the buffer rather
+    //               than from a copy of them. We still copy the bytes of a SharedArrayBuffer, as other agents may modify
+    //               them while we are decoding.
+    auto& buffer_source = *input.value();
+    if (auto array_buffer = buffer_source.viewed_array_buffer(); !array_buffer->is_shared_array_buffer()) {
+        if (array_buffer->is_detached())
+            return decode_bytes({});
+
+        // NOTE: The byte length of an out-of-bounds view is zero, in which case its byte offset may be out of bounds too.
+        auto byte_length = buffer_source.byte_length();
+        if (byte_length == 0)
+            return decode_bytes({});
+
+        return decode_bytes(array_buffer->buffer().bytes().slice(buffer_source.byte_offset(), byte_length));
+    }
+
     // FIXME: Implement the streaming stuff.
-    auto data_buffer_or_error = WebIDL::get_buffer_source_copy(*input.value()->raw_object());
+    auto data_buffer_or_error = WebIDL::get_buffer_source_copy(*buffer_source.raw_object());
     if (data_buffer_or_error.is_error())
         return WebIDL::OperationError::create(realm(), "Failed to copy bytes from ArrayBuffer"_utf16);
-    auto& data_buffer = data_buffer_or_error.value();
-    auto result = TRY_OR_THROW_OOM(vm(), m_decoder.to_utf8({ data_buffer.data(), data_buffer.size() }));
-    if (this->fatal() && result.contains(0xfffd))
-        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Decoding failed"sv };
-    return result;
+    return decode_bytes(data_buffer_or_error.value());
 }
 
 }
@@ -66,6 +66,23 @@ TextEncoderEncodeIntoResult TextEncoder::encode_into(String const& source, GC::R
     // 2. Let written be 0.
     WebIDL::UnsignedLongLong written = 0;
 
+    // OPTIMIZATION: If all of source fits into destination, the steps below write every one of its UTF-8 bytes, so we can
+    //               copy them in one go. We then only have to count the UTF-16 code units that were read: one for each
+    //               code point, i.e. each byte that isn't a continuation byte, plus one more for each code point above
+    //               U+FFFF, i.e. each leading byte of a 4-byte sequence.
+    if (auto source_bytes = source.bytes(); source_bytes.size() <= data.size()) {
+        source_bytes.copy_to(data);
+
+        for (auto byte : source_bytes) {
+            if ((byte & 0xc0) != 0x80)
+                read++;
+            if (byte >= 0xf0)
+                read++;
+        }
+
+        return { read, source_bytes.size() };
+    }
+
     // NOTE: The AK::String is always UTF-8, so most of these steps are no-ops.
     // 3. Let encoder be an instance of the UTF-8 encoder.
     // 4. Let unused be the I/O queue of scalar values « end-of-queue ».
@@ -45,6 +45,7 @@
 #include <LibWeb/FileAPI/Blob.h>
 #include <LibWeb/FileAPI/BlobURLStore.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Preload.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
@@ -154,11 +155,11 @@ WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& r
             fetch_params->set_preloaded_response_candidate(response);
         });
 
-        // FIXME: 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
+        // 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
         //    window, given request’s URL, request’s destination, request’s mode, request’s credentials mode,
         //    request’s integrity metadata, and onPreloadedResponseAvailable.
-        auto found_preloaded_resource = false;
-        (void)on_preloaded_response_available;
+        auto& window = as<HTML::Window>(request.client()->global_object());
+        auto found_preloaded_resource = HTML::consume_a_preloaded_resource(window, request.url(), request.destination(), request.mode(), request.credentials_mode(), request.integrity_metadata(), on_preloaded_response_available);
 
         // 4. If foundPreloadedResource is true and fetchParams’s preloaded response candidate is null, then set
         //    fetchParams’s preloaded response candidate to "pending".
@@ -293,6 +294,17 @@ void populate_request_from_client(JS::Realm const& realm, Infrastructure::Reques
     }
 }
 
+// The bytes of a response body that have been read so far, while checking them against the request's integrity metadata.
+struct BodyBeingCheckedForIntegrity : public RefCounted<BodyBeingCheckedForIntegrity> {
+    explicit BodyBeingCheckedForIntegrity(NonnullOwnPtr<SRI::IncrementalMetadataListMatcher> matcher)
+        : matcher(move(matcher))
+    {
+    }
+
+    NonnullOwnPtr<SRI::IncrementalMetadataListMatcher> matcher;
+    ByteBuffer bytes;
+};
+
 // https://fetch.spec.whatwg.org/#concept-main-fetch
 WebIDL::ExceptionOr<GC::Ptr<PendingResponse>> main_fetch(JS::Realm& realm, Infrastructure::FetchParams const& fetch_params, Recursive recursive)
 {
@@ -602,23 +614,33 @@ WebIDL::ExceptionOr<GC::Ptr<PendingResponse>> main_fetch(JS::Realm& realm, Infra
                     return;
                 }
 
+                // OPTIMIZATION: Rather than hashing the bytes once the body has been fully read, we hash each chunk of
+                //               the body as it is read. This way, checking the integrity metadata is done as soon as the
+                //               last chunk has been read.
+                auto body_being_checked = adopt_ref(*new BodyBeingCheckedForIntegrity(TRY_OR_IGNORE(SRI::IncrementalMetadataListMatcher::create(request->integrity_metadata()))));
+
+                auto process_body_chunk = GC::create_function(vm.heap(), [body_being_checked](ByteBuffer chunk) {
+                    body_being_checked->matcher->update(chunk);
+                    body_being_checked->bytes.append(chunk);
+                });
+
                 // 3. Let processBody given bytes be these steps:
-                auto process_body = GC::create_function(vm.heap(), [&realm, request, response, &fetch_params, process_body_error](ByteBuffer bytes) {
+                auto process_body = GC::create_function(vm.heap(), [&realm, response, &fetch_params, process_body_error, body_being_checked]() {
                     // 1. If bytes do not match request’s integrity metadata, then run processBodyError and abort these steps.
-                    if (!TRY_OR_IGNORE(SRI::do_bytes_match_metadata_list(bytes, request->integrity_metadata()))) {
+                    if (!TRY_OR_IGNORE(body_being_checked->matcher->do_bytes_match())) {
                         process_body_error->function()({});
                         return;
                     }
 
                     // 2. Set response’s body to bytes as a body.
-                    response->set_body(Infrastructure::byte_sequence_as_body(realm, bytes));
+                    response->set_body(Infrastructure::byte_sequence_as_body(realm, body_being_checked->bytes));
 
                     // 3. Run fetch response handover given fetchParams and response.
                     fetch_response_handover(realm, fetch_params, *response);
                 });
 
                 // 4. Fully read response’s body given processBody and processBodyError.
-                response->body()->fully_read(realm, process_body, process_body_error, fetch_params.task_destination());
+                response->body()->incrementally_read(process_body_chunk, process_body, process_body_error, fetch_params.task_destination());
             }
             // 23. Otherwise, run fetch response handover given fetchParams and response.
             else {
@@ -1467,6 +1489,33 @@ public:
         m_cache.set(http_request.current_url(), move(cached_response));
     }
 
+    // AD-HOC: While a response for a URL is being fetched from the network, other requests for the same URL wait for it
+    //         to be stored in the cache rather than fetching it again. This avoids fetching (and decoding) the same
+    //         resource many times when, for example, a document contains many images with the same source.
+    bool has_in_flight_request(URL::URL const& url) const { return m_in_flight_requests.contains(url); }
+
+    void begin_in_flight_request(URL::URL const& url)
+    {
+        m_in_flight_requests.set(url, {});
+    }
+
+    void wait_for_in_flight_request(URL::URL const& url, GC::Ref<GC::Function<void()>> on_complete)
+    {
+        auto it = m_in_flight_requests.find(url);
+        VERIFY(it != m_in_flight_requests.end());
+        it->value.append(on_complete);
+    }
+
+    void end_in_flight_request(URL::URL const& url)
+    {
+        auto waiting_requests = m_in_flight_requests.take(url);
+        if (!waiting_requests.has_value())
+            return;
+
+        for (auto& on_complete : *waiting_requests)
+            on_complete->function()();
+    }
+
     // https://httpwg.org/specs/rfc9111.html#freshening.responses
     void freshen_stored_responses_upon_validation(Infrastructure::Response const& response, Vector<GC::Ptr<Infrastructure::Response>>& initial_set_of_stored_responses)
     {
@@ -1650,6 +1699,7 @@ private:
     }
 
     HashMap<URL::URL, GC::Root<Infrastructure::Response>> m_cache;
+    HashMap<URL::URL, Vector<GC::Root<GC::Function<void()>>>> m_in_flight_requests;
 };
 
 class HTTPCache {
@@ -1661,6 +1711,8 @@ public:
         });
     }
 
+    void clear() { m_cache.clear(); }
+
     static HTTPCache& the()
     {
         static HTTPCache s_cache;
@@ -1671,6 +1723,11 @@ private:
     HashMap<Infrastructure::NetworkPartitionKey, NonnullRefPtr<CachePartition>> m_cache;
 };
 
+void clear_http_cache()
+{
+    HTTPCache::the().clear();
+}
+
 // https://fetch.spec.whatwg.org/#determine-the-http-cache-partition
 static RefPtr<CachePartition> determine_the_http_cache_partition(Infrastructure::Request const& request)
 {
@@ -1688,6 +1745,18 @@ static RefPtr<CachePartition> determine_the_http_cache_partition(Infrastructure:
     return HTTPCache::the().get(key.value());
 }
 
+// AD-HOC: Only plain GET requests that may be served from the cache wait for an in-flight request for the same URL.
+static bool can_coalesce_with_in_flight_request(Infrastructure::Request const& http_request)
+{
+    if (http_request.method() != "GET"sv.bytes())
+        return false;
+    if (http_request.header_list()->contains("Range"sv.bytes()))
+        return false;
+
+    return http_request.cache_mode() == Infrastructure::Request::CacheMode::Default
+        || http_request.cache_mode() == Infrastructure::Request::CacheMode::ForceCache;
+}
+
 // https://fetch.spec.whatwg.org/#concept-http-network-or-cache-fetch
 WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Realm& realm, Infrastructure::FetchParams const& fetch_params, IsAuthenticationFetch is_authentication_fetch, IsNewConnectionFetch is_new_connection_fetch)
 {
@@ -1719,6 +1788,10 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
     // 7. Let the revalidatingFlag be unset.
     auto revalidating_flag = RefCountedFlag::create(false);
 
+    // AD-HOC: Whether this request waits for another request for the same URL to complete, see CachePartition.
+    auto is_coalesced_flag = RefCountedFlag::create(false);
+    auto is_in_flight_request = false;
+
     auto include_credentials = IncludeCredentials::No;
 
     // 8. Run these steps, but abort when fetchParams is canceled:
@@ -2079,18 +2152,56 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
         if (http_request->cache_mode() == Infrastructure::Request::CacheMode::OnlyIfCached)
             return PendingResponse::create(vm, request, Infrastructure::Response::network_error(vm, "Request with 'only-if-cached' cache mode doesn't have a cached response"_string));
 
-        // 2. Let forwardResponse be the result of running HTTP-network fetch given httpFetchParams, includeCredentials,
-        //    and isNewConnectionFetch.
-        pending_forward_response = TRY(nonstandard_resource_loader_file_or_http_network_fetch(realm, *http_fetch_params, include_credentials, is_new_connection_fetch));
+        // AD-HOC: If the same URL is already being fetched for this cache, wait for that response to be stored and serve
+        //         it from the cache instead. If it could not be stored, fetch it from the network after all.
+        if (http_cache && can_coalesce_with_in_flight_request(*http_request) && http_cache->has_in_flight_request(http_request->current_url())) {
+            dbgln("\033[36;1mHTTP CACHE COALESCE\033[0m {}", http_request->current_url());
+            is_coalesced_flag->set_value(true);
+            pending_forward_response = PendingResponse::create(vm, request);
+
+            http_cache->wait_for_in_flight_request(http_request->current_url(), GC::create_function(realm.heap(), [realm = GC::Ref { realm }, pending_forward_response = GC::Ref { *pending_forward_response }, http_fetch_params = GC::Ref { *http_fetch_params }, http_request, http_cache, include_credentials, is_new_connection_fetch, is_coalesced_flag] {
+                GC::RootVector<GC::Ptr<Infrastructure::Response>> initial_set_of_stored_responses(realm->heap());
+
+                if (auto stored_response = http_cache->select_response(realm, http_request->current_url(), http_request->method(), *http_request->header_list(), initial_set_of_stored_responses)) {
+                    stored_response->set_cache_state(Infrastructure::Response::CacheState::Local);
+                    pending_forward_response->resolve(*stored_response);
+                    return;
+                }
+
+                is_coalesced_flag->set_value(false);
+
+                auto forward_response = nonstandard_resource_loader_file_or_http_network_fetch(realm, http_fetch_params, include_credentials, is_new_connection_fetch);
+                if (forward_response.is_error()) {
+                    pending_forward_response->resolve(Infrastructure::Response::network_error(realm->vm(), "Failed to fetch coalesced request"_string));
+                    return;
+                }
+
+                forward_response.value()->when_loaded([pending_forward_response](GC::Ref<Infrastructure::Response> response) {
+                    pending_forward_response->resolve(response);
+                });
+            }));
+        } else {
+            // 2. Let forwardResponse be the result of running HTTP-network fetch given httpFetchParams, includeCredentials,
+            //    and isNewConnectionFetch.
+            pending_forward_response = TRY(nonstandard_resource_loader_file_or_http_network_fetch(realm, *http_fetch_params, include_credentials, is_new_connection_fetch));
+
+            if (http_cache && can_coalesce_with_in_flight_request(*http_request)) {
+                http_cache->begin_in_flight_request(http_request->current_url());
+                is_in_flight_request = true;
+            }
+        }
     } else {
         pending_forward_response = PendingResponse::create(vm, request, Infrastructure::Response::create(vm));
     }
 
     auto returned_pending_response = PendingResponse::create(vm, request);
 
-    pending_forward_response->when_loaded([&realm, &vm, &fetch_params, request, response, stored_response, initial_set_of_stored_responses, http_request, returned_pending_response, is_authentication_fetch, is_new_connection_fetch, revalidating_flag, include_credentials, response_was_null = !response, http_cache](GC::Ref<Infrastructure::Response> resolved_forward_response) mutable {
+    pending_forward_response->when_loaded([&realm, &vm, &fetch_params, request, response, stored_response, initial_set_of_stored_responses, http_request, returned_pending_response, is_authentication_fetch, is_new_connection_fetch, revalidating_flag, include_credentials, response_was_null = !response, http_cache, is_coalesced_flag, is_in_flight_request](GC::Ref<Infrastructure::Response> resolved_forward_response) mutable {
         dbgln_if(WEB_FETCH_DEBUG, "Fetch: Running 'HTTP-network-or-cache fetch' pending_forward_response load callback");
-        if (response_was_null) {
+        if (response_was_null && is_coalesced_flag->value()) {
+            // NOTE: This response was served from the cache once the request we were waiting for had completed.
+            response = resolved_forward_response;
+        } else if (response_was_null) {
             auto forward_response = resolved_forward_response;
 
             // NOTE: TRACE is omitted as it is a forbidden method in Fetch.
@@ -2132,6 +2243,10 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
                 if (http_cache)
                     http_cache->store_response(realm, *http_request, *forward_response);
             }
+
+            // AD-HOC: Let any requests that were waiting for this response be served from the cache.
+            if (is_in_flight_request)
+                http_cache->end_in_flight_request(http_request->current_url());
         }
 
         // 11. Set response’s URL list to a clone of httpRequest’s URL list.
@@ -2294,6 +2409,60 @@ static void log_response(auto const& status_code, auto const& headers, auto cons
 // https://fetch.spec.whatwg.org/#concept-http-network-fetch
 // Drop-in replacement for 'HTTP-network fetch', but obviously non-standard :^)
 // It also handles file:// URLs since those can also go through ResourceLoader.
+// NOTE: This tells RequestServer which requests to start first, based on what the response is needed for and on the
+//       request's fetch priority.
+static RequestServer::RequestPriority network_priority_for_request(Infrastructure::Request const& request)
+{
+    using Destination = Infrastructure::Request::Destination;
+    using RequestServer::RequestPriority;
+
+    auto priority = [&] {
+        if (request.initiator() == Infrastructure::Request::Initiator::Prefetch)
+            return RequestPriority::Lowest;
+        if (request.render_blocking())
+            return RequestPriority::Highest;
+
+        // NOTE: Requests without a destination come from fetch() and XMLHttpRequest, which pages tend to wait on.
+        if (!request.destination().has_value())
+            return RequestPriority::High;
+
+        switch (*request.destination()) {
+        case Destination::Document:
+        case Destination::Frame:
+        case Destination::IFrame:
+        case Destination::Style:
+        case Destination::Font:
+            return RequestPriority::Highest;
+        case Destination::Script:
+            return RequestPriority::High;
+        case Destination::Audio:
+        case Destination::Image:
+        case Destination::Track:
+        case Destination::Video:
+            return RequestPriority::Low;
+        case Destination::Report:
+            return RequestPriority::Lowest;
+        default:
+            return RequestPriority::Medium;
+        }
+    }();
+
+    switch (request.priority()) {
+    case Infrastructure::Request::Priority::High:
+        if (priority != RequestPriority::Highest)
+            priority = static_cast<RequestPriority>(to_underlying(priority) + 1);
+        break;
+    case Infrastructure::Request::Priority::Low:
+        if (priority != RequestPriority::Lowest)
+            priority = static_cast<RequestPriority>(to_underlying(priority) - 1);
+        break;
+    case Infrastructure::Request::Priority::Auto:
+        break;
+    }
+
+    return priority;
+}
+
 WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_or_http_network_fetch(JS::Realm& realm, Infrastructure::FetchParams const& fetch_params, IncludeCredentials include_credentials, IsNewConnectionFetch is_new_connection_fetch)
 {
     dbgln_if(WEB_FETCH_DEBUG, "Fetch: Running 'non-standard HTTP-network fetch' with: fetch_params @ {}", &fetch_params);
@@ -2316,6 +2485,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_url(request->current_url());
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
+    load_request.set_priority(network_priority_for_request(*request));
 
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
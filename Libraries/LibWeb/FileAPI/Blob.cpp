@@ -23,6 +23,8 @@
 #include <LibWeb/Streams/ReadableStreamOperations.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
 #include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/DOMException.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::FileAPI {
 
@@ -30,7 +32,12 @@ GC_DEFINE_ALLOCATOR(Blob);
 
 GC::Ref<Blob> Blob::create(JS::Realm& realm, ByteBuffer byte_buffer, String type)
 {
-    return realm.create<Blob>(realm, move(byte_buffer), move(type));
+    return realm.create<Blob>(realm, BlobData::create(move(byte_buffer)), move(type));
+}
+
+GC::Ref<Blob> Blob::create(JS::Realm& realm, NonnullRefPtr<BlobData const> data, String type)
+{
+    return realm.create<Blob>(realm, move(data), move(type));
 }
 
 // https://w3c.github.io/FileAPI/#convert-line-endings-to-native
@@ -81,11 +88,22 @@ ErrorOr<String> convert_line_endings_to_native(StringView string)
 }
 
 // https://w3c.github.io/FileAPI/#process-blob-parts
-ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options)
+ErrorOr<NonnullRefPtr<BlobData const>> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options)
 {
     // 1. Let bytes be an empty sequence of bytes.
+    // NOTE: The bytes of blobs are not copied. Instead, bytes is made of the data of those blobs, and of buffers holding
+    //       the bytes of the other elements in between them.
+    Vector<NonnullRefPtr<BlobData const>> parts;
     ByteBuffer bytes {};
 
+    auto append_pending_bytes_to_parts = [&]() -> ErrorOr<void> {
+        if (bytes.is_empty())
+            return {};
+        TRY(parts.try_append(BlobData::create(move(bytes))));
+        bytes = {};
+        return {};
+    };
+
     // 2. For each element in parts:
     for (auto const& blob_part : blob_parts) {
         TRY(blob_part.visit(
@@ -109,11 +127,13 @@ ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optio
             },
             // 3. If element is a Blob, append the bytes it represents to bytes.
             [&](GC::Root<Blob> const& blob) -> ErrorOr<void> {
-                return bytes.try_append(blob->raw_bytes());
+                TRY(append_pending_bytes_to_parts());
+                return parts.try_append(blob->data());
             }));
     }
     // 3. Return bytes.
-    return bytes;
+    TRY(append_pending_bytes_to_parts());
+    return BlobData::create_from_parts(move(parts));
 }
 
 bool is_basic_latin(StringView view)
@@ -127,19 +147,20 @@ bool is_basic_latin(StringView view)
 
 Blob::Blob(JS::Realm& realm)
     : PlatformObject(realm)
+    , m_data(BlobData::empty())
 {
 }
 
-Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer, String type)
+Blob::Blob(JS::Realm& realm, NonnullRefPtr<BlobData const> data, String type)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
+    , m_data(move(data))
     , m_type(move(type))
 {
 }
 
-Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer)
+Blob::Blob(JS::Realm& realm, NonnullRefPtr<BlobData const> data)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
+    , m_data(move(data))
 {
 }
 
@@ -160,7 +181,10 @@ WebIDL::ExceptionOr<void> Blob::serialization_steps(HTML::TransferDataEncoder& s
     serialized.encode(m_type);
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    serialized.encode(m_byte_buffer);
+    auto bytes = m_data->bytes();
+    if (bytes.is_error())
+        return WebIDL::DataCloneError::create(realm(), Utf16String::formatted("Unable to read blob: {}", bytes.error()));
+    serialized.encode_bytes(bytes.value());
 
     return {};
 }
@@ -176,7 +200,7 @@ WebIDL::ExceptionOr<void> Blob::deserialization_steps(HTML::TransferDataDecoder&
     m_type = serialized.decode<String>();
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(serialized.decode_buffer(realm));
+    m_data = BlobData::create(TRY(serialized.decode_buffer(realm)));
 
     return {};
 }
@@ -188,10 +212,10 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
     if (!blob_parts.has_value() && !options.has_value())
         return realm.create<Blob>(realm);
 
-    ByteBuffer byte_buffer {};
+    auto data = BlobData::empty();
     // 2. Let bytes be the result of processing blob parts given blobParts and options.
     if (blob_parts.has_value()) {
-        byte_buffer = MUST(process_blob_parts(blob_parts.value(), options));
+        data = MUST(process_blob_parts(blob_parts.value(), options));
     }
 
     auto type = String {};
@@ -211,7 +235,7 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
     }
 
     // 4. Return a Blob object referring to bytes as its associated byte sequence, with its size set to the length of bytes, and its type set to the value of t from the substeps above.
-    return realm.create<Blob>(realm, move(byte_buffer), move(type));
+    return realm.create<Blob>(realm, move(data), move(type));
 }
 
 WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::construct_impl(JS::Realm& realm, Optional<Vector<BlobPart>> const& blob_parts, Optional<BlobPropertyBag> const& options)
@@ -233,8 +257,6 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice(Optional<i64> start, Optional<i64
 // https://w3c.github.io/FileAPI/#slice-blob
 WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optional<i64> end, Optional<String> const& content_type)
 {
-    auto& vm = realm().vm();
-
     // 1. Let originalSize be blob’s size.
     auto original_size = size();
 
@@ -302,8 +324,9 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optiona
     // a. S refers to span consecutive bytes from blob’s associated byte sequence, beginning with the byte at byte-order position relativeStart.
     // b. S.size = span.
     // c. S.type = relativeContentType.
-    auto byte_buffer = TRY_OR_THROW_OOM(vm, m_byte_buffer.slice(relative_start, span));
-    return realm().create<Blob>(realm(), move(byte_buffer), move(relative_content_type));
+    // NOTE: The bytes are not copied, the new blob refers to them.
+    auto data = m_data->slice(relative_start, span);
+    return realm().create<Blob>(realm(), move(data), move(relative_content_type));
 }
 
 // https://w3c.github.io/FileAPI/#dom-blob-stream
@@ -313,34 +336,64 @@ GC::Ref<Streams::ReadableStream> Blob::stream()
     return get_stream();
 }
 
+ReadonlyBytes Blob::raw_bytes() const
+{
+    auto bytes = m_data->bytes();
+
+    // FIXME: Propagate errors from reading the blob to our callers.
+    if (bytes.is_error()) {
+        dbgln("Unable to read the bytes of a blob: {}", bytes.error());
+        return {};
+    }
+
+    return bytes.release_value();
+}
+
 // https://w3c.github.io/FileAPI/#blob-get-stream
 GC::Ref<Streams::ReadableStream> Blob::get_stream()
 {
+    static constexpr size_t chunk_size = 64 * KiB;
+
     auto& realm = this->realm();
 
     // 1. Let stream be a new ReadableStream created in blob’s relevant Realm.
     auto stream = realm.create<Streams::ReadableStream>(realm);
 
-    // 2. Set up stream with byte reading support.
-    stream->set_up_with_byte_reading_support();
+    // 3. Run the following steps in parallel:
+    // NOTE: Rather than reading all chunks up front, we read a single chunk each time the stream is pulled. This way, the
+    //       blob is never held in memory at once, and chunks are only read as fast as they are consumed.
+    auto pull_algorithm = GC::create_function(heap(), [&realm, stream, data = m_data, offset = static_cast<u64>(0)]() mutable {
+        auto promise = WebIDL::create_promise(realm);
 
-    // FIXME: 3. Run the following steps in parallel:
-    {
         // 1. While not all bytes of blob have been read:
-        //    NOTE: for simplicity the chunk is the entire buffer for now.
-        {
-            // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
-            auto bytes = m_byte_buffer;
-
-            // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
-            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(heap(), [stream, bytes = move(bytes)]() {
-                auto& realm = stream->realm();
-                HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
-
-                // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
+        // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
+        auto bytes = [&]() -> ErrorOr<ByteBuffer> {
+            auto bytes = TRY(ByteBuffer::create_uninitialized(min<u64>(chunk_size, data->size() - offset)));
+            TRY(data->read(offset, bytes.bytes()));
+            return bytes;
+        }();
+
+        if (!bytes.is_error())
+            offset += bytes.value().size();
+        auto is_last_chunk = bytes.is_error() || offset >= data->size();
+
+        // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
+        HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(realm.heap(), [stream, promise, bytes = move(bytes), is_last_chunk]() mutable {
+            auto& realm = stream->realm();
+            HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+            // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
+            if (bytes.is_error()) {
+                Streams::readable_stream_error(*stream, WebIDL::NotReadableError::create(realm, Utf16String::formatted("{}", bytes.error())));
+                WebIDL::resolve_promise(realm, promise);
+                return;
+            }
+
+            if (!bytes.value().is_empty()) {
                 // 2. Let chunk be a new Uint8Array wrapping an ArrayBuffer containing bytes. If creating the ArrayBuffer throws an exception, then error stream with that exception and abort these steps.
-                auto array_buffer = JS::ArrayBuffer::create(realm, bytes);
-                auto chunk = JS::Uint8Array::create(realm, bytes.size(), *array_buffer);
+                auto byte_length = bytes.value().size();
+                auto array_buffer = JS::ArrayBuffer::create(realm, bytes.release_value());
+                auto chunk = JS::Uint8Array::create(realm, byte_length, *array_buffer);
 
                 // 3. Enqueue chunk in stream.
                 auto maybe_error = Bindings::throw_dom_exception_if_needed(realm.vm(), [&]() {
@@ -349,16 +402,25 @@ GC::Ref<Streams::ReadableStream> Blob::get_stream()
 
                 if (maybe_error.is_error()) {
                     Streams::readable_stream_error(*stream, maybe_error.release_error().value());
+                    WebIDL::resolve_promise(realm, promise);
                     return;
                 }
+            }
 
-                // FIXME: Spec bug: https://github.com/w3c/FileAPI/issues/206
-                //
-                // We need to close the stream so that the stream will finish reading.
+            // FIXME: Spec bug: https://github.com/w3c/FileAPI/issues/206
+            //
+            // We need to close the stream so that the stream will finish reading.
+            if (is_last_chunk)
                 stream->close();
-            }));
-        }
-    }
+
+            WebIDL::resolve_promise(realm, promise);
+        }));
+
+        return promise;
+    });
+
+    // 2. Set up stream with byte reading support.
+    stream->set_up_with_byte_reading_support(pull_algorithm);
 
     // 4. Return stream.
     return stream;
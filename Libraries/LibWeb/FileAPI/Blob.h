@@ -11,6 +11,7 @@
 #include <LibWeb/Bindings/BlobPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/Bindings/Serializable.h>
+#include <LibWeb/FileAPI/BlobData.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -24,7 +25,7 @@ struct BlobPropertyBag {
 };
 
 [[nodiscard]] ErrorOr<String> convert_line_endings_to_native(StringView string);
-[[nodiscard]] ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options = {});
+[[nodiscard]] ErrorOr<NonnullRefPtr<BlobData const>> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options = {});
 [[nodiscard]] bool is_basic_latin(StringView view);
 
 class Blob
@@ -37,11 +38,12 @@ public:
     virtual ~Blob() override;
 
     [[nodiscard]] static GC::Ref<Blob> create(JS::Realm&, ByteBuffer, String type);
+    [[nodiscard]] static GC::Ref<Blob> create(JS::Realm&, NonnullRefPtr<BlobData const>, String type);
     [[nodiscard]] static GC::Ref<Blob> create(JS::Realm&, Optional<Vector<BlobPart>> const& blob_parts = {}, Optional<BlobPropertyBag> const& options = {});
     static WebIDL::ExceptionOr<GC::Ref<Blob>> construct_impl(JS::Realm&, Optional<Vector<BlobPart>> const& blob_parts = {}, Optional<BlobPropertyBag> const& options = {});
 
     // https://w3c.github.io/FileAPI/#dfn-size
-    u64 size() const { return m_byte_buffer.size(); }
+    u64 size() const { return m_data->size(); }
     // https://w3c.github.io/FileAPI/#dfn-type
     String const& type() const { return m_type; }
 
@@ -52,7 +54,11 @@ public:
     GC::Ref<WebIDL::Promise> array_buffer();
     GC::Ref<WebIDL::Promise> bytes();
 
-    ReadonlyBytes raw_bytes() const { return m_byte_buffer.bytes(); }
+    // NOTE: This reads the whole blob into memory if it is not held in memory already. Prefer get_stream() or data()
+    //       for blobs which may be large, such as files selected by the user.
+    ReadonlyBytes raw_bytes() const;
+
+    NonnullRefPtr<BlobData const> const& data() const { return m_data; }
 
     GC::Ref<Streams::ReadableStream> get_stream();
 
@@ -62,14 +68,14 @@ public:
     virtual WebIDL::ExceptionOr<void> deserialization_steps(HTML::TransferDataDecoder&, HTML::DeserializationMemory&) override;
 
 protected:
-    Blob(JS::Realm&, ByteBuffer, String type);
-    Blob(JS::Realm&, ByteBuffer);
+    Blob(JS::Realm&, NonnullRefPtr<BlobData const>, String type);
+    Blob(JS::Realm&, NonnullRefPtr<BlobData const>);
 
     virtual void initialize(JS::Realm&) override;
 
     WebIDL::ExceptionOr<GC::Ref<Blob>> slice_blob(Optional<i64> start = {}, Optional<i64> end = {}, Optional<String> const& content_type = {});
 
-    ByteBuffer m_byte_buffer {};
+    NonnullRefPtr<BlobData const> m_data;
     String m_type {};
 
 private:
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibWeb/FileAPI/BlobData.h>
+
+namespace Web::FileAPI {
+
+class MemoryBlobData final : public BlobData {
+public:
+    explicit MemoryBlobData(ByteBuffer bytes)
+        : BlobData(bytes.size())
+        , m_bytes(move(bytes))
+    {
+    }
+
+    virtual Optional<ReadonlyBytes> bytes_in_memory() const override { return m_bytes.bytes(); }
+
+private:
+    virtual ErrorOr<size_t> read_impl(u64 offset, Bytes buffer) const override
+    {
+        return m_bytes.bytes().slice(offset).copy_trimmed_to(buffer);
+    }
+
+    ByteBuffer m_bytes;
+};
+
+class FileBlobData final : public BlobData {
+public:
+    FileBlobData(int fd, u64 size)
+        : BlobData(size)
+        , m_fd(fd)
+    {
+    }
+
+    virtual ~FileBlobData() override
+    {
+        MUST(Core::System::close(m_fd));
+    }
+
+private:
+    virtual ErrorOr<size_t> read_impl(u64 offset, Bytes buffer) const override
+    {
+        size_t total_read = 0;
+
+        while (total_read < buffer.size()) {
+            auto remaining = buffer.slice(total_read);
+
+            auto nread = ::pread(m_fd, remaining.data(), remaining.size(), static_cast<off_t>(offset + total_read));
+            if (nread < 0) {
+                if (errno == EINTR)
+                    continue;
+                return Error::from_syscall("pread"sv, errno);
+            }
+
+            // NOTE: The file may have been truncated since it was selected.
+            if (nread == 0)
+                return Error::from_string_literal("File was truncated while it was being read");
+
+            total_read += static_cast<size_t>(nread);
+        }
+
+        return total_read;
+    }
+
+    int m_fd { -1 };
+};
+
+class SliceBlobData final : public BlobData {
+public:
+    SliceBlobData(NonnullRefPtr<BlobData const> base, u64 offset, u64 size)
+        : BlobData(size)
+        , m_base(move(base))
+        , m_offset(offset)
+    {
+    }
+
+    virtual Optional<ReadonlyBytes> bytes_in_memory() const override
+    {
+        if (auto bytes = m_base->bytes_in_memory(); bytes.has_value())
+            return bytes->slice(m_offset, size());
+        return {};
+    }
+
+private:
+    virtual ErrorOr<size_t> read_impl(u64 offset, Bytes buffer) const override
+    {
+        return m_base->read(m_offset + offset, buffer);
+    }
+
+    // NOTE: Slices of a slice refer to its base directly, so that reading them never goes through a chain of slices.
+    virtual NonnullRefPtr<BlobData const> slice_impl(u64 offset, u64 size) const override
+    {
+        return m_base->slice(m_offset + offset, size);
+    }
+
+    NonnullRefPtr<BlobData const> m_base;
+    u64 m_offset { 0 };
+};
+
+class ConcatenatedBlobData final : public BlobData {
+public:
+    ConcatenatedBlobData(Vector<NonnullRefPtr<BlobData const>> parts, Vector<u64> part_offsets, u64 size)
+        : BlobData(size)
+        , m_parts(move(parts))
+        , m_part_offsets(move(part_offsets))
+    {
+    }
+
+private:
+    virtual ErrorOr<size_t> read_impl(u64 offset, Bytes buffer) const override
+    {
+        // Find the last part that starts at or before the offset.
+        size_t low = 0;
+        size_t high = m_part_offsets.size();
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (m_part_offsets[middle] <= offset)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+        auto part_index = low - 1;
+
+        size_t total_read = 0;
+
+        for (; part_index < m_parts.size() && total_read < buffer.size(); ++part_index) {
+            auto const& part = m_parts[part_index];
+
+            auto offset_in_part = offset + total_read - m_part_offsets[part_index];
+            if (offset_in_part >= part->size())
+                continue;
+
+            total_read += TRY(part->read(offset_in_part, buffer.slice(total_read)));
+        }
+
+        return total_read;
+    }
+
+    Vector<NonnullRefPtr<BlobData const>> m_parts;
+    Vector<u64> m_part_offsets;
+};
+
+NonnullRefPtr<BlobData const> BlobData::create(ByteBuffer bytes)
+{
+    return adopt_ref(*new MemoryBlobData(move(bytes)));
+}
+
+ErrorOr<NonnullRefPtr<BlobData const>> BlobData::create_from_file(int fd)
+{
+    auto stat = Core::System::fstat(fd);
+    if (stat.is_error()) {
+        MUST(Core::System::close(fd));
+        return stat.release_error();
+    }
+
+    return adopt_ref(*new FileBlobData(fd, static_cast<u64>(stat.value().st_size)));
+}
+
+NonnullRefPtr<BlobData const> BlobData::create_from_parts(Vector<NonnullRefPtr<BlobData const>> parts)
+{
+    parts.remove_all_matching([](auto const& part) { return part->size() == 0; });
+
+    if (parts.is_empty())
+        return empty();
+    if (parts.size() == 1)
+        return parts.take_first();
+
+    Vector<u64> part_offsets;
+    part_offsets.ensure_capacity(parts.size());
+
+    u64 size = 0;
+    for (auto const& part : parts) {
+        part_offsets.unchecked_append(size);
+        size += part->size();
+    }
+
+    return adopt_ref(*new ConcatenatedBlobData(move(parts), move(part_offsets), size));
+}
+
+NonnullRefPtr<BlobData const> BlobData::empty()
+{
+    return create({});
+}
+
+BlobData::~BlobData() = default;
+
+NonnullRefPtr<BlobData const> BlobData::slice(u64 offset, u64 size) const
+{
+    VERIFY(offset <= m_size);
+    VERIFY(size <= m_size - offset);
+
+    if (offset == 0 && size == m_size)
+        return *this;
+    if (size == 0)
+        return empty();
+
+    return slice_impl(offset, size);
+}
+
+NonnullRefPtr<BlobData const> BlobData::slice_impl(u64 offset, u64 size) const
+{
+    return adopt_ref(*new SliceBlobData(*this, offset, size));
+}
+
+ErrorOr<size_t> BlobData::read(u64 offset, Bytes buffer) const
+{
+    if (offset >= m_size)
+        return 0;
+
+    auto size_to_read = static_cast<size_t>(min<u64>(buffer.size(), m_size - offset));
+    if (size_to_read == 0)
+        return 0;
+
+    return read_impl(offset, buffer.trim(size_to_read));
+}
+
+ErrorOr<ReadonlyBytes> BlobData::bytes() const
+{
+    if (auto bytes = bytes_in_memory(); bytes.has_value())
+        return *bytes;
+
+    if (!m_materialized_bytes.has_value()) {
+        auto bytes = TRY(ByteBuffer::create_uninitialized(m_size));
+        TRY(read(0, bytes.bytes()));
+        m_materialized_bytes = move(bytes);
+    }
+
+    return m_materialized_bytes->bytes();
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/Vector.h>
+
+namespace Web::FileAPI {
+
+// The byte sequence of a blob. It is immutable, so it can be shared by every blob referring to (a part of) it: slicing
+// a blob or creating a blob from other blobs only creates a new BlobData referring to the existing ones, and bytes are
+// only read once they are needed. Bytes of a file are read from its file descriptor on demand.
+class BlobData : public RefCounted<BlobData> {
+public:
+    static NonnullRefPtr<BlobData const> create(ByteBuffer);
+    static ErrorOr<NonnullRefPtr<BlobData const>> create_from_file(int fd);
+    static NonnullRefPtr<BlobData const> create_from_parts(Vector<NonnullRefPtr<BlobData const>>);
+
+    static NonnullRefPtr<BlobData const> empty();
+
+    virtual ~BlobData();
+
+    u64 size() const { return m_size; }
+
+    // Returns the given range of our bytes, without copying them.
+    NonnullRefPtr<BlobData const> slice(u64 offset, u64 size) const;
+
+    // Reads our bytes starting at the given offset into the buffer, and returns the number of bytes read. This is less
+    // than the size of the buffer only if the end of our bytes was reached.
+    ErrorOr<size_t> read(u64 offset, Bytes buffer) const;
+
+    // Returns all of our bytes as a contiguous span. Bytes that are not already held in memory are read into a buffer,
+    // which is kept until we are destroyed. Prefer read() for large blobs that do not need to be held in memory at once.
+    ErrorOr<ReadonlyBytes> bytes() const;
+
+    // Returns our bytes if they are already held in memory.
+    virtual Optional<ReadonlyBytes> bytes_in_memory() const { return {}; }
+
+protected:
+    explicit BlobData(u64 size)
+        : m_size(size)
+    {
+    }
+
+    virtual ErrorOr<size_t> read_impl(u64 offset, Bytes buffer) const = 0;
+    virtual NonnullRefPtr<BlobData const> slice_impl(u64 offset, u64 size) const;
+
+private:
+    u64 m_size { 0 };
+    mutable Optional<ByteBuffer> m_materialized_bytes;
+};
+
+}
@@ -12,20 +12,21 @@
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::FileAPI {
 
 GC_DEFINE_ALLOCATOR(File);
 
-File::File(JS::Realm& realm, ByteBuffer byte_buffer, String file_name, String type, i64 last_modified)
-    : Blob(realm, move(byte_buffer), move(type))
+File::File(JS::Realm& realm, NonnullRefPtr<BlobData const> data, String file_name, String type, i64 last_modified)
+    : Blob(realm, move(data), move(type))
     , m_name(move(file_name))
     , m_last_modified(last_modified)
 {
 }
 
 File::File(JS::Realm& realm)
-    : Blob(realm, {})
+    : Blob(realm, BlobData::empty())
 {
 }
 
@@ -97,7 +98,10 @@ WebIDL::ExceptionOr<void> File::serialization_steps(HTML::TransferDataEncoder& s
     serialized.encode(m_type);
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    serialized.encode(m_byte_buffer);
+    auto bytes = m_data->bytes();
+    if (bytes.is_error())
+        return WebIDL::DataCloneError::create(realm(), Utf16String::formatted("Unable to read blob: {}", bytes.error()));
+    serialized.encode_bytes(bytes.value());
 
     // 3. Set serialized.[[Name]] to the value of value’s name attribute.
     serialized.encode(m_name);
@@ -119,7 +123,7 @@ WebIDL::ExceptionOr<void> File::deserialization_steps(HTML::TransferDataDecoder&
     m_type = serialized.decode<String>();
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(serialized.decode_buffer(realm));
+    m_data = BlobData::create(TRY(serialized.decode_buffer(realm)));
 
     // 3. Initialize the value of value’s name attribute to serialized.[[Name]].
     m_name = serialized.decode<String>();
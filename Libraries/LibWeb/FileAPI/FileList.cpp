@@ -57,7 +57,7 @@ WebIDL::ExceptionOr<void> FileList::serialization_steps(HTML::TransferDataEncode
     serialized.encode(m_files.size());
 
     for (auto file : m_files)
-        serialized.append(TRY(HTML::structured_serialize_internal(vm, file, for_storage, memory)));
+        TRY(HTML::structured_serialize_internal(vm, serialized, file, for_storage, memory));
 
     return {};
 }
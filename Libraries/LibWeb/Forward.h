@@ -257,6 +257,7 @@ class CSSStyleValue;
 class CSSSupportsRule;
 class CursorStyleValue;
 class CustomIdentStyleValue;
+class CustomPropertyData;
 class DimensionStyleValue;
 class Display;
 class DisplayStyleValue;
@@ -509,6 +510,7 @@ struct Header;
 namespace Web::FileAPI {
 
 class Blob;
+class BlobData;
 class File;
 class FileList;
 
@@ -711,6 +713,7 @@ class TransferDataEncoder;
 class TraversableNavigable;
 class UserActivation;
 class ValidityState;
+class VideoPlaybackQuality;
 class VideoTrack;
 class VideoTrackList;
 class Window;
@@ -830,6 +833,13 @@ struct LayoutState;
 
 }
 
+namespace Web::LongAnimationFrames {
+
+struct FrameTimingInfo;
+class PerformanceLongAnimationFrameTiming;
+
+}
+
 namespace Web::MathML {
 
 class MathMLElement;
@@ -972,6 +982,9 @@ struct SerialPortInfo;
 
 namespace Web::ServiceWorker {
 
+class Cache;
+class CacheStorage;
+class RequestResponseList;
 class ServiceWorker;
 class ServiceWorkerContainer;
 class ServiceWorkerRegistration;
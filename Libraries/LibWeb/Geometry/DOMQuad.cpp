@@ -108,16 +108,16 @@ WebIDL::ExceptionOr<void> DOMQuad::serialization_steps(HTML::TransferDataEncoder
     auto& vm = this->vm();
 
     // 1. Set serialized.[[P1]] to the sub-serialization of value’s point 1.
-    serialized.append(TRY(HTML::structured_serialize_internal(vm, m_p1, for_storage, memory)));
+    TRY(HTML::structured_serialize_internal(vm, serialized, m_p1, for_storage, memory));
 
     // 2. Set serialized.[[P2]] to the sub-serialization of value’s point 2.
-    serialized.append(TRY(HTML::structured_serialize_internal(vm, m_p2, for_storage, memory)));
+    TRY(HTML::structured_serialize_internal(vm, serialized, m_p2, for_storage, memory));
 
     // 3. Set serialized.[[P3]] to the sub-serialization of value’s point 3.
-    serialized.append(TRY(HTML::structured_serialize_internal(vm, m_p3, for_storage, memory)));
+    TRY(HTML::structured_serialize_internal(vm, serialized, m_p3, for_storage, memory));
 
     // 4. Set serialized.[[P4]] to the sub-serialization of value’s point 4.
-    serialized.append(TRY(HTML::structured_serialize_internal(vm, m_p4, for_storage, memory)));
+    TRY(HTML::structured_serialize_internal(vm, serialized, m_p4, for_storage, memory));
 
     return {};
 }
@@ -202,6 +202,14 @@ void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
     // FIXME: Make use of the rect to reduce the invalidated area when possible.
     if (!canvas_element().paintable())
         return;
+
+    // OPTIMIZATION: Scripts commonly issue thousands of drawing operations per frame. Once a repaint is pending, it
+    //               will pick up the contents of the canvas, so there is no need to request another one.
+    if (auto navigable = canvas_element().document().navigable()) {
+        if (auto traversable = navigable->traversable_navigable(); traversable && traversable->needs_repaint())
+            return;
+    }
+
     canvas_element().paintable()->set_needs_display(InvalidateDisplayList::No);
 }
 
@@ -475,9 +483,9 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = canvas_element().surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -488,17 +496,15 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
+    // OPTIMIZATION: imageData's bitmap wraps its Uint8ClampedArray, so we read the surface's pixels straight into it,
+    //               letting Skia unpremultiply them on the way, instead of snapshotting the surface and painting it.
     VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
-
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+    surface->read_into_bitmap(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
     // NOTE: No-op, already done during creation.
@@ -514,18 +520,14 @@ void CanvasRenderingContext2D::put_image_data(ImageData& image_data, float x, fl
     // given imageData, this's output bitmap, dx, dy, 0, 0, imageData's width, and imageData's height.
     // FIXME: "put pixels from an ImageData onto a bitmap" is a spec algorithm.
     //        https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
-    if (auto* painter = this->painter()) {
-        auto dst_rect = Gfx::FloatRect(x, y, image_data.width(), image_data.height());
-        painter->draw_bitmap(
-            dst_rect,
-            Gfx::ImmutableBitmap::create(image_data.bitmap(), Gfx::AlphaType::Unpremultiplied),
-            image_data.bitmap().rect(),
-            Gfx::ScalingMode::NearestNeighbor,
-            drawing_state().filter,
-            1.0f,
-            Gfx::CompositingAndBlendingOperator::SourceOver);
-        did_draw(dst_rect);
-    }
+    // NOTE: Putting pixels is not affected by the current transformation matrix, the clipping region, global alpha,
+    //       the compositing operator, shadows or filters, so we write imageData's pixels straight into the surface. Skia
+    //       premultiplies them on the way, and only writes the pixels that lie within the surface.
+    if (!painter())
+        return;
+
+    canvas_element().surface()->write_from_bitmap(image_data.bitmap(), { static_cast<int>(x), static_cast<int>(y) });
+    did_draw(Gfx::FloatRect(x, y, image_data.width(), image_data.height()));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
@@ -960,8 +962,23 @@ void CanvasRenderingContext2D::set_shadow_color(String color)
         return;
     }
 }
+
+// https://html.spec.whatwg.org/multipage/canvas.html#when-shadows-are-drawn
+bool CanvasRenderingContext2D::shadows_would_be_drawn() const
+{
+    // Shadows are only drawn if the opacity component of the alpha component of the shadow color is nonzero and
+    // either the shadowBlur is nonzero, or the shadowOffsetX is nonzero, or the shadowOffsetY is nonzero.
+    auto const& state = drawing_state();
+    if (state.shadow_color.alpha() == 0)
+        return false;
+    return state.shadow_blur != 0 || state.shadow_offset_x != 0 || state.shadow_offset_y != 0;
+}
+
 void CanvasRenderingContext2D::paint_shadow_for_fill_internal(Gfx::Path const& path, Gfx::WindingRule winding_rule)
 {
+    if (!shadows_would_be_drawn())
+        return;
+
     auto* painter = this->painter();
     if (!painter)
         return;
@@ -988,6 +1005,9 @@ void CanvasRenderingContext2D::paint_shadow_for_fill_internal(Gfx::Path const& p
 
 void CanvasRenderingContext2D::paint_shadow_for_stroke_internal(Gfx::Path const& path)
 {
+    if (!shadows_would_be_drawn())
+        return;
+
     auto* painter = this->painter();
     if (!painter)
         return;
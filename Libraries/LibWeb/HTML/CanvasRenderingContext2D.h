@@ -159,6 +159,7 @@ private:
     void clip_internal(Gfx::Path&, Gfx::WindingRule);
     void paint_shadow_for_fill_internal(Gfx::Path const&, Gfx::WindingRule);
     void paint_shadow_for_stroke_internal(Gfx::Path const&);
+    bool shadows_would_be_drawn() const;
 
     GC::Ref<HTMLCanvasElement> m_element;
     OwnPtr<Gfx::Painter> m_painter;
@@ -22,6 +22,7 @@
 #include <LibWeb/HighResolutionTime/Performance.h>
 #include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
@@ -160,7 +161,7 @@ void EventLoop::process()
 
     // 1. Let oldestTask and taskStartTime be null.
     GC::Ptr<Task> oldest_task;
-    [[maybe_unused]] double task_start_time = 0;
+    double task_start_time = 0;
 
     // 2. If the event loop has a task queue with at least one runnable task, then:
     if (m_task_queue->has_runnable_tasks()) {
@@ -173,7 +174,9 @@ void EventLoop::process()
         // 3. Set oldestTask to the first runnable task in taskQueue, and remove it from taskQueue.
         oldest_task = task_queue->take_first_runnable();
 
-        // FIXME: 4. If oldestTask's document is not null, then record task start time given taskStartTime and oldestTask's document.
+        // 4. If oldestTask's document is not null, then record task start time given taskStartTime and oldestTask's document.
+        if (auto const* document = oldest_task->document())
+            LongAnimationFrames::record_task_start_time(const_cast<DOM::Document&>(*document), task_start_time);
 
         // 5. Set the event loop's currently running task to oldestTask.
         m_currently_running_task = oldest_task.ptr();
@@ -189,7 +192,7 @@ void EventLoop::process()
     }
 
     // 3. Let taskEndTime be the unsafe shared current time. [HRT]
-    [[maybe_unused]] auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
+    auto task_end_time = HighResolutionTime::unsafe_shared_current_time();
 
     // 4. If oldestTask is not null, then:
     if (oldest_task) {
@@ -201,7 +204,13 @@ void EventLoop::process()
         // FIXME: 2.4. Let tlbc be global's browsing context's top-level browsing context.
         // FIXME: 2.5. If tlbc is not null, then append it to top-level browsing contexts.
         // FIXME: 3. Report long tasks, passing in taskStartTime, taskEndTime, top-level browsing contexts, and oldestTask.
-        // FIXME: 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
+        // 4. If oldestTask's document is not null, then record task end time given taskEndTime and oldestTask's document.
+        if (auto const* document = oldest_task->document()) {
+            // NOTE: The frame is only over once the rendering has been updated, if the task left anything to update.
+            auto navigable = document->navigable();
+            bool rendering_update_pending = m_task_queue->has_rendering_tasks() || (navigable && navigable->traversable_navigable()->needs_repaint());
+            LongAnimationFrames::record_task_end_time(const_cast<DOM::Document&>(*document), task_end_time, rendering_update_pending);
+        }
     }
 
     // 5. If this is a window event loop that has no runnable task in this event loop's task queues, then:
@@ -327,6 +336,8 @@ void EventLoop::update_the_rendering()
     // 1. Let frameTimestamp be eventLoop's last render opportunity time.
     auto frame_timestamp = m_last_render_opportunity_time;
 
+    auto rendering_start_time = HighResolutionTime::unsafe_shared_current_time();
+
     // FIXME: 2. Let docs be all fully active Document objects whose relevant agent's event loop is eventLoop, sorted arbitrarily except that the following conditions must be met:
     // 3. Filter non-renderable documents: Remove from docs any Document object doc for which any of the following are true:
     auto docs = documents_in_this_event_loop_matching([&](auto const& document) {
@@ -363,6 +374,9 @@ void EventLoop::update_the_rendering()
 
     // FIXME: 7. For each doc of docs, flush autofocus candidates for doc if its node navigable is a top-level traversable.
 
+    for (auto& document : docs)
+        LongAnimationFrames::record_rendering_start_time(*document, rendering_start_time);
+
     // 8. For each doc of docs, run the resize steps for doc. [CSSOMVIEW]
     for (auto& document : docs) {
         document->run_the_resize_steps();
@@ -390,13 +404,23 @@ void EventLoop::update_the_rendering()
     // 14. For each doc of docs, run the animation frame callbacks for doc, passing in the relative high resolution time given frameTimestamp and doc's relevant global object as the timestamp.
     for (auto& document : docs) {
         auto now = HighResolutionTime::relative_high_resolution_time(frame_timestamp, relevant_global_object(*document));
+        auto callbacks_start_time = HighResolutionTime::unsafe_shared_current_time();
         run_animation_frame_callbacks(*document, now);
+        if (auto& timing_info = document->current_frame_timing_info(); timing_info.has_value())
+            timing_info->animation_frame_callbacks_duration += HighResolutionTime::unsafe_shared_current_time() - callbacks_start_time;
     }
 
-    // FIXME: 15. Let unsafeStyleAndLayoutStartTime be the unsafe shared current time.
+    // 15. Let unsafeStyleAndLayoutStartTime be the unsafe shared current time.
+    auto unsafe_style_and_layout_start_time = HighResolutionTime::unsafe_shared_current_time();
 
     // 16. For each doc of docs:
     for (auto& document : docs) {
+        auto document_style_and_layout_start_time = HighResolutionTime::unsafe_shared_current_time();
+        ScopeGuard record_style_and_layout_duration = [&] {
+            if (auto& timing_info = document->current_frame_timing_info(); timing_info.has_value())
+                timing_info->style_and_layout_duration += HighResolutionTime::unsafe_shared_current_time() - document_style_and_layout_start_time;
+        };
+
         // 1. Let resizeObserverDepth be 0.
         size_t resize_observer_depth = 0;
 
@@ -464,7 +488,9 @@ void EventLoop::update_the_rendering()
         document->run_the_update_intersection_observations_steps(now);
     }
 
-    // FIXME: 20. For each doc of docs, record rendering time for doc given unsafeStyleAndLayoutStartTime.
+    // 20. For each doc of docs, record rendering time for doc given unsafeStyleAndLayoutStartTime.
+    for (auto& document : docs)
+        LongAnimationFrames::record_rendering_time(*document, unsafe_style_and_layout_start_time);
 
     // FIXME: 21. For each doc of docs, mark paint timing for doc.
 
@@ -477,7 +503,10 @@ void EventLoop::update_the_rendering()
         traversable->process_screenshot_requests();
         if (!navigable->needs_repaint())
             continue;
+        auto paint_start_time = HighResolutionTime::unsafe_shared_current_time();
         navigable->paint_next_frame();
+        if (auto& timing_info = document->current_frame_timing_info(); timing_info.has_value())
+            timing_info->paint_duration += HighResolutionTime::unsafe_shared_current_time() - paint_start_time;
     }
 
     // 23. For each doc of docs, process top layer removals given doc.
@@ -491,6 +520,10 @@ void EventLoop::update_the_rendering()
             document->fonts()->resolve_ready_promise();
         }
     }
+
+    // NOTE: The frame of every document whose rendering was updated ends here.
+    for (auto& document : docs)
+        LongAnimationFrames::flush_frame_timing(*document);
 }
 
 // https://html.spec.whatwg.org/multipage/webappapis.html#queue-a-task
@@ -39,7 +39,7 @@ GC::Ref<DOM::HTMLCollection> HTMLDataListElement::options()
     if (!m_options) {
         m_options = DOM::HTMLCollection::create(*this, DOM::HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLOptionElement>(element);
-        });
+        }, DOM::HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_options;
 }
@@ -592,10 +592,23 @@ void HTMLInputElement::did_select_files(Span<SelectedFile> selected_files, Multi
     auto files = FileAPI::FileList::create(realm());
 
     for (auto& selected_file : selected_files) {
-        auto contents = selected_file.take_contents();
+        auto data = selected_file.take_data();
+        if (data.is_error()) {
+            dbgln("Unable to read selected file '{}': {}", selected_file.name(), data.error());
+            continue;
+        }
+
+        // NOTE: MIME type sniffing only looks at the first 1445 bytes of a resource, so that is all we read here.
+        static constexpr size_t mime_type_sniffing_size = 1445;
+
+        auto resource_header = MUST(ByteBuffer::create_uninitialized(min<u64>(data.value()->size(), mime_type_sniffing_size)));
+        if (auto result = data.value()->read(0, resource_header.bytes()); result.is_error()) {
+            dbgln("Unable to read selected file '{}': {}", selected_file.name(), result.error());
+            continue;
+        }
 
-        auto mime_type = MimeSniff::Resource::sniff(contents);
-        auto blob = FileAPI::Blob::create(realm(), move(contents), mime_type.essence());
+        auto mime_type = MimeSniff::Resource::sniff(resource_header);
+        auto blob = FileAPI::Blob::create(realm(), data.release_value(), mime_type.essence());
 
         // FIXME: The FileAPI should use ByteString for file names.
         auto file_name = MUST(String::from_byte_string(selected_file.name()));
@@ -28,6 +28,7 @@
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/HTMLLinkElement.h>
 #include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
@@ -85,6 +86,15 @@ void HTMLLinkElement::inserted()
             fetch_and_process_linked_resource();
     }
 
+    if (m_relationship & Relationship::ModulePreload) {
+        // https://html.spec.whatwg.org/multipage/links.html#link-type-modulepreload
+        // The appropriate times to fetch and process the linked resource for such a link are:
+        //  - When the external resource link is created on a link element that is already browsing-context connected.
+        //  - When the external resource link's link element becomes browsing-context connected.
+        if (is_browsing_context_connected())
+            fetch_and_process_modulepreload_resource();
+    }
+
     // FIXME: Follow spec for fetching and processing these attributes as well
     if (m_relationship & Relationship::Preload) {
         if (auto maybe_href = document().encoding_parse_url(get_attribute_value(HTML::AttributeNames::href)); maybe_href.has_value()) {
@@ -194,6 +204,8 @@ void HTMLLinkElement::attribute_changed(FlyString const& name, Optional<String>
                 m_relationship |= Relationship::Preconnect;
             else if (part == "icon"sv)
                 m_relationship |= Relationship::Icon;
+            else if (part == "modulepreload"sv)
+                m_relationship |= Relationship::ModulePreload;
         }
 
         if (m_rel_list)
@@ -234,6 +246,96 @@ void HTMLLinkElement::attribute_changed(FlyString const& name, Optional<String>
             m_loaded_style_sheet->set_media(value.value_or(String {}));
         }
     }
+
+    if (m_relationship & Relationship::ModulePreload) {
+        // https://html.spec.whatwg.org/multipage/links.html#link-type-modulepreload
+        // The appropriate times to fetch and process the linked resource for such a link are:
+        if (is_browsing_context_connected()
+            && (
+                // AD-HOC: When the link element's type becomes a modulepreload link
+                !(old_relationship & Relationship::ModulePreload) ||
+                // - When the href attribute of the link element of an external resource link that is already browsing-context connected is changed.
+                name == AttributeNames::href)) {
+            fetch_and_process_modulepreload_resource();
+        }
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#link-type-modulepreload:fetch-and-process-the-linked-resource
+void HTMLLinkElement::fetch_and_process_modulepreload_resource()
+{
+    // 1. If el's href attribute's value is the empty string, then return.
+    auto href = get_attribute_value(HTML::AttributeNames::href);
+    if (href.is_empty())
+        return;
+
+    // 2. Let destination be the current state of el's as attribute (a destination), or "script" if it is in no state.
+    // 3. If destination is not script-like, then queue an element task on the networking task source given el to fire an
+    //    event named error at el, and return.
+    // FIXME: Support the script-like destinations of worklets and workers.
+    auto destination = Fetch::Infrastructure::Request::Destination::Script;
+    if (auto as = get_attribute_value(HTML::AttributeNames::as); !as.is_empty() && !as.equals_ignoring_ascii_case("script"sv)) {
+        queue_an_element_task(HTML::Task::Source::Networking, [this] {
+            dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
+        });
+        return;
+    }
+
+    // 4. Let url be the result of encoding-parsing a URL given el's href attribute's value, relative to el's node document.
+    auto url = document().encoding_parse_url(href);
+
+    // 5. If url is failure, then return.
+    if (!url.has_value())
+        return;
+
+    // 6. Let settings object be el's node document's relevant settings object.
+    auto& settings_object = document().relevant_settings_object();
+
+    // 7. Let credentials mode be the CORS settings attribute credentials mode for el's crossorigin attribute.
+    auto credentials_mode = cors_settings_attribute_credentials_mode(cors_setting_attribute_from_keyword(get_attribute(AttributeNames::crossorigin)));
+
+    // 8. Let cryptographic nonce be el.[[CryptographicNonce]].
+    auto cryptographic_nonce = m_cryptographic_nonce;
+
+    // 9. Let integrity metadata be the value of el's integrity attribute, if it is specified, or the empty string otherwise.
+    // 10. If el does not have an integrity attribute, then set integrity metadata to the result of resolving a module
+    //     integrity metadata with url and settings object.
+    String integrity_metadata;
+    if (auto maybe_integrity = get_attribute(AttributeNames::integrity); maybe_integrity.has_value())
+        integrity_metadata = maybe_integrity.release_value();
+    else
+        integrity_metadata = resolve_a_module_integrity_metadata(*url, settings_object);
+
+    // 11. Let referrer policy be the current state of el's referrerpolicy attribute.
+    auto referrer_policy = ReferrerPolicy::from_string(get_attribute_value(AttributeNames::referrerpolicy)).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString);
+
+    // 12. Let fetch priority be the current state of el's fetchpriority attribute.
+    auto fetch_priority = Fetch::Infrastructure::request_priority_from_string(get_attribute_value(HTML::AttributeNames::fetchpriority)).value_or(Fetch::Infrastructure::Request::Priority::Auto);
+
+    // 13. Let options be a script fetch options whose cryptographic nonce is cryptographic nonce, integrity metadata is
+    //     integrity metadata, parser metadata is "not-parser-inserted", credentials mode is credentials mode, referrer
+    //     policy is referrer policy, and fetch priority is fetch priority.
+    ScriptFetchOptions options {
+        .cryptographic_nonce = move(cryptographic_nonce),
+        .integrity_metadata = move(integrity_metadata),
+        .parser_metadata = Fetch::Infrastructure::Request::ParserMetadata::NotParserInserted,
+        .credentials_mode = credentials_mode,
+        .referrer_policy = referrer_policy,
+        .fetch_priority = fetch_priority,
+    };
+
+    // 14. Fetch a modulepreload module script graph given url, destination, settings object, options, and with the
+    //     following steps given result:
+    fetch_modulepreload_module_script_graph(realm(), *url, destination, settings_object, options, create_on_fetch_script_complete(heap(), [this](auto result) {
+        // 1. If result is null, then fire an event named error at el, and return.
+        if (!result) {
+            dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
+            return;
+        }
+
+        // 2. Fire an event named load at el.
+        dispatch_event(DOM::Event::create(realm(), HTML::EventNames::load));
+    }));
 }
 
 void HTMLLinkElement::resource_did_fail()
@@ -596,6 +698,9 @@ void HTMLLinkElement::resource_did_load_favicon()
     document().check_favicon_after_loading_link_resource();
 }
 
+// Favicons are only ever displayed at small sizes by the UI, so there's no need to keep a huge decoded bitmap around.
+static constexpr Gfx::IntSize favicon_ideal_size { 64, 64 };
+
 static NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_favicon(ReadonlyBytes favicon_data, URL::URL const& favicon_url, GC::Ref<DOM::Document> document)
 {
     auto on_failed_decode = [favicon_url]([[maybe_unused]] Error& error) {
@@ -613,7 +718,7 @@ static NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> decode_favicon(
         return {};
     };
 
-    auto promise = Platform::ImageCodecPlugin::the().decode_image(favicon_data, move(on_successful_decode), move(on_failed_decode));
+    auto promise = Platform::ImageCodecPlugin::the().decode_image(favicon_data, move(on_successful_decode), move(on_failed_decode), favicon_ideal_size, Platform::FramesToDecode::FirstOnly);
 
     return promise;
 }
@@ -138,6 +138,9 @@ private:
     // https://html.spec.whatwg.org/multipage/semantics.html#default-fetch-and-process-the-linked-resource
     void default_fetch_and_process_linked_resource();
 
+    // https://html.spec.whatwg.org/multipage/links.html#link-type-modulepreload:fetch-and-process-the-linked-resource
+    void fetch_and_process_modulepreload_resource();
+
     void resource_did_load_favicon();
 
     struct Relationship {
@@ -148,6 +151,7 @@ private:
             DNSPrefetch = 1 << 3,
             Preconnect = 1 << 4,
             Icon = 1 << 5,
+            ModulePreload = 1 << 6,
         };
     };
 
@@ -39,7 +39,7 @@ GC::Ref<DOM::HTMLCollection> HTMLMapElement::areas()
     if (!m_areas) {
         m_areas = DOM::HTMLCollection::create(*this, DOM::HTMLCollection::Scope::Descendants, [](Element const& element) {
             return is<HTML::HTMLAreaElement>(element);
-        });
+        }, DOM::HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_areas;
 }
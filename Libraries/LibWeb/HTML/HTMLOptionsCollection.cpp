@@ -24,7 +24,7 @@ GC::Ref<HTMLOptionsCollection> HTMLOptionsCollection::create(DOM::ParentNode& ro
 }
 
 HTMLOptionsCollection::HTMLOptionsCollection(DOM::ParentNode& root, Function<bool(DOM::Element const&)> filter)
-    : DOM::HTMLCollection(root, Scope::Descendants, move(filter))
+    : DOM::HTMLCollection(root, Scope::Descendants, move(filter), FilterDependencies::TreeStructure)
 {
     m_legacy_platform_object_flags->has_indexed_property_setter = true;
     m_legacy_platform_object_flags->indexed_property_setter_has_identifier = true;
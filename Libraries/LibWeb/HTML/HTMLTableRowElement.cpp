@@ -87,7 +87,7 @@ GC::Ref<DOM::HTMLCollection> HTMLTableRowElement::cells() const
     if (!m_cells) {
         m_cells = DOM::HTMLCollection::create(const_cast<HTMLTableRowElement&>(*this), DOM::HTMLCollection::Scope::Children, [](Element const& element) {
             return is<HTMLTableCellElement>(element);
-        });
+        }, DOM::HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_cells;
 }
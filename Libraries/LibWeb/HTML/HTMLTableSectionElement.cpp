@@ -49,7 +49,7 @@ GC::Ref<DOM::HTMLCollection> HTMLTableSectionElement::rows() const
     if (!m_rows) {
         m_rows = DOM::HTMLCollection::create(const_cast<HTMLTableSectionElement&>(*this), DOM::HTMLCollection::Scope::Children, [](Element const& element) {
             return is<HTMLTableRowElement>(element);
-        });
+        }, DOM::HTMLCollection::FilterDependencies::TreeStructure);
     }
     return *m_rows;
 }
@@ -18,8 +18,11 @@
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
 #include <LibWeb/HTML/AudioTrackList.h>
 #include <LibWeb/HTML/HTMLVideoElement.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/VideoPlaybackQuality.h>
 #include <LibWeb/HTML/VideoTrack.h>
 #include <LibWeb/HTML/VideoTrackList.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 #include <LibWeb/Layout/VideoBox.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
@@ -115,9 +118,13 @@ void HTMLVideoElement::set_video_track(GC::Ptr<HTML::VideoTrack> video_track)
     if (auto layout_node = this->layout_node())
         layout_node->set_needs_layout_update(DOM::SetNeedsLayoutReason::HTMLVideoElementSetVideoTrack);
 
-    if (m_video_track)
+    if (m_video_track) {
         m_video_track->pause_video({});
 
+        m_dropped_frame_count_of_previous_tracks += m_video_track->dropped_frame_count();
+        m_presented_frame_count_of_previous_tracks += m_video_track->presented_frame_count();
+    }
+
     m_video_track = video_track;
 }
 
@@ -128,6 +135,32 @@ void HTMLVideoElement::set_current_frame(Badge<VideoTrack>, RefPtr<Gfx::Bitmap>
         paintable()->set_needs_display();
 }
 
+// https://w3c.github.io/media-playback-quality/#dom-htmlvideoelement-getvideoplaybackquality
+GC::Ref<VideoPlaybackQuality> HTMLVideoElement::get_video_playback_quality()
+{
+    auto dropped_frame_count = m_dropped_frame_count_of_previous_tracks;
+    auto presented_frame_count = m_presented_frame_count_of_previous_tracks;
+    if (m_video_track) {
+        dropped_frame_count += m_video_track->dropped_frame_count();
+        presented_frame_count += m_video_track->presented_frame_count();
+    }
+
+    // 1. Let playbackQuality be a new instance of VideoPlaybackQuality.
+    // 2. Set playbackQuality.creationTime to the value returned by a call to Performance.now().
+    auto creation_time = HighResolutionTime::current_high_resolution_time(relevant_global_object(*this));
+
+    // 3. Set playbackQuality.droppedVideoFrames to the number of frames dropped predecode or dropped because the frame
+    //    missed its display deadline since the creation of the associated HTMLVideoElement.
+    // 4. Set playbackQuality.totalVideoFrames to the number of frames that would have been displayed if no frames are
+    //    dropped since the creation of the associated HTMLVideoElement.
+    // NOTE: The counts are clamped to the range of the unsigned long attributes that expose them.
+    auto dropped_video_frames = static_cast<u32>(min(dropped_frame_count, NumericLimits<u32>::max()));
+    auto total_video_frames = static_cast<u32>(min(dropped_frame_count + presented_frame_count, NumericLimits<u32>::max()));
+
+    // 5. Return playbackQuality.
+    return VideoPlaybackQuality::create(realm(), creation_time, dropped_video_frames, total_video_frames);
+}
+
 void HTMLVideoElement::on_playing()
 {
     if (m_video_track)
@@ -231,7 +264,9 @@ WebIDL::ExceptionOr<void> HTMLVideoElement::determine_element_poster_frame(Optio
                         strong_this->m_poster_frame = move(image.frames[0].bitmap);
                     return {};
                 },
-                [](auto&) {});
+                [](auto&) {},
+                {},
+                Platform::FramesToDecode::FirstOnly);
         });
 
         VERIFY(response->body());
@@ -42,6 +42,8 @@ public:
     VideoFrame const& current_frame() const { return m_current_frame; }
     RefPtr<Gfx::Bitmap> const& poster_frame() const { return m_poster_frame; }
 
+    GC::Ref<VideoPlaybackQuality> get_video_playback_quality();
+
     // FIXME: This is a hack for images used as CanvasImageSource. Do something more elegant.
     RefPtr<Gfx::Bitmap> bitmap() const
     {
@@ -74,6 +76,11 @@ private:
     VideoFrame m_current_frame;
     RefPtr<Gfx::Bitmap> m_poster_frame;
 
+    // The frame counts of the video tracks that this element has played before its current one, which are included in
+    // its playback quality.
+    u64 m_dropped_frame_count_of_previous_tracks { 0 };
+    u64 m_presented_frame_count_of_previous_tracks { 0 };
+
     u32 m_video_width { 0 };
     u32 m_video_height { 0 };
 
@@ -185,8 +185,7 @@ WebIDL::ExceptionOr<void> ImageData::serialization_steps(HTML::TransferDataEncod
     auto& vm = this->vm();
 
     // 1. Set serialized.[[Data]] to the sub-serialization of the value of value's data attribute.
-    auto serialized_data = TRY(structured_serialize_internal(vm, m_data, for_storage, memory));
-    serialized.append(move(serialized_data));
+    TRY(structured_serialize_internal(vm, serialized, m_data, for_storage, memory));
 
     // 2. Set serialized.[[Width]] to the value of value's width attribute.
     serialized.encode(m_bitmap->width());
@@ -305,7 +305,7 @@ void MessagePort::read_from_transport()
         return;
 
     auto schedule_shutdown = m_transport->read_as_many_messages_as_possible_without_blocking([this](auto&& raw_message) {
-        FixedMemoryStream stream { raw_message.bytes.span(), FixedMemoryStream::Mode::ReadOnly };
+        FixedMemoryStream stream { raw_message.bytes, FixedMemoryStream::Mode::ReadOnly };
         IPC::Decoder decoder { stream, raw_message.fds };
 
         auto serialized_transfer_record = MUST(decoder.decode<SerializedTransferRecord>());
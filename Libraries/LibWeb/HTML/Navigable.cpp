@@ -112,23 +112,27 @@ bool Navigable::is_ancestor_of(GC::Ref<Navigable> other) const
 }
 
 static RefPtr<Gfx::SkiaBackendContext> g_cached_skia_backend_context;
+static bool g_skia_backend_context_creation_failed { false };
 
 static RefPtr<Gfx::SkiaBackendContext> get_skia_backend_context()
 {
-    if (!g_cached_skia_backend_context) {
+    // NOTE: If the GPU backend can't be set up, we fall back to painting on the CPU. Don't keep retrying for every
+    //       new navigable, as that is unlikely to succeed later on.
+    if (!g_cached_skia_backend_context && !g_skia_backend_context_creation_failed) {
 #ifdef AK_OS_MACOS
-        auto metal_context = Gfx::get_metal_context();
-        g_cached_skia_backend_context = Gfx::SkiaBackendContext::create_metal_context(*metal_context);
+        if (auto metal_context = Gfx::get_metal_context())
+            g_cached_skia_backend_context = Gfx::SkiaBackendContext::create_metal_context(metal_context.release_nonnull());
 #elif USE_VULKAN
         auto maybe_vulkan_context = Gfx::create_vulkan_context();
         if (maybe_vulkan_context.is_error()) {
             dbgln("Vulkan context creation failed: {}", maybe_vulkan_context.error());
-            return {};
+        } else {
+            auto vulkan_context = maybe_vulkan_context.release_value();
+            g_cached_skia_backend_context = Gfx::SkiaBackendContext::create_vulkan_context(vulkan_context);
         }
-
-        auto vulkan_context = maybe_vulkan_context.release_value();
-        g_cached_skia_backend_context = Gfx::SkiaBackendContext::create_vulkan_context(vulkan_context);
 #endif
+        if (!g_cached_skia_backend_context)
+            g_skia_backend_context_creation_failed = true;
     }
     return g_cached_skia_backend_context;
 }
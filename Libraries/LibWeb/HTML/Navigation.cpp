@@ -5,6 +5,7 @@
  */
 
 #include <LibGC/Heap.h>
+#include <LibGC/RootVector.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
@@ -1517,4 +1518,60 @@ void Navigation::update_the_navigation_api_entries_for_a_same_document_navigatio
     clean_up_after_running_script(relevant_realm(*this));
 }
 
+// https://html.spec.whatwg.org/multipage/nav-history-apis.html#update-the-navigation-api-entries-for-reactivation
+void Navigation::update_the_navigation_api_entries_for_reactivation(Vector<GC::Ref<SessionHistoryEntry>> const& new_shes, GC::Ref<SessionHistoryEntry> reactivated_entry)
+{
+    auto& realm = relevant_realm(*this);
+
+    // 1. If navigation has entries and events disabled, then return.
+    if (has_entries_and_events_disabled())
+        return;
+
+    // 2. Let newNHEs be a new empty list.
+    Vector<GC::Ref<NavigationHistoryEntry>> new_nhes;
+
+    // 3. Let oldNHEs be a clone of navigation's entry list.
+    GC::RootVector<GC::Ref<NavigationHistoryEntry>> old_nhes(realm.heap(), m_entry_list.span());
+
+    // 4. For each newSHE of newSHEs:
+    for (auto const& new_she : new_shes) {
+        // 1. Let newNHE be null.
+        GC::Ptr<NavigationHistoryEntry> new_nhe;
+
+        // 2. If oldNHEs contains a NavigationHistoryEntry matchingOldNHE whose session history entry is newSHE, then:
+        auto matching_old_nhe_index = old_nhes.find_first_index_if([&](auto const& old_nhe) {
+            return &old_nhe->session_history_entry() == new_she.ptr();
+        });
+        if (matching_old_nhe_index.has_value()) {
+            // 1. Set newNHE to matchingOldNHE.
+            // 2. Remove matchingOldNHE from oldNHEs.
+            new_nhe = old_nhes.take(*matching_old_nhe_index);
+        }
+        // 3. Otherwise:
+        else {
+            // 1. Set newNHE to a new NavigationHistoryEntry created in the relevant realm of navigation.
+            // 2. Set newNHE's session history entry to newSHE.
+            new_nhe = NavigationHistoryEntry::create(realm, new_she);
+        }
+
+        // 4. Append newNHE to newNHEs.
+        new_nhes.append(*new_nhe);
+    }
+
+    // 5. Set navigation's entry list to newNHEs.
+    m_entry_list = move(new_nhes);
+
+    // 6. Set navigation's current entry index to the result of getting the navigation API entry index of reactivatedEntry within navigation.
+    m_current_entry_index = get_the_navigation_api_entry_index(*reactivated_entry);
+
+    // 7. Queue a global task on the navigation and traversal task source given navigation's relevant global object to run the following steps:
+    queue_global_task(Task::Source::NavigationAndTraversal, relevant_global_object(*this), GC::create_function(heap(), [&realm, old_nhes = move(old_nhes)] {
+        // 1. For each disposedNHE of oldNHEs:
+        for (auto& disposed_nhe : old_nhes) {
+            // 1. Fire an event named dispose at disposedNHE.
+            disposed_nhe->dispatch_event(DOM::Event::create(realm, EventNames::dispose, {}));
+        }
+    }));
+}
+
 }
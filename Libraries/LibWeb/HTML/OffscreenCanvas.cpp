@@ -10,6 +10,7 @@
 #include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/OffscreenCanvasRenderingContext2D.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebGL/WebGL2RenderingContext.h>
@@ -80,25 +81,65 @@ OffscreenCanvas::OffscreenCanvas(JS::Realm& realm, RefPtr<Gfx::Bitmap> bitmap)
 
 OffscreenCanvas::~OffscreenCanvas() = default;
 
-WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_steps(HTML::TransferDataEncoder&)
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_steps(HTML::TransferDataEncoder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::transfer_steps(HTML::TransferDataEncoder&)");
+    // 1. If value's context mode is not equal to none, then throw an "InvalidStateError" DOMException.
+    if (!m_context.has<Empty>())
+        return WebIDL::InvalidStateError::create(realm(), "Cannot transfer an OffscreenCanvas that has a rendering context"_utf16);
+
+    // 2. Set value's context mode to detached.
+    // NOTE: The caller sets our [[Detached]] internal slot, which we use to represent the detached context mode.
+
+    // 3. Let width and height be the dimensions of value's bitmap.
+    auto size = bitmap_size_for_canvas();
+
+    // FIXME: 4. Let language and direction be the values of value's inherited language and inherited direction.
+
+    // 5. Unset value's bitmap.
+    m_bitmap = nullptr;
+
+    // 6. Set dataHolder.[[Width]] to width and dataHolder.[[Height]] to height.
+    data_holder.encode(size.width());
+    data_holder.encode(size.height());
+
+    // FIXME: 7. Set dataHolder.[[Language]] to language and dataHolder.[[Direction]] to direction.
+
+    // FIXME: 8. Set dataHolder.[[PlaceholderCanvas]] to be a weak reference to value's placeholder canvas element, if
+    //           value has one, or null if it does not.
+
     return {};
 }
 
-WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataDecoder&)
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-receiving-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataDecoder& data_holder)
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataDecoder&)");
+    auto width = data_holder.decode<int>();
+    auto height = data_holder.decode<int>();
+
+    // 1. Initialize value's bitmap to a rectangular array of transparent black pixels with width given by
+    //    dataHolder.[[Width]] and height given by dataHolder.[[Height]].
+    if (width > 0 && height > 0) {
+        auto bitmap_or_error = Gfx::Bitmap::create(Gfx::BitmapFormat::RGBA8888, Gfx::IntSize { width, height });
+        if (bitmap_or_error.is_error())
+            return WebIDL::InvalidStateError::create(realm(), Utf16String::formatted("Error in allocating bitmap: {}", bitmap_or_error.error()));
+        m_bitmap = bitmap_or_error.release_value();
+    } else {
+        m_bitmap = nullptr;
+    }
+
+    // FIXME: 2. Set value's inherited language to dataHolder.[[Language]] and its inherited direction to
+    //           dataHolder.[[Direction]].
+
+    // FIXME: 3. If dataHolder.[[PlaceholderCanvas]] is not null, set value's placeholder canvas element to
+    //           dataHolder.[[PlaceholderCanvas]] (while maintaining the weak reference semantics).
+
     return {};
 }
 
 HTML::TransferType OffscreenCanvas::primary_interface() const
 {
-    // FIXME: Implement this
-    dbgln("(STUBBED) OffscreenCanvas::primary_interface()");
-    return {};
+    return TransferType::OffscreenCanvas;
 }
 
 WebIDL::UnsignedLong OffscreenCanvas::width() const
@@ -226,7 +267,9 @@ WebIDL::ExceptionOr<GC::Ref<ImageBitmap>> OffscreenCanvas::transfer_to_image_bit
 {
     // The transferToImageBitmap() method, when invoked, must run the following steps :
 
-    // FIXME: 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then throw an "InvalidStateError" DOMException.
+    // 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then throw an "InvalidStateError" DOMException.
+    if (is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_utf16);
 
     // 2. If this OffscreenCanvas object's context mode is set to none, then throw an "InvalidStateError" DOMException.
     if (m_context.has<Empty>()) {
@@ -265,7 +308,11 @@ GC::Ref<WebIDL::Promise> OffscreenCanvas::convert_to_blob(Optional<ImageEncodeOp
 {
     // The convertToBlob(options) method, when invoked, must run the following steps:
 
-    // FIXME: 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then return a promise rejected with an "InvalidStateError" DOMException.
+    // 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then return a promise rejected with an "InvalidStateError" DOMException.
+    if (is_detached()) {
+        auto error = WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_utf16);
+        return WebIDL::create_rejected_promise_from_exception(realm(), error);
+    }
 
     // FIXME 2. If this OffscreenCanvas object's context mode is 2d and the rendering context's output bitmap's origin-clean flag is set to false, then return a promise rejected with a "SecurityError" DOMException.
 
@@ -157,7 +157,12 @@ static bool is_html_integration_point(DOM::Element const& element)
 }
 
 HTMLParser::HTMLParser(DOM::Document& document, StringView input, StringView encoding)
-    : m_tokenizer(input, encoding)
+    : HTMLParser(document, HTMLTokenizer::decode_input(input, encoding), encoding)
+{
+}
+
+HTMLParser::HTMLParser(DOM::Document& document, HTMLTokenizer::DecodedInput decoded_input, StringView encoding)
+    : m_tokenizer(move(decoded_input))
     , m_scripting_enabled(document.is_scripting_enabled())
     , m_document(document)
 {
@@ -1409,15 +1414,42 @@ void HTMLParser::flush_character_insertions()
 {
     if (m_character_insertion_builder.is_empty())
         return;
+
+    // NOTE: We copy the collected characters out of the builder rather than letting the string take over its buffer,
+    //       so that the builder keeps its capacity and does not have to grow again for every run of characters.
+    auto data = Utf16String::from_utf16(m_character_insertion_builder.utf16_string_view());
+    m_character_insertion_builder.clear();
+
     if (m_character_insertion_node->data().is_empty())
-        m_character_insertion_node->set_data(m_character_insertion_builder.to_utf16_string());
+        m_character_insertion_node->set_data(data);
     else
-        (void)m_character_insertion_node->append_data(m_character_insertion_builder.to_utf16_string());
-    m_character_insertion_builder.clear();
+        (void)m_character_insertion_node->append_data(data);
+}
+
+bool HTMLParser::can_append_to_character_insertion_node()
+{
+    // NOTE: This returns true if finding the appropriate place for inserting a node would end up right after the last
+    //       character we inserted, i.e. after the last child of the current node (which is not a template element,
+    //       as we would then insert into its template contents instead).
+    if (!m_character_insertion_node || m_foster_parenting)
+        return false;
+
+    auto current = current_node();
+    if (!current || is<HTMLTemplateElement>(*current))
+        return false;
+
+    return m_character_insertion_node->parent() == current && current->last_child() == m_character_insertion_node;
 }
 
 void HTMLParser::insert_character(u32 data)
 {
+    // OPTIMIZATION: Characters tend to come in runs that all end up in the same text node. While that's the case, we
+    //               keep collecting them in the same builder, and only touch the DOM once the run is over.
+    if (can_append_to_character_insertion_node()) {
+        m_character_insertion_builder.append_code_point(data);
+        return;
+    }
+
     auto node = find_character_insertion_node();
     if (node == m_character_insertion_node.ptr()) {
         m_character_insertion_builder.append_code_point(data);
@@ -3293,7 +3325,10 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: Our speculative HTML parser runs to the end of its input right away, rather than in parallel,
+                    //       so there is nothing to stop in step 7.
+                    m_preload_scanner.scan(*m_document, m_tokenizer);
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -5104,12 +5139,18 @@ GC::Ref<HTMLParser> HTMLParser::create_for_scripting(DOM::Document& document)
     return document.realm().create<HTMLParser>(document);
 }
 
-GC::Ref<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
+ByteString HTMLParser::encoding_for_uncertain_input(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
 {
     if (document.has_encoding())
-        return document.realm().create<HTMLParser>(document, input, document.encoding().value().to_byte_string());
+        return document.encoding().value().to_byte_string();
     auto encoding = run_encoding_sniffing_algorithm(document, input, maybe_mime_type);
     dbgln_if(HTML_PARSER_DEBUG, "The encoding sniffing algorithm returned encoding '{}'", encoding);
+    return encoding;
+}
+
+GC::Ref<HTMLParser> HTMLParser::create_with_uncertain_encoding(DOM::Document& document, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type)
+{
+    auto encoding = encoding_for_uncertain_input(document, input, move(maybe_mime_type));
     return document.realm().create<HTMLParser>(document, input, encoding);
 }
 
@@ -5118,16 +5159,20 @@ GC::Ref<HTMLParser> HTMLParser::create(DOM::Document& document, StringView input
     return document.realm().create<HTMLParser>(document, input, encoding);
 }
 
+GC::Ref<HTMLParser> HTMLParser::create_with_decoded_input(DOM::Document& document, HTMLTokenizer::DecodedInput decoded_input, StringView encoding)
+{
+    return document.realm().create<HTMLParser>(document, move(decoded_input), encoding);
+}
+
 enum class AttributeMode {
     No,
     Yes,
 };
 
 template<OneOf<Utf8View, Utf16View> ViewType>
-static String escape_string(ViewType const& string, AttributeMode attribute_mode)
+static void append_escaped_string(StringBuilder& builder, ViewType const& string, AttributeMode attribute_mode)
 {
     // https://html.spec.whatwg.org/multipage/parsing.html#escapingString
-    StringBuilder builder;
     for (auto code_point : string) {
         // 1. Replace any occurrence of the "&" character by the string "&amp;".
         if (code_point == '&')
@@ -5147,19 +5192,17 @@ static String escape_string(ViewType const& string, AttributeMode attribute_mode
         else
             builder.append_code_point(code_point);
     }
-    return builder.to_string_without_validation();
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
-String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, Vector<GC::Root<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
+// NOTE: This appends to the string builder of the outermost invocation of the algorithm, instead of creating (and then
+//       copying) a new string for every element that is serialized.
+static void serialize_html_fragment_into(StringBuilder& builder, DOM::Node const& node, HTMLParser::SerializableShadowRoots serializable_shadow_roots, Vector<GC::Root<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
 {
     // NOTE: Steps in this function are jumbled a bit to accommodate the Element.outerHTML API.
     //       When called with FragmentSerializationMode::Outer, we will serialize the element itself,
     //       not just its children.
 
-    // 2. Let s be a string, and initialize it to the empty string.
-    StringBuilder builder;
-
     auto serialize_element = [&](DOM::Element const& element) {
         // If current node is an element in the HTML namespace, the MathML namespace, or the SVG namespace, then let tagname be current node's local name.
         // Otherwise, let tagname be current node's qualified name.
@@ -5180,7 +5223,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // followed by a U+0022 QUOTATION MARK character (").
         if (element.is_value().has_value() && !element.has_attribute(AttributeNames::is)) {
             builder.append(" is=\""sv);
-            builder.append(escape_string(element.is_value().value().code_points(), AttributeMode::Yes));
+            append_escaped_string(builder, element.is_value().value().code_points(), AttributeMode::Yes);
             builder.append('"');
         }
 
@@ -5213,7 +5256,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             builder.append(attribute.name());
 
             builder.append("=\""sv);
-            builder.append(escape_string(attribute.value().code_points(), AttributeMode::Yes));
+            append_escaped_string(builder, attribute.value().code_points(), AttributeMode::Yes);
             builder.append('"');
         });
 
@@ -5230,7 +5273,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // a U+002F SOLIDUS character (/),
         // tagname again,
         // and finally a U+003E GREATER-THAN SIGN character (>).
-        builder.append(serialize_html_fragment(element, serializable_shadow_roots, shadow_roots));
+        serialize_html_fragment_into(builder, element, serializable_shadow_roots, shadow_roots, DOM::FragmentSerializationMode::Inner);
         builder.append("</"sv);
         builder.append(tag_name);
         builder.append('>');
@@ -5240,7 +5283,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
     if (fragment_serialization_mode == DOM::FragmentSerializationMode::Outer) {
         serialize_element(as<DOM::Element>(node));
-        return builder.to_string_without_validation();
+        return;
     }
 
     // The algorithm takes as input a DOM Element, Document, or DocumentFragment referred to as the node.
@@ -5253,7 +5296,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // 1. If the node serializes as void, then return the empty string.
         //    (NOTE: serializes as void is defined only on elements in the spec)
         if (element.serializes_as_void())
-            return String {};
+            return;
 
         // 3. If the node is a template element, then let the node instead be the template element's template contents (a DocumentFragment node).
         //    (NOTE: This is out of order of the spec to avoid another dynamic cast. The second step just creates a string builder, so it shouldn't matter)
@@ -5268,7 +5311,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             // 2. If one of the following is true:
             //    - serializableShadowRoots is true and shadow's serializable is true; or
             //    - shadowRoots contains shadow,
-            if ((serializable_shadow_roots == SerializableShadowRoots::Yes && shadow->serializable())
+            if ((serializable_shadow_roots == HTMLParser::SerializableShadowRoots::Yes && shadow->serializable())
                 || shadow_roots.find_first_index_if([&](auto& entry) { return entry == shadow; }).has_value()) {
                 // then:
                 // 1. Append "<template shadowrootmode="".
@@ -5297,7 +5340,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
                 // 8. Append the value of running the HTML fragment serialization algorithm with shadow,
                 //    serializableShadowRoots, and shadowRoots (thus recursing into this algorithm for that element).
-                builder.append(serialize_html_fragment(*shadow, serializable_shadow_roots, shadow_roots));
+                serialize_html_fragment_into(builder, *shadow, serializable_shadow_roots, shadow_roots, DOM::FragmentSerializationMode::Inner);
 
                 // 9. Append "</template>".
                 builder.append("</template>"sv);
@@ -5336,7 +5379,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             }
 
             // Otherwise, append the value of current node's data IDL attribute, escaped as described below.
-            builder.append(escape_string(text_node.data().utf16_view(), AttributeMode::No));
+            append_escaped_string(builder, text_node.data().utf16_view(), AttributeMode::No);
         }
 
         if (is<DOM::Comment>(current_node)) {
@@ -5380,6 +5423,14 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
 
         return IterationDecision::Continue;
     });
+}
+
+String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableShadowRoots serializable_shadow_roots, Vector<GC::Root<DOM::ShadowRoot>> const& shadow_roots, DOM::FragmentSerializationMode fragment_serialization_mode)
+{
+    // 2. Let s be a string, and initialize it to the empty string.
+    StringBuilder builder;
+
+    serialize_html_fragment_into(builder, node, serializable_shadow_roots, shadow_roots, fragment_serialization_mode);
 
     // 6. Return s.
     return MUST(builder.to_string());
@@ -9,6 +9,7 @@
 #include <LibGfx/Color.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/DOM/Node.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
 #include <LibWeb/HTML/Parser/ListOfActiveFormattingElements.h>
 #include <LibWeb/HTML/Parser/StackOfOpenElements.h>
@@ -63,6 +64,10 @@ public:
     static GC::Ref<HTMLParser> create_for_scripting(DOM::Document&);
     static GC::Ref<HTMLParser> create_with_uncertain_encoding(DOM::Document&, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type = {});
     static GC::Ref<HTMLParser> create(DOM::Document&, StringView input, StringView encoding);
+    static GC::Ref<HTMLParser> create_with_decoded_input(DOM::Document&, HTMLTokenizer::DecodedInput, StringView encoding);
+
+    // Returns the encoding that create_with_uncertain_encoding() would decode the given input with.
+    static ByteString encoding_for_uncertain_input(DOM::Document&, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type = {});
 
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
     void run(const URL::URL&, HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
@@ -103,6 +108,7 @@ public:
 
 private:
     HTMLParser(DOM::Document&, StringView input, StringView encoding);
+    HTMLParser(DOM::Document&, HTMLTokenizer::DecodedInput, StringView encoding);
     HTMLParser(DOM::Document&);
 
     virtual void visit_edges(Cell::Visitor&) override;
@@ -163,6 +169,7 @@ private:
     [[nodiscard]] GC::Ptr<DOM::Element> adjusted_current_node();
     [[nodiscard]] GC::Ptr<DOM::Element> node_before_current_node();
     void insert_character(u32 data);
+    bool can_append_to_character_insertion_node();
     void insert_comment(HTMLToken&);
     void reconstruct_the_active_formatting_elements();
     void close_a_p_element();
@@ -197,6 +204,7 @@ private:
     ListOfActiveFormattingElements m_list_of_active_formatting_elements;
 
     HTMLTokenizer m_tokenizer;
+    HTMLPreloadScanner m_preload_scanner;
 
     bool m_next_line_feed_can_be_ignored { false };
 
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
+#include <LibWeb/HTML/Parser/HTMLToken.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/Preload.h>
+#include <LibWeb/HTML/SourceSet.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
+
+namespace Web::HTML {
+
+void HTMLPreloadScanner::scan(DOM::Document& document, HTMLTokenizer const& parser_tokenizer)
+{
+    // We have already seen everything that lies ahead of the parser, unless its input changed since the last scan
+    // (e.g. through document.write()).
+    if (parser_tokenizer.input_length() == m_scanned_input_length)
+        return;
+    m_scanned_input_length = parser_tokenizer.input_length();
+
+    if (!document.window() || !document.browsing_context())
+        return;
+
+    HTMLTokenizer tokenizer { parser_tokenizer.unconsumed_input() };
+    tokenizer.insert_eof();
+
+    ScanState state;
+    state.base_url = document.base_url();
+    state.has_base_url_from_base_element = document.first_base_element_with_href_in_tree_order() != nullptr;
+
+    for (;;) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_end_tag()) {
+            if (token->tag_name() == TagNames::template_ && state.template_depth > 0)
+                --state.template_depth;
+            else if (token->tag_name() == TagNames::picture && state.picture_depth > 0)
+                --state.picture_depth;
+            continue;
+        }
+
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+
+        // Switch the tokenizer to the same state the tree builder would switch it to, so that we don't go looking for
+        // resources in the contents of scripts, style sheets, etc.
+        if (tag_name.is_one_of(TagNames::title, TagNames::textarea))
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes))
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name == TagNames::noscript && document.is_scripting_enabled())
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name == TagNames::script)
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name == TagNames::plaintext)
+            tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+
+        process_start_tag(document, *token, state);
+    }
+}
+
+void HTMLPreloadScanner::process_start_tag(DOM::Document& document, HTMLToken const& token, ScanState& state)
+{
+    auto const& tag_name = token.tag_name();
+
+    // The contents of templates are inert, so nothing inside them is fetched.
+    if (tag_name == TagNames::template_) {
+        ++state.template_depth;
+        return;
+    }
+    if (state.template_depth > 0)
+        return;
+
+    auto parse_url = [&](Optional<String> const& value) -> Optional<URL::URL> {
+        if (!value.has_value())
+            return {};
+
+        auto url = DOMURL::parse(value->bytes_as_string_view().trim(Infra::ASCII_WHITESPACE), state.base_url);
+        if (!url.has_value() || !Fetch::Infrastructure::is_http_or_https_scheme(url->scheme()))
+            return {};
+
+        // NOTE: Preloaded responses are only ever handed out to fetches of HTTP(S) URLs, so there is no point in
+        //       preloading anything else.
+        return url;
+    };
+
+    if (tag_name == TagNames::base) {
+        // https://html.spec.whatwg.org/multipage/semantics.html#frozen-base-url
+        // Only the first base element with an href attribute affects the document base URL.
+        if (state.has_base_url_from_base_element)
+            return;
+
+        if (auto href = token.attribute(AttributeNames::href); href.has_value()) {
+            state.has_base_url_from_base_element = true;
+
+            if (auto url = DOMURL::parse(*href, document.fallback_base_url()); url.has_value())
+                state.base_url = url.release_value();
+        }
+        return;
+    }
+
+    if (tag_name == TagNames::script) {
+        if (auto url = parse_url(token.attribute(AttributeNames::src)); url.has_value())
+            preload_script(document, token, *url);
+        return;
+    }
+
+    if (tag_name == TagNames::link) {
+        if (auto url = parse_url(token.attribute(AttributeNames::href)); url.has_value())
+            preload_link(document, token, *url);
+        return;
+    }
+
+    if (tag_name == TagNames::picture) {
+        ++state.picture_depth;
+        return;
+    }
+
+    if (tag_name == TagNames::img) {
+        // The image used inside a picture element depends on its source elements, let the tree builder figure it out.
+        if (state.picture_depth > 0)
+            return;
+
+        // Lazily loaded images are only fetched once they approach the viewport.
+        if (auto loading = token.attribute(AttributeNames::loading); loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv) && document.is_scripting_enabled())
+            return;
+
+        auto src = token.attribute(AttributeNames::src).value_or({});
+        auto srcset = token.attribute(AttributeNames::srcset).value_or({});
+
+        if (srcset.is_empty()) {
+            if (auto url = parse_url(src); url.has_value())
+                preload_image(document, token, *url, false);
+            return;
+        }
+
+        // https://html.spec.whatwg.org/multipage/images.html#create-a-source-set
+        // We can only select a source from the source set if the selection does not depend on layout, i.e. if the
+        // source set has no width descriptors.
+        auto source_set = parse_a_srcset_attribute(srcset);
+        bool has_source_with_pixel_density_of_1 = false;
+
+        for (auto& source : source_set.m_sources) {
+            if (source.descriptor.has<ImageSource::WidthDescriptorValue>())
+                return;
+
+            // https://html.spec.whatwg.org/multipage/images.html#normalise-the-source-densities
+            if (source.descriptor.has<Empty>())
+                source.descriptor = ImageSource::PixelDensityDescriptorValue { .value = 1.0 };
+
+            if (source.descriptor.get<ImageSource::PixelDensityDescriptorValue>().value == 1.0)
+                has_source_with_pixel_density_of_1 = true;
+        }
+
+        if (!src.is_empty() && !has_source_with_pixel_density_of_1)
+            source_set.m_sources.append({ .url = src, .descriptor = ImageSource::PixelDensityDescriptorValue { .value = 1.0 } });
+
+        if (source_set.is_empty())
+            return;
+
+        if (auto url = parse_url(source_set.select_an_image_source().source.url); url.has_value())
+            preload_image(document, token, *url, true);
+        return;
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/scripting.html#prepare-the-script-element
+void HTMLPreloadScanner::preload_script(DOM::Document& document, HTMLToken const& token, URL::URL const& url)
+{
+    auto& vm = document.vm();
+
+    // Determine the script's type the same way the script element will once it is prepared.
+    auto type = token.attribute(AttributeNames::type);
+    auto language = token.attribute(AttributeNames::language);
+
+    String script_block_type;
+    if ((type.has_value() && type->is_empty()) || (!type.has_value() && (!language.has_value() || language->is_empty())))
+        script_block_type = "text/javascript"_string;
+    else if (type.has_value())
+        script_block_type = MUST(type->trim(Infra::ASCII_WHITESPACE));
+    else
+        script_block_type = MUST(String::formatted("text/{}", *language));
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+    GC::Ptr<Fetch::Infrastructure::Request> request;
+
+    if (MimeSniff::is_javascript_mime_type_essence_match(script_block_type)) {
+        // Classic scripts with a nomodule attribute are not executed, as we support module scripts.
+        if (token.has_attribute(AttributeNames::nomodule))
+            return;
+
+        // https://html.spec.whatwg.org/multipage/webappapis.html#fetch-a-classic-script
+        request = create_potential_CORS_request(vm, url, Fetch::Infrastructure::Request::Destination::Script, cors_setting);
+        request->set_client(&document.relevant_settings_object());
+    } else if (script_block_type.equals_ignoring_ascii_case("module"sv)) {
+        // https://html.spec.whatwg.org/multipage/webappapis.html#fetch-a-single-module-script
+        request = Fetch::Infrastructure::Request::create(vm);
+        request->set_url(url);
+        request->set_mode(Fetch::Infrastructure::Request::Mode::CORS);
+        request->set_client(&document.relevant_settings_object());
+        request->set_destination(Fetch::Infrastructure::Request::Destination::Script);
+        request->set_credentials_mode(cors_settings_attribute_credentials_mode(cors_setting));
+    } else {
+        return;
+    }
+
+    request->set_initiator_type(Fetch::Infrastructure::Request::InitiatorType::Script);
+    request->set_integrity_metadata(token.attribute(AttributeNames::integrity).value_or({}));
+
+    preload(document, *request, token);
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#link-type-stylesheet
+void HTMLPreloadScanner::preload_style_sheet(DOM::Document& document, HTMLToken const& token, URL::URL const& url)
+{
+    if (token.has_attribute(AttributeNames::disabled))
+        return;
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    auto request = create_potential_CORS_request(document.vm(), url, Fetch::Infrastructure::Request::Destination::Style, cors_setting);
+    request->set_client(&document.relevant_settings_object());
+    request->set_initiator_type(Fetch::Infrastructure::Request::InitiatorType::Link);
+    request->set_integrity_metadata(token.attribute(AttributeNames::integrity).value_or({}));
+
+    preload(document, request, token);
+}
+
+// https://html.spec.whatwg.org/multipage/images.html#update-the-image-data
+void HTMLPreloadScanner::preload_image(DOM::Document& document, HTMLToken const& token, URL::URL const& url, bool uses_srcset)
+{
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    auto request = create_potential_CORS_request(document.vm(), url, Fetch::Infrastructure::Request::Destination::Image, cors_setting);
+    request->set_client(&document.relevant_settings_object());
+
+    if (uses_srcset)
+        request->set_initiator(Fetch::Infrastructure::Request::Initiator::ImageSet);
+
+    preload(document, request, token);
+}
+
+void HTMLPreloadScanner::preload_link(DOM::Document& document, HTMLToken const& token, URL::URL const& url)
+{
+    auto rel = token.attribute(AttributeNames::rel);
+    if (!rel.has_value())
+        return;
+
+    bool is_style_sheet = false;
+    bool is_alternate = false;
+    bool is_preload = false;
+
+    for (auto part : rel->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+        if (part.equals_ignoring_ascii_case("stylesheet"sv))
+            is_style_sheet = true;
+        else if (part.equals_ignoring_ascii_case("alternate"sv))
+            is_alternate = true;
+        else if (part.equals_ignoring_ascii_case("preload"sv))
+            is_preload = true;
+    }
+
+    // Alternative style sheets are not applied by default, so don't compete with the resources that are needed.
+    if (is_style_sheet && !is_alternate) {
+        preload_style_sheet(document, token, url);
+        return;
+    }
+
+    if (!is_preload)
+        return;
+
+    // https://html.spec.whatwg.org/multipage/links.html#link-type-preload
+    auto as = token.attribute(AttributeNames::as);
+    if (!as.has_value())
+        return;
+
+    Optional<Fetch::Infrastructure::Request::Destination> destination;
+    if (as->equals_ignoring_ascii_case("script"sv))
+        destination = Fetch::Infrastructure::Request::Destination::Script;
+    else if (as->equals_ignoring_ascii_case("style"sv))
+        destination = Fetch::Infrastructure::Request::Destination::Style;
+    else if (as->equals_ignoring_ascii_case("image"sv))
+        destination = Fetch::Infrastructure::Request::Destination::Image;
+    else if (as->equals_ignoring_ascii_case("font"sv))
+        destination = Fetch::Infrastructure::Request::Destination::Font;
+    else
+        return;
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    auto request = create_potential_CORS_request(document.vm(), url, destination, cors_setting);
+    request->set_client(&document.relevant_settings_object());
+    request->set_initiator_type(Fetch::Infrastructure::Request::InitiatorType::Link);
+    request->set_integrity_metadata(token.attribute(AttributeNames::integrity).value_or({}));
+
+    preload(document, request, token);
+}
+
+void HTMLPreloadScanner::preload(DOM::Document& document, GC::Ref<Fetch::Infrastructure::Request> request, HTMLToken const& token)
+{
+    if (m_preloaded_urls.set(request->url()) != HashSetResult::InsertedNewEntry)
+        return;
+
+    if (auto referrer_policy = token.attribute(AttributeNames::referrerpolicy); referrer_policy.has_value())
+        request->set_referrer_policy(ReferrerPolicy::from_string(*referrer_policy).value_or(ReferrerPolicy::ReferrerPolicy::EmptyString));
+
+    if (auto fetch_priority = token.attribute(AttributeNames::fetchpriority); fetch_priority.has_value())
+        request->set_priority(Fetch::Infrastructure::request_priority_from_string(*fetch_priority).value_or(Fetch::Infrastructure::Request::Priority::Auto));
+
+    HTML::preload(document, request);
+}
+
+}
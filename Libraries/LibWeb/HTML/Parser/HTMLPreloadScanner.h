@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashTable.h>
+#include <LibGC/Ptr.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+class HTMLToken;
+class HTMLTokenizer;
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+// A simplified speculative HTML parser: while the HTML parser is blocked on a parser-blocking script, this tokenizes the
+// input that lies ahead of it, and preloads the scripts, style sheets and images referenced there. The elements that
+// are eventually created for those resources then find their responses in the document's map of preloaded resources.
+//
+// Rather than building a tree of speculative mock elements, this only tracks the little tree construction state that
+// affects which resources are fetched (<base>, <template> and <picture>).
+class HTMLPreloadScanner {
+public:
+    void scan(DOM::Document&, HTMLTokenizer const& parser_tokenizer);
+
+private:
+    struct ScanState {
+        URL::URL base_url;
+        bool has_base_url_from_base_element { false };
+        size_t template_depth { 0 };
+        size_t picture_depth { 0 };
+    };
+
+    void process_start_tag(DOM::Document&, HTMLToken const&, ScanState&);
+
+    void preload_script(DOM::Document&, HTMLToken const&, URL::URL const&);
+    void preload_style_sheet(DOM::Document&, HTMLToken const&, URL::URL const&);
+    void preload_image(DOM::Document&, HTMLToken const&, URL::URL const&, bool uses_srcset);
+    void preload_link(DOM::Document&, HTMLToken const&, URL::URL const&);
+
+    void preload(DOM::Document&, GC::Ref<Fetch::Infrastructure::Request>, HTMLToken const&);
+
+    HashTable<URL::URL> m_preloaded_urls;
+    size_t m_scanned_input_length { 0 };
+};
+
+}
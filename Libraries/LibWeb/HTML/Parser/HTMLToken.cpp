@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/HashTable.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
 
@@ -87,11 +88,30 @@ void HTMLToken::normalize_attributes()
     // are never subsequently used by the parser, and are therefore effectively discarded. Removing the attribute
     // in this way does not change its status as the "current attribute" for the purposes of the tokenizer, however.
 
-    HashTable<FlyString> seen_attributes;
     auto* ptr = tag_attributes();
     if (!ptr)
         return;
     auto& tag_attributes = *ptr;
+
+    // OPTIMIZATION: Comparing against the preceding attributes is cheaper than building a hash table for the few
+    //               attributes that most tags have.
+    static constexpr size_t maximum_attribute_count_for_linear_search = 8;
+    if (tag_attributes.size() <= maximum_attribute_count_for_linear_search) {
+        for (size_t i = 1; i < tag_attributes.size(); ++i) {
+            auto is_duplicate = any_of(tag_attributes.span().trim(i), [&](auto const& attribute) {
+                return attribute.local_name == tag_attributes[i].local_name;
+            });
+            if (is_duplicate) {
+                // This is a duplicate attribute, remove it.
+                tag_attributes.remove(i);
+                --i;
+                m_had_duplicate_attribute = true;
+            }
+        }
+        return;
+    }
+
+    HashTable<FlyString> seen_attributes;
     for (size_t i = 0; i < tag_attributes.size(); ++i) {
         auto& attribute = tag_attributes[i];
         if (seen_attributes.set(attribute.local_name, AK::HashSetExistingEntryBehavior::Keep) == AK::HashSetResult::KeptExistingEntry) {
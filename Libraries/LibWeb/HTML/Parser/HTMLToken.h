@@ -49,6 +49,9 @@ public:
         Position value_end_position;
     };
 
+    // NOTE: Most tags have only a few attributes, so we keep those inline to save an allocation per tag.
+    using AttributeList = Vector<Attribute, 4>;
+
     struct DoctypeData {
         // NOTE: "Missing" is a distinct state from the empty string.
         String name;
@@ -88,7 +91,7 @@ public:
             break;
         case Type::StartTag:
         case Type::EndTag:
-            m_data.set(OwnPtr<Vector<Attribute>>());
+            m_data.set(OwnPtr<AttributeList>());
             break;
         default:
             break;
@@ -217,7 +220,7 @@ public:
     void drop_attributes()
     {
         VERIFY(is_start_tag() || is_end_tag());
-        m_data.get<OwnPtr<Vector<Attribute>>>().clear();
+        m_data.get<OwnPtr<AttributeList>>().clear();
     }
 
     void for_each_attribute(Function<IterationDecision(Attribute const&)> callback) const
@@ -331,22 +334,22 @@ public:
     bool had_duplicate_attribute() const { return m_had_duplicate_attribute; }
 
 private:
-    Vector<Attribute> const* tag_attributes() const
+    AttributeList const* tag_attributes() const
     {
-        return m_data.get<OwnPtr<Vector<Attribute>>>().ptr();
+        return m_data.get<OwnPtr<AttributeList>>().ptr();
     }
 
-    Vector<Attribute>* tag_attributes()
+    AttributeList* tag_attributes()
     {
-        return m_data.get<OwnPtr<Vector<Attribute>>>().ptr();
+        return m_data.get<OwnPtr<AttributeList>>().ptr();
     }
 
-    Vector<Attribute>& ensure_tag_attributes()
+    AttributeList& ensure_tag_attributes()
     {
         VERIFY(is_start_tag() || is_end_tag());
-        auto& ptr = m_data.get<OwnPtr<Vector<Attribute>>>();
+        auto& ptr = m_data.get<OwnPtr<AttributeList>>();
         if (!ptr)
-            ptr = make<Vector<Attribute>>();
+            ptr = make<AttributeList>();
         return *ptr;
     }
 
@@ -367,7 +370,7 @@ private:
     // Type::Comment (comment data)
     String m_comment_data;
 
-    Variant<Empty, u32, OwnPtr<DoctypeData>, OwnPtr<Vector<Attribute>>> m_data {};
+    Variant<Empty, u32, OwnPtr<DoctypeData>, OwnPtr<AttributeList>> m_data {};
 
     Position m_start_position;
     Position m_end_position;
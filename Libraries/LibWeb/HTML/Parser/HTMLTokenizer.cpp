@@ -5,15 +5,20 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/GenericShorthands.h>
+#include <AK/HashMap.h>
+#include <AK/SIMDExtras.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/HTML/Parser/Entities.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/TagNames.h>
 #include <LibWeb/Namespace.h>
 #include <string.h>
 
@@ -218,6 +223,48 @@ Optional<u32> HTMLTokenizer::next_code_point(StopAtInsertionPoint stop_at_insert
     return code_point;
 }
 
+// Bounds how many character tokens the data state queues up in one go.
+static constexpr size_t maximum_character_run_length = 1024;
+
+// Returns the number of code points at the start of the input that come before the first of the given code points.
+template<u32... code_points>
+static size_t length_of_run_without(ReadonlySpan<u32> input)
+{
+    size_t length = 0;
+
+    // OPTIMIZATION: Compare four code points at a time while we can.
+    for (; length + 4 <= input.size(); length += 4) {
+        auto chunk = AK::SIMD::load_unaligned<AK::SIMD::u32x4>(input.offset_pointer(length));
+        auto matches = ((chunk == AK::SIMD::expand4(code_points)) | ...);
+
+        if (auto mask = AK::SIMD::maskbits(matches); mask != 0)
+            return length + count_trailing_zeroes(static_cast<u32>(mask));
+    }
+
+    for (; length < input.size(); ++length) {
+        if (((input[length] == code_points) || ...))
+            break;
+    }
+
+    return length;
+}
+
+// Returns how many of the code points following the current input character may be consumed without reaching one of
+// the given code points, the end of the input, or the insertion point (if we are to stop there).
+template<u32... code_points>
+size_t HTMLTokenizer::length_of_upcoming_run_without(StopAtInsertionPoint stop_at_insertion_point, size_t maximum_length) const
+{
+    auto end = static_cast<ssize_t>(m_decoded_input.size());
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined)
+        end = min(end, m_insertion_point.position);
+
+    if (m_current_offset >= end)
+        return 0;
+
+    auto length = min(static_cast<size_t>(end - m_current_offset), maximum_length);
+    return length_of_run_without<code_points...>(m_decoded_input.span().slice(m_current_offset, length));
+}
+
 void HTMLTokenizer::skip(size_t count)
 {
     if (!m_source_positions.is_empty())
@@ -302,7 +349,24 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    // OPTIMIZATION: Text tends to come in long runs, so we emit all of the characters up to the next one
+                    //               that needs special handling at once, rather than going through the state machine for
+                    //               each of them.
+                    create_new_token(HTMLToken::Type::Character);
+                    m_current_token.set_code_point(current_input_character.value());
+                    will_emit(m_current_token);
+                    m_queued_tokens.enqueue(move(m_current_token));
+
+                    auto run_length = length_of_upcoming_run_without<'<', '&', '\r', 0>(stop_at_insertion_point, maximum_character_run_length);
+                    for (size_t i = 0; i < run_length; ++i) {
+                        skip(1);
+                        create_new_token(HTMLToken::Type::Character);
+                        m_current_token.set_code_point(m_decoded_input[m_prev_offset]);
+                        will_emit(m_current_token);
+                        m_queued_tokens.enqueue(move(m_current_token));
+                    }
+
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -349,19 +413,19 @@ _StartOfFunction:
             {
                 ON_WHITESPACE
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     m_current_token.set_end_position({}, nth_last_position(1));
                     SWITCH_TO(BeforeAttributeName);
                 }
                 ON('/')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     m_current_token.set_end_position({}, nth_last_position(0));
                     SWITCH_TO(SelfClosingStartTag);
                 }
                 ON('>')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     SWITCH_TO_AND_EMIT_CURRENT_TOKEN(Data);
                 }
                 ON_ASCII_UPPER_ALPHA
@@ -1163,31 +1227,31 @@ _StartOfFunction:
                 ON_WHITESPACE
                 {
                     m_current_token.last_attribute().name_end_position = nth_last_position(1);
-                    m_current_token.last_attribute().local_name = consume_current_builder();
+                    m_current_token.last_attribute().local_name = consume_current_builder_as_name();
                     RECONSUME_IN(AfterAttributeName);
                 }
                 ON('/')
                 {
                     m_current_token.last_attribute().name_end_position = nth_last_position(1);
-                    m_current_token.last_attribute().local_name = consume_current_builder();
+                    m_current_token.last_attribute().local_name = consume_current_builder_as_name();
                     RECONSUME_IN(AfterAttributeName);
                 }
                 ON('>')
                 {
                     m_current_token.last_attribute().name_end_position = nth_last_position(1);
-                    m_current_token.last_attribute().local_name = consume_current_builder();
+                    m_current_token.last_attribute().local_name = consume_current_builder_as_name();
                     RECONSUME_IN(AfterAttributeName);
                 }
                 ON_EOF
                 {
                     m_current_token.last_attribute().name_end_position = nth_last_position(1);
-                    m_current_token.last_attribute().local_name = consume_current_builder();
+                    m_current_token.last_attribute().local_name = consume_current_builder_as_name();
                     RECONSUME_IN(AfterAttributeName);
                 }
                 ON('=')
                 {
                     m_current_token.last_attribute().name_end_position = nth_last_position(1);
-                    m_current_token.last_attribute().local_name = consume_current_builder();
+                    m_current_token.last_attribute().local_name = consume_current_builder_as_name();
                     SWITCH_TO(BeforeAttributeValue);
                 }
                 ON_ASCII_UPPER_ALPHA
@@ -1315,6 +1379,14 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+
+                    // OPTIMIZATION: Append everything up to the next character that needs special handling at once.
+                    auto run_length = length_of_upcoming_run_without<'"', '&', '\r', 0>(stop_at_insertion_point, NumericLimits<size_t>::max());
+                    for (auto code_point : m_decoded_input.span().slice(m_current_offset, run_length))
+                        m_current_builder.append_code_point(code_point);
+                    if (run_length > 0)
+                        skip(run_length);
+
                     continue;
                 }
             }
@@ -1347,6 +1419,14 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+
+                    // OPTIMIZATION: Append everything up to the next character that needs special handling at once.
+                    auto run_length = length_of_upcoming_run_without<'\'', '&', '\r', 0>(stop_at_insertion_point, NumericLimits<size_t>::max());
+                    for (auto code_point : m_decoded_input.span().slice(m_current_offset, run_length))
+                        m_current_builder.append_code_point(code_point);
+                    if (run_length > 0)
+                        skip(run_length);
+
                     continue;
                 }
             }
@@ -2031,7 +2111,7 @@ _StartOfFunction:
             {
                 ON_WHITESPACE
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (!current_end_tag_token_is_appropriate()) {
                         m_queued_tokens.enqueue(HTMLToken::make_character('<'));
                         m_queued_tokens.enqueue(HTMLToken::make_character('/'));
@@ -2043,7 +2123,7 @@ _StartOfFunction:
                 }
                 ON('/')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (!current_end_tag_token_is_appropriate()) {
                         m_queued_tokens.enqueue(HTMLToken::make_character('<'));
                         m_queued_tokens.enqueue(HTMLToken::make_character('/'));
@@ -2055,7 +2135,7 @@ _StartOfFunction:
                 }
                 ON('>')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (!current_end_tag_token_is_appropriate()) {
                         m_queued_tokens.enqueue(HTMLToken::make_character('<'));
                         m_queued_tokens.enqueue(HTMLToken::make_character('/'));
@@ -2150,7 +2230,7 @@ _StartOfFunction:
             {
                 ON_WHITESPACE
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (!current_end_tag_token_is_appropriate()) {
                         m_queued_tokens.enqueue(HTMLToken::make_character('<'));
                         m_queued_tokens.enqueue(HTMLToken::make_character('/'));
@@ -2162,7 +2242,7 @@ _StartOfFunction:
                 }
                 ON('/')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (!current_end_tag_token_is_appropriate()) {
                         m_queued_tokens.enqueue(HTMLToken::make_character('<'));
                         m_queued_tokens.enqueue(HTMLToken::make_character('/'));
@@ -2174,7 +2254,7 @@ _StartOfFunction:
                 }
                 ON('>')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (!current_end_tag_token_is_appropriate()) {
                         m_queued_tokens.enqueue(HTMLToken::make_character('<'));
                         m_queued_tokens.enqueue(HTMLToken::make_character('/'));
@@ -2374,7 +2454,7 @@ _StartOfFunction:
             {
                 ON_WHITESPACE
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (current_end_tag_token_is_appropriate())
                         SWITCH_TO(BeforeAttributeName);
 
@@ -2389,7 +2469,7 @@ _StartOfFunction:
                 }
                 ON('/')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (current_end_tag_token_is_appropriate())
                         SWITCH_TO(SelfClosingStartTag);
 
@@ -2404,7 +2484,7 @@ _StartOfFunction:
                 }
                 ON('>')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (current_end_tag_token_is_appropriate())
                         SWITCH_TO_AND_EMIT_CURRENT_TOKEN(Data);
 
@@ -2720,7 +2800,7 @@ _StartOfFunction:
             {
                 ON_WHITESPACE
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (current_end_tag_token_is_appropriate())
                         SWITCH_TO(BeforeAttributeName);
                     m_queued_tokens.enqueue(HTMLToken::make_character('<'));
@@ -2733,7 +2813,7 @@ _StartOfFunction:
                 }
                 ON('/')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (current_end_tag_token_is_appropriate())
                         SWITCH_TO(SelfClosingStartTag);
                     m_queued_tokens.enqueue(HTMLToken::make_character('<'));
@@ -2746,7 +2826,7 @@ _StartOfFunction:
                 }
                 ON('>')
                 {
-                    m_current_token.set_tag_name(consume_current_builder());
+                    m_current_token.set_tag_name(consume_current_builder_as_name());
                     if (current_end_tag_token_is_appropriate())
                         SWITCH_TO_AND_EMIT_CURRENT_TOKEN(Data);
                     m_queued_tokens.enqueue(HTMLToken::make_character('<'));
@@ -2882,14 +2962,39 @@ HTMLTokenizer::HTMLTokenizer()
     m_source_positions.empend(0u, 0u);
 }
 
-HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
+HTMLTokenizer::DecodedInput HTMLTokenizer::decode_input(StringView input, StringView encoding)
 {
     auto decoder = TextCodec::decoder_for(encoding);
     VERIFY(decoder.has_value());
-    m_source = MUST(decoder->to_utf8(input));
-    m_decoded_input.ensure_capacity(m_source.bytes().size());
-    for (auto code_point : m_source.code_points())
-        m_decoded_input.append(code_point);
+
+    DecodedInput decoded_input;
+    decoded_input.source = MUST(decoder->to_utf8(input));
+
+    auto code_points = decoded_input.source.code_points();
+    decoded_input.code_points.ensure_capacity(code_points.length());
+    for (auto code_point : code_points)
+        decoded_input.code_points.unchecked_append(code_point);
+
+    return decoded_input;
+}
+
+HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
+    : HTMLTokenizer(decode_input(input, encoding))
+{
+}
+
+HTMLTokenizer::HTMLTokenizer(DecodedInput decoded_input)
+{
+    m_source = move(decoded_input.source);
+    m_decoded_input = move(decoded_input.code_points);
+    m_current_offset = 0;
+    m_prev_offset = 0;
+    m_source_positions.empend(0u, 0u);
+}
+
+HTMLTokenizer::HTMLTokenizer(ReadonlySpan<u32> decoded_input)
+{
+    m_decoded_input.append(decoded_input.data(), decoded_input.size());
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
@@ -2990,4 +3095,30 @@ String HTMLTokenizer::consume_current_builder()
     return string;
 }
 
+static HashMap<StringView, FlyString> const& known_names()
+{
+    static auto const names = [] {
+        HashMap<StringView, FlyString> names;
+#define __ENUMERATE_HTML_TAG(name, tag) names.set(tag##sv, TagNames::name);
+        ENUMERATE_HTML_TAGS
+#undef __ENUMERATE_HTML_TAG
+#define __ENUMERATE_HTML_ATTRIBUTE(name, attribute) names.set(attribute##sv, AttributeNames::name);
+        ENUMERATE_HTML_ATTRIBUTES
+#undef __ENUMERATE_HTML_ATTRIBUTE
+        return names;
+    }();
+    return names;
+}
+
+FlyString HTMLTokenizer::consume_current_builder_as_name()
+{
+    // OPTIMIZATION: Most tag and attribute names are known ones, so look those up before allocating a string for the
+    //               name, only to then find it in the table of fly strings.
+    if (auto it = known_names().find(m_current_builder.string_view()); it != known_names().end()) {
+        m_current_builder.clear();
+        return it->value;
+    }
+    return consume_current_builder();
+}
+
 }
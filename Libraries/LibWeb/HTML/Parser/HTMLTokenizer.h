@@ -11,6 +11,7 @@
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
 #include <AK/Types.h>
+#include <AK/Vector.h>
 #include <LibGC/Ptr.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/HTML/Parser/Entities.h>
@@ -102,8 +103,21 @@ namespace Web::HTML {
 
 class HTMLTokenizer {
 public:
+    // The input of a tokenizer, decoded from the input byte stream.
+    struct DecodedInput {
+        String source;
+        Vector<u32> code_points;
+    };
+
+    // NOTE: This does not depend on any tokenizer or parser state, so it's safe to call from any thread.
+    static DecodedInput decode_input(StringView input, StringView encoding);
+
     explicit HTMLTokenizer();
     explicit HTMLTokenizer(StringView input, ByteString const& encoding);
+    explicit HTMLTokenizer(DecodedInput);
+
+    // Creates a tokenizer for the given already decoded input, as used by the speculative HTML parser.
+    explicit HTMLTokenizer(ReadonlySpan<u32> decoded_input);
 
     enum class State {
 #define __ENUMERATE_TOKENIZER_STATE(state) state,
@@ -130,6 +144,9 @@ public:
 
     auto const& source() const { return m_source; }
 
+    ReadonlySpan<u32> unconsumed_input() const { return m_decoded_input.span().slice(m_current_offset); }
+    size_t input_length() const { return m_decoded_input.size(); }
+
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
     bool is_eof_inserted();
@@ -156,6 +173,9 @@ private:
     Optional<u32> next_code_point(StopAtInsertionPoint);
     Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
 
+    template<u32... code_points>
+    size_t length_of_upcoming_run_without(StopAtInsertionPoint, size_t maximum_length) const;
+
     enum class ConsumeNextResult {
         Consumed,
         NotConsumed,
@@ -166,6 +186,7 @@ private:
     void create_new_token(HTMLToken::Type);
     bool current_end_tag_token_is_appropriate() const;
     String consume_current_builder();
+    FlyString consume_current_builder_as_name();
 
     static char const* state_name(State state)
     {
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/VM.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/Preload.h>
+#include <LibWeb/HTML/Window.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(PreloadEntry);
+
+GC::Ref<PreloadEntry> PreloadEntry::create(JS::VM& vm, String integrity_metadata)
+{
+    return vm.heap().allocate<PreloadEntry>(move(integrity_metadata));
+}
+
+PreloadEntry::PreloadEntry(String integrity_metadata)
+    : m_integrity_metadata(move(integrity_metadata))
+{
+}
+
+void PreloadEntry::visit_edges(JS::Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_response);
+    visitor.visit(m_on_response_available);
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#consume-a-preloaded-resource
+bool consume_a_preloaded_resource(Window& window, URL::URL const& url, Optional<Fetch::Infrastructure::Request::Destination> destination, Fetch::Infrastructure::Request::Mode mode, Fetch::Infrastructure::Request::CredentialsMode credentials_mode, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable> on_response_available)
+{
+    // 1. Let key be a preload key whose URL is url, destination is destination, mode is mode, and credentials mode is
+    //    credentialsMode.
+    PreloadKey key { url, destination, mode, credentials_mode };
+
+    // 2. Let preloads be window's associated Document's map of preloaded resources.
+    auto& preloads = window.associated_document().map_of_preloaded_resources();
+
+    // 3. If key does not exist in preloads, then return false.
+    auto it = preloads.find(key);
+    if (it == preloads.end())
+        return false;
+
+    // 4. Let entry be preloads[key].
+    auto entry = it->value;
+
+    // 5. Let consumerIntegrityMetadata be the result of parsing integrityMetadata.
+    // 6. Let preloadIntegrityMetadata be the result of parsing entry's integrity metadata.
+    // 7. If none of the following conditions apply:
+    //    - consumerIntegrityMetadata is no metadata;
+    //    - consumerIntegrityMetadata is equal to preloadIntegrityMetadata;
+    //    then return false.
+    // NOTE: We compare the unparsed metadata, which may reject a few preloads whose metadata only differs in formatting.
+    if (!integrity_metadata.is_empty() && integrity_metadata != entry->integrity_metadata())
+        return false;
+
+    // 8. Remove preloads[key].
+    preloads.remove(it);
+
+    // 9. If entry's response is null, then set entry's on response available to onResponseAvailable.
+    if (!entry->response())
+        entry->set_on_response_available(on_response_available);
+
+    // 10. Otherwise, call onResponseAvailable with entry's response.
+    else
+        on_response_available->function()(*entry->response());
+
+    // 11. Return true.
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#preload
+// NOTE: This takes an already created request, so that the speculative HTML parser can set it up the same way the
+//       element that will eventually consume it would.
+void preload(DOM::Document& document, GC::Ref<Fetch::Infrastructure::Request> request)
+{
+    auto& realm = document.realm();
+    auto& vm = realm.vm();
+
+    // 6. Let key be a preload key whose URL is request's URL, destination is request's destination, mode is request's
+    //    mode, and credentials mode is request's credentials mode.
+    PreloadKey key { request->url(), request->destination(), request->mode(), request->credentials_mode() };
+
+    // AD-HOC: Don't fetch a resource again while an identical preload is still waiting to be consumed.
+    auto& preloads = document.map_of_preloaded_resources();
+    if (preloads.contains(key))
+        return;
+
+    // 7. Let preloadEntry be a new preload entry whose integrity metadata is options's integrity.
+    auto preload_entry = PreloadEntry::create(vm, request->integrity_metadata());
+
+    // 9. Fetch request, with processResponseConsumeBody set to the following steps given a response response and null,
+    //    failure, or a byte sequence bytesOrNull:
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [&realm, preload_entry](GC::Ref<Fetch::Infrastructure::Response> response, Fetch::Infrastructure::FetchAlgorithms::BodyBytes bytes_or_null) {
+        // 1. If bytesOrNull is a byte sequence, then set response's body to the first return value of safely
+        //    extracting bytesOrNull.
+        if (auto* bytes = bytes_or_null.get_pointer<ByteBuffer>())
+            response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *bytes));
+
+        // 2. Otherwise, set response to a network error.
+        else
+            response = Fetch::Infrastructure::Response::network_error(realm.vm(), "Preloaded response has no body"_string);
+
+        // 3. If preloadEntry's on response available is null, then set preloadEntry's response to response.
+        if (!preload_entry->on_response_available())
+            preload_entry->set_response(response);
+
+        // 4. Otherwise, call preloadEntry's on response available with response.
+        else
+            preload_entry->on_response_available()->function()(response);
+    };
+
+    if (Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input))).is_error())
+        return;
+
+    // 8. Set options's document's map of preloaded resources[key] to preloadEntry.
+    // NOTE: This is done after starting the fetch, as fetch would otherwise find preloadEntry and consume it itself.
+    preloads.set(move(key), preload_entry);
+}
+
+}
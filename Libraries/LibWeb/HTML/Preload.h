@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashFunctions.h>
+#include <AK/String.h>
+#include <AK/Traits.h>
+#include <LibGC/Function.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-key
+struct PreloadKey {
+    bool operator==(PreloadKey const&) const = default;
+
+    // URL
+    //     A URL
+    URL::URL url;
+
+    // destination
+    //     A string
+    Optional<Fetch::Infrastructure::Request::Destination> destination;
+
+    // mode
+    //     A request mode, either "same-origin", "cors", or "no-cors"
+    Fetch::Infrastructure::Request::Mode mode { Fetch::Infrastructure::Request::Mode::NoCORS };
+
+    // credentials mode
+    //     A credentials mode
+    Fetch::Infrastructure::Request::CredentialsMode credentials_mode { Fetch::Infrastructure::Request::CredentialsMode::Include };
+};
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-entry
+class PreloadEntry final : public JS::Cell {
+    GC_CELL(PreloadEntry, JS::Cell);
+    GC_DECLARE_ALLOCATOR(PreloadEntry);
+
+public:
+    using OnResponseAvailable = GC::Function<void(GC::Ref<Fetch::Infrastructure::Response>)>;
+
+    [[nodiscard]] static GC::Ref<PreloadEntry> create(JS::VM&, String integrity_metadata);
+
+    String const& integrity_metadata() const { return m_integrity_metadata; }
+
+    GC::Ptr<Fetch::Infrastructure::Response> response() const { return m_response; }
+    void set_response(GC::Ref<Fetch::Infrastructure::Response> response) { m_response = response; }
+
+    GC::Ptr<OnResponseAvailable> on_response_available() const { return m_on_response_available; }
+    void set_on_response_available(GC::Ref<OnResponseAvailable> on_response_available) { m_on_response_available = on_response_available; }
+
+private:
+    explicit PreloadEntry(String integrity_metadata);
+
+    virtual void visit_edges(JS::Cell::Visitor&) override;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-integrity-metadata
+    // integrity metadata
+    //     A string
+    String m_integrity_metadata;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-response
+    // response
+    //     Null or a response
+    GC::Ptr<Fetch::Infrastructure::Response> m_response;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-on-response-available
+    // on response available
+    //     Null, or an algorithm accepting a response or null
+    GC::Ptr<OnResponseAvailable> m_on_response_available;
+};
+
+bool consume_a_preloaded_resource(Window&, URL::URL const&, Optional<Fetch::Infrastructure::Request::Destination>, Fetch::Infrastructure::Request::Mode, Fetch::Infrastructure::Request::CredentialsMode, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable>);
+
+void preload(DOM::Document&, GC::Ref<Fetch::Infrastructure::Request>);
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::HTML::PreloadKey> : public DefaultTraits<Web::HTML::PreloadKey> {
+    static unsigned hash(Web::HTML::PreloadKey const& key)
+    {
+        auto hash = Traits<URL::URL>::hash(key.url);
+        hash = pair_int_hash(hash, key.destination.has_value() ? to_underlying(*key.destination) + 1 : 0);
+        hash = pair_int_hash(hash, to_underlying(key.mode));
+        hash = pair_int_hash(hash, to_underlying(key.credentials_mode));
+        return hash;
+    }
+};
+
+}
@@ -752,6 +752,32 @@ void fetch_external_module_script_graph(JS::Realm& realm, URL::URL const& url, E
     fetch_single_module_script(realm, url, settings_object, Fetch::Infrastructure::Request::Destination::Script, options, settings_object.realm(), Web::Fetch::Infrastructure::Request::Referrer::Client, {}, TopLevelModule::Yes, nullptr, steps);
 }
 
+// https://html.spec.whatwg.org/multipage/webappapis.html#fetch-a-modulepreload-module-script-graph
+void fetch_modulepreload_module_script_graph(JS::Realm& realm, URL::URL const& url, Fetch::Infrastructure::Request::Destination destination, EnvironmentSettingsObject& settings_object, ScriptFetchOptions const& options, OnFetchScriptComplete on_complete)
+{
+    // FIXME: 1. Disallow further import maps given settingsObject's realm.
+
+    // 2. Fetch a single module script given url, settingsObject, destination, options, settingsObject's realm, "client", true,
+    //    and with the following steps given result:
+    auto steps = create_on_fetch_script_complete(realm.heap(), [&realm, &settings_object, destination, on_complete](auto result) {
+        // 1. Run onComplete given result.
+        on_complete->function()(result);
+
+        // 2. Assert: settingsObject's global object implements Window.
+        VERIFY(is<Window>(settings_object.global_object()));
+
+        // 3. If result is not null, optionally fetch the descendants of and link result given settingsObject, destination, and an empty algorithm.
+        // NOTE: We do, so that the whole graph is fetched in parallel with the document, instead of one level of imports
+        //       at a time once a script imports the module.
+        if (result) {
+            auto& module_script = as<JavaScriptModuleScript>(*result);
+            fetch_descendants_of_and_link_a_module_script(realm, module_script, settings_object, destination, nullptr, create_on_fetch_script_complete(realm.heap(), [](auto) { }));
+        }
+    });
+
+    fetch_single_module_script(realm, url, settings_object, destination, options, settings_object.realm(), Fetch::Infrastructure::Request::Referrer::Client, {}, TopLevelModule::Yes, nullptr, steps);
+}
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#fetch-an-inline-module-script-graph
 void fetch_inline_module_script_graph(JS::Realm& realm, ByteString const& filename, ByteString const& source_text, URL::URL const& base_url, EnvironmentSettingsObject& settings_object, OnFetchScriptComplete on_complete)
 {
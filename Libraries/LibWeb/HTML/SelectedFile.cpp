@@ -8,6 +8,7 @@
 #include <LibCore/File.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
+#include <LibWeb/FileAPI/BlobData.h>
 #include <LibWeb/HTML/SelectedFile.h>
 
 namespace Web::HTML {
@@ -35,10 +36,21 @@ SelectedFile::SelectedFile(ByteString name, IPC::File file)
 {
 }
 
-ByteBuffer SelectedFile::take_contents()
+ErrorOr<ByteBuffer> SelectedFile::take_contents()
 {
-    VERIFY(m_file_or_contents.has<ByteBuffer>());
-    return move(m_file_or_contents.get<ByteBuffer>());
+    if (auto* contents = m_file_or_contents.get_pointer<ByteBuffer>())
+        return move(*contents);
+
+    auto file = TRY(Core::File::adopt_fd(m_file_or_contents.get<IPC::File>().take_fd(), Core::File::OpenMode::Read));
+    return file->read_until_eof();
+}
+
+ErrorOr<NonnullRefPtr<FileAPI::BlobData const>> SelectedFile::take_data()
+{
+    if (auto* contents = m_file_or_contents.get_pointer<ByteBuffer>())
+        return FileAPI::BlobData::create(move(*contents));
+
+    return FileAPI::BlobData::create_from_file(m_file_or_contents.get<IPC::File>().take_fd());
 }
 
 }
@@ -57,14 +69,8 @@ ErrorOr<Web::HTML::SelectedFile> IPC::decode(Decoder& decoder)
     auto name = TRY(decoder.decode<ByteString>());
     auto file_or_contents = TRY((decoder.decode<Variant<IPC::File, ByteBuffer>>()));
 
-    ByteBuffer contents;
-
-    if (file_or_contents.has<IPC::File>()) {
-        auto file = TRY(Core::File::adopt_fd(file_or_contents.get<IPC::File>().take_fd(), Core::File::OpenMode::Read));
-        contents = TRY(file->read_until_eof());
-    } else {
-        contents = move(file_or_contents.get<ByteBuffer>());
-    }
-
-    return Web::HTML::SelectedFile { move(name), move(contents) };
+    // NOTE: Files are not read here, so that large files are only read as they are used.
+    return file_or_contents.visit([&](auto& file_or_contents) {
+        return Web::HTML::SelectedFile { move(name), move(file_or_contents) };
+    });
 }
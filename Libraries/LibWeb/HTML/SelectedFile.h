@@ -11,6 +11,7 @@
 #include <AK/Variant.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Forward.h>
+#include <LibWeb/Forward.h>
 
 namespace Web::HTML {
 
@@ -28,7 +29,12 @@ public:
 
     ByteString const& name() const { return m_name; }
     auto const& file_or_contents() const { return m_file_or_contents; }
-    ByteBuffer take_contents();
+
+    // Reads the whole file into memory if it was selected by its path.
+    ErrorOr<ByteBuffer> take_contents();
+
+    // The file's bytes are read from its file descriptor on demand, rather than being read into memory here.
+    ErrorOr<NonnullRefPtr<FileAPI::BlobData const>> take_data();
 
 private:
     ByteString m_name;
@@ -17,6 +17,7 @@
 #include <LibJS/Runtime/BooleanObject.h>
 #include <LibJS/Runtime/DataView.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/Map.h>
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/PrimitiveString.h>
@@ -38,6 +39,7 @@
 #include <LibWeb/Bindings/ImageBitmapPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/MessagePortPrototype.h>
+#include <LibWeb/Bindings/OffscreenCanvasPrototype.h>
 #include <LibWeb/Bindings/ReadableStreamPrototype.h>
 #include <LibWeb/Bindings/Serializable.h>
 #include <LibWeb/Bindings/Transferable.h>
@@ -57,6 +59,7 @@
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/HTML/ImageData.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/Streams/ReadableStream.h>
@@ -162,22 +165,24 @@ static WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, TransferData
 
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
         //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // OPTIMIZATION: The serialized record holds its own copy of the data, so we encode value.[[ArrayBufferData]] into it
+        //               directly, rather than copying the data into an intermediate data block first.
+        if (data_holder.extend_capacity(size).is_error())
+            return vm.throw_completion<JS::RangeError>(JS::ErrorType::NotEnoughMemoryToAllocate, size);
+        auto data_copy = array_buffer.buffer().bytes().trim(size);
 
         // 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
         if (!array_buffer.is_fixed_length()) {
             data_holder.encode(ValueTag::ResizeableArrayBuffer);
-            data_holder.encode(data_copy.buffer());
+            data_holder.encode_bytes(data_copy);
             data_holder.encode(array_buffer.max_byte_length());
         }
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
             data_holder.encode(ValueTag::ArrayBuffer);
-            data_holder.encode(data_copy.buffer());
+            data_holder.encode_bytes(data_copy);
         }
     }
     return {};
@@ -209,11 +214,14 @@ static WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Trans
     JS::Value buffer = view.viewed_array_buffer();
 
     // 3. Let bufferSerialized be ? StructuredSerializeInternal(buffer, forStorage, memory).
-    auto buffer_serialized = TRY(structured_serialize_internal(vm, buffer, for_storage, memory));
+    // NOTE: bufferSerialized is encoded straight after the serialized value's type, which is where it would be appended.
+    data_holder.encode(ValueTag::ArrayBufferView);
+    auto buffer_serialized_offset = data_holder.buffer().data().size();
+    TRY(structured_serialize_internal(vm, data_holder, buffer, for_storage, memory));
 
     // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
     // NOTE: Object reference + memory check is required when ArrayBuffer is transferred.
-    auto tag = TransferDataDecoder { buffer_serialized }.decode<ValueTag>();
+    auto tag = static_cast<ValueTag>(data_holder.buffer().data()[buffer_serialized_offset]);
 
     VERIFY(first_is_one_of(tag, ValueTag::ArrayBuffer, ValueTag::ResizeableArrayBuffer, ValueTag::SharedArrayBuffer, ValueTag::GrowableSharedArrayBuffer)
         || (tag == ValueTag::ObjectReference && memory.contains(buffer)));
@@ -221,9 +229,7 @@ static WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Trans
     // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
     //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
     if constexpr (IsSame<ViewType, JS::DataView>) {
-        data_holder.encode(ValueTag::ArrayBufferView);
-        data_holder.append(move(buffer_serialized)); // [[ArrayBufferSerialized]]
-        data_holder.encode("DataView"_utf16);        // [[Constructor]]
+        data_holder.encode("DataView"_utf16); // [[Constructor]]
         data_holder.encode(JS::get_view_byte_length(view_record));
         data_holder.encode(view.byte_offset());
     }
@@ -234,8 +240,6 @@ static WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, Trans
         // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
         //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
         //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
-        data_holder.encode(ValueTag::ArrayBufferView);
-        data_holder.append(move(buffer_serialized));               // [[ArrayBufferSerialized]]
         data_holder.encode(view.element_name().to_utf16_string()); // [[Constructor]]
         data_holder.encode(JS::typed_array_byte_length(view_record));
         data_holder.encode(view.byte_offset());
@@ -253,22 +257,21 @@ public:
     Serializer(JS::VM& vm, SerializationMemory& memory, bool for_storage)
         : m_vm(vm)
         , m_memory(memory)
-        , m_next_id(memory.size())
         , m_for_storage(for_storage)
     {
     }
 
     // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
     // https://whatpr.org/html/9893/structured-data.html#structuredserializeinternal
-    WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
+    // NOTE: Rather than returning a new record for each value, values are serialized into the record of the value that
+    //       contains them, so that nested values are not copied once for every value they are nested in.
+    WebIDL::ExceptionOr<void> serialize(TransferDataEncoder& serialized, JS::Value value)
     {
-        TransferDataEncoder serialized;
-
         // 2. If memory[value] exists, then return memory[value].
         if (m_memory.contains(value)) {
             serialized.encode(ValueTag::ObjectReference);
             serialized.encode(m_memory.get(value).value());
-            return serialized.take_buffer().take_data();
+            return {};
         }
 
         // 3. Let deep be false.
@@ -298,7 +301,7 @@ public:
         }
 
         if (return_primitive_type)
-            return serialized.take_buffer().take_data();
+            return {};
 
         // 5. If value is a Symbol, then throw a "DataCloneError" DOMException.
         if (value.is_symbol())
@@ -462,7 +465,10 @@ public:
         }
 
         // 25. Set memory[value] to serialized.
-        m_memory.set(make_root(value), m_next_id++);
+        // NOTE: Values are identified by the order in which they were added to the memory, which is also the order in which
+        //       they are deserialized. Serialization steps of nested serializable objects add to the memory as well.
+        auto id = static_cast<u32>(m_memory.size());
+        m_memory.set(make_root(value), id);
 
         // 26. If deep is true, then:
         if (deep) {
@@ -488,10 +494,8 @@ public:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize(serialized, copied_value));
                 }
             }
 
@@ -512,10 +516,8 @@ public:
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize(serialized, copied_value));
                 }
             }
 
@@ -539,11 +541,9 @@ public:
                         auto input_value = TRY(object.internal_get(property_key, value));
 
                         // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
-
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
                         serialized.encode(key.as_string().utf16_string());
-                        serialized.append(move(output_value));
+                        TRY(serialize(serialized, input_value));
 
                         ++property_count;
                     }
@@ -557,13 +557,12 @@ public:
         }
 
         // 27. Return serialized.
-        return serialized.take_buffer().take_data();
+        return {};
     }
 
 private:
     JS::VM& m_vm;
     SerializationMemory& m_memory; // JS value -> index
-    u32 m_next_id { 0 };
     bool m_for_storage { false };
 };
 
@@ -1122,6 +1121,8 @@ static bool is_transferable_interface_exposed_on_target_realm(TransferType name,
         return intrinsics.is_interface_exposed<Bindings::TransformStreamPrototype>(realm);
     case TransferType::ImageBitmap:
         return intrinsics.is_interface_exposed<Bindings::ImageBitmapPrototype>(realm);
+    case TransferType::OffscreenCanvas:
+        return intrinsics.is_interface_exposed<Bindings::OffscreenCanvasPrototype>(realm);
     case TransferType::Unknown:
         dbgln("Unknown interface type for transfer: {}", to_underlying(name));
         break;
@@ -1159,6 +1160,11 @@ static WebIDL::ExceptionOr<GC::Ref<Bindings::PlatformObject>> create_transferred
         TRY(image_bitmap->transfer_receiving_steps(decoder));
         return image_bitmap;
     }
+    case TransferType::OffscreenCanvas: {
+        auto offscreen_canvas = OffscreenCanvas::create(target_realm, 0, 0);
+        TRY(offscreen_canvas->transfer_receiving_steps(decoder));
+        return offscreen_canvas;
+    }
     case TransferType::ArrayBuffer:
     case TransferType::ResizableArrayBuffer:
     case TransferType::Unknown:
@@ -1275,8 +1281,15 @@ WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM& v
     // 1. If memory was not supplied, let memory be an empty map.
     // IMPLEMENTATION DEFINED: We move this requirement up to the callers to make recursion easier
 
+    TransferDataEncoder serialized;
+    TRY(structured_serialize_internal(vm, serialized, value, for_storage, memory));
+    return serialized.take_buffer().take_data();
+}
+
+WebIDL::ExceptionOr<void> structured_serialize_internal(JS::VM& vm, TransferDataEncoder& serialized, JS::Value value, bool for_storage, SerializationMemory& memory)
+{
     Serializer serializer(vm, memory, for_storage);
-    return serializer.serialize(value);
+    return serializer.serialize(serialized, value);
 }
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structureddeserialize
@@ -1313,6 +1326,18 @@ void TransferDataEncoder::append(SerializationRecord&& record)
     MUST(m_buffer.append_data(record.data(), record.size()));
 }
 
+void TransferDataEncoder::encode_bytes(ReadonlyBytes bytes)
+{
+    // NOTE: This is encoded the same way as a ByteBuffer, so it can be decoded with decode_buffer().
+    MUST(m_encoder.encode_size(bytes.size()));
+    MUST(m_encoder.append(bytes.data(), bytes.size()));
+}
+
+ErrorOr<void> TransferDataEncoder::extend_capacity(size_t capacity)
+{
+    return m_encoder.extend_capacity(capacity);
+}
+
 void TransferDataEncoder::extend(Vector<TransferDataEncoder> data_holders)
 {
     for (auto& data_holder : data_holders)
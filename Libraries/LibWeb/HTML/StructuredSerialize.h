@@ -31,9 +31,13 @@ public:
         MUST(m_encoder.encode(value));
     }
 
+    void encode_bytes(ReadonlyBytes);
+
     void append(SerializationRecord&&);
     void extend(Vector<TransferDataEncoder>);
 
+    ErrorOr<void> extend_capacity(size_t);
+
     IPC::MessageBuffer const& buffer() const { return m_buffer; }
     IPC::MessageBuffer take_buffer() { return move(m_buffer); }
 
@@ -78,6 +82,7 @@ struct DeserializedTransferRecord {
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize(JS::VM&, JS::Value);
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize_for_storage(JS::VM&, JS::Value);
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize_internal(JS::VM&, JS::Value, bool for_storage, SerializationMemory&);
+WebIDL::ExceptionOr<void> structured_serialize_internal(JS::VM&, TransferDataEncoder&, JS::Value, bool for_storage, SerializationMemory&);
 
 WebIDL::ExceptionOr<JS::Value> structured_deserialize(JS::VM&, SerializationRecord const&, JS::Realm&, Optional<DeserializationMemory> = {});
 WebIDL::ExceptionOr<JS::Value> structured_deserialize_internal(JS::VM&, TransferDataDecoder&, JS::Realm&, DeserializationMemory&);
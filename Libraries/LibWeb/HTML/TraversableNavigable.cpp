@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/QuickSort.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -44,6 +45,7 @@ void TraversableNavigable::visit_edges(Cell::Visitor& visitor)
     if (m_emulated_position_data.has<GC::Ref<Geolocation::GeolocationCoordinates>>())
         visitor.visit(m_emulated_position_data.get<GC::Ref<Geolocation::GeolocationCoordinates>>());
     visitor.visit(m_session_history_entries);
+    visitor.visit(m_back_forward_cache);
     visitor.visit(m_session_history_traversal_queue);
     visitor.visit(m_storage_shed);
 }
@@ -1106,6 +1108,56 @@ void TraversableNavigable::clear_the_forward_session_history()
             }
         }
     }
+
+    // NOTE: Documents of the entries we removed can never be traversed to again.
+    evict_from_back_forward_cache(m_back_forward_cache.size());
+}
+
+// NOTE: Every cached document keeps its whole DOM, JS realm and resources alive, so we only keep a few of them around.
+static constexpr size_t back_forward_cache_size = 4;
+
+void TraversableNavigable::store_in_back_forward_cache(GC::Ref<DocumentState> document_state)
+{
+    VERIFY(document_state->document());
+
+    m_back_forward_cache.remove_first_matching([&](auto const& cached_document_state) { return cached_document_state == document_state; });
+    m_back_forward_cache.append(document_state);
+
+    evict_from_back_forward_cache(back_forward_cache_size);
+}
+
+void TraversableNavigable::remove_from_back_forward_cache(DOM::Document const& document)
+{
+    m_back_forward_cache.remove_first_matching([&](auto const& document_state) { return document_state->document() == &document; });
+}
+
+void TraversableNavigable::evict_from_back_forward_cache(size_t maximum_size)
+{
+    Vector<GC::Ref<DocumentState>> evicted_document_states;
+
+    m_back_forward_cache.remove_all_matching([&](auto const& document_state) {
+        // A document that is no longer referenced by any of our session history entries can never be restored.
+        auto is_referenced = any_of(m_session_history_entries, [&](auto const& entry) { return entry->document_state() == document_state; });
+        if (is_referenced && document_state->document())
+            return false;
+        evicted_document_states.append(document_state);
+        return true;
+    });
+
+    while (m_back_forward_cache.size() > maximum_size)
+        evicted_document_states.append(m_back_forward_cache.take_first());
+
+    for (auto& document_state : evicted_document_states) {
+        auto document = document_state->document();
+        if (!document)
+            continue;
+
+        // NOTE: The document is not fully active, so we destroy it directly instead of in a task, which would never run.
+        //       Traversing back to its session history entry will load it again.
+        document_state->set_document(nullptr);
+        document->make_unsalvageable("bfcache-eviction"_string);
+        document->destroy();
+    }
 }
 
 bool TraversableNavigable::can_go_forward() const
@@ -1261,6 +1313,8 @@ void TraversableNavigable::destroy_top_level_traversable()
             document->destroy();
     }
 
+    m_back_forward_cache.clear();
+
     // 3. Remove browsingContext.
     if (!browsing_context) {
         dbgln("TraversableNavigable::destroy_top_level_traversable: No browsing context?");
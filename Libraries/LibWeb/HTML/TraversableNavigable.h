@@ -80,6 +80,13 @@ public:
 
     Vector<int> get_all_used_history_steps() const;
     void clear_the_forward_session_history();
+
+    // Keeps a document that is being navigated away from alive in its session history entry, so that traversing back to
+    // it can restore it without loading it again. Documents that were stored the longest ago are evicted to stay within
+    // our budget.
+    void store_in_back_forward_cache(GC::Ref<DocumentState>);
+    void remove_from_back_forward_cache(DOM::Document const&);
+    void clear_back_forward_cache() { evict_from_back_forward_cache(0); }
     void traverse_the_history_by_delta(int delta, GC::Ptr<DOM::Document> source_document = {});
 
     void close_top_level_traversable();
@@ -145,6 +152,8 @@ private:
 
     [[nodiscard]] bool can_go_forward() const;
 
+    void evict_from_back_forward_cache(size_t maximum_size);
+
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-current-session-history-step
     int m_current_session_history_step { 0 };
 
@@ -153,6 +162,9 @@ private:
 
     // FIXME: https://html.spec.whatwg.org/multipage/document-sequences.html#tn-session-history-traversal-queue
 
+    // The document states whose documents are kept in the back/forward cache, ordered from least to most recently stored.
+    Vector<GC::Ref<DocumentState>> m_back_forward_cache;
+
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-running-nested-apply-history-step
     bool m_running_nested_apply_history_step { false };
 
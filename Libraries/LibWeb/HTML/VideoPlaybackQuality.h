@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
+
+namespace Web::HTML {
+
+// https://w3c.github.io/media-playback-quality/#videoplaybackquality-interface
+class VideoPlaybackQuality final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(VideoPlaybackQuality, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(VideoPlaybackQuality);
+
+public:
+    [[nodiscard]] static GC::Ref<VideoPlaybackQuality> create(JS::Realm&, HighResolutionTime::DOMHighResTimeStamp creation_time, u32 dropped_video_frames, u32 total_video_frames);
+    virtual ~VideoPlaybackQuality() override;
+
+    HighResolutionTime::DOMHighResTimeStamp creation_time() const { return m_creation_time; }
+    u32 dropped_video_frames() const { return m_dropped_video_frames; }
+    u32 total_video_frames() const { return m_total_video_frames; }
+
+    // https://w3c.github.io/media-playback-quality/#dom-videoplaybackquality-corruptedvideoframes
+    // When the corruptedVideoFrames attribute is read, it MUST return 0.
+    u32 corrupted_video_frames() const { return 0; }
+
+private:
+    VideoPlaybackQuality(JS::Realm&, HighResolutionTime::DOMHighResTimeStamp creation_time, u32 dropped_video_frames, u32 total_video_frames);
+
+    virtual void initialize(JS::Realm&) override;
+
+    HighResolutionTime::DOMHighResTimeStamp m_creation_time { 0 };
+    u32 m_dropped_video_frames { 0 };
+    u32 m_total_video_frames { 0 };
+};
+
+}
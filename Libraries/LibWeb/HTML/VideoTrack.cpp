@@ -125,6 +125,16 @@ void VideoTrack::seek(AK::Duration position, MediaSeekMode seek_mode)
     }
 }
 
+u64 VideoTrack::dropped_frame_count() const
+{
+    return m_playback_manager->number_of_skipped_frames();
+}
+
+u64 VideoTrack::presented_frame_count() const
+{
+    return m_playback_manager->number_of_presented_frames();
+}
+
 u64 VideoTrack::pixel_width() const
 {
     return m_playback_manager->selected_video_track().video_data().pixel_width;
@@ -31,6 +31,9 @@ public:
     AK::Duration duration() const;
     void seek(AK::Duration, MediaSeekMode);
 
+    u64 dropped_frame_count() const;
+    u64 presented_frame_count() const;
+
     u64 pixel_width() const;
     u64 pixel_height() const;
 
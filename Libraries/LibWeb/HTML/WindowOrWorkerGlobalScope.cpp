@@ -12,8 +12,11 @@
 #include <AK/Utf8View.h>
 #include <AK/Vector.h>
 #include <LibGC/Function.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/Painter.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/TypedArray.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Crypto/Crypto.h>
@@ -36,6 +39,7 @@
 #include <LibWeb/HighResolutionTime/SupportedPerformanceTypes.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
 #include <LibWeb/PerformanceTimeline/EntryTypes.h>
 #include <LibWeb/PerformanceTimeline/EventNames.h>
 #include <LibWeb/PerformanceTimeline/PerformanceObserver.h>
@@ -198,10 +202,30 @@ static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> crop_to_the_source_rectangle_with_for
     // 6. Let output be the rectangle on the plane denoted by sourceRectangle.
     auto output = TRY(input->cropped(source_rectangle, Gfx::Color::Transparent));
 
-    // FIXME: 7. Scale output to the size specified by outputWidth and outputHeight. The user agent should use the
-    //  value of the resizeQuality option to guide the choice of scaling algorithm.
-    (void)output_width;
-    (void)output_height;
+    // 7. Scale output to the size specified by outputWidth and outputHeight. The user agent should use the
+    //    value of the resizeQuality option to guide the choice of scaling algorithm.
+    if (output->width() != output_width || output->height() != output_height) {
+        auto scaling_mode = Gfx::ScalingMode::BilinearBlend;
+        if (options.has_value()) {
+            switch (options->resize_quality) {
+            case Bindings::ResizeQuality::Pixelated:
+                scaling_mode = Gfx::ScalingMode::NearestNeighbor;
+                break;
+            case Bindings::ResizeQuality::Low:
+            case Bindings::ResizeQuality::Medium:
+                scaling_mode = Gfx::ScalingMode::BilinearBlend;
+                break;
+            case Bindings::ResizeQuality::High:
+                scaling_mode = Gfx::ScalingMode::BoxSampling;
+                break;
+            }
+        }
+
+        auto scaled_output = TRY(Gfx::Bitmap::create(output->format(), output->alpha_type(), { output_width, output_height }));
+        auto painter = Gfx::Painter::create(scaled_output);
+        painter->draw_bitmap(scaled_output->rect().to_type<float>(), Gfx::ImmutableBitmap::create(output), output->rect(), scaling_mode, {}, 1, Gfx::CompositingAndBlendingOperator::Copy);
+        output = move(scaled_output);
+    }
 
     // FIXME: 8. If the value of the imageOrientation member of options is "flipY", output must be flipped vertically,
     //  disregarding any image orientation metadata of the source (such as EXIF metadata), if any. [EXIF]
@@ -213,6 +237,47 @@ static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> crop_to_the_source_rectangle_with_for
     return output;
 }
 
+// Runs "cropped to the source rectangle with formatting" on a background thread, as it may have to scale large images.
+// Afterwards, imageBitmap's bitmap data is set to the output, and a global task is queued on the bitmap task source to
+// resolve promise with imageBitmap.
+static void crop_to_the_source_rectangle_with_formatting_and_resolve(GC::Ref<ImageBitmap> image_bitmap, GC::Ref<WebIDL::Promise> promise, NonnullRefPtr<Gfx::Bitmap const> input, Optional<WebIDL::Long> sx, Optional<WebIDL::Long> sy, Optional<WebIDL::Long> sw, Optional<WebIDL::Long> sh, Optional<ImageBitmapOptions> const& options)
+{
+    // NOTE: A failure is reported as a null bitmap, so that the promise is always settled from the completion callback.
+    using CropJob = Threading::BackgroundAction<RefPtr<Gfx::Bitmap>>;
+    CropJob::construct(
+        [input = move(input), sx, sy, sw, sh, options](auto&) -> ErrorOr<RefPtr<Gfx::Bitmap>> {
+            auto output_or_error = crop_to_the_source_rectangle_with_formatting(input, sx, sy, sw, sh, options);
+            if (output_or_error.is_error())
+                return RefPtr<Gfx::Bitmap> {};
+            return RefPtr<Gfx::Bitmap> { output_or_error.release_value() };
+        },
+        [image_bitmap = GC::make_root(image_bitmap), promise = GC::make_root(promise)](RefPtr<Gfx::Bitmap> output) mutable -> ErrorOr<void> {
+            // NOTE: The job may be destroyed on the background thread, so we make sure that the roots don't outlive
+            //       this callback.
+            auto image_bitmap_root = move(image_bitmap);
+            auto promise_root = move(promise);
+            auto& realm = relevant_realm(*image_bitmap_root);
+
+            // AD-HOC: Reject promise with an "InvalidStateError" DOMException on allocation failure
+            // Spec issue: https://github.com/whatwg/html/issues/3323
+            if (!output) {
+                queue_global_task(Task::Source::BitmapTask, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise = GC::Ref { *promise_root }] {
+                    TemporaryExecutionContext const context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
+                    WebIDL::reject_promise(realm, promise, WebIDL::InvalidStateError::create(realm, "Image size is invalid"_utf16));
+                }));
+                return {};
+            }
+            image_bitmap_root->set_bitmap(move(output));
+
+            queue_global_task(Task::Source::BitmapTask, *image_bitmap_root, GC::create_function(realm.heap(), [promise = GC::Ref { *promise_root }, image_bitmap = GC::Ref { *image_bitmap_root }] {
+                auto& realm = relevant_realm(image_bitmap);
+                TemporaryExecutionContext const context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
+                WebIDL::resolve_promise(realm, promise, image_bitmap);
+            }));
+            return {};
+        });
+}
+
 GC::Ref<WebIDL::Promise> WindowOrWorkerGlobalScopeMixin::create_image_bitmap_impl(ImageBitmapSource& image, Optional<WebIDL::Long> sx, Optional<WebIDL::Long> sy, Optional<WebIDL::Long> sw, Optional<WebIDL::Long> sh, Optional<ImageBitmapOptions>& options) const
 {
     auto& realm = this_impl().realm();
@@ -289,31 +354,14 @@ GC::Ref<WebIDL::Promise> WindowOrWorkerGlobalScopeMixin::create_image_bitmap_imp
                     // If this is an animated image, imageBitmap's bitmap data must only be taken from the default image
                     // of the animation (the one that the format defines is to be used when animation is not supported
                     // or is disabled), or, if there is no such image, the first frame of the animation.
-                    auto cropped_bitmap_or_error = crop_to_the_source_rectangle_with_formatting(result.frames.take_first().bitmap, sx, sy, sw, sh, options);
-                    // AD-HOC: Reject promise with an "InvalidStateError" DOMException on allocation failure
-                    // Spec issue: https://github.com/whatwg/html/issues/3323
-                    if (cropped_bitmap_or_error.is_error()) {
-                        auto& realm = relevant_realm(p->promise());
-                        queue_global_task(Task::Source::BitmapTask, realm.global_object(), GC::create_function(realm.heap(), [&realm, p] {
-                            TemporaryExecutionContext const context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
-                            WebIDL::reject_promise(realm, *p, WebIDL::InvalidStateError::create(realm, "Image size is invalid"_utf16));
-                        }));
-                        return {};
-                    }
-                    image_bitmap->set_bitmap(cropped_bitmap_or_error.release_value());
-
-                    auto& realm = relevant_realm(p->promise());
-
                     // 5. Queue a global task, using the bitmap task source, to resolve promise with imageBitmap.
-                    queue_global_task(Task::Source::BitmapTask, *image_bitmap, GC::create_function(realm.heap(), [p, image_bitmap] {
-                        auto& realm = relevant_realm(*image_bitmap);
-                        TemporaryExecutionContext const context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
-                        WebIDL::resolve_promise(realm, *p, image_bitmap);
-                    }));
+                    // NOTE: The image has already been decoded out of process, and the cropping and scaling happen on
+                    //       a background thread.
+                    crop_to_the_source_rectangle_with_formatting_and_resolve(*image_bitmap, *p, *result.frames.take_first().bitmap, sx, sy, sw, sh, options);
                     return {};
                 };
 
-                (void)Web::Platform::ImageCodecPlugin::the().decode_image(image_data, move(on_successful_decode), move(on_failed_decode));
+                (void)Web::Platform::ImageCodecPlugin::the().decode_image(image_data, move(on_successful_decode), move(on_failed_decode), {}, Web::Platform::FramesToDecode::FirstOnly);
             }));
         },
         // -> ImageData
@@ -412,23 +460,11 @@ GC::Ref<WebIDL::Promise> WindowOrWorkerGlobalScopeMixin::create_image_bitmap_imp
                     } else {
                         immutable_bitmap = image_element->default_image_bitmap(Gfx::IntSize { *options->resize_width, *options->resize_height });
                     }
-                    auto cropped_bitmap_or_error = crop_to_the_source_rectangle_with_formatting(immutable_bitmap->bitmap(), sx, sy, sw, sh, options);
-                    // AD-HOC: Reject promise with an "InvalidStateError" DOMException on allocation failure
-                    // Spec issue: https://github.com/whatwg/html/issues/3323
-                    if (cropped_bitmap_or_error.is_error()) {
-                        WebIDL::reject_promise(realm, *p, WebIDL::InvalidStateError::create(image_bitmap->realm(), "Image size is invalid"_utf16));
-                        return;
-                    }
-                    image_bitmap->set_bitmap(cropped_bitmap_or_error.release_value());
-
                     // FIXME: 4. If image is not origin-clean, then set the origin-clean flag of imageBitmap's bitmap to false.
 
                     // 5. Queue a global task, using the bitmap task source, to resolve promise with imageBitmap.
-                    queue_global_task(Task::Source::BitmapTask, image_bitmap, GC::create_function(realm.heap(), [p, image_bitmap] {
-                        auto& realm = relevant_realm(image_bitmap);
-                        TemporaryExecutionContext const context { realm, TemporaryExecutionContext::CallbacksEnabled::Yes };
-                        WebIDL::resolve_promise(realm, *p, image_bitmap);
-                    }));
+                    // NOTE: The cropping and scaling of the image's decoded bitmap happen on a background thread.
+                    crop_to_the_source_rectangle_with_formatting_and_resolve(image_bitmap, p, *immutable_bitmap->bitmap(), sx, sy, sw, sh, options);
                 });
         });
 
@@ -73,9 +73,11 @@ public:
     void register_event_source(Badge<EventSource>, GC::Ref<EventSource>);
     void unregister_event_source(Badge<EventSource>, GC::Ref<EventSource>);
     void forcibly_close_all_event_sources();
+    bool has_registered_event_sources() const { return !m_registered_event_sources.is_empty(); }
 
     void register_web_socket(Badge<WebSockets::WebSocket>, GC::Ref<WebSockets::WebSocket>);
     void unregister_web_socket(Badge<WebSockets::WebSocket>, GC::Ref<WebSockets::WebSocket>);
+    bool has_registered_web_sockets() const { return !m_registered_web_sockets.is_empty(); }
 
     enum class AffectedAnyWebSockets {
         No,
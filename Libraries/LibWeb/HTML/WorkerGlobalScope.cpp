@@ -42,8 +42,6 @@ void WorkerGlobalScope::initialize_web_interfaces_impl()
     Base::initialize(realm);
 
     WindowOrWorkerGlobalScopeMixin::initialize(realm);
-
-    m_navigator = WorkerNavigator::create(*this);
 }
 
 void WorkerGlobalScope::visit_edges(Cell::Visitor& visitor)
@@ -144,10 +142,13 @@ GC::Ref<WorkerLocation> WorkerGlobalScope::location() const
 }
 
 // https://html.spec.whatwg.org/multipage/workers.html#dom-worker-navigator
-GC::Ref<WorkerNavigator> WorkerGlobalScope::navigator() const
+GC::Ref<WorkerNavigator> WorkerGlobalScope::navigator()
 {
     // The navigator attribute of the WorkerGlobalScope interface must return an instance of the WorkerNavigator interface,
     // which represents the identity and state of the user agent (the client).
+    // NOTE: Most workers never look at their navigator, so we only create it on first access.
+    if (!m_navigator)
+        m_navigator = WorkerNavigator::create(*this);
     return *m_navigator;
 }
 
@@ -66,7 +66,7 @@ public:
     GC::Ref<WorkerGlobalScope const> self() const { return *this; }
 
     GC::Ref<WorkerLocation> location() const;
-    GC::Ref<WorkerNavigator> navigator() const;
+    GC::Ref<WorkerNavigator> navigator();
     WebIDL::ExceptionOr<void> import_scripts(Vector<String> const& urls, PerformTheFetchHook = nullptr);
 
 #undef __ENUMERATE
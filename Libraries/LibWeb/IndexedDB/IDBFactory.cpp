@@ -16,6 +16,7 @@
 #include <LibWeb/IndexedDB/IDBDatabase.h>
 #include <LibWeb/IndexedDB/IDBFactory.h>
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseStorage.h>
 #include <LibWeb/IndexedDB/Internal/Key.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/StorageAPI/StorageKey.h>
@@ -202,6 +203,18 @@ GC::Ref<WebIDL::Promise> IDBFactory::databases()
 
         // 1. Let databases be the set of databases in storageKey.
         //    If this cannot be determined for any reason, then reject p with an appropriate error (e.g. an "UnknownError" DOMException) and terminate these steps.
+        // NOTE: Databases that haven't been used since the user agent started are only in storage, so read those first.
+        for (auto name : database_names_in_storage(realm, storage_key)) {
+            auto key = storage_key;
+            if (Database::for_key_and_name(key, name).has_value())
+                continue;
+
+            if (auto result = read_database_from_storage(realm, key, name); result.is_error()) {
+                WebIDL::reject_promise(realm, p, result.exception().get<GC::Ref<WebIDL::DOMException>>());
+                return;
+            }
+        }
+
         auto databases = Database::for_key(storage_key);
 
         // 2. Let result be a new list.
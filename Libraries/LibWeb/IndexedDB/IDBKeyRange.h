@@ -48,6 +48,8 @@ public:
 
     bool is_unbound() const { return m_lower_bound == nullptr && m_upper_bound == nullptr; }
     bool is_in_range(GC::Ref<Key>) const;
+    bool is_below_range(GC::Ref<Key>) const;
+    bool is_above_range(GC::Ref<Key>) const;
     GC::Ptr<Key> lower_key() const { return m_lower_bound; }
     GC::Ptr<Key> upper_key() const { return m_upper_bound; }
 
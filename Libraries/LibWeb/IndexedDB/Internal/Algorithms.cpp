@@ -19,6 +19,7 @@
 #include <LibWeb/FileAPI/Blob.h>
 #include <LibWeb/FileAPI/File.h>
 #include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/IndexedDB/IDBCursor.h>
@@ -31,6 +32,7 @@
 #include <LibWeb/IndexedDB/Internal/Algorithms.h>
 #include <LibWeb/IndexedDB/Internal/ConnectionQueueHandler.h>
 #include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseStorage.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/Key.h>
 #include <LibWeb/Infra/Strings.h>
@@ -75,14 +77,17 @@ WebIDL::ExceptionOr<GC::Ref<IDBDatabase>> open_a_database_connection(JS::Realm&
     auto maybe_db = Database::for_key_and_name(storage_key, name);
     if (maybe_db.has_value()) {
         db = maybe_db.value();
+    } else {
+        // NOTE: Databases that haven't been used since the user agent started are only in storage.
+        db = TRY(read_database_from_storage(realm, storage_key, name));
     }
 
     // 5. If version is undefined, let version be 1 if db is null, or db’s version otherwise.
-    auto version = maybe_version.value_or(maybe_db.has_value() ? maybe_db.value()->version() : 1);
+    auto version = maybe_version.value_or(db ? db->version() : 1);
 
     // 6. If db is null, let db be a new database with name name, version 0 (zero), and with no object stores.
     // If this fails for any reason, return an appropriate error (e.g. a "QuotaExceededError" or "UnknownError" DOMException).
-    if (!maybe_db.has_value()) {
+    if (!db) {
         auto maybe_database = Database::create_for_key_and_name(realm, storage_key, name);
 
         if (maybe_database.is_error()) {
@@ -456,11 +461,15 @@ WebIDL::ExceptionOr<u64> delete_a_database(JS::Realm& realm, StorageAPI::Storage
     }));
 
     // 4. Let db be the database named name in storageKey, if one exists. Otherwise, return 0 (zero).
+    GC::Ptr<Database> db;
     auto maybe_db = Database::for_key_and_name(storage_key, name);
-    if (!maybe_db.has_value())
-        return 0;
+    if (maybe_db.has_value())
+        db = maybe_db.value();
+    else
+        db = TRY(read_database_from_storage(realm, storage_key, name));
 
-    auto db = maybe_db.value();
+    if (!db)
+        return 0;
 
     // 5. Let openConnections be the set of all connections associated with db.
     auto open_connections = db->associated_connections();
@@ -526,6 +535,8 @@ WebIDL::ExceptionOr<u64> delete_a_database(JS::Realm& realm, StorageAPI::Storage
     if (maybe_deleted.is_error())
         return WebIDL::OperationError::create(realm, "Unable to delete database"_utf16);
 
+    remove_database_from_storage(realm, storage_key, name);
+
     // 12. Return version.
     return version;
 }
@@ -769,8 +780,24 @@ void commit_a_transaction(JS::Realm& realm, GC::Ref<IDBTransaction> transaction)
         if (transaction->state() != IDBTransaction::TransactionState::Committing)
             return;
 
-        // FIXME: 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s durability hint.
-        // FIXME: 4. If an error occurs while writing the changes to the database, then run abort a transaction with transaction and an appropriate type for the error, for example "QuotaExceededError" or "UnknownError" DOMException, and terminate these steps.
+        // 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s durability hint.
+        // NOTE: Read-only transactions can't have changed the database, so there is nothing to write for them.
+        // FIXME: Consider transaction’s durability hint. Every write currently goes through the storage jar, which
+        //        syncs it to disk the same way regardless of the hint.
+        if (transaction->mode() != Bindings::IDBTransactionMode::Readonly) {
+            auto database = transaction->connection()->associated_database();
+            auto storage_key = StorageAPI::obtain_a_storage_key(HTML::relevant_settings_object(*transaction));
+
+            if (storage_key.has_value()) {
+                auto result = write_database_to_storage(realm, *storage_key, *database);
+
+                // 4. If an error occurs while writing the changes to the database, then run abort a transaction with transaction and an appropriate type for the error, for example "QuotaExceededError" or "UnknownError" DOMException, and terminate these steps.
+                if (result.is_error()) {
+                    abort_a_transaction(transaction, result.exception().get<GC::Ref<WebIDL::DOMException>>());
+                    return;
+                }
+            }
+        }
 
         // 5. Queue a database task to run these steps:
         queue_a_database_task(GC::create_function(transaction->realm().vm().heap(), [transaction]() {
@@ -1508,6 +1535,36 @@ WebIDL::ExceptionOr<JS::Value> retrieve_a_value_from_an_object_store(JS::Realm&
     return MUST(HTML::structured_deserialize(realm.vm(), serialized, realm));
 }
 
+// NOTE: The requirements that iterating a cursor places on the next record are all lower bounds on its position in
+//       records, except for its key being in range, which also places an upper bound on it. So instead of testing every
+//       record, we can find the first record that either satisfies the requirements or is past the range, and only
+//       need to check whether that record satisfies them.
+template<typename Records, typename Requirements>
+static typename Records::Iterator first_record_satisfying_lower_requirements(Records const& records, Requirements const& requirements, GC::Ref<IDBKeyRange> range)
+{
+    auto it = records.partition_point([&](auto const& record) {
+        return requirements(record) || range->is_above_range(record.key);
+    });
+
+    if (it.is_end() || !requirements(*it))
+        return records.end();
+    return it;
+}
+
+// NOTE: Likewise, the requirements on the previous record are all upper bounds on its position in records, except for
+//       its key being in range.
+template<typename Records, typename Requirements>
+static typename Records::Iterator last_record_satisfying_upper_requirements(Records const& records, Requirements const& requirements, GC::Ref<IDBKeyRange> range)
+{
+    auto it = records.previous(records.partition_point([&](auto const& record) {
+        return !requirements(record) && !range->is_below_range(record.key);
+    }));
+
+    if (it.is_end() || !requirements(*it))
+        return records.end();
+    return it;
+}
+
 // https://w3c.github.io/IndexedDB/#iterate-a-cursor
 GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor, GC::Ptr<Key> key, GC::Ptr<Key> primary_key, u64 count)
 {
@@ -1523,12 +1580,12 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         VERIFY(source.has<GC::Ref<Index>>() && direction_is_next_or_prev);
 
     // 4. Let records be the list of records in source.
-    Variant<ReadonlySpan<Record>, ReadonlySpan<IndexRecord>> records = source.visit(
-        [](GC::Ref<ObjectStore> object_store) -> Variant<ReadonlySpan<Record>, ReadonlySpan<IndexRecord>> {
-            return object_store->records();
+    Variant<RecordList const*, IndexRecordList const*> records = source.visit(
+        [](GC::Ref<ObjectStore> object_store) -> Variant<RecordList const*, IndexRecordList const*> {
+            return &object_store->records();
         },
-        [](GC::Ref<Index> index) -> Variant<ReadonlySpan<Record>, ReadonlySpan<IndexRecord>> {
-            return index->records();
+        [](GC::Ref<Index> index) -> Variant<RecordList const*, IndexRecordList const*> {
+            return &index->records();
         });
 
     // 5. Let range be cursor’s range.
@@ -1743,9 +1800,9 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Next: {
             // Let found record be the first record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.first_matching(next_requirements);
-                if (value.has_value())
-                    return *value;
+                auto it = first_record_satisfying_lower_requirements(*content, next_requirements, range);
+                if (!it.is_end())
+                    return *it;
 
                 return Empty {};
             });
@@ -1754,9 +1811,9 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Nextunique: {
             // Let found record be the first record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.first_matching(next_unique_requirements);
-                if (value.has_value())
-                    return *value;
+                auto it = first_record_satisfying_lower_requirements(*content, next_unique_requirements, range);
+                if (!it.is_end())
+                    return *it;
 
                 return Empty {};
             });
@@ -1765,9 +1822,9 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Prev: {
             // Let found record be the last record in records which satisfy all of the following requirements:
             found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.last_matching(prev_requirements);
-                if (value.has_value())
-                    return *value;
+                auto it = last_record_satisfying_upper_requirements(*content, prev_requirements, range);
+                if (!it.is_end())
+                    return *it;
 
                 return Empty {};
             });
@@ -1777,9 +1834,9 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         case Bindings::IDBCursorDirection::Prevunique: {
             // Let temp record be the last record in records which satisfy all of the following requirements:
             auto temp_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                auto value = content.last_matching(prev_unique_requirements);
-                if (value.has_value())
-                    return *value;
+                auto it = last_record_satisfying_upper_requirements(*content, prev_unique_requirements, range);
+                if (!it.is_end())
+                    return *it;
 
                 return Empty {};
             });
@@ -1791,11 +1848,11 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
                     [](auto const& record) { return record.key; });
 
                 found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
-                    auto value = content.first_matching([&](auto const& content_record) {
-                        return Key::equals(content_record.key, temp_record_key);
+                    auto it = content->partition_point([&](auto const& content_record) {
+                        return !Key::less_than(content_record.key, temp_record_key);
                     });
-                    if (value.has_value())
-                        return *value;
+                    if (!it.is_end() && Key::equals(it->key, temp_record_key))
+                        return *it;
 
                     return Empty {};
                 });
@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Base64.h>
+#include <AK/Endian.h>
+#include <AK/MemoryStream.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/IndexedDB/Internal/DatabaseStorage.h>
+#include <LibWeb/IndexedDB/Internal/Index.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::IndexedDB {
+
+// Bump this whenever the layout of a snapshot changes. Snapshots with another version are not read.
+static constexpr u32 SNAPSHOT_FORMAT_VERSION = 1;
+
+static Page* page_for_realm(JS::Realm& realm)
+{
+    // FIXME: Workers don't have access to the storage jar yet, so their databases only live as long as the worker.
+    auto* window = as_if<HTML::Window>(realm.global_object());
+    if (!window)
+        return nullptr;
+    return &window->page();
+}
+
+template<typename T>
+static ErrorOr<void> write_integer(Stream& stream, T value)
+{
+    return stream.write_value<LittleEndian<T>>(value);
+}
+
+template<typename T>
+static ErrorOr<T> read_integer(Stream& stream)
+{
+    return TRY(stream.read_value<LittleEndian<T>>());
+}
+
+static ErrorOr<void> write_bytes(Stream& stream, ReadonlyBytes bytes)
+{
+    TRY(write_integer<u32>(stream, bytes.size()));
+    return stream.write_until_depleted(bytes);
+}
+
+static ErrorOr<ByteBuffer> read_bytes(Stream& stream)
+{
+    auto size = TRY(read_integer<u32>(stream));
+    auto bytes = TRY(ByteBuffer::create_uninitialized(size));
+    TRY(stream.read_until_filled(bytes));
+    return bytes;
+}
+
+static ErrorOr<void> write_string(Stream& stream, String const& string)
+{
+    return write_bytes(stream, string.bytes());
+}
+
+static ErrorOr<String> read_string(Stream& stream)
+{
+    auto bytes = TRY(read_bytes(stream));
+    return String::from_utf8(bytes);
+}
+
+enum class KeyPathType : u8 {
+    None,
+    String,
+    Sequence,
+};
+
+static ErrorOr<void> write_key_path(Stream& stream, Optional<KeyPath> const& key_path)
+{
+    if (!key_path.has_value())
+        return write_integer(stream, to_underlying(KeyPathType::None));
+
+    return key_path->visit(
+        [&](String const& string) -> ErrorOr<void> {
+            TRY(write_integer(stream, to_underlying(KeyPathType::String)));
+            return write_string(stream, string);
+        },
+        [&](Vector<String> const& strings) -> ErrorOr<void> {
+            TRY(write_integer(stream, to_underlying(KeyPathType::Sequence)));
+            TRY(write_integer<u32>(stream, strings.size()));
+            for (auto const& string : strings)
+                TRY(write_string(stream, string));
+            return {};
+        });
+}
+
+static ErrorOr<Optional<KeyPath>> read_key_path(Stream& stream)
+{
+    switch (static_cast<KeyPathType>(TRY(read_integer<u8>(stream)))) {
+    case KeyPathType::None:
+        return OptionalNone {};
+    case KeyPathType::String:
+        return KeyPath { TRY(read_string(stream)) };
+    case KeyPathType::Sequence: {
+        auto count = TRY(read_integer<u32>(stream));
+        Vector<String> strings;
+        TRY(strings.try_ensure_capacity(count));
+        for (u32 i = 0; i < count; ++i)
+            strings.unchecked_append(TRY(read_string(stream)));
+        return KeyPath { move(strings) };
+    }
+    }
+    return Error::from_string_literal("Invalid key path type");
+}
+
+static ErrorOr<void> write_key(Stream& stream, GC::Ref<Key> key)
+{
+    TRY(write_integer(stream, static_cast<u8>(key->type())));
+
+    switch (key->type()) {
+    case Key::KeyType::Number:
+    case Key::KeyType::Date:
+        return write_integer(stream, bit_cast<u64>(key->value_as_double()));
+    case Key::KeyType::String:
+        return write_string(stream, key->value_as_string());
+    case Key::KeyType::Binary:
+        return write_bytes(stream, key->value_as_byte_buffer());
+    case Key::KeyType::Array: {
+        auto subkeys = key->subkeys();
+        TRY(write_integer<u32>(stream, subkeys.size()));
+        for (auto const& subkey : subkeys)
+            TRY(write_key(stream, *subkey));
+        return {};
+    }
+    case Key::KeyType::Invalid:
+        break;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static ErrorOr<GC::Ref<Key>> read_key(JS::Realm& realm, Stream& stream)
+{
+    switch (static_cast<Key::KeyType>(TRY(read_integer<u8>(stream)))) {
+    case Key::KeyType::Number:
+        return Key::create_number(realm, bit_cast<double>(TRY(read_integer<u64>(stream))));
+    case Key::KeyType::Date:
+        return Key::create_date(realm, bit_cast<double>(TRY(read_integer<u64>(stream))));
+    case Key::KeyType::String:
+        return Key::create_string(realm, TRY(read_string(stream)));
+    case Key::KeyType::Binary:
+        return Key::create_binary(realm, TRY(read_bytes(stream)));
+    case Key::KeyType::Array: {
+        auto count = TRY(read_integer<u32>(stream));
+        Vector<GC::Root<Key>> subkeys;
+        TRY(subkeys.try_ensure_capacity(count));
+        for (u32 i = 0; i < count; ++i)
+            subkeys.unchecked_append(TRY(read_key(realm, stream)));
+        return Key::create_array(realm, subkeys);
+    }
+    case Key::KeyType::Invalid:
+        break;
+    }
+    return Error::from_string_literal("Invalid key type");
+}
+
+static ErrorOr<ByteBuffer> serialize_database(Database& database)
+{
+    AllocatingMemoryStream stream;
+
+    TRY(write_integer(stream, SNAPSHOT_FORMAT_VERSION));
+    TRY(write_integer(stream, database.version()));
+
+    auto object_stores = database.object_stores();
+    TRY(write_integer<u32>(stream, object_stores.size()));
+
+    for (auto const& object_store : object_stores) {
+        TRY(write_string(stream, object_store->name()));
+        TRY(write_key_path(stream, object_store->key_path()));
+
+        TRY(write_integer<u8>(stream, object_store->uses_a_key_generator()));
+        if (object_store->uses_a_key_generator())
+            TRY(write_integer(stream, object_store->key_generator().current_number()));
+
+        // NOTE: Record values are written as the serialization records they are stored as.
+        auto const& records = object_store->records();
+        TRY(write_integer<u32>(stream, records.size()));
+        for (auto it = records.begin(); !it.is_end(); ++it) {
+            TRY(write_key(stream, it->key));
+            TRY(write_bytes(stream, it->value.span()));
+        }
+
+        auto& indexes = object_store->index_set();
+        TRY(write_integer<u32>(stream, indexes.size()));
+        for (auto const& [name, index] : indexes) {
+            TRY(write_string(stream, index->name()));
+            TRY(write_key_path(stream, index->key_path()));
+            TRY(write_integer<u8>(stream, index->unique()));
+            TRY(write_integer<u8>(stream, index->multi_entry()));
+
+            auto const& index_records = index->records();
+            TRY(write_integer<u32>(stream, index_records.size()));
+            for (auto it = index_records.begin(); !it.is_end(); ++it) {
+                TRY(write_key(stream, it->key));
+                TRY(write_key(stream, it->value));
+            }
+        }
+    }
+
+    return stream.read_until_eof();
+}
+
+static ErrorOr<void> deserialize_database(JS::Realm& realm, Database& database, ReadonlyBytes snapshot)
+{
+    FixedMemoryStream stream { snapshot };
+
+    if (TRY(read_integer<u32>(stream)) != SNAPSHOT_FORMAT_VERSION)
+        return Error::from_string_literal("Unsupported database snapshot version");
+
+    database.set_version(TRY(read_integer<u64>(stream)));
+
+    auto object_store_count = TRY(read_integer<u32>(stream));
+    for (u32 i = 0; i < object_store_count; ++i) {
+        auto name = TRY(read_string(stream));
+        auto key_path = TRY(read_key_path(stream));
+        auto auto_increment = TRY(read_integer<u8>(stream)) != 0;
+
+        auto object_store = ObjectStore::create(realm, database, move(name), auto_increment, key_path);
+        if (auto_increment)
+            object_store->key_generator().set(TRY(read_integer<u64>(stream)));
+
+        auto record_count = TRY(read_integer<u32>(stream));
+        for (u32 j = 0; j < record_count; ++j) {
+            auto key = TRY(read_key(realm, stream));
+            auto value = TRY(read_bytes(stream));
+
+            HTML::SerializationRecord serialized_value;
+            TRY(serialized_value.try_append(value.data(), value.size()));
+            object_store->store_a_record({ key, move(serialized_value) });
+        }
+
+        auto index_count = TRY(read_integer<u32>(stream));
+        for (u32 j = 0; j < index_count; ++j) {
+            auto index_name = TRY(read_string(stream));
+            auto index_key_path = TRY(read_key_path(stream));
+            if (!index_key_path.has_value())
+                return Error::from_string_literal("Index has no key path");
+            auto unique = TRY(read_integer<u8>(stream)) != 0;
+            auto multi_entry = TRY(read_integer<u8>(stream)) != 0;
+
+            auto index = Index::create(realm, object_store, index_name, *index_key_path, unique, multi_entry);
+
+            auto index_record_count = TRY(read_integer<u32>(stream));
+            for (u32 k = 0; k < index_record_count; ++k) {
+                auto key = TRY(read_key(realm, stream));
+                auto value = TRY(read_key(realm, stream));
+                index->store_a_record({ key, value });
+            }
+        }
+    }
+
+    if (!stream.is_eof())
+        return Error::from_string_literal("Trailing data in database snapshot");
+    return {};
+}
+
+WebIDL::ExceptionOr<void> write_database_to_storage(JS::Realm& realm, StorageAPI::StorageKey const& storage_key, Database& database)
+{
+    auto* page = page_for_realm(realm);
+    if (!page)
+        return {};
+
+    auto snapshot = serialize_database(database);
+    if (snapshot.is_error())
+        return WebIDL::UnknownError::create(realm, "Unable to serialize database"_utf16);
+
+    auto encoded_snapshot = encode_base64(snapshot.value());
+    if (encoded_snapshot.is_error())
+        return WebIDL::UnknownError::create(realm, "Unable to serialize database"_utf16);
+
+    auto result = page->client().page_did_set_storage_item(StorageAPI::StorageEndpointType::IndexedDB, storage_key.to_string(), database.name(), encoded_snapshot.value());
+    if (result == WebView::StorageOperationError::QuotaExceededError)
+        return WebIDL::QuotaExceededError::create(realm, "Unable to write database, as the storage quota has been exceeded"_utf16);
+
+    return {};
+}
+
+WebIDL::ExceptionOr<GC::Ptr<Database>> read_database_from_storage(JS::Realm& realm, StorageAPI::StorageKey& storage_key, String& name)
+{
+    auto* page = page_for_realm(realm);
+    if (!page)
+        return GC::Ptr<Database> {};
+
+    auto encoded_snapshot = page->client().page_did_request_storage_item(StorageAPI::StorageEndpointType::IndexedDB, storage_key.to_string(), name);
+    if (!encoded_snapshot.has_value())
+        return GC::Ptr<Database> {};
+
+    auto snapshot = decode_base64(*encoded_snapshot);
+    if (snapshot.is_error())
+        return WebIDL::UnknownError::create(realm, "Unable to read database"_utf16);
+
+    auto maybe_database = Database::create_for_key_and_name(realm, storage_key, name);
+    if (maybe_database.is_error())
+        return WebIDL::OperationError::create(realm, "Unable to create a new database"_utf16);
+    auto database = maybe_database.release_value();
+
+    if (auto result = deserialize_database(realm, *database, snapshot.value()); result.is_error()) {
+        dbgln("IndexedDB: Unable to read database '{}': {}", name, result.error());
+        MUST(Database::delete_for_key_and_name(storage_key, name));
+        return WebIDL::UnknownError::create(realm, "Unable to read database"_utf16);
+    }
+
+    return GC::Ptr<Database> { *database };
+}
+
+void remove_database_from_storage(JS::Realm& realm, StorageAPI::StorageKey const& storage_key, String const& name)
+{
+    if (auto* page = page_for_realm(realm))
+        page->client().page_did_remove_storage_item(StorageAPI::StorageEndpointType::IndexedDB, storage_key.to_string(), name);
+}
+
+Vector<String> database_names_in_storage(JS::Realm& realm, StorageAPI::StorageKey const& storage_key)
+{
+    if (auto* page = page_for_realm(realm))
+        return page->client().page_did_request_storage_keys(StorageAPI::StorageEndpointType::IndexedDB, storage_key.to_string());
+    return {};
+}
+
+}
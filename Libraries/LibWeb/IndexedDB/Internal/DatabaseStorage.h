@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/String.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::IndexedDB {
+
+// Databases are persisted in the IndexedDB storage bottle of their storage key, which lives in the browser's storage
+// jar. Each database is stored as a single snapshot of its version, object stores, indexes and records, which is
+// replaced whenever a transaction that may have changed the database commits. Record values are stored as their
+// serialization records, so they don't have to be serialized again.
+WebIDL::ExceptionOr<void> write_database_to_storage(JS::Realm&, StorageAPI::StorageKey const&, Database&);
+WebIDL::ExceptionOr<GC::Ptr<Database>> read_database_from_storage(JS::Realm&, StorageAPI::StorageKey&, String&);
+void remove_database_from_storage(JS::Realm&, StorageAPI::StorageKey const&, String const&);
+Vector<String> database_names_in_storage(JS::Realm&, StorageAPI::StorageKey const&);
+
+}
@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -34,10 +33,10 @@ void Index::visit_edges(Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_object_store);
 
-    for (auto& record : m_records) {
+    m_records.for_each([&](auto const& record) {
         visitor.visit(record.key);
         visitor.visit(record.value);
-    }
+    });
 }
 
 void Index::set_name(String name)
@@ -49,13 +48,20 @@ void Index::set_name(String name)
     m_name = move(name);
 }
 
+IndexRecordList::Iterator Index::first_record_not_below_range(GC::Ref<IDBKeyRange> range) const
+{
+    return m_records.partition_point([&](auto const& record) {
+        return !range->is_below_range(record.key);
+    });
+}
+
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
+    auto it = m_records.partition_point([&](auto const& record) {
+        return !Key::less_than(record.key, key);
     });
 
-    return index != m_records.end();
+    return !it.is_end() && Key::equals(it->key, key);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -63,13 +69,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->record_with_key(index_record.value).value().value;
 }
 
 void Index::clear_records()
@@ -77,19 +77,19 @@ void Index::clear_records()
     m_records.clear();
 }
 
-Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
+Optional<IndexRecord const&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto it = first_record_not_below_range(range);
+    if (it.is_end() || !range->is_in_range(it->key))
+        return {};
+    return *it;
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto it = first_record_not_below_range(range); !it.is_end() && range->is_in_range(it->key); ++it) {
+        records.append(*it);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -101,29 +101,20 @@ GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange>
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
     u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
+    for (auto it = first_record_not_below_range(range); !it.is_end() && range->is_in_range(it->key); ++it)
+        ++count;
     return count;
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
-        if (key_comparison != 0)
-            return key_comparison < 0;
-
-        return Key::compare_two_keys(a.value, b.value) < 0;
-    });
+    m_records.insert(record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
 {
+    // NOTE: The records are sorted by key rather than by value, so this has to look at all of them.
     m_records.remove_all_matching([&](auto const& record) {
         return range->is_in_range(record.value);
     });
@@ -11,6 +11,7 @@
 #include <LibJS/Heap/Cell.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
 
 namespace Web::IndexedDB {
 
@@ -22,6 +23,18 @@ struct IndexRecord {
     GC::Ref<Key> value;
 };
 
+struct CompareIndexRecords {
+    static int compare(IndexRecord const& a, IndexRecord const& b)
+    {
+        auto key_comparison = Key::compare_two_keys(a.key, b.key);
+        if (key_comparison != 0)
+            return key_comparison;
+        return Key::compare_two_keys(a.value, b.value);
+    }
+};
+
+using IndexRecordList = RecordTree<IndexRecord, CompareIndexRecords>;
+
 // https://w3c.github.io/IndexedDB/#index-construct
 class Index : public JS::Cell {
     GC_CELL(Index, JS::Cell);
@@ -36,12 +49,12 @@ public:
     [[nodiscard]] bool unique() const { return m_unique; }
     [[nodiscard]] bool multi_entry() const { return m_multi_entry; }
     [[nodiscard]] GC::Ref<ObjectStore> object_store() const { return m_object_store; }
-    [[nodiscard]] AK::ReadonlySpan<IndexRecord> records() const { return m_records; }
+    [[nodiscard]] IndexRecordList const& records() const { return m_records; }
     [[nodiscard]] KeyPath const& key_path() const { return m_key_path; }
 
     [[nodiscard]] bool has_record_with_key(GC::Ref<Key> key);
     void clear_records();
-    Optional<IndexRecord&> first_in_range(GC::Ref<IDBKeyRange> range);
+    Optional<IndexRecord const&> first_in_range(GC::Ref<IDBKeyRange> range);
     GC::ConservativeVector<IndexRecord> first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
     void store_a_record(IndexRecord const& record);
@@ -55,11 +68,14 @@ protected:
 private:
     Index(GC::Ref<ObjectStore>, String const&, KeyPath const&, bool, bool);
 
+    IndexRecordList::Iterator first_record_not_below_range(GC::Ref<IDBKeyRange> range) const;
+
     // An index [...] has a referenced object store.
     GC::Ref<ObjectStore> m_object_store;
 
     // The index has a list of records which hold the data stored in the index.
-    Vector<IndexRecord> m_records;
+    // NOTE: Like the records of an object store, these are kept in a B+-tree.
+    IndexRecordList m_records;
 
     // An index has a name, which is a name. At any one time, the name is unique within index’s referenced object store.
     String m_name;
@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -36,52 +35,60 @@ void ObjectStore::visit_edges(Visitor& visitor)
     visitor.visit(m_database);
     visitor.visit(m_indexes);
 
-    for (auto& record : m_records) {
+    m_records.for_each([&](auto const& record) {
         visitor.visit(record.key);
-    }
+    });
 }
 
-void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
+RecordList::Iterator ObjectStore::first_record_not_below_range(GC::Ref<IDBKeyRange> range) const
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
+    return m_records.partition_point([&](auto const& record) {
+        return !range->is_below_range(record.key);
     });
 }
 
+void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
+{
+    for (auto it = first_record_not_below_range(range); !it.is_end() && range->is_in_range(it->key);)
+        it = m_records.remove(it);
+}
+
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
+    return record_with_key(key).has_value();
+}
+
+Optional<Record const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
+{
+    auto it = m_records.partition_point([&](auto const& record) {
+        return !Key::less_than(record.key, key);
     });
 
-    return index != m_records.end();
+    if (it.is_end() || !Key::equals(it->key, key))
+        return {};
+    return *it;
 }
 
 void ObjectStore::store_a_record(Record const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
-    });
+    m_records.insert(record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
     u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
+    for (auto it = first_record_not_below_range(range); !it.is_end() && range->is_in_range(it->key); ++it)
+        ++count;
     return count;
 }
 
-Optional<Record&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
+Optional<Record const&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto it = first_record_not_below_range(range);
+    if (it.is_end() || !range->is_in_range(it->key))
+        return {};
+    return *it;
 }
 
 void ObjectStore::clear_records()
@@ -92,9 +99,8 @@ void ObjectStore::clear_records()
 GC::ConservativeVector<Record> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
     GC::ConservativeVector<Record> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto it = first_record_not_below_range(range); !it.is_end() && range->is_in_range(it->key); ++it) {
+        records.append(*it);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -18,6 +18,7 @@
 #include <LibWeb/IndexedDB/Internal/Database.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/KeyGenerator.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
 
 namespace Web::IndexedDB {
 
@@ -29,6 +30,12 @@ struct Record {
     HTML::SerializationRecord value;
 };
 
+struct CompareRecords {
+    static int compare(Record const& a, Record const& b) { return Key::compare_two_keys(a.key, b.key); }
+};
+
+using RecordList = RecordTree<Record, CompareRecords>;
+
 // https://w3c.github.io/IndexedDB/#object-store-construct
 class ObjectStore : public JS::Cell {
     GC_CELL(ObjectStore, JS::Cell);
@@ -48,13 +55,14 @@ public:
     AK::HashMap<String, GC::Ref<Index>>& index_set() { return m_indexes; }
 
     GC::Ref<Database> database() const { return m_database; }
-    ReadonlySpan<Record> records() const { return m_records; }
+    RecordList const& records() const { return m_records; }
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
     bool has_record_with_key(GC::Ref<Key> key);
+    Optional<Record const&> record_with_key(GC::Ref<Key> key) const;
     void store_a_record(Record const& record);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
-    Optional<Record&> first_in_range(GC::Ref<IDBKeyRange> range);
+    Optional<Record const&> first_in_range(GC::Ref<IDBKeyRange> range);
     void clear_records();
     GC::ConservativeVector<Record> first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count);
 
@@ -64,6 +72,8 @@ protected:
 private:
     ObjectStore(GC::Ref<Database> database, String name, bool auto_increment, Optional<KeyPath> const& key_path);
 
+    RecordList::Iterator first_record_not_below_range(GC::Ref<IDBKeyRange> range) const;
+
     // AD-HOC: An ObjectStore needs to know what Database it belongs to...
     GC::Ref<Database> m_database;
 
@@ -80,7 +90,9 @@ private:
     Optional<KeyGenerator> m_key_generator;
 
     // An object store has a list of records
-    Vector<Record> m_records;
+    // NOTE: The records are kept in a B+-tree, sorted by key, so that looking up records and keeping them sorted don't
+    //       get slower as the object store grows.
+    RecordList m_records;
 };
 
 }
@@ -0,0 +1,320 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullOwnPtr.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Vector.h>
+
+namespace Web::IndexedDB {
+
+// A list of records sorted in ascending order, stored in a B+-tree so that records can be looked up, inserted and
+// removed in logarithmic time, and iterated in order from any position.
+//
+// CompareRecords::compare(a, b) must return a negative number if a is sorted before b, zero if they are equal, and a
+// positive number if a is sorted after b.
+//
+// Inner nodes don't store separator keys. Instead, the first record in the subtree of each child separates it from
+// the child before it. That saves copying records that may hold large serialized values, and the separators never go
+// stale when records are removed. Nodes that become empty are removed, but nodes that underflow are not merged with
+// their siblings, so the tree is never deeper than the number of records it ever held requires.
+template<typename RecordType, typename CompareRecords>
+class RecordTree {
+    AK_MAKE_NONCOPYABLE(RecordTree);
+    AK_MAKE_NONMOVABLE(RecordTree);
+
+    // The maximum number of records in a leaf node, and of children in an inner node.
+    static constexpr size_t maximum_node_size = 64;
+
+    struct Node {
+        Node* parent { nullptr };
+        bool is_leaf { true };
+
+        // Leaf nodes hold records, and are linked to the leaf nodes before and after them.
+        Vector<RecordType> records;
+        Node* previous { nullptr };
+        Node* next { nullptr };
+
+        // Inner nodes hold their children.
+        Vector<NonnullOwnPtr<Node>> children;
+    };
+
+public:
+    class Iterator {
+    public:
+        Iterator() = default;
+
+        RecordType const& operator*() const { return m_leaf->records[m_index]; }
+        RecordType const* operator->() const { return &m_leaf->records[m_index]; }
+
+        bool operator==(Iterator const&) const = default;
+        bool is_end() const { return m_leaf == nullptr; }
+
+        Iterator& operator++()
+        {
+            if (++m_index == m_leaf->records.size()) {
+                m_leaf = m_leaf->next;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+    private:
+        friend class RecordTree;
+
+        Iterator(Node const* leaf, size_t index)
+            : m_leaf(leaf)
+            , m_index(index)
+        {
+        }
+
+        Node const* m_leaf { nullptr };
+        size_t m_index { 0 };
+    };
+
+    RecordTree() = default;
+
+    size_t size() const { return m_size; }
+    bool is_empty() const { return m_size == 0; }
+
+    Iterator begin() const { return iterator_at_or_after(first_leaf(*m_root), 0); }
+    Iterator end() const { return {}; }
+
+    // Returns the last record, or the end if there are no records.
+    Iterator last() const
+    {
+        auto const* node = m_root.ptr();
+        while (!node->is_leaf)
+            node = node->children.last().ptr();
+        if (node->records.is_empty())
+            return end();
+        return { node, node->records.size() - 1 };
+    }
+
+    // Returns the record before the given one, or the end if it is the first record. The record before the end is the
+    // last record.
+    Iterator previous(Iterator it) const
+    {
+        if (it.is_end())
+            return last();
+        if (it.m_index > 0)
+            return { it.m_leaf, it.m_index - 1 };
+        if (auto const* previous_leaf = it.m_leaf->previous)
+            return { previous_leaf, previous_leaf->records.size() - 1 };
+        return end();
+    }
+
+    // Returns the first record for which the predicate returns true, or the end if there is no such record. The
+    // predicate must be false for every record before some position, and true for every record from there on.
+    template<typename Predicate>
+    Iterator partition_point(Predicate predicate) const
+    {
+        auto const* node = m_root.ptr();
+        while (!node->is_leaf) {
+            // The partition point is in the child before the first child whose first record satisfies the predicate.
+            size_t low = 1;
+            size_t high = node->children.size();
+            while (low < high) {
+                auto middle = low + (high - low) / 2;
+                if (predicate(first_record(*node->children[middle])))
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+            node = node->children[low - 1].ptr();
+        }
+
+        size_t low = 0;
+        size_t high = node->records.size();
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (predicate(node->records[middle]))
+                high = middle;
+            else
+                low = middle + 1;
+        }
+        return iterator_at_or_after(node, low);
+    }
+
+    // Inserts the record after any records that are equal to it.
+    void insert(RecordType record)
+    {
+        auto* node = m_root.ptr();
+        while (!node->is_leaf) {
+            // The record belongs in the last child whose first record is not sorted after it.
+            size_t low = 1;
+            size_t high = node->children.size();
+            while (low < high) {
+                auto middle = low + (high - low) / 2;
+                if (CompareRecords::compare(record, first_record(*node->children[middle])) < 0)
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+            node = node->children[low - 1].ptr();
+        }
+
+        size_t low = 0;
+        size_t high = node->records.size();
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (CompareRecords::compare(record, node->records[middle]) < 0)
+                high = middle;
+            else
+                low = middle + 1;
+        }
+
+        node->records.insert(low, move(record));
+        ++m_size;
+
+        if (node->records.size() > maximum_node_size)
+            split(*node);
+    }
+
+    // Removes the record, and returns the record that followed it.
+    Iterator remove(Iterator it)
+    {
+        auto* leaf = const_cast<Node*>(it.m_leaf);
+        leaf->records.remove(it.m_index);
+        --m_size;
+
+        auto next = iterator_at_or_after(leaf, it.m_index);
+        if (leaf->records.is_empty() && leaf != m_root.ptr())
+            remove_node(*leaf);
+        return next;
+    }
+
+    template<typename Predicate>
+    void remove_all_matching(Predicate predicate)
+    {
+        for (auto it = begin(); !it.is_end();) {
+            if (predicate(*it))
+                it = remove(it);
+            else
+                ++it;
+        }
+    }
+
+    void clear()
+    {
+        m_root = make<Node>();
+        m_size = 0;
+    }
+
+    template<typename Callback>
+    void for_each(Callback callback) const
+    {
+        for (auto const* leaf = first_leaf(*m_root); leaf; leaf = leaf->next) {
+            for (auto const& record : leaf->records)
+                callback(record);
+        }
+    }
+
+private:
+    static Node* first_leaf(Node& node)
+    {
+        auto* leaf = &node;
+        while (!leaf->is_leaf)
+            leaf = leaf->children.first().ptr();
+        return leaf;
+    }
+
+    static Node const* first_leaf(Node const& node)
+    {
+        return first_leaf(const_cast<Node&>(node));
+    }
+
+    static RecordType const& first_record(Node const& node)
+    {
+        return first_leaf(node)->records.first();
+    }
+
+    static Iterator iterator_at_or_after(Node const* leaf, size_t index)
+    {
+        if (index < leaf->records.size())
+            return { leaf, index };
+        return { leaf->next, 0 };
+    }
+
+    void split(Node& node)
+    {
+        auto sibling = make<Node>();
+        sibling->is_leaf = node.is_leaf;
+
+        if (node.is_leaf) {
+            auto half = node.records.size() / 2;
+            for (size_t i = half; i < node.records.size(); ++i)
+                sibling->records.append(move(node.records[i]));
+            node.records.shrink(half);
+
+            sibling->previous = &node;
+            sibling->next = node.next;
+            if (node.next)
+                node.next->previous = sibling.ptr();
+            node.next = sibling.ptr();
+        } else {
+            auto half = node.children.size() / 2;
+            for (size_t i = half; i < node.children.size(); ++i) {
+                node.children[i]->parent = sibling.ptr();
+                sibling->children.append(move(node.children[i]));
+            }
+            node.children.shrink(half);
+        }
+
+        if (!node.parent) {
+            auto old_root = exchange(m_root, make<Node>());
+            m_root->is_leaf = false;
+            old_root->parent = m_root.ptr();
+            m_root->children.append(move(old_root));
+        }
+
+        auto& parent = *node.parent;
+        auto index = parent.children.find_first_index_if([&](auto const& child) { return child.ptr() == &node; }).value();
+
+        sibling->parent = &parent;
+        parent.children.insert(index + 1, move(sibling));
+
+        if (parent.children.size() > maximum_node_size)
+            split(parent);
+    }
+
+    void remove_node(Node& node)
+    {
+        if (node.is_leaf) {
+            if (node.previous)
+                node.previous->next = node.next;
+            if (node.next)
+                node.next->previous = node.previous;
+        }
+
+        auto& parent = *node.parent;
+        parent.children.remove_first_matching([&](auto const& child) { return child.ptr() == &node; });
+
+        if (parent.children.is_empty() && &parent != m_root.ptr()) {
+            remove_node(parent);
+            return;
+        }
+
+        // Let the tree become shallower once the root is left with a single child, or none at all.
+        if (m_root->is_leaf)
+            return;
+        if (m_root->children.is_empty()) {
+            m_root = make<Node>();
+            return;
+        }
+        while (!m_root->is_leaf && m_root->children.size() == 1) {
+            auto child = move(m_root->children.first());
+            child->parent = nullptr;
+            m_root = move(child);
+        }
+    }
+
+    NonnullOwnPtr<Node> m_root { make<Node>() };
+    size_t m_size { 0 };
+};
+
+}
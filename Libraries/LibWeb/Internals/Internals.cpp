@@ -5,7 +5,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibUnicode/TimeZone.h>
@@ -17,10 +19,14 @@
 #include <LibWeb/DOM/NodeList.h>
 #include <LibWeb/DOMURL/DOMURL.h>
 #include <LibWeb/HTML/HTMLElement.h>
+#include <LibWeb/HTML/Navigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
 #include <LibWeb/Page/InputEvent.h>
+#include <LibWeb/Layout/FormattingContext.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/PaintableBox.h>
 
 namespace Web::Internals {
@@ -325,6 +331,92 @@ String Internals::dump_display_list()
     return window().associated_document().dump_display_list();
 }
 
+String Internals::dump_bytecode_profile()
+{
+    StringBuilder builder;
+    vm().bytecode_interpreter().dump_profile(builder);
+    return builder.to_string_without_validation();
+}
+
+String Internals::measure_rendering(WebIDL::UnsignedLong iterations)
+{
+    auto& document = window().associated_document();
+    auto navigable = document.navigable();
+    if (!navigable)
+        return "{}"_string;
+
+    auto bitmap_size = page().css_to_device_rect({ {}, navigable->viewport_size() }).size().to_type<int>();
+    auto bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, bitmap_size.is_empty() ? Gfx::IntSize { 1, 1 } : bitmap_size).release_value_but_fixme_should_propagate_errors();
+    auto painting_surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+
+    auto milliseconds_since = [](MonotonicTime start_time) {
+        return static_cast<double>((MonotonicTime::now() - start_time).to_nanoseconds()) / 1'000'000.0;
+    };
+
+    JsonArray style_times;
+    JsonArray layout_times;
+    JsonArray display_list_recording_times;
+    JsonArray display_list_playback_times;
+    Layout::FormattingContextTimings formatting_context_timings;
+
+    for (WebIDL::UnsignedLong i = 0; i < iterations; ++i) {
+        document.invalidate_style(DOM::StyleInvalidationReason::InternalsMeasureRendering);
+        auto start_time = MonotonicTime::now();
+        document.update_style();
+        style_times.must_append(milliseconds_since(start_time));
+
+        // NOTE: This includes building the layout tree, which every formatting context then lays out.
+        document.invalidate_layout_tree(DOM::InvalidateLayoutTreeReason::InternalsMeasureRendering);
+        start_time = MonotonicTime::now();
+        {
+            Layout::FormattingContextTimings::Collector collector { formatting_context_timings };
+            document.update_layout(DOM::UpdateLayoutReason::InternalsMeasureRendering);
+        }
+        layout_times.must_append(milliseconds_since(start_time));
+
+        document.invalidate_display_list();
+        start_time = MonotonicTime::now();
+        auto display_list = document.record_display_list({});
+        display_list_recording_times.must_append(milliseconds_since(start_time));
+
+        if (!display_list)
+            continue;
+
+        start_time = MonotonicTime::now();
+        Painting::DisplayListPlayerSkia display_list_player;
+        display_list_player.execute(*display_list, {}, painting_surface);
+        display_list_playback_times.must_append(milliseconds_since(start_time));
+    }
+
+    JsonObject formatting_context_times;
+    for (size_t i = 0; i < Layout::FormattingContextTimings::number_of_types; ++i) {
+        auto type = static_cast<Layout::FormattingContext::Type>(i);
+        auto total_time = formatting_context_timings.time_spent_in(type);
+        if (total_time.is_zero())
+            continue;
+
+        auto time_per_iteration = static_cast<double>(total_time.to_nanoseconds()) / 1'000'000.0 / static_cast<double>(max(iterations, 1u));
+        formatting_context_times.set(Layout::FormattingContextTimings::type_name(type), time_per_iteration);
+    }
+
+    size_t dom_node_count = 0;
+    document.for_each_in_inclusive_subtree([&](auto const&) {
+        ++dom_node_count;
+        return TraversalDecision::Continue;
+    });
+
+    JsonObject result;
+    result.set("url"sv, document.url().serialize());
+    result.set("iterations"sv, iterations);
+    result.set("dom_nodes"sv, dom_node_count);
+    result.set("style_ms"sv, move(style_times));
+    result.set("layout_ms"sv, move(layout_times));
+    result.set("formatting_context_ms_per_iteration"sv, move(formatting_context_times));
+    result.set("display_list_recording_ms"sv, move(display_list_recording_times));
+    result.set("display_list_playback_ms"sv, move(display_list_playback_times));
+    return result.serialized();
+}
+
 GC::Ptr<DOM::ShadowRoot> Internals::get_shadow_root(GC::Ref<DOM::Element> element)
 {
     return element->shadow_root();
@@ -65,6 +65,8 @@ public:
     bool headless();
 
     String dump_display_list();
+    String dump_bytecode_profile();
+    String measure_rendering(WebIDL::UnsignedLong iterations);
 
     GC::Ptr<DOM::ShadowRoot> get_shadow_root(GC::Ref<DOM::Element>);
 
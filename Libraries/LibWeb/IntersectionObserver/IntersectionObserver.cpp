@@ -127,7 +127,9 @@ void IntersectionObserver::observe(DOM::Element& target)
     // Run the observe a target Element algorithm, providing this and target.
     // https://www.w3.org/TR/intersection-observer/#observe-a-target-element
     // 1. If target is in observer’s internal [[ObservationTargets]] slot, return.
-    if (m_observation_targets.contains_slow(GC::Ref { target }))
+    // NOTE: Every target of an observer has a registration for it, and a target has far fewer registrations than an
+    //       observer may have targets, so we look for a registration instead.
+    if (target.has_intersection_observer_registration(*this))
         return;
 
     // 2. Let intersectionObserverRegistration be an IntersectionObserverRegistration record with an observer
@@ -144,6 +146,18 @@ void IntersectionObserver::observe(DOM::Element& target)
 
     // 4. Add target to observer’s internal [[ObservationTargets]] slot.
     m_observation_targets.append(target);
+
+    m_geometry_generation_at_last_update.clear();
+}
+
+bool IntersectionObserver::needs_to_update_observations() const
+{
+    return m_geometry_generation_at_last_update != DOM::Document::geometry_generation();
+}
+
+void IntersectionObserver::did_update_observations(Badge<DOM::Document>)
+{
+    m_geometry_generation_at_last_update = DOM::Document::geometry_generation();
 }
 
 // https://w3c.github.io/IntersectionObserver/#dom-intersectionobserver-unobserve
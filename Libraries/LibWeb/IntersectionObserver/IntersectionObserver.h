@@ -67,6 +67,9 @@ public:
 
     void queue_entry(Badge<DOM::Document>, GC::Ref<IntersectionObserverEntry>);
 
+    bool needs_to_update_observations() const;
+    void did_update_observations(Badge<DOM::Document>);
+
     WebIDL::CallbackType& callback() { return *m_callback; }
 
 private:
@@ -107,6 +110,10 @@ private:
 
     // AD-HOC: This is the document where we've registered the IntersectionObserver.
     WeakPtr<DOM::Document> m_document;
+
+    // OPTIMIZATION: The geometry generation of documents when we last updated our observations, if no target was added
+    //               since then. See DOM::Document::geometry_generation().
+    Optional<u64> m_geometry_generation_at_last_update;
 };
 
 }
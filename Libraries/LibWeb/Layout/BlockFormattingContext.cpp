@@ -71,6 +71,8 @@ static bool margins_collapse_through(Box const& box, LayoutState& state)
 
 void BlockFormattingContext::run(AvailableSpace const& available_space)
 {
+    FormattingContextTimings::RunScope timing_scope { Type::Block };
+
     if (is<Viewport>(root())) {
         layout_viewport(available_space);
         return;
@@ -17,6 +17,9 @@ struct LineBoxFragmentCoordinate {
     size_t fragment_index { 0 };
 };
 
+// Memoized results of the throwaway layouts used to determine a box's intrinsic sizes. Flex and grid items are sized
+// through these, so each item is laid out at most once per constraint and width across all intrinsic sizing passes of
+// its container. Reset when the box (or anything affecting it) needs a layout update.
 struct IntrinsicSizes {
     Optional<CSSPixels> min_content_width;
     Optional<CSSPixels> max_content_width;
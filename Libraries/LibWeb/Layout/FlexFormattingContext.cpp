@@ -46,6 +46,8 @@ CSSPixels FlexFormattingContext::automatic_content_height() const
 
 void FlexFormattingContext::run(AvailableSpace const& available_space)
 {
+    FormattingContextTimings::RunScope timing_scope { Type::Flex };
+
     // This implements https://www.w3.org/TR/css-flexbox-1/#layout-algorithm
 
     // OPTIMIZATION: If we're in intrinsic sizing layout, but the flex container is not the
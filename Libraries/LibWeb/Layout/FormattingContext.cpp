@@ -1976,4 +1976,76 @@ bool FormattingContext::should_treat_max_height_as_none(Box const& box, Availabl
     return false;
 }
 
+static FormattingContextTimings* s_current_timings { nullptr };
+
+FormattingContextTimings::Collector::Collector(FormattingContextTimings& timings)
+    : m_previous_timings(exchange(s_current_timings, &timings))
+{
+}
+
+FormattingContextTimings::Collector::~Collector()
+{
+    s_current_timings = m_previous_timings;
+}
+
+FormattingContextTimings::RunScope::RunScope(FormattingContext::Type type)
+    : m_timings(s_current_timings)
+{
+    if (m_timings) [[unlikely]]
+        m_timings->enter(type);
+}
+
+FormattingContextTimings::RunScope::~RunScope()
+{
+    if (m_timings) [[unlikely]]
+        m_timings->leave();
+}
+
+void FormattingContextTimings::enter(FormattingContext::Type type)
+{
+    auto now = MonotonicTime::now();
+
+    // The time of the formatting context we are nested in is paused until we are done.
+    if (!m_running_contexts.is_empty()) {
+        auto& parent = m_running_contexts.last();
+        m_time_per_type[to_underlying(parent.type)] += now - parent.start_time;
+    }
+
+    m_running_contexts.append({ type, now });
+}
+
+void FormattingContextTimings::leave()
+{
+    auto now = MonotonicTime::now();
+
+    auto context = m_running_contexts.take_last();
+    m_time_per_type[to_underlying(context.type)] += now - context.start_time;
+
+    if (!m_running_contexts.is_empty())
+        m_running_contexts.last().start_time = now;
+}
+
+StringView FormattingContextTimings::type_name(FormattingContext::Type type)
+{
+    switch (type) {
+    case FormattingContext::Type::Block:
+        return "block"sv;
+    case FormattingContext::Type::Inline:
+        return "inline"sv;
+    case FormattingContext::Type::Flex:
+        return "flex"sv;
+    case FormattingContext::Type::Grid:
+        return "grid"sv;
+    case FormattingContext::Type::Table:
+        return "table"sv;
+    case FormattingContext::Type::SVG:
+        return "svg"sv;
+    case FormattingContext::Type::InternalReplaced:
+        return "internal-replaced"sv;
+    case FormattingContext::Type::InternalDummy:
+        return "internal-dummy"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 }
@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <AK/Array.h>
+#include <AK/Noncopyable.h>
 #include <AK/OwnPtr.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/LayoutState.h>
@@ -167,4 +171,52 @@ protected:
     LayoutState& m_state;
 };
 
+// Accumulates how long every type of formatting context has run for, not counting the time spent in the formatting
+// contexts nested in it. Timings are only collected while a collector is installed, which also covers the throwaway
+// layouts done for intrinsic sizing.
+class FormattingContextTimings {
+public:
+    static constexpr size_t number_of_types = to_underlying(FormattingContext::Type::InternalDummy) + 1;
+
+    class Collector {
+        AK_MAKE_NONCOPYABLE(Collector);
+        AK_MAKE_NONMOVABLE(Collector);
+
+    public:
+        explicit Collector(FormattingContextTimings&);
+        ~Collector();
+
+    private:
+        FormattingContextTimings* m_previous_timings { nullptr };
+    };
+
+    // Placed at the start of every FormattingContext::run().
+    class RunScope {
+        AK_MAKE_NONCOPYABLE(RunScope);
+        AK_MAKE_NONMOVABLE(RunScope);
+
+    public:
+        explicit RunScope(FormattingContext::Type);
+        ~RunScope();
+
+    private:
+        FormattingContextTimings* m_timings { nullptr };
+    };
+
+    AK::Duration time_spent_in(FormattingContext::Type type) const { return m_time_per_type[to_underlying(type)]; }
+
+    static StringView type_name(FormattingContext::Type);
+
+private:
+    void enter(FormattingContext::Type);
+    void leave();
+
+    struct RunningContext {
+        FormattingContext::Type type;
+        MonotonicTime start_time;
+    };
+    Vector<RunningContext, 32> m_running_contexts;
+    Array<AK::Duration, number_of_types> m_time_per_type;
+};
+
 }
@@ -1962,6 +1962,8 @@ CSSPixelRect GridFormattingContext::get_grid_area_rect(GridItem const& grid_item
 
 void GridFormattingContext::run(AvailableSpace const& available_space)
 {
+    FormattingContextTimings::RunScope timing_scope { Type::Grid };
+
     // OPTIMIZATION: If we're in intrinsic sizing layout, but the grid container is not the
     //               box being measured, we can skip everything here.
     //               The parent formatting context has already figured out our size anyway.
@@ -2349,23 +2351,87 @@ void GridFormattingContext::init_grid_lines(GridDimension dimension)
     lines.append(line_names);
 }
 
-void OccupationGrid::set_occupied(int column_start, int column_end, int row_start, int row_end)
+void OccupationGrid::ensure_cells_are_allocated(int column_start, int column_end, int row_start, int row_end)
 {
-    for (int row_index = row_start; row_index < row_end; row_index++) {
-        for (int column_index = column_start; column_index < column_end; column_index++) {
-            m_min_column_index = min(m_min_column_index, column_index);
-            m_max_column_index = max(m_max_column_index, column_index);
-            m_min_row_index = min(m_min_row_index, row_index);
-            m_max_row_index = max(m_max_row_index, row_index);
+    auto allocated_column_end = m_allocated_column_start + static_cast<int>(m_allocated_column_count);
+    auto allocated_row_end = m_allocated_row_start + static_cast<int>(m_allocated_row_count);
+
+    if (m_allocated_column_count > 0 && m_allocated_row_count > 0
+        && column_start >= m_allocated_column_start && column_end <= allocated_column_end
+        && row_start >= m_allocated_row_start && row_end <= allocated_row_end) {
+        return;
+    }
+
+    auto new_column_start = column_start;
+    auto new_column_end = column_end;
+    auto new_row_start = row_start;
+    auto new_row_end = row_end;
+    if (m_allocated_column_count > 0 && m_allocated_row_count > 0) {
+        new_column_start = min(new_column_start, m_allocated_column_start);
+        new_column_end = max(new_column_end, allocated_column_end);
+        new_row_start = min(new_row_start, m_allocated_row_start);
+        new_row_end = max(new_row_end, allocated_row_end);
 
-            m_occupation_grid.set(GridPosition { .row = row_index, .column = column_index });
+        // NOTE: Auto-placed items usually create new rows one at a time, so allocate more rows than we need right now.
+        if (new_row_end > allocated_row_end)
+            new_row_end = max(new_row_end, allocated_row_end + static_cast<int>(m_allocated_row_count));
+    }
+
+    auto new_column_count = static_cast<size_t>(new_column_end - new_column_start);
+    auto new_row_count = static_cast<size_t>(new_row_end - new_row_start);
+    auto old_occupied_cells = move(m_occupied_cells);
+    auto old_column_count = m_allocated_column_count;
+    auto old_row_count = m_allocated_row_count;
+    auto row_shift = static_cast<size_t>(m_allocated_row_start - new_row_start);
+    auto column_shift = static_cast<size_t>(m_allocated_column_start - new_column_start);
+
+    m_occupied_cells.resize(ceil_div(new_column_count * new_row_count, static_cast<size_t>(64)));
+
+    for (size_t row = 0; row < old_row_count; ++row) {
+        for (size_t column = 0; column < old_column_count; ++column) {
+            auto old_index = row * old_column_count + column;
+            if (!(old_occupied_cells[old_index / 64] & (1ull << (old_index % 64))))
+                continue;
+            set_allocated_cell_occupied((row + row_shift) * new_column_count + column + column_shift);
         }
     }
+
+    m_allocated_column_start = new_column_start;
+    m_allocated_row_start = new_row_start;
+    m_allocated_column_count = new_column_count;
+    m_allocated_row_count = new_row_count;
+}
+
+void OccupationGrid::set_occupied(int column_start, int column_end, int row_start, int row_end)
+{
+    if (column_start >= column_end || row_start >= row_end)
+        return;
+
+    m_min_column_index = min(m_min_column_index, column_start);
+    m_max_column_index = max(m_max_column_index, column_end - 1);
+    m_min_row_index = min(m_min_row_index, row_start);
+    m_max_row_index = max(m_max_row_index, row_end - 1);
+
+    ensure_cells_are_allocated(column_start, column_end, row_start, row_end);
+
+    for (int row_index = row_start; row_index < row_end; row_index++) {
+        auto row_offset = static_cast<size_t>(row_index - m_allocated_row_start) * m_allocated_column_count;
+        for (int column_index = column_start; column_index < column_end; column_index++)
+            set_allocated_cell_occupied(row_offset + static_cast<size_t>(column_index - m_allocated_column_start));
+    }
 }
 
 bool OccupationGrid::is_occupied(int column_index, int row_index) const
 {
-    return m_occupation_grid.contains(GridPosition { row_index, column_index });
+    if (column_index < m_allocated_column_start || row_index < m_allocated_row_start)
+        return false;
+
+    auto column = static_cast<size_t>(column_index - m_allocated_column_start);
+    auto row = static_cast<size_t>(row_index - m_allocated_row_start);
+    if (column >= m_allocated_column_count || row >= m_allocated_row_count)
+        return false;
+
+    return is_allocated_cell_occupied(row * m_allocated_column_count + column);
 }
 
 int GridItem::gap_adjusted_row() const
@@ -33,12 +33,6 @@ enum class Alignment {
     Unsafe,
 };
 
-struct GridPosition {
-    int row;
-    int column;
-    inline bool operator==(GridPosition const&) const = default;
-};
-
 struct GridItem {
     GC::Ref<Box const> box;
     LayoutState::UsedValues& used_values;
@@ -170,7 +164,18 @@ public:
     FoundUnoccupiedPlace find_unoccupied_place(GridDimension dimension, int& column_index, int& row_index, int column_span, int row_span) const;
 
 private:
-    HashTable<GridPosition> m_occupation_grid;
+    void ensure_cells_are_allocated(int column_start, int column_end, int row_start, int row_end);
+
+    bool is_allocated_cell_occupied(size_t index) const { return m_occupied_cells[index / 64] & (1ull << (index % 64)); }
+    void set_allocated_cell_occupied(size_t index) { m_occupied_cells[index / 64] |= 1ull << (index % 64); }
+
+    // The occupied cells are stored as a bitmap of the allocated area in row-major order. The allocated area grows as
+    // cells outside of it are occupied.
+    Vector<u64> m_occupied_cells;
+    int m_allocated_column_start { 0 };
+    int m_allocated_row_start { 0 };
+    size_t m_allocated_column_count { 0 };
+    size_t m_allocated_row_count { 0 };
 
     int m_min_column_index { 0 };
     int m_max_column_index { 0 };
@@ -527,7 +527,7 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next_without_lookahead(
         }
 
         CSS::CalculationResolutionContext calculation_context { .length_resolution_context = CSS::Length::ResolutionContext::for_layout_node(text_node) };
-        auto letter_spacing = text_node.computed_values().letter_spacing().resolved(calculation_context).map([&](auto& it) { return it.to_px(text_node); }).value_or(0);
+        auto letter_spacing = m_text_node_context->letter_spacing;
         // FIXME: We should apply word spacing to all word-separator characters not just breaking tabs
         auto word_spacing = text_node.computed_values().word_spacing().resolved(text_node, CSS::Length::make_px(chunk.font->glyph_width(' ')).to_px(text_node)).absolute_length_to_px();
 
@@ -536,7 +536,7 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next_without_lookahead(
             CSSPixels accumulated_width;
 
             // make sure to account for any fragments that take up a portion of the measured tab stop distance
-            auto fragments = m_containing_block_used_values.line_boxes.last().fragments();
+            auto const& fragments = m_containing_block_used_values.line_boxes.last().fragments();
             for (auto const& frag : fragments) {
                 accumulated_width += frag.width();
             }
@@ -579,8 +579,7 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next_without_lookahead(
             x = tab_stop_dist.to_float();
         }
 
-        auto shape_features = create_and_merge_font_features();
-        auto glyph_run = Gfx::shape_text({ x, 0 }, letter_spacing.to_float(), chunk.view, chunk.font, text_type, shape_features);
+        auto glyph_run = Gfx::shape_text({ x, 0 }, letter_spacing.to_float(), chunk.view, chunk.font, text_type, m_text_node_context->shape_features);
 
         CSSPixels chunk_width = CSSPixels::nearest_value_for(glyph_run->width() + x);
 
@@ -678,6 +677,9 @@ void InlineLevelIterator::enter_text_node(Layout::TextNode const& text_node)
     if (text_node.dom_node().is_editable() && !text_node.dom_node().is_uninteresting_whitespace_node())
         do_collapse = false;
 
+    CSS::CalculationResolutionContext calculation_context { .length_resolution_context = CSS::Length::ResolutionContext::for_layout_node(text_node) };
+    auto letter_spacing = text_node.computed_values().letter_spacing().resolved(calculation_context).map([&](auto& it) { return it.to_px(text_node); }).value_or(0);
+
     m_text_node_context = TextNodeContext {
         .do_collapse = do_collapse,
         .do_wrap_lines = do_wrap_lines,
@@ -685,6 +687,8 @@ void InlineLevelIterator::enter_text_node(Layout::TextNode const& text_node)
         .is_first_chunk = true,
         .is_last_chunk = false,
         .chunk_iterator = TextNode::ChunkIterator { text_node, do_wrap_lines, do_respect_linebreaks },
+        .letter_spacing = letter_spacing,
+        .shape_features = create_and_merge_font_features(),
     };
 }
 
@@ -88,6 +88,9 @@ private:
         bool is_last_chunk {};
         TextNode::ChunkIterator chunk_iterator;
         Optional<Gfx::GlyphRun::TextType> last_known_direction {};
+        // NOTE: These are the same for every chunk of the text node, so they are only resolved once.
+        CSSPixels letter_spacing {};
+        Gfx::ShapeFeatures shape_features {};
     };
 
     Optional<TextNodeContext> m_text_node_context;
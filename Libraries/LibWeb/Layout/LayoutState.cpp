@@ -18,36 +18,92 @@
 
 namespace Web::Layout {
 
+static u64 s_next_layout_state_serial_number = 1;
+
+// Layout creates many short-lived layout states (e.g. for intrinsic sizing), so we hold on to the storage of a few
+// chunks of used values when a layout state is destroyed, and reuse them for the next one.
+static constexpr size_t MAXIMUM_RECYCLED_USED_VALUES_CHUNKS = 16;
+
+static Vector<NonnullOwnPtr<Vector<LayoutState::UsedValues>>>& recycled_used_values_chunks()
+{
+    static Vector<NonnullOwnPtr<Vector<LayoutState::UsedValues>>> chunks;
+    return chunks;
+}
+
+LayoutState::LayoutState()
+    : m_serial_number(s_next_layout_state_serial_number++)
+{
+}
+
 LayoutState::~LayoutState()
 {
+    auto& recycled_chunks = recycled_used_values_chunks();
+
+    for (auto& chunk : m_used_values_chunks) {
+        if (recycled_chunks.size() >= MAXIMUM_RECYCLED_USED_VALUES_CHUNKS)
+            break;
+
+        chunk->clear_with_capacity();
+        recycled_chunks.append(move(chunk));
+    }
 }
 
-LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
+LayoutState::UsedValues const* LayoutState::find(NodeWithStyle const& node) const
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
-        return *used_values;
+    // OPTIMIZATION: The node remembers where the layout state that last touched it stored its used values, so we can
+    //               usually find them without a hash lookup.
+    if (node.m_layout_state_serial_number == m_serial_number)
+        return m_used_values[node.m_used_values_index];
+
+    auto index = m_used_values_index_by_node.get(&node);
+    if (!index.has_value())
+        return nullptr;
+
+    node.m_layout_state_serial_number = m_serial_number;
+    node.m_used_values_index = *index;
+    return m_used_values[*index];
+}
 
+LayoutState::UsedValues& LayoutState::create(NodeWithStyle const& node) const
+{
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    // NOTE: Used values are allocated in chunks that are never reallocated, so references to them remain valid.
+    if (m_used_values_chunks.is_empty() || m_used_values_chunks.last()->size() == used_values_chunk_size) {
+        if (auto& recycled_chunks = recycled_used_values_chunks(); !recycled_chunks.is_empty()) {
+            m_used_values_chunks.append(recycled_chunks.take_last());
+        } else {
+            auto new_chunk = make<Vector<UsedValues>>();
+            new_chunk->ensure_capacity(used_values_chunk_size);
+            m_used_values_chunks.append(move(new_chunk));
+        }
+    }
+    auto& chunk = *m_used_values_chunks.last();
+    chunk.empend();
+    auto& new_used_values = chunk.last();
+    new_used_values.set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
+
+    auto index = static_cast<u32>(m_used_values.size());
+    m_used_values.append(&new_used_values);
+    m_used_values_index_by_node.set(&node, index);
+
+    node.m_layout_state_serial_number = m_serial_number;
+    node.m_used_values_index = index;
+    return new_used_values;
+}
+
+LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
+{
+    if (auto* used_values = find(node))
+        return const_cast<UsedValues&>(*used_values);
+    return create(node);
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto const* used_values = find(node))
         return *used_values;
-
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
-
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    return create(node);
 }
 
 // https://drafts.csswg.org/css-overflow-3/#scrollable-overflow-region
@@ -163,8 +219,8 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         for (auto& paintable : node.paintables()) {
@@ -262,7 +318,7 @@ void LayoutState::commit(Box& root)
                 auto& inline_node = const_cast<InlineNode&>(static_cast<InlineNode const&>(*parent));
                 auto line_paintable = inline_node.create_paintable_for_line_with_index(line_index);
                 line_paintable->add_fragment(fragment);
-                if (auto const* used_values = used_values_per_layout_node.get(inline_node).value_or(nullptr))
+                if (auto const* used_values = find(inline_node))
                     transfer_box_model_metrics(line_paintable->box_model(), *used_values);
                 if (!inline_node_paintables.contains(line_paintable.ptr())) {
                     inline_node_paintables.set(line_paintable.ptr());
@@ -274,8 +330,8 @@ void LayoutState::commit(Box& root)
         return false;
     };
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         auto paintable = node.create_paintable();
@@ -336,15 +392,15 @@ void LayoutState::commit(Box& root)
         auto line_paintable = inline_node->create_paintable_for_line_with_index(0);
         inline_node->add_paintable(line_paintable);
         inline_node_paintables.set(line_paintable.ptr());
-        if (auto const* used_values = used_values_per_layout_node.get(*inline_node).value_or(nullptr))
+        if (auto const* used_values = find(*inline_node))
             transfer_box_model_metrics(line_paintable->box_model(), *used_values);
     }
 
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -430,8 +486,8 @@ void LayoutState::commit(Box& root)
     }
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         if (!used_values.node().is_box())
             continue;
         auto const& box = static_cast<Layout::Box const&>(used_values.node());
@@ -445,8 +501,8 @@ void LayoutState::commit(Box& root)
             paintable_box.set_scroll_offset(paintable_box.scroll_offset());
     }
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto* used_values_pointer : m_used_values) {
+        auto& used_values = *used_values_pointer;
         auto& node = used_values.node();
         for (auto& paintable : node.paintables()) {
             Painting::PaintableBox* paintable_box = nullptr;
@@ -199,6 +199,7 @@ struct LayoutState {
         Optional<StaticPositionRect> m_static_position_rect;
     };
 
+    LayoutState();
     ~LayoutState();
 
     // Commits the used values produced by layout and builds a paintable tree.
@@ -207,10 +208,24 @@ struct LayoutState {
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
-
 private:
+    AK_MAKE_NONCOPYABLE(LayoutState);
+    AK_MAKE_NONMOVABLE(LayoutState);
+
     void resolve_relative_positions();
+
+    [[nodiscard]] UsedValues const* find(NodeWithStyle const&) const;
+    UsedValues& create(NodeWithStyle const&) const;
+
+    static constexpr size_t used_values_chunk_size = 64;
+
+    // Identifies this layout state to the nodes that remember where their used values are stored.
+    u64 m_serial_number { 0 };
+
+    // The used values of each node, in the order they were created.
+    mutable Vector<UsedValues*> m_used_values;
+    mutable Vector<NonnullOwnPtr<Vector<UsedValues>>> m_used_values_chunks;
+    mutable HashMap<NodeWithStyle const*, u32> m_used_values_index_by_node;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
@@ -269,6 +269,11 @@ private:
 
     NonnullOwnPtr<CSS::ComputedValues> m_computed_values;
     RefPtr<CSS::AbstractImageStyleValue const> m_list_style_image;
+
+    // Where the layout state that last looked up this node stored its used values.
+    friend struct LayoutState;
+    mutable u64 m_layout_state_serial_number { 0 };
+    mutable u32 m_used_values_index { 0 };
 };
 
 template<>
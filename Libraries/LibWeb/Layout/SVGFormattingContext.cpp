@@ -174,6 +174,8 @@ static bool is_container_element(Node const& node)
 
 void SVGFormattingContext::run(AvailableSpace const& available_space)
 {
+    FormattingContextTimings::RunScope timing_scope { Type::SVG };
+
     // NOTE: SVG doesn't have a "formatting context" in the spec, but this is the most
     //       obvious way to drive SVG layout in our engine at the moment.
 
@@ -1672,6 +1672,8 @@ void TableFormattingContext::parent_context_did_dimension_child_root_box()
 
 void TableFormattingContext::run(AvailableSpace const& available_space)
 {
+    FormattingContextTimings::RunScope timing_scope { Type::Table };
+
     m_available_space = available_space;
 
     auto total_captions_height = run_caption_layout(CSS::CaptionSide::Top);
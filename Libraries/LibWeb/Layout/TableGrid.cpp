@@ -10,6 +10,16 @@
 
 namespace Web::Layout {
 
+void TableGrid::set_occupied(size_t x, size_t y)
+{
+    if (m_occupancy_grid.size() <= y)
+        m_occupancy_grid.resize(y + 1);
+    auto& row = m_occupancy_grid[y];
+    if (row.size() <= x)
+        row.resize(x + 1);
+    row[x] = true;
+}
+
 TableGrid TableGrid::calculate_row_column_grid(Box const& box, Vector<Cell>& cells, Vector<Row>& rows)
 {
     // Implements https://html.spec.whatwg.org/multipage/tables.html#forming-a-table
@@ -29,7 +39,7 @@ TableGrid TableGrid::calculate_row_column_grid(Box const& box, Vector<Cell>& cel
         for (auto* child = row.first_child(); child; child = child->next_sibling()) {
             if (child->display().is_table_cell()) {
                 // Cells: While x_current is less than x_width and the slot with coordinate (x_current, y_current) already has a cell assigned to it, increase x_current by 1.
-                while (x_current < x_width && table_grid.m_occupancy_grid.contains(GridPosition { x_current, y_current }))
+                while (x_current < x_width && table_grid.is_occupied(x_current, y_current))
                     x_current++;
 
                 Box const* box = static_cast<Box const*>(child);
@@ -50,7 +60,7 @@ TableGrid TableGrid::calculate_row_column_grid(Box const& box, Vector<Cell>& cel
 
                 for (size_t y = y_current; y < y_current + rowspan; y++)
                     for (size_t x = x_current; x < x_current + colspan; x++)
-                        table_grid.m_occupancy_grid.set(GridPosition { x, y }, true);
+                        table_grid.set_occupied(x, y);
                 cells.append(Cell { *box, x_current, y_current, colspan, rowspan });
                 max_cell_x = max(x_current, max_cell_x);
                 max_cell_y = max(y_current, max_cell_y);
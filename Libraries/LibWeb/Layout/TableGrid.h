@@ -6,19 +6,13 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
+#include <AK/Vector.h>
 #include <LibWeb/Layout/Box.h>
 
 namespace Web::Layout {
 
 class TableGrid {
 public:
-    struct GridPosition {
-        size_t x;
-        size_t y;
-        inline bool operator==(GridPosition const&) const = default;
-    };
-
     struct Row {
         GC::Ref<Box const> box;
         CSSPixels base_height { 0 };
@@ -53,7 +47,7 @@ public:
     static TableGrid calculate_row_column_grid(Box const& box);
 
     size_t column_count() const { return m_column_count; }
-    HashMap<GridPosition, bool> const& occupancy_grid() const { return m_occupancy_grid; }
+    bool is_occupied(size_t x, size_t y) const { return y < m_occupancy_grid.size() && x < m_occupancy_grid[y].size() && m_occupancy_grid[y][x]; }
 
     static bool is_table_row_group(Box const& box)
     {
@@ -82,20 +76,11 @@ public:
     }
 
 private:
-    size_t m_column_count { 0 };
-    HashMap<GridPosition, bool> m_occupancy_grid;
-};
-
-}
-
-namespace AK {
+    void set_occupied(size_t x, size_t y);
 
-template<>
-struct Traits<Web::Layout::TableGrid::GridPosition> : public DefaultTraits<Web::Layout::TableGrid::GridPosition> {
-    static unsigned hash(Web::Layout::TableGrid::GridPosition const& key)
-    {
-        return pair_int_hash(key.x, key.y);
-    }
+    size_t m_column_count { 0 };
+    // The slots that have a cell assigned to them, indexed by row and then by column.
+    Vector<Vector<bool>> m_occupancy_grid;
 };
 
 }
@@ -5,10 +5,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
 #include <AK/CharacterTypes.h>
 #include <AK/StringBuilder.h>
 #include <LibUnicode/CharacterTypes.h>
 #include <LibUnicode/Locale.h>
+#include <LibUnicode/Segmenter.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/Layout/BlockContainer.h>
 #include <LibWeb/Layout/InlineFormattingContext.h>
@@ -298,7 +300,7 @@ static Utf16String apply_text_transform(Utf16String const& string, CSS::TextTran
 void TextNode::invalidate_text_for_rendering()
 {
     m_text_for_rendering = {};
-    m_grapheme_segmenter.clear();
+    m_grapheme_boundaries.clear();
 }
 
 Utf16String const& TextNode::text_for_rendering() const
@@ -372,14 +374,52 @@ void TextNode::compute_text_for_rendering()
     m_text_for_rendering = builder.to_utf16_string();
 }
 
-Unicode::Segmenter& TextNode::grapheme_segmenter() const
+void TextNode::compute_grapheme_boundaries() const
 {
-    if (!m_grapheme_segmenter) {
-        m_grapheme_segmenter = document().grapheme_segmenter().clone();
-        m_grapheme_segmenter->set_segmented_text(text_for_rendering());
+    auto const& text = text_for_rendering();
+    auto length = text.length_in_code_units();
+
+    Vector<u64> boundaries;
+    boundaries.resize(ceil_div(length, static_cast<size_t>(64)));
+
+    auto set_boundary = [&](size_t index) {
+        if (index < length)
+            boundaries[index / 64] |= 1ull << (index % 64);
+    };
+
+    if (text.utf16_view().has_ascii_storage()) {
+        // OPTIMIZATION: Every ASCII character is a grapheme of its own, except for CR LF.
+        for (size_t index = 0; index < length; ++index) {
+            if (index == 0 || text.code_unit_at(index - 1) != '\r' || text.code_unit_at(index) != '\n')
+                set_boundary(index);
+        }
+    } else {
+        // NOTE: The document's segmenter is shared by all of its text nodes, as we only need it while computing these.
+        document().grapheme_segmenter().for_each_boundary(text.utf16_view(), [&](auto boundary) {
+            set_boundary(boundary);
+            return IterationDecision::Continue;
+        });
+    }
+
+    m_grapheme_boundaries = move(boundaries);
+}
+
+size_t TextNode::next_grapheme_boundary(size_t index) const
+{
+    if (!m_grapheme_boundaries.has_value())
+        compute_grapheme_boundaries();
+
+    auto length = text_for_rendering().length_in_code_units();
+    auto const& boundaries = *m_grapheme_boundaries;
+
+    for (auto next_index = index + 1; next_index < length;) {
+        auto word = boundaries[next_index / 64] >> (next_index % 64);
+        if (word != 0)
+            return min(next_index + count_trailing_zeroes(word), length);
+        next_index = (next_index / 64 + 1) * 64;
     }
 
-    return *m_grapheme_segmenter;
+    return length;
 }
 
 TextNode::ChunkIterator::ChunkIterator(TextNode const& text_node, bool wrap_lines, bool respect_linebreaks)
@@ -387,7 +427,7 @@ TextNode::ChunkIterator::ChunkIterator(TextNode const& text_node, bool wrap_line
     , m_respect_linebreaks(respect_linebreaks)
     , m_view(text_node.text_for_rendering())
     , m_font_cascade_list(text_node.computed_values().font_list())
-    , m_grapheme_segmenter(text_node.grapheme_segmenter())
+    , m_text_node(text_node)
 {
 }
 
@@ -460,7 +500,7 @@ Optional<TextNode::Chunk> TextNode::ChunkIterator::next_without_peek()
         return m_view.code_point_at(m_current_index);
     };
     auto next_grapheme_boundary = [this]() {
-        return m_grapheme_segmenter.next_boundary(m_current_index).value_or(m_view.length_in_code_units());
+        return m_text_node.next_grapheme_boundary(m_current_index);
     };
 
     auto code_point = current_code_point();
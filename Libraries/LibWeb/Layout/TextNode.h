@@ -9,7 +9,6 @@
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <LibGfx/TextLayout.h>
-#include <LibUnicode/Segmenter.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Layout/Node.h>
 
@@ -56,7 +55,7 @@ public:
         Utf16View m_view;
         Gfx::FontCascadeList const& m_font_cascade_list;
 
-        Unicode::Segmenter& m_grapheme_segmenter;
+        TextNode const& m_text_node;
         size_t m_current_index { 0 };
 
         Vector<Chunk> m_peek_queue;
@@ -64,7 +63,8 @@ public:
 
     void invalidate_text_for_rendering();
 
-    Unicode::Segmenter& grapheme_segmenter() const;
+    // Returns the first grapheme boundary after the given index in our text for rendering.
+    size_t next_grapheme_boundary(size_t index) const;
 
     virtual GC::Ptr<Painting::Paintable> create_paintable() const override;
 
@@ -72,9 +72,14 @@ private:
     virtual bool is_text_node() const final { return true; }
 
     void compute_text_for_rendering();
+    void compute_grapheme_boundaries() const;
 
     Optional<Utf16String> m_text_for_rendering;
-    mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
+
+    // One bit per code unit of our text for rendering, which is set if there is a grapheme boundary before it. The end
+    // of the text is always a boundary, so it isn't stored. These are computed once for the text, so that laying out the
+    // text again (e.g. at a different width) doesn't need to segment it again.
+    mutable Optional<Vector<u64>> m_grapheme_boundaries;
 };
 
 template<>
@@ -8,6 +8,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/TemporaryChange.h>
 #include <LibWeb/CSS/ComputedProperties.h>
@@ -608,6 +609,8 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
 
     if (dom_node.is_document()) {
         m_layout_root = layout_node;
+        if (should_create_layout_node)
+            m_rebuilt_subtree_roots.append(*layout_node);
     } else if (should_create_layout_node) {
         // Decide whether to replace an existing node (partial tree update) or insert a new one appropriately.
         bool const may_replace_existing_layout_node = must_create_subtree == MustCreateSubtree::No
@@ -621,15 +624,19 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         } else {
             insert_node_into_inline_or_block_ancestor(*layout_node, display, AppendOrPrepend::Append);
         }
+
+        // Everything below this node is created along with it, so the node covers its entire subtree.
+        if (must_create_subtree == MustCreateSubtree::No)
+            m_rebuilt_subtree_roots.append(*layout_node);
     }
 
     auto shadow_root = is<DOM::Element>(dom_node) ? as<DOM::Element>(dom_node).shadow_root() : nullptr;
 
-    auto element_has_content_visibility_hidden = [&dom_node]() {
-        if (is<DOM::Element>(dom_node)) {
-            auto& element = static_cast<DOM::Element&>(dom_node);
-            return element.computed_properties()->content_visibility() == CSS::ContentVisibility::Hidden;
-        }
+    // NOTE: Elements that skip their contents (because of content-visibility) get no layout children at all, which
+    //       also keeps their subtrees out of layout and painting.
+    auto element_skips_its_contents = [&dom_node]() {
+        if (auto* element = as_if<DOM::Element>(dom_node))
+            return element->skips_its_contents();
         return false;
     }();
 
@@ -642,11 +649,11 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             CSS::resolve_counters(element_reference);
         }
 
-        update_layout_tree_before_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_before_children(dom_node, *layout_node, context, element_skips_its_contents);
     }
 
     if (should_create_layout_node || dom_node.child_needs_layout_tree_update()) {
-        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_skips_its_contents) {
             push_parent(as<NodeWithStyle>(*layout_node));
             if (shadow_root) {
                 for (auto* node = shadow_root->first_child(); node; node = node->next_sibling()) {
@@ -682,7 +689,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     if (is<HTML::HTMLSlotElement>(dom_node)) {
         auto& slot_element = static_cast<HTML::HTMLSlotElement&>(dom_node);
 
-        if (slot_element.computed_properties()->content_visibility() != CSS::ContentVisibility::Hidden) {
+        if (!element_skips_its_contents) {
             auto slottables = slot_element.assigned_nodes_internal();
             push_parent(as<NodeWithStyle>(*layout_node));
 
@@ -699,7 +706,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 
     if (should_create_layout_node) {
-        update_layout_tree_after_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_after_children(dom_node, *layout_node, context, element_skips_its_contents);
         wrap_in_button_layout_tree_if_needed(dom_node, *layout_node);
 
         // If we completely finished inserting a block level element into an inline parent, we need to fix up the tree so
@@ -788,10 +795,10 @@ void TreeBuilder::wrap_in_button_layout_tree_if_needed(DOM::Node& dom_node, GC::
     }
 }
 
-void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_skips_its_contents)
 {
     // Add node for the ::before pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::Before, AppendOrPrepend::Prepend);
@@ -799,7 +806,7 @@ void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Re
     }
 }
 
-void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_skips_its_contents)
 {
     auto& document = dom_node.document();
     auto& style_computer = document.style_computer();
@@ -835,7 +842,7 @@ void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref
     }
 
     // Add nodes for the ::after pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::After, AppendOrPrepend::Append);
@@ -853,12 +860,57 @@ GC::Ptr<Layout::Node> TreeBuilder::build(DOM::Node& dom_node)
     m_quote_nesting_level = 0;
     update_layout_tree(dom_node, context, MustCreateSubtree::No);
 
-    if (auto* root = dom_node.document().layout_node())
-        fixup_tables(*root);
+    fixup_rebuilt_subtrees();
 
     return m_layout_root;
 }
 
+// The anonymous boxes generated by the table fixup only depend on a box and its children, so after a partial tree
+// update, we only need to fix up the subtrees that were rebuilt. We start from the nearest block ancestor of each
+// rebuilt subtree, as new boxes may need wrapping together with their siblings, and inline continuations may have
+// moved them around below that ancestor.
+static NodeWithStyle& nearest_table_fixup_root(Node& rebuilt_subtree_root)
+{
+    NodeWithStyle* fixup_root = nullptr;
+    for (auto* ancestor = rebuilt_subtree_root.parent(); ancestor; ancestor = ancestor->parent()) {
+        fixup_root = ancestor;
+        if (is<BlockContainer>(*ancestor) && !ancestor->display().is_contents() && !ancestor->is_anonymous())
+            break;
+    }
+    if (!fixup_root)
+        return as<NodeWithStyle>(rebuilt_subtree_root);
+    return *fixup_root;
+}
+
+void TreeBuilder::fixup_rebuilt_subtrees()
+{
+    HashTable<Node const*> fixup_roots;
+    Vector<GC::Ref<NodeWithStyle>> fixup_roots_in_order;
+    for (auto& rebuilt_subtree_root : m_rebuilt_subtree_roots) {
+        // Skip subtrees that have been removed from the layout tree again.
+        if (!rebuilt_subtree_root->parent() && rebuilt_subtree_root.ptr() != m_layout_root.ptr())
+            continue;
+
+        auto& fixup_root = nearest_table_fixup_root(*rebuilt_subtree_root);
+        if (fixup_roots.set(&fixup_root) == HashSetResult::InsertedNewEntry)
+            fixup_roots_in_order.append(fixup_root);
+    }
+    m_rebuilt_subtree_roots.clear();
+
+    for (auto& fixup_root : fixup_roots_in_order) {
+        // Subtrees below another fixup root will be fixed up along with it.
+        bool is_inside_other_fixup_root = false;
+        for (auto* ancestor = fixup_root->parent(); ancestor; ancestor = ancestor->parent()) {
+            if (fixup_roots.contains(ancestor)) {
+                is_inside_other_fixup_root = true;
+                break;
+            }
+        }
+        if (!is_inside_other_fixup_root)
+            fixup_tables(*fixup_root);
+    }
+}
+
 template<CSS::DisplayInternal internal, typename Callback>
 void TreeBuilder::for_each_in_tree_with_internal_display(NodeWithStyle& root, Callback callback)
 {
@@ -1138,7 +1190,7 @@ static void for_each_child_box_matching(Box& parent, Matcher matcher, Callback c
 static void fixup_row(Box& row_box, TableGrid const& table_grid, size_t row_index)
 {
     for (size_t column_index = 0; column_index < table_grid.column_count(); ++column_index) {
-        if (table_grid.occupancy_grid().contains({ column_index, row_index }))
+        if (table_grid.is_occupied(column_index, row_index))
             continue;
 
         auto computed_values = row_box.computed_values().clone_inherited_values();
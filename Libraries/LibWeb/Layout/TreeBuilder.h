@@ -29,8 +29,8 @@ private:
 
     i32 calculate_list_item_index(DOM::Node&);
 
-    void update_layout_tree_before_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_has_content_visibility_hidden);
-    void update_layout_tree_after_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_has_content_visibility_hidden);
+    void update_layout_tree_before_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_skips_its_contents);
+    void update_layout_tree_after_children(DOM::Node&, GC::Ref<Layout::Node>, Context&, bool element_skips_its_contents);
     void wrap_in_button_layout_tree_if_needed(DOM::Node&, GC::Ref<Layout::Node>);
     enum class MustCreateSubtree {
         No,
@@ -47,6 +47,7 @@ private:
     template<CSS::DisplayInside, typename Callback>
     void for_each_in_tree_with_inside_display(NodeWithStyle& root, Callback);
 
+    void fixup_rebuilt_subtrees();
     void fixup_tables(NodeWithStyle& root);
     void remove_irrelevant_boxes(NodeWithStyle& root);
     void generate_missing_child_wrappers(NodeWithStyle& root);
@@ -63,6 +64,7 @@ private:
 
     GC::Ptr<Layout::Node> m_layout_root;
     Vector<GC::Ref<Layout::NodeWithStyle>> m_ancestor_stack;
+    Vector<GC::Root<Layout::Node>> m_rebuilt_subtree_roots;
 
     u32 m_quote_nesting_level { 0 };
 };
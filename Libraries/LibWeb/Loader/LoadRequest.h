@@ -13,6 +13,7 @@
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <RequestServer/RequestPriority.h>
 
 namespace Web {
 
@@ -40,6 +41,9 @@ public:
     ByteBuffer const& body() const { return m_body; }
     void set_body(ByteBuffer body) { m_body = move(body); }
 
+    RequestServer::RequestPriority priority() const { return m_priority; }
+    void set_priority(RequestServer::RequestPriority priority) { m_priority = priority; }
+
     void start_timer() { m_load_timer.start(); }
     AK::Duration load_time() const { return m_load_timer.elapsed_time(); }
 
@@ -80,6 +84,7 @@ private:
     ByteString m_method { "GET" };
     HashMap<ByteString, ByteString, CaseInsensitiveStringTraits> m_headers;
     ByteBuffer m_body;
+    RequestServer::RequestPriority m_priority { RequestServer::RequestPriority::Medium };
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
     bool m_main_resource { false };
@@ -552,7 +552,7 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         return nullptr;
     }
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy, request.priority());
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
@@ -567,6 +567,10 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         on_load_counter_change();
 
     m_active_requests.set(*protocol_request);
+
+    if (auto page = request.page())
+        page->did_start_network_request(request.url().value());
+
     return protocol_request;
 }
 
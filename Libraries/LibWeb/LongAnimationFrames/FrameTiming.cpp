@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <LibGC/Heap.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
+#include <LibWeb/LongAnimationFrames/FrameTiming.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#record-task-start-time
+void record_task_start_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp task_start_time)
+{
+    // 1. If document's current frame timing info is null, set it to a new frame timing info whose start time is taskStartTime.
+    auto& timing_info = document.current_frame_timing_info();
+    if (!timing_info.has_value()) {
+        timing_info = FrameTimingInfo {
+            .start_time = task_start_time,
+            .garbage_collection_time_at_start = document.heap().total_garbage_collection_time(),
+        };
+    }
+
+    // 2. Set document's current frame timing info's current task start time to taskStartTime.
+    timing_info->current_task_start_time = task_start_time;
+}
+
+// https://w3c.github.io/long-animation-frames/#record-task-end-time
+void record_task_end_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp task_end_time, bool rendering_update_pending)
+{
+    // 1. Let timingInfo be document's current frame timing info.
+    auto& timing_info = document.current_frame_timing_info();
+
+    // 2. If timingInfo is null, then return.
+    if (!timing_info.has_value())
+        return;
+
+    // 3. Append the duration between timingInfo's current task start time and taskEndTime to timingInfo's task durations.
+    timing_info->task_durations.append(task_end_time - timing_info->current_task_start_time);
+
+    // 4. If the user agent believes that updating the rendering of document's node navigable would have no visible
+    //    effect, then:
+    if (!rendering_update_pending) {
+        // 1. Set timingInfo's end time to taskEndTime.
+        timing_info->end_time = task_end_time;
+
+        // 2. Flush frame timing given document.
+        flush_frame_timing(document);
+    }
+}
+
+// NOTE: This marks the beginning of the rendering update, so that a frame which was not started by a task still has a
+//       frame timing info that covers it.
+void record_rendering_start_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp rendering_start_time)
+{
+    auto& timing_info = document.current_frame_timing_info();
+    if (!timing_info.has_value()) {
+        timing_info = FrameTimingInfo {
+            .start_time = rendering_start_time,
+            .garbage_collection_time_at_start = document.heap().total_garbage_collection_time(),
+        };
+    }
+
+    timing_info->update_the_rendering_start_time = rendering_start_time;
+}
+
+// https://w3c.github.io/long-animation-frames/#record-rendering-time
+void record_rendering_time(DOM::Document& document, HighResolutionTime::DOMHighResTimeStamp unsafe_style_and_layout_start_time)
+{
+    // 1. Let timingInfo be document's current frame timing info.
+    auto& timing_info = document.current_frame_timing_info();
+
+    // 2. If timingInfo is null, then return.
+    if (!timing_info.has_value())
+        return;
+
+    // 3. Set timingInfo's style and layout start time to unsafeStyleAndLayoutStartTime.
+    timing_info->style_and_layout_start_time = unsafe_style_and_layout_start_time;
+}
+
+// https://w3c.github.io/long-animation-frames/#flush-frame-timing
+void flush_frame_timing(DOM::Document& document)
+{
+    // 1. Let timingInfo be document's current frame timing info.
+    // 2. Set document's current frame timing info to null.
+    auto maybe_timing_info = exchange(document.current_frame_timing_info(), {});
+
+    // 3. If timingInfo is null, then return.
+    if (!maybe_timing_info.has_value())
+        return;
+    auto& timing_info = *maybe_timing_info;
+
+    // 4. If timingInfo's end time is 0, set it to the unsafe shared current time.
+    if (timing_info.end_time == 0)
+        timing_info.end_time = HighResolutionTime::unsafe_shared_current_time();
+
+    // 5. If the duration between timingInfo's start time and end time is less than the long animation frame duration
+    //    threshold, then return.
+    auto duration = timing_info.end_time - timing_info.start_time;
+    if (duration < long_animation_frame_duration_threshold)
+        return;
+
+    // 6. Let global be document's relevant global object.
+    auto& global = HTML::relevant_global_object(document);
+
+    // 7. Let blockingDuration be 0.
+    HighResolutionTime::DOMHighResTimeStamp blocking_duration = 0;
+
+    // 8. If timingInfo's update the rendering start time is not 0, then add the duration of the rendering update to the
+    //    longest of timingInfo's task durations, as the rendering update blocks the frame in the same way.
+    if (timing_info.update_the_rendering_start_time != 0) {
+        auto render_duration = timing_info.end_time - timing_info.update_the_rendering_start_time;
+        if (timing_info.task_durations.is_empty()) {
+            timing_info.task_durations.append(render_duration);
+        } else {
+            auto* longest_task_duration = &timing_info.task_durations.first();
+            for (auto& task_duration : timing_info.task_durations) {
+                if (task_duration > *longest_task_duration)
+                    longest_task_duration = &task_duration;
+            }
+            *longest_task_duration += render_duration;
+        }
+    }
+
+    // 9. For each duration of timingInfo's task durations, if duration is greater than the long animation frame duration
+    //    threshold, add the difference between them to blockingDuration.
+    for (auto task_duration : timing_info.task_durations) {
+        if (task_duration > long_animation_frame_duration_threshold)
+            blocking_duration += task_duration - long_animation_frame_duration_threshold;
+    }
+
+    auto relative_time = [&](HighResolutionTime::DOMHighResTimeStamp time) -> HighResolutionTime::DOMHighResTimeStamp {
+        if (time == 0)
+            return 0;
+        return HighResolutionTime::relative_high_resolution_time(time, global);
+    };
+
+    auto garbage_collection_time = document.heap().total_garbage_collection_time() - timing_info.garbage_collection_time_at_start;
+    dbgln_if(LIBWEB_LONG_ANIMATION_FRAME_DEBUG, "Long animation frame in {}: {:.3}ms ({} tasks, {:.3}ms blocking), rAF callbacks {:.3}ms, style and layout {:.3}ms, paint {:.3}ms, GC {:.3}ms",
+        document.url(), duration, timing_info.task_durations.size(), blocking_duration,
+        timing_info.animation_frame_callbacks_duration, timing_info.style_and_layout_duration, timing_info.paint_duration,
+        garbage_collection_time.to_nanoseconds() / 1'000'000.0);
+
+    // 10. Let entry be a new PerformanceLongAnimationFrameTiming in global's realm, with its start time set to the
+    //    relative high resolution time given timingInfo's start time and global, its duration set to the duration between
+    //    timingInfo's start time and end time, and its render start, style and layout start, first UI event timestamp and
+    //    blocking duration set accordingly.
+    auto& realm = document.realm();
+    auto entry = realm.create<PerformanceLongAnimationFrameTiming>(realm,
+        relative_time(timing_info.start_time),
+        duration,
+        relative_time(timing_info.update_the_rendering_start_time),
+        relative_time(timing_info.style_and_layout_start_time),
+        relative_time(timing_info.first_ui_event_timestamp),
+        blocking_duration);
+
+    // 11. Queue entry.
+    as<HTML::Window>(global).queue_performance_entry(entry);
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HighResolutionTime/DOMHighResTimeStamp.h>
+
+namespace Web::LongAnimationFrames {
+
+// https://w3c.github.io/long-animation-frames/#frame-timing-info
+struct FrameTimingInfo {
+    HighResolutionTime::DOMHighResTimeStamp start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp current_task_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp update_the_rendering_start_time { 0 };
+    HighResolutionTime::DOMHighResTimeStamp style_and_layout_start_time { 0 };
+    // FIXME: Set this when the first UI event of the frame is dispatched.
+    HighResolutionTime::DOMHighResTimeStamp first_ui_event_timestamp { 0 };
+    HighResolutionTime::DOMHighResTimeStamp end_time { 0 };
+    Vector<HighResolutionTime::DOMHighResTimeStamp> task_durations;
+
+    // NOTE: These are not part of the spec. They break the rendering update down into its phases, so that long frames
+    //       can be attributed to what made them long.
+    HighResolutionTime::DOMHighResTimeStamp animation_frame_callbacks_duration { 0 };
+    HighResolutionTime::DOMHighResTimeStamp style_and_layout_duration { 0 };
+    HighResolutionTime::DOMHighResTimeStamp paint_duration { 0 };
+    AK::Duration garbage_collection_time_at_start;
+};
+
+// https://w3c.github.io/long-animation-frames/#long-animation-frame-duration-threshold
+constexpr HighResolutionTime::DOMHighResTimeStamp long_animation_frame_duration_threshold = 50;
+
+void record_task_start_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp task_start_time);
+void record_task_end_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp task_end_time, bool rendering_update_pending);
+void record_rendering_start_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp rendering_start_time);
+void record_rendering_time(DOM::Document&, HighResolutionTime::DOMHighResTimeStamp unsafe_style_and_layout_start_time);
+void flush_frame_timing(DOM::Document&);
+
+}
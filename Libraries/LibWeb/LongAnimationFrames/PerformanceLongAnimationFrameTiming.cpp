@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PerformanceLongAnimationFrameTimingPrototype.h>
+#include <LibWeb/LongAnimationFrames/PerformanceLongAnimationFrameTiming.h>
+#include <LibWeb/PerformanceTimeline/EntryTypes.h>
+
+namespace Web::LongAnimationFrames {
+
+GC_DEFINE_ALLOCATOR(PerformanceLongAnimationFrameTiming);
+
+// https://w3c.github.io/long-animation-frames/#sec-PerformanceLongAnimationFrameTiming
+// The name attribute's getter step is to return "same-origin-descendant".
+PerformanceLongAnimationFrameTiming::PerformanceLongAnimationFrameTiming(JS::Realm& realm, HighResolutionTime::DOMHighResTimeStamp start_time, HighResolutionTime::DOMHighResTimeStamp duration, HighResolutionTime::DOMHighResTimeStamp render_start, HighResolutionTime::DOMHighResTimeStamp style_and_layout_start, HighResolutionTime::DOMHighResTimeStamp first_ui_event_timestamp, HighResolutionTime::DOMHighResTimeStamp blocking_duration)
+    : PerformanceTimeline::PerformanceEntry(realm, "same-origin-descendant"_string, start_time, duration)
+    , m_render_start(render_start)
+    , m_style_and_layout_start(style_and_layout_start)
+    , m_first_ui_event_timestamp(first_ui_event_timestamp)
+    , m_blocking_duration(blocking_duration)
+{
+}
+
+PerformanceLongAnimationFrameTiming::~PerformanceLongAnimationFrameTiming() = default;
+
+FlyString const& PerformanceLongAnimationFrameTiming::entry_type() const
+{
+    return PerformanceTimeline::EntryTypes::long_animation_frame;
+}
+
+void PerformanceLongAnimationFrameTiming::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(PerformanceLongAnimationFrameTiming);
+    Base::initialize(realm);
+}
+
+}
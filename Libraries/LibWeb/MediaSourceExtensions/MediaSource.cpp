@@ -6,9 +6,16 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/MediaSourcePrototype.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/MediaSourceExtensions/EventNames.h>
+#include <LibWeb/MediaSourceExtensions/ManagedMediaSource.h>
+#include <LibWeb/MediaSourceExtensions/ManagedSourceBuffer.h>
 #include <LibWeb/MediaSourceExtensions/MediaSource.h>
+#include <LibWeb/MediaSourceExtensions/SourceBuffer.h>
+#include <LibWeb/MediaSourceExtensions/SourceBufferList.h>
 #include <LibWeb/MimeSniff/MimeType.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::MediaSourceExtensions {
 
@@ -30,6 +37,66 @@ void MediaSource::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(MediaSource);
     Base::initialize(realm);
+
+    m_source_buffers = realm.create<SourceBufferList>(realm);
+    m_active_source_buffers = realm.create<SourceBufferList>(realm);
+}
+
+void MediaSource::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_source_buffers);
+    visitor.visit(m_active_source_buffers);
+}
+
+// https://w3c.github.io/media-source/#dom-mediasource-addsourcebuffer
+WebIDL::ExceptionOr<GC::Ref<SourceBuffer>> MediaSource::add_source_buffer(String const& type)
+{
+    auto& realm = this->realm();
+
+    // 1. If type is an empty string then throw a TypeError exception and abort these steps.
+    if (type.is_empty())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "SourceBuffer type must not be empty"sv };
+
+    // 2. If type contains a MIME type that is not supported or contains a MIME type that is not supported with the
+    //    types specified for the other SourceBuffer objects in sourceBuffers, then throw a NotSupportedError exception
+    //    and abort these steps.
+    // AD-HOC: Appended data is parsed by our own byte stream parser, which only supports the WebM byte stream format.
+    auto mime_type = MimeSniff::MimeType::parse(type);
+    if (!is_type_supported(vm(), type) || !mime_type.has_value() || !mime_type->essence().is_one_of("video/webm"sv, "audio/webm"sv))
+        return WebIDL::NotSupportedError::create(realm, Utf16String::formatted("SourceBuffer type '{}' is not supported", type));
+
+    // FIXME: 3. If the user agent can't handle any more SourceBuffer objects or if creating a SourceBuffer based on type
+    //           would result in an unsupported SourceBuffer configuration, then throw a QuotaExceededError exception
+    //           and abort these steps.
+
+    // 4. If the readyState attribute is not in the "open" state then throw an InvalidStateError exception and abort
+    //    these steps.
+    if (m_ready_state != Bindings::ReadyState::Open)
+        return WebIDL::InvalidStateError::create(realm, "MediaSource is not open"_utf16);
+
+    // 5. If this is a ManagedMediaSource, then let buffer be a ManagedSourceBuffer; otherwise, let buffer be a
+    //    SourceBuffer.
+    // NOTE: The buffer's parent media source is set to this on construction.
+    GC::Ref<SourceBuffer> buffer = is<ManagedMediaSource>(*this)
+        ? GC::Ref<SourceBuffer> { realm.create<ManagedSourceBuffer>(realm, *this) }
+        : realm.create<SourceBuffer>(realm, *this);
+
+    // FIXME: 6. Set buffer's [[generate timestamps flag]] to the value in the "Generate Timestamps Flag" column of the
+    //           Media Source Extensions™ Byte Stream Format Registry entry that is associated with type.
+    // FIXME: 7. If buffer's [[generate timestamps flag]] is true, set buffer's mode to "sequence". Otherwise, set
+    //           buffer's mode to "segments".
+
+    // 8. Append buffer to this's sourceBuffers.
+    m_source_buffers->add_source_buffer({}, buffer);
+
+    // 9. Queue a task to fire an event named addsourcebuffer at this's sourceBuffers.
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [source_buffers = GC::Ref { *m_source_buffers }] {
+        source_buffers->dispatch_event(DOM::Event::create(source_buffers->realm(), EventNames::addsourcebuffer));
+    }));
+
+    // 10. Return buffer.
+    return buffer;
 }
 
 // https://w3c.github.io/media-source/#dom-mediasource-onsourceopen
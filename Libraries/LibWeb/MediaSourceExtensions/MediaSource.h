@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <LibWeb/Bindings/MediaSourcePrototype.h>
 #include <LibWeb/DOM/EventTarget.h>
 
 namespace Web::MediaSourceExtensions {
@@ -21,6 +22,17 @@ public:
     // https://w3c.github.io/media-source/#dom-mediasource-canconstructindedicatedworker
     static bool can_construct_in_dedicated_worker(JS::VM&) { return true; }
 
+    // https://w3c.github.io/media-source/#dom-mediasource-sourcebuffers
+    GC::Ref<SourceBufferList> source_buffers() const { return *m_source_buffers; }
+
+    // https://w3c.github.io/media-source/#dom-mediasource-activesourcebuffers
+    GC::Ref<SourceBufferList> active_source_buffers() const { return *m_active_source_buffers; }
+
+    // https://w3c.github.io/media-source/#dom-mediasource-readystate
+    Bindings::ReadyState ready_state() const { return m_ready_state; }
+
+    WebIDL::ExceptionOr<GC::Ref<SourceBuffer>> add_source_buffer(String const& type);
+
     void set_onsourceopen(GC::Ptr<WebIDL::CallbackType>);
     GC::Ptr<WebIDL::CallbackType> onsourceopen();
 
@@ -38,8 +50,14 @@ protected:
     virtual ~MediaSource() override;
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
 
 private:
+    GC::Ptr<SourceBufferList> m_source_buffers;
+    GC::Ptr<SourceBufferList> m_active_source_buffers;
+
+    // FIXME: This only changes once a MediaSource can be attached to a media element.
+    Bindings::ReadyState m_ready_state { Bindings::ReadyState::Closed };
 };
 
 }
@@ -4,17 +4,26 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SourceBufferPrototype.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/TimeRanges.h>
 #include <LibWeb/MediaSourceExtensions/EventNames.h>
+#include <LibWeb/MediaSourceExtensions/MediaSource.h>
 #include <LibWeb/MediaSourceExtensions/SourceBuffer.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::MediaSourceExtensions {
 
 GC_DEFINE_ALLOCATOR(SourceBuffer);
 
-SourceBuffer::SourceBuffer(JS::Realm& realm)
+SourceBuffer::SourceBuffer(JS::Realm& realm, MediaSource& media_source)
     : DOM::EventTarget(realm)
+    , m_media_source(media_source)
+    , m_processor(SourceBufferProcessor::create())
 {
 }
 
@@ -26,6 +35,154 @@ void SourceBuffer::initialize(JS::Realm& realm)
     Base::initialize(realm);
 }
 
+void SourceBuffer::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_media_source);
+}
+
+// https://w3c.github.io/media-source/#dom-sourcebuffer-buffered
+WebIDL::ExceptionOr<GC::Ref<HTML::TimeRanges>> SourceBuffer::buffered() const
+{
+    auto& realm = this->realm();
+
+    // 1. If this object has been removed from the sourceBuffers attribute of the parent media source then throw an
+    //    InvalidStateError exception and abort these steps.
+    if (!m_media_source)
+        return WebIDL::InvalidStateError::create(realm, "SourceBuffer has been removed from its MediaSource"_utf16);
+
+    // 2-5. Compute the intersection of the track buffer ranges.
+    // NOTE: This is done by the buffer append algorithm whenever the track buffers change, so we only need to return the
+    //       result of the last append here.
+    auto time_ranges = realm.create<HTML::TimeRanges>(realm);
+    for (auto const& range : m_buffered_ranges)
+        time_ranges->add_range(static_cast<double>(range.start.to_milliseconds()) / 1000.0, static_cast<double>(range.end.to_milliseconds()) / 1000.0);
+
+    // 6. Return the current value of this attribute.
+    return time_ranges;
+}
+
+// https://w3c.github.io/media-source/#dom-sourcebuffer-appendbuffer
+WebIDL::ExceptionOr<void> SourceBuffer::append_buffer(GC::Root<WebIDL::BufferSource> const& data)
+{
+    // 1. Run the prepare append algorithm.
+    TRY(prepare_append());
+
+    // 2. Add data to the end of the [[input buffer]].
+    // NOTE: The data is copied once here, as the page is free to modify its buffer as soon as this returns. The byte
+    //       stream parser then refers into this copy rather than copying the coded frames out of it.
+    auto bytes = TRY_OR_THROW_OOM(vm(), WebIDL::get_buffer_source_copy(*data->raw_object()));
+
+    // 3. Set the updating attribute to true.
+    m_updating = true;
+
+    // 4. Queue a task to fire an event named updatestart at this SourceBuffer object.
+    queue_event(EventNames::updatestart);
+
+    // 5. Asynchronously run the buffer append algorithm.
+    run_buffer_append_algorithm(move(bytes));
+    return {};
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-prepare-append
+WebIDL::ExceptionOr<void> SourceBuffer::prepare_append()
+{
+    auto& realm = this->realm();
+
+    // 1. If the SourceBuffer has been removed from the sourceBuffers attribute of the parent media source then throw
+    //    an InvalidStateError exception and abort these steps.
+    if (!m_media_source)
+        return WebIDL::InvalidStateError::create(realm, "SourceBuffer has been removed from its MediaSource"_utf16);
+
+    // 2. If the updating attribute equals true, then throw an InvalidStateError exception and abort these steps.
+    if (m_updating)
+        return WebIDL::InvalidStateError::create(realm, "SourceBuffer is already updating"_utf16);
+
+    // FIXME: 3. Let recent element error be determined as follows: If the MediaSource was constructed in a Window, let
+    //           recent element error be true if the HTMLMediaElement's error attribute is not null.
+    // FIXME: 4. If recent element error is true, then throw an InvalidStateError exception and abort these steps.
+    // FIXME: 5. If the readyState attribute of the parent media source is in the "ended" state then run the following
+    //           steps:
+    //           1. Set the readyState attribute of the parent media source to "open"
+    //           2. Queue a task to fire an event named sourceopen at the parent media source.
+
+    // 6. Run the coded frame eviction algorithm.
+    // NOTE: This is run by the buffer append algorithm after each append, see SourceBufferProcessor.
+
+    // 7. If the [[buffer full flag]] equals true, then throw a QuotaExceededError exception and abort these steps.
+    if (m_buffer_full)
+        return WebIDL::QuotaExceededError::create(realm, "SourceBuffer is full"_utf16);
+
+    return {};
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-buffer-append
+void SourceBuffer::run_buffer_append_algorithm(ByteBuffer bytes)
+{
+    // NOTE: Parsing the appended segments and updating the track buffers happens on a background thread, as players
+    //       routinely append several megabytes at a time. The results are brought back to the main thread in a task.
+    using AppendJob = Threading::BackgroundAction<SourceBufferProcessor::AppendResult>;
+    AppendJob::construct(
+        [processor = m_processor, bytes = move(bytes)](auto&) mutable -> ErrorOr<SourceBufferProcessor::AppendResult> {
+            // 1. Run the segment parser loop algorithm.
+            return processor->run_segment_parser_loop(move(bytes));
+        },
+        [source_buffer = GC::make_root(*this)](SourceBufferProcessor::AppendResult result) mutable -> ErrorOr<void> {
+            // NOTE: The job may be destroyed on the background thread, so we make sure that nothing that must only be
+            //       touched on the main thread outlives this callback.
+            auto strong_source_buffer = move(source_buffer);
+            auto& realm = strong_source_buffer->realm();
+
+            HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [source_buffer = GC::Ref { *strong_source_buffer }, result = move(result)]() mutable {
+                // 2. If the segment parser loop algorithm in the previous step was aborted, then abort this algorithm.
+                if (result.append_error) {
+                    source_buffer->run_append_error_algorithm();
+                    return;
+                }
+
+                source_buffer->m_buffered_ranges = move(result.buffered_ranges);
+                source_buffer->m_buffer_full = result.buffer_full;
+
+                // 3. Set the updating attribute to false.
+                source_buffer->m_updating = false;
+
+                // 4. Queue a task to fire an event named update at this SourceBuffer object.
+                source_buffer->queue_event(EventNames::update);
+
+                // 5. Queue a task to fire an event named updateend at this SourceBuffer object.
+                source_buffer->queue_event(EventNames::updateend);
+            }));
+
+            return {};
+        });
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-append-error
+void SourceBuffer::run_append_error_algorithm()
+{
+    // 1. Run the reset parser state algorithm.
+    // NOTE: This has already been run by the segment parser loop, on the background thread.
+
+    // 2. Set the updating attribute to false.
+    m_updating = false;
+
+    // 3. Queue a task to fire an event named error at this SourceBuffer object.
+    queue_event(EventNames::error);
+
+    // 4. Queue a task to fire an event named updateend at this SourceBuffer object.
+    queue_event(EventNames::updateend);
+
+    // FIXME: 5. Run the end of stream algorithm with the error parameter set to "decode".
+}
+
+void SourceBuffer::queue_event(FlyString const& name)
+{
+    auto& realm = this->realm();
+    HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [this, name] {
+        dispatch_event(DOM::Event::create(this->realm(), name));
+    }));
+}
+
 // https://w3c.github.io/media-source/#dom-sourcebuffer-onupdatestart
 void SourceBuffer::set_onupdatestart(GC::Ptr<WebIDL::CallbackType> event_handler)
 {
@@ -7,6 +7,8 @@
 #pragma once
 
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/MediaSourceExtensions/SourceBufferProcessor.h>
+#include <LibWeb/WebIDL/Buffers.h>
 
 namespace Web::MediaSourceExtensions {
 
@@ -16,6 +18,11 @@ class SourceBuffer : public DOM::EventTarget {
     GC_DECLARE_ALLOCATOR(SourceBuffer);
 
 public:
+    bool updating() const { return m_updating; }
+    WebIDL::ExceptionOr<GC::Ref<HTML::TimeRanges>> buffered() const;
+
+    WebIDL::ExceptionOr<void> append_buffer(GC::Root<WebIDL::BufferSource> const&);
+
     void set_onupdatestart(GC::Ptr<WebIDL::CallbackType>);
     GC::Ptr<WebIDL::CallbackType> onupdatestart();
 
@@ -32,13 +39,34 @@ public:
     GC::Ptr<WebIDL::CallbackType> onabort();
 
 protected:
-    SourceBuffer(JS::Realm&);
+    SourceBuffer(JS::Realm&, MediaSource&);
 
     virtual ~SourceBuffer() override;
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
 
 private:
+    WebIDL::ExceptionOr<void> prepare_append();
+    void run_buffer_append_algorithm(ByteBuffer);
+    void run_append_error_algorithm();
+    void queue_event(FlyString const& name);
+
+    // https://w3c.github.io/media-source/#parent-media-source
+    GC::Ptr<MediaSource> m_media_source;
+
+    // NOTE: The byte stream parser and the track buffers live here, and are only touched by the buffer append
+    //       algorithm on a background thread.
+    NonnullRefPtr<SourceBufferProcessor> m_processor;
+
+    // https://w3c.github.io/media-source/#dom-sourcebuffer-updating
+    bool m_updating { false };
+
+    // https://w3c.github.io/media-source/#sourcebuffer-buffer-full-flag
+    bool m_buffer_full { false };
+
+    // The buffered ranges of the track buffers, as of the last completed append.
+    Vector<SourceBufferProcessor::TimeRange> m_buffered_ranges;
 };
 
 }
@@ -7,6 +7,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SourceBufferListPrototype.h>
 #include <LibWeb/MediaSourceExtensions/EventNames.h>
+#include <LibWeb/MediaSourceExtensions/SourceBuffer.h>
 #include <LibWeb/MediaSourceExtensions/SourceBufferList.h>
 
 namespace Web::MediaSourceExtensions {
@@ -14,7 +15,7 @@ namespace Web::MediaSourceExtensions {
 GC_DEFINE_ALLOCATOR(SourceBufferList);
 
 SourceBufferList::SourceBufferList(JS::Realm& realm)
-    : DOM::EventTarget(realm)
+    : DOM::EventTarget(realm, MayInterfereWithIndexedPropertyAccess::Yes)
 {
 }
 
@@ -26,6 +27,33 @@ void SourceBufferList::initialize(JS::Realm& realm)
     Base::initialize(realm);
 }
 
+void SourceBufferList::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_source_buffers);
+}
+
+// https://w3c.github.io/media-source/#dfn-sourcebufferlist-getter
+JS::ThrowCompletionOr<Optional<JS::PropertyDescriptor>> SourceBufferList::internal_get_own_property(JS::PropertyKey const& property_name) const
+{
+    // Allows the SourceBuffer objects in the list to be accessed with an array operator (i.e., []).
+    if (property_name.is_number()) {
+        if (auto index = property_name.as_number(); index < m_source_buffers.size()) {
+            JS::PropertyDescriptor descriptor;
+            descriptor.value = m_source_buffers.at(index);
+
+            return descriptor;
+        }
+    }
+
+    return Base::internal_get_own_property(property_name);
+}
+
+void SourceBufferList::add_source_buffer(Badge<MediaSource>, GC::Ref<SourceBuffer> source_buffer)
+{
+    m_source_buffers.append(source_buffer);
+}
+
 // https://w3c.github.io/media-source/#dom-sourcebufferlist-onaddsourcebuffer
 void SourceBufferList::set_onaddsourcebuffer(GC::Ptr<WebIDL::CallbackType> event_handler)
 {
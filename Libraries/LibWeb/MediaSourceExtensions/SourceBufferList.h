@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <LibWeb/DOM/EventTarget.h>
 
 namespace Web::MediaSourceExtensions {
@@ -16,6 +17,11 @@ class SourceBufferList : public DOM::EventTarget {
     GC_DECLARE_ALLOCATOR(SourceBufferList);
 
 public:
+    void add_source_buffer(Badge<MediaSource>, GC::Ref<SourceBuffer>);
+
+    // https://w3c.github.io/media-source/#dom-sourcebufferlist-length
+    size_t length() const { return m_source_buffers.size(); }
+
     void set_onaddsourcebuffer(GC::Ptr<WebIDL::CallbackType>);
     GC::Ptr<WebIDL::CallbackType> onaddsourcebuffer();
 
@@ -28,6 +34,10 @@ private:
     virtual ~SourceBufferList() override;
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual JS::ThrowCompletionOr<Optional<JS::PropertyDescriptor>> internal_get_own_property(JS::PropertyKey const& property_name) const override;
+
+    Vector<GC::Ref<SourceBuffer>> m_source_buffers;
 };
 
 }
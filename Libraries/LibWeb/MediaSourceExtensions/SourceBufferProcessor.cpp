@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/MediaSourceExtensions/SourceBufferProcessor.h>
+
+namespace Web::MediaSourceExtensions {
+
+using Media::Matroska::CodedFrame;
+using Media::Matroska::TrackEntry;
+
+// Bounds the memory used by the coded frames of a single SourceBuffer. Once this is exceeded, the oldest coded frames
+// are evicted, and if that is not enough, the next append fails with a QuotaExceededError.
+static constexpr size_t MAXIMUM_BUFFERED_BYTES = 150 * MiB;
+
+NonnullRefPtr<SourceBufferProcessor> SourceBufferProcessor::create()
+{
+    return adopt_ref(*new SourceBufferProcessor);
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-segment-parser-loop
+SourceBufferProcessor::AppendResult SourceBufferProcessor::run_segment_parser_loop(ByteBuffer&& data)
+{
+    Threading::MutexLocker locker(m_mutex);
+    AppendResult result;
+
+    auto parsed_data_or_error = m_parser.append(move(data));
+
+    // If the [[input buffer]] contains bytes that violate the SourceBuffer byte stream format specification, then run
+    // the append error algorithm and abort this algorithm.
+    if (parsed_data_or_error.is_error()) {
+        dbgln("SourceBuffer: Failed to parse appended data: {}", parsed_data_or_error.error().description());
+
+        // NOTE: The append error algorithm starts by running the reset parser state algorithm, which we do here, so that
+        //       the main thread doesn't have to come back to the parser.
+        m_parser.reset();
+        result.append_error = true;
+        return result;
+    }
+    auto parsed_data = parsed_data_or_error.release_value();
+
+    // If the [[input buffer]] contains one or more complete initialization segments, then run the initialization
+    // segment received algorithm.
+    if (parsed_data.initialization_segment.has_value() && !process_initialization_segment(*parsed_data.initialization_segment)) {
+        m_parser.reset();
+        result.append_error = true;
+        return result;
+    }
+
+    // If the [[input buffer]] contains one or more complete coded frames, then run the coded frame processing algorithm.
+    process_coded_frames(move(parsed_data.coded_frames));
+
+    // https://w3c.github.io/media-source/#sourcebuffer-coded-frame-eviction
+    // NOTE: The spec runs coded frame eviction as part of preparing the next append. We run it here instead, as the
+    //       track buffers are only available to this thread, and the main thread only needs to know whether the buffer
+    //       is still full.
+    if (m_buffered_byte_count > MAXIMUM_BUFFERED_BYTES)
+        evict_coded_frames();
+
+    result.buffered_ranges = buffered_ranges();
+    result.buffer_full = m_buffered_byte_count > MAXIMUM_BUFFERED_BYTES;
+    return result;
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-reset-parser-state
+void SourceBufferProcessor::reset_parser_state()
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    // 7. Remove all bytes from the [[input buffer]].
+    m_parser.reset();
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-init-segment-received
+bool SourceBufferProcessor::process_initialization_segment(Media::Matroska::ByteStreamParser::InitializationSegment const& initialization_segment)
+{
+    Vector<u64> track_numbers;
+    for (auto const& track : initialization_segment.tracks) {
+        if (track->track_type() == TrackEntry::TrackType::Video || track->track_type() == TrackEntry::TrackType::Audio)
+            track_numbers.append(track->track_number());
+    }
+
+    // FIXME: 1. Update the duration attribute if it currently equals NaN.
+
+    // 2. If the initialization segment has no audio, video, or text tracks, then run the append error algorithm and
+    //    abort these steps.
+    if (track_numbers.is_empty())
+        return false;
+
+    // 3. If the [[first initialization segment received flag]] is true, then run the following steps:
+    if (m_first_initialization_segment_received) {
+        // 1. Verify the following properties. If any of the checks fail then run the append error algorithm and abort
+        //    these steps.
+        //    - The number of audio, video, and text tracks match what was in the first initialization segment.
+        //    - If more than one track for a single type are present, then the Track IDs match the ones in the first
+        //      initialization segment.
+        // FIXME: - The codecs for each track are supported by the user agent.
+        if (track_numbers.size() != m_track_buffers.size())
+            return false;
+        for (auto track_number : track_numbers) {
+            if (!m_track_buffers.contains(track_number))
+                return false;
+        }
+        return true;
+    }
+
+    // 5. If the [[first initialization segment received flag]] is false, then run the following steps:
+    // NOTE: Of these, we only create the track buffers here. The audio and video tracks are not exposed yet.
+    for (auto track_number : track_numbers)
+        m_track_buffers.set(track_number, {});
+
+    // 6. Set [[first initialization segment received flag]] to true.
+    m_first_initialization_segment_received = true;
+    return true;
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-coded-frame-processing
+void SourceBufferProcessor::process_coded_frames(Vector<CodedFrame>&& coded_frames)
+{
+    for (auto& coded_frame : coded_frames) {
+        auto track_buffer = m_track_buffers.find(coded_frame.track_number);
+        if (track_buffer == m_track_buffers.end())
+            continue;
+        auto& frames = track_buffer->value.coded_frames;
+
+        // NOTE: Coded frames are almost always appended in presentation order, so search for the insertion point from
+        //       the end of the track buffer.
+        auto index = frames.size();
+        while (index > 0 && frames[index - 1].timestamp > coded_frame.timestamp)
+            index--;
+
+        // Remove existing coded frames in track buffer that have the same presentation timestamp as the new coded frame.
+        if (index > 0 && frames[index - 1].timestamp == coded_frame.timestamp) {
+            m_buffered_byte_count -= frames[index - 1].data.size();
+            m_buffered_byte_count += coded_frame.data.size();
+            frames[index - 1] = move(coded_frame);
+            continue;
+        }
+
+        // Add the coded frame with the presentation timestamp, decode timestamp, and frame duration to the track buffer.
+        m_buffered_byte_count += coded_frame.data.size();
+        frames.insert(index, move(coded_frame));
+    }
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-coded-frame-eviction
+void SourceBufferProcessor::evict_coded_frames()
+{
+    // 3. Let removal ranges equal a list of presentation time ranges that can be evicted from the presentation to make
+    //    room for the new data.
+    // FIXME: The spec lets the user agent choose these ranges around the current playback position. Until SourceBuffers
+    //        can be played, we evict the oldest coded frames, one group of pictures at a time, so that every track
+    //        buffer still starts with a random access point.
+    while (m_buffered_byte_count > MAXIMUM_BUFFERED_BYTES) {
+        // Evict up to the end of the longest first group of pictures, so that every track that has more than one loses
+        // at least one.
+        Optional<AK::Duration> removal_end;
+        for (auto const& it : m_track_buffers) {
+            auto const& frames = it.value.coded_frames;
+            for (size_t i = 1; i < frames.size(); i++) {
+                if (!frames[i].is_keyframe)
+                    continue;
+                if (!removal_end.has_value() || frames[i].timestamp > *removal_end)
+                    removal_end = frames[i].timestamp;
+                break;
+            }
+        }
+        if (!removal_end.has_value())
+            return;
+
+        // 4. For each range in removal ranges, run the coded frame removal algorithm with start and end equal to the
+        //    removal range start and end timestamp respectively.
+        size_t removed_frame_count = 0;
+        for (auto& it : m_track_buffers) {
+            auto& frames = it.value.coded_frames;
+
+            // Only remove up to the last random access point before the end of the removal range.
+            size_t frames_to_remove = 0;
+            for (size_t i = 0; i < frames.size() && frames[i].timestamp <= *removal_end; i++) {
+                if (frames[i].is_keyframe)
+                    frames_to_remove = i;
+            }
+
+            for (size_t i = 0; i < frames_to_remove; i++)
+                m_buffered_byte_count -= frames[i].data.size();
+            frames.remove(0, frames_to_remove);
+            removed_frame_count += frames_to_remove;
+        }
+
+        if (removed_frame_count == 0)
+            return;
+    }
+}
+
+// https://w3c.github.io/media-source/#dfn-track-buffer-ranges
+static Vector<SourceBufferProcessor::TimeRange> track_buffer_ranges(Vector<CodedFrame> const& frames)
+{
+    Vector<SourceBufferProcessor::TimeRange> ranges;
+    if (frames.is_empty())
+        return ranges;
+
+    // NOTE: Our coded frames don't carry a duration, so each one is assumed to last until the next one starts, unless
+    //       the gap between them is more than twice the duration of the previous frame, in which case there is a
+    //       discontinuity, the same as is detected by the coded frame processing algorithm.
+    auto range_start = frames.first().timestamp;
+    auto last_frame_duration = AK::Duration::zero();
+    for (size_t i = 1; i < frames.size(); i++) {
+        auto gap = frames[i].timestamp - frames[i - 1].timestamp;
+        if (i > 1 && gap > last_frame_duration + last_frame_duration) {
+            ranges.append({ range_start, frames[i - 1].timestamp + last_frame_duration });
+            range_start = frames[i].timestamp;
+            continue;
+        }
+        last_frame_duration = gap;
+    }
+    ranges.append({ range_start, frames.last().timestamp + last_frame_duration });
+    return ranges;
+}
+
+static Vector<SourceBufferProcessor::TimeRange> intersect_ranges(Vector<SourceBufferProcessor::TimeRange> const& a, Vector<SourceBufferProcessor::TimeRange> const& b)
+{
+    Vector<SourceBufferProcessor::TimeRange> intersection;
+    size_t a_index = 0;
+    size_t b_index = 0;
+    while (a_index < a.size() && b_index < b.size()) {
+        auto start = max(a[a_index].start, b[b_index].start);
+        auto end = min(a[a_index].end, b[b_index].end);
+        if (start < end)
+            intersection.append({ start, end });
+
+        if (a[a_index].end < b[b_index].end)
+            a_index++;
+        else
+            b_index++;
+    }
+    return intersection;
+}
+
+// https://w3c.github.io/media-source/#dom-sourcebuffer-buffered
+Vector<SourceBufferProcessor::TimeRange> SourceBufferProcessor::buffered_ranges() const
+{
+    // 2. Let highest end time be the largest track buffer ranges end time across all the track buffers managed by this
+    //    SourceBuffer object.
+    // 3. Let intersection ranges equal a TimeRanges object containing a single range from 0 to highest end time.
+    // NOTE: Starting from the first track's ranges instead is equivalent, and avoids computing each track's ranges twice.
+    Optional<Vector<TimeRange>> intersection;
+
+    // 4. For each audio and video track buffer managed by this SourceBuffer, run the following steps:
+    for (auto const& it : m_track_buffers) {
+        // 1. Let track ranges equal the track buffer ranges for the current track buffer.
+        auto track_ranges = track_buffer_ranges(it.value.coded_frames);
+
+        // FIXME: 2. If readyState is "ended", then set the end time on the last range in track ranges to highest end time.
+
+        // 3. Let new intersection ranges equal the intersection between the intersection ranges and the track ranges.
+        // 4. Replace the ranges in intersection ranges with the new intersection ranges.
+        if (!intersection.has_value())
+            intersection = move(track_ranges);
+        else
+            intersection = intersect_ranges(*intersection, track_ranges);
+    }
+
+    // 5. If intersection ranges does not contain the exact same range information as the current value of this
+    //    attribute, then update the current value of this attribute to intersection ranges.
+    if (!intersection.has_value())
+        return {};
+    return intersection.release_value();
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
+#include <AK/HashMap.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibMedia/Containers/Matroska/Reader.h>
+#include <LibThreading/Mutex.h>
+
+namespace Web::MediaSourceExtensions {
+
+// The state of a SourceBuffer that appended data is parsed into. The buffer append algorithm runs on a background
+// thread, so that adaptive streaming players appending many megabytes a minute do not block the main thread. Everything
+// this holds is therefore guarded by its mutex.
+class SourceBufferProcessor final : public AtomicRefCounted<SourceBufferProcessor> {
+public:
+    struct TimeRange {
+        AK::Duration start;
+        AK::Duration end;
+    };
+
+    struct AppendResult {
+        bool append_error { false };
+        Vector<TimeRange> buffered_ranges;
+        bool buffer_full { false };
+    };
+
+    static NonnullRefPtr<SourceBufferProcessor> create();
+
+    // https://w3c.github.io/media-source/#sourcebuffer-segment-parser-loop
+    AppendResult run_segment_parser_loop(ByteBuffer&&);
+
+    // https://w3c.github.io/media-source/#sourcebuffer-reset-parser-state
+    void reset_parser_state();
+
+private:
+    SourceBufferProcessor() = default;
+
+    struct TrackBuffer {
+        // Sorted by timestamp.
+        Vector<Media::Matroska::CodedFrame> coded_frames;
+    };
+
+    bool process_initialization_segment(Media::Matroska::ByteStreamParser::InitializationSegment const&);
+    void process_coded_frames(Vector<Media::Matroska::CodedFrame>&&);
+    void evict_coded_frames();
+    Vector<TimeRange> buffered_ranges() const;
+
+    Threading::Mutex m_mutex;
+
+    Media::Matroska::ByteStreamParser m_parser;
+
+    // https://w3c.github.io/media-source/#first-init-segment-received-flag
+    bool m_first_initialization_segment_received { false };
+
+    HashMap<u64, TrackBuffer> m_track_buffers;
+    size_t m_buffered_byte_count { 0 };
+};
+
+}
@@ -94,7 +94,13 @@ EventResult DragAndDropEventHandler::handle_drag_start(
     //    The actual data
     //        The file's contents and name.
     for (auto& file : files) {
-        auto contents = file.take_contents();
+        auto contents_or_error = file.take_contents();
+        if (contents_or_error.is_error()) {
+            dbgln("Unable to read dragged file '{}': {}", file.name(), contents_or_error.error());
+            continue;
+        }
+
+        auto contents = contents_or_error.release_value();
         auto mime_type = MimeSniff::Resource::sniff(contents);
 
         m_drag_data_store->add_item({
@@ -22,6 +22,7 @@
 #include <LibWeb/HTML/HTMLVideoElement.h>
 #include <LibWeb/Layout/Label.h>
 #include <LibWeb/Layout/Viewport.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Page/DragAndDropEventHandler.h>
 #include <LibWeb/Page/EventHandler.h>
 #include <LibWeb/Page/Page.h>
@@ -378,6 +379,21 @@ GC::Ptr<Painting::PaintableBox const> EventHandler::paint_root() const
     return m_navigable->active_document()->paintable_box();
 }
 
+// Whether dispatching an event of the given type at the node could invoke any event listeners. This errs on the side of
+// caution for shadow trees, where the event path isn't simply the node's ancestors.
+static bool event_could_reach_a_listener(DOM::Node const& node, FlyString const& type)
+{
+    for (auto const* ancestor = &node; ancestor; ancestor = ancestor->parent_or_shadow_host()) {
+        if (ancestor->is_shadow_root() || ancestor->has_event_listener(type))
+            return true;
+        if (auto const* element = as_if<DOM::Element>(*ancestor); element && element->is_shadow_host())
+            return true;
+    }
+
+    auto window = node.document().window();
+    return window && window->has_event_listener(type);
+}
+
 EventResult EventHandler::handle_mousewheel(CSSPixelPoint viewport_position, CSSPixelPoint screen_position, u32 button, u32 buttons, u32 modifiers, int wheel_delta_x, int wheel_delta_y)
 {
     if (should_ignore_device_input_event())
@@ -433,7 +449,10 @@ EventResult EventHandler::handle_mousewheel(CSSPixelPoint viewport_position, CSS
 
             auto page_offset = compute_mouse_event_page_offset(viewport_position);
             auto offset = compute_mouse_event_offset(page_offset, *layout_node->first_paintable());
-            if (node->dispatch_event(UIEvents::WheelEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::wheel, screen_position, page_offset, viewport_position, offset, wheel_delta_x, wheel_delta_y, button, buttons, modifiers).release_value_but_fixme_should_propagate_errors())) {
+            // OPTIMIZATION: Don't create and dispatch a wheel event that no listener could observe, so that scrolling
+            //               doesn't have to go through the DOM event machinery.
+            if (!event_could_reach_a_listener(*node, UIEvents::EventNames::wheel)
+                || node->dispatch_event(UIEvents::WheelEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::wheel, screen_position, page_offset, viewport_position, offset, wheel_delta_x, wheel_delta_y, button, buttons, modifiers).release_value_but_fixme_should_propagate_errors())) {
                 m_navigable->active_window()->scroll_by(wheel_delta_x, wheel_delta_y);
             }
 
@@ -762,8 +781,12 @@ EventResult EventHandler::handle_mousemove(CSSPixelPoint viewport_position, CSSP
                 return EventResult::Cancelled;
             }
 
-            // FIXME: It feels a bit aggressive to always update the cursor like this.
-            m_navigable->page().client().page_did_request_cursor_change(Gfx::StandardCursor::None);
+            // NOTE: Only tell the client about the cursor change if it actually changed, as this happens on every mouse move.
+            auto& page = m_navigable->page();
+            if (page.current_cursor() != Gfx::Cursor { Gfx::StandardCursor::None }) {
+                page.set_current_cursor(Gfx::StandardCursor::None);
+                page.client().page_did_request_cursor_change(Gfx::StandardCursor::None);
+            }
         }
 
         node = dom_node_for_event_dispatch(*paintable);
@@ -802,12 +825,18 @@ EventResult EventHandler::handle_mousemove(CSSPixelPoint viewport_position, CSSP
 
             m_mousemove_previous_screen_position = screen_position;
 
-            bool continue_ = node->dispatch_event(UIEvents::PointerEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::pointermove, screen_position, page_offset, viewport_position, offset, movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors());
-            if (!continue_)
-                return EventResult::Cancelled;
-            continue_ = node->dispatch_event(UIEvents::MouseEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::mousemove, screen_position, page_offset, viewport_position, offset, movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors());
-            if (!continue_)
-                return EventResult::Cancelled;
+            // OPTIMIZATION: Pointer movement arrives at a high rate, so don't create and dispatch move events that no
+            //               listener could observe.
+            if (event_could_reach_a_listener(*node, UIEvents::EventNames::pointermove)) {
+                bool continue_ = node->dispatch_event(UIEvents::PointerEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::pointermove, screen_position, page_offset, viewport_position, offset, movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors());
+                if (!continue_)
+                    return EventResult::Cancelled;
+            }
+            if (event_could_reach_a_listener(*node, UIEvents::EventNames::mousemove)) {
+                bool continue_ = node->dispatch_event(UIEvents::MouseEvent::create_from_platform_event(node->realm(), UIEvents::EventNames::mousemove, screen_position, page_offset, viewport_position, offset, movement, UIEvents::MouseButton::Primary, buttons, modifiers).release_value_but_fixme_should_propagate_errors());
+                if (!continue_)
+                    return EventResult::Cancelled;
+            }
 
             // NOTE: Dispatching an event may have disturbed the world.
             if (!paint_root() || paint_root() != node->document().paintable_box())
@@ -859,8 +888,20 @@ EventResult EventHandler::handle_mousemove(CSSPixelPoint viewport_position, CSSP
         }
 
         if (is_hovering_link) {
+            auto link_url = *document.encoding_parse_url(hovered_link_element->href());
+
+            // OPTIMIZATION: Resolve the link's host while the user is still hovering it, so that a click doesn't wait
+            //               for DNS. We only do this once per host, as mouse moves over the same link are frequent.
+            if (link_url.scheme().is_one_of("http"sv, "https"sv)) {
+                auto host = link_url.serialized_host();
+                if (host != m_last_dns_prefetched_link_host) {
+                    m_last_dns_prefetched_link_host = host;
+                    ResourceLoader::the().prefetch_dns(link_url);
+                }
+            }
+
             page.set_is_hovering_link(true);
-            page.client().page_did_hover_link(*document.encoding_parse_url(hovered_link_element->href()));
+            page.client().page_did_hover_link(link_url);
         } else if (page.is_hovering_link()) {
             page.set_is_hovering_link(false);
             page.client().page_did_unhover_link();
@@ -81,6 +81,8 @@ private:
     Optional<CSSPixelPoint> m_mousemove_previous_screen_position;
 
     OwnPtr<Unicode::Segmenter> m_word_segmenter;
+
+    Optional<String> m_last_dns_prefetched_link_host;
 };
 
 }
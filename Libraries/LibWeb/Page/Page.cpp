@@ -595,6 +595,30 @@ void Page::set_user_style(String source)
     }
 }
 
+void Page::did_start_network_request(URL::URL const& url)
+{
+    static constexpr size_t maximum_tracked_origins = 64;
+
+    if (m_network_request_origins.size() >= maximum_tracked_origins)
+        return;
+    if (url.scheme() != "http"sv && url.scheme() != "https"sv)
+        return;
+
+    m_network_request_origins.set(url.origin().serialize());
+}
+
+Vector<String> Page::take_network_request_origins()
+{
+    Vector<String> origins;
+    origins.ensure_capacity(m_network_request_origins.size());
+
+    for (auto& origin : m_network_request_origins)
+        origins.unchecked_append(origin);
+
+    m_network_request_origins.clear();
+    return origins;
+}
+
 Vector<GC::Root<DOM::Document>> Page::documents_in_active_window() const
 {
     if (!top_level_traversable_is_initialized())
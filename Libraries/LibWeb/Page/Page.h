@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/HashTable.h>
 #include <AK/WeakPtr.h>
 #include <LibGC/Root.h>
 #include <LibGfx/Cursor.h>
@@ -223,6 +224,12 @@ public:
     bool listen_for_dom_mutations() const { return m_listen_for_dom_mutations; }
     void set_listen_for_dom_mutations(bool listen_for_dom_mutations) { m_listen_for_dom_mutations = listen_for_dom_mutations; }
 
+    // The origins contacted by network requests while loading the current top-level document. These are reported to the
+    // UI process once loading finishes, so that it may preconnect to them on future visits.
+    void did_start_network_request(URL::URL const&);
+    Vector<String> take_network_request_origins();
+    void clear_network_request_origins() { m_network_request_origins.clear(); }
+
 private:
     explicit Page(GC::Ref<PageClient>);
     virtual void visit_edges(Visitor&) override;
@@ -294,6 +301,8 @@ private:
     URL::URL m_last_find_in_page_url;
 
     bool m_listen_for_dom_mutations { false };
+
+    HashTable<String> m_network_request_origins;
 };
 
 enum class DisplayListPlayerType {
@@ -363,6 +372,8 @@ public:
     virtual WebView::StorageOperationError page_did_set_storage_item([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] String const& bottle_key, [[maybe_unused]] String const& value) { return WebView::StorageOperationError::None; }
     virtual void page_did_remove_storage_item([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] String const& bottle_key) { }
     virtual Vector<String> page_did_request_storage_keys([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key) { return {}; }
+    virtual OrderedHashMap<String, String> page_did_request_storage_items([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key) { return {}; }
+    virtual void page_did_update_storage_items([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key, [[maybe_unused]] OrderedHashMap<String, Optional<String>> changes) { }
     virtual void page_did_clear_storage([[maybe_unused]] Web::StorageAPI::StorageEndpointType storage_endpoint, [[maybe_unused]] String const& storage_key) { }
     virtual void page_did_update_resource_count(i32) { }
     struct NewWebViewResult {
@@ -5,6 +5,7 @@
  */
 
 #include <AK/TemporaryChange.h>
+#include <LibCore/TraceEvent.h>
 #include <LibWeb/Painting/DevicePixelConverter.h>
 #include <LibWeb/Painting/DisplayList.h>
 
@@ -15,6 +16,20 @@ void DisplayList::append(DisplayListCommand&& command, Optional<i32> scroll_fram
     m_commands.append({ scroll_frame_id, clip_frame, move(command) });
 }
 
+NonnullRefPtr<DisplayList> DisplayList::with_nested_display_lists_replaced(HashMap<DisplayList const*, NonnullRefPtr<DisplayList>> const& replaced_display_lists) const
+{
+    auto display_list = create(m_device_pixels_per_css_pixel);
+    for (auto const& [scroll_frame_id, clip_frame, command] : m_commands) {
+        auto new_command = command;
+        if (auto* paint_nested_display_list = new_command.get_pointer<PaintNestedDisplayList>()) {
+            if (auto replacement = replaced_display_lists.get(paint_nested_display_list->display_list.ptr()); replacement.has_value())
+                paint_nested_display_list->display_list = replacement.value();
+        }
+        display_list->append(move(new_command), scroll_frame_id, clip_frame);
+    }
+    return display_list;
+}
+
 String DisplayList::dump() const
 {
     StringBuilder builder;
@@ -68,6 +83,8 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
 
 void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
 {
+    TRACE_EVENT("paint", "DisplayListPlayer::execute");
+
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
     if (surface) {
         surface->lock_context();
@@ -128,7 +145,14 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
     Vector<RefPtr<ClipFrame const>> clip_frames_stack;
     clip_frames_stack.append({});
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
-        auto [scroll_frame_id, clip_frame, command] = commands[command_index];
+        auto const& [scroll_frame_id, clip_frame, recorded_command] = commands[command_index];
+
+        // OPTIMIZATION: Only copy the commands that have to be adjusted for the current scroll state, rather than every
+        //               command (with all of its glyph runs, paths and bitmaps) on every frame.
+        Optional<DisplayListCommand> adjusted_command;
+        if (scroll_frame_id.has_value() || recorded_command.has<PaintScrollBar>())
+            adjusted_command = recorded_command;
+        auto const& command = adjusted_command.has_value() ? *adjusted_command : recorded_command;
 
         if (clip_frames_stack.last() != clip_frame) {
             if (auto clip_frame = clip_frames_stack.take_last()) {
@@ -153,7 +177,7 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         }
 
         if (command.has<PaintScrollBar>()) {
-            auto& paint_scroll_bar = command.get<PaintScrollBar>();
+            auto& paint_scroll_bar = adjusted_command->get<PaintScrollBar>();
             auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
             if (paint_scroll_bar.vertical) {
                 auto offset = scroll_offset.y() * paint_scroll_bar.scroll_size;
@@ -167,7 +191,7 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         if (scroll_frame_id.has_value()) {
             auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
             auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
-            command.visit(
+            adjusted_command->visit(
                 [&](auto& command) {
                     if constexpr (requires { command.translate_by(scroll_offset); }) {
                         command.translate_by(scroll_offset);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/Forward.h>
+#include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/SegmentedVector.h>
 #include <LibGfx/Color.h>
@@ -88,6 +89,9 @@ public:
 
     void append(DisplayListCommand&& command, Optional<i32> scroll_frame_id, RefPtr<ClipFrame const>);
 
+    // Returns a copy of this display list in which nested display lists are replaced by the given ones.
+    NonnullRefPtr<DisplayList> with_nested_display_lists_replaced(HashMap<DisplayList const*, NonnullRefPtr<DisplayList>> const&) const;
+
     struct DisplayListCommandWithScrollAndClip {
         Optional<i32> scroll_frame_id;
         RefPtr<ClipFrame const> clip_frame;
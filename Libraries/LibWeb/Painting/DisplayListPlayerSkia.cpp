@@ -547,18 +547,30 @@ void DisplayListPlayerSkia::paint_inner_box_shadow(PaintInnerBoxShadow const& co
 
 void DisplayListPlayerSkia::paint_text_shadow(PaintTextShadow const& command)
 {
-    auto& canvas = surface().canvas();
-    auto blur_image_filter = SkImageFilters::Blur(command.blur_radius / 2, command.blur_radius / 2, nullptr);
-    SkPaint blur_paint;
-    blur_paint.setImageFilter(blur_image_filter);
-    canvas.saveLayer(SkCanvas::SaveLayerRec(nullptr, &blur_paint, nullptr, 0));
-    draw_glyph_run({
+    DrawGlyphRun draw_glyph_run_command {
         .glyph_run = command.glyph_run,
         .scale = command.glyph_run_scale,
         .rect = command.text_rect,
         .translation = command.draw_location + command.text_rect.location().to_type<float>(),
         .color = command.color,
-    });
+    };
+
+    // OPTIMIZATION: An unblurred shadow is just the text drawn in the shadow color.
+    if (command.blur_radius <= 0) {
+        draw_glyph_run(draw_glyph_run_command);
+        return;
+    }
+
+    // NOTE: The shadow's bounding rect leaves room for twice the blur radius (i.e. four standard deviations) around the
+    //       text, which covers the whole extent of the blur. Limiting the layer to it avoids allocating and blurring a
+    //       layer the size of the entire clip for every shadow.
+    auto& canvas = surface().canvas();
+    auto blur_image_filter = SkImageFilters::Blur(command.blur_radius / 2, command.blur_radius / 2, nullptr);
+    SkPaint blur_paint;
+    blur_paint.setImageFilter(blur_image_filter);
+    auto layer_bounds = to_skia_rect(command.bounding_rect());
+    canvas.saveLayer(SkCanvas::SaveLayerRec(&layer_bounds, &blur_paint, nullptr, 0));
+    draw_glyph_run(draw_glyph_run_command);
     canvas.restore();
 }
 
@@ -60,6 +60,8 @@ void NavigableContainerViewportPaintable::paint(DisplayListRecordingContext& con
         paint_config.paint_overlay = context.should_paint_overlay();
         paint_config.should_show_line_box_borders = context.should_show_line_box_borders();
         auto display_list = const_cast<DOM::Document*>(hosted_document)->record_display_list(paint_config);
+        if (display_list)
+            const_cast<DOM::Document&>(document()).did_record_nested_display_list(const_cast<DOM::Document&>(*hosted_document), *display_list, paint_config);
         context.display_list_recorder().paint_nested_display_list(display_list, context.enclosing_device_rect(absolute_rect).to_type<int>());
 
         context.display_list_recorder().restore();
@@ -1158,11 +1158,65 @@ CSSPixelPoint PaintableBox::adjust_position_for_cumulative_scroll_offset(CSSPixe
     return position.translated(-cumulative_offset_of_enclosing_scroll_frame());
 }
 
+Optional<CSSPixelRect> const& PaintableBox::hit_test_bounds() const
+{
+    if (m_hit_test_bounds.has_value())
+        return *m_hit_test_bounds;
+
+    auto compute_hit_test_bounds = [&]() -> Optional<CSSPixelRect> {
+        // NOTE: Hit testing transformed boxes maps positions, and hit testing SVG checks their geometry. Scroll containers
+        //       move their contents, and their scrollbars update as the mouse moves away from them.
+        if (is_svg_paintable() || !combined_css_transform().is_identity() || layout_node().is_scroll_container())
+            return {};
+
+        auto bounds = absolute_border_box_rect();
+
+        if (auto const* paintable_with_lines = as_if<PaintableWithLines>(*this)) {
+            for (auto const& fragment : paintable_with_lines->fragments())
+                bounds.unite(fragment.absolute_rect());
+        }
+
+        for (auto const* child = first_child(); child; child = child->next_sibling()) {
+            auto const* child_box = as_if<PaintableBox>(*child);
+            if (!child_box)
+                continue;
+
+            // NOTE: Boxes in other scroll frames (e.g. fixed or sticky boxes) are offset differently from us.
+            if (child_box->enclosing_scroll_frame() != enclosing_scroll_frame())
+                return {};
+
+            auto const& child_bounds = child_box->hit_test_bounds();
+            if (!child_bounds.has_value())
+                return {};
+            bounds.unite(*child_bounds);
+        }
+
+        return bounds;
+    };
+
+    m_hit_test_bounds = compute_hit_test_bounds();
+    return *m_hit_test_bounds;
+}
+
+// OPTIMIZATION: Exact hit tests can only hit this box or its descendants inside of their absolute rects, so we can skip
+//               entire subtrees for positions outside of them, instead of visiting every box on the page.
+bool PaintableBox::can_skip_hit_test(CSSPixelPoint position, HitTestType type) const
+{
+    if (type != HitTestType::Exact)
+        return false;
+
+    auto const& bounds = hit_test_bounds();
+    return bounds.has_value() && !bounds->contains(adjust_position_for_cumulative_scroll_offset(position));
+}
+
 TraversalDecision PaintableBox::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
 {
     if (clip_rect_for_hit_testing().has_value() && !clip_rect_for_hit_testing()->contains(position))
         return TraversalDecision::Continue;
 
+    if (can_skip_hit_test(position, type))
+        return TraversalDecision::Continue;
+
     auto position_adjusted_by_scroll_offset = adjust_position_for_cumulative_scroll_offset(position);
 
     if (computed_values().visibility() != CSS::Visibility::Visible)
@@ -1245,6 +1299,9 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
     if (clip_rect_for_hit_testing().has_value() && !clip_rect_for_hit_testing()->contains(position))
         return TraversalDecision::Continue;
 
+    if (can_skip_hit_test(position, type))
+        return TraversalDecision::Continue;
+
     auto position_adjusted_by_scroll_offset = adjust_position_for_cumulative_scroll_offset(position);
 
     // TextCursor hit testing mode should be able to place cursor in contenteditable elements even if they are empty
@@ -1351,9 +1408,50 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
     return TraversalDecision::Continue;
 }
 
+// Whether everything this box paints is guaranteed to lie within its (freshly computed) absolute paint rect, in the
+// same coordinate space as its document's viewport rect.
+static bool paint_rect_is_reliable_for_viewport_culling(PaintableBox const& box)
+{
+    if (box.is_svg_paintable())
+        return false;
+
+    // NOTE: Paint-only properties such as box shadows and outlines may not have been resolved yet after a style
+    //       change, so the cached values can't be trusted here.
+    auto const& computed_values = box.computed_values();
+    if (!computed_values.box_shadow().is_empty() || computed_values.outline_style() != CSS::OutlineStyle::None)
+        return false;
+
+    // Anything that moves or grows a box's painting after layout makes its absolute rect unreliable.
+    for (auto const* paintable = static_cast<Paintable const*>(&box); paintable; paintable = paintable->parent()) {
+        if (!is<PaintableBox>(*paintable))
+            continue;
+        auto const& ancestor = static_cast<PaintableBox const&>(*paintable);
+        if (ancestor.is_viewport())
+            break;
+        if (ancestor.is_fixed_position() || ancestor.is_sticky_position() || ancestor.has_css_transform())
+            return false;
+        if (ancestor.computed_values().filter().has_value() || ancestor.computed_values().backdrop_filter().has_value())
+            return false;
+        if (&ancestor != &box && ancestor.layout_node().is_scroll_container())
+            return false;
+    }
+    return true;
+}
+
 void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    auto& document = this->document();
+
+    // OPTIMIZATION: Changes to a box that lies entirely outside of the viewport, e.g. an animation below the fold, can't
+    //               be visible, so don't repaint for them. The display list is still invalidated, so that the change
+    //               is painted once the box is scrolled into view (which repaints the whole viewport).
+    if (paint_rect_is_reliable_for_viewport_culling(*this) && !compute_absolute_paint_rect().intersects(document.viewport_rect())) {
+        if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+            document.invalidate_display_list();
+        return;
+    }
+
+    document.set_needs_display(absolute_rect(), should_invalidate_display_list);
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
@@ -1503,6 +1601,9 @@ void PaintableBox::resolve_paint_properties()
     auto combined_transform = compute_combined_css_transform();
     set_combined_css_transform(combined_transform);
 
+    // NOTE: Our hit test bounds depend on the transforms of our ancestors and descendants, which may have changed.
+    m_hit_test_bounds.clear();
+
     CSSPixelRect background_rect;
     Color background_color = computed_values.background_color();
     auto const* background_layers = &computed_values.background_layers();
@@ -145,6 +145,11 @@ public:
     [[nodiscard]] TraversalDecision hit_test_children(CSSPixelPoint, HitTestType, Function<TraversalDecision(HitTestResult)> const&) const;
     [[nodiscard]] TraversalDecision hit_test_continuation(Function<TraversalDecision(HitTestResult)> const& callback) const;
 
+    // The union of the absolute rects that hit testing this box and its descendants checks positions against, in the
+    // coordinate space of our enclosing scroll frame. This is empty if a hit test outside of these rects could still
+    // hit something, e.g. because our subtree contains transforms, SVG or scroll containers.
+    [[nodiscard]] Optional<CSSPixelRect> const& hit_test_bounds() const;
+
     virtual bool handle_mousewheel(Badge<EventHandler>, CSSPixelPoint, unsigned buttons, unsigned modifiers, int wheel_delta_x, int wheel_delta_y) override;
 
     enum class ConflictingElementKind {
@@ -290,6 +295,7 @@ protected:
     [[nodiscard]] bool could_be_scrolled_by_wheel_event(ScrollDirection) const;
 
     TraversalDecision hit_test_scrollbars(CSSPixelPoint position, Function<TraversalDecision(HitTestResult)> const& callback) const;
+    [[nodiscard]] bool can_skip_hit_test(CSSPixelPoint position, HitTestType) const;
     CSSPixelPoint adjust_position_for_cumulative_scroll_offset(CSSPixelPoint) const;
 
     Gfx::AffineTransform const& combined_css_transform() const { return m_combined_css_transform; }
@@ -330,6 +336,8 @@ private:
     CSSPixelPoint m_transform_origin;
     Gfx::AffineTransform m_combined_css_transform;
 
+    mutable Optional<Optional<CSSPixelRect>> m_hit_test_bounds;
+
     Optional<BordersData> m_outline_data;
     CSSPixels m_outline_offset { 0 };
 
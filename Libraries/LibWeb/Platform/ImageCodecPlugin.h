@@ -12,6 +12,7 @@
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 
 namespace Web::Platform {
 
@@ -27,6 +28,11 @@ struct DecodedImage {
     Gfx::ColorSpace color_space;
 };
 
+enum class FramesToDecode {
+    All,
+    FirstOnly,
+};
+
 class ImageCodecPlugin {
 public:
     static ImageCodecPlugin& the();
@@ -34,7 +40,10 @@ public:
 
     virtual ~ImageCodecPlugin();
 
-    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    // If an ideal size is given, decoders that support it may produce a smaller bitmap that still covers that size.
+    // Callers that only ever look at the first frame should pass FramesToDecode::FirstOnly, so that the remaining
+    // frames of animated images aren't decoded for nothing.
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, FramesToDecode = FramesToDecode::All) = 0;
 };
 
 }
@@ -6,6 +6,7 @@
 
 #include <LibGC/Heap.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/ResizeObserver/ResizeObservation.h>
@@ -39,6 +40,10 @@ void ResizeObservation::visit_edges(JS::Cell::Visitor& visitor)
 // https://drafts.csswg.org/resize-observer-1/#dom-resizeobservation-isactive
 bool ResizeObservation::is_active()
 {
+    auto layout_generation = DOM::Document::layout_generation();
+    if (m_inactive_at_layout_generation == layout_generation)
+        return false;
+
     // 1. Set currentSize by calculate box size given target and observedBox.
     auto current_size = ResizeObserverSize::calculate_box_size(m_realm, m_target, m_observed_box);
 
@@ -48,7 +53,14 @@ bool ResizeObservation::is_active()
         return true;
 
     // 3. Return false.
+    m_inactive_at_layout_generation = layout_generation;
     return false;
 }
 
+void ResizeObservation::set_last_reported_sizes(Vector<GC::Ref<ResizeObserverSize>> sizes)
+{
+    m_last_reported_sizes = move(sizes);
+    m_inactive_at_layout_generation.clear();
+}
+
 }
@@ -25,7 +25,8 @@ public:
     GC::Ref<DOM::Element> target() const { return m_target; }
     Bindings::ResizeObserverBoxOptions observed_box() const { return m_observed_box; }
 
-    Vector<GC::Ref<ResizeObserverSize>>& last_reported_sizes() { return m_last_reported_sizes; }
+    Vector<GC::Ref<ResizeObserverSize>> const& last_reported_sizes() const { return m_last_reported_sizes; }
+    void set_last_reported_sizes(Vector<GC::Ref<ResizeObserverSize>>);
 
     explicit ResizeObservation(JS::Realm& realm, DOM::Element& target, Bindings::ResizeObserverBoxOptions observed_box);
 
@@ -36,6 +37,10 @@ private:
     GC::Ref<DOM::Element> m_target;
     Bindings::ResizeObserverBoxOptions m_observed_box;
     Vector<GC::Ref<ResizeObserverSize>> m_last_reported_sizes;
+
+    // OPTIMIZATION: The size of our target can only change when layout is updated, so once we've found this observation
+    //               to be inactive, it stays inactive until the next layout update.
+    Optional<u64> m_inactive_at_layout_generation;
 };
 
 }
@@ -157,28 +157,72 @@ ErrorOr<Vector<Metadata>> get_strongest_metadata_from_set(Vector<Metadata> const
 
 // https://w3c.github.io/webappsec-subresource-integrity/#does-response-match-metadatalist
 ErrorOr<bool> do_bytes_match_metadata_list(ByteBuffer const& bytes, StringView metadata_list)
+{
+    auto matcher = TRY(IncrementalMetadataListMatcher::create(metadata_list));
+    matcher->update(bytes);
+    return matcher->do_bytes_match();
+}
+
+static Crypto::Hash::HashKind hash_kind_for_algorithm(StringView algorithm)
+{
+    if (algorithm == "sha256"sv)
+        return Crypto::Hash::HashKind::SHA256;
+    if (algorithm == "sha384"sv)
+        return Crypto::Hash::HashKind::SHA384;
+    if (algorithm == "sha512"sv)
+        return Crypto::Hash::HashKind::SHA512;
+    VERIFY_NOT_REACHED();
+}
+
+// https://w3c.github.io/webappsec-subresource-integrity/#does-response-match-metadatalist
+ErrorOr<NonnullOwnPtr<IncrementalMetadataListMatcher>> IncrementalMetadataListMatcher::create(StringView metadata_list)
 {
     // 1. Let parsedMetadata be the result of parsing metadataList.
     auto parsed_metadata = TRY(parse_metadata(metadata_list));
 
     // 2. If parsedMetadata is empty set, return true.
+    // NOTE: We don't hash anything in this case, and do_bytes_match() returns true.
     if (parsed_metadata.is_empty())
-        return true;
+        return adopt_nonnull_own_or_enomem(new (nothrow) IncrementalMetadataListMatcher({}, nullptr));
 
     // 3. Let metadata be the result of getting the strongest metadata from parsedMetadata.
     auto metadata = TRY(get_strongest_metadata_from_set(parsed_metadata));
 
+    // NOTE: All of the strongest metadata uses the same algorithm, so we only need to compute a single hash.
+    auto hash = Crypto::Hash::Manager::create(hash_kind_for_algorithm(metadata.first().algorithm));
+
+    return adopt_nonnull_own_or_enomem(new (nothrow) IncrementalMetadataListMatcher(move(metadata), move(hash)));
+}
+
+IncrementalMetadataListMatcher::IncrementalMetadataListMatcher(Vector<Metadata> metadata, OwnPtr<Crypto::Hash::Manager> hash)
+    : m_metadata(move(metadata))
+    , m_hash(move(hash))
+{
+}
+
+void IncrementalMetadataListMatcher::update(ReadonlyBytes bytes)
+{
+    if (m_hash)
+        m_hash->update(bytes);
+}
+
+// https://w3c.github.io/webappsec-subresource-integrity/#does-response-match-metadatalist
+ErrorOr<bool> IncrementalMetadataListMatcher::do_bytes_match()
+{
+    if (!m_hash)
+        return true;
+
+    // NOTE: Every item in metadata uses the same algorithm, so we only apply it to bytes once, rather than once per item.
+    auto digest = m_hash->digest();
+    auto actual_value = TRY(encode_base64({ digest.immutable_data(), m_hash->digest_size() }));
+
     // 4. For each item in metadata:
-    for (auto const& item : metadata) {
+    for (auto const& item : m_metadata) {
         // 1. Let algorithm be the item["alg"].
-        auto& algorithm = item.algorithm;
-
         // 2. Let expectedValue be the item["val"].
         auto& expected_value = item.base64_value;
 
         // 3. Let actualValue be the result of applying algorithm to bytes.
-        auto actual_value = TRY(apply_algorithm_to_bytes(algorithm, bytes));
-
         // 4. If actualValue is a case-sensitive match for expectedValue, return true.
         if (actual_value == expected_value)
             return true;
@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/String.h>
+#include <LibCrypto/Hash/HashManager.h>
 
 namespace Web::SRI {
 
@@ -22,4 +26,25 @@ ErrorOr<Vector<Metadata>> parse_metadata(StringView metadata);
 ErrorOr<Vector<Metadata>> get_strongest_metadata_from_set(Vector<Metadata> const& set);
 ErrorOr<bool> do_bytes_match_metadata_list(ByteBuffer const& bytes, StringView metadata_list);
 
+// Determines whether bytes match a metadata list while they are being received, by hashing each chunk of bytes once it
+// is received rather than all of the bytes once they have been received.
+class IncrementalMetadataListMatcher {
+    AK_MAKE_NONCOPYABLE(IncrementalMetadataListMatcher);
+    AK_MAKE_NONMOVABLE(IncrementalMetadataListMatcher);
+
+public:
+    static ErrorOr<NonnullOwnPtr<IncrementalMetadataListMatcher>> create(StringView metadata_list);
+
+    void update(ReadonlyBytes);
+
+    // Returns whether all of the bytes passed to update() match the metadata list.
+    ErrorOr<bool> do_bytes_match();
+
+private:
+    IncrementalMetadataListMatcher(Vector<Metadata>, OwnPtr<Crypto::Hash::Manager>);
+
+    Vector<Metadata> m_metadata;
+    OwnPtr<Crypto::Hash::Manager> m_hash;
+};
+
 }
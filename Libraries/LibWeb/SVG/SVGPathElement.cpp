@@ -4,12 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <LibGfx/Path.h>
 #include <LibWeb/Bindings/SVGPathElementPrototype.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/Layout/SVGGeometryBox.h>
+#include <LibWeb/SVG/AttributeParser.h>
 #include <LibWeb/SVG/SVGPathElement.h>
 
 namespace Web::SVG {
@@ -32,12 +34,34 @@ void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> c
     Base::attribute_changed(name, old_value, value, namespace_);
 
     if (name == "d")
-        m_path = AttributeParser::parse_path_data(value.value_or(String {}));
+        m_path.clear();
+}
+
+// OPTIMIZATION: Icon-heavy pages often draw the same path many times, for example by referencing it from many <use>
+//               elements, each of which gets its own clone of the path. So we share the paths built for the same path
+//               data between all elements.
+static Gfx::Path path_for_path_data(String const& path_data)
+{
+    static constexpr size_t max_cached_path_count = 1024;
+    static HashMap<String, Gfx::Path> s_paths_by_path_data;
+
+    if (auto path = s_paths_by_path_data.get(path_data); path.has_value())
+        return *path;
+
+    auto path = AttributeParser::parse_path_data(path_data).to_gfx_path();
+
+    if (s_paths_by_path_data.size() >= max_cached_path_count)
+        s_paths_by_path_data.clear();
+    s_paths_by_path_data.set(path_data, path);
+
+    return path;
 }
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
 {
-    return m_path.to_gfx_path();
+    if (!m_path.has_value())
+        m_path = path_for_path_data(get_attribute_value("d"_fly_string));
+    return *m_path;
 }
 
 }
@@ -6,7 +6,7 @@
 
 #pragma once
 
-#include <LibWeb/SVG/Path.h>
+#include <LibGfx/Path.h>
 #include <LibWeb/SVG/SVGGeometryElement.h>
 
 namespace Web::SVG {
@@ -27,7 +27,8 @@ private:
 
     virtual void initialize(JS::Realm&) override;
 
-    Path m_path {};
+    // NOTE: This is built from the path data when it's first needed, and reused until the path data changes.
+    Optional<Gfx::Path> m_path;
 };
 
 }
@@ -0,0 +1,649 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Array.h>
+#include <LibWeb/Bindings/CachePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Methods.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Statuses.h>
+#include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/ServiceWorker/Cache.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(RequestResponseList);
+GC_DEFINE_ALLOCATOR(Cache);
+
+void RequestResponseList::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto const& item : m_items) {
+        visitor.visit(item.request);
+        visitor.visit(item.response);
+    }
+}
+
+GC::Ref<Cache> Cache::create(JS::Realm& realm, GC::Ref<RequestResponseList> request_response_list)
+{
+    return realm.create<Cache>(realm, request_response_list);
+}
+
+Cache::Cache(JS::Realm& realm, GC::Ref<RequestResponseList> request_response_list)
+    : Bindings::PlatformObject(realm)
+    , m_request_response_list(request_response_list)
+{
+}
+
+void Cache::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Cache);
+}
+
+void Cache::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_request_response_list);
+}
+
+// Returns a copy of the response of a request response, with a body of its own.
+static GC::Ref<Fetch::Infrastructure::Response> copy_of_response(JS::Realm& realm, RequestResponseList::Item const& request_response)
+{
+    auto response = request_response.response->clone(realm);
+    if (request_response.body_bytes.has_value())
+        response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *request_response.body_bytes));
+    return response;
+}
+
+// Returns the request of the given RequestInfo, or nothing if the given request is a Request object that must be
+// ignored, as it is not a GET request and options' ignoreMethod is false.
+static WebIDL::ExceptionOr<GC::Ptr<Fetch::Infrastructure::Request>> request_for_query(JS::Realm& realm, Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    // 1. If request is a Request object, then:
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+        // 1. Set r to request’s request.
+        auto inner_request = (*request_object)->request();
+
+        // 2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with an empty
+        //    array / false.
+        if (inner_request->method() != "GET"sv.bytes() && !options.ignore_method)
+            return nullptr;
+
+        return inner_request;
+    }
+
+    // 2. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+    //        with request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto request_object = TRY(Fetch::Request::construct_impl(realm, request));
+    return request_object->request();
+}
+
+static GC::Ref<JS::Array> create_frozen_array(JS::Realm& realm, ReadonlySpan<JS::Value> values)
+{
+    auto array = JS::Array::create_from(realm, values);
+    MUST(array->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+    return array;
+}
+
+// https://w3c.github.io/ServiceWorker/#request-matches-cached-item-algorithm
+static bool request_matches_cached_item(Fetch::Infrastructure::Request const& request_query, Fetch::Infrastructure::Request const& request, GC::Ptr<Fetch::Infrastructure::Response const> response, Optional<CacheQueryOptions> const& options)
+{
+    // 1. If options["ignoreMethod"] is false and request’s method is not `GET`, return false.
+    if ((!options.has_value() || !options->ignore_method) && request.method() != "GET"sv.bytes())
+        return false;
+
+    // 2. Let queryURL be requestQuery’s url.
+    auto query_url = request_query.url();
+
+    // 3. Let cachedURL be request’s url.
+    auto cached_url = request.url();
+
+    // 4. If options["ignoreSearch"] is true, then:
+    if (options.has_value() && options->ignore_search) {
+        // 1. Set cachedURL’s query to the empty string.
+        cached_url.set_query(String {});
+
+        // 2. Set queryURL’s query to the empty string.
+        query_url.set_query(String {});
+    }
+
+    // 5. If queryURL does not equal cachedURL with exclude fragment flag set, then return false.
+    if (!query_url.equals(cached_url, URL::ExcludeFragment::Yes))
+        return false;
+
+    // 6. If response is null, options["ignoreVary"] is true, or response’s header list does not contain `Vary`, then
+    //    return true.
+    if (!response || (options.has_value() && options->ignore_vary) || !response->header_list()->contains("Vary"sv.bytes()))
+        return true;
+
+    // 7. Let fieldValues be the list containing the elements corresponding to the field-values of the Vary header for
+    //    the value of the header with name `Vary`.
+    auto field_values = response->header_list()->get_decode_and_split("Vary"sv.bytes()).value_or({});
+
+    // 8. For each fieldValue in fieldValues:
+    for (auto const& field_value : field_values) {
+        // 1. If fieldValue matches "*", or the combined value given fieldValue and request’s header list does not
+        //    match the combined value given fieldValue and requestQuery’s header list, then return false.
+        if (field_value == "*"sv)
+            return false;
+        if (request.header_list()->get(field_value.bytes()) != request_query.header_list()->get(field_value.bytes()))
+            return false;
+    }
+
+    // 9. Return true.
+    return true;
+}
+
+// https://w3c.github.io/ServiceWorker/#query-cache
+Cache::RequestResponses Cache::query_cache(Fetch::Infrastructure::Request const& request_query, Optional<CacheQueryOptions> const& options, Optional<Vector<RequestResponseList::Item> const&> target_storage) const
+{
+    // 1. Let resultList be an empty list.
+    RequestResponses result_list { heap() };
+
+    // 2. Let storage be null.
+    // 3. If the optional argument targetStorage is omitted, set storage to the relevant request response list.
+    // 4. Else, set storage to targetStorage.
+    auto const& storage = target_storage.has_value() ? *target_storage : m_request_response_list->items();
+
+    // 5. For each requestResponse of storage:
+    for (auto const& request_response : storage) {
+        // 1. Let cachedRequest be requestResponse’s request.
+        // 2. Let cachedResponse be requestResponse’s response.
+        // 3. If the result of running request matches cached item with requestQuery, cachedRequest, cachedResponse,
+        //    and options is true, then:
+        if (request_matches_cached_item(request_query, request_response.request, request_response.response, options)) {
+            // 1. Let requestCopy be a copy of cachedRequest.
+            // 2. Let responseCopy be a copy of cachedResponse.
+            // 3. Add requestCopy/responseCopy to resultList.
+            // NOTE: Copies are made of the responses once they are handed out, see copy_of_response().
+            result_list.append(request_response);
+        }
+    }
+
+    // 6. Return resultList.
+    return result_list;
+}
+
+// https://w3c.github.io/ServiceWorker/#batch-cache-operations
+WebIDL::ExceptionOr<Cache::RequestResponses> Cache::batch_cache_operations(Vector<BatchOperation> const& operations)
+{
+    // 1. Let cache be the relevant request response list.
+    auto& cache = m_request_response_list->items();
+
+    // 2. Let backupCache be a new request response list that is a copy of cache.
+    RequestResponses backup_cache { heap() };
+    backup_cache.extend(cache);
+
+    // 3. Let addedItems be an empty list.
+    Vector<RequestResponseList::Item> added_items;
+
+    // 4. Try running the following substeps atomically:
+    auto result = [&]() -> WebIDL::ExceptionOr<RequestResponses> {
+        // 1. Let resultList be an empty list.
+        RequestResponses result_list { heap() };
+
+        // 2. For each operation in operations:
+        for (auto const& operation : operations) {
+            // 1. If operation’s type matches neither "delete" nor "put", throw a TypeError.
+            // NOTE: This is ensured by our BatchOperation type.
+
+            // 2. If operation’s type matches "delete" and operation’s response is not null, throw a TypeError.
+            if (operation.type == BatchOperation::Type::Delete && operation.response)
+                return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Delete operation must not have a response"sv };
+
+            // 3. If the result of running Query Cache with operation’s request, operation’s options, and addedItems is
+            //    not empty, throw an "InvalidStateError" DOMException.
+            if (!query_cache(operation.request, operation.options, added_items).is_empty())
+                return WebIDL::InvalidStateError::create(realm(), "Operation conflicts with an earlier operation of the batch"_utf16);
+
+            // 4. Let requestResponses be an empty list.
+            RequestResponses request_responses { heap() };
+
+            // 5. If operation’s type matches "delete", then:
+            if (operation.type == BatchOperation::Type::Delete) {
+                // 1. Set requestResponses to the result of running Query Cache with operation’s request and operation’s
+                //    options.
+                request_responses = query_cache(operation.request, operation.options);
+
+                // 2. For each requestResponse in requestResponses:
+                //     1. Remove the item whose value matches requestResponse from cache.
+                for (auto const& request_response : request_responses) {
+                    cache.remove_first_matching([&](auto const& item) {
+                        return item.request == request_response.request && item.response == request_response.response;
+                    });
+                }
+            }
+            // 6. Else if operation’s type matches "put", then:
+            else {
+                // 1. If operation’s response is null, throw a TypeError.
+                if (!operation.response)
+                    return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Put operation must have a response"sv };
+
+                // 2. Let r be operation’s request's associated request.
+                auto const& request = operation.request;
+
+                // 3. If r’s url’s scheme is not one of "http" and "https", throw a TypeError.
+                if (!request->url().scheme().is_one_of("http"sv, "https"sv))
+                    return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Request URL must be HTTP(S)"sv };
+
+                // 4. If r’s method is not `GET`, throw a TypeError.
+                if (request->method() != "GET"sv.bytes())
+                    return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Request method must be GET"sv };
+
+                // 5. If operation’s options is not null, throw a TypeError.
+                if (operation.options.has_value())
+                    return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Put operation must not have options"sv };
+
+                // 6. Set requestResponses to the result of running Query Cache with operation’s request.
+                request_responses = query_cache(operation.request);
+
+                // 7. For each requestResponse in requestResponses:
+                //     1. Remove the item whose value matches requestResponse from cache.
+                for (auto const& request_response : request_responses) {
+                    cache.remove_first_matching([&](auto const& item) {
+                        return item.request == request_response.request && item.response == request_response.response;
+                    });
+                }
+
+                // 8. Append operation’s request/operation’s response to cache.
+                RequestResponseList::Item item { operation.request, *operation.response, operation.response_body_bytes };
+                cache.append(item);
+
+                // 9. If the cache write operation in the previous two steps failed due to exceeding the granted quota
+                //    limit, throw a "QuotaExceededError" DOMException.
+                // FIXME: Enforce a quota once caches are kept in a storage bottle.
+
+                // 10. Append operation’s request/operation’s response to addedItems.
+                added_items.append(move(item));
+            }
+
+            // 7. Append operation’s request/operation’s response to resultList.
+            // NOTE: Delete operations have no response, so we append the request responses they removed instead. This
+            //       lets Cache.delete() tell whether anything was deleted.
+            if (operation.type == BatchOperation::Type::Delete)
+                result_list.extend(request_responses);
+            else
+                result_list.append({ operation.request, *operation.response, operation.response_body_bytes });
+        }
+
+        // 3. Return resultList.
+        return result_list;
+    }();
+
+    // 5. And then, if an exception was thrown, then:
+    if (result.is_error()) {
+        // 1. Remove all the items from the relevant request response list.
+        cache.clear();
+
+        // 2. For each requestResponse of backupCache:
+        //     1. Append requestResponse to the relevant request response list.
+        cache.extend(backup_cache);
+
+        // 3. Throw the exception.
+        return result.release_error();
+    }
+
+    return result.release_value();
+
+// https://w3c.github.io/ServiceWorker/#cache-match
+GC::Ref<WebIDL::Promise> Cache::match(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    // 1. Let promise be the result of running the algorithm specified in matchAll(request, options) method with request
+    //    and options.
+    auto promise = match_all(request, options);
+
+    // 2. Return the result of reacting to promise with a fulfillment handler that, when called with argument responses,
+    //    performs the following substeps:
+    return WebIDL::upon_fulfillment(*promise, GC::create_function(heap(), [](JS::Value responses) -> WebIDL::ExceptionOr<JS::Value> {
+        // 1. If responses is not an empty list, return responses[0].
+        // 2. Return undefined.
+        // NOTE: Getting the first element of an empty array returns undefined.
+        return MUST(responses.as_object().get(0));
+    }));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-matchall
+GC::Ref<WebIDL::Promise> Cache::match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    GC::Ptr<Fetch::Infrastructure::Request> r;
+
+    // 2. If the optional argument request is not omitted, then:
+    if (request.has_value()) {
+        auto request_or_error = request_for_query(realm, *request, options);
+        if (request_or_error.is_error())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_or_error.release_error());
+
+        r = request_or_error.release_value();
+        if (!r)
+            return WebIDL::create_resolved_promise(realm, MUST(JS::Array::create(realm, 0)));
+    }
+
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, promise, r, options]() {
+        // 1. Let responses be an empty list.
+        RequestResponses request_responses { realm.heap() };
+
+        // 2. If the optional argument request is omitted, then:
+        //     1. For each requestResponse of the relevant request response list:
+        //         1. Add a copy of requestResponse’s response to responses.
+        if (!r) {
+            request_responses.extend(self->m_request_response_list->items());
+        }
+        // 3. Else:
+        //     1. Let requestResponses be the result of running Query Cache with r and options.
+        //     2. For each requestResponse of requestResponses:
+        //         1. Add a copy of requestResponse’s response to responses.
+        else {
+            request_responses = self->query_cache(*r, options);
+        }
+
+        // 4. For each response of responses:
+        //     1. If response’s type is "opaque" and cross-origin resource policy check with promise’s relevant settings
+        //        object’s origin, promise’s relevant settings object, "", and response’s internal response returns
+        //        blocked, then reject promise with a TypeError and abort these steps.
+        // FIXME: Implement the cross-origin resource policy check.
+
+        // 5. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation task
+        //    source, to perform the following steps:
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, request_responses = move(request_responses)]() {
+            HTML::TemporaryExecutionContext execution_context { realm };
+
+            // 1. Let responseList be a list.
+            GC::RootVector<JS::Value> response_list { realm.heap() };
+
+            // 2. For each response in responses:
+            //     1. Add a new Response object associated with response and a new Headers object whose guard is
+            //        "immutable" to responseList.
+            for (auto const& request_response : request_responses)
+                response_list.append(Fetch::Response::create(realm, copy_of_response(realm, request_response), Fetch::Headers::Guard::Immutable));
+
+            // 3. Resolve promise with a frozen array created from responseList, in realm.
+            WebIDL::resolve_promise(realm, promise, create_frozen_array(realm, response_list));
+        }));
+    }));
+
+    // 6. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-put
+GC::Ref<WebIDL::Promise> Cache::put(Fetch::RequestInfo const& request, GC::Ref<Fetch::Response> response)
+{
+    auto& realm = this->realm();
+
+    // 1. Let innerRequest be null.
+    GC::Ptr<Fetch::Infrastructure::Request> inner_request;
+
+    // 2. If request is a Request object, then set innerRequest to request’s request.
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+        inner_request = (*request_object)->request();
+    }
+    // 3. Otherwise:
+    else {
+        // 1. Let requestObj be the result of invoking Request’s constructor with request as its argument. If this throws
+        //    an exception, return a promise rejected with exception.
+        auto request_object = Fetch::Request::construct_impl(realm, request);
+        if (request_object.is_error())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_object.release_error());
+
+        // 2. Set innerRequest to requestObj’s request.
+        inner_request = request_object.value()->request();
+    }
+
+    // 4. If innerRequest’s url’s scheme is not one of "http" and "https", or innerRequest’s method is not `GET`, return a
+    //    promise rejected with a TypeError.
+    if (!inner_request->url().scheme().is_one_of("http"sv, "https"sv) || inner_request->method() != "GET"sv.bytes())
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Request must be a GET request with a scheme of 'http' or 'https'"sv));
+
+    // 5. Let innerResponse be response’s response.
+    auto inner_response = response->response();
+
+    // 6. If innerResponse’s status is 206, return a promise rejected with a TypeError.
+    if (inner_response->status() == 206)
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Partial responses cannot be cached"sv));
+
+    // 7. If innerResponse’s header list contains a header named `Vary`, then:
+    //     1. Let fieldValues be the list containing the items corresponding to the Vary header’s field-values.
+    //     2. For each fieldValue in fieldValues:
+    //         1. If fieldValue matches "*", return a promise rejected with a TypeError.
+    if (auto field_values = inner_response->header_list()->get_decode_and_split("Vary"sv.bytes()); field_values.has_value()) {
+        if (field_values->contains_slow("*"_string))
+            return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Responses that vary on '*' cannot be cached"sv));
+    }
+
+    // 8. If innerResponse’s body is disturbed or locked, return a promise rejected with a TypeError.
+    if (response->is_unusable())
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Response body is unusable"sv));
+
+    // 9. Let clonedResponse be a clone of innerResponse.
+    // NOTE: We store the bytes that we read from innerResponse’s body below with the cached response, rather than a clone
+    //       of its body. So we clone innerResponse without its body, which avoids teeing its stream.
+    auto body = inner_response->body();
+    inner_response->set_body(nullptr);
+    auto cloned_response = inner_response->clone(realm);
+    inner_response->set_body(body);
+
+    // 10. Let bodyReadPromise be a promise resolved with undefined.
+    // 11. If innerResponse’s body is non-null, run these substeps:
+    //     1. Let stream be innerResponse’s body’s stream.
+    //     2. Let reader be the result of getting a reader for stream.
+    //     3. Set bodyReadPromise to the result of reading all bytes from reader.
+    // NOTE: This ensures that innerResponse is locked, and we have a full buffered copy of the body.
+    // 12. Let operations be an empty list.
+    // 13. Let operation be a cache batch operation.
+    // 14. Set operation’s type to "put".
+    // 15. Set operation’s request to innerRequest.
+    // 16. Set operation’s response to clonedResponse.
+    // 17. Append operation to operations.
+    // 18. Let realm be this’s relevant realm.
+    // 19. Let cacheJobPromise be the result of reacting to bodyReadPromise with a fulfillment handler that, when called
+    //     with argument bytes, performs the following substeps:
+    //     1. Let promise be a new promise.
+    auto cache_job_promise = WebIDL::create_promise(realm);
+
+    auto store_response = GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, cache_job_promise, inner_request = GC::Ref { *inner_request }, cloned_response](Optional<ByteBuffer> bytes) {
+        // 2. Run the following substeps in parallel:
+        Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self, &realm, cache_job_promise, inner_request, cloned_response, bytes = move(bytes)]() mutable {
+            // 1. Let errorData be null.
+            Optional<WebIDL::Exception> error_data;
+
+            // 2. Invoke Batch Cache Operations with operations. If this throws an exception, set errorData to the
+            //    exception.
+            Vector<BatchOperation> operations;
+            operations.append({ .type = BatchOperation::Type::Put, .request = inner_request, .response = cloned_response, .response_body_bytes = move(bytes), .options = {} });
+
+            if (auto result = self->batch_cache_operations(operations); result.is_error())
+                error_data = result.release_error();
+
+            // 3. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM
+            //    manipulation task source, to perform the following substeps:
+            HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, cache_job_promise, error_data = move(error_data)]() mutable {
+                HTML::TemporaryExecutionContext execution_context { realm };
+
+                // 1. If errorData is null, resolve promise with undefined.
+                if (!error_data.has_value())
+                    WebIDL::resolve_promise(realm, cache_job_promise, JS::js_undefined());
+                // 2. Else, reject promise with errorData.
+                else
+                    WebIDL::reject_promise(realm, cache_job_promise, Bindings::exception_to_throw_completion(realm.vm(), error_data.release_value()).value());
+            }));
+        }));
+
+        // 3. Return promise.
+    });
+
+    if (body) {
+        auto process_body = GC::create_function(realm.heap(), [store_response](ByteBuffer bytes) {
+            store_response->function()(move(bytes));
+        });
+        auto process_body_error = GC::create_function(realm.heap(), [&realm, cache_job_promise](JS::Value error) {
+            WebIDL::reject_promise(realm, cache_job_promise, error);
+        });
+        body->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
+    } else {
+        store_response->function()({});
+    }
+
+    // 20. Return cacheJobPromise.
+    return cache_job_promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-delete
+GC::Ref<WebIDL::Promise> Cache::delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    // 2. If request is a Request object, then:
+    //     1. Set r to request’s request.
+    //     2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with false.
+    // 3. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor with
+    //        request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto request_or_error = request_for_query(realm, request, options);
+    if (request_or_error.is_error())
+        return WebIDL::create_rejected_promise_from_exception(realm, request_or_error.release_error());
+
+    auto r = request_or_error.release_value();
+    if (!r)
+        return WebIDL::create_resolved_promise(realm, JS::Value(false));
+
+    // 4. Let operations be an empty list.
+    // 5. Let operation be a cache batch operation.
+    // 6. Set operation’s type to "delete".
+    // 7. Set operation’s request to r.
+    // 8. Set operation’s options to options.
+    // 9. Append operation to operations.
+    // 10. Let cacheJobPromise be a new promise.
+    auto cache_job_promise = WebIDL::create_promise(realm);
+
+    // 11. Run the following substeps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, cache_job_promise, r = GC::Ref { *r }, options]() {
+        // 1. Let errorData be null.
+        Optional<WebIDL::Exception> error_data;
+
+        // 2. Let requestResponses be the result of running Batch Cache Operations with operations. If this throws an
+        //    exception, set errorData to the exception.
+        Vector<BatchOperation> operations;
+        operations.append({ .type = BatchOperation::Type::Delete, .request = r, .response = {}, .response_body_bytes = {}, .options = options });
+
+        bool deleted_any_request_response = false;
+        if (auto result = self->batch_cache_operations(operations); result.is_error())
+            error_data = result.release_error();
+        else
+            deleted_any_request_response = !result.value().is_empty();
+
+        // 3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+        //    manipulation task source, to perform the following substeps:
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, cache_job_promise, error_data = move(error_data), deleted_any_request_response]() mutable {
+            HTML::TemporaryExecutionContext execution_context { realm };
+
+            // 1. If errorData is null, then:
+            //     1. If requestResponses is not empty, resolve cacheJobPromise with true.
+            //     2. Else, resolve cacheJobPromise with false.
+            if (!error_data.has_value())
+                WebIDL::resolve_promise(realm, cache_job_promise, JS::Value(deleted_any_request_response));
+            // 2. Else, reject cacheJobPromise with errorData.
+            else
+                WebIDL::reject_promise(realm, cache_job_promise, Bindings::exception_to_throw_completion(realm.vm(), error_data.release_value()).value());
+        }));
+    }));
+
+    // 12. Return cacheJobPromise.
+    return cache_job_promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-keys
+GC::Ref<WebIDL::Promise> Cache::keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    GC::Ptr<Fetch::Infrastructure::Request> r;
+
+    // 2. If the optional argument request is not omitted, then:
+    //     1. If request is a Request object, then:
+    //         1. Set r to request’s request.
+    //         2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with an empty
+    //            array.
+    //     2. Else if request is a string, then:
+    //         1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+    //            with request as its argument. If this throws an exception, return a promise rejected with that
+    //            exception.
+    if (request.has_value()) {
+        auto request_or_error = request_for_query(realm, *request, options);
+        if (request_or_error.is_error())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_or_error.release_error());
+
+        r = request_or_error.release_value();
+        if (!r)
+            return WebIDL::create_resolved_promise(realm, MUST(JS::Array::create(realm, 0)));
+    }
+
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, promise, r, options]() {
+        // 1. Let requests be an empty list.
+        GC::ConservativeVector<GC::Ref<Fetch::Infrastructure::Request>> requests { realm.heap() };
+
+        // 2. If the optional argument request is omitted, then:
+        //     1. For each requestResponse of the relevant request response list:
+        //         1. Add requestResponse’s request to requests.
+        if (!r) {
+            for (auto const& request_response : self->m_request_response_list->items())
+                requests.append(request_response.request);
+        }
+        // 3. Else:
+        //     1. Let requestResponses be the result of running Query Cache with r and options.
+        //     2. For each requestResponse of requestResponses:
+        //         1. Add requestResponse’s request to requests.
+        else {
+            for (auto const& request_response : self->query_cache(*r, options))
+                requests.append(request_response.request);
+        }
+
+        // 4. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation task
+        //    source, to perform the following steps:
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, requests = move(requests)]() {
+            HTML::TemporaryExecutionContext execution_context { realm };
+
+            // 1. Let requestList be a list.
+            GC::RootVector<JS::Value> request_list { realm.heap() };
+
+            // 2. For each request of requests:
+            //     1. Add a new Request object associated with request and a new associated Headers object whose guard
+            //        is "immutable" to requestList.
+            for (auto const& request : requests)
+                request_list.append(Fetch::Request::create(realm, request, Fetch::Headers::Guard::Immutable, MUST(DOM::AbortSignal::construct_impl(realm))));
+
+            // 3. Resolve promise with a frozen array created from requestList, in realm.
+            WebIDL::resolve_promise(realm, promise, create_frozen_array(realm, request_list));
+        }));
+    }));
+
+    // 6. Return promise.
+    return promise;
+}
+
+}
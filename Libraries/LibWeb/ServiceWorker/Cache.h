@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGC/ConservativeVector.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Request.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dictdef-cachequeryoptions
+struct CacheQueryOptions {
+    bool ignore_search { false };
+    bool ignore_method { false };
+    bool ignore_vary { false };
+};
+
+// https://w3c.github.io/ServiceWorker/#request-response-list
+// A request response list is a list of pairs consisting of a request (a request) and a response (a response).
+class RequestResponseList final : public GC::Cell {
+    GC_CELL(RequestResponseList, GC::Cell);
+    GC_DECLARE_ALLOCATOR(RequestResponseList);
+
+public:
+    struct Item {
+        GC::Ref<Fetch::Infrastructure::Request> request;
+        GC::Ref<Fetch::Infrastructure::Response> response;
+
+        // NOTE: The response is kept without a body, and we keep the bytes of its body instead. That way, every copy of
+        //       the response gets a body with a stream of its own.
+        Optional<ByteBuffer> body_bytes;
+    };
+
+    [[nodiscard]] static GC::Ref<RequestResponseList> create(GC::Heap& heap) { return heap.allocate<RequestResponseList>(); }
+
+    Vector<Item>& items() { return m_items; }
+    Vector<Item> const& items() const { return m_items; }
+
+    virtual void visit_edges(Visitor&) override;
+
+private:
+    RequestResponseList() = default;
+
+    Vector<Item> m_items;
+};
+
+// https://w3c.github.io/ServiceWorker/#cache-interface
+class Cache final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Cache, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Cache);
+
+public:
+    [[nodiscard]] static GC::Ref<Cache> create(JS::Realm&, GC::Ref<RequestResponseList>);
+
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> match_all(Optional<Fetch::RequestInfo> const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> put(Fetch::RequestInfo const&, GC::Ref<Fetch::Response>);
+    GC::Ref<WebIDL::Promise> delete_(Fetch::RequestInfo const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> keys(Optional<Fetch::RequestInfo> const&, CacheQueryOptions const&);
+
+private:
+    // https://w3c.github.io/ServiceWorker/#cache-batch-operation
+    struct BatchOperation {
+        enum class Type {
+            Delete,
+            Put,
+        };
+
+        Type type;
+        GC::Ref<Fetch::Infrastructure::Request> request;
+        GC::Ptr<Fetch::Infrastructure::Response> response;
+        Optional<ByteBuffer> response_body_bytes;
+        Optional<CacheQueryOptions> options;
+    };
+
+    Cache(JS::Realm&, GC::Ref<RequestResponseList>);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Visitor&) override;
+
+    using RequestResponses = GC::ConservativeVector<RequestResponseList::Item>;
+
+    RequestResponses query_cache(Fetch::Infrastructure::Request const& request_query, Optional<CacheQueryOptions> const& = {}, Optional<Vector<RequestResponseList::Item> const&> target_storage = {}) const;
+    WebIDL::ExceptionOr<RequestResponses> batch_cache_operations(Vector<BatchOperation> const&);
+
+    // https://w3c.github.io/ServiceWorker/#dfn-relevant-request-response-list
+    GC::Ref<RequestResponseList> m_request_response_list;
+};
+
+}
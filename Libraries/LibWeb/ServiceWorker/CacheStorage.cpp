@@ -4,8 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/Array.h>
 #include <LibWeb/Bindings/CacheStoragePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/ServiceWorker/Cache.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
 #include <LibWeb/WebIDL/Promise.h>
 
@@ -24,17 +29,174 @@ void CacheStorage::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(CacheStorage);
 }
 
-// https://w3c.github.io/ServiceWorker/#cache-storage-open
-GC::Ref<WebIDL::Promise> CacheStorage::open(String const&)
+void CacheStorage::visit_edges(Visitor& visitor)
 {
-    return WebIDL::create_rejected_promise(realm(), WebIDL::NotSupportedError::create(realm(), "CacheStorage.open() is not yet implemented"_utf16));
+    Base::visit_edges(visitor);
+    for (auto const& [cache_name, cache] : m_name_to_cache_map)
+        visitor.visit(cache);
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-match
+GC::Ref<WebIDL::Promise> CacheStorage::match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. If options["cacheName"] exists, then:
+    if (options.cache_name.has_value()) {
+        // 1. Return a new promise promise and run the following substeps in parallel:
+        //     1. For each cacheName → cache of the relevant name to cache map:
+        //         1. If options["cacheName"] matches cacheName, then:
+        //             1. Resolve promise with the result of running the algorithm specified in match(request, options)
+        //                method of Cache interface with request and options (providing cache as thisArgument to the
+        //                [[Call]] internal method of match(request, options).)
+        //             2. Abort these steps.
+        //     2. Resolve promise with undefined.
+        // NOTE: The Cache object's match() runs its own steps in parallel, so we can find the cache right away.
+        if (auto cache = m_name_to_cache_map.get(*options.cache_name); cache.has_value())
+            return Cache::create(realm, *cache)->match(request, options);
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    }
+
+    // 2. Else:
+    //     1. Let promise be a promise resolved with undefined.
+    auto promise = WebIDL::create_resolved_promise(realm, JS::js_undefined());
+
+    //     2. For each cacheName → cache of the relevant name to cache map:
+    for (auto const& [cache_name, cache] : m_name_to_cache_map) {
+        // 1. Set promise to the result of reacting to itself with a fulfillment handler that, when called with argument
+        //    response, performs the following substeps:
+        promise = WebIDL::upon_fulfillment(*promise, GC::create_function(realm.heap(), [&realm, cache, request = Fetch::RequestInfo { request }, options](JS::Value response) -> WebIDL::ExceptionOr<JS::Value> {
+            // 1. If response is not undefined, return response.
+            if (!response.is_undefined())
+                return response;
+
+            // 2. Return the result of running the algorithm specified in match(request, options) method of Cache
+            //    interface with request and options as the arguments (providing cache as thisArgument to the [[Call]]
+            //    internal method of match(request, options).)
+            return Cache::create(realm, cache)->match(request, options)->promise().ptr();
+        }));
+    }
+
+    //     3. Return promise.
+    return promise;
 }
 
 // https://w3c.github.io/ServiceWorker/#cache-storage-has
-GC::Ref<WebIDL::Promise> CacheStorage::has(String const&)
+GC::Ref<WebIDL::Promise> CacheStorage::has(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, promise, cache_name]() {
+        // 1. For each key → value of the relevant name to cache map:
+        //     1. If cacheName matches key, resolve promise with true and abort these steps.
+        // 2. Resolve promise with false.
+        auto has_cache = self->m_name_to_cache_map.contains(cache_name);
+
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, has_cache]() {
+            HTML::TemporaryExecutionContext execution_context { realm };
+            WebIDL::resolve_promise(realm, promise, JS::Value(has_cache));
+        }));
+    }));
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-open
+GC::Ref<WebIDL::Promise> CacheStorage::open(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, promise, cache_name]() {
+        // 1. For each key → value of the relevant name to cache map:
+        //     1. If cacheName matches key, then:
+        //         1. Resolve promise with a new Cache object that represents value.
+        //         2. Abort these steps.
+        // 2. Let cache be a new request response list.
+        // 3. Set the relevant name to cache map[cacheName] to cache. If this cache write operation failed due to
+        //    exceeding the granted quota limit, reject promise with a "QuotaExceededError" DOMException and abort these
+        //    steps.
+        // 4. Resolve promise with a new Cache object that represents cache.
+        auto cache = self->m_name_to_cache_map.ensure(cache_name, [&] {
+            return RequestResponseList::create(realm.heap());
+        });
+
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, cache]() {
+            HTML::TemporaryExecutionContext execution_context { realm };
+            WebIDL::resolve_promise(realm, promise, Cache::create(realm, cache));
+        }));
+    }));
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-delete
+GC::Ref<WebIDL::Promise> CacheStorage::delete_(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    // 1. Let cacheExists be the result of running the algorithm specified in has(cacheName) method with cacheName.
+    // 2. Let cacheJobPromise be a new promise.
+    auto cache_job_promise = WebIDL::create_promise(realm);
+
+    // 3. Run the following substeps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, cache_job_promise, cache_name]() {
+        // 1. If cacheExists is false, then:
+        //     1. Resolve cacheJobPromise with false.
+        //     2. Abort these steps.
+        // 2. Let cacheJobPromise be the result of running the following substeps:
+        //     1. Remove the relevant name to cache map[cacheName].
+        //     2. Resolve cacheJobPromise with true.
+        // NOTE: The cache's request responses stay alive for as long as Cache objects that represent it do.
+        auto cache_existed = self->m_name_to_cache_map.remove(cache_name);
+
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, cache_job_promise, cache_existed]() {
+            HTML::TemporaryExecutionContext execution_context { realm };
+            WebIDL::resolve_promise(realm, cache_job_promise, JS::Value(cache_existed));
+        }));
+    }));
+
+    // 4. Return cacheJobPromise.
+    return cache_job_promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-keys
+GC::Ref<WebIDL::Promise> CacheStorage::keys()
 {
-    dbgln("FIXME: CacheStorage::has() is not implemented yet");
-    return WebIDL::create_rejected_promise(realm(), JS::Value(false));
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Run the following substeps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [self = GC::Ref { *this }, &realm, promise]() {
+        // 1. Let cacheKeys be the result of running getting the keys on the relevant name to cache map.
+        // NOTE: The keys in the result ordered set are ordered in the order that their corresponding entries were added
+        //       to the name to cache map.
+        auto cache_keys = self->m_name_to_cache_map.keys();
+
+        // 2. Resolve promise with cacheKeys.
+        HTML::queue_global_task(HTML::Task::Source::DOMManipulation, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, cache_keys = move(cache_keys)]() {
+            HTML::TemporaryExecutionContext execution_context { realm };
+
+            auto array = JS::Array::create_from<String>(realm, cache_keys.span(), [&](auto const& key) -> JS::Value {
+                return JS::PrimitiveString::create(realm.vm(), key);
+            });
+            WebIDL::resolve_promise(realm, promise, array);
+        }));
+    }));
+
+    // 3. Return promise.
+    return promise;
 }
 
 }
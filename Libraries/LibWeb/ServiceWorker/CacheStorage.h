@@ -6,24 +6,41 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/ServiceWorker/Cache.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::ServiceWorker {
 
+// https://w3c.github.io/ServiceWorker/#dictdef-multicachequeryoptions
+struct MultiCacheQueryOptions : public CacheQueryOptions {
+    Optional<String> cache_name;
+};
+
 // https://w3c.github.io/ServiceWorker/#cachestorage-interface
 class CacheStorage : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(CacheStorage, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(CacheStorage);
 
 public:
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const&, MultiCacheQueryOptions const&);
     GC::Ref<WebIDL::Promise> has(String const& cache_name);
     GC::Ref<WebIDL::Promise> open(String const& cache_name);
+    GC::Ref<WebIDL::Promise> delete_(String const& cache_name);
+    GC::Ref<WebIDL::Promise> keys();
 
 private:
     explicit CacheStorage(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Visitor&) override;
+
+    // https://w3c.github.io/ServiceWorker/#relevant-name-to-cache-map
+    // FIXME: The relevant name to cache map is the map of the "caches" storage bottle of our environment, so that it is
+    //        shared with every environment of the same storage key and persisted. For now, each global keeps its own
+    //        map in memory.
+    OrderedHashMap<String, GC::Ref<RequestResponseList>> m_name_to_cache_map;
 };
 
 }
@@ -8,6 +8,7 @@
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/StorageAPI/StorageBottle.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWeb/StorageAPI/StorageShed.h>
@@ -104,34 +105,140 @@ void LocalStorageBottle::visit_edges(GC::Cell::Visitor& visitor)
     visitor.visit(m_page);
 }
 
+// The items of the local storage bottles used by this process, by storage key, so that reading them doesn't need a
+// round trip to the storage jar in the browser process. Changes are applied to these right away, and are sent to the
+// storage jar in a single batch once the current task is done.
+struct CachedLocalStorageItems {
+    // The bottle's map, or nothing if it has to be requested from the storage jar again.
+    Optional<OrderedHashMap<String, String>> items;
+    u64 size_in_bytes { 0 };
+
+    // The changes that have not been sent to the storage jar yet. Removed items have no value.
+    OrderedHashMap<String, Optional<String>> pending_changes;
+    bool flush_scheduled { false };
+};
+
+static HashMap<String, CachedLocalStorageItems>& cached_local_storage_items()
+{
+    static HashMap<String, CachedLocalStorageItems> cached_items;
+    return cached_items;
+}
+
+static u64 item_size_in_bytes(String const& key, String const& value)
+{
+    return key.bytes().size() + value.bytes().size();
+}
+
+void LocalStorageBottle::discard_cached_items(String const& storage_key)
+{
+    // NOTE: Pending changes are kept, and are applied on top of the items once they are requested again.
+    if (auto cached_items = cached_local_storage_items().find(storage_key); cached_items != cached_local_storage_items().end())
+        cached_items->value.items.clear();
+}
+
+CachedLocalStorageItems& LocalStorageBottle::cached_items() const
+{
+    auto storage_key = m_storage_key.to_string();
+    auto& cached_items = cached_local_storage_items().ensure(storage_key);
+
+    if (!cached_items.items.has_value()) {
+        auto items = m_page->client().page_did_request_storage_items(StorageEndpointType::LocalStorage, storage_key);
+
+        for (auto const& [key, value] : cached_items.pending_changes) {
+            if (value.has_value())
+                items.set(key, *value);
+            else
+                items.remove(key);
+        }
+
+        cached_items.size_in_bytes = 0;
+        for (auto const& [key, value] : items)
+            cached_items.size_in_bytes += item_size_in_bytes(key, value);
+
+        cached_items.items = move(items);
+    }
+
+    return cached_items;
+}
+
+void LocalStorageBottle::schedule_flush(CachedLocalStorageItems& cached_items)
+{
+    if (cached_items.flush_scheduled)
+        return;
+    cached_items.flush_scheduled = true;
+
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [page = m_page, storage_key = m_storage_key.to_string()]() {
+        auto cached_items = cached_local_storage_items().find(storage_key);
+        if (cached_items == cached_local_storage_items().end())
+            return;
+
+        cached_items->value.flush_scheduled = false;
+        if (cached_items->value.pending_changes.is_empty())
+            return;
+
+        auto changes = move(cached_items->value.pending_changes);
+        cached_items->value.pending_changes = {};
+        page->client().page_did_update_storage_items(StorageEndpointType::LocalStorage, storage_key, move(changes));
+    }));
+}
+
 size_t LocalStorageBottle::size() const
 {
-    return m_page->client().page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string()).size();
+    return cached_items().items->size();
 }
 
 Vector<String> LocalStorageBottle::keys() const
 {
-    return m_page->client().page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string());
+    return cached_items().items->keys();
 }
 
 Optional<String> LocalStorageBottle::get(String const& key) const
 {
-    return m_page->client().page_did_request_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key);
+    return cached_items().items->get(key).copy();
 }
 
 WebView::StorageOperationError LocalStorageBottle::set(String const& key, String const& value)
 {
-    return m_page->client().page_did_set_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key, value);
+    auto& cached_items = this->cached_items();
+
+    auto size_in_bytes = cached_items.size_in_bytes + item_size_in_bytes(key, value);
+    if (auto old_value = cached_items.items->get(key); old_value.has_value())
+        size_in_bytes -= item_size_in_bytes(key, *old_value);
+
+    if (m_quota.has_value() && size_in_bytes > *m_quota)
+        return WebView::StorageOperationError::QuotaExceededError;
+
+    cached_items.items->set(key, value);
+    cached_items.size_in_bytes = size_in_bytes;
+
+    cached_items.pending_changes.set(key, value);
+    schedule_flush(cached_items);
+
+    return WebView::StorageOperationError::None;
 }
 
 void LocalStorageBottle::clear()
 {
-    m_page->client().page_did_clear_storage(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string());
+    auto& cached_items = cached_local_storage_items().ensure(m_storage_key.to_string());
+    cached_items.items = OrderedHashMap<String, String> {};
+    cached_items.size_in_bytes = 0;
+
+    // NOTE: Clearing the storage jar supersedes any changes that have not been sent to it yet.
+    cached_items.pending_changes.clear();
+    m_page->client().page_did_clear_storage(StorageEndpointType::LocalStorage, m_storage_key.to_string());
 }
 
 void LocalStorageBottle::remove(String const& key)
 {
-    m_page->client().page_did_remove_storage_item(Web::StorageAPI::StorageEndpointType::LocalStorage, m_storage_key.to_string(), key);
+    auto& cached_items = this->cached_items();
+
+    auto old_value = cached_items.items->take(key);
+    if (!old_value.has_value())
+        return;
+    cached_items.size_in_bytes -= item_size_in_bytes(key, *old_value);
+
+    cached_items.pending_changes.set(key, OptionalNone {});
+    schedule_flush(cached_items);
 }
 
 size_t SessionStorageBottle::size() const
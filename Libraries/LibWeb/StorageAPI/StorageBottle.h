@@ -19,6 +19,8 @@
 
 namespace Web::StorageAPI {
 
+struct CachedLocalStorageItems;
+
 // https://storage.spec.whatwg.org/#storage-bottle
 class StorageBottle : public GC::Cell {
     GC_CELL(StorageBottle, GC::Cell);
@@ -68,6 +70,9 @@ public:
 
     virtual void visit_edges(GC::Cell::Visitor& visitor) override;
 
+    // Called when another process has changed the items of the given storage key.
+    static void discard_cached_items(String const& storage_key);
+
 private:
     explicit LocalStorageBottle(GC::Ref<Page> page, StorageKey key, Optional<u64> quota)
         : StorageBottle(quota)
@@ -76,6 +81,9 @@ private:
     {
     }
 
+    CachedLocalStorageItems& cached_items() const;
+    void schedule_flush(CachedLocalStorageItems&);
+
     GC::Ref<Page> m_page;
     StorageKey m_storage_key;
 };
@@ -301,11 +301,10 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     auto pull_size = min(available, desired_size);
 
     // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
-
     // 7. Remove the first pullSize bytes from bytes.
-    if (pull_size != available)
-        bytes = MUST(bytes.slice(pull_size, available - pull_size));
+    // NOTE: Rather than copying bytes into a separate buffer, we write it straight into the BYOB request view, or hand
+    //       it over to the Uint8Array as a whole (pullSize is only smaller than the available length for BYOB reads).
+    auto pulled = bytes.bytes().trim(pull_size);
 
     // 8. If stream’s current BYOB request view is non-null, then:
     if (auto byob_view = current_byob_request_view()) {
@@ -314,11 +313,20 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
 
         // 2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
         TRY(readable_byte_stream_controller_respond(controller, pull_size));
+
+        // AD-HOC: The spec leaves the remaining bytes in the caller's buffer, to be pulled later. Our callers only hand
+        //         us each chunk of data once, so enqueue the remaining bytes instead of dropping them.
+        if (pull_size != available) {
+            auto remaining_bytes = MUST(ByteBuffer::copy(bytes.bytes().slice(pull_size)));
+            auto array_buffer = JS::ArrayBuffer::create(realm, move(remaining_bytes));
+            auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
+            TRY(readable_byte_stream_controller_enqueue(controller, view));
+        }
     }
     // 9. Otherwise,
     else {
         // 1. Set view to the result of creating a Uint8Array from pulled in stream’s relevant Realm.
-        auto array_buffer = JS::ArrayBuffer::create(realm, move(pulled));
+        auto array_buffer = JS::ArrayBuffer::create(realm, move(bytes));
         auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
         // 2. Perform ? ReadableByteStreamControllerEnqueue(stream.[[controller]], view).
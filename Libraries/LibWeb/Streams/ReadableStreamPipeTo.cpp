@@ -102,6 +102,10 @@ void ReadableStreamPipeTo::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_signal);
     visitor.visit(m_pending_writes);
     visitor.visit(m_unwritten_chunks);
+    visitor.visit(m_read_request);
+    visitor.visit(m_on_writer_ready);
+    visitor.visit(m_on_promise_settled);
+    visitor.visit(m_write_chunk_steps);
 }
 
 void ReadableStreamPipeTo::process()
@@ -109,6 +113,9 @@ void ReadableStreamPipeTo::process()
     if (check_for_error_and_close_states())
         return;
 
+    if (!m_read_request)
+        create_callbacks();
+
     auto ready_promise = m_writer->ready();
 
     if (ready_promise && WebIDL::is_promise_fulfilled(*ready_promise)) {
@@ -116,20 +123,52 @@ void ReadableStreamPipeTo::process()
         return;
     }
 
-    auto when_ready = GC::create_function(m_realm->heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
-        read_chunk();
+    if (ready_promise)
+        WebIDL::react_to_promise(*ready_promise, *m_on_writer_ready, *m_on_promise_settled);
+}
+
+// OPTIMIZATION: Every chunk that is piped goes through the same read request and callbacks, so we only create them
+//               once, rather than allocating a new set of GC functions for each chunk. Similarly, we only react to the
+//               reader's and writer's closed promises once, rather than adding another reaction for every chunk.
+void ReadableStreamPipeTo::create_callbacks()
+{
+    m_on_promise_settled = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        check_for_error_and_close_states();
         return JS::js_undefined();
     });
 
-    auto shutdown = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
-        check_for_error_and_close_states();
+    m_on_writer_ready = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        read_chunk();
         return JS::js_undefined();
     });
 
-    if (ready_promise)
-        WebIDL::react_to_promise(*ready_promise, when_ready, shutdown);
+    m_write_chunk_steps = GC::create_function(heap(), [this]() {
+        HTML::TemporaryExecutionContext execution_context { m_realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+        write_chunk();
+        process();
+    });
+
+    auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
+        m_unwritten_chunks.append(chunk);
+
+        if (check_for_error_and_close_states())
+            return;
+
+        HTML::queue_a_microtask(nullptr, *m_write_chunk_steps);
+    });
+
+    auto on_complete = GC::create_function(heap(), [this]() {
+        if (!check_for_error_and_close_states())
+            finish();
+    });
+
+    // NOTE: Only one read is ever outstanding at a time, so the read request may be reused for every chunk.
+    m_read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, *m_on_promise_settled);
+
     if (auto promise = m_reader->closed())
-        WebIDL::react_to_promise(*promise, shutdown, shutdown);
+        WebIDL::react_to_promise(*promise, *m_on_promise_settled, *m_on_promise_settled);
+    if (auto promise = m_writer->closed())
+        WebIDL::react_to_promise(*promise, *m_on_promise_settled, *m_on_promise_settled);
 }
 
 void ReadableStreamPipeTo::set_abort_signal(GC::Ref<DOM::AbortSignal> signal, DOM::AbortSignal::AbortSignal::AbortAlgorithmID signal_id)
@@ -217,34 +256,7 @@ void ReadableStreamPipeTo::read_chunk()
     if (check_for_error_and_close_states())
         return;
 
-    auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
-        m_unwritten_chunks.append(chunk);
-
-        if (check_for_error_and_close_states())
-            return;
-
-        HTML::queue_a_microtask(nullptr, GC::create_function(m_realm->heap(), [this]() {
-            HTML::TemporaryExecutionContext execution_context { m_realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
-            write_chunk();
-            process();
-        }));
-    });
-
-    auto on_complete = GC::create_function(heap(), [this]() {
-        if (!check_for_error_and_close_states())
-            finish();
-    });
-
-    auto shutdown = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
-        check_for_error_and_close_states();
-        return JS::js_undefined();
-    });
-
-    auto read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, shutdown);
-    readable_stream_default_reader_read(m_reader, read_request);
-
-    if (auto promise = m_writer->closed())
-        WebIDL::react_to_promise(*promise, shutdown, shutdown);
+    readable_stream_default_reader_read(m_reader, *m_read_request);
 }
 
 void ReadableStreamPipeTo::write_chunk()
@@ -258,6 +270,12 @@ void ReadableStreamPipeTo::write_chunk()
     auto promise = writable_stream_default_writer_write(m_writer, m_unwritten_chunks.take_first());
     WebIDL::mark_promise_as_handled(promise);
 
+    // NOTE: We only need to wait for writes which have not completed yet, so drop those that have, rather than keeping
+    //       every chunk's promise alive until the pipe is finished.
+    m_pending_writes.remove_all_matching([](auto const& pending_write) {
+        return WebIDL::is_promise_fulfilled(pending_write);
+    });
+
     m_pending_writes.append(promise);
 }
 
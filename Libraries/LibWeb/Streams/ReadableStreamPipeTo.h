@@ -7,14 +7,18 @@
 #pragma once
 
 #include <AK/Vector.h>
+#include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/DOM/AbortSignal.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::Streams::Detail {
 
+class ReadableStreamPipeToReadRequest;
+
 // https://streams.spec.whatwg.org/#ref-for-in-parallel
 class ReadableStreamPipeTo final : public JS::Cell {
     GC_CELL(ReadableStreamPipeTo, JS::Cell);
@@ -42,6 +46,8 @@ private:
 
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
+    void create_callbacks();
+
     void read_chunk();
     void write_chunk();
 
@@ -71,6 +77,12 @@ private:
     Vector<GC::Ref<WebIDL::Promise>> m_pending_writes;
     Vector<JS::Value, 1> m_unwritten_chunks;
 
+    using OnPromiseSettled = GC::Function<WebIDL::ExceptionOr<JS::Value>(JS::Value)>;
+    GC::Ptr<ReadableStreamPipeToReadRequest> m_read_request;
+    GC::Ptr<OnPromiseSettled> m_on_writer_ready;
+    GC::Ptr<OnPromiseSettled> m_on_promise_settled;
+    GC::Ptr<GC::Function<void()>> m_write_chunk_steps;
+
     bool m_prevent_close { false };
     bool m_prevent_abort { false };
     bool m_prevent_cancel { false };
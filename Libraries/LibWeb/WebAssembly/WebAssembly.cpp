@@ -9,6 +9,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -70,6 +71,16 @@ void visit_edges(JS::Object& object, JS::Cell::Visitor& visitor)
     }
 }
 
+size_t total_memory_size_in_bytes()
+{
+    size_t size = 0;
+    for (auto& it : Detail::s_caches) {
+        for (auto const& memory : it.value.abstract_machine().store().memories())
+            size += memory.size();
+    }
+    return size;
+}
+
 void finalize(JS::Object& object)
 {
     auto& global_object = HTML::relevant_global_object(object);
@@ -418,20 +429,85 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
 
 // // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
 // https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
+// NOTE: Validated modules are immutable (apart from lazily compiled function bodies), so they can be shared between
+//       realms. Keep the most recently compiled large ones around, so that reloading a page, or compiling the same
+//       module in another frame, skips parsing and validation entirely.
+static constexpr size_t compiled_module_cache_minimum_size_in_bytes = 64 * KiB;
+static constexpr size_t compiled_module_cache_maximum_size_in_bytes = 128 * MiB;
+
+struct CachedCompiledModule {
+    ::Crypto::Hash::SHA256::DigestType digest;
+    size_t size_in_bytes { 0 };
+    NonnullRefPtr<Wasm::Module> module;
+};
+
+// NOTE: Ordered from least to most recently used.
+static Vector<CachedCompiledModule> s_compiled_module_cache;
+static size_t s_compiled_module_cache_size_in_bytes { 0 };
+
+static RefPtr<Wasm::Module> find_cached_compiled_module(::Crypto::Hash::SHA256::DigestType const& digest, size_t size_in_bytes)
+{
+    for (size_t i = 0; i < s_compiled_module_cache.size(); ++i) {
+        auto& entry = s_compiled_module_cache[i];
+        if (entry.size_in_bytes != size_in_bytes || entry.digest != digest)
+            continue;
+
+        auto cached_module = s_compiled_module_cache.take(i);
+        auto module = cached_module.module;
+        s_compiled_module_cache.append(move(cached_module));
+        return module;
+    }
+
+    return {};
+}
+
+static void cache_compiled_module(::Crypto::Hash::SHA256::DigestType const& digest, size_t size_in_bytes, NonnullRefPtr<Wasm::Module> module)
+{
+    if (size_in_bytes > compiled_module_cache_maximum_size_in_bytes)
+        return;
+
+    s_compiled_module_cache_size_in_bytes += size_in_bytes;
+    s_compiled_module_cache.append({
+        .digest = digest,
+        .size_in_bytes = size_in_bytes,
+        .module = move(module),
+    });
+
+    while (s_compiled_module_cache_size_in_bytes > compiled_module_cache_maximum_size_in_bytes) {
+        auto evicted_module = s_compiled_module_cache.take_first();
+        s_compiled_module_cache_size_in_bytes -= evicted_module.size_in_bytes;
+    }
+}
+
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
+    auto& cache = get_cache(*vm.current_realm());
+
+    Optional<::Crypto::Hash::SHA256::DigestType> digest;
+    if (data.size() >= compiled_module_cache_minimum_size_in_bytes) {
+        digest = ::Crypto::Hash::SHA256::hash(data);
+        if (auto module = find_cached_compiled_module(*digest, data.size())) {
+            auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module.release_nonnull());
+            cache.add_compiled_module(compiled_module);
+            return compiled_module;
+        }
+    }
+
     FixedMemoryStream stream { data.bytes() };
     auto module_result = Wasm::Module::parse(stream);
     if (module_result.is_error()) {
         return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
 
-    auto& cache = get_cache(*vm.current_realm());
     if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
         return vm.throw_completion<CompileError>(validation_result.error().error_string);
     }
+
+    if (digest.has_value())
+        cache_compiled_module(*digest, data.size(), module_result.value());
+
     auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
     cache.add_compiled_module(compiled_module);
     return compiled_module;
@@ -860,11 +936,21 @@ GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::
         auto body_fulfillment_steps = GC::create_function(vm.heap(), [&vm, return_value](JS::Value body_array_buffer) -> WebIDL::ExceptionOr<JS::Value> {
             // 1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
             VERIFY(body_array_buffer.is_object());
-            auto stable_bytes = WebIDL::get_buffer_source_copy(body_array_buffer.as_object());
-            if (stable_bytes.is_error()) {
-                VERIFY(stable_bytes.error().code() == ENOMEM);
-                WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)).value());
-                return JS::js_undefined();
+
+            // OPTIMIZATION: bodyArrayBuffer was created by consuming response's body, and is only reachable from this
+            //               reaction. Nothing can observe it afterwards, so take its bytes instead of copying them.
+            Optional<ByteBuffer> stable_bytes;
+            if (auto* array_buffer = as_if<JS::ArrayBuffer>(body_array_buffer.as_object()))
+                stable_bytes = array_buffer->take_owned_buffer_and_detach();
+
+            if (!stable_bytes.has_value()) {
+                auto stable_bytes_or_error = WebIDL::get_buffer_source_copy(body_array_buffer.as_object());
+                if (stable_bytes_or_error.is_error()) {
+                    VERIFY(stable_bytes_or_error.error().code() == ENOMEM);
+                    WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)).value());
+                    return JS::js_undefined();
+                }
+                stable_bytes = stable_bytes_or_error.release_value();
             }
 
             // 2. Asynchronously compile the WebAssembly module stableBytes using the networking task source and resolve returnValue with the result.
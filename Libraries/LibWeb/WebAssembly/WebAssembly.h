@@ -23,6 +23,9 @@ void visit_edges(JS::Object&, JS::Cell::Visitor&);
 void finalize(JS::Object&);
 void initialize(JS::Object&, JS::Realm&);
 
+// The size of the linear memories of all WebAssembly instances in this process. Used for memory reports.
+size_t total_memory_size_in_bytes();
+
 bool validate(JS::VM&, GC::Root<WebIDL::BufferSource>& bytes);
 WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> compile(JS::VM&, GC::Root<WebIDL::BufferSource>& bytes);
 WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> compile_streaming(JS::VM&, GC::Root<WebIDL::Promise> source);
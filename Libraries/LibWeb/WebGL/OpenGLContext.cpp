@@ -39,6 +39,12 @@ struct OpenGLContext::Impl {
 #endif
 };
 
+#ifdef AK_OS_MACOS
+// The context that was last made current. WebGL contexts are only used on the main thread, so this is the context
+// that is current on it.
+static OpenGLContext* s_current_context { nullptr };
+#endif
+
 OpenGLContext::OpenGLContext(NonnullRefPtr<Gfx::SkiaBackendContext> skia_backend_context, Impl impl, WebGLVersion webgl_version)
     : m_skia_backend_context(move(skia_backend_context))
     , m_impl(make<Impl>(impl))
@@ -50,6 +56,7 @@ OpenGLContext::~OpenGLContext()
 {
 #ifdef AK_OS_MACOS
     eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    s_current_context = nullptr;
     glDeleteFramebuffers(1, &m_impl->framebuffer);
     glDeleteRenderbuffers(1, &m_impl->depth_buffer);
     eglDestroyContext(m_impl->display, m_impl->context);
@@ -207,6 +214,7 @@ void OpenGLContext::allocate_painting_surface_if_needed()
     m_impl->surface = eglCreatePbufferFromClientBuffer(display, EGL_IOSURFACE_ANGLE, iosurface.core_foundation_pointer(), config, surface_attributes);
 
     eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    s_current_context = this;
 
     EGLint texture_target_name = 0;
     eglGetConfigAttrib(display, config, EGL_BIND_TO_TEXTURE_TARGET_ANGLE, &texture_target_name);
@@ -245,7 +253,14 @@ void OpenGLContext::make_current()
 {
 #ifdef AK_OS_MACOS
     allocate_painting_surface_if_needed();
+
+    // OPTIMIZATION: Every WebGL call makes its context current first, and making a context current takes a lock and
+    //               validates the context and surface in ANGLE. Most of the time, the context is already current.
+    if (s_current_context == this)
+        return;
+
     eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    s_current_context = this;
 #endif
 }
 
@@ -92,7 +92,7 @@ void XMLDocumentBuilder::set_doctype(XML::Doctype doctype)
     m_document->insert_before(document_type, m_document->first_child(), false);
 }
 
-void XMLDocumentBuilder::element_start(const XML::Name& name, HashMap<XML::Name, ByteString> const& attributes)
+void XMLDocumentBuilder::element_start(const XML::Name& name, ReadonlySpan<XML::Attribute> attributes)
 {
     if (m_has_error)
         return;
@@ -158,24 +158,24 @@ void XMLDocumentBuilder::element_start(const XML::Name& name, HashMap<XML::Name,
     }
 
     for (auto const& attribute : attributes) {
-        if (attribute.key == "xmlns" || attribute.key.starts_with("xmlns:"sv)) {
+        if (attribute.name == "xmlns" || attribute.name.starts_with("xmlns:"sv)) {
             // The prefix xmlns is used only to declare namespace bindings and is by definition bound to the namespace name http://www.w3.org/2000/xmlns/.
-            if (!attribute.key.is_one_of("xmlns:"sv, "xmlns:xmlns"sv)) {
-                if (!node->set_attribute_ns(Namespace::XMLNS, MUST(String::from_byte_string(attribute.key)), MUST(String::from_byte_string(attribute.value))).is_error())
+            if (!attribute.name.is_one_of("xmlns:"sv, "xmlns:xmlns"sv)) {
+                if (!node->set_attribute_ns(Namespace::XMLNS, MUST(String::from_byte_string(attribute.name)), MUST(String::from_byte_string(attribute.value))).is_error())
                     continue;
             }
             m_has_error = true;
-        } else if (attribute.key.contains(':')) {
-            if (auto ns = namespace_for_name(attribute.key); ns.has_value()) {
-                if (!node->set_attribute_ns(ns.value(), MUST(String::from_byte_string(attribute.key)), MUST(String::from_byte_string(attribute.value))).is_error())
+        } else if (attribute.name.contains(':')) {
+            if (auto ns = namespace_for_name(attribute.name); ns.has_value()) {
+                if (!node->set_attribute_ns(ns.value(), MUST(String::from_byte_string(attribute.name)), MUST(String::from_byte_string(attribute.value))).is_error())
                     continue;
-            } else if (attribute.key.starts_with("xml:"sv)) {
-                if (auto maybe_error = node->set_attribute_ns(Namespace::XML, MUST(String::from_byte_string(attribute.key)), MUST(String::from_byte_string(attribute.value))); !maybe_error.is_error())
+            } else if (attribute.name.starts_with("xml:"sv)) {
+                if (auto maybe_error = node->set_attribute_ns(Namespace::XML, MUST(String::from_byte_string(attribute.name)), MUST(String::from_byte_string(attribute.value))); !maybe_error.is_error())
                     continue;
             }
             m_has_error = true;
         } else {
-            if (!node->set_attribute(MUST(String::from_byte_string(attribute.key)), MUST(String::from_byte_string(attribute.value))).is_error())
+            if (!node->set_attribute(MUST(String::from_byte_string(attribute.name)), MUST(String::from_byte_string(attribute.value))).is_error())
                 continue;
             m_has_error = true;
         }
@@ -266,6 +266,7 @@ libweb_js_bindings(HTML/ToggleEvent)
 libweb_js_bindings(HTML/TrackEvent)
 libweb_js_bindings(HTML/UserActivation)
 libweb_js_bindings(HTML/ValidityState)
+libweb_js_bindings(HTML/VideoPlaybackQuality)
 libweb_js_bindings(HTML/VideoTrack)
 libweb_js_bindings(HTML/VideoTrackList)
 libweb_js_bindings(HTML/Window GLOBAL)
@@ -292,6 +293,7 @@ libweb_js_bindings(Internals/Internals)
 libweb_js_bindings(Internals/WebUI)
 libweb_js_bindings(IntersectionObserver/IntersectionObserver)
 libweb_js_bindings(IntersectionObserver/IntersectionObserverEntry)
+libweb_js_bindings(LongAnimationFrames/PerformanceLongAnimationFrameTiming)
 libweb_js_bindings(MathML/MathMLElement)
 libweb_js_bindings(MediaCapabilitiesAPI/MediaCapabilities)
 libweb_js_bindings(MediaSourceExtensions/BufferedChangeEvent)
@@ -313,6 +315,7 @@ libweb_js_bindings(ResizeObserver/ResizeObserverSize)
 libweb_js_bindings(ResourceTiming/PerformanceResourceTiming)
 libweb_js_bindings(Serial/Serial)
 libweb_js_bindings(Serial/SerialPort)
+libweb_js_bindings(ServiceWorker/Cache)
 libweb_js_bindings(ServiceWorker/CacheStorage)
 libweb_js_bindings(ServiceWorker/ServiceWorker)
 libweb_js_bindings(ServiceWorker/ServiceWorkerContainer)
@@ -29,6 +29,10 @@ public:
 
     virtual bool handshake_complete_when_connected() const { return false; }
 
+    // Returns the value of a header of the server's handshake response, for implementations which complete the handshake
+    // themselves.
+    virtual Optional<ByteString> handshake_response_header(StringView) const { return {}; }
+
     Function<void()> on_connected;
     Function<void()> on_connection_error;
     Function<void()> on_ready_to_read;
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWebSocket/PerMessageDeflate.h>
+
+namespace WebSocket {
+
+// Section 7.2.1: Remove 4 octets (that are 0x00 0x00 0xff 0xff) from the tail end of the compressed data.
+// Section 7.2.2: Append 4 octets of 0x00 0x00 0xff 0xff to the tail end of the payload of the message.
+static constexpr AK::Array<u8, 4> message_trailer { 0x00, 0x00, 0xff, 0xff };
+
+// The compressed messages are handed to the decompressor one at a time as they are received, so its input never ends.
+class PerMessageDeflate::MessageInputStream final : public Stream {
+public:
+    void set_message(ReadonlyBytes message)
+    {
+        m_message = message;
+        m_trailer = message_trailer.span();
+    }
+
+    bool has_remaining_input() const { return !m_message.is_empty() || !m_trailer.is_empty(); }
+
+    virtual ErrorOr<Bytes> read_some(Bytes bytes) override
+    {
+        size_t size = 0;
+
+        for (auto* input : { &m_message, &m_trailer }) {
+            auto copied = input->copy_trimmed_to(bytes.slice(size));
+            *input = input->slice(copied);
+            size += copied;
+        }
+
+        return bytes.trim(size);
+    }
+
+    virtual ErrorOr<size_t> write_some(ReadonlyBytes) override { return Error::from_errno(EBADF); }
+    virtual bool is_eof() const override { return false; }
+    virtual bool is_open() const override { return true; }
+    virtual void close() override { }
+
+private:
+    ReadonlyBytes m_message;
+    ReadonlyBytes m_trailer;
+};
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.1
+ErrorOr<PerMessageDeflate::Parameters, ByteString> PerMessageDeflate::parse_response_parameters(StringView parameters)
+{
+    Parameters result;
+
+    bool has_server_no_context_takeover = false;
+    bool has_client_no_context_takeover = false;
+    bool has_server_max_window_bits = false;
+    bool has_client_max_window_bits = false;
+
+    auto parse_window_bits = [](StringView name, Optional<StringView> value) -> ErrorOr<u8, ByteString> {
+        if (!value.has_value())
+            return ByteString::formatted("Extension parameter '{}' requires a value", name);
+
+        // The value may be a quoted string, as allowed by Section 9.1 of RFC 6455.
+        auto bits_string = *value;
+        if (bits_string.length() >= 2 && bits_string.starts_with('"') && bits_string.ends_with('"'))
+            bits_string = bits_string.substring_view(1, bits_string.length() - 2);
+
+        auto bits = bits_string.to_number<u8>();
+        if (!bits.has_value() || *bits < 8 || *bits > 15)
+            return ByteString::formatted("Extension parameter '{}' has an invalid value '{}'", name, *value);
+        return *bits;
+    };
+
+    for (auto parameter : parameters.split_view(';')) {
+        parameter = parameter.trim_whitespace();
+
+        auto name = parameter;
+        Optional<StringView> value;
+        if (auto equals = parameter.find('='); equals.has_value()) {
+            name = parameter.substring_view(0, *equals).trim_whitespace();
+            value = parameter.substring_view(*equals + 1).trim_whitespace();
+        }
+
+        // A server MUST decline an extension negotiation offer for this extension if the negotiation offer contains an
+        // extension parameter not defined for use in an offer, or multiple extension parameters with the same name. A
+        // client MUST _Fail the WebSocket Connection_ if the response has the same issues.
+        auto check_parameter = [&](bool& has_parameter) -> ErrorOr<void, ByteString> {
+            if (has_parameter)
+                return ByteString::formatted("Extension parameter '{}' was given more than once", name);
+            has_parameter = true;
+            return {};
+        };
+
+        if (name.equals_ignoring_ascii_case("server_no_context_takeover"sv)) {
+            TRY(check_parameter(has_server_no_context_takeover));
+            if (value.has_value())
+                return ByteString::formatted("Extension parameter '{}' must not have a value", name);
+            result.server_no_context_takeover = true;
+        } else if (name.equals_ignoring_ascii_case("client_no_context_takeover"sv)) {
+            TRY(check_parameter(has_client_no_context_takeover));
+            if (value.has_value())
+                return ByteString::formatted("Extension parameter '{}' must not have a value", name);
+            result.client_no_context_takeover = true;
+        } else if (name.equals_ignoring_ascii_case("server_max_window_bits"sv)) {
+            TRY(check_parameter(has_server_max_window_bits));
+            result.server_max_window_bits = TRY(parse_window_bits(name, value));
+        } else if (name.equals_ignoring_ascii_case("client_max_window_bits"sv)) {
+            TRY(check_parameter(has_client_max_window_bits));
+            result.client_max_window_bits = TRY(parse_window_bits(name, value));
+        } else {
+            return ByteString::formatted("Unknown extension parameter '{}'", name);
+        }
+    }
+
+    return result;
+}
+
+ErrorOr<NonnullOwnPtr<PerMessageDeflate>> PerMessageDeflate::create(Parameters parameters)
+{
+    auto decompressor_input = TRY(try_make<MessageInputStream>());
+
+    // NOTE: Decompressing with the largest window works for any window size the server may use.
+    auto decompressor = TRY(Compress::DeflateDecompressor::create(MaybeOwned<Stream> { *decompressor_input }));
+
+    auto per_message_deflate = TRY(adopt_nonnull_own_or_enomem(new (nothrow) PerMessageDeflate(parameters, move(decompressor_input), move(decompressor))));
+    TRY(per_message_deflate->create_compressor());
+
+    return per_message_deflate;
+}
+
+PerMessageDeflate::PerMessageDeflate(Parameters parameters, NonnullOwnPtr<MessageInputStream> decompressor_input, NonnullOwnPtr<Compress::DeflateDecompressor> decompressor)
+    : m_parameters(parameters)
+    , m_decompressor_input(move(decompressor_input))
+    , m_decompressor(move(decompressor))
+{
+}
+
+PerMessageDeflate::~PerMessageDeflate() = default;
+
+ErrorOr<void> PerMessageDeflate::create_compressor()
+{
+    // FIXME: Our compressor always uses the largest window, so we can only compress messages if the server allows it.
+    //        Section 6 allows us to send messages uncompressed otherwise.
+    if (m_parameters.client_max_window_bits < 15)
+        return {};
+
+    m_compressor = nullptr;
+    m_compressor = TRY(Compress::DeflateCompressor::create(MaybeOwned<Stream> { m_compressor_output }, Compress::GenericZlibCompressionLevel::Fastest));
+    return {};
+}
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.1
+ErrorOr<Optional<ByteBuffer>> PerMessageDeflate::compress_message(ReadonlyBytes payload)
+{
+    if (!m_compressor || payload.is_empty())
+        return OptionalNone {};
+
+    // 1. Compress all the octets of the payload of the message using DEFLATE.
+    TRY(m_compressor->write_until_depleted(payload));
+
+    // 2. If the resulting data does not end with an empty DEFLATE block with no compression (the "BTYPE" bits are set to
+    //    00), append an empty DEFLATE block with no compression to the tail end.
+    // NOTE: A sync flush always ends with such an empty block.
+    TRY(m_compressor->flush());
+
+    auto compressed = TRY(ByteBuffer::create_uninitialized(m_compressor_output.used_buffer_size()));
+    TRY(m_compressor_output.read_until_filled(compressed));
+
+    // 3. Remove 4 octets (that are 0x00 0x00 0xff 0xff) from the tail end. After this step, the last octet of the
+    //    compressed data contains (possibly part of) the DEFLATE header bits with the "BTYPE" bits set to 00.
+    VERIFY(compressed.bytes().ends_with(message_trailer.span()));
+    compressed.resize(compressed.size() - message_trailer.size());
+
+    // Section 7.1.1.2: If the peer server doesn't use context takeover, the client needs to start compressing each new
+    // message with an empty LZ77 sliding window.
+    if (m_parameters.client_no_context_takeover)
+        TRY(create_compressor());
+
+    return compressed;
+}
+
+// https://datatracker.ietf.org/doc/html/rfc7692#section-7.2.2
+ErrorOr<ByteBuffer> PerMessageDeflate::decompress_message(ReadonlyBytes payload)
+{
+    static constexpr size_t chunk_size = 16 * KiB;
+
+    // 1. Append 4 octets of 0x00 0x00 0xff 0xff to the tail end of the payload of the message.
+    m_decompressor_input->set_message(payload);
+
+    // 2. Decompress the resulting data using DEFLATE.
+    // NOTE: The decompressor keeps its sliding window across messages, as the server may use context takeover.
+    ByteBuffer decompressed;
+
+    while (true) {
+        auto previous_size = decompressed.size();
+        auto output = TRY(m_decompressor->read_some(TRY(decompressed.get_bytes_for_writing(chunk_size))));
+        decompressed.resize(previous_size + output.size());
+
+        // NOTE: The decompressor makes progress on every read until it has consumed all of its input, so once it does not
+        //       produce any output with no input left, the message is complete.
+        if (output.is_empty() && !m_decompressor_input->has_remaining_input())
+            break;
+    }
+
+    return decompressed;
+}
+
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/ByteString.h>
+#include <AK/MemoryStream.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/StringView.h>
+#include <LibCompress/Deflate.h>
+
+namespace WebSocket {
+
+// The permessage-deflate extension, defined in RFC 7692, found at https://datatracker.ietf.org/doc/html/rfc7692
+// Section numbers in this class refer to RFC 7692.
+class PerMessageDeflate {
+    AK_MAKE_NONCOPYABLE(PerMessageDeflate);
+    AK_MAKE_NONMOVABLE(PerMessageDeflate);
+
+public:
+    // The extension offer sent in our opening handshake. We accept any window size the server may ask us to use.
+    static constexpr StringView extension_offer = "permessage-deflate; client_max_window_bits"sv;
+    static constexpr StringView extension_name = "permessage-deflate"sv;
+
+    struct Parameters {
+        bool server_no_context_takeover { false };
+        bool client_no_context_takeover { false };
+        u8 server_max_window_bits { 15 };
+        u8 client_max_window_bits { 15 };
+    };
+
+    // Parses the extension parameters of the server's response to our offer, as defined in section 7.1.
+    static ErrorOr<Parameters, ByteString> parse_response_parameters(StringView parameters);
+
+    static ErrorOr<NonnullOwnPtr<PerMessageDeflate>> create(Parameters);
+    ~PerMessageDeflate();
+
+    // Returns the compressed payload of a message, or nothing if the message should be sent uncompressed.
+    ErrorOr<Optional<ByteBuffer>> compress_message(ReadonlyBytes payload);
+
+    ErrorOr<ByteBuffer> decompress_message(ReadonlyBytes payload);
+
+private:
+    class MessageInputStream;
+
+    PerMessageDeflate(Parameters, NonnullOwnPtr<MessageInputStream>, NonnullOwnPtr<Compress::DeflateDecompressor>);
+
+    ErrorOr<void> create_compressor();
+
+    Parameters m_parameters;
+
+    NonnullOwnPtr<MessageInputStream> m_decompressor_input;
+    NonnullOwnPtr<Compress::DeflateDecompressor> m_decompressor;
+
+    AllocatingMemoryStream m_compressor_output;
+    OwnPtr<Compress::DeflateCompressor> m_compressor;
+};
+
+}
@@ -10,6 +10,7 @@
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibCrypto/SecureRandom.h>
 #include <LibWebSocket/Impl/WebSocketImplSerenity.h>
+#include <LibWebSocket/PerMessageDeflate.h>
 #include <LibWebSocket/WebSocket.h>
 
 namespace WebSocket {
@@ -26,8 +27,20 @@ WebSocket::WebSocket(ConnectionInfo connection, RefPtr<WebSocketImpl> impl)
     : m_connection(move(connection))
     , m_impl(move(impl))
 {
+    // NOTE: We always offer to compress messages with the permessage-deflate extension (RFC 7692).
+    auto extensions = m_connection.extensions();
+    auto offers_per_message_deflate = any_of(extensions, [](auto const& extension) {
+        return extension.starts_with(PerMessageDeflate::extension_name, CaseSensitivity::CaseInsensitive);
+    });
+
+    if (!offers_per_message_deflate) {
+        extensions.append(PerMessageDeflate::extension_offer);
+        m_connection.set_extensions(move(extensions));
+    }
 }
 
+WebSocket::~WebSocket() = default;
+
 void WebSocket::start()
 {
     VERIFY(m_state == WebSocket::InternalState::NotStarted);
@@ -43,6 +56,13 @@ void WebSocket::start()
         if (m_state != WebSocket::InternalState::EstablishingProtocolConnection)
             return;
         if (m_impl->handshake_complete_when_connected()) {
+            if (auto extensions = m_impl->handshake_response_header("Sec-WebSocket-Extensions"sv); extensions.has_value()) {
+                if (auto result = accept_server_extensions(*extensions); result.is_error()) {
+                    fail_connection(to_underlying(CloseStatusCode::AbnormalClosure), WebSocket::Error::ConnectionUpgradeFailed, result.release_error());
+                    return;
+                }
+            }
+
             set_state(WebSocket::InternalState::Open);
             notify_open();
         } else {
@@ -89,10 +109,18 @@ void WebSocket::send(Message const& message)
     // Calling send on a socket that is not opened is not allowed
     VERIFY(m_state == WebSocket::InternalState::Open);
     VERIFY(m_impl);
-    if (message.is_text())
-        send_frame(WebSocket::OpCode::Text, message.data(), true);
-    else
-        send_frame(WebSocket::OpCode::Binary, message.data(), true);
+
+    auto op_code = message.is_text() ? WebSocket::OpCode::Text : WebSocket::OpCode::Binary;
+
+    if (m_per_message_deflate) {
+        auto compressed_payload = m_per_message_deflate->compress_message(message.data()).release_value_but_fixme_should_propagate_errors(); // FIXME: Handle possible OOM situation.
+        if (compressed_payload.has_value()) {
+            send_frame(op_code, *compressed_payload, true, true);
+            return;
+        }
+    }
+
+    send_frame(op_code, message.data(), true);
 }
 
 void WebSocket::close(u16 code, ByteString const& message)
@@ -154,7 +182,12 @@ void WebSocket::drain_read()
         do {
             if (auto maybe_error = read_frame(); maybe_error.is_error())
                 break;
-        } while (!m_buffered_data.is_empty());
+        } while (m_buffered_data_offset < m_buffered_data.size() && (m_state == InternalState::Open || m_state == InternalState::Closing));
+
+        // NOTE: Frames are consumed by advancing an offset into the buffered data, so only the remainder of a partially
+        //       received frame is moved to the front of the buffer, once per read.
+        m_buffered_data.remove(0, m_buffered_data_offset);
+        m_buffered_data_offset = 0;
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -239,6 +272,48 @@ void WebSocket::fail_connection(u16 close_status_code, WebSocket::Error error_co
     notify_close(close_status_code, reason, false);
 }
 
+// Section 9.1: The server's response contains the extensions it accepted, each of which must have been offered by us.
+ErrorOr<void, ByteString> WebSocket::accept_server_extensions(StringView extensions)
+{
+    for (auto extension : extensions.split_view(',')) {
+        extension = extension.trim_whitespace();
+
+        auto name = extension;
+        StringView parameters;
+        if (auto separator = extension.find(';'); separator.has_value()) {
+            name = extension.substring_view(0, *separator).trim_whitespace();
+            parameters = extension.substring_view(*separator + 1);
+        }
+
+        if (name.equals_ignoring_ascii_case(PerMessageDeflate::extension_name)) {
+            // https://datatracker.ietf.org/doc/html/rfc7692#section-5
+            // If a received extension negotiation response contains multiple elements for the same extension, the client
+            // MUST _Fail the WebSocket Connection_.
+            if (m_per_message_deflate)
+                return ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}' more than once. Failing connection.", name);
+
+            auto deflate_parameters = PerMessageDeflate::parse_response_parameters(parameters);
+            if (deflate_parameters.is_error())
+                return ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains an invalid '{}' response: {}. Failing connection.", name, deflate_parameters.error());
+
+            auto per_message_deflate = PerMessageDeflate::create(deflate_parameters.release_value());
+            if (per_message_deflate.is_error())
+                return ByteString::formatted("Failed to set up the '{}' extension: {}", name, per_message_deflate.error());
+
+            m_per_message_deflate = per_message_deflate.release_value();
+            continue;
+        }
+
+        auto is_offered_extension = any_of(m_connection.extensions(), [&](auto const& supported_extension) {
+            return extension.equals_ignoring_ascii_case(supported_extension);
+        });
+        if (!is_offered_extension)
+            return ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}', which is not supported by the client. Failing connection.", extension);
+    }
+
+    return {};
+}
+
 // The server handshake message is defined in the third list of section 4.1
 void WebSocket::read_server_handshake()
 {
@@ -352,19 +427,9 @@ void WebSocket::read_server_handshake()
 
         if (header_name.equals_ignoring_ascii_case("Sec-WebSocket-Extensions"sv)) {
             // 5. |Sec-WebSocket-Extensions| should not contain an extension that doesn't appear in m_connection->extensions()
-            auto server_extensions = parts[1].split(',');
-            for (auto const& extension : server_extensions) {
-                auto trimmed_extension = extension.trim_whitespace();
-                bool found_extension = false;
-                for (auto const& supported_extension : m_connection.extensions()) {
-                    if (trimmed_extension.equals_ignoring_ascii_case(supported_extension)) {
-                        found_extension = true;
-                    }
-                }
-                if (!found_extension) {
-                    fail_opening_handshake(ByteString::formatted("Server HTTP Handshake Header |Sec-WebSocket-Extensions| contains '{}', which is not supported by the client. Failing connection.", trimmed_extension));
-                    return;
-                }
+            if (auto result = accept_server_extensions(parts[1]); result.is_error()) {
+                fail_opening_handshake(result.release_error());
+                return;
             }
             continue;
         }
@@ -398,24 +463,20 @@ ErrorOr<void> WebSocket::read_frame()
 
     size_t cursor = 0;
     auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
-        if (cursor + count > m_buffered_data.size())
+        if (m_buffered_data_offset + cursor + count > m_buffered_data.size())
             return {};
-        auto bytes = m_buffered_data.span().slice(cursor, count);
+        auto bytes = m_buffered_data.span().slice(m_buffered_data_offset + cursor, count);
         cursor += count;
         return bytes;
     };
 
     auto head_bytes = get_buffered_bytes(2);
-    if (head_bytes.is_null() || head_bytes.is_empty()) {
-        // The connection got closed.
-        set_state(WebSocket::InternalState::Closed);
-        notify_close(m_last_close_code, m_last_close_message, true);
-        discard_connection();
-        return AK::Error::from_errno(ECONNABORTED);
-    }
+    if (head_bytes.is_null())
+        return AK::Error::from_errno(EAGAIN);
 
     auto op_code = (WebSocket::OpCode)(head_bytes[0] & 0x0f);
     bool is_final_frame = head_bytes[0] & 0x80;
+    bool is_compressed = head_bytes[0] & 0x40;
     bool is_masked = head_bytes[1] & 0x80;
 
     // Parse the payload length.
@@ -475,13 +536,7 @@ ErrorOr<void> WebSocket::read_frame()
         read_length += payload_part.size();
     }
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+    m_buffered_data_offset += cursor;
 
     if (is_masked) {
         // Unmask the payload
@@ -490,6 +545,14 @@ ErrorOr<void> WebSocket::read_frame()
         }
     }
 
+    // Section 5.2: RSV1 MUST be 0 unless an extension is negotiated that defines meanings for non-zero values.
+    // https://datatracker.ietf.org/doc/html/rfc7692#section-6: The "Per-Message Compressed" bit is only set on the first
+    // frame of a data message, never on control frames.
+    if (is_compressed && (!m_per_message_deflate || op_code == WebSocket::OpCode::Continuation || (to_underlying(op_code) & 0x8))) {
+        fail_connection(to_underlying(CloseStatusCode::ProtocolError), WebSocket::Error::ServerClosedSocket, "Received a frame with an unexpected RSV1 bit");
+        return AK::Error::from_errno(EPROTO);
+    }
+
     if (op_code == WebSocket::OpCode::ConnectionClose) {
         if (payload.size() > 1) {
             m_last_close_code = (((u16)(payload[0] & 0xff) << 8) | ((u16)(payload[1] & 0xff)));
@@ -514,6 +577,7 @@ ErrorOr<void> WebSocket::read_frame()
         if (op_code != WebSocket::OpCode::Continuation) {
             // First fragmented message
             m_initial_fragment_opcode = op_code;
+            m_initial_fragment_is_compressed = is_compressed;
         }
         // First and next fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
@@ -523,9 +587,16 @@ ErrorOr<void> WebSocket::read_frame()
         // Last fragmented message
         m_fragmented_data_buffer.append(payload.data(), payload_length);
         op_code = m_initial_fragment_opcode;
-        payload.clear();
-        payload.append(m_fragmented_data_buffer.data(), m_fragmented_data_buffer.size());
-        m_fragmented_data_buffer.clear();
+        is_compressed = m_initial_fragment_is_compressed;
+        payload = move(m_fragmented_data_buffer);
+    }
+    if (is_compressed) {
+        auto decompressed_payload = m_per_message_deflate->decompress_message(payload);
+        if (decompressed_payload.is_error()) {
+            fail_connection(to_underlying(CloseStatusCode::InvalidPayload), WebSocket::Error::ServerClosedSocket, ByteString::formatted("Failed to decompress message: {}", decompressed_payload.error()));
+            return decompressed_payload.release_error();
+        }
+        payload = decompressed_payload.release_value();
     }
     if (op_code == WebSocket::OpCode::Text) {
         notify_message(Message(move(payload), true));
@@ -539,7 +610,7 @@ ErrorOr<void> WebSocket::read_frame()
     return {};
 }
 
-void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final)
+void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, bool is_final, bool is_compressed)
 {
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open);
@@ -547,7 +618,8 @@ void WebSocket::send_frame(WebSocket::OpCode op_code, ReadonlyBytes payload, boo
     ByteBuffer buf = MUST(ByteBuffer::create_uninitialized(1 + 9 + 4 + payload.size()));
     size_t offset = 0;
 
-    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | ((u8)(op_code) & 0xf)) };
+    // RSV1 is the "Per-Message Compressed" bit of the permessage-deflate extension.
+    u8 frame_head[1] = { (u8)((is_final ? 0x80 : 0x00) | (is_compressed ? 0x40 : 0x00) | ((u8)(op_code) & 0xf)) };
     buf.overwrite(offset, frame_head, 1);
     offset += 1;
     // Section 5.1 : a client MUST mask all frames that it sends to the server
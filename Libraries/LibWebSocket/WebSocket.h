@@ -36,11 +36,13 @@ enum class CloseStatusCode : u16 {
     UnexpectedCondition = 1011,
 };
 
+class PerMessageDeflate;
+
 class WebSocket final : public Core::EventReceiver {
     C_OBJECT(WebSocket)
 public:
     static NonnullRefPtr<WebSocket> create(ConnectionInfo, RefPtr<WebSocketImpl> = nullptr);
-    virtual ~WebSocket() override = default;
+    virtual ~WebSocket() override;
 
     URL::URL const& url() const { return m_connection.url(); }
 
@@ -89,8 +91,10 @@ private:
     void send_client_handshake();
     void read_server_handshake();
 
+    ErrorOr<void, ByteString> accept_server_extensions(StringView extensions);
+
     ErrorOr<void> read_frame();
-    void send_frame(OpCode, ReadonlyBytes, bool is_final);
+    void send_frame(OpCode, ReadonlyBytes, bool is_final, bool is_compressed = false);
 
     void notify_open();
     void notify_close(u16 code, ByteString reason, bool was_clean);
@@ -134,8 +138,13 @@ private:
     RefPtr<WebSocketImpl> m_impl;
 
     Vector<u8> m_buffered_data;
+    size_t m_buffered_data_offset { 0 };
+
     ByteBuffer m_fragmented_data_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
+    bool m_initial_fragment_is_compressed { false };
+
+    OwnPtr<PerMessageDeflate> m_per_message_deflate;
 };
 
 }
@@ -7,6 +7,8 @@
 #include <AK/Debug.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
+#include <LibCore/File.h>
+#include <LibCore/MemoryPressureWatcher.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZoneWatcher.h>
@@ -19,6 +21,7 @@
 #include <LibWebView/Database.h>
 #include <LibWebView/HeadlessWebView.h>
 #include <LibWebView/HelperProcess.h>
+#include <LibWebView/PageLoadBenchmark.h>
 #include <LibWebView/URL.h>
 #include <LibWebView/UserAgent.h>
 #include <LibWebView/Utilities.h>
@@ -101,6 +104,11 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool allow_popups = false;
     bool disable_scripting = false;
     bool disable_sql_database = false;
+    bool enable_http_disk_cache = false;
+    Optional<StringView> record_http_archive_directory;
+    Optional<StringView> replay_http_archive_directory;
+    Optional<size_t> benchmark_iterations;
+    Optional<StringView> benchmark_baseline_path;
     Optional<u16> devtools_port;
     Optional<StringView> debug_process;
     Optional<StringView> profile_process;
@@ -120,6 +128,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    bool share_gc_blocks_between_types = false;
+    Optional<double> gc_growth_factor;
+    Optional<size_t> gc_minimum_threshold_in_mib;
     bool disable_scrollbar_painting = false;
 
     Core::ArgsParser args_parser;
@@ -128,7 +139,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
-        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', or 'text'.",
+        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', 'text', or 'benchmark'.",
         .long_name = "headless",
         .value_name = "mode",
         .accept_value = [&](StringView value) {
@@ -141,6 +152,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
                 headless_mode = HeadlessMode::LayoutTree;
             else if (value.equals_ignoring_ascii_case("text"sv))
                 headless_mode = HeadlessMode::Text;
+            else if (value.equals_ignoring_ascii_case("benchmark"sv))
+                headless_mode = HeadlessMode::Benchmark;
 
             return headless_mode.has_value();
         },
@@ -154,6 +167,11 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(allow_popups, "Disable popup blocking by default", "allow-popups");
     args_parser.add_option(disable_scripting, "Disable scripting by default", "disable-scripting");
     args_parser.add_option(disable_sql_database, "Disable SQL database", "disable-sql-database");
+    args_parser.add_option(enable_http_disk_cache, "Enable the on-disk HTTP cache in RequestServer", "enable-http-disk-cache");
+    args_parser.add_option(record_http_archive_directory, "Record every response RequestServer receives into an archive in the given directory", "record-http-archive", 0, "directory");
+    args_parser.add_option(replay_http_archive_directory, "Let RequestServer answer every request from an archive in the given directory", "replay-http-archive", 0, "directory");
+    args_parser.add_option(benchmark_iterations, "Number of times to load the page in benchmark mode (default: 10)", "benchmark-iterations", 0, "count");
+    args_parser.add_option(benchmark_baseline_path, "Compare the results of benchmark mode to those of a previous run", "benchmark-baseline", 0, "path");
     args_parser.add_option(debug_process, "Wait for a debugger to attach to the given process name (WebContent, RequestServer, etc.)", "debug-process", 0, "process-name");
     args_parser.add_option(profile_process, "Enable callgrind profiling of the given process name (WebContent, RequestServer, etc.)", "profile-process", 0, "process-name");
     args_parser.add_option(webdriver_content_ipc_path, "Path to WebDriver IPC for WebContent", "webdriver-content-path", 0, "path", Core::ArgsParser::OptionHideMode::CommandLineAndMarkdown);
@@ -167,6 +185,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation", 'g');
+    args_parser.add_option(share_gc_blocks_between_types, "Let same-size JS heap cell types share memory blocks", "share-gc-blocks-between-types");
+    args_parser.add_option(gc_growth_factor, "Collect garbage once the JS heap has allocated this many times its live bytes (default: 1.0)", "gc-growth-factor", 0, "factor");
+    args_parser.add_option(gc_minimum_threshold_in_mib, "Never collect garbage before the JS heap has allocated this many MiB (default: 4)", "gc-minimum-threshold", 0, "MiB");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical scrollbars on the main viewport", "disable-scrollbar-painting");
     args_parser.add_option(dns_server_address, "Set the DNS server address", "dns-server", 0, "host|address");
     args_parser.add_option(dns_server_port, "Set the DNS server port", "dns-port", 0, "port (default: 53 or 853 if --dot)");
@@ -232,6 +253,11 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .allow_popups = allow_popups ? AllowPopups::Yes : AllowPopups::No,
         .disable_scripting = disable_scripting ? DisableScripting::Yes : DisableScripting::No,
         .disable_sql_database = disable_sql_database ? DisableSQLDatabase::Yes : DisableSQLDatabase::No,
+        .enable_http_disk_cache = enable_http_disk_cache ? EnableHTTPDiskCache::Yes : EnableHTTPDiskCache::No,
+        .record_http_archive_directory = record_http_archive_directory.map([](auto path) { return ByteString { path }; }),
+        .replay_http_archive_directory = replay_http_archive_directory.map([](auto path) { return ByteString { path }; }),
+        .benchmark_iterations = benchmark_iterations.value_or(10),
+        .benchmark_baseline_path = benchmark_baseline_path.map([](auto path) { return ByteString { path }; }),
         .debug_helper_process = move(debug_process_type),
         .profile_helper_process = move(profile_process_type),
         .dns_settings = (dns_server_address.has_value()
@@ -264,6 +290,9 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .force_fontconfig = force_fontconfig ? ForceFontconfig::Yes : ForceFontconfig::No,
         .enable_autoplay = enable_autoplay ? EnableAutoplay::Yes : EnableAutoplay::No,
         .collect_garbage_on_every_allocation = collect_garbage_on_every_allocation ? CollectGarbageOnEveryAllocation::Yes : CollectGarbageOnEveryAllocation::No,
+        .share_gc_blocks_between_types = share_gc_blocks_between_types ? ShareGCBlocksBetweenTypes::Yes : ShareGCBlocksBetweenTypes::No,
+        .gc_growth_factor = gc_growth_factor,
+        .gc_minimum_threshold_in_mib = gc_minimum_threshold_in_mib,
         .paint_viewport_scrollbars = disable_scrollbar_painting ? PaintViewportScrollbars::No : PaintViewportScrollbars::Yes,
     };
 
@@ -328,6 +357,47 @@ void Application::launch_spare_web_content_process()
     });
 }
 
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_web_worker_process(Web::Bindings::AgentType type)
+{
+    if (type != Web::Bindings::AgentType::DedicatedWorker)
+        return WebView::launch_web_worker_process(type);
+
+    if (m_spare_web_worker_process) {
+        auto web_worker_client = m_spare_web_worker_process.release_nonnull();
+        launch_spare_web_worker_process();
+
+        return web_worker_client;
+    }
+
+    launch_spare_web_worker_process();
+    return WebView::launch_web_worker_process(type);
+}
+
+void Application::launch_spare_web_worker_process()
+{
+    // Disable spare processes when debugging or profiling WebWorker, for the same reasons as for WebContent.
+    if (browser_options().debug_helper_process == ProcessType::WebWorker)
+        return;
+    if (browser_options().profile_helper_process == ProcessType::WebWorker)
+        return;
+
+    if (m_has_queued_task_to_launch_spare_web_worker_process)
+        return;
+    m_has_queued_task_to_launch_spare_web_worker_process = true;
+
+    Core::deferred_invoke([this]() {
+        m_has_queued_task_to_launch_spare_web_worker_process = false;
+
+        auto web_worker_client = WebView::launch_web_worker_process(Web::Bindings::AgentType::DedicatedWorker);
+        if (web_worker_client.is_error()) {
+            dbgln("Unable to create spare web worker client: {}", web_worker_client.error());
+            return;
+        }
+
+        m_spare_web_worker_process = web_worker_client.release_value();
+    });
+}
+
 ErrorOr<void> Application::launch_services()
 {
     m_settings_observer = make<ApplicationSettingsObserver>();
@@ -341,9 +411,11 @@ ErrorOr<void> Application::launch_services()
         m_database = Database::create().release_value_but_fixme_should_propagate_errors();
         m_cookie_jar = CookieJar::create(*m_database).release_value_but_fixme_should_propagate_errors();
         m_storage_jar = StorageJar::create(*m_database).release_value_but_fixme_should_propagate_errors();
+        m_connection_predictor = ConnectionPredictor::create(*m_database).release_value_but_fixme_should_propagate_errors();
     } else {
         m_cookie_jar = CookieJar::create();
         m_storage_jar = StorageJar::create();
+        m_connection_predictor = ConnectionPredictor::create();
     }
 
     // No need to monitor the system time zone if the TZ environment variable is set, as it overrides system preferences.
@@ -362,6 +434,19 @@ ErrorOr<void> Application::launch_services()
         }
     }
 
+    if (auto memory_pressure_watcher = Core::MemoryPressureWatcher::create(); memory_pressure_watcher.is_error()) {
+        warnln("Unable to monitor memory pressure: {}", memory_pressure_watcher.error());
+    } else {
+        m_memory_pressure_watcher = memory_pressure_watcher.release_value();
+
+        m_memory_pressure_watcher->on_memory_pressure = []() {
+            WebContentClient::for_each_client([&](WebView::WebContentClient& client) {
+                client.async_purge_memory();
+                return IterationDecision::Continue;
+            });
+        };
+    }
+
     TRY(launch_request_server());
     TRY(launch_image_decoder_server());
 
@@ -490,6 +575,7 @@ ErrorOr<int> Application::execute()
 {
     OwnPtr<HeadlessWebView> view;
     RefPtr<Core::Timer> screenshot_timer;
+    OwnPtr<PageLoadBenchmark> benchmark;
 
     if (m_browser_options.headless_mode.has_value()) {
         auto theme_path = LexicalPath::join(WebView::s_ladybird_resource_root, "themes"sv, "Default.ini"sv);
@@ -511,6 +597,11 @@ ErrorOr<int> Application::execute()
             case HeadlessMode::Text:
                 load_page_for_info_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), WebView::PageInfoType::Text);
                 break;
+            case HeadlessMode::Benchmark:
+                benchmark = PageLoadBenchmark::create(*view, m_browser_options.urls.first(), m_browser_options.benchmark_iterations, m_browser_options.benchmark_baseline_path);
+                benchmark->on_finish = [this](int exit_code) { m_event_loop->quit(exit_code); };
+                benchmark->start();
+                break;
             case HeadlessMode::Test:
                 VERIFY_NOT_REACHED();
             }
@@ -575,6 +666,11 @@ void Application::process_did_exit(Process&& process)
         }
         break;
     case ProcessType::WebWorker:
+        if (auto client = process.client<Web::HTML::WebWorkerClient>(); client.has_value() && &client.value() == m_spare_web_worker_process.ptr()) {
+            dbgln_if(WEBVIEW_PROCESS_DEBUG, "Spare WebWorker {} died", process.pid());
+            m_spare_web_worker_process = nullptr;
+            break;
+        }
         dbgln_if(WEBVIEW_PROCESS_DEBUG, "WebWorker {} died, not sure what to do.", process.pid());
         break;
     case ProcessType::Browser:
@@ -601,6 +697,28 @@ ErrorOr<LexicalPath> Application::path_for_downloaded_file(StringView file) cons
     return LexicalPath::join(downloads_directory, file);
 }
 
+ErrorOr<LexicalPath> Application::dump_network_log()
+{
+    if (!m_request_server_client)
+        return Error::from_string_literal("RequestServer is not running");
+
+    auto har = m_request_server_client->network_log_as_har();
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(AK::UnixDateTime::now().to_string("network-log-%Y-%m-%d-%H-%M-%S.har"sv)));
+
+    auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(dump_file->write_until_depleted(har.bytes()));
+
+    return path;
+}
+
+void Application::clear_network_log()
+{
+    if (m_request_server_client)
+        m_request_server_client->async_clear_network_log();
+}
+
 ErrorOr<Application::DevtoolsState> Application::toggle_devtools_enabled()
 {
     if (m_devtools) {
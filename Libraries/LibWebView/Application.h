@@ -18,6 +18,9 @@
 #include <LibMain/Main.h>
 #include <LibRequests/RequestClient.h>
 #include <LibURL/URL.h>
+#include <LibWeb/Bindings/AgentType.h>
+#include <LibWeb/Worker/WebWorkerClient.h>
+#include <LibWebView/ConnectionPredictor.h>
 #include <LibWebView/Options.h>
 #include <LibWebView/Process.h>
 #include <LibWebView/ProcessManager.h>
@@ -48,10 +51,12 @@ public:
 
     static CookieJar& cookie_jar() { return *the().m_cookie_jar; }
     static StorageJar& storage_jar() { return *the().m_storage_jar; }
+    static ConnectionPredictor& connection_predictor() { return *the().m_connection_predictor; }
 
     static ProcessManager& process_manager() { return *the().m_process_manager; }
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
 
     void add_child_process(Process&&);
 
@@ -63,6 +68,10 @@ public:
 
     ErrorOr<LexicalPath> path_for_downloaded_file(StringView file) const;
 
+    // Writes the requests that RequestServer made most recently into a temporary file, as an HTTP Archive (HAR).
+    ErrorOr<LexicalPath> dump_network_log();
+    void clear_network_log();
+
     enum class DevtoolsState {
         Disabled,
         Enabled,
@@ -88,6 +97,7 @@ protected:
 private:
     ErrorOr<void> launch_services();
     void launch_spare_web_content_process();
+    void launch_spare_web_worker_process();
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
@@ -138,11 +148,17 @@ private:
     RefPtr<WebContentClient> m_spare_web_content_process;
     bool m_has_queued_task_to_launch_spare_web_content_process { false };
 
+    // NOTE: Only dedicated workers are common enough to be worth keeping a spare process around for.
+    RefPtr<Web::HTML::WebWorkerClient> m_spare_web_worker_process;
+    bool m_has_queued_task_to_launch_spare_web_worker_process { false };
+
     RefPtr<Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
     OwnPtr<StorageJar> m_storage_jar;
+    OwnPtr<ConnectionPredictor> m_connection_predictor;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
+    OwnPtr<Core::MemoryPressureWatcher> m_memory_pressure_watcher;
 
     OwnPtr<Core::EventLoop> m_event_loop;
     OwnPtr<ProcessManager> m_process_manager;
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibURL/Parser.h>
+#include <LibURL/URL.h>
+#include <LibWebView/ConnectionPredictor.h>
+
+namespace WebView {
+
+// Origins which have not been contacted by a site for this long are no longer predicted for that site.
+static constexpr auto MAXIMUM_ORIGIN_AGE = AK::Duration::from_seconds(30 * 24 * 60 * 60);
+
+// Bounds the memory used by the in-memory predictor, which is used when the SQL database is disabled.
+static constexpr size_t MAXIMUM_TRANSIENT_SITES = 1024;
+
+static Optional<String> site_for_url(URL::URL const& url)
+{
+    if (url.scheme() != "http"sv && url.scheme() != "https"sv)
+        return {};
+
+    auto origin = url.origin();
+    if (origin.is_opaque())
+        return {};
+
+    return origin.serialize();
+}
+
+ErrorOr<NonnullOwnPtr<ConnectionPredictor>> ConnectionPredictor::create(Database& database)
+{
+    Statements statements {};
+
+    auto create_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS PreconnectOrigins (
+            site TEXT,
+            origin TEXT,
+            hit_count INTEGER,
+            last_seen INTEGER,
+            PRIMARY KEY(site, origin)
+        );)#"sv));
+    database.execute_statement(create_table, {});
+
+    auto delete_stale_origins = TRY(database.prepare_statement("DELETE FROM PreconnectOrigins WHERE last_seen < ?;"sv));
+    database.execute_statement(delete_stale_origins, {}, UnixDateTime::now() - MAXIMUM_ORIGIN_AGE);
+
+    statements.record_origin = TRY(database.prepare_statement(R"#(
+        INSERT INTO PreconnectOrigins VALUES (?, ?, 1, ?)
+        ON CONFLICT(site, origin) DO UPDATE SET hit_count = hit_count + 1, last_seen = excluded.last_seen;)#"sv));
+    statements.select_origins = TRY(database.prepare_statement(R"#(
+        SELECT origin FROM PreconnectOrigins
+        WHERE site = ? AND last_seen >= ?
+        ORDER BY hit_count DESC, last_seen DESC
+        LIMIT ?;)#"sv));
+
+    return adopt_own(*new ConnectionPredictor { PersistedStorage { database, statements } });
+}
+
+NonnullOwnPtr<ConnectionPredictor> ConnectionPredictor::create()
+{
+    return adopt_own(*new ConnectionPredictor { OptionalNone {} });
+}
+
+ConnectionPredictor::ConnectionPredictor(Optional<PersistedStorage> persisted_storage)
+    : m_persisted_storage(move(persisted_storage))
+{
+}
+
+ConnectionPredictor::~ConnectionPredictor() = default;
+
+Vector<URL::URL> ConnectionPredictor::predict_origins(URL::URL const& url)
+{
+    auto site = site_for_url(url);
+    if (!site.has_value())
+        return {};
+
+    auto oldest_allowed = UnixDateTime::now() - MAXIMUM_ORIGIN_AGE;
+
+    auto origins = m_persisted_storage.has_value()
+        ? m_persisted_storage->select_origins(*site, oldest_allowed)
+        : m_transient_storage.select_origins(*site, oldest_allowed);
+
+    Vector<URL::URL> predicted_origins;
+    predicted_origins.ensure_capacity(origins.size());
+
+    for (auto const& origin : origins) {
+        if (auto origin_url = URL::Parser::basic_parse(origin); origin_url.has_value())
+            predicted_origins.unchecked_append(origin_url.release_value());
+    }
+
+    return predicted_origins;
+}
+
+void ConnectionPredictor::did_load_with_network_request_origins(URL::URL const& url, ReadonlySpan<String> origins)
+{
+    auto site = site_for_url(url);
+    if (!site.has_value())
+        return;
+
+    auto now = UnixDateTime::now();
+
+    for (auto const& origin : origins) {
+        // We will already be connecting to the site itself when navigating to it.
+        if (origin == *site)
+            continue;
+
+        if (m_persisted_storage.has_value())
+            m_persisted_storage->record_origin(*site, origin, now);
+        else
+            m_transient_storage.record_origin(*site, origin, now);
+    }
+}
+
+void ConnectionPredictor::PersistedStorage::record_origin(String const& site, String const& origin, UnixDateTime now)
+{
+    database.execute_statement(statements.record_origin, {}, site, origin, now);
+}
+
+Vector<String> ConnectionPredictor::PersistedStorage::select_origins(String const& site, UnixDateTime oldest_allowed)
+{
+    Vector<String> origins;
+    database.execute_statement(
+        statements.select_origins,
+        [&](auto statement_id) {
+            origins.append(database.result_column<String>(statement_id, 0));
+        },
+        site,
+        oldest_allowed,
+        static_cast<int>(maximum_predicted_origins));
+    return origins;
+}
+
+void ConnectionPredictor::TransientStorage::record_origin(String const& site, String const& origin, UnixDateTime now)
+{
+    if (!m_sites.contains(site) && m_sites.size() >= MAXIMUM_TRANSIENT_SITES)
+        return;
+
+    auto& entry = m_sites.ensure(site).ensure(origin);
+    ++entry.hit_count;
+    entry.last_seen = now;
+}
+
+Vector<String> ConnectionPredictor::TransientStorage::select_origins(String const& site, UnixDateTime oldest_allowed)
+{
+    auto site_entries = m_sites.get(site);
+    if (!site_entries.has_value())
+        return {};
+
+    struct Candidate {
+        String const* origin { nullptr };
+        Entry const* entry { nullptr };
+    };
+
+    Vector<Candidate> candidates;
+    for (auto const& [origin, entry] : *site_entries) {
+        if (entry.last_seen >= oldest_allowed)
+            candidates.append({ &origin, &entry });
+    }
+
+    quick_sort(candidates, [](auto const& lhs, auto const& rhs) {
+        if (lhs.entry->hit_count != rhs.entry->hit_count)
+            return lhs.entry->hit_count > rhs.entry->hit_count;
+        return lhs.entry->last_seen > rhs.entry->last_seen;
+    });
+
+    Vector<String> origins;
+    for (auto const& candidate : candidates.span().trim(maximum_predicted_origins))
+        origins.append(*candidate.origin);
+    return origins;
+}
+
+}
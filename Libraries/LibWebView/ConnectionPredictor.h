@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Span.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibURL/Forward.h>
+#include <LibWebView/Database.h>
+
+namespace WebView {
+
+// Learns which origins are contacted while loading a top-level site, so that connections to those origins may be set
+// up as soon as a future navigation to that site begins, rather than when the parser discovers the first subresource.
+class ConnectionPredictor {
+    AK_MAKE_NONCOPYABLE(ConnectionPredictor);
+    AK_MAKE_NONMOVABLE(ConnectionPredictor);
+
+public:
+    static constexpr size_t maximum_predicted_origins = 6;
+
+    static ErrorOr<NonnullOwnPtr<ConnectionPredictor>> create(Database&);
+    static NonnullOwnPtr<ConnectionPredictor> create();
+
+    ~ConnectionPredictor();
+
+    // Returns the origins, most frequently contacted first, to preconnect to when navigating to the given URL.
+    Vector<URL::URL> predict_origins(URL::URL const&);
+
+    void did_load_with_network_request_origins(URL::URL const&, ReadonlySpan<String> origins);
+
+private:
+    struct Statements {
+        Database::StatementID record_origin { 0 };
+        Database::StatementID select_origins { 0 };
+    };
+
+    class TransientStorage {
+    public:
+        void record_origin(String const& site, String const& origin, UnixDateTime now);
+        Vector<String> select_origins(String const& site, UnixDateTime oldest_allowed);
+
+    private:
+        struct Entry {
+            u32 hit_count { 0 };
+            UnixDateTime last_seen;
+        };
+
+        HashMap<String, HashMap<String, Entry>> m_sites;
+    };
+
+    struct PersistedStorage {
+        void record_origin(String const& site, String const& origin, UnixDateTime now);
+        Vector<String> select_origins(String const& site, UnixDateTime oldest_allowed);
+
+        Database& database;
+        Statements statements;
+    };
+
+    explicit ConnectionPredictor(Optional<PersistedStorage>);
+
+    Optional<PersistedStorage> m_persisted_storage;
+    TransientStorage m_transient_storage;
+};
+
+}
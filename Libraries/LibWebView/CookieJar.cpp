@@ -509,7 +509,8 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    // NOTE: A cookie can only match if its domain is the canonicalized host, or a domain that the host domain-matches.
+    m_transient_storage.for_each_cookie_with_domain_or_parent_domain(canonicalized_domain, [&](Web::Cookie::Cookie& cookie) {
         // * Either:
         //     The cookie's host-only-flag is true and the canonicalized host of the retrieval's URI is identical to
         //     the cookie's domain.
@@ -583,9 +584,30 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+
+    m_cookie_keys_by_domain.clear();
+    for (auto const& it : m_cookies)
+        index_cookie(it.key);
+
     purge_expired_cookies();
 }
 
+void CookieJar::TransientStorage::index_cookie(CookieStorageKey const& key)
+{
+    m_cookie_keys_by_domain.ensure(key.domain).set(key);
+}
+
+void CookieJar::TransientStorage::unindex_cookie(CookieStorageKey const& key)
+{
+    auto keys = m_cookie_keys_by_domain.find(key.domain);
+    if (keys == m_cookie_keys_by_domain.end())
+        return;
+
+    keys->value.remove(key);
+    if (keys->value.is_empty())
+        m_cookie_keys_by_domain.remove(keys);
+}
+
 static void notify_cookies_changed(Vector<Web::Cookie::Cookie> cookies)
 {
     WebContentClient::for_each_client([&](WebContentClient& client) {
@@ -602,6 +624,7 @@ void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::
     if (cookie.expiry_time < now && !m_cookies.contains(key))
         return;
     m_cookies.set(key, cookie);
+    index_cookie(key);
     // We skip notifying about updating expired cookies, as they will be notified as being expired immediately after instead
     if (cookie.expiry_time >= now)
         notify_cookies_changed({ cookie });
@@ -628,8 +651,10 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
     if (!removed_entries.is_empty()) {
         Vector<Web::Cookie::Cookie> removed_cookies;
         removed_cookies.ensure_capacity(removed_entries.size());
-        for (auto const& entry : removed_entries)
+        for (auto const& entry : removed_entries) {
+            unindex_cookie(entry.key);
             removed_cookies.unchecked_append(move(entry.value));
+        }
         notify_cookies_changed(move(removed_cookies));
     }
 
@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -51,6 +52,26 @@ class CookieJar {
 
         auto take_dirty_cookies() { return move(m_dirty_cookies); }
 
+        // Invokes the callback for the cookies whose domain is the given domain, or one of its parent domains. These are
+        // the only cookies that can domain-match the given domain.
+        template<typename Callback>
+        void for_each_cookie_with_domain_or_parent_domain(StringView canonicalized_domain, Callback callback)
+        {
+            auto domain = canonicalized_domain;
+
+            while (true) {
+                if (auto keys = m_cookie_keys_by_domain.find(domain); keys != m_cookie_keys_by_domain.end()) {
+                    for (auto const& key : keys->value)
+                        callback(m_cookies.find(key)->value);
+                }
+
+                auto separator = domain.find('.');
+                if (!separator.has_value())
+                    break;
+                domain = domain.substring_view(*separator + 1);
+            }
+        }
+
         template<typename Callback>
         void for_each_cookie(Callback callback)
         {
@@ -68,8 +89,15 @@ class CookieJar {
         }
 
     private:
+        void index_cookie(CookieStorageKey const&);
+        void unindex_cookie(CookieStorageKey const&);
+
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+
+        // The keys of the stored cookies, by cookie domain, so that retrieving the cookies for a URL doesn't have to
+        // check every cookie in the store.
+        HashMap<String, HashTable<CookieStorageKey>> m_cookie_keys_by_domain;
     };
 
     struct PersistedStorage {
@@ -50,6 +50,10 @@ ErrorOr<NonnullRefPtr<Database>> Database::create()
     sqlite3* m_database { nullptr };
     SQL_TRY(sqlite3_open(database_file.characters(), &m_database));
 
+    // Use a write-ahead log, so that writes only append to the log instead of rewriting pages of the database file, and
+    // don't block readers while they are committed.
+    SQL_TRY(sqlite3_exec(m_database, "PRAGMA journal_mode=WAL;", nullptr, nullptr, nullptr));
+
     return adopt_nonnull_ref_or_enomem(new (nothrow) Database(m_database));
 }
 
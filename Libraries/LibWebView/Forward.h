@@ -13,9 +13,12 @@ namespace WebView {
 
 class Application;
 class Autocomplete;
+class ConnectionPredictor;
 class CookieJar;
 class Database;
+class HeadlessWebView;
 class OutOfProcessWebView;
+class PageLoadBenchmark;
 class ProcessManager;
 class Settings;
 class ViewImplementation;
@@ -120,6 +120,12 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append("--force-fontconfig"sv);
     if (web_content_options.collect_garbage_on_every_allocation == WebView::CollectGarbageOnEveryAllocation::Yes)
         arguments.append("--collect-garbage-on-every-allocation"sv);
+    if (web_content_options.share_gc_blocks_between_types == WebView::ShareGCBlocksBetweenTypes::Yes)
+        arguments.append("--share-gc-blocks-between-types"sv);
+    if (auto growth_factor = web_content_options.gc_growth_factor; growth_factor.has_value())
+        arguments.append(ByteString::formatted("--gc-growth-factor={}", *growth_factor));
+    if (auto threshold = web_content_options.gc_minimum_threshold_in_mib; threshold.has_value())
+        arguments.append(ByteString::formatted("--gc-minimum-threshold={}", *threshold));
     if (web_content_options.paint_viewport_scrollbars == PaintViewportScrollbars::No)
         arguments.append("--disable-scrollbar-painting"sv);
 
@@ -206,6 +212,13 @@ ErrorOr<NonnullRefPtr<Requests::RequestClient>> launch_request_server_process()
     for (auto const& certificate : WebView::Application::browser_options().certificates)
         arguments.append(ByteString::formatted("--certificate={}", certificate));
 
+    if (WebView::Application::browser_options().enable_http_disk_cache == WebView::EnableHTTPDiskCache::Yes)
+        arguments.append("--enable-http-disk-cache"sv);
+    if (auto const& directory = WebView::Application::browser_options().record_http_archive_directory; directory.has_value())
+        arguments.append(ByteString::formatted("--record-http-archive={}", *directory));
+    if (auto const& directory = WebView::Application::browser_options().replay_http_archive_directory; directory.has_value())
+        arguments.append(ByteString::formatted("--replay-http-archive={}", *directory));
+
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
@@ -19,6 +19,7 @@ enum class HeadlessMode {
     Screenshot,
     LayoutTree,
     Text,
+    Benchmark,
     Test,
 };
 
@@ -47,6 +48,11 @@ enum class DisableSQLDatabase {
     Yes,
 };
 
+enum class EnableHTTPDiskCache {
+    No,
+    Yes,
+};
+
 enum class EnableAutoplay {
     No,
     Yes,
@@ -80,6 +86,11 @@ struct BrowserOptions {
     AllowPopups allow_popups { AllowPopups::No };
     DisableScripting disable_scripting { DisableScripting::No };
     DisableSQLDatabase disable_sql_database { DisableSQLDatabase::No };
+    EnableHTTPDiskCache enable_http_disk_cache { EnableHTTPDiskCache::No };
+    Optional<ByteString> record_http_archive_directory {};
+    Optional<ByteString> replay_http_archive_directory {};
+    size_t benchmark_iterations { 10 };
+    Optional<ByteString> benchmark_baseline_path {};
     Optional<ProcessType> debug_helper_process {};
     Optional<ProcessType> profile_helper_process {};
     Optional<ByteString> webdriver_content_ipc_path {};
@@ -132,6 +143,11 @@ enum class CollectGarbageOnEveryAllocation {
     Yes,
 };
 
+enum class ShareGCBlocksBetweenTypes {
+    No,
+    Yes,
+};
+
 enum class PaintViewportScrollbars {
     Yes,
     No,
@@ -152,6 +168,9 @@ struct WebContentOptions {
     ForceFontconfig force_fontconfig { ForceFontconfig::No };
     EnableAutoplay enable_autoplay { EnableAutoplay::No };
     CollectGarbageOnEveryAllocation collect_garbage_on_every_allocation { CollectGarbageOnEveryAllocation::No };
+    ShareGCBlocksBetweenTypes share_gc_blocks_between_types { ShareGCBlocksBetweenTypes::No };
+    Optional<double> gc_growth_factor {};
+    Optional<size_t> gc_minimum_threshold_in_mib {};
     Optional<u16> echo_server_port {};
     PaintViewportScrollbars paint_viewport_scrollbars { PaintViewportScrollbars::Yes };
 };
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/Math.h>
+#include <LibCore/File.h>
+#include <LibCore/Timer.h>
+#include <LibWebView/Application.h>
+#include <LibWebView/HeadlessWebView.h>
+#include <LibWebView/PageLoadBenchmark.h>
+#include <LibWebView/ProcessManager.h>
+
+namespace WebView {
+
+static constexpr int memory_sampling_interval_in_milliseconds = 100;
+
+// NOTE: We treat the load times as normally distributed, which is close enough for the iteration counts we use.
+static constexpr double z_score_for_95_percent_confidence = 1.96;
+
+struct Statistics {
+    double mean { 0 };
+    double variance { 0 };
+    size_t sample_count { 0 };
+
+    double confidence_interval() const { return z_score_for_95_percent_confidence * AK::sqrt(variance / static_cast<double>(sample_count)); }
+};
+
+static Statistics compute_statistics(ReadonlySpan<double> samples)
+{
+    Statistics statistics { .sample_count = samples.size() };
+    if (samples.is_empty())
+        return statistics;
+
+    for (auto sample : samples)
+        statistics.mean += sample;
+    statistics.mean /= static_cast<double>(samples.size());
+
+    if (samples.size() > 1) {
+        for (auto sample : samples)
+            statistics.variance += (sample - statistics.mean) * (sample - statistics.mean);
+        statistics.variance /= static_cast<double>(samples.size() - 1);
+    }
+
+    return statistics;
+}
+
+NonnullOwnPtr<PageLoadBenchmark> PageLoadBenchmark::create(HeadlessWebView& view, URL::URL url, size_t iteration_count, Optional<ByteString> baseline_path)
+{
+    return adopt_own(*new PageLoadBenchmark(view, move(url), iteration_count, move(baseline_path)));
+}
+
+PageLoadBenchmark::PageLoadBenchmark(HeadlessWebView& view, URL::URL url, size_t iteration_count, Optional<ByteString> baseline_path)
+    : m_view(view)
+    , m_url(move(url))
+    , m_iteration_count(max(iteration_count, 1uz))
+    , m_baseline_path(move(baseline_path))
+{
+    m_memory_sampling_timer = Core::Timer::create_repeating(memory_sampling_interval_in_milliseconds, [this] {
+        sample_memory_usage();
+    });
+}
+
+PageLoadBenchmark::~PageLoadBenchmark() = default;
+
+void PageLoadBenchmark::start()
+{
+    m_view.on_load_finish = [this](auto const& url) {
+        if (url.equals(m_url, URL::ExcludeFragment::Yes))
+            finish_iteration();
+    };
+
+    m_memory_sampling_timer->start();
+    start_iteration();
+}
+
+void PageLoadBenchmark::start_iteration()
+{
+    // NOTE: Every iteration should fetch the page's resources from RequestServer again, rather than from the memory cache
+    //       of the previous one.
+    m_view.debug_request("clear-cache"sv);
+
+    m_iteration_start_time = MonotonicTime::now();
+    m_view.load(m_url);
+}
+
+void PageLoadBenchmark::finish_iteration()
+{
+    auto load_time = MonotonicTime::now() - m_iteration_start_time;
+    m_load_times_in_milliseconds.append(static_cast<double>(load_time.to_microseconds()) / 1000.0);
+    sample_memory_usage();
+
+    warnln("Loaded {} in {:.1}ms ({}/{})", m_url, m_load_times_in_milliseconds.last(), m_load_times_in_milliseconds.size(), m_iteration_count);
+
+    if (m_load_times_in_milliseconds.size() < m_iteration_count) {
+        // NOTE: Start the next load from a fresh task, rather than from within the load event of this one.
+        Core::deferred_invoke([this] { start_iteration(); });
+        return;
+    }
+
+    m_memory_sampling_timer->stop();
+
+    auto result = report_results();
+    if (result.is_error())
+        warnln("Unable to report the benchmark results: {}", result.error());
+
+    if (on_finish)
+        on_finish(result.is_error() ? 1 : 0);
+}
+
+void PageLoadBenchmark::sample_memory_usage()
+{
+    auto& process_manager = Application::process_manager();
+    process_manager.update_all_process_statistics();
+    m_peak_memory_usage_in_bytes = max(m_peak_memory_usage_in_bytes, process_manager.total_memory_usage_in_bytes());
+}
+
+ErrorOr<void> PageLoadBenchmark::report_results() const
+{
+    auto statistics = compute_statistics(m_load_times_in_milliseconds);
+
+    JsonArray load_times;
+    for (auto load_time : m_load_times_in_milliseconds)
+        load_times.must_append(load_time);
+
+    JsonObject results;
+    results.set("url"sv, m_url.serialize());
+    results.set("load_times_ms"sv, move(load_times));
+    results.set("mean_ms"sv, statistics.mean);
+    results.set("standard_deviation_ms"sv, AK::sqrt(statistics.variance));
+    results.set("confidence_interval_ms"sv, statistics.confidence_interval());
+    results.set("peak_memory_bytes"sv, m_peak_memory_usage_in_bytes);
+
+    // The results are written to stdout, so that they can be used as the baseline of another run.
+    outln("{}", results.serialized());
+
+    warnln("Load time: {:.1}ms ± {:.1}ms (95% confidence) over {} loads, peak memory: {} MiB",
+        statistics.mean, statistics.confidence_interval(), statistics.sample_count, m_peak_memory_usage_in_bytes / MiB);
+
+    if (!m_baseline_path.has_value())
+        return {};
+
+    auto baseline_file = TRY(Core::File::open(*m_baseline_path, Core::File::OpenMode::Read));
+    auto baseline_json = TRY(JsonValue::from_string(TRY(baseline_file->read_until_eof())));
+    if (!baseline_json.is_object())
+        return Error::from_string_literal("Baseline results must be a JSON object");
+
+    auto baseline_load_times_json = baseline_json.as_object().get_array("load_times_ms"sv);
+    if (!baseline_load_times_json.has_value())
+        return Error::from_string_literal("Baseline results do not contain any load times");
+
+    Vector<double> baseline_load_times;
+    baseline_load_times_json->for_each([&](auto const& value) {
+        if (auto load_time = value.get_double_with_precision_loss(); load_time.has_value())
+            baseline_load_times.append(*load_time);
+    });
+
+    auto baseline_statistics = compute_statistics(baseline_load_times);
+    if (baseline_statistics.sample_count == 0)
+        return Error::from_string_literal("Baseline results do not contain any load times");
+
+    // Welch's method: the difference of the means, with the confidence interval of two samples of unequal variance.
+    auto difference = statistics.mean - baseline_statistics.mean;
+    auto difference_confidence_interval = z_score_for_95_percent_confidence
+        * AK::sqrt(statistics.variance / static_cast<double>(statistics.sample_count) + baseline_statistics.variance / static_cast<double>(baseline_statistics.sample_count));
+
+    auto is_significant = AK::fabs(difference) > difference_confidence_interval;
+    auto relative_difference = baseline_statistics.mean != 0 ? difference / baseline_statistics.mean * 100 : 0;
+
+    warnln("Compared to the baseline ({:.1}ms): {:+.1}ms ({:+.1}%) ± {:.1}ms, {}",
+        baseline_statistics.mean, difference, relative_difference, difference_confidence_interval,
+        is_significant ? (difference > 0 ? "slower"sv : "faster"sv) : "no significant difference"sv);
+
+    return {};
+}
+
+}
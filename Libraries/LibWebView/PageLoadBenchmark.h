@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibURL/URL.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+// Loads a page a number of times, and reports how long the loads took and how much memory was used at most while
+// loading it. Combined with replaying an archive of recorded pages in RequestServer, every load sees the same responses,
+// so the results of two builds can be compared against each other.
+class PageLoadBenchmark {
+public:
+    static NonnullOwnPtr<PageLoadBenchmark> create(HeadlessWebView&, URL::URL, size_t iteration_count, Optional<ByteString> baseline_path);
+    ~PageLoadBenchmark();
+
+    void start();
+
+    Function<void(int exit_code)> on_finish;
+
+private:
+    PageLoadBenchmark(HeadlessWebView&, URL::URL, size_t iteration_count, Optional<ByteString> baseline_path);
+
+    void start_iteration();
+    void finish_iteration();
+    void sample_memory_usage();
+
+    ErrorOr<void> report_results() const;
+
+    HeadlessWebView& m_view;
+    URL::URL m_url;
+    size_t m_iteration_count { 0 };
+    Optional<ByteString> m_baseline_path;
+
+    MonotonicTime m_iteration_start_time { MonotonicTime::now_coarse() };
+    Vector<double> m_load_times_in_milliseconds;
+    u64 m_peak_memory_usage_in_bytes { 0 };
+
+    RefPtr<Core::Timer> m_memory_sampling_timer;
+};
+
+}
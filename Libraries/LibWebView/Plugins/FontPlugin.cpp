@@ -28,9 +28,13 @@ FontPlugin::FontPlugin(bool is_layout_test_mode, Gfx::SystemFontProvider* font_p
         font_provider = &static_cast<Gfx::PathFontProvider&>(Gfx::FontDatabase::the().install_system_font_provider(make<Gfx::PathFontProvider>()));
     if (is<Gfx::PathFontProvider>(*font_provider)) {
         auto& path_font_provider = static_cast<Gfx::PathFontProvider&>(*font_provider);
-        // Load anything we can find in the system's font directories
+
+        // Load anything we can find in the system's font directories. Fonts that were indexed by an earlier run are
+        // only loaded once they are needed.
+        path_font_provider.load_font_index(ByteString::formatted("{}/Ladybird/FontIndex.json", Core::StandardPaths::user_data_directory()));
         for (auto const& path : Gfx::FontDatabase::font_directories().release_value_but_fixme_should_propagate_errors())
             path_font_provider.load_all_fonts_from_uri(MUST(String::formatted("file://{}", path)));
+        path_font_provider.save_font_index();
     }
 
     update_generic_fonts();
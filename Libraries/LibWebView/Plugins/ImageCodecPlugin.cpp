@@ -31,7 +31,7 @@ void ImageCodecPlugin::set_client(NonnullRefPtr<ImageDecoderClient::Client> clie
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
-NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Web::Platform::FramesToDecode frames_to_decode)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
@@ -60,7 +60,10 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
         },
         [promise](auto& error) {
             promise->reject(Error::copy(error));
-        });
+        },
+        ideal_size,
+        {},
+        frames_to_decode == Web::Platform::FramesToDecode::FirstOnly);
 
     return promise;
 }
@@ -37,6 +37,9 @@ public:
     void update_all_process_statistics();
     JsonValue serialize_json();
 
+    // The memory used by all processes as of the last update of their statistics.
+    u64 total_memory_usage_in_bytes();
+
     Function<void(Process&&)> on_process_exited;
 
 private:
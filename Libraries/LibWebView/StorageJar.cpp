@@ -11,7 +11,14 @@
 namespace WebView {
 
 // Quota size is specified in https://storage.spec.whatwg.org/#registered-storage-endpoints
-static constexpr size_t LOCAL_STORAGE_QUOTA = 5 * MiB;
+static Optional<u64> quota_for_storage_endpoint(StorageEndpointType storage_endpoint)
+{
+    for (auto const& endpoint : Web::StorageAPI::StorageEndpoint::registered_endpoints()) {
+        if (endpoint.identifier == storage_endpoint)
+            return endpoint.quota;
+    }
+    VERIFY_NOT_REACHED();
+}
 
 ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
 {
@@ -32,6 +39,7 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database& database)
     statements.get_item = TRY(database.prepare_statement("SELECT bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
     statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
+    statements.get_items = TRY(database.prepare_statement("SELECT bottle_key, bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
     statements.calculate_size_excluding_key = TRY(database.prepare_statement("SELECT SUM(LENGTH(bottle_key) + LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
 
     return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
@@ -91,21 +99,30 @@ Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, St
     return m_transient_storage.get_keys(storage_endpoint, storage_key);
 }
 
-StorageOperationError StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
+OrderedHashMap<String, String> StorageJar::get_all_items(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    size_t current_size = 0;
-    database.execute_statement(
-        statements.calculate_size_excluding_key,
-        [&](auto statement_id) {
-            current_size = database.result_column<int>(statement_id, 0);
-        },
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
+    if (m_persisted_storage.has_value())
+        return m_persisted_storage->get_items(storage_endpoint, storage_key);
+    return m_transient_storage.get_items(storage_endpoint, storage_key);
+}
 
-    auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
-    if (current_size + new_size > LOCAL_STORAGE_QUOTA) {
-        return StorageOperationError::QuotaExceededError;
+StorageOperationError StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
+{
+    if (auto quota = quota_for_storage_endpoint(key.storage_endpoint); quota.has_value()) {
+        size_t current_size = 0;
+        database.execute_statement(
+            statements.calculate_size_excluding_key,
+            [&](auto statement_id) {
+                current_size = database.result_column<int>(statement_id, 0);
+            },
+            static_cast<int>(to_underlying(key.storage_endpoint)),
+            key.storage_key,
+            key.bottle_key);
+
+        auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
+        if (current_size + new_size > *quota) {
+            return StorageOperationError::QuotaExceededError;
+        }
     }
 
     database.execute_statement(
@@ -165,6 +182,19 @@ Vector<String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storag
     return keys;
 }
 
+OrderedHashMap<String, String> StorageJar::PersistedStorage::get_items(StorageEndpointType storage_endpoint, String const& storage_key)
+{
+    OrderedHashMap<String, String> items;
+    database.execute_statement(
+        statements.get_items,
+        [&](auto statement_id) {
+            items.set(database.result_column<String>(statement_id, 0), database.result_column<String>(statement_id, 1));
+        },
+        static_cast<int>(to_underlying(storage_endpoint)),
+        storage_key);
+    return items;
+}
+
 StorageOperationError StorageJar::TransientStorage::set_item(StorageLocation const& key, String const& value)
 {
     u64 current_size = 0;
@@ -176,7 +206,7 @@ StorageOperationError StorageJar::TransientStorage::set_item(StorageLocation con
     }
 
     auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
-    if (current_size + new_size > LOCAL_STORAGE_QUOTA) {
+    if (auto quota = quota_for_storage_endpoint(key.storage_endpoint); quota.has_value() && current_size + new_size > *quota) {
         return StorageOperationError::QuotaExceededError;
     }
 
@@ -219,4 +249,14 @@ Vector<String> StorageJar::TransientStorage::get_keys(StorageEndpointType storag
     return keys;
 }
 
+OrderedHashMap<String, String> StorageJar::TransientStorage::get_items(StorageEndpointType storage_endpoint, String const& storage_key)
+{
+    OrderedHashMap<String, String> items;
+    for (auto const& [key, value] : m_storage_items) {
+        if (key.storage_endpoint == storage_endpoint && key.storage_key == storage_key)
+            items.set(key.bottle_key, value);
+    }
+    return items;
+}
+
 }
@@ -41,6 +41,7 @@ public:
     void remove_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& key);
     void clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key);
     Vector<String> get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+    OrderedHashMap<String, String> get_all_items(StorageEndpointType storage_endpoint, String const& storage_key);
 
 private:
     struct Statements {
@@ -49,6 +50,7 @@ private:
         Database::StatementID get_item { 0 };
         Database::StatementID clear { 0 };
         Database::StatementID get_keys { 0 };
+        Database::StatementID get_items { 0 };
         Database::StatementID calculate_size_excluding_key { 0 };
     };
 
@@ -59,6 +61,7 @@ private:
         void delete_item(StorageLocation const& key);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
         Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        OrderedHashMap<String, String> get_items(StorageEndpointType storage_endpoint, String const& storage_key);
 
     private:
         HashMap<StorageLocation, String> m_storage_items;
@@ -70,6 +73,7 @@ private:
         void delete_item(StorageLocation const& key);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
         Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        OrderedHashMap<String, String> get_items(StorageEndpointType storage_endpoint, String const& storage_key);
 
         Database& database;
         Statements statements;
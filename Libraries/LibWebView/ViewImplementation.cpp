@@ -787,6 +787,20 @@ ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
     return path;
 }
 
+ErrorOr<LexicalPath> ViewImplementation::dump_memory_report()
+{
+    auto promise = request_internal_page_info(PageInfoType::MemoryReport);
+    auto memory_report_json = TRY(promise->await());
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(AK::UnixDateTime::now().to_string("memory-report-%Y-%m-%d-%H-%M-%S.json"sv)));
+
+    auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(dump_file->write_until_depleted(memory_report_json.bytes()));
+
+    return path;
+}
+
 void ViewImplementation::set_user_style_sheet(String const& source)
 {
     client().async_set_user_style(page_id(), source);
@@ -91,6 +91,11 @@ void WebContentClient::did_start_loading(u64 page_id, URL::URL url, bool is_redi
     if (auto process = WebView::Application::the().find_process(m_process_handle.pid); process.has_value())
         process->set_title(OptionalNone {});
 
+    // OPTIMIZATION: Start connecting to the origins this site contacted on previous visits, so that the connections are
+    //               (hopefully) ready by the time the parser discovers the subresources that need them.
+    for (auto const& origin : Application::connection_predictor().predict_origins(url))
+        Application::request_server_client().ensure_connection(origin, RequestServer::CacheLevel::CreateConnection);
+
     if (auto view = view_for_page_id(page_id); view.has_value()) {
         view->set_url({}, url);
 
@@ -116,6 +121,11 @@ void WebContentClient::did_finish_loading(u64 page_id, URL::URL url)
     }
 }
 
+void WebContentClient::did_load_with_network_request_origins(u64, URL::URL url, Vector<String> origins)
+{
+    Application::connection_predictor().did_load_with_network_request_origins(url, origins);
+}
+
 void WebContentClient::did_finish_test(u64 page_id, String text)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -520,6 +530,19 @@ void WebContentClient::did_expire_cookies_with_time_offset(AK::Duration offset)
     Application::cookie_jar().expire_cookies_with_time_offset(offset);
 }
 
+// WebContent processes cache the local storage items they use, so let the others know when a storage key's items change.
+void WebContentClient::notify_local_storage_changed(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
+{
+    if (storage_endpoint != Web::StorageAPI::StorageEndpointType::LocalStorage)
+        return;
+
+    for_each_client([&](WebContentClient& client) {
+        if (&client != this)
+            client.async_local_storage_changed(storage_key);
+        return IterationDecision::Continue;
+    });
+}
+
 Messages::WebContentClient::DidRequestStorageItemResponse WebContentClient::did_request_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
 {
     return Application::storage_jar().get_item(storage_endpoint, storage_key, bottle_key);
@@ -527,12 +550,16 @@ Messages::WebContentClient::DidRequestStorageItemResponse WebContentClient::did_
 
 Messages::WebContentClient::DidSetStorageItemResponse WebContentClient::did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key, String value)
 {
-    return Application::storage_jar().set_item(storage_endpoint, storage_key, bottle_key, value);
+    auto result = Application::storage_jar().set_item(storage_endpoint, storage_key, bottle_key, value);
+    if (result == StorageOperationError::None)
+        notify_local_storage_changed(storage_endpoint, storage_key);
+    return result;
 }
 
 void WebContentClient::did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, String bottle_key)
 {
     Application::storage_jar().remove_item(storage_endpoint, storage_key, bottle_key);
+    notify_local_storage_changed(storage_endpoint, storage_key);
 }
 
 Messages::WebContentClient::DidRequestStorageKeysResponse WebContentClient::did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
@@ -540,9 +567,33 @@ Messages::WebContentClient::DidRequestStorageKeysResponse WebContentClient::did_
     return Application::storage_jar().get_all_keys(storage_endpoint, storage_key);
 }
 
+Messages::WebContentClient::DidRequestStorageItemsResponse WebContentClient::did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
+{
+    return Application::storage_jar().get_all_items(storage_endpoint, storage_key);
+}
+
+void WebContentClient::did_update_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key, OrderedHashMap<String, Optional<String>> changes)
+{
+    auto& storage_jar = Application::storage_jar();
+
+    for (auto const& [bottle_key, value] : changes) {
+        if (!value.has_value()) {
+            storage_jar.remove_item(storage_endpoint, storage_key, bottle_key);
+            continue;
+        }
+
+        // NOTE: The WebContent process has already checked the change against the bottle's quota.
+        if (storage_jar.set_item(storage_endpoint, storage_key, bottle_key, *value) != StorageOperationError::None)
+            dbgln("WebContentClient: Unable to store item '{}' for storage key '{}'", bottle_key, storage_key);
+    }
+
+    notify_local_storage_changed(storage_endpoint, storage_key);
+}
+
 void WebContentClient::did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String storage_key)
 {
     Application::storage_jar().clear_storage_key(storage_endpoint, storage_key);
+    notify_local_storage_changed(storage_endpoint, storage_key);
 }
 
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab activate_tab, Web::HTML::WebViewHints hints, Optional<u64> page_index)
@@ -710,7 +761,7 @@ void WebContentClient::did_allocate_backing_stores(u64 page_id, i32 front_bitmap
 Messages::WebContentClient::RequestWorkerAgentResponse WebContentClient::request_worker_agent(u64 page_id, Web::Bindings::AgentType worker_type)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
-        auto worker_client = MUST(WebView::launch_web_worker_process(worker_type));
+        auto worker_client = MUST(Application::the().launch_web_worker_process(worker_type));
         return worker_client->clone_transport();
     }
 
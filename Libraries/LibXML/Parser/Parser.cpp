@@ -70,16 +70,43 @@ namespace XML {
 
 size_t Parser::s_debug_indent_level { 0 };
 
-void Parser::append_node(NonnullOwnPtr<Node> node)
+void Parser::enter_element(StartTag const& tag)
 {
+    // NOTE: When parsing with a listener, we don't build a tree of nodes; the listener is told about elements as they
+    //       are parsed instead.
+    if (m_listener) {
+        m_listener->element_start(tag.name, m_attributes.span());
+        return;
+    }
+
+    HashMap<Name, ByteString> attributes;
+    attributes.ensure_capacity(m_attributes.size());
+    for (auto& attribute : m_attributes)
+        attributes.set(move(attribute.name), move(attribute.value));
+
+    auto node = make<Node>(tag.position, Node::Element { tag.name, move(attributes), {} });
+
+    Node* entered_node = nullptr;
     if (m_entered_node) {
         auto& entered_element = m_entered_node->content.get<Node::Element>();
         entered_element.children.append(move(node));
-        enter_node(*entered_element.children.last());
+        entered_node = entered_element.children.last().ptr();
+        entered_node->parent = m_entered_node;
     } else {
         m_root_node = move(node);
-        enter_node(*m_root_node);
+        entered_node = m_root_node.ptr();
     }
+    m_entered_node = entered_node;
+}
+
+void Parser::leave_element(Name const& name)
+{
+    if (m_listener) {
+        m_listener->element_end(name);
+        return;
+    }
+
+    m_entered_node = m_entered_node->parent;
 }
 
 void Parser::append_text(StringView text, LineTrackingLexer::Position position)
@@ -158,28 +185,6 @@ void Parser::append_processing_instruction(StringView target, StringView data)
     m_processing_instructions.set(target, data);
 }
 
-void Parser::enter_node(Node& node)
-{
-    if (m_listener) {
-        auto& element = node.content.get<Node::Element>();
-        m_listener->element_start(element.name, element.attributes);
-    }
-
-    if (&node != m_root_node.ptr())
-        node.parent = m_entered_node;
-    m_entered_node = &node;
-}
-
-void Parser::leave_node()
-{
-    if (m_listener) {
-        auto& element = m_entered_node->content.get<Node::Element>();
-        m_listener->element_end(element.name);
-    }
-
-    m_entered_node = m_entered_node->parent;
-}
-
 ErrorOr<Document, ParseError> Parser::parse()
 {
     if (auto result = parse_internal(); result.is_error()) {
@@ -659,20 +664,19 @@ ErrorOr<void, ParseError> Parser::parse_element()
     // element ::= EmptyElemTag
     //           | STag content ETag
     if (auto result = parse_empty_element_tag(); !result.is_error()) {
-        append_node(result.release_value());
-        leave_node();
+        auto tag = result.release_value();
+        enter_element(tag);
+        leave_element(tag.name);
         rollback.disarm();
         return {};
     }
 
     auto accept = accept_rule();
-    auto start_tag = TRY(parse_start_tag());
-    auto& node = *start_tag;
-    auto& tag = node.content.get<Node::Element>();
-    append_node(move(start_tag));
+    auto tag = TRY(parse_start_tag());
+    enter_element(tag);
     ScopeGuard quit {
         [&] {
-            leave_node();
+            leave_element(tag.name);
         }
     };
 
@@ -690,7 +694,7 @@ ErrorOr<void, ParseError> Parser::parse_element()
 }
 
 // 3.1.44. EmptyElemTag, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-EmptyElemTag
-ErrorOr<NonnullOwnPtr<Node>, ParseError> Parser::parse_empty_element_tag()
+ErrorOr<Parser::StartTag, ParseError> Parser::parse_empty_element_tag()
 {
     auto rollback = rollback_point();
     auto rule = enter_rule();
@@ -700,27 +704,33 @@ ErrorOr<NonnullOwnPtr<Node>, ParseError> Parser::parse_empty_element_tag()
     TRY(expect("<"sv));
 
     auto name = TRY(parse_name());
-    HashMap<Name, ByteString> attributes;
+    TRY(parse_attributes());
+
+    TRY(skip_whitespace());
+    TRY(expect("/>"sv));
+
+    auto accept = accept_rule();
+
+    rollback.disarm();
+    return StartTag { m_lexer.position_for(tag_start), move(name) };
+}
+
+// (S Attribute)*, as used by EmptyElemTag and STag.
+ErrorOr<void, ParseError> Parser::parse_attributes()
+{
+    m_attributes.clear_with_capacity();
 
     while (true) {
         if (auto result = skip_whitespace(Required::Yes); result.is_error())
             break;
 
-        if (auto result = parse_attribute(); !result.is_error()) {
-            auto attribute = result.release_value();
-            attributes.set(move(attribute.name), move(attribute.value));
-        } else {
+        if (auto result = parse_attribute(); !result.is_error())
+            m_attributes.append(result.release_value());
+        else
             break;
-        }
     }
 
-    TRY(skip_whitespace());
-    TRY(expect("/>"sv));
-
-    auto accept = accept_rule();
-
-    rollback.disarm();
-    return make<Node>(m_lexer.position_for(tag_start), Node::Element { move(name), move(attributes), {} });
+    return {};
 }
 
 // 3.1.41. Attribute, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-Attribute
@@ -763,7 +773,13 @@ ErrorOr<ByteString, ParseError> Parser::parse_attribute_value()
 
 ErrorOr<ByteString, ParseError> Parser::parse_attribute_value_inner(StringView disallow)
 {
+    // NOTE: Most attribute values don't contain any references, so we take them from the source as-is where possible.
+    auto plain_text = m_lexer.consume_while([&](char ch) { return ch != '&' && ch != '<' && !disallow.contains(ch); });
+    if (!m_lexer.next_is('&') && !m_lexer.next_is('<'))
+        return ByteString { plain_text };
+
     StringBuilder builder;
+    builder.append(plain_text);
     while (true) {
         if (m_lexer.next_is(is_any_of(disallow)) || m_lexer.is_eof())
             break;
@@ -843,7 +859,7 @@ ErrorOr<Variant<Parser::EntityReference, ByteString>, ParseError> Parser::parse_
 }
 
 // 3.1.40 STag, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-STag
-ErrorOr<NonnullOwnPtr<Node>, ParseError> Parser::parse_start_tag()
+ErrorOr<Parser::StartTag, ParseError> Parser::parse_start_tag()
 {
     auto rollback = rollback_point();
     auto rule = enter_rule();
@@ -854,25 +870,13 @@ ErrorOr<NonnullOwnPtr<Node>, ParseError> Parser::parse_start_tag()
     auto accept = accept_rule();
 
     auto name = TRY(parse_name());
-    HashMap<Name, ByteString> attributes;
-
-    while (true) {
-        if (auto result = skip_whitespace(Required::Yes); result.is_error())
-            break;
-
-        if (auto result = parse_attribute(); !result.is_error()) {
-            auto attribute = result.release_value();
-            attributes.set(move(attribute.name), move(attribute.value));
-        } else {
-            break;
-        }
-    }
+    TRY(parse_attributes());
 
     TRY(skip_whitespace());
     TRY(expect(">"sv));
 
     rollback.disarm();
-    return make<Node>(m_lexer.position_for(tag_start), Node::Element { move(name), move(attributes), {} });
+    return StartTag { m_lexer.position_for(tag_start), move(name) };
 }
 
 // 3.1.42 ETag, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-ETag
@@ -37,7 +37,8 @@ struct Listener {
     virtual void set_doctype(XML::Doctype) { }
     virtual void document_start() { }
     virtual void document_end() { }
-    virtual void element_start(Name const&, HashMap<Name, ByteString> const&) { }
+    // NOTE: The attributes are given in the order they appear in the start tag, and are only valid for the duration of the call.
+    virtual void element_start(Name const&, ReadonlySpan<Attribute>) { }
     virtual void element_end(Name const&) { }
     virtual void text(StringView) { }
     virtual void cdata_section(StringView) { }
@@ -80,14 +81,19 @@ private:
         Name name;
     };
 
+    // The attributes of a start tag are collected in m_attributes, which is reused for every tag.
+    struct StartTag {
+        LineTrackingLexer::Position position;
+        Name name;
+    };
+
     ErrorOr<void, ParseError> parse_internal();
-    void append_node(NonnullOwnPtr<Node>);
+    void enter_element(StartTag const&);
+    void leave_element(Name const&);
     void append_text(StringView, LineTrackingLexer::Position);
     void append_comment(StringView, LineTrackingLexer::Position);
     void append_cdata_section(StringView, LineTrackingLexer::Position);
     void append_processing_instruction(StringView target, StringView data);
-    void enter_node(Node&);
-    void leave_node();
 
     enum class ReferencePlacement {
         AttributeValue,
@@ -114,8 +120,9 @@ private:
     ErrorOr<void, ParseError> parse_processing_instruction();
     ErrorOr<Name, ParseError> parse_processing_instruction_target();
     ErrorOr<Name, ParseError> parse_name();
-    ErrorOr<NonnullOwnPtr<Node>, ParseError> parse_empty_element_tag();
-    ErrorOr<NonnullOwnPtr<Node>, ParseError> parse_start_tag();
+    ErrorOr<StartTag, ParseError> parse_empty_element_tag();
+    ErrorOr<StartTag, ParseError> parse_start_tag();
+    ErrorOr<void, ParseError> parse_attributes();
     ErrorOr<Name, ParseError> parse_end_tag();
     ErrorOr<void, ParseError> parse_content();
     ErrorOr<Attribute, ParseError> parse_attribute();
@@ -212,6 +219,7 @@ private:
 
     OwnPtr<Node> m_root_node;
     Node* m_entered_node { nullptr };
+    Vector<Attribute, 8> m_attributes;
     Version m_version { Version::Version11 };
     bool m_in_compatibility_mode { false };
     ByteString m_encoding;
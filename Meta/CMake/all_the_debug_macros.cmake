@@ -28,12 +28,15 @@ set(IDB_DEBUG ON)
 set(IDL_DEBUG ON)
 set(IMAGE_DECODER_DEBUG ON)
 set(IMAGE_LOADER_DEBUG ON)
+set(IPC_STATISTICS_DEBUG ON)
 set(JOB_DEBUG ON)
 set(JS_BYTECODE_DEBUG ON)
+set(JS_BYTECODE_OP_COUNTS_DEBUG ON)
 set(JS_MODULE_DEBUG ON)
 set(LEXER_DEBUG ON)
 set(LIBWEB_CSS_ANIMATION_DEBUG ON)
 set(LIBWEB_CSS_DEBUG ON)
+set(LIBWEB_LONG_ANIMATION_FRAME_DEBUG ON)
 set(LIBWEB_WASM_DEBUG ON)
 set(LINE_EDITOR_DEBUG ON)
 set(LZW_DEBUG ON)
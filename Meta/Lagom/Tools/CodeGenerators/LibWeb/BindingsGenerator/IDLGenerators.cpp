@@ -3516,14 +3516,21 @@ static void generate_prototype_or_global_mixin_initialization(IDL::Interface con
         generator.set("define_direct_property", "object.define_direct_property");
         generator.set("define_native_accessor", "object.define_native_accessor");
         generator.set("define_native_function", "object.define_native_function");
+        generator.set("define_intrinsic_accessor", "object.define_intrinsic_accessor");
         generator.set("set_prototype", "object.set_prototype");
     } else {
         generator.set("define_direct_property", "define_direct_property");
         generator.set("define_native_accessor", "define_native_accessor");
         generator.set("define_native_function", "define_native_function");
+        generator.set("define_intrinsic_accessor", "define_intrinsic_accessor");
         generator.set("set_prototype", "set_prototype");
     }
 
+    // OPTIMIZATION: Pages only ever use a small part of the attributes and operations of the interfaces they touch, so
+    //               we only create their functions once they are first looked up. Unforgeable members are defined on
+    //               every platform object, whose shapes are shared, so they cannot be materialized lazily.
+    bool define_members_lazily = generate_unforgeables == GenerateUnforgeables::No;
+
     if (generate_unforgeables == GenerateUnforgeables::Yes) {
         generator.append(R"~~~(
 void @class_name@::define_unforgeable_attributes(JS::Realm& realm, [[maybe_unused]] JS::Object& object)
@@ -3623,7 +3630,8 @@ void @class_name@::initialize(JS::Realm& realm)
         attribute_generator.set("attribute.name", attribute.name);
         attribute_generator.set("attribute.getter_callback", attribute.getter_callback_name);
 
-        if (!attribute.readonly || attribute.extended_attributes.contains("Replaceable"sv) || attribute.extended_attributes.contains("PutForwards"sv))
+        auto has_setter = !attribute.readonly || attribute.extended_attributes.contains("Replaceable"sv) || attribute.extended_attributes.contains("PutForwards"sv);
+        if (has_setter)
             attribute_generator.set("attribute.setter_callback", attribute.setter_callback_name);
         else
             attribute_generator.set("attribute.setter_callback", "nullptr");
@@ -3634,9 +3642,27 @@ void @class_name@::initialize(JS::Realm& realm)
 )~~~");
         }
 
-        attribute_generator.append(R"~~~(
+        if (define_members_lazily) {
+            attribute_generator.append(R"~~~(
+    @define_intrinsic_accessor@("@attribute.name@"_utf16_fly_string, default_attributes, [](auto& realm) -> JS::Value {
+        auto property_name = "@attribute.name@"_utf16_fly_string;
+        JS::FunctionObject* getter_function = JS::NativeFunction::create(realm, @attribute.getter_callback@, 0, property_name, &realm, "get"sv);
+        JS::FunctionObject* setter_function = nullptr;
+)~~~");
+            if (has_setter) {
+                attribute_generator.append(R"~~~(
+        setter_function = JS::NativeFunction::create(realm, @attribute.setter_callback@, 1, property_name, &realm, "set"sv);
+)~~~");
+            }
+            attribute_generator.append(R"~~~(
+        return JS::Accessor::create(realm.vm(), getter_function, setter_function);
+    });
+)~~~");
+        } else {
+            attribute_generator.append(R"~~~(
     @define_native_accessor@(realm, "@attribute.name@"_utf16_fly_string, @attribute.getter_callback@, @attribute.setter_callback@, default_attributes);
 )~~~");
+        }
     }
 
     for (auto& function : interface.functions) {
@@ -3689,9 +3715,17 @@ void @class_name@::initialize(JS::Realm& realm)
 )~~~");
         }
 
-        function_generator.append(R"~~~(
+        if (define_members_lazily) {
+            function_generator.append(R"~~~(
+    @define_intrinsic_accessor@("@function.name@"_utf16_fly_string, default_attributes, [](auto& realm) -> JS::Value {
+        return JS::NativeFunction::create(realm, @function.name:snakecase@, @function.length@, "@function.name@"_utf16_fly_string, &realm);
+    });
+)~~~");
+        } else {
+            function_generator.append(R"~~~(
     @define_native_function@(realm, "@function.name@"_utf16_fly_string, @function.name:snakecase@, @function.length@, default_attributes);
 )~~~");
+        }
     }
 
     bool should_generate_stringifier = true;
@@ -3818,6 +3852,24 @@ void @class_name@::initialize(JS::Realm& realm)
 )~~~");
 }
 
+static bool interface_inherits_from(IDL::Interface const& interface, StringView ancestor_name)
+{
+    auto const* current_interface = &interface;
+    while (!current_interface->parent_name.is_empty()) {
+        if (current_interface->parent_name == ancestor_name)
+            return true;
+
+        auto imported_interface_iterator = interface.imported_modules.find_if([&current_interface](IDL::Interface const& imported_interface) {
+            return imported_interface.name == current_interface->parent_name;
+        });
+        if (imported_interface_iterator == interface.imported_modules.end())
+            return false;
+
+        current_interface = &*imported_interface_iterator;
+    }
+    return false;
+}
+
 // https://webidl.spec.whatwg.org/#interface-prototype-object
 static void generate_prototype_or_global_mixin_definitions(IDL::Interface const& interface, StringBuilder& builder)
 {
@@ -3860,12 +3912,25 @@ static void generate_prototype_or_global_mixin_definitions(IDL::Interface const&
 )~~~");
         }
 
-        generator.append(R"~~~(
+        // OPTIMIZATION: Most interfaces that inherit from Node have a Node::fast_is<T>() specialization, which is much
+        //               cheaper than the dynamic_cast used to check the type of arbitrary JS objects. So when this is
+        //               an interface inheriting from Node, first check that the object is a DOM node (which is a
+        //               virtual call) and then cast from there.
+        if (interface_inherits_from(interface, "Node"sv)) {
+            generator.append(R"~~~(
+    if (!this_object->is_dom_node() || !is<@fully_qualified_name@>(static_cast<DOM::Node&>(*this_object)))
+        return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@namespaced_name@");
+    return static_cast<@fully_qualified_name@*>(static_cast<DOM::Node*>(this_object));
+}
+)~~~");
+        } else {
+            generator.append(R"~~~(
     if (!is<@fully_qualified_name@>(this_object))
         return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@namespaced_name@");
     return static_cast<@fully_qualified_name@*>(this_object);
 }
 )~~~");
+        }
     }
 
     for (auto& attribute : interface.attributes) {
@@ -5353,6 +5418,7 @@ void generate_prototype_implementation(IDL::Interface const& interface, StringBu
     generator.append(R"~~~(
 #include <AK/Function.h>
 #include <LibIDL/Types.h>
+#include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/DataView.h>
@@ -5360,6 +5426,7 @@ void generate_prototype_implementation(IDL::Interface const& interface, StringBu
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
@@ -5773,12 +5840,14 @@ void generate_global_mixin_implementation(IDL::Interface const& interface, Strin
     generator.append(R"~~~(
 #include <AK/Function.h>
 #include <LibIDL/Types.h>
+#include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/DataView.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
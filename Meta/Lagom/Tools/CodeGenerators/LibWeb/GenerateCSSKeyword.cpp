@@ -103,31 +103,24 @@ ErrorOr<void> generate_implementation_file(JsonArray& keyword_data, Core::File&
     SourceGenerator generator { builder };
 
     generator.append(R"~~~(
+#include <AK/Array.h>
 #include <AK/Assertions.h>
-#include <AK/HashMap.h>
+#include <AK/HashFunctions.h>
+#include <AK/StringHash.h>
 #include <LibWeb/CSS/Keyword.h>
 
 namespace Web::CSS {
 
-HashMap<StringView, Keyword, AK::CaseInsensitiveASCIIStringViewTraits> g_stringview_to_keyword_map {
-)~~~");
+Optional<Keyword> keyword_from_string(StringView string)
+{)~~~");
 
+    Vector<PerfectHashEntry> entries;
     keyword_data.for_each([&](auto& name) {
-        auto member_generator = generator.fork();
-        member_generator.set("name", name.as_string());
-        member_generator.set("name:titlecase", keyword_name(name.as_string()));
-        member_generator.append(R"~~~(
-    {"@name@"sv, Keyword::@name:titlecase@},
-)~~~");
+        entries.append({ name.as_string(), MUST(String::formatted("Keyword::{}", keyword_name(name.as_string()))) });
     });
+    TRY(generate_case_insensitive_perfect_hash_lookup(generator, "Keyword"sv, move(entries)));
 
-    generator.append(R"~~~(
-};
-
-Optional<Keyword> keyword_from_string(StringView string)
-{
-    return g_stringview_to_keyword_map.get(string);
-}
+    generator.append(R"~~~(}
 
 StringView string_from_keyword(Keyword keyword) {
     switch (keyword) {
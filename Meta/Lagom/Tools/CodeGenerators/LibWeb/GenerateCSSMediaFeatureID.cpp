@@ -94,6 +94,9 @@ ErrorOr<void> generate_implementation_file(JsonObject& media_feature_data, Core:
     StringBuilder builder;
     SourceGenerator generator { builder };
     generator.append(R"~~~(
+#include <AK/Array.h>
+#include <AK/HashFunctions.h>
+#include <AK/StringHash.h>
 #include <LibWeb/CSS/MediaFeatureID.h>
 #include <LibWeb/Infra/Strings.h>
 
@@ -102,19 +105,13 @@ namespace Web::CSS {
 Optional<MediaFeatureID> media_feature_id_from_string(StringView string)
 {)~~~");
 
+    Vector<PerfectHashEntry> entries;
     media_feature_data.for_each_member([&](auto& name, auto&) {
-        auto member_generator = generator.fork();
-        member_generator.set("name", name);
-        member_generator.set("name:titlecase", title_casify(name));
-        member_generator.append(R"~~~(
-    if (string.equals_ignoring_ascii_case("@name@"sv))
-        return MediaFeatureID::@name:titlecase@;
-)~~~");
+        entries.append({ name, MUST(String::formatted("MediaFeatureID::{}", title_casify(name))) });
     });
+    TRY(generate_case_insensitive_perfect_hash_lookup(generator, "MediaFeatureID"sv, move(entries)));
 
-    generator.append(R"~~~(
-    return {};
-}
+    generator.append(R"~~~(}
 
 StringView string_from_media_feature_id(MediaFeatureID media_feature_id)
 {
@@ -450,7 +450,10 @@ ErrorOr<void> generate_implementation_file(JsonObject& properties, JsonObject& l
     SourceGenerator generator { builder };
 
     generator.append(R"~~~(
+#include <AK/Array.h>
 #include <AK/Assertions.h>
+#include <AK/HashFunctions.h>
+#include <AK/StringHash.h>
 #include <LibWeb/CSS/Enums.h>
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/PropertyID.h>
@@ -463,56 +466,36 @@ ErrorOr<void> generate_implementation_file(JsonObject& properties, JsonObject& l
 namespace Web::CSS {
 
 Optional<PropertyID> property_id_from_camel_case_string(StringView string)
-{
-)~~~");
+{)~~~");
 
+    Vector<PerfectHashEntry> camel_case_entries;
+    Vector<PerfectHashEntry> entries;
     properties.for_each_member([&](auto& name, auto& value) {
         VERIFY(value.is_object());
 
-        auto member_generator = generator.fork();
-        member_generator.set("name", name);
-        member_generator.set("name:camelcase", camel_casify(name));
-        if (auto legacy_alias_for = value.as_object().get_string("legacy-alias-for"sv); legacy_alias_for.has_value()) {
-            member_generator.set("name:titlecase", title_casify(legacy_alias_for.value()));
-        } else {
-            member_generator.set("name:titlecase", title_casify(name));
-        }
-        member_generator.append(R"~~~(
-    if (string.equals_ignoring_ascii_case("@name:camelcase@"sv))
-        return PropertyID::@name:titlecase@;
-)~~~");
+        String property_id;
+        if (auto legacy_alias_for = value.as_object().get_string("legacy-alias-for"sv); legacy_alias_for.has_value())
+            property_id = MUST(String::formatted("PropertyID::{}", title_casify(legacy_alias_for.value())));
+        else
+            property_id = MUST(String::formatted("PropertyID::{}", title_casify(name)));
+
+        camel_case_entries.append({ camel_casify(name), property_id });
+        entries.append({ name, move(property_id) });
     });
 
-    generator.append(R"~~~(
-    return {};
-}
+    TRY(generate_case_insensitive_perfect_hash_lookup(generator, "PropertyID"sv, move(camel_case_entries)));
+
+    generator.append(R"~~~(}
 
 Optional<PropertyID> property_id_from_string(StringView string)
 {
     if (is_a_custom_property_name_string(string))
         return PropertyID::Custom;
-
 )~~~");
 
-    properties.for_each_member([&](auto& name, auto& value) {
-        VERIFY(value.is_object());
+    TRY(generate_case_insensitive_perfect_hash_lookup(generator, "PropertyID"sv, move(entries)));
 
-        auto member_generator = generator.fork();
-        member_generator.set("name", name);
-        if (auto legacy_alias_for = value.as_object().get_string("legacy-alias-for"sv); legacy_alias_for.has_value()) {
-            member_generator.set("name:titlecase", title_casify(legacy_alias_for.value()));
-        } else {
-            member_generator.set("name:titlecase", title_casify(name));
-        }
-        member_generator.append(R"~~~(
-    if (string.equals_ignoring_ascii_case("@name@"sv))
-        return PropertyID::@name:titlecase@;
-)~~~");
-    });
-
-    generator.append(R"~~~(
-    return {};
-}
+    generator.append(R"~~~(}
 
 FlyString const& string_from_property_id(PropertyID property_id) {
     switch (property_id) {
@@ -98,29 +98,23 @@ ErrorOr<void> generate_implementation_file(JsonObject& pseudo_classes_data, Core
     SourceGenerator generator { builder };
 
     generator.append(R"~~~(
+#include <AK/Array.h>
+#include <AK/HashFunctions.h>
+#include <AK/StringHash.h>
 #include <LibWeb/CSS/PseudoClass.h>
 
 namespace Web::CSS {
 
 Optional<PseudoClass> pseudo_class_from_string(StringView string)
-{
-)~~~");
+{)~~~");
 
+    Vector<PerfectHashEntry> entries;
     pseudo_classes_data.for_each_member([&](auto& name, auto&) {
-        auto member_generator = generator.fork();
-        member_generator.set("name", name);
-        member_generator.set("name:titlecase", title_casify(name));
-
-        member_generator.append(R"~~~(
-    if (string.equals_ignoring_ascii_case("@name@"sv))
-        return PseudoClass::@name:titlecase@;
-)~~~");
+        entries.append({ name, MUST(String::formatted("PseudoClass::{}", title_casify(name))) });
     });
+    TRY(generate_case_insensitive_perfect_hash_lookup(generator, "PseudoClass"sv, move(entries)));
 
-    generator.append(R"~~~(
-
-    return {};
-}
+    generator.append(R"~~~(}
 
 StringView pseudo_class_name(PseudoClass pseudo_class)
 {
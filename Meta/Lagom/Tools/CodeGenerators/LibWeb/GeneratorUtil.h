@@ -8,8 +8,12 @@
 
 #pragma once
 
+#include <AK/HashFunctions.h>
 #include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <AK/SourceGenerator.h>
 #include <AK/String.h>
+#include <AK/StringHash.h>
 #include <AK/Vector.h>
 #include <LibCore/File.h>
 #include <ctype.h>
@@ -137,3 +141,133 @@ inline StringView underlying_type_for_enum(size_t member_count)
         return "u32"sv;
     return "u64"sv;
 }
+
+struct PerfectHashEntry {
+    String key;
+    String value;
+};
+
+// Generates the body of a function that returns the value of the entry whose key matches `string`, ignoring ASCII case,
+// or an empty Optional. The entries are put in a minimal perfect hash table that is built here, so a lookup costs one
+// hash of the string and one comparison with the only key it could match. The generated code needs <AK/Array.h>,
+// <AK/HashFunctions.h> and <AK/StringHash.h>.
+// If several keys are equal ignoring ASCII case, the first one wins.
+inline ErrorOr<void> generate_case_insensitive_perfect_hash_lookup(SourceGenerator& generator, StringView value_type, Vector<PerfectHashEntry> entries)
+{
+    static constexpr u32 max_seed = 1'000'000;
+
+    auto hash_key = [](StringView key) {
+        return AK::case_insensitive_string_hash(key.characters_without_null_termination(), key.length());
+    };
+    auto slot_for_hash = [](u32 hash, u32 seed, size_t size) {
+        return int_hash(hash ^ seed) % size;
+    };
+
+    for (size_t i = 0; i < entries.size(); ++i) {
+        for (size_t j = i + 1; j < entries.size();) {
+            if (entries[i].key.equals_ignoring_ascii_case(entries[j].key))
+                entries.remove(j);
+            else
+                ++j;
+        }
+    }
+
+    auto size = entries.size();
+    VERIFY(size > 0);
+
+    Vector<u32> hashes;
+    hashes.ensure_capacity(size);
+    for (auto const& entry : entries)
+        hashes.unchecked_append(hash_key(entry.key));
+
+    // This is the "hash, displace" construction: Keys are distributed into buckets by their hash, and then, starting with
+    // the largest bucket, we look for a seed that moves every key of the bucket to a slot that is still free.
+    Vector<Vector<size_t>> buckets;
+    buckets.resize(size);
+    for (size_t i = 0; i < size; ++i)
+        buckets[hashes[i] % size].append(i);
+
+    Vector<size_t> bucket_order;
+    bucket_order.ensure_capacity(size);
+    for (size_t i = 0; i < size; ++i)
+        bucket_order.unchecked_append(i);
+    quick_sort(bucket_order, [&](size_t a, size_t b) {
+        if (buckets[a].size() != buckets[b].size())
+            return buckets[a].size() > buckets[b].size();
+        return a < b;
+    });
+
+    Vector<u32> seeds;
+    seeds.resize(size);
+    Vector<Optional<size_t>> slots;
+    slots.resize(size);
+    Vector<size_t> bucket_slots;
+
+    for (auto bucket_index : bucket_order) {
+        auto const& bucket = buckets[bucket_index];
+        if (bucket.is_empty())
+            break;
+
+        u32 seed = 1;
+        for (; seed <= max_seed; ++seed) {
+            bucket_slots.clear_with_capacity();
+
+            bool fits = true;
+            for (auto entry_index : bucket) {
+                auto slot = slot_for_hash(hashes[entry_index], seed, size);
+                if (slots[slot].has_value() || bucket_slots.contains_slow(slot)) {
+                    fits = false;
+                    break;
+                }
+                bucket_slots.append(slot);
+            }
+
+            if (fits)
+                break;
+        }
+
+        if (seed > max_seed)
+            return Error::from_string_literal("Unable to find a perfect hash function for the given keys");
+
+        seeds[bucket_index] = seed;
+        for (size_t i = 0; i < bucket.size(); ++i)
+            slots[bucket_slots[i]] = bucket[i];
+    }
+
+    StringBuilder seeds_builder;
+    seeds_builder.join(", "sv, seeds);
+
+    generator.set("perfect_hash_value_type", MUST(String::from_utf8(value_type)));
+    generator.set("perfect_hash_size", String::number(size));
+    generator.set("perfect_hash_seeds", MUST(seeds_builder.to_string()));
+    generator.append(R"~~~(
+    struct Entry {
+        StringView key;
+        @perfect_hash_value_type@ value;
+    };
+
+    static constexpr Array<u32, @perfect_hash_size@> seeds { @perfect_hash_seeds@ };
+    static constexpr auto entries = to_array<Entry>({)~~~");
+
+    for (auto const& slot : slots) {
+        auto const& entry = entries[slot.value()];
+
+        auto entry_generator = generator.fork();
+        entry_generator.set("key", entry.key);
+        entry_generator.set("value", entry.value);
+        entry_generator.append(R"~~~(
+        { "@key@"sv, @value@ },)~~~");
+    }
+
+    generator.append(R"~~~(
+    });
+
+    auto hash = AK::case_insensitive_string_hash(string.characters_without_null_termination(), string.length());
+    auto const& entry = entries[int_hash(hash ^ seeds[hash % seeds.size()]) % entries.size()];
+    if (!string.equals_ignoring_ascii_case(entry.key))
+        return {};
+    return entry.value;
+)~~~");
+
+    return {};
+}
@@ -8,6 +8,7 @@
 #include <AK/IDAllocator.h>
 #include <ImageDecoder/ConnectionFromClient.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
+#include <LibCore/TraceEvent.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
@@ -84,11 +85,13 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return files;
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, bool first_frame_only, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
 {
-    bitmaps.ensure_capacity(decoder.frame_count());
-    durations.ensure_capacity(decoder.frame_count());
-    for (size_t i = 0; i < decoder.frame_count(); ++i) {
+    auto frame_count = first_frame_only ? min(decoder.frame_count(), 1uz) : decoder.frame_count();
+
+    bitmaps.ensure_capacity(frame_count);
+    durations.ensure_capacity(frame_count);
+    for (size_t i = 0; i < frame_count; ++i) {
         auto frame_or_error = decoder.frame(i, ideal_size);
         if (frame_or_error.is_error()) {
             bitmaps.unchecked_append({});
@@ -101,7 +104,7 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
     }
 }
 
-static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type, bool first_frame_only)
 {
     auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
 
@@ -115,13 +118,16 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     result.is_animated = decoder->is_animated();
     result.loop_count = decoder->loop_count();
 
+    // NOTE: Decode the frames before querying anything else that might make the plugin decode the image, so that
+    //       plugins which support it get to decode at the ideal size.
+    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), first_frame_only, bitmaps, result.durations);
+
     if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
         result.color_profile = maybe_icc_data.value();
     else
         dbgln("Invalid color profile: {}", maybe_icc_data.error());
 
-    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
-
     if (auto maybe_metadata = decoder->metadata(); maybe_metadata.has_value() && is<Gfx::ExifMetadata>(*maybe_metadata)) {
         auto const& exif = static_cast<Gfx::ExifMetadata const&>(maybe_metadata.value());
         if (exif.x_resolution().has_value() && exif.y_resolution().has_value()) {
@@ -134,8 +140,6 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
-
     if (bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
 
@@ -144,11 +148,16 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool first_frame_only)
 {
     return Job::construct(
-        [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
-            return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
+        [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type), first_frame_only](auto& job) -> ErrorOr<DecodeResult> {
+            // The job may have been cancelled while it was waiting in the queue.
+            if (job.is_canceled())
+                return Error::from_errno(ECANCELED);
+
+            TRACE_EVENT("image", "ImageDecoder::decode_image");
+            return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type, first_frame_only));
         },
         [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
             strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
@@ -156,13 +165,17 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
             return {};
         },
         [strong_this = NonnullRefPtr(*this), image_id](Error error) -> void {
+            // NOTE: Cancelled jobs report their error on the background thread. Whoever cancelled the job has already
+            //       removed it, so there is nothing left to do here.
+            if (error.is_errno() && error.code() == ECANCELED)
+                return;
             if (strong_this->is_open())
                 strong_this->async_did_fail_to_decode_image(image_id, MUST(String::formatted("Decoding failed: {}", error)));
             strong_this->m_pending_jobs.remove(image_id);
         });
 }
 
-Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool first_frame_only)
 {
     auto image_id = m_next_image_id++;
 
@@ -172,7 +185,7 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
         return image_id;
     }
 
-    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type)));
+    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type), first_frame_only));
 
     return image_id;
 }
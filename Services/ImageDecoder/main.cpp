@@ -10,8 +10,10 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
+#include <LibCore/System.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
+#include <LibThreading/BackgroundAction.h>
 
 #if defined(AK_OS_MACOS)
 #    include <LibCore/Platform/ProcessStatisticsMach.h>
@@ -34,6 +36,10 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     Core::EventLoop event_loop;
 
+    // Every decode job is independent of the others, so let them use all available cores. This keeps a single large
+    // image from holding up the decoding of every image requested after it.
+    Threading::set_background_thread_count(max(Core::System::hardware_concurrency(), 1u));
+
 #if defined(AK_OS_MACOS)
     if (!mach_server_name.is_empty())
         Core::Platform::register_with_mach_server(mach_server_name);
@@ -7,12 +7,16 @@
 #include "WebSocketImplCurl.h"
 
 #include <AK/IDAllocator.h>
+#include <AK/LexicalPath.h>
 #include <AK/NonnullOwnPtr.h>
+#include <LibCore/Directory.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
 #include <LibCore/StandardPaths.h>
+#include <LibCore/TraceEvent.h>
 #include <LibRequests/NetworkError.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
@@ -21,6 +25,7 @@
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/NetworkLog.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
@@ -31,6 +36,7 @@
 namespace RequestServer {
 
 ByteString g_default_certificate_path;
+OwnPtr<DiskCache> g_disk_cache;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
@@ -43,6 +49,44 @@ static struct {
 } g_dns_info;
 
 static WeakPtr<Resolver> s_resolver {};
+
+static constexpr size_t max_persisted_dns_entries = 256;
+
+static ByteString dns_cache_path()
+{
+    return ByteString::formatted("{}/Ladybird/dns-cache.txt", Core::StandardPaths::user_data_directory());
+}
+
+static void load_persisted_dns_entries(Resolver& resolver)
+{
+    auto file = Core::File::open(dns_cache_path(), Core::File::OpenMode::Read);
+    if (file.is_error())
+        return;
+
+    auto contents = file.value()->read_until_eof();
+    if (contents.is_error()) {
+        dbgln("RequestServer: Unable to read DNS cache: {}", contents.error());
+        return;
+    }
+
+    resolver.dns.load_serialized_entries(contents.value());
+}
+
+static void persist_dns_entries(Resolver& resolver)
+{
+    auto result = [&] -> ErrorOr<void> {
+        auto path = dns_cache_path();
+        TRY(Core::Directory::create(LexicalPath { path }.parent(), Core::Directory::CreateDirectories::Yes));
+
+        auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(resolver.dns.serialize_frequently_used_entries(max_persisted_dns_entries)));
+        return {};
+    }();
+
+    if (result.is_error())
+        dbgln("RequestServer: Unable to persist DNS cache: {}", result.error());
+}
+
 static NonnullRefPtr<Resolver> default_resolver()
 {
     if (auto resolver = s_resolver.strong_ref())
@@ -77,10 +121,33 @@ static NonnullRefPtr<Resolver> default_resolver()
         };
     });
 
+    load_persisted_dns_entries(*resolver);
+
     s_resolver = resolver;
     return resolver;
 }
 
+// NOTE: Every client has its own multi handle, but we want requests from all of them to benefit from connections, TLS
+//       sessions and DNS results that another client has already set up. All of our clients live on the same thread, so
+//       the share handle does not need lock callbacks.
+static CURLSH* shared_curl_handle()
+{
+    static CURLSH* s_share_handle = [] {
+        auto* share_handle = curl_share_init();
+        VERIFY(share_handle);
+
+        for (auto data : { CURL_LOCK_DATA_CONNECT, CURL_LOCK_DATA_SSL_SESSION, CURL_LOCK_DATA_DNS }) {
+            auto result = curl_share_setopt(share_handle, CURLSHOPT_SHARE, data);
+            if (result != CURLSHE_OK)
+                dbgln("RequestServer: Failed to share curl data: {}", curl_share_strerror(result));
+        }
+
+        return share_handle;
+    }();
+
+    return s_share_handle;
+}
+
 ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringView host, u16 port)
 {
     StringBuilder resolve_opt_builder;
@@ -113,11 +180,22 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     bool is_connect_only { false };
     size_t downloaded_so_far { 0 };
     String url;
+    ByteString method;
+    HTTP::HeaderMap request_headers;
     Optional<String> reason_phrase;
     ByteBuffer body;
+    Optional<DiskCache::CachedResponse> response_being_revalidated;
+    Optional<ByteBuffer> body_for_disk_cache;
+    bool is_served_from_disk_cache { false };
+    long http_status_code { 0 };
+    ByteString host;
+    bool is_critical_request { false };
     AllocatingMemoryStream send_buffer;
     NonnullRefPtr<Core::Notifier> write_notifier;
     bool done_fetching { false };
+    MonotonicTime start_time { MonotonicTime::now_coarse() };
+    UnixDateTime start_date_time { UnixDateTime::now() };
+    Optional<AK::Duration> dns_lookup_time;
 
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
@@ -147,19 +225,25 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
 
     ErrorOr<void> write_queued_bytes_without_blocking()
     {
-        Vector<u8> bytes_to_send;
-        bytes_to_send.resize(send_buffer.used_buffer_size());
-        send_buffer.peek_some(bytes_to_send);
-        auto result = Core::System::write(this->writer_fd, bytes_to_send);
-        if (result.is_error()) {
-            if (result.error().code() != EAGAIN) {
-                return result.release_error();
+        // NOTE: We write straight out of the queue's chunks rather than gathering everything into one buffer first.
+        while (!send_buffer.is_eof()) {
+            auto bytes_to_send = send_buffer.peek_some_contiguous();
+
+            auto result = Core::System::write(this->writer_fd, bytes_to_send);
+            if (result.is_error()) {
+                if (result.error().code() != EAGAIN) {
+                    return result.release_error();
+                }
+                write_notifier->set_enabled(true);
+                return {};
             }
-            write_notifier->set_enabled(true);
-            return {};
+
+            MUST(send_buffer.discard(result.value()));
+
+            if (result.value() < bytes_to_send.size())
+                break;
         }
 
-        MUST(send_buffer.discard(result.value()));
         write_notifier->set_enabled(!send_buffer.is_eof());
         if (send_buffer.is_eof() && done_fetching)
             schedule_self_destruction();
@@ -167,8 +251,42 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         return {};
     }
 
+    void finish_critical_request_if_needed()
+    {
+        if (!is_critical_request)
+            return;
+        is_critical_request = false;
+        if (client)
+            client->did_finish_critical_request(host);
+    }
+
+    ErrorOr<void> write_bytes_without_blocking(ReadonlyBytes bytes)
+    {
+        if (!send_buffer.is_eof()) {
+            TRY(send_buffer.write_until_depleted(bytes));
+            return write_queued_bytes_without_blocking();
+        }
+
+        // OPTIMIZATION: If nothing is queued up, hand the bytes to the pipe directly and only queue what doesn't fit.
+        auto result = Core::System::write(this->writer_fd, bytes);
+        if (result.is_error()) {
+            if (result.error().code() != EAGAIN)
+                return result.release_error();
+        } else {
+            bytes = bytes.slice(result.value());
+        }
+
+        if (bytes.is_empty())
+            return {};
+
+        TRY(send_buffer.write_until_depleted(bytes));
+        write_notifier->set_enabled(true);
+        return {};
+    }
+
     void notify_about_fetching_completion()
     {
+        finish_critical_request_if_needed();
         done_fetching = true;
         if (send_buffer.is_eof())
             schedule_self_destruction();
@@ -176,6 +294,13 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
 
     ~ActiveRequest()
     {
+        finish_critical_request_if_needed();
+
+        if (Core::TraceEvents::is_enabled()) {
+            auto name = is_connect_only ? "ActiveRequest (connect only)"sv : is_served_from_disk_cache ? "ActiveRequest (disk cache)"sv : "ActiveRequest"sv;
+            Core::TraceEvents::record("network"sv, name, start_time, MonotonicTime::now_coarse());
+        }
+
         if (!send_buffer.is_eof()) {
             dbgln("Warning: Request destroyed with buffered data (it's likely that the client disappeared or the request was cancelled)");
         }
@@ -183,9 +308,11 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
-        auto result = curl_multi_remove_handle(multi, easy);
-        VERIFY(result == CURLM_OK);
-        curl_easy_cleanup(easy);
+        if (easy) {
+            auto result = curl_multi_remove_handle(multi, easy);
+            VERIFY(result == CURLM_OK);
+            curl_easy_cleanup(easy);
+        }
 
         for (auto* string_list : curl_string_lists)
             curl_slist_free_all(string_list);
@@ -196,11 +323,51 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (got_all_headers)
             return;
         got_all_headers = true;
-        long http_status_code = 0;
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
+
+        if (response_being_revalidated.has_value() && http_status_code == 304) {
+            serve_revalidated_response();
+            return;
+        }
+        response_being_revalidated.clear();
+
+        if (g_disk_cache) {
+            if (g_disk_cache->should_store_response(method, request_headers, http_status_code, headers))
+                body_for_disk_cache = ByteBuffer {};
+            // https://httpwg.org/specs/rfc9111.html#invalidation
+            else if (!method.is_one_of("GET"sv, "HEAD"sv) && http_status_code >= 200 && http_status_code < 400)
+                g_disk_cache->remove_entry(url);
+        }
+
         client->async_headers_became_available(request_id, headers, http_status_code, reason_phrase);
     }
+
+    // https://httpwg.org/specs/rfc9111.html#freshening.responses
+    void serve_revalidated_response()
+    {
+        auto cached_response = response_being_revalidated.release_value();
+        is_served_from_disk_cache = true;
+
+        // NOTE: The 304 response carries updated metadata for the stored response, but not its framing.
+        HTTP::HeaderMap updated_headers;
+        for (auto const& header : headers.headers()) {
+            if (!header.name.is_one_of_ignoring_ascii_case("Content-Length"sv, "Content-Encoding"sv, "Transfer-Encoding"sv))
+                updated_headers.set(header.name, header.value);
+        }
+        for (auto const& header : cached_response.headers.headers()) {
+            if (!updated_headers.contains(header.name))
+                updated_headers.set(header.name, header.value);
+        }
+
+        client->async_headers_became_available(request_id, updated_headers, cached_response.status_code, cached_response.reason_phrase);
+
+        if (auto result = write_bytes_without_blocking(cached_response.body); result.is_error())
+            dbgln("Warning: Failed to write cached response data (it's likely the client disappeared): {}", result.error());
+        downloaded_so_far = cached_response.body.size();
+
+        g_disk_cache->store_entry(url, request_headers, cached_response.status_code, cached_response.reason_phrase, updated_headers, cached_response.body);
+    }
 };
 
 size_t ConnectionFromClient::on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data)
@@ -243,12 +410,15 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     size_t total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
-    auto maybe_write_error = [&] -> ErrorOr<void> {
-        TRY(request->send_buffer.write_some(bytes));
-        return request->write_queued_bytes_without_blocking();
-    }();
+    if (request->is_served_from_disk_cache)
+        return total_size;
 
-    if (maybe_write_error.is_error()) {
+    if (request->body_for_disk_cache.has_value()) {
+        if (request->body_for_disk_cache->size() + total_size > g_disk_cache->maximum_entry_size() || request->body_for_disk_cache->try_append(bytes).is_error())
+            request->body_for_disk_cache.clear();
+    }
+
+    if (auto maybe_write_error = request->write_bytes_without_blocking(bytes); maybe_write_error.is_error()) {
         dbgln("ConnectionFromClient::on_data_received: Aborting request because error occurred whilst writing data to the client: {}", maybe_write_error.error());
         return CURL_WRITEFUNC_ERROR;
     }
@@ -337,6 +507,7 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
 
 ConnectionFromClient::~ConnectionFromClient()
 {
+    m_delayed_requests.clear();
     m_active_requests.clear();
 
     curl_multi_cleanup(m_curl_multi);
@@ -349,8 +520,11 @@ void ConnectionFromClient::die()
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
 
-    if (s_connections.is_empty())
+    if (s_connections.is_empty()) {
+        if (auto resolver = s_resolver.strong_ref())
+            persist_dns_entries(*resolver);
         Core::EventLoop::current().quit(0);
+    }
 }
 
 Messages::RequestServer::InitTransportResponse ConnectionFromClient::init_transport([[maybe_unused]] int peer_pid)
@@ -452,25 +626,108 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, RequestPriority)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+// https://httpwg.org/specs/rfc7540.html#StreamPriority
+static long http2_stream_weight_for_priority(RequestPriority priority)
+{
+    switch (priority) {
+    case RequestPriority::Highest:
+        return 256;
+    case RequestPriority::High:
+        return 220;
+    case RequestPriority::Medium:
+        return 183;
+    case RequestPriority::Low:
+        return 147;
+    case RequestPriority::Lowest:
+        return 110;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static void log_failed_request(UnixDateTime start_time, ByteString method, String url, Requests::NetworkError network_error)
+{
+    NetworkLog::the().append({
+        .start_time = start_time,
+        .method = move(method),
+        .url = move(url),
+        .network_error = network_error,
+    });
+}
+
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, RequestPriority priority)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
     auto host = url.serialized_host().to_byte_string();
+    auto start_date_time = UnixDateTime::now();
+
+    Optional<DiskCache::CachedResponse> stale_response;
+    if (g_disk_cache && g_disk_cache->should_serve_request(method, request_headers)) {
+        if (auto cached_response = g_disk_cache->open_entry(url.to_string(), request_headers); cached_response.has_value()) {
+            if (g_disk_cache->should_serve_response(*cached_response)) {
+                NetworkLog::the().append({
+                    .start_time = start_date_time,
+                    .method = method,
+                    .url = url.to_string(),
+                    .request_headers = request_headers,
+                    .status_code = cached_response->status_code,
+                    .reason_phrase = cached_response->reason_phrase,
+                    .response_headers = cached_response->headers,
+                    .body_size = cached_response->body.size(),
+                    .cache_status = NetworkLogEntry::CacheStatus::Hit,
+                });
+                serve_from_disk_cache(request_id, cached_response.release_value());
+                return;
+            }
+            if (cached_response->can_be_revalidated())
+                stale_response = cached_response.release_value();
+        }
+    }
+
+    // NOTE: When replaying recorded pages, anything that was not recorded fails as if we were offline, so that every
+    //       replay loads exactly the same responses.
+    if (g_disk_cache && g_disk_cache->mode() == DiskCache::Mode::Replay) {
+        dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: No recorded response for {} {}", method, url);
+        log_failed_request(start_date_time, method, url.to_string(), Requests::NetworkError::UnableToConnect);
+        async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToConnect);
+        return;
+    }
+
+    if (priority <= RequestPriority::Low && m_critical_requests_per_host.contains(host)) {
+        dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: Delaying low priority request {} for {}", request_id, url);
+        m_delayed_requests.append({ request_id, move(host), move(method), move(url), move(request_headers), move(request_body), proxy_data, priority });
+        return;
+    }
+
+    // NOTE: The count is handed over to the ActiveRequest once we have one, which decrements it when it is done.
+    auto const is_critical_request = is_critical_priority(priority);
+    if (is_critical_request)
+        ++m_critical_requests_per_host.ensure(host, [] { return 0uz; });
+
+    auto fail_before_starting = [this, host, is_critical_request] {
+        if (is_critical_request)
+            did_finish_critical_request(host);
+    };
+
+    auto dns_lookup_start_time = MonotonicTime::now();
 
     m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA }, { .validate_dnssec_locally = g_dns_info.validate_dnssec_locally })
-        ->when_rejected([this, request_id](auto const& error) {
+        ->when_rejected([this, request_id, fail_before_starting, start_date_time, method, url = url.to_string()](auto const& error) {
+            fail_before_starting();
             dbgln("StartRequest: DNS lookup failed: {}", error);
+            log_failed_request(start_date_time, method, url, Requests::NetworkError::UnableToResolveHost);
             // FIXME: Implement timing info for DNS lookup failure.
             async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, priority, is_critical_request, fail_before_starting, stale_response = move(stale_response), start_date_time, dns_lookup_start_time](auto const& dns_result) mutable {
             if (dns_result->is_empty() || !dns_result->has_cached_addresses()) {
+                fail_before_starting();
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
+                log_failed_request(start_date_time, method, url.to_string(), Requests::NetworkError::UnableToResolveHost);
                 // FIXME: Implement timing info for DNS lookup failure.
                 async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
                 return;
@@ -480,12 +737,15 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
 
             auto* easy = curl_easy_init();
             if (!easy) {
+                fail_before_starting();
                 dbgln("StartRequest: Failed to initialize curl easy handle");
                 return;
             }
 
             auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
             if (fds_or_error.is_error()) {
+                fail_before_starting();
+                curl_easy_cleanup(easy);
                 dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
                 return;
             }
@@ -493,10 +753,23 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             auto fds = fds_or_error.release_value();
             auto writer_fd = fds[1];
             auto reader_fd = fds[0];
+
+#if defined(AK_OS_LINUX)
+            // OPTIMIZATION: The default 64 KiB pipe makes us queue up and copy most of a large response body before the
+            //               client gets to read it. Ask for a larger one; this is capped by /proc/sys/fs/pipe-max-size.
+            (void)Core::System::fcntl(writer_fd, F_SETPIPE_SZ, static_cast<int>(1 * MiB));
+#endif
+
             async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
 
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url.to_string();
+            request->host = host;
+            request->is_critical_request = is_critical_request;
+            request->method = method;
+            request->request_headers = request_headers;
+            request->start_date_time = start_date_time;
+            request->dns_lookup_time = MonotonicTime::now() - dns_lookup_start_time;
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -505,6 +778,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             };
 
             set_option(CURLOPT_PRIVATE, request.ptr());
+            set_option(CURLOPT_SHARE, shared_curl_handle());
 
             if (!g_default_certificate_path.is_empty())
                 set_option(CURLOPT_CAINFO, g_default_certificate_path.characters());
@@ -514,6 +788,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             set_option(CURLOPT_PORT, url.port_or_default());
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
             set_option(CURLOPT_PIPEWAIT, 1L);
+            set_option(CURLOPT_STREAM_WEIGHT, http2_stream_weight_for_priority(priority));
             set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
 
             set_option(CURLOPT_CUSTOMREQUEST, method.characters());
@@ -554,6 +829,15 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                 curl_headers = curl_slist_append(curl_headers, header_string.characters());
             }
 
+            if (stale_response.has_value()) {
+                // https://httpwg.org/specs/rfc9111.html#validation.sent
+                if (auto etag = stale_response->headers.get("ETag"sv); etag.has_value())
+                    curl_headers = curl_slist_append(curl_headers, ByteString::formatted("If-None-Match: {}", *etag).characters());
+                if (auto last_modified = stale_response->headers.get("Last-Modified"sv); last_modified.has_value())
+                    curl_headers = curl_slist_append(curl_headers, ByteString::formatted("If-Modified-Since: {}", *last_modified).characters());
+                request->response_being_revalidated = stale_response.release_value();
+            }
+
             if (curl_headers) {
                 set_option(CURLOPT_HTTPHEADER, curl_headers);
                 request->curl_string_lists.append(curl_headers);
@@ -581,6 +865,42 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             m_active_requests.set(request_id, move(request));
         });
 }
+
+void ConnectionFromClient::serve_from_disk_cache(i32 request_id, DiskCache::CachedResponse cached_response)
+{
+    dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: Serving request {} from the disk cache", request_id);
+
+    auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
+    if (fds_or_error.is_error()) {
+        dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
+        async_request_finished(request_id, 0, {}, Requests::NetworkError::Unknown);
+        return;
+    }
+
+    auto fds = fds_or_error.release_value();
+    auto writer_fd = fds[1];
+    auto reader_fd = fds[0];
+    async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
+
+    auto request = make<ActiveRequest>(*this, m_curl_multi, nullptr, request_id, writer_fd);
+    request->got_all_headers = true;
+    request->is_served_from_disk_cache = true;
+    request->downloaded_so_far = cached_response.body.size();
+
+    async_headers_became_available(request_id, cached_response.headers, cached_response.status_code, cached_response.reason_phrase);
+
+    if (auto maybe_write_error = request->write_bytes_without_blocking(cached_response.body); maybe_write_error.is_error()) {
+        dbgln("StartRequest: Failed to write cached response data to the client: {}", maybe_write_error.error());
+        async_request_finished(request_id, 0, {}, Requests::NetworkError::Unknown);
+        return;
+    }
+
+    async_request_finished(request_id, request->downloaded_so_far, {}, {});
+
+    auto& request_ref = *request;
+    m_active_requests.set(request_id, move(request));
+    request_ref.notify_about_fetching_completion();
+}
 #endif
 
 static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& code)
@@ -678,6 +998,49 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
     };
 }
 
+static NetworkLogEntry::Timings get_network_log_timings_from_curl_easy_handle(CURL* easy_handle, Optional<AK::Duration> dns_lookup_time)
+{
+    // NOTE: Apart from the queue time, curl measures every phase from the start of the transfer until its end.
+    auto get_time = [easy_handle](auto option) {
+        curl_off_t time_value = 0;
+        auto result = curl_easy_getinfo(easy_handle, option, &time_value);
+        VERIFY(result == CURLE_OK);
+        return time_value;
+    };
+
+    auto queue_time = get_time(CURLINFO_QUEUE_TIME_T);
+    auto domain_lookup_time = get_time(CURLINFO_NAMELOOKUP_TIME_T);
+    auto connect_time = get_time(CURLINFO_CONNECT_TIME_T);
+    auto secure_connect_time = get_time(CURLINFO_APPCONNECT_TIME_T);
+    auto request_start_time = get_time(CURLINFO_PRETRANSFER_TIME_T);
+    auto response_start_time = get_time(CURLINFO_STARTTRANSFER_TIME_T);
+    auto response_end_time = get_time(CURLINFO_TOTAL_TIME_T);
+
+    auto between = [](curl_off_t start, curl_off_t end) {
+        return AK::Duration::from_microseconds(max(end - start, 0));
+    };
+
+    NetworkLogEntry::Timings timings;
+    timings.blocked = AK::Duration::from_microseconds(queue_time);
+
+    // NOTE: We resolve hosts ourselves before handing them to curl, so curl's own lookup time is always close to zero.
+    timings.dns = dns_lookup_time;
+
+    // NOTE: The connect times are zero if an existing connection was reused.
+    auto connection_established_time = domain_lookup_time;
+    if (connect_time != 0) {
+        connection_established_time = secure_connect_time != 0 ? secure_connect_time : connect_time;
+        timings.connect = between(domain_lookup_time, connection_established_time);
+        if (secure_connect_time != 0)
+            timings.ssl = between(connect_time, secure_connect_time);
+    }
+
+    timings.send = between(connection_established_time, request_start_time);
+    timings.wait = between(request_start_time, response_start_time);
+    timings.receive = between(response_start_time, response_end_time);
+    return timings;
+}
+
 void ConnectionFromClient::check_active_requests()
 {
     int msgs_in_queue = 0;
@@ -728,6 +1091,29 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
+            if (msg->data.result == CURLE_OK && request->body_for_disk_cache.has_value())
+                g_disk_cache->store_entry(request->url, request->request_headers, request->http_status_code, request->reason_phrase, request->headers, *request->body_for_disk_cache);
+
+            long new_connection_count = 0;
+            auto get_connection_count_result = curl_easy_getinfo(msg->easy_handle, CURLINFO_NUM_CONNECTS, &new_connection_count);
+            VERIFY(get_connection_count_result == CURLE_OK);
+
+            NetworkLog::the().append({
+                .start_time = request->start_date_time,
+                .method = request->method,
+                .url = request->url,
+                .request_headers = request->request_headers,
+                .status_code = static_cast<u32>(request->http_status_code),
+                .reason_phrase = request->reason_phrase,
+                .response_headers = request->headers,
+                .body_size = request->downloaded_so_far,
+                .http_version = timing_info.http_version_alpn_identifier,
+                .connection_was_reused = new_connection_count == 0,
+                .cache_status = request->is_served_from_disk_cache ? NetworkLogEntry::CacheStatus::Revalidated : NetworkLogEntry::CacheStatus::NotCached,
+                .network_error = network_error,
+                .timings = get_network_log_timings_from_curl_easy_handle(msg->easy_handle, request->dns_lookup_time),
+            });
+
             async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
         }
 
@@ -735,8 +1121,34 @@ void ConnectionFromClient::check_active_requests()
     }
 }
 
+void ConnectionFromClient::did_finish_critical_request(ByteString const& host)
+{
+    auto it = m_critical_requests_per_host.find(host);
+    VERIFY(it != m_critical_requests_per_host.end());
+
+    if (--it->value != 0)
+        return;
+    m_critical_requests_per_host.remove(it);
+
+    Vector<DelayedRequest> requests_to_start;
+    for (size_t i = 0; i < m_delayed_requests.size();) {
+        if (m_delayed_requests[i].host == host)
+            requests_to_start.append(m_delayed_requests.take(i));
+        else
+            ++i;
+    }
+
+    for (auto& request : requests_to_start)
+        start_request(request.request_id, move(request.method), move(request.url), move(request.request_headers), move(request.request_body), request.proxy_data, request.priority);
+}
+
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
 {
+    if (auto index = m_delayed_requests.find_first_index_if([&](auto const& request) { return request.request_id == request_id; }); index.has_value()) {
+        m_delayed_requests.remove(*index);
+        return true;
+    }
+
     auto request = m_active_requests.take(request_id);
     if (!request.has_value()) {
         dbgln("StopRequest: Request ID {} not found", request_id);
@@ -781,6 +1193,7 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
         request->is_connect_only = true;
 
         set_option(CURLOPT_PRIVATE, request.ptr());
+        set_option(CURLOPT_SHARE, shared_curl_handle());
         set_option(CURLOPT_URL, url_string_value.to_byte_string().characters());
         set_option(CURLOPT_PORT, url.port_or_default());
         set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
@@ -808,6 +1221,16 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
     }
 }
 
+Messages::RequestServer::NetworkLogAsHarResponse ConnectionFromClient::network_log_as_har()
+{
+    return NetworkLog::the().to_har();
+}
+
+void ConnectionFromClient::clear_network_log()
+{
+    NetworkLog::the().clear();
+}
+
 void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, ByteString origin, Vector<ByteString> protocols, Vector<ByteString> extensions, HTTP::HeaderMap additional_request_headers)
 {
     auto host = url.serialized_host().to_byte_string();
@@ -837,19 +1260,24 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
             auto impl = WebSocketImplCurl::create(m_curl_multi);
             auto connection = WebSocket::WebSocket::create(move(connection_info), move(impl));
 
+            // NOTE: Any pending messages must reach the client before it is told about a change of state, as it would
+            //       otherwise drop messages that were received before the connection was closed.
             connection->on_open = [this, websocket_id]() {
                 async_websocket_connected(websocket_id);
             };
             connection->on_message = [this, websocket_id](auto message) {
-                async_websocket_received(websocket_id, message.is_text(), message.data());
+                queue_websocket_message(websocket_id, move(message));
             };
             connection->on_error = [this, websocket_id](auto message) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_errored(websocket_id, (i32)message);
             };
             connection->on_close = [this, websocket_id](u16 code, ByteString reason, bool was_clean) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_closed(websocket_id, code, move(reason), was_clean);
             };
             connection->on_ready_state_change = [this, websocket_id](auto state) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_ready_state_changed(websocket_id, (u32)state);
             };
 
@@ -858,6 +1286,25 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
         });
 }
 
+void ConnectionFromClient::queue_websocket_message(i64 websocket_id, WebSocket::Message message)
+{
+    auto& pending_messages = m_pending_websocket_messages.ensure(websocket_id, [&] {
+        deferred_invoke([this, websocket_id] {
+            flush_websocket_messages(websocket_id);
+        });
+        return Vector<Requests::WebSocket::Message> {};
+    });
+
+    auto is_text = message.is_text();
+    pending_messages.append(Requests::WebSocket::Message { .data = message.release_data(), .is_text = is_text });
+}
+
+void ConnectionFromClient::flush_websocket_messages(i64 websocket_id)
+{
+    if (auto messages = m_pending_websocket_messages.take(websocket_id); messages.has_value())
+        async_websocket_received(websocket_id, messages.release_value());
+}
+
 void ConnectionFromClient::websocket_send(i64 websocket_id, bool is_text, ByteBuffer data)
 {
     if (auto connection = m_websockets.get(websocket_id).value_or({}); connection && connection->ready_state() == WebSocket::ReadyState::Open)
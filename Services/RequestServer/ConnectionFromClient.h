@@ -10,6 +10,8 @@
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
+#include <RequestServer/DiskCache.h>
+#include <RequestServer/RequestPriority.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -44,23 +46,38 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, RequestPriority) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
 
+    virtual Messages::RequestServer::NetworkLogAsHarResponse network_log_as_har() override;
+    virtual void clear_network_log() override;
+
     virtual void websocket_connect(i64 websocket_id, URL::URL, ByteString, Vector<ByteString>, Vector<ByteString>, HTTP::HeaderMap) override;
     virtual void websocket_send(i64 websocket_id, bool, ByteBuffer) override;
     virtual void websocket_close(i64 websocket_id, u16, ByteString) override;
     virtual Messages::RequestServer::WebsocketSetCertificateResponse websocket_set_certificate(i64, ByteString, ByteString) override;
 
+    void queue_websocket_message(i64 websocket_id, WebSocket::Message);
+    void flush_websocket_messages(i64 websocket_id);
+
     HashMap<i32, RefPtr<WebSocket::WebSocket>> m_websockets;
 
+    // Messages received by a WebSocket are sent to the client in batches, once per event loop iteration, rather than in
+    // an IPC message each.
+    HashMap<i64, Vector<Requests::WebSocket::Message>> m_pending_websocket_messages;
+
     struct ActiveRequest;
     friend struct ActiveRequest;
 
     static ErrorOr<IPC::File> create_client_socket();
 
+    void serve_from_disk_cache(i32 request_id, DiskCache::CachedResponse);
+
+    static bool is_critical_priority(RequestPriority priority) { return priority >= RequestPriority::High; }
+    void did_finish_critical_request(ByteString const& host);
+
     static int on_socket_callback(void*, int sockfd, int what, void* user_data, void*);
     static int on_timeout_callback(void*, long timeout_ms, void* user_data);
     static size_t on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data);
@@ -68,6 +85,21 @@ private:
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
 
+    // NOTE: Low priority requests are held back while critical requests to the same host are in flight, so that they
+    //       don't compete with them for bandwidth.
+    struct DelayedRequest {
+        i32 request_id { 0 };
+        ByteString host;
+        ByteString method;
+        URL::URL url;
+        HTTP::HeaderMap request_headers;
+        ByteBuffer request_body;
+        Core::ProxyData proxy_data;
+        RequestPriority priority { RequestPriority::Medium };
+    };
+    Vector<DelayedRequest> m_delayed_requests;
+    HashMap<ByteString, size_t> m_critical_requests_per_host;
+
     void check_active_requests();
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
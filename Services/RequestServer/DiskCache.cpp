@@ -0,0 +1,473 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Debug.h>
+#include <AK/Endian.h>
+#include <AK/Hex.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <RequestServer/DiskCache.h>
+
+namespace RequestServer {
+
+static constexpr u32 cache_entry_magic = 0x4C424843; // "LBHC"
+static constexpr u32 cache_entry_version = 1;
+static constexpr auto temporary_file_suffix = ".tmp"sv;
+
+static ErrorOr<void> write_string(Stream& stream, StringView string)
+{
+    TRY(stream.write_value<LittleEndian<u32>>(string.length()));
+    TRY(stream.write_until_depleted(string.bytes()));
+    return {};
+}
+
+static ErrorOr<StringView> read_string(FixedMemoryStream& stream)
+{
+    auto length = TRY(stream.read_value<LittleEndian<u32>>());
+    auto bytes = TRY(stream.read_in_place<u8 const>(length));
+    return StringView { bytes };
+}
+
+static ErrorOr<void> write_headers(Stream& stream, Vector<HTTP::Header> const& headers)
+{
+    TRY(stream.write_value<LittleEndian<u32>>(headers.size()));
+    for (auto const& header : headers) {
+        TRY(write_string(stream, header.name));
+        TRY(write_string(stream, header.value));
+    }
+    return {};
+}
+
+static ErrorOr<Vector<HTTP::Header>> read_headers(FixedMemoryStream& stream)
+{
+    auto count = TRY(stream.read_value<LittleEndian<u32>>());
+
+    Vector<HTTP::Header> headers;
+    TRY(headers.try_ensure_capacity(count));
+
+    for (u32 i = 0; i < count; ++i) {
+        auto name = TRY(read_string(stream));
+        auto value = TRY(read_string(stream));
+        headers.unchecked_append({ name, value });
+    }
+
+    return headers;
+}
+
+template<typename Callback>
+static void for_each_cache_control_directive(HTTP::HeaderMap const& headers, Callback callback)
+{
+    auto cache_control = headers.get("Cache-Control"sv);
+    if (!cache_control.has_value())
+        return;
+
+    cache_control->view().for_each_split_view(',', SplitBehavior::Nothing, [&](StringView directive) {
+        directive = directive.trim_whitespace();
+
+        if (auto equals_index = directive.find('='); equals_index.has_value())
+            callback(directive.substring_view(0, *equals_index).trim_whitespace(), directive.substring_view(*equals_index + 1).trim_whitespace().trim("\""sv));
+        else
+            callback(directive, StringView {});
+    });
+}
+
+static bool has_cache_control_directive(HTTP::HeaderMap const& headers, StringView name)
+{
+    bool found = false;
+    for_each_cache_control_directive(headers, [&](StringView directive, StringView) {
+        if (directive.equals_ignoring_ascii_case(name))
+            found = true;
+    });
+    return found;
+}
+
+static Optional<u64> cache_control_directive_value(HTTP::HeaderMap const& headers, StringView name)
+{
+    Optional<u64> result;
+    for_each_cache_control_directive(headers, [&](StringView directive, StringView value) {
+        if (!result.has_value() && directive.equals_ignoring_ascii_case(name))
+            result = value.to_number<u64>();
+    });
+    return result;
+}
+
+static Optional<UnixDateTime> parse_http_date(HTTP::HeaderMap const& headers, StringView name)
+{
+    auto value = headers.get(name);
+    if (!value.has_value())
+        return {};
+
+    auto date_time = Core::DateTime::parse("%a, %d %b %Y %H:%M:%S %Z"sv, *value);
+    if (!date_time.has_value())
+        return {};
+
+    return UnixDateTime::from_seconds_since_epoch(date_time->timestamp());
+}
+
+// https://httpwg.org/specs/rfc9111.html#calculating.freshness.lifetime
+static AK::Duration freshness_lifetime(HTTP::HeaderMap const& response_headers)
+{
+    if (has_cache_control_directive(response_headers, "no-cache"sv))
+        return {};
+
+    // If the max-age response directive (Section 5.2.2.1) is present, use its value, or
+    if (auto max_age = cache_control_directive_value(response_headers, "max-age"sv); max_age.has_value())
+        return AK::Duration::from_seconds(static_cast<i64>(min(*max_age, static_cast<u64>(NumericLimits<i32>::max()))));
+
+    auto date = parse_http_date(response_headers, "Date"sv).value_or(UnixDateTime::now());
+
+    // If the Expires response header field (Section 5.3) is present, use its value minus the value of the Date response
+    // header field (using the time the message was received if it is not present, as per Section 6.6.1 of [HTTP]), or
+    if (response_headers.contains("Expires"sv)) {
+        auto expires = parse_http_date(response_headers, "Expires"sv);
+        if (!expires.has_value() || *expires <= date)
+            return {};
+        return *expires - date;
+    }
+
+    // Otherwise, no explicit expiration time is present in the response. A heuristic freshness lifetime might be
+    // applicable; see Section 4.2.2.
+    // NOTE: We follow the suggestion of Section 4.2.2 and use 10% of the time since the response was last modified.
+    if (auto last_modified = parse_http_date(response_headers, "Last-Modified"sv); last_modified.has_value() && *last_modified < date)
+        return AK::Duration::from_seconds((date - *last_modified).to_seconds() / 10);
+
+    return {};
+}
+
+// https://httpwg.org/specs/rfc9111.html#age.calculations
+static AK::Duration current_age(HTTP::HeaderMap const& response_headers)
+{
+    if (auto age = response_headers.get("Age"sv); age.has_value()) {
+        if (auto age_value = age->to_number<u32>(); age_value.has_value())
+            return AK::Duration::from_seconds(*age_value);
+    }
+    return {};
+}
+
+static Vector<StringView> vary_header_names(HTTP::HeaderMap const& response_headers)
+{
+    Vector<StringView> names;
+
+    if (auto vary = response_headers.get("Vary"sv); vary.has_value()) {
+        vary->view().for_each_split_view(',', SplitBehavior::Nothing, [&](StringView name) {
+            names.append(name.trim_whitespace());
+        });
+    }
+
+    return names;
+}
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(ByteString directory, Mode mode, u64 maximum_size)
+{
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes));
+
+    // NOTE: An archive of recorded pages must keep every response it was given.
+    if (mode != Mode::Normal)
+        maximum_size = NumericLimits<u64>::max();
+
+    auto disk_cache = adopt_own(*new DiskCache(move(directory), mode, maximum_size));
+    TRY(disk_cache->load_index());
+    disk_cache->evict_entries_if_needed();
+
+    return disk_cache;
+}
+
+DiskCache::DiskCache(ByteString directory, Mode mode, u64 maximum_size)
+    : m_directory(move(directory))
+    , m_mode(mode)
+    , m_maximum_size(maximum_size)
+{
+}
+
+ErrorOr<void> DiskCache::load_index()
+{
+    return Core::Directory::for_each_entry(m_directory, Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const& directory) -> ErrorOr<IterationDecision> {
+        if (entry.type != Core::DirectoryEntry::Type::File)
+            return IterationDecision::Continue;
+
+        auto path = path_for_key(entry.name);
+
+        // NOTE: A leftover temporary file means we were interrupted while writing an entry.
+        if (entry.name.ends_with(temporary_file_suffix)) {
+            (void)Core::System::unlink(path);
+            return IterationDecision::Continue;
+        }
+
+        auto stat = directory.stat(entry.name, 0);
+        if (stat.is_error())
+            return IterationDecision::Continue;
+
+        auto size = static_cast<u64>(stat.value().st_size);
+        auto last_access_time = UnixDateTime::from_seconds_since_epoch(stat.value().st_mtime);
+
+        m_entries.set(entry.name, { .size = size, .last_access_time = last_access_time });
+        m_total_size += size;
+
+        return IterationDecision::Continue;
+    });
+}
+
+bool DiskCache::can_serve_request(StringView method, HTTP::HeaderMap const& request_headers)
+{
+    if (method != "GET"sv)
+        return false;
+
+    // NOTE: Conditional and range requests expect the server's answer to them, and we do not store credentialed
+    //       responses. Leave all of those to the network.
+    for (auto header : { "Authorization"sv, "Range"sv, "If-Match"sv, "If-None-Match"sv, "If-Modified-Since"sv, "If-Unmodified-Since"sv, "If-Range"sv }) {
+        if (request_headers.contains(header))
+            return false;
+    }
+
+    if (has_cache_control_directive(request_headers, "no-cache"sv) || has_cache_control_directive(request_headers, "no-store"sv))
+        return false;
+
+    if (auto pragma = request_headers.get("Pragma"sv); pragma.has_value() && pragma->equals_ignoring_ascii_case("no-cache"sv))
+        return false;
+
+    return true;
+}
+
+// https://httpwg.org/specs/rfc9111.html#response.cacheability
+bool DiskCache::is_storable(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers)
+{
+    if (method != "GET"sv || status_code != 200)
+        return false;
+
+    if (request_headers.contains("Authorization"sv) || request_headers.contains("Range"sv))
+        return false;
+
+    if (has_cache_control_directive(request_headers, "no-store"sv) || has_cache_control_directive(response_headers, "no-store"sv))
+        return false;
+
+    // NOTE: This cache is shared between all clients of RequestServer, so we treat it like a shared cache and do not
+    //       store responses that are private to a user.
+    if (has_cache_control_directive(response_headers, "private"sv) || response_headers.contains("Set-Cookie"sv))
+        return false;
+
+    if (vary_header_names(response_headers).contains_slow("*"sv))
+        return false;
+
+    if (freshness_lifetime(response_headers) > current_age(response_headers))
+        return true;
+
+    // NOTE: A response that would be stale immediately is still worth storing if we can revalidate it later.
+    return response_headers.contains("ETag"sv) || response_headers.contains("Last-Modified"sv);
+}
+
+bool DiskCache::should_serve_request(StringView method, HTTP::HeaderMap const& request_headers) const
+{
+    if (m_mode == Mode::Replay)
+        return method == "GET"sv;
+    return can_serve_request(method, request_headers);
+}
+
+bool DiskCache::should_store_response(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers) const
+{
+    switch (m_mode) {
+    case Mode::Normal:
+        return is_storable(method, request_headers, status_code, response_headers);
+    case Mode::Record:
+        // NOTE: Redirects and errors are part of the recorded page as well. Partial responses are not, as we would
+        //       replay them as the full response.
+        return method == "GET"sv && status_code != 206 && !request_headers.contains("Range"sv);
+    case Mode::Replay:
+        return false;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+Optional<DiskCache::CachedResponse> DiskCache::open_entry(StringView url, HTTP::HeaderMap const& request_headers)
+{
+    auto key = key_for_url(url);
+
+    auto metadata = m_entries.get(key);
+    if (!metadata.has_value())
+        return {};
+
+    auto path = path_for_key(key);
+
+    auto response = read_entry(path, url, request_headers);
+    if (response.is_error()) {
+        dbgln_if(REQUESTSERVER_DEBUG, "DiskCache: Unable to use entry for {}: {}", url, response.error());
+        return {};
+    }
+
+    metadata->last_access_time = UnixDateTime::now();
+
+    // NOTE: The modification time is what we use to restore the LRU order on startup.
+    (void)Core::System::utimensat(AT_FDCWD, path, nullptr, 0);
+
+    return response.release_value();
+}
+
+ErrorOr<DiskCache::CachedResponse> DiskCache::read_entry(ByteString const& path, StringView url, HTTP::HeaderMap const& request_headers) const
+{
+    auto file = TRY(Core::MappedFile::map(path));
+    FixedMemoryStream stream { file->bytes() };
+
+    if (TRY(stream.read_value<LittleEndian<u32>>()) != cache_entry_magic)
+        return Error::from_string_literal("Invalid cache entry");
+    if (TRY(stream.read_value<LittleEndian<u32>>()) != cache_entry_version)
+        return Error::from_string_literal("Unsupported cache entry version");
+
+    // NOTE: The file name is only a hash of the URL, so make sure this really is the entry we are looking for.
+    if (TRY(read_string(stream)) != url)
+        return Error::from_string_literal("Cache entry URL mismatch");
+
+    auto vary_headers = TRY(read_headers(stream));
+    for (auto const& vary_header : vary_headers) {
+        if (request_headers.get(vary_header.name).value_or({}) != vary_header.value)
+            return Error::from_string_literal("Cache entry was stored for a different variant");
+    }
+
+    auto status_code = TRY(stream.read_value<LittleEndian<u32>>());
+    auto expiration_time = UnixDateTime::from_seconds_since_epoch(TRY(stream.read_value<LittleEndian<i64>>()));
+
+    Optional<String> reason_phrase;
+    if (TRY(stream.read_value<u8>()) != 0)
+        reason_phrase = TRY(String::from_utf8(TRY(read_string(stream))));
+
+    auto headers = TRY(read_headers(stream));
+
+    auto body_size = TRY(stream.read_value<LittleEndian<u64>>());
+    auto body = TRY(stream.read_in_place<u8 const>(body_size));
+
+    return CachedResponse {
+        .file = move(file),
+        .status_code = status_code,
+        .reason_phrase = move(reason_phrase),
+        .headers = HTTP::HeaderMap { move(headers) },
+        .expiration_time = expiration_time,
+        .body = body,
+    };
+}
+
+void DiskCache::store_entry(StringView url, HTTP::HeaderMap const& request_headers, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body)
+{
+    if (body.size() > maximum_entry_size())
+        return;
+
+    auto key = key_for_url(url);
+    auto path = path_for_key(key);
+
+    auto size = write_entry(path, url, request_headers, status_code, reason_phrase, response_headers, body);
+    if (size.is_error()) {
+        dbgln("DiskCache: Unable to store entry for {}: {}", url, size.error());
+        forget_entry(key);
+        return;
+    }
+
+    if (auto metadata = m_entries.get(key); metadata.has_value())
+        m_total_size -= metadata->size;
+
+    m_entries.set(key, { .size = size.value(), .last_access_time = UnixDateTime::now() });
+    m_total_size += size.value();
+
+    dbgln_if(REQUESTSERVER_DEBUG, "DiskCache: Stored {} bytes for {}", size.value(), url);
+
+    evict_entries_if_needed();
+}
+
+ErrorOr<u64> DiskCache::write_entry(ByteString const& path, StringView url, HTTP::HeaderMap const& request_headers, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body) const
+{
+    Vector<HTTP::Header> vary_headers;
+    for (auto name : vary_header_names(response_headers))
+        vary_headers.append({ name, request_headers.get(name).value_or({}) });
+
+    auto expiration_time = UnixDateTime::now() + freshness_lifetime(response_headers) - current_age(response_headers);
+
+    AllocatingMemoryStream metadata;
+    TRY(metadata.write_value<LittleEndian<u32>>(cache_entry_magic));
+    TRY(metadata.write_value<LittleEndian<u32>>(cache_entry_version));
+    TRY(write_string(metadata, url));
+    TRY(write_headers(metadata, vary_headers));
+    TRY(metadata.write_value<LittleEndian<u32>>(status_code));
+    TRY(metadata.write_value<LittleEndian<i64>>(expiration_time.seconds_since_epoch()));
+    TRY(metadata.write_value<u8>(reason_phrase.has_value()));
+    if (reason_phrase.has_value())
+        TRY(write_string(metadata, *reason_phrase));
+    TRY(write_headers(metadata, response_headers.headers()));
+    TRY(metadata.write_value<LittleEndian<u64>>(body.size()));
+
+    auto metadata_bytes = TRY(metadata.read_until_eof());
+
+    // NOTE: We write the entry to a temporary file first, so that a concurrent reader (or a crash) never sees a
+    //       partially written entry. Any existing mapping of the old entry stays valid after the rename.
+    auto temporary_path = ByteString::formatted("{}{}", path, temporary_file_suffix);
+
+    auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate, 0600));
+    TRY(file->write_until_depleted(metadata_bytes));
+    TRY(file->write_until_depleted(body));
+    file->close();
+
+    TRY(Core::System::rename(temporary_path, path));
+
+    return metadata_bytes.size() + body.size();
+}
+
+void DiskCache::remove_entry(StringView url)
+{
+    // NOTE: A recorded page is not invalidated by the requests made to record or replay it.
+    if (m_mode != Mode::Normal)
+        return;
+
+    forget_entry(key_for_url(url));
+}
+
+void DiskCache::forget_entry(ByteString const& key)
+{
+    auto metadata = m_entries.take(key);
+    if (!metadata.has_value())
+        return;
+
+    m_total_size -= metadata->size;
+    (void)Core::System::unlink(path_for_key(key));
+}
+
+void DiskCache::evict_entries_if_needed()
+{
+    if (m_total_size <= m_maximum_size)
+        return;
+
+    Vector<ByteString> keys;
+    keys.ensure_capacity(m_entries.size());
+    for (auto const& entry : m_entries)
+        keys.unchecked_append(entry.key);
+
+    quick_sort(keys, [&](auto const& a, auto const& b) {
+        return m_entries.get(a)->last_access_time < m_entries.get(b)->last_access_time;
+    });
+
+    // NOTE: Evict down to 90% of the limit, so that we don't have to do this again on every subsequent store.
+    auto target_size = m_maximum_size - m_maximum_size / 10;
+
+    for (auto const& key : keys) {
+        if (m_total_size <= target_size)
+            break;
+
+        dbgln_if(REQUESTSERVER_DEBUG, "DiskCache: Evicting entry {}", key);
+        forget_entry(key);
+    }
+}
+
+ByteString DiskCache::key_for_url(StringView url) const
+{
+    auto digest = Crypto::Hash::SHA256::hash(url);
+    return encode_hex(digest.bytes());
+}
+
+ByteString DiskCache::path_for_key(StringView key) const
+{
+    return ByteString::formatted("{}/{}", m_directory, key);
+}
+
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <LibCore/MappedFile.h>
+#include <LibHTTP/HeaderMap.h>
+
+namespace RequestServer {
+
+// A persistent HTTP cache for the responses fetched by RequestServer, shared between all of its clients.
+//
+// Every entry lives in its own file, named after the SHA-256 of the request URL, holding the response metadata followed
+// by the response body. Entries are mapped into memory when read, and the least recently used entries are evicted once
+// the total size of the cache exceeds its limit.
+//
+// The cache may also be used as an archive of recorded pages, so that page loads can be benchmarked against the same
+// responses every time: in record mode, every response to a GET request is stored, and nothing is ever evicted. In
+// replay mode, every GET request is answered from the archive regardless of freshness, and nothing goes to the network.
+class DiskCache {
+public:
+    static constexpr u64 default_maximum_size = 256 * MiB;
+
+    enum class Mode : u8 {
+        Normal,
+        Record,
+        Replay,
+    };
+
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(ByteString directory, Mode = Mode::Normal, u64 maximum_size = default_maximum_size);
+
+    Mode mode() const { return m_mode; }
+
+    struct CachedResponse {
+        NonnullOwnPtr<Core::MappedFile> file;
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap headers;
+        UnixDateTime expiration_time;
+        ReadonlyBytes body; // Points into the mapped file.
+
+        bool is_fresh() const { return UnixDateTime::now() < expiration_time; }
+        bool can_be_revalidated() const { return headers.contains("ETag"sv) || headers.contains("Last-Modified"sv); }
+    };
+
+    // Returns whether we may answer a request from the cache at all (e.g. a GET without conditional or range headers).
+    static bool can_serve_request(StringView method, HTTP::HeaderMap const& request_headers);
+
+    // Returns whether a response to the given request may be written to the cache.
+    static bool is_storable(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers);
+
+    // These answer the questions above for the mode of this cache.
+    bool should_serve_request(StringView method, HTTP::HeaderMap const& request_headers) const;
+    bool should_store_response(StringView method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers) const;
+    bool should_serve_response(CachedResponse const& response) const { return m_mode == Mode::Replay || response.is_fresh(); }
+
+    Optional<CachedResponse> open_entry(StringView url, HTTP::HeaderMap const& request_headers);
+    void store_entry(StringView url, HTTP::HeaderMap const& request_headers, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body);
+    void remove_entry(StringView url);
+
+    u64 maximum_entry_size() const { return m_maximum_size / 8; }
+
+private:
+    DiskCache(ByteString directory, Mode, u64 maximum_size);
+
+    ErrorOr<void> load_index();
+    ErrorOr<CachedResponse> read_entry(ByteString const& path, StringView url, HTTP::HeaderMap const& request_headers) const;
+    ErrorOr<u64> write_entry(ByteString const& path, StringView url, HTTP::HeaderMap const& request_headers, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body) const;
+
+    ByteString key_for_url(StringView url) const;
+    ByteString path_for_key(StringView key) const;
+
+    void forget_entry(ByteString const& key);
+    void evict_entries_if_needed();
+
+    struct EntryMetadata {
+        u64 size { 0 };
+        UnixDateTime last_access_time;
+    };
+
+    ByteString m_directory;
+    Mode m_mode { Mode::Normal };
+    u64 m_maximum_size { 0 };
+    u64 m_total_size { 0 };
+    HashMap<ByteString, EntryMetadata> m_entries;
+};
+
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <RequestServer/NetworkLog.h>
+
+namespace RequestServer {
+
+NetworkLog& NetworkLog::the()
+{
+    static NetworkLog s_the;
+    return s_the;
+}
+
+void NetworkLog::append(NetworkLogEntry entry)
+{
+    // NOTE: The log is only meant to cover the last few page loads, so we drop the oldest entries once it is full.
+    if (m_entries.size() == max_entries)
+        m_entries.remove(0, max_entries / 4);
+
+    m_entries.append(move(entry));
+}
+
+static String to_iso8601(UnixDateTime time)
+{
+    auto milliseconds = time.milliseconds_since_epoch() % 1000;
+    return MUST(String::formatted("{}.{:03}Z", time.to_byte_string("%Y-%m-%dT%H:%M:%S"sv, UnixDateTime::LocalTime::No), milliseconds));
+}
+
+static double to_milliseconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_microseconds()) / 1000.0;
+}
+
+static JsonArray headers_to_json(HTTP::HeaderMap const& headers)
+{
+    JsonArray array;
+    for (auto const& header : headers.headers()) {
+        JsonObject object;
+        object.set("name"sv, header.name.view());
+        object.set("value"sv, header.value.view());
+        array.must_append(move(object));
+    }
+    return array;
+}
+
+static StringView header_value(HTTP::HeaderMap const& headers, StringView name)
+{
+    if (auto value = headers.get(name); value.has_value())
+        return value->view();
+    return {};
+}
+
+static StringView cache_status_to_string(NetworkLogEntry::CacheStatus cache_status)
+{
+    switch (cache_status) {
+    case NetworkLogEntry::CacheStatus::NotCached:
+        return "not-cached"sv;
+    case NetworkLogEntry::CacheStatus::Hit:
+        return "hit"sv;
+    case NetworkLogEntry::CacheStatus::Revalidated:
+        return "revalidated"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static JsonObject entry_to_json(NetworkLogEntry const& entry)
+{
+    auto http_version = Requests::alpn_http_version_to_fly_string(entry.http_version);
+
+    JsonObject request;
+    request.set("method"sv, entry.method.view());
+    request.set("url"sv, entry.url);
+    request.set("httpVersion"sv, http_version.to_string());
+    request.set("cookies"sv, JsonArray {});
+    request.set("headers"sv, headers_to_json(entry.request_headers));
+    request.set("queryString"sv, JsonArray {});
+    request.set("headersSize"sv, -1);
+    request.set("bodySize"sv, -1);
+
+    JsonObject content;
+    content.set("size"sv, entry.body_size);
+    content.set("mimeType"sv, header_value(entry.response_headers, "Content-Type"sv));
+
+    JsonObject response;
+    response.set("status"sv, entry.status_code);
+    response.set("statusText"sv, entry.reason_phrase.value_or({}));
+    response.set("httpVersion"sv, http_version.to_string());
+    response.set("cookies"sv, JsonArray {});
+    response.set("headers"sv, headers_to_json(entry.response_headers));
+    response.set("content"sv, move(content));
+    response.set("redirectURL"sv, header_value(entry.response_headers, "Location"sv));
+    response.set("headersSize"sv, -1);
+    response.set("bodySize"sv, entry.cache_status == NetworkLogEntry::CacheStatus::Hit ? 0 : entry.body_size);
+
+    // NOTE: HAR uses -1 for the phases which do not apply to a request, and the total time is the sum of all others.
+    auto total_time = AK::Duration::zero();
+    JsonObject timings;
+    auto set_timing = [&](StringView name, Optional<AK::Duration> duration, bool is_part_of_total = true) {
+        if (!duration.has_value()) {
+            timings.set(name, -1);
+            return;
+        }
+        timings.set(name, to_milliseconds(*duration));
+        if (is_part_of_total)
+            total_time += *duration;
+    };
+    set_timing("blocked"sv, entry.timings.blocked);
+    set_timing("dns"sv, entry.timings.dns);
+    set_timing("connect"sv, entry.timings.connect);
+    // NOTE: The TLS handshake is already included in the time spent connecting.
+    set_timing("ssl"sv, entry.timings.ssl, false);
+    set_timing("send"sv, entry.timings.send.value_or(AK::Duration::zero()));
+    set_timing("wait"sv, entry.timings.wait.value_or(AK::Duration::zero()));
+    set_timing("receive"sv, entry.timings.receive.value_or(AK::Duration::zero()));
+
+    JsonObject object;
+    object.set("startedDateTime"sv, to_iso8601(entry.start_time));
+    object.set("time"sv, to_milliseconds(total_time));
+    object.set("request"sv, move(request));
+    object.set("response"sv, move(response));
+    object.set("cache"sv, JsonObject {});
+    object.set("timings"sv, move(timings));
+
+    // Custom fields, which the format allows as long as they start with an underscore.
+    object.set("_connectionReused"sv, entry.connection_was_reused);
+    object.set("_cacheStatus"sv, cache_status_to_string(entry.cache_status));
+    if (entry.network_error.has_value())
+        object.set("_error"sv, Requests::network_error_to_string(*entry.network_error));
+
+    return object;
+}
+
+String NetworkLog::to_har() const
+{
+    JsonArray entries;
+    for (auto const& entry : m_entries)
+        entries.must_append(entry_to_json(entry));
+
+    JsonObject creator;
+    creator.set("name"sv, "Ladybird"sv);
+    creator.set("version"sv, "1.0"sv);
+
+    JsonObject log;
+    log.set("version"sv, "1.2"sv);
+    log.set("creator"sv, move(creator));
+    log.set("entries"sv, move(entries));
+
+    JsonObject har;
+    har.set("log"sv, move(log));
+    return har.serialized();
+}
+
+}
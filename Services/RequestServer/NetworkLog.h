@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibRequests/ALPNHttpVersion.h>
+#include <LibRequests/NetworkError.h>
+
+namespace RequestServer {
+
+struct NetworkLogEntry {
+    enum class CacheStatus {
+        NotCached,
+        Hit,
+        Revalidated,
+    };
+
+    // The phases of a request, in the order in which they happen. Phases which did not happen (e.g. connecting, when
+    // an existing connection was reused) are left empty.
+    struct Timings {
+        Optional<AK::Duration> blocked;
+        Optional<AK::Duration> dns;
+        Optional<AK::Duration> connect;
+        Optional<AK::Duration> ssl;
+        Optional<AK::Duration> send;
+        Optional<AK::Duration> wait;
+        Optional<AK::Duration> receive;
+    };
+
+    UnixDateTime start_time;
+    ByteString method;
+    String url;
+    HTTP::HeaderMap request_headers;
+
+    u32 status_code { 0 };
+    Optional<String> reason_phrase;
+    HTTP::HeaderMap response_headers;
+    u64 body_size { 0 };
+
+    Requests::ALPNHttpVersion http_version { Requests::ALPNHttpVersion::None };
+    bool connection_was_reused { false };
+    CacheStatus cache_status { CacheStatus::NotCached };
+    Optional<Requests::NetworkError> network_error;
+
+    Timings timings;
+};
+
+// A record of the most recent requests made by RequestServer, shared between all of its clients, so that the waterfall
+// of a page load can be exported as an HTTP Archive (HAR).
+class NetworkLog {
+public:
+    static NetworkLog& the();
+
+    void append(NetworkLogEntry);
+    void clear() { m_entries.clear(); }
+
+    // https://w3c.github.io/web-performance/specs/HAR/Overview.html
+    String to_har() const;
+
+private:
+    static constexpr size_t max_entries = 2000;
+
+    Vector<NetworkLogEntry> m_entries;
+};
+
+}
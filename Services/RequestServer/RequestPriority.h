@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace RequestServer {
+
+enum class RequestPriority : u8 {
+    Lowest,
+    Low,
+    Medium,
+    High,
+    Highest,
+};
+
+}
@@ -138,6 +138,28 @@ bool WebSocketImplCurl::send(ReadonlyBytes bytes)
     return result == CURLE_OK;
 }
 
+Optional<ByteString> WebSocketImplCurl::handshake_response_header(StringView name) const
+{
+    auto name_string = ByteString { name };
+
+    struct curl_header* header = nullptr;
+    if (curl_easy_header(m_easy_handle, name_string.characters(), 0, CURLH_HEADER, -1, &header) != CURLHE_OK)
+        return {};
+
+    // NOTE: A header given multiple times is equivalent to a single header with its values joined by commas.
+    StringBuilder builder;
+    builder.append(StringView { header->value, strlen(header->value) });
+
+    for (size_t index = 1; index < header->amount; ++index) {
+        if (curl_easy_header(m_easy_handle, name_string.characters(), index, CURLH_HEADER, -1, &header) != CURLHE_OK)
+            break;
+        builder.append(',');
+        builder.append(StringView { header->value, strlen(header->value) });
+    }
+
+    return builder.to_byte_string();
+}
+
 bool WebSocketImplCurl::eof()
 {
     return m_read_buffer.is_eof();
@@ -193,8 +215,17 @@ void WebSocketImplCurl::read_from_socket()
             on_connection_error();
     }
 
-    if (received_data)
+    if (!received_data)
+        return;
+
+    // NOTE: The WebSocket reads a limited amount of data each time it is notified, so keep notifying it for as long as it
+    //       makes progress, rather than leaving data in our buffer until the server sends more.
+    while (m_read_buffer.used_buffer_size() > 0 && on_ready_to_read) {
+        auto buffered_size = m_read_buffer.used_buffer_size();
         on_ready_to_read();
+        if (m_read_buffer.used_buffer_size() == buffered_size)
+            break;
+    }
 }
 
 bool WebSocketImplCurl::did_connect()
@@ -28,6 +28,7 @@ public:
     virtual void discard_connection() override;
 
     virtual bool handshake_complete_when_connected() const override { return true; }
+    virtual Optional<ByteString> handshake_response_header(StringView name) const override;
 
     bool did_connect();
 
@@ -12,9 +12,11 @@
 #include <LibCore/ArgsParser.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/Process.h>
+#include <LibCore/StandardPaths.h>
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/DiskCache.h>
 
 #if defined(AK_OS_MACOS)
 #    include <LibCore/Platform/ProcessStatisticsMach.h>
@@ -23,6 +25,7 @@
 namespace RequestServer {
 
 extern ByteString g_default_certificate_path;
+extern OwnPtr<DiskCache> g_disk_cache;
 
 }
 
@@ -32,11 +35,17 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     Vector<ByteString> certificates;
     StringView mach_server_name;
+    bool enable_http_disk_cache = false;
+    StringView record_http_archive_directory;
+    StringView replay_http_archive_directory;
     bool wait_for_debugger = false;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
     args_parser.add_option(mach_server_name, "Mach server name", "mach-server-name", 0, "mach_server_name");
+    args_parser.add_option(enable_http_disk_cache, "Enable the on-disk HTTP cache", "enable-http-disk-cache");
+    args_parser.add_option(record_http_archive_directory, "Record every response into an archive in the given directory", "record-http-archive", 0, "directory");
+    args_parser.add_option(replay_http_archive_directory, "Answer every request from an archive in the given directory", "replay-http-archive", 0, "directory");
     args_parser.add_option(wait_for_debugger, "Wait for debugger", "wait-for-debugger");
     args_parser.parse(arguments);
 
@@ -47,6 +56,20 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (!certificates.is_empty())
         RequestServer::g_default_certificate_path = certificates.first();
 
+    if (!replay_http_archive_directory.is_empty()) {
+        // NOTE: Failing to open the archive must not let the replay fall back to the network.
+        RequestServer::g_disk_cache = TRY(RequestServer::DiskCache::create(replay_http_archive_directory, RequestServer::DiskCache::Mode::Replay));
+    } else if (!record_http_archive_directory.is_empty()) {
+        RequestServer::g_disk_cache = TRY(RequestServer::DiskCache::create(record_http_archive_directory, RequestServer::DiskCache::Mode::Record));
+    } else if (enable_http_disk_cache) {
+        auto cache_directory = ByteString::formatted("{}/Ladybird/Cache", Core::StandardPaths::user_data_directory());
+
+        if (auto disk_cache = RequestServer::DiskCache::create(move(cache_directory)); disk_cache.is_error())
+            warnln("Unable to create the HTTP disk cache: {}", disk_cache.error());
+        else
+            RequestServer::g_disk_cache = disk_cache.release_value();
+    }
+
     Core::EventLoop event_loop;
 
 #if defined(AK_OS_MACOS)
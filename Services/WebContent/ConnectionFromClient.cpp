@@ -12,9 +12,13 @@
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/StandardPaths.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/Font/DecodedFontCache.h>
 #include <LibGfx/Font/FontDatabase.h>
+#include <LibGfx/Font/TypefaceSkia.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
@@ -33,7 +37,9 @@
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
@@ -46,10 +52,13 @@
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Loader/UserAgent.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/StorageAPI/StorageBottle.h>
+#include <LibWeb/WebAssembly/WebAssembly.h>
 #include <LibWebView/Attribute.h>
 #include <WebContent/ConnectionFromClient.h>
 #include <WebContent/PageClient.h>
@@ -373,6 +382,43 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "set-gc-growth-factor") {
+        if (auto growth_factor = argument.to_number<double>(); growth_factor.has_value() && *growth_factor > 0)
+            Web::Bindings::main_thread_vm().heap().set_growth_factor(*growth_factor);
+        return;
+    }
+
+    if (request == "set-gc-minimum-threshold") {
+        if (auto threshold = argument.to_number<size_t>(); threshold.has_value())
+            Web::Bindings::main_thread_vm().heap().set_minimum_collection_threshold(*threshold * MiB);
+        return;
+    }
+
+    if (request == "dump-gc-statistics") {
+        dbgln("{}", Web::Bindings::main_thread_vm().heap().dump_collection_statistics().serialized());
+        return;
+    }
+
+    if (request == "dump-heap-snapshot") {
+        // NOTE: We use deferred_invoke here to ensure that the snapshot doesn't include cells only kept alive by the stack.
+        Core::deferred_invoke([] {
+            auto result = [] -> ErrorOr<LexicalPath> {
+                LexicalPath path { Core::StandardPaths::tempfile_directory() };
+                path = path.append(TRY(AK::UnixDateTime::now().to_string("heap-%Y-%m-%d-%H-%M-%S.heapsnapshot"sv)));
+
+                auto file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+                TRY(Web::Bindings::main_thread_vm().heap().write_heap_snapshot(*file));
+                return path;
+            }();
+
+            if (result.is_error())
+                dbgln("Unable to dump heap snapshot: {}", result.error());
+            else
+                dbgln("Dumped heap snapshot into {}", result.value());
+        });
+        return;
+    }
+
     if (request == "set-line-box-borders") {
         bool state = argument == "on";
         auto traversable = page->page().top_level_traversable();
@@ -993,6 +1039,56 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static void append_memory_report(Web::Page& page, StringBuilder& builder)
+{
+    // NOTE: The GC heap, bitmaps and WebAssembly memories are shared by all pages of this process, so they are reported
+    //       for the whole process. Only the documents are reported for the given page.
+    JsonObject bitmaps;
+    bitmaps.set("count"sv, Gfx::Bitmap::live_bitmap_count());
+    bitmaps.set("bytes"sv, Gfx::Bitmap::live_bitmap_size_in_bytes());
+
+    JsonArray documents;
+    auto page_documents = Web::HTML::main_thread_event_loop().documents_in_this_event_loop_matching([&](auto& document) {
+        return &document.page() == &page;
+    });
+
+    for (auto const& document : page_documents) {
+        size_t dom_node_count = 0;
+        document->for_each_in_inclusive_subtree([&](auto const&) {
+            ++dom_node_count;
+            return Web::TraversalDecision::Continue;
+        });
+
+        size_t layout_node_count = 0;
+        if (auto const* layout_root = document->layout_node()) {
+            layout_root->for_each_in_inclusive_subtree([&](auto const&) {
+                ++layout_node_count;
+                return Web::TraversalDecision::Continue;
+            });
+        }
+
+        size_t display_list_command_count = 0;
+        if (auto display_list = document->cached_display_list())
+            display_list_command_count = display_list->commands().size();
+
+        JsonObject document_report;
+        document_report.set("url"sv, document->url().serialize());
+        document_report.set("dom_nodes"sv, dom_node_count);
+        document_report.set("layout_nodes"sv, layout_node_count);
+        document_report.set("display_list_commands"sv, display_list_command_count);
+        document_report.set("display_list_bytes"sv, display_list_command_count * sizeof(Web::Painting::DisplayList::DisplayListCommandWithScrollAndClip));
+        documents.must_append(move(document_report));
+    }
+
+    JsonObject report;
+    report.set("pid"sv, Core::System::getpid());
+    report.set("gc_heap"sv, Web::Bindings::main_thread_vm().heap().dump_memory_usage());
+    report.set("bitmaps"sv, move(bitmaps));
+    report.set("webassembly_memory_bytes"sv, Web::WebAssembly::total_memory_size_in_bytes());
+    report.set("documents"sv, move(documents));
+    report.serialize(builder);
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
@@ -1031,6 +1127,12 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::MemoryReport)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_memory_report(page->page(), builder);
+    }
+
     async_did_get_internal_page_info(page_id, type, MUST(builder.to_string()));
 }
 
@@ -1321,6 +1423,29 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::purge_memory()
+{
+    // The system is running low on memory, so drop everything we can recreate or reload later.
+    Web::ResourceLoader::the().clear_cache();
+    Web::Fetch::Fetching::clear_http_cache();
+    Gfx::DecodedFontCache::the().clear();
+    Gfx::TypefaceSkia::purge_glyph_caches();
+
+    for (auto& navigable : Web::HTML::all_navigables()) {
+        if (navigable->is_top_level_traversable())
+            as<Web::HTML::TraversableNavigable>(*navigable).clear_back_forward_cache();
+    }
+
+    // NOTE: We use deferred_invoke here to ensure that GC runs with as little on the stack as possible.
+    Core::deferred_invoke([] {
+        auto& heap = Web::Bindings::main_thread_vm().heap();
+        heap.collect_garbage();
+
+        // NOTE: Blocks emptied by the collection are otherwise kept around for a whole GC cycle before being released.
+        heap.release_unused_blocks();
+    });
+}
+
 void ConnectionFromClient::cookies_changed(Vector<Web::Cookie::Cookie> cookies)
 {
     for (auto& navigable : Web::HTML::all_navigables()) {
@@ -1331,4 +1456,9 @@ void ConnectionFromClient::cookies_changed(Vector<Web::Cookie::Cookie> cookies)
     }
 }
 
+void ConnectionFromClient::local_storage_changed(String storage_key)
+{
+    Web::StorageAPI::LocalStorageBottle::discard_cached_items(storage_key);
+}
+
 }
@@ -158,7 +158,9 @@ private:
     virtual void paste(u64 page_id, String text) override;
 
     virtual void system_time_zone_changed() override;
+    virtual void purge_memory() override;
     virtual void cookies_changed(Vector<Web::Cookie::Cookie>) override;
+    virtual void local_storage_changed(String storage_key) override;
 
     NonnullOwnPtr<PageHost> m_page_host;
 
@@ -310,6 +310,7 @@ void PageClient::page_did_middle_click_link(URL::URL const& url, ByteString cons
 
 void PageClient::page_did_start_loading(URL::URL const& url, bool is_redirect)
 {
+    page().clear_network_request_origins();
     client().async_did_start_loading(m_id, url, is_redirect);
 }
 
@@ -336,6 +337,9 @@ void PageClient::page_did_change_active_document_in_top_level_browsing_context(W
 void PageClient::page_did_finish_loading(URL::URL const& url)
 {
     client().async_did_finish_loading(m_id, url);
+
+    if (auto origins = page().take_network_request_origins(); !origins.is_empty())
+        client().async_did_load_with_network_request_origins(m_id, url, move(origins));
 }
 
 void PageClient::page_did_finish_test(String const& text)
@@ -565,6 +569,21 @@ Vector<String> PageClient::page_did_request_storage_keys(Web::StorageAPI::Storag
     return response->take_keys();
 }
 
+OrderedHashMap<String, String> PageClient::page_did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageItems>(storage_endpoint, storage_key);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestStorageItems. Exiting peacefully.");
+        exit(0);
+    }
+    return response->take_items();
+}
+
+void PageClient::page_did_update_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, OrderedHashMap<String, Optional<String>> changes)
+{
+    client().async_did_update_storage_items(storage_endpoint, storage_key, move(changes));
+}
+
 void PageClient::page_did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key)
 {
     auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidClearStorage>(storage_endpoint, storage_key);
@@ -154,6 +154,8 @@ private:
     virtual WebView::StorageOperationError page_did_set_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& value) override;
     virtual void page_did_remove_storage_item(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key) override;
     virtual Vector<String> page_did_request_storage_keys(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key) override;
+    virtual OrderedHashMap<String, String> page_did_request_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key) override;
+    virtual void page_did_update_storage_items(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key, OrderedHashMap<String, Optional<String>> changes) override;
     virtual void page_did_clear_storage(Web::StorageAPI::StorageEndpointType storage_endpoint, String const& storage_key) override;
     virtual void page_did_update_resource_count(i32) override;
     virtual NewWebViewResult page_did_request_new_web_view(Web::HTML::ActivateTab, Web::HTML::WebViewHints, Web::HTML::TokenizedFeature::NoOpener) override;
@@ -112,6 +112,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
+    bool share_gc_blocks_between_types = false;
+    Optional<double> gc_growth_factor;
+    Optional<size_t> gc_minimum_threshold_in_mib;
     bool is_headless = false;
     bool disable_scrollbar_painting = false;
     StringView echo_server_port_string_view {};
@@ -134,6 +137,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
+    args_parser.add_option(share_gc_blocks_between_types, "Let same-size JS heap cell types share memory blocks", "share-gc-blocks-between-types");
+    args_parser.add_option(gc_growth_factor, "Collect garbage once the JS heap has allocated this many times its live bytes", "gc-growth-factor", 0, "factor");
+    args_parser.add_option(gc_minimum_threshold_in_mib, "Never collect garbage before the JS heap has allocated this many MiB", "gc-minimum-threshold", 0, "MiB");
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
@@ -203,6 +209,14 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (collect_garbage_on_every_allocation)
         Web::Bindings::main_thread_vm().heap().set_should_collect_on_every_allocation(true);
 
+    if (share_gc_blocks_between_types)
+        Web::Bindings::main_thread_vm().heap().set_shares_blocks_between_types(true);
+
+    if (gc_growth_factor.has_value() && *gc_growth_factor > 0)
+        Web::Bindings::main_thread_vm().heap().set_growth_factor(*gc_growth_factor);
+    if (gc_minimum_threshold_in_mib.has_value())
+        Web::Bindings::main_thread_vm().heap().set_minimum_collection_threshold(*gc_minimum_threshold_in_mib * MiB);
+
     TRY(initialize_resource_loader(Web::Bindings::main_thread_vm().heap(), request_server_socket));
 
     if (log_all_js_exceptions) {
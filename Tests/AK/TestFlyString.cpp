@@ -85,6 +85,23 @@ TEST_CASE(from_string_view)
     EXPECT_NE(fly2, fly3);
 }
 
+TEST_CASE(statistics)
+{
+    auto statistics = FlyString::statistics();
+    EXPECT_EQ(statistics.count, 0u);
+    EXPECT_EQ(statistics.byte_count, 0u);
+
+    auto fly1 = MUST(FlyString::from_utf8("thisisdefinitelymorethan7bytes"sv));
+    auto fly2 = MUST(FlyString::from_utf8("thisisdefinitelymorethan7bytes"sv));
+    auto fly3 = MUST(FlyString::from_utf8("foo"sv));
+
+    auto new_statistics = FlyString::statistics();
+    EXPECT_EQ(new_statistics.count, 1u);
+    EXPECT_EQ(new_statistics.byte_count, "thisisdefinitelymorethan7bytes"sv.length());
+    EXPECT_EQ(new_statistics.lookup_hits - statistics.lookup_hits, 1u);
+    EXPECT_EQ(new_statistics.lookup_misses - statistics.lookup_misses, 1u);
+}
+
 TEST_CASE(fly_string_keep_string_data_alive)
 {
     EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
@@ -206,6 +206,22 @@ TEST_CASE(many_collisions)
     EXPECT(strings.find("foo") != strings.end());
 }
 
+TEST_CASE(find_missing_values_among_clusters)
+{
+    struct ClusteringTraits : public DefaultTraits<int> {
+        static unsigned hash(int value) { return value / 10; }
+    };
+
+    HashTable<int, ClusteringTraits> table;
+    for (int i = 0; i < 1000; i += 2)
+        table.set(i);
+    for (int i = 0; i < 1000; i += 6)
+        table.remove(i);
+
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(table.contains(i), i % 2 == 0 && i % 6 != 0);
+}
+
 TEST_CASE(space_reuse)
 {
     struct StringCollisionTraits : public DefaultTraits<ByteString> {
@@ -513,3 +529,17 @@ TEST_CASE(values)
     EXPECT_EQ(values[1], 30);
     EXPECT_EQ(values[2], 20);
 }
+
+BENCHMARK_CASE(find_missing_values)
+{
+    HashTable<u64> table;
+    for (u64 i = 0; i < 100'000; ++i)
+        table.set(i * 2);
+
+    size_t found = 0;
+    for (size_t round = 0; round < 100; ++round) {
+        for (u64 i = 0; i < 100'000; ++i)
+            found += table.contains(i * 2 + 1);
+    }
+    EXPECT_EQ(found, 0u);
+}
@@ -153,6 +153,35 @@ TEST_CASE(allocating_memory_stream_offset_of_with_write_offset_multiple_of_chunk
     }
 }
 
+TEST_CASE(allocating_memory_stream_peek_some_contiguous)
+{
+    AllocatingMemoryStream stream;
+    EXPECT(stream.peek_some_contiguous().is_empty());
+
+    Array<u8, AllocatingMemoryStream::CHUNK_SIZE + 16> data;
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<u8>(i);
+    MUST(stream.write_until_depleted(data));
+
+    MUST(stream.discard(8));
+
+    auto first_range = stream.peek_some_contiguous();
+    EXPECT_EQ(first_range.size(), AllocatingMemoryStream::CHUNK_SIZE - 8);
+    EXPECT(first_range == ReadonlyBytes { data }.slice(8, AllocatingMemoryStream::CHUNK_SIZE - 8));
+
+    // Peeking must not consume anything.
+    EXPECT_EQ(stream.used_buffer_size(), data.size() - 8);
+
+    MUST(stream.discard(first_range.size()));
+
+    auto second_range = stream.peek_some_contiguous();
+    EXPECT_EQ(second_range.size(), 16ul);
+    EXPECT(second_range == ReadonlyBytes { data }.slice(AllocatingMemoryStream::CHUNK_SIZE));
+
+    MUST(stream.discard(second_range.size()));
+    EXPECT(stream.peek_some_contiguous().is_empty());
+}
+
 TEST_CASE(fixed_memory_read_write)
 {
     constexpr auto some_words = "These are some words"sv;
@@ -833,6 +833,15 @@ TEST_CASE(find_code_unit_offset)
     EXPECT_EQ(7u, view.find_code_unit_offset(u"bar"sv).value());
 
     EXPECT(!view.find_code_unit_offset(u"baz"sv).has_value());
+
+    EXPECT_EQ(3u, u"aaaaab"sv.find_code_unit_offset(u"aab"sv).value());
+    EXPECT_EQ(4u, u"abcabd"sv.find_code_unit_offset(u"bd"sv, 2).value());
+    EXPECT(!u"abcab"sv.find_code_unit_offset(u"abc"sv, 1).has_value());
+    EXPECT(!u"abcab"sv.find_code_unit_offset(u"b"sv, 5).has_value());
+
+    EXPECT_EQ(1u, Utf16View { "xfoo"sv }.find_code_unit_offset(u"foo"sv).value());
+    EXPECT_EQ(2u, view.find_code_unit_offset(Utf16View { "foo"sv }).value());
+    EXPECT(!Utf16View { "foo"sv }.find_code_unit_offset(u"😀"sv).has_value());
 }
 
 TEST_CASE(find_code_unit_offset_ignoring_case)
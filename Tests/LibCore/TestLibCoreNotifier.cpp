@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Format.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibTest/TestCase.h>
+#include <sys/socket.h>
+
+TEST_CASE(notifiers_can_share_a_file_descriptor)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Core::EventLoop event_loop;
+    auto reaper = Core::Timer::create_single_shot(1000, [] {
+        warnln("Timed out waiting for the notifiers to be activated!");
+        VERIFY_NOT_REACHED();
+    });
+    reaper->start();
+
+    int fds[2];
+    MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA bool was_readable = false;
+    IGNORE_USE_IN_ESCAPING_LAMBDA bool was_writable = false;
+
+    auto read_notifier = Core::Notifier::construct(fds[0], Core::NotificationType::Read);
+    auto write_notifier = Core::Notifier::construct(fds[0], Core::NotificationType::Write);
+
+    write_notifier->on_activation = [&] {
+        was_writable = true;
+        write_notifier->set_enabled(false);
+
+        // The read notifier must keep watching the file descriptor once the write notifier has been disabled.
+        MUST(Core::System::write(fds[1], "x"sv.bytes()));
+    };
+    read_notifier->on_activation = [&] {
+        was_readable = true;
+        event_loop.quit(0);
+    };
+
+    event_loop.exec();
+
+    EXPECT(was_writable);
+    EXPECT(was_readable);
+
+    read_notifier->close();
+    write_notifier->close();
+    MUST(Core::System::close(fds[0]));
+    MUST(Core::System::close(fds[1]));
+}
+
+TEST_CASE(notifier_type_can_be_changed)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Core::EventLoop event_loop;
+    auto reaper = Core::Timer::create_single_shot(1000, [] {
+        warnln("Timed out waiting for the notifier to be activated!");
+        VERIFY_NOT_REACHED();
+    });
+    reaper->start();
+
+    auto pipe_fds = MUST(Core::System::pipe2(O_CLOEXEC));
+
+    // The write end of a pipe is never readable, so the notifier is only activated once it watches for writes.
+    auto notifier = Core::Notifier::construct(pipe_fds[1], Core::NotificationType::Read);
+    notifier->on_activation = [&] {
+        event_loop.quit(0);
+    };
+    notifier->set_type(Core::NotificationType::Write);
+
+    event_loop.exec();
+
+    notifier->close();
+    MUST(Core::System::close(pipe_fds[0]));
+    MUST(Core::System::close(pipe_fds[1]));
+}
@@ -102,3 +102,31 @@ TEST_CASE(test_tls)
 
     EXPECT_EQ(0, loop.exec());
 }
+
+TEST_CASE(test_serialized_entries_round_trip)
+{
+    DNS::Resolver resolver {
+        [&] -> ErrorOr<DNS::Resolver::SocketResult> {
+            return Error::from_string_literal("No network in this test");
+        }
+    };
+
+    auto expiration = AK::UnixDateTime::now().seconds_since_epoch() + 60;
+    resolver.load_serialized_entries(ByteString::formatted(
+        "example.com A 93.184.216.34 {0}\n"
+        "example.com AAAA 2606:2800:220:1:248:1893:25c8:1946 {0}\n"
+        "long-expired.example.com A 10.0.0.1 1\n"
+        "malformed line\n",
+        expiration));
+
+    auto result = resolver.lookup_in_cache("example.com"sv);
+    EXPECT(result);
+    EXPECT_EQ(result->cached_addresses().size(), 2u);
+    EXPECT(!result->has_stale_records());
+
+    EXPECT(!resolver.lookup_in_cache("long-expired.example.com"sv));
+
+    auto serialized = resolver.serialize_frequently_used_entries(1);
+    EXPECT(serialized.contains(ByteString::formatted("example.com A 93.184.216.34 {}", expiration)));
+    EXPECT(!serialized.contains("localhost"sv));
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibMedia/Color/ColorConverter.h>
+#include <LibTest/TestCase.h>
+
+template<Media::MatrixCoefficients MC, Media::VideoFullRangeFlag FR>
+static void expect_row_conversion_matches_pixel_conversion()
+{
+    // Use an odd width so that both the vectorized loop and the remainder are exercised.
+    static constexpr size_t width = 255;
+
+    for (u32 pass = 0; pass < 256; pass++) {
+        Vector<u8> y_row;
+        Vector<u8> u_row;
+        Vector<u8> v_row;
+        for (u32 column = 0; column < width; column++) {
+            y_row.append(static_cast<u8>(column + pass));
+            u_row.append(static_cast<u8>(column * 7 + pass * 3));
+            v_row.append(static_cast<u8>(pass - column * 13));
+        }
+
+        Vector<u32> output;
+        output.resize(width);
+        Media::ColorConverter::convert_simple_yuv_to_rgb_row<MC, FR>(y_row.data(), u_row.data(), v_row.data(), output.data(), width);
+
+        for (size_t column = 0; column < width; column++) {
+            auto expected = Media::ColorConverter::convert_simple_yuv_to_rgb<MC, FR>(y_row[column], u_row[column], v_row[column]);
+            EXPECT_EQ(output[column], expected.value());
+        }
+    }
+}
+
+TEST_CASE(simple_yuv_to_rgb_row_matches_pixel_conversion)
+{
+    expect_row_conversion_matches_pixel_conversion<Media::MatrixCoefficients::BT601, Media::VideoFullRangeFlag::Studio>();
+    expect_row_conversion_matches_pixel_conversion<Media::MatrixCoefficients::BT709, Media::VideoFullRangeFlag::Studio>();
+    expect_row_conversion_matches_pixel_conversion<Media::MatrixCoefficients::BT601, Media::VideoFullRangeFlag::Full>();
+    expect_row_conversion_matches_pixel_conversion<Media::MatrixCoefficients::BT2020ConstantLuminance, Media::VideoFullRangeFlag::Full>();
+}
+
+BENCHMARK_CASE(simple_yuv_to_rgb_row_4k_frame)
+{
+    static constexpr size_t width = 3840;
+    static constexpr size_t height = 2160;
+
+    Vector<u8> y_row;
+    Vector<u8> u_row;
+    Vector<u8> v_row;
+    for (u32 column = 0; column < width; column++) {
+        y_row.append(static_cast<u8>(column));
+        u_row.append(static_cast<u8>(column * 3));
+        v_row.append(static_cast<u8>(column * 5));
+    }
+
+    Vector<u32> output;
+    output.resize(width);
+    for (size_t row = 0; row < height; row++)
+        Media::ColorConverter::convert_simple_yuv_to_rgb_row<Media::MatrixCoefficients::BT709, Media::VideoFullRangeFlag::Studio>(y_row.data(), u_row.data(), v_row.data(), output.data(), width);
+    EXPECT_NE(output[width / 2], 0u);
+}
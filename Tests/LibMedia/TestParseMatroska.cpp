@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/MappedFile.h>
 #include <LibTest/TestCase.h>
 
 #include <LibMedia/Containers/Matroska/Reader.h>
@@ -23,3 +24,57 @@ TEST_CASE(master_elements_containing_crc32)
     MUST(matroska_reader.seek_to_random_access_point(iterator, AK::Duration::from_seconds(7)));
     MUST(iterator.next_block());
 }
+
+TEST_CASE(byte_stream_parser_matches_reader)
+{
+    auto file = MUST(Core::MappedFile::map("vp9_in_webm.webm"sv));
+    auto data = file->bytes();
+
+    auto matroska_reader = MUST(Media::Matroska::Reader::from_data(data));
+    u64 video_track = 0;
+    MUST(matroska_reader.for_each_track_of_type(Media::Matroska::TrackEntry::TrackType::Video, [&](Media::Matroska::TrackEntry const& track_entry) -> Media::DecoderErrorOr<IterationDecision> {
+        video_track = track_entry.track_number();
+        return IterationDecision::Break;
+    }));
+
+    Vector<Media::Matroska::Block> expected_blocks;
+    auto iterator = MUST(matroska_reader.create_sample_iterator(video_track));
+    while (true) {
+        auto block = iterator.next_block();
+        if (block.is_error()) {
+            EXPECT_EQ(block.error().category(), Media::DecoderErrorCategory::EndOfStream);
+            break;
+        }
+        expected_blocks.append(block.release_value());
+    }
+    EXPECT(!expected_blocks.is_empty());
+
+    // Append the file in pieces which split elements apart, as a SourceBuffer may receive them.
+    static constexpr size_t piece_size = 1000;
+    Media::Matroska::ByteStreamParser parser;
+    Vector<Media::Matroska::CodedFrame> coded_frames;
+    size_t initialization_segment_count = 0;
+
+    for (size_t offset = 0; offset < data.size(); offset += piece_size) {
+        auto piece = MUST(ByteBuffer::copy(data.slice(offset, min(piece_size, data.size() - offset))));
+        auto parsed_data = MUST(parser.append(move(piece)));
+
+        if (parsed_data.initialization_segment.has_value()) {
+            initialization_segment_count++;
+            EXPECT(parsed_data.initialization_segment->tracks.first_matching([&](auto const& track) { return track->track_number() == video_track; }).has_value());
+        }
+
+        for (auto& coded_frame : parsed_data.coded_frames) {
+            if (coded_frame.track_number == video_track)
+                coded_frames.append(move(coded_frame));
+        }
+    }
+
+    EXPECT_EQ(initialization_segment_count, 1u);
+    EXPECT_EQ(coded_frames.size(), expected_blocks.size());
+    for (size_t i = 0; i < min(coded_frames.size(), expected_blocks.size()); i++) {
+        EXPECT_EQ(coded_frames[i].timestamp, expected_blocks[i].timestamp());
+        EXPECT_EQ(coded_frames[i].is_keyframe, expected_blocks[i].only_keyframes());
+        EXPECT_EQ(coded_frames[i].data, expected_blocks[i].frame(0));
+    }
+}
@@ -1379,3 +1379,59 @@ TEST_CASE(account_for_opcode_size_calculating_incoming_jump_edges)
         EXPECT_EQ(result.matches.first().view.to_byte_string(), "aa"sv);
     }
 }
+
+TEST_CASE(catastrophic_backtracking)
+{
+    {
+        // Backtracking would take exponential time to reject this, the linear matcher must take over.
+        Regex<ECMA262> re("^(x+x+)+y$");
+        EXPECT(re.parser_result.optimization_data.can_use_linear_matcher);
+
+        auto input = ByteString::repeated('x', 64);
+        auto result = re.match(input.view());
+        EXPECT_EQ(result.success, false);
+    }
+    {
+        Regex<ECMA262> re("(x+x+)+y", ECMAScriptFlags::Global);
+        auto input = ByteString::formatted("{}y {}", ByteString::repeated('x', 64), ByteString::repeated('x', 32));
+        auto result = re.match(input.view());
+
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), ByteString::formatted("{}y", ByteString::repeated('x', 64)));
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.length(), 64u);
+    }
+    {
+        // Backreferences depend on more than the position in the input, so these patterns always backtrack.
+        Regex<ECMA262> re("(a+)b\\1");
+        EXPECT(!re.parser_result.optimization_data.can_use_linear_matcher);
+    }
+}
+
+TEST_CASE(literal_prefix)
+{
+    {
+        Regex<ECMA262> re("fo(o)\\d+", ECMAScriptFlags::Global);
+        EXPECT_EQ(re.parser_result.optimization_data.literal_prefix, "foo"sv);
+
+        auto result = re.match("xx foo1 bar fofoo22 fo3 foo"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "foo1"sv);
+        EXPECT_EQ(result.matches[0].global_offset, 3u);
+        EXPECT_EQ(result.matches[1].view.to_byte_string(), "foo22"sv);
+        EXPECT_EQ(result.matches[1].global_offset, 14u);
+    }
+    {
+        // The prefix is compared case-sensitively, so it must not be used to skip ahead for case-insensitive matches.
+        Regex<ECMA262> re("abc", ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        auto result = re.match("xABCabc"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].global_offset, 1u);
+    }
+    {
+        Regex<ECMA262> re("a|b");
+        EXPECT(re.parser_result.optimization_data.literal_prefix.is_empty());
+    }
+}
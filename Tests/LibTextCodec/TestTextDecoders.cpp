@@ -48,3 +48,23 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_latin1_decode)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+    auto test_string = "s\xe4k \xff"sv;
+
+    EXPECT(decoder.validate(test_string));
+    auto utf8 = MUST(decoder.to_utf8(test_string));
+    EXPECT_EQ(utf8, "säk ÿ"sv);
+}
+
+TEST_CASE(test_single_byte_decode)
+{
+    auto decoder = TextCodec::decoder_for("windows-1252"sv);
+    EXPECT(decoder.has_value());
+
+    EXPECT_EQ(MUST(decoder->to_utf8("plain ascii"sv)), "plain ascii"sv);
+    EXPECT_EQ(MUST(decoder->to_utf8("\x80"sv)), "€"sv);
+    EXPECT_EQ(MUST(decoder->to_utf8("\x93quoted\x94 \x80 text"sv)), "“quoted” € text"sv);
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Vector.h>
+#include <LibCore/EventLoop.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+
+TEST_CASE(submitted_tasks_are_run)
+{
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> run_count = 0;
+
+    {
+        auto pool = Threading::ThreadPool::create(4);
+        for (size_t i = 0; i < 1000; ++i)
+            pool->submit([&] { run_count.fetch_add(1); }, i % 2 == 0 ? Threading::ThreadPool::Priority::High : Threading::ThreadPool::Priority::Normal);
+    }
+
+    EXPECT_EQ(run_count.load(), 1000u);
+}
+
+TEST_CASE(parallel_for_visits_every_element_once)
+{
+    auto pool = Threading::ThreadPool::create(4);
+
+    Vector<size_t> visit_counts;
+    visit_counts.resize(10'000);
+
+    pool->parallel_for(visit_counts.span(), [](size_t& visit_count) { ++visit_count; });
+
+    for (auto visit_count : visit_counts)
+        EXPECT_EQ(visit_count, 1u);
+}
+
+TEST_CASE(parallel_for_can_be_nested)
+{
+    auto pool = Threading::ThreadPool::create(2);
+    Atomic<size_t> sum = 0;
+
+    pool->parallel_for(16, [&](size_t i) {
+        pool->parallel_for(16, [&](size_t j) { sum.fetch_add(i * 16 + j); });
+    });
+
+    EXPECT_EQ(sum.load(), 256u * 255u / 2u);
+}
+
+TEST_CASE(completion_callbacks_run_on_the_submitting_event_loop)
+{
+    Core::EventLoop event_loop;
+    auto pool = Threading::ThreadPool::create(2);
+
+    auto main_thread = pthread_self();
+    Optional<int> result;
+
+    pool->submit([] { return 42; }, [&](int value) {
+        EXPECT(pthread_equal(pthread_self(), main_thread));
+        result = value;
+        event_loop.quit(0);
+    });
+
+    event_loop.exec();
+    EXPECT_EQ(result, 42);
+}
@@ -578,6 +578,47 @@ TEST_CASE(ascii_only_url)
     }
 }
 
+TEST_CASE(canonical_special_url)
+{
+    {
+        auto url = URL::Parser::basic_parse("https://example.com:8080/a//b/?q=1?2#f#g"sv);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->scheme(), "https");
+        EXPECT_EQ(url->serialized_host(), "example.com"sv);
+        EXPECT_EQ(url->port(), 8080);
+        EXPECT_EQ(url->path_segment_count(), 4u);
+        EXPECT_EQ(url->serialize_path(), "/a//b/");
+        EXPECT_EQ(url->query(), "q=1?2");
+        EXPECT_EQ(url->fragment(), "f#g");
+    }
+
+    {
+        auto url = URL::Parser::basic_parse("http://example.com:080?#"sv);
+        EXPECT(url.has_value());
+        EXPECT(!url->port().has_value());
+        EXPECT_EQ(url->query(), "");
+        EXPECT_EQ(url->fragment(), "");
+        EXPECT_EQ(url->to_byte_string(), "http://example.com/?#");
+    }
+
+    {
+        auto url = URL::Parser::basic_parse("http://example.com/a/./b/../c"sv);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->to_byte_string(), "http://example.com/a/c");
+    }
+
+    {
+        auto url = URL::Parser::basic_parse("http://example.com/a b?c'd"sv);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->to_byte_string(), "http://example.com/a%20b?c%27d");
+    }
+
+    {
+        auto url = URL::Parser::basic_parse("http://192.168.0.1:99999"sv);
+        EXPECT(!url.has_value());
+    }
+}
+
 TEST_CASE(invalid_domain_code_points)
 {
     {
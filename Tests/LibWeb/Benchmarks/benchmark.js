@@ -0,0 +1,26 @@
+// Measures how long it takes to render the document, and replaces its contents with the results as JSON.
+// Run a benchmark with: Ladybird --headless=text --expose-internals-object Tests/LibWeb/Benchmarks/<name>.html
+
+function runRenderingBenchmark(iterations = 10) {
+    if (globalThis.internals === undefined || internals.measureRendering === undefined) {
+        document.body.textContent = "This benchmark requires the internals object (--expose-internals-object)";
+        return;
+    }
+
+    const results = internals.measureRendering(iterations);
+
+    const output = document.createElement("pre");
+    output.textContent = results;
+    document.body.replaceChildren(output);
+}
+
+function repeat(count, callback) {
+    let html = "";
+    for (let i = 0; i < count; ++i) html += callback(i);
+    return html;
+}
+
+const loremIpsum =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore " +
+    "magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo " +
+    "consequat.";
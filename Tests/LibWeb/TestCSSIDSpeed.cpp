@@ -7,6 +7,9 @@
 #include <LibTest/TestCase.h>
 
 #include <LibWeb/CSS/Keyword.h>
+#include <LibWeb/CSS/MediaFeatureID.h>
+#include <LibWeb/CSS/PropertyID.h>
+#include <LibWeb/CSS/PseudoClass.h>
 
 TEST_CASE(basic)
 {
@@ -19,9 +22,72 @@ TEST_CASE(basic)
     EXPECT_EQ(Web::CSS::keyword_from_string("smALl"sv).value(), Web::CSS::Keyword::Small);
 }
 
+TEST_CASE(unknown_names)
+{
+    EXPECT(!Web::CSS::keyword_from_string(""sv).has_value());
+    EXPECT(!Web::CSS::keyword_from_string("smal"sv).has_value());
+    EXPECT(!Web::CSS::keyword_from_string("smaller-than-small"sv).has_value());
+    EXPECT(!Web::CSS::property_id_from_string(""sv).has_value());
+    EXPECT(!Web::CSS::property_id_from_string("colour"sv).has_value());
+    EXPECT(!Web::CSS::pseudo_class_from_string("hoover"sv).has_value());
+    EXPECT(!Web::CSS::media_feature_id_from_string("widths"sv).has_value());
+}
+
+TEST_CASE(property_ids)
+{
+    for (auto property_id = Web::CSS::first_property_id; property_id <= Web::CSS::last_property_id; property_id = static_cast<Web::CSS::PropertyID>(to_underlying(property_id) + 1)) {
+        auto const& name = Web::CSS::string_from_property_id(property_id);
+        EXPECT_EQ(Web::CSS::property_id_from_string(name), property_id);
+        auto uppercase_name = name.to_ascii_uppercase();
+        EXPECT_EQ(Web::CSS::property_id_from_string(uppercase_name), property_id);
+
+        auto const& camel_case_name = Web::CSS::camel_case_string_from_property_id(property_id);
+        EXPECT_EQ(Web::CSS::property_id_from_camel_case_string(camel_case_name), property_id);
+    }
+
+    EXPECT_EQ(Web::CSS::property_id_from_string("--custom-property"sv), Web::CSS::PropertyID::Custom);
+}
+
+TEST_CASE(pseudo_classes)
+{
+    for (size_t i = 0; i < to_underlying(Web::CSS::PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<Web::CSS::PseudoClass>(i);
+        EXPECT_EQ(Web::CSS::pseudo_class_from_string(Web::CSS::pseudo_class_name(pseudo_class)), pseudo_class);
+    }
+
+    EXPECT_EQ(Web::CSS::pseudo_class_from_string("HOVER"sv), Web::CSS::PseudoClass::Hover);
+}
+
+TEST_CASE(media_features)
+{
+    EXPECT_EQ(Web::CSS::media_feature_id_from_string("width"sv), Web::CSS::MediaFeatureID::Width);
+    EXPECT_EQ(Web::CSS::media_feature_id_from_string("Prefers-Color-Scheme"sv), Web::CSS::MediaFeatureID::PrefersColorScheme);
+}
+
 BENCHMARK_CASE(keyword_from_string)
 {
     for (size_t i = 0; i < 10'000'000; ++i) {
         EXPECT_EQ(Web::CSS::keyword_from_string("inline"sv).value(), Web::CSS::Keyword::Inline);
     }
 }
+
+BENCHMARK_CASE(property_id_from_string)
+{
+    for (size_t i = 0; i < 10'000'000; ++i) {
+        EXPECT_EQ(Web::CSS::property_id_from_string("z-index"sv).value(), Web::CSS::PropertyID::ZIndex);
+    }
+}
+
+BENCHMARK_CASE(pseudo_class_from_string)
+{
+    for (size_t i = 0; i < 10'000'000; ++i) {
+        EXPECT_EQ(Web::CSS::pseudo_class_from_string("visited"sv).value(), Web::CSS::PseudoClass::Visited);
+    }
+}
+
+BENCHMARK_CASE(media_feature_id_from_string)
+{
+    for (size_t i = 0; i < 10'000'000; ++i) {
+        EXPECT_EQ(Web::CSS::media_feature_id_from_string("prefers-reduced-motion"sv).value(), Web::CSS::MediaFeatureID::PrefersReducedMotion);
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/IndexedDB/Internal/RecordTree.h>
+
+namespace {
+
+struct TestRecord {
+    int key;
+    int value;
+};
+
+struct CompareTestRecords {
+    static int compare(TestRecord const& a, TestRecord const& b)
+    {
+        if (a.key != b.key)
+            return a.key < b.key ? -1 : 1;
+        return 0;
+    }
+};
+
+using TestRecordTree = Web::IndexedDB::RecordTree<TestRecord, CompareTestRecords>;
+
+Vector<int> keys_of(TestRecordTree const& tree)
+{
+    Vector<int> keys;
+    tree.for_each([&](auto const& record) { keys.append(record.key); });
+    return keys;
+}
+
+}
+
+TEST_CASE(empty_tree)
+{
+    TestRecordTree tree;
+    EXPECT(tree.is_empty());
+    EXPECT(tree.begin().is_end());
+    EXPECT(tree.last().is_end());
+    EXPECT(tree.partition_point([](auto const&) { return true; }).is_end());
+}
+
+TEST_CASE(records_are_kept_in_order)
+{
+    TestRecordTree tree;
+
+    // Insert enough records to need several levels of inner nodes.
+    static constexpr int record_count = 100'000;
+    for (int i = 0; i < record_count; ++i)
+        tree.insert({ (i * 7919) % record_count, i });
+
+    EXPECT_EQ(tree.size(), static_cast<size_t>(record_count));
+
+    auto keys = keys_of(tree);
+    EXPECT_EQ(keys.size(), static_cast<size_t>(record_count));
+    for (int i = 0; i < record_count; ++i)
+        EXPECT_EQ(keys[i], i);
+
+    int expected_key = record_count;
+    for (auto it = tree.last(); !it.is_end(); it = tree.previous(it))
+        EXPECT_EQ(it->key, --expected_key);
+    EXPECT_EQ(expected_key, 0);
+}
+
+TEST_CASE(equal_records_are_inserted_after_each_other)
+{
+    TestRecordTree tree;
+    for (int i = 0; i < 200; ++i)
+        tree.insert({ i % 2, i });
+
+    int previous_value = -1;
+    for (auto it = tree.partition_point([](auto const& record) { return record.key >= 1; }); !it.is_end(); ++it) {
+        EXPECT_EQ(it->key, 1);
+        EXPECT(it->value > previous_value);
+        previous_value = it->value;
+    }
+}
+
+TEST_CASE(partition_point)
+{
+    TestRecordTree tree;
+    for (int i = 0; i < 1000; ++i)
+        tree.insert({ i * 2, i });
+
+    for (int key = -1; key < 2001; ++key) {
+        auto it = tree.partition_point([&](auto const& record) { return record.key >= key; });
+        if (key > 1998) {
+            EXPECT(it.is_end());
+            continue;
+        }
+        EXPECT_EQ(it->key, key <= 0 ? 0 : key + key % 2);
+    }
+}
+
+TEST_CASE(remove_records)
+{
+    TestRecordTree tree;
+    for (int i = 0; i < 1000; ++i)
+        tree.insert({ i, i });
+
+    // Remove a range of records, spanning several leaf nodes.
+    auto it = tree.partition_point([](auto const& record) { return record.key >= 100; });
+    while (!it.is_end() && it->key < 900)
+        it = tree.remove(it);
+    EXPECT_EQ(it->key, 900);
+    EXPECT_EQ(tree.size(), 200u);
+
+    tree.remove_all_matching([](auto const& record) { return record.key % 2 == 1; });
+    EXPECT_EQ(tree.size(), 100u);
+
+    auto keys = keys_of(tree);
+    for (size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(keys[i], static_cast<int>(i < 50 ? i * 2 : 900 + (i - 50) * 2));
+
+    tree.remove_all_matching([](auto const&) { return true; });
+    EXPECT(tree.is_empty());
+    EXPECT(tree.begin().is_end());
+
+    tree.insert({ 42, 0 });
+    EXPECT_EQ(tree.begin()->key, 42);
+    EXPECT_EQ(tree.last()->key, 42);
+}
@@ -404,6 +404,17 @@
     WebView::Application::cookie_jar().clear_all_cookies();
 }
 
+- (void)dumpNetworkLog:(id)sender
+{
+    auto network_log_path = WebView::Application::the().dump_network_log();
+    warnln("\033[33;1mDumped network log into {}\033[0m", network_log_path);
+}
+
+- (void)clearNetworkLog:(id)sender
+{
+    WebView::Application::the().clear_network_log();
+}
+
 - (NSMenuItem*)createApplicationMenu
 {
     auto* menu = [[NSMenuItem alloc] init];
@@ -682,6 +693,18 @@
     [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump GC Graph"
                                                 action:@selector(dumpGCGraph:)
                                          keyEquivalent:@""]];
+    [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Memory Report"
+                                                action:@selector(dumpMemoryReport:)
+                                         keyEquivalent:@""]];
+    [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Network Log"
+                                                action:@selector(dumpNetworkLog:)
+                                         keyEquivalent:@""]];
+    [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Clear Network Log"
+                                                action:@selector(clearNetworkLog:)
+                                         keyEquivalent:@""]];
+    [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Heap Snapshot"
+                                                action:@selector(dumpHeapSnapshot:)
+                                         keyEquivalent:@""]];
     [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Clear Cache"
                                                 action:@selector(clearCache:)
                                          keyEquivalent:@""]];
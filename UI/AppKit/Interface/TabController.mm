@@ -403,6 +403,18 @@ static NSString* const TOOLBAR_TAB_OVERVIEW_IDENTIFIER = @"ToolbarTabOverviewIde
     warnln("\033[33;1mDumped GC-graph into {}\033[0m", gc_graph_path);
 }
 
+- (void)dumpMemoryReport:(id)sender
+{
+    auto& view_impl = [[[self tab] web_view] view];
+    auto memory_report_path = view_impl.dump_memory_report();
+    warnln("\033[33;1mDumped memory report into {}\033[0m", memory_report_path);
+}
+
+- (void)dumpHeapSnapshot:(id)sender
+{
+    [self debugRequest:"dump-heap-snapshot" argument:""];
+}
+
 - (void)clearCache:(id)sender
 {
     [self debugRequest:"clear-cache" argument:""];
@@ -486,6 +486,38 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         }
     });
 
+    auto* dump_memory_report_action = new QAction("Dump Memory Report", this);
+    debug_menu->addAction(dump_memory_report_action);
+    QObject::connect(dump_memory_report_action, &QAction::triggered, this, [this] {
+        if (m_current_tab) {
+            auto memory_report_path = m_current_tab->view().dump_memory_report();
+            warnln("\033[33;1mDumped memory report into {}"
+                   "\033[0m",
+                memory_report_path);
+        }
+    });
+
+    auto* dump_network_log_action = new QAction("Dump Network Log", this);
+    debug_menu->addAction(dump_network_log_action);
+    QObject::connect(dump_network_log_action, &QAction::triggered, this, [] {
+        auto network_log_path = WebView::Application::the().dump_network_log();
+        warnln("\033[33;1mDumped network log into {}"
+               "\033[0m",
+            network_log_path);
+    });
+
+    auto* clear_network_log_action = new QAction("Clear Network Log", this);
+    debug_menu->addAction(clear_network_log_action);
+    QObject::connect(clear_network_log_action, &QAction::triggered, this, [] {
+        WebView::Application::the().clear_network_log();
+    });
+
+    auto* dump_heap_snapshot_action = new QAction("Dump Heap Snapshot", this);
+    debug_menu->addAction(dump_heap_snapshot_action);
+    QObject::connect(dump_heap_snapshot_action, &QAction::triggered, this, [this] {
+        debug_request("dump-heap-snapshot");
+    });
+
     auto* clear_cache_action = new QAction("Clear &Cache", this);
     clear_cache_action->setIcon(load_icon_from_uri("resource://icons/browser/clear-cache.png"sv));
     debug_menu->addAction(clear_cache_action);
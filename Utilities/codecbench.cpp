@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitStream.h>
+#include <AK/LexicalPath.h>
+#include <AK/MemoryStream.h>
+#include <AK/QuickSort.h>
+#include <AK/Time.h>
+#include <LibCompress/Deflate.h>
+#include <LibCompress/Gzip.h>
+#include <LibCompress/Lzw.h>
+#include <LibCompress/Zlib.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/DirIterator.h>
+#include <LibCore/MappedFile.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibGfx/ImageFormats/BMPWriter.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
+#include <LibGfx/ImageFormats/JPEGWriter.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibGfx/ImageFormats/WebPWriter.h>
+#include <LibMain/Main.h>
+#include <sys/resource.h>
+
+struct Options {
+    size_t iteration_count { 5 };
+    bool encode { false };
+    bool compression { false };
+};
+
+static u64 peak_resident_memory_in_bytes()
+{
+    rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) < 0)
+        return 0;
+
+#if defined(AK_OS_MACOS)
+    return usage.ru_maxrss;
+#else
+    return static_cast<u64>(usage.ru_maxrss) * KiB;
+#endif
+}
+
+template<typename Callback>
+static ErrorOr<Vector<AK::Duration>> measure(size_t iteration_count, Callback callback)
+{
+    Vector<AK::Duration> times;
+    TRY(times.try_ensure_capacity(iteration_count));
+
+    for (size_t i = 0; i < iteration_count; ++i) {
+        auto start_time = MonotonicTime::now();
+        TRY(callback());
+        times.unchecked_append(MonotonicTime::now() - start_time);
+    }
+
+    return times;
+}
+
+static double to_seconds(AK::Duration duration)
+{
+    return static_cast<double>(duration.to_nanoseconds()) / 1'000'000'000.0;
+}
+
+// Reports the mean time of the iterations, and the throughput of the fastest one, which is the least disturbed by
+// everything else that is going on in the system.
+static void report(StringView path, StringView operation, ReadonlySpan<AK::Duration> times, size_t byte_count, Optional<size_t> pixel_count = {})
+{
+    AK::Duration total_time;
+    auto fastest_time = times.first();
+    for (auto time : times) {
+        total_time += time;
+        fastest_time = min(fastest_time, time);
+    }
+
+    auto mean_time = to_seconds(total_time) / static_cast<double>(times.size());
+    auto fastest_seconds = max(to_seconds(fastest_time), 1e-9);
+
+    out("{:<20} {:>10.3}ms {:>10.1} MB/s", operation, mean_time * 1000, static_cast<double>(byte_count) / fastest_seconds / 1'000'000.0);
+    if (pixel_count.has_value())
+        out(" {:>10.1} MP/s", static_cast<double>(*pixel_count) / fastest_seconds / 1'000'000.0);
+    outln("  {}", path);
+}
+
+static ErrorOr<void> benchmark_image_decoding(StringView path, ReadonlyBytes bytes, Options const& options)
+{
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(bytes));
+    if (!decoder)
+        return {};
+
+    auto frame_count = decoder->frame_count();
+    auto pixel_count = static_cast<size_t>(decoder->width()) * decoder->height() * frame_count;
+    auto natural_frame_format = decoder->natural_frame_format();
+
+    // The time spent decoding every frame, summed up over all iterations.
+    Vector<AK::Duration> frame_times;
+    TRY(frame_times.try_resize(frame_count));
+
+    auto times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        // NOTE: Creating the decoder is part of decoding, as most plugins parse the image's headers at that point.
+        auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(bytes));
+        if (!decoder)
+            return Error::from_string_literal("Could not find decoder for input file");
+
+        for (size_t i = 0; i < frame_count; ++i) {
+            auto start_time = MonotonicTime::now();
+            if (natural_frame_format == Gfx::NaturalFrameFormat::CMYK)
+                (void)TRY(decoder->cmyk_frame());
+            else
+                (void)TRY(decoder->frame(i));
+            frame_times[i] += MonotonicTime::now() - start_time;
+        }
+        return {};
+    }));
+
+    report(path, "decode"sv, times, bytes.size(), pixel_count);
+
+    if (frame_count > 1) {
+        size_t slowest_frame = 0;
+        for (size_t i = 1; i < frame_count; ++i) {
+            if (frame_times[i] > frame_times[slowest_frame])
+                slowest_frame = i;
+        }
+
+        auto iteration_count = static_cast<double>(options.iteration_count);
+        AK::Duration total_frame_time;
+        for (auto frame_time : frame_times)
+            total_frame_time += frame_time;
+
+        outln("{:<20} {:>10.3}ms per frame over {} frames, slowest is frame {} at {:.3}ms  {}",
+            "decode frames"sv, to_seconds(total_frame_time) * 1000 / iteration_count / static_cast<double>(frame_count), frame_count,
+            slowest_frame, to_seconds(frame_times[slowest_frame]) * 1000 / iteration_count, path);
+    }
+
+    if (!options.encode || natural_frame_format == Gfx::NaturalFrameFormat::CMYK)
+        return {};
+
+    auto bitmap = TRY(decoder->frame(0)).image;
+    auto bitmap_pixel_count = static_cast<size_t>(bitmap->width()) * bitmap->height();
+    auto bitmap_byte_count = bitmap->size_in_bytes();
+
+    auto encode_times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        (void)TRY(Gfx::PNGWriter::encode(*bitmap));
+        return {};
+    }));
+    report(path, "encode png"sv, encode_times, bitmap_byte_count, bitmap_pixel_count);
+
+    encode_times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        AllocatingMemoryStream stream;
+        TRY(Gfx::JPEGWriter::encode(stream, *bitmap));
+        return {};
+    }));
+    report(path, "encode jpeg"sv, encode_times, bitmap_byte_count, bitmap_pixel_count);
+
+    encode_times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        AllocatingMemoryStream stream;
+        TRY(Gfx::WebPWriter::encode(stream, *bitmap));
+        return {};
+    }));
+    report(path, "encode webp"sv, encode_times, bitmap_byte_count, bitmap_pixel_count);
+
+    encode_times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        (void)TRY(Gfx::BMPWriter::encode(*bitmap));
+        return {};
+    }));
+    report(path, "encode bmp"sv, encode_times, bitmap_byte_count, bitmap_pixel_count);
+
+    return {};
+}
+
+template<typename Compressor, typename Decompressor>
+static ErrorOr<void> benchmark_compression_format(StringView path, StringView name, ReadonlyBytes bytes, Options const& options)
+{
+    auto compressed = TRY(Compressor::compress_all(bytes));
+
+    auto times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        (void)TRY(Compressor::compress_all(bytes));
+        return {};
+    }));
+    report(path, ByteString::formatted("compress {}", name), times, bytes.size());
+
+    times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        (void)TRY(Decompressor::decompress_all(compressed));
+        return {};
+    }));
+    report(path, ByteString::formatted("decompress {}", name), times, bytes.size());
+
+    return {};
+}
+
+static ErrorOr<void> benchmark_compression(StringView path, ReadonlyBytes bytes, Options const& options)
+{
+    // Throughputs are always given in uncompressed bytes, so that compression and decompression can be compared.
+    TRY((benchmark_compression_format<Compress::DeflateCompressor, Compress::DeflateDecompressor>(path, "deflate"sv, bytes, options)));
+    TRY((benchmark_compression_format<Compress::ZlibCompressor, Compress::ZlibDecompressor>(path, "zlib"sv, bytes, options)));
+    TRY((benchmark_compression_format<Compress::GzipCompressor, Compress::GzipDecompressor>(path, "gzip"sv, bytes, options)));
+
+    // GIF images use 8-bit LZW codes. We only measure decompression, as that is what loading a GIF image does.
+    static constexpr u8 lzw_code_size = 8;
+    auto lzw_compressed = TRY(Compress::LzwCompressor::compress_all(bytes, lzw_code_size));
+
+    auto times = TRY(measure(options.iteration_count, [&]() -> ErrorOr<void> {
+        (void)TRY(Compress::LzwDecompressor<LittleEndianInputBitStream>::decompress_all(lzw_compressed, lzw_code_size));
+        return {};
+    }));
+    report(path, "decompress lzw"sv, times, bytes.size());
+
+    return {};
+}
+
+static ErrorOr<void> collect_paths(StringView path, Vector<ByteString>& paths)
+{
+    if (!FileSystem::is_directory(path)) {
+        TRY(paths.try_append(path));
+        return {};
+    }
+
+    Core::DirIterator iterator { path, Core::DirIterator::SkipDots };
+    while (iterator.has_next())
+        TRY(collect_paths(iterator.next_full_path(), paths));
+    if (iterator.has_error())
+        return iterator.error();
+
+    return {};
+}
+
+ErrorOr<int> ladybird_main(Main::Arguments arguments)
+{
+    Options options;
+    Vector<StringView> input_paths;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Benchmark image and compression codecs on a corpus of files");
+    args_parser.add_positional_argument(input_paths, "Files, or directories of files, to benchmark", "paths");
+    args_parser.add_option(options.iteration_count, "How many times to run every benchmark (default: 5)", "iterations", 'n', "count");
+    args_parser.add_option(options.encode, "Also benchmark encoding the first frame of every image as PNG, JPEG, WebP and BMP", "encode", 'e');
+    args_parser.add_option(options.compression, "Also benchmark compressing and decompressing every file with Deflate, Zlib, Gzip and LZW", "compression", 'c');
+    args_parser.parse(arguments);
+
+    if (options.iteration_count == 0)
+        return Error::from_string_literal("At least one iteration is required");
+
+    Vector<ByteString> paths;
+    for (auto path : input_paths)
+        TRY(collect_paths(path, paths));
+    quick_sort(paths);
+
+    for (auto const& path : paths) {
+        auto file = TRY(Core::MappedFile::map(path));
+
+        if (auto result = benchmark_image_decoding(path, file->bytes(), options); result.is_error())
+            warnln("Unable to benchmark decoding {}: {}", path, result.error());
+
+        if (options.compression) {
+            if (auto result = benchmark_compression(path, file->bytes(), options); result.is_error())
+                warnln("Unable to benchmark compressing {}: {}", path, result.error());
+        }
+    }
+
+    outln("Peak resident memory: {} KiB", peak_resident_memory_in_bytes() / KiB);
+    return 0;
+}
@@ -8,9 +8,11 @@
  */
 
 #include <AK/JsonValue.h>
+#include <AK/Math.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/Platform.h>
 #include <AK/StringBuilder.h>
+#include <AK/Time.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
 #include <LibCore/StandardPaths.h>
@@ -25,6 +27,7 @@
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
@@ -87,6 +90,7 @@ static bool s_print_last_result = false;
 static bool s_strip_ansi = false;
 static bool s_raw_strings = false;
 static bool s_disable_source_location_hints = false;
+static bool s_profile_bytecode = false;
 #if !defined(AK_OS_WINDOWS)
 static RefPtr<Line::Editor> s_editor;
 #endif
@@ -255,6 +259,102 @@ static ErrorOr<bool> parse_and_run(JS::Realm& realm, StringView source, StringVi
     return true;
 }
 
+static ErrorOr<void> append_script_source(StringBuilder& builder, StringView path)
+{
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
+    auto file_contents = TRY(file->read_until_eof());
+    auto source = StringView { file_contents };
+
+    if (Utf8View { file_contents }.validate()) {
+        builder.append(source);
+    } else {
+        auto decoder = TextCodec::decoder_for("windows-1252"sv);
+        VERIFY(decoder.has_value());
+
+        auto utf8_source = TRY(TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, source));
+        builder.append(utf8_source);
+    }
+
+    return {};
+}
+
+struct BenchmarkOptions {
+    size_t iteration_count { 10 };
+    size_t warmup_iteration_count { 3 };
+    bool dump_op_counts { false };
+};
+
+// Runs the script a number of times, each time in a new realm, and reports the mean time of the runs after the warmup
+// runs along with its 95% confidence interval, and how much of that time was spent collecting garbage.
+static ErrorOr<bool> run_benchmark(StringView source, StringView source_name, BenchmarkOptions const& options)
+{
+    auto& interpreter = g_vm->bytecode_interpreter();
+    auto& heap = g_vm->heap();
+
+    Vector<double> run_times_in_milliseconds;
+    AK::Duration total_run_time;
+    AK::Duration total_garbage_collection_time;
+
+    for (size_t i = 0; i < options.warmup_iteration_count + options.iteration_count; ++i) {
+        auto is_warmup = i < options.warmup_iteration_count;
+
+        auto execution_context = JS::create_simple_execution_context<ScriptObject>(*g_vm);
+        auto& realm = *execution_context->realm;
+
+        if (i == options.warmup_iteration_count)
+            interpreter.reset_op_counts();
+
+        auto garbage_collection_time_before_run = heap.total_garbage_collection_time();
+        auto start_time = MonotonicTime::now();
+
+        auto success = TRY(parse_and_run(realm, source, source_name));
+
+        auto run_time = MonotonicTime::now() - start_time;
+        g_vm->pop_execution_context();
+
+        if (!success)
+            return false;
+
+        if (!is_warmup) {
+            run_times_in_milliseconds.append(static_cast<double>(run_time.to_nanoseconds()) / 1'000'000.0);
+            total_run_time += run_time;
+            total_garbage_collection_time += heap.total_garbage_collection_time() - garbage_collection_time_before_run;
+        }
+
+        // Start every run from a heap without the garbage of the previous one, so that they all do the same work.
+        heap.collect_garbage();
+    }
+
+    double mean = 0;
+    for (auto run_time : run_times_in_milliseconds)
+        mean += run_time;
+    mean /= static_cast<double>(run_times_in_milliseconds.size());
+
+    double variance = 0;
+    if (run_times_in_milliseconds.size() > 1) {
+        for (auto run_time : run_times_in_milliseconds)
+            variance += (run_time - mean) * (run_time - mean);
+        variance /= static_cast<double>(run_times_in_milliseconds.size() - 1);
+    }
+
+    // NOTE: We treat the run times as normally distributed, which is close enough for the iteration counts we use.
+    auto confidence_interval = 1.96 * AK::sqrt(variance / static_cast<double>(run_times_in_milliseconds.size()));
+    auto garbage_collection_share = total_run_time.is_zero()
+        ? 0.0
+        : static_cast<double>(total_garbage_collection_time.to_nanoseconds()) / static_cast<double>(total_run_time.to_nanoseconds()) * 100;
+
+    outln("{}: {:.3}ms ± {:.3}ms (95% confidence) over {} runs, {:.1}% spent collecting garbage",
+        source_name, mean, confidence_interval, run_times_in_milliseconds.size(), garbage_collection_share);
+
+    if (options.dump_op_counts) {
+        StringBuilder op_counts_builder;
+        interpreter.dump_op_counts(op_counts_builder);
+        out("{}", op_counts_builder.string_view());
+    }
+
+    return true;
+}
+
 static JS::ThrowCompletionOr<JS::Value> load_ini_impl(JS::VM& vm)
 {
     auto& realm = *vm.current_realm();
@@ -816,13 +916,24 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_syntax_highlight = false;
     bool disable_debug_printing = false;
     bool use_test262_global = false;
+    bool disable_bytecode_optimizations = false;
     StringView evaluate_script;
+    StringView profile_path;
+    bool benchmark = false;
+    BenchmarkOptions benchmark_options;
     Vector<StringView> script_paths;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(disable_bytecode_optimizations, "Disable the bytecode optimization passes", "disable-bytecode-optimizations", {});
+    args_parser.add_option(s_profile_bytecode, "Print per-function invocation, loop and inline cache counters on exit", "profile-bytecode", {});
+    args_parser.add_option(profile_path, "Sample the script while it runs and write its stacks to a file, in the folded format read by flame graph tools", "profile", {}, "path");
+    args_parser.add_option(benchmark, "Run every script as a benchmark, and report how long it takes to run", "bench", {});
+    args_parser.add_option(benchmark_options.iteration_count, "Number of times to run every benchmark (default: 10)", "bench-iterations", {}, "count");
+    args_parser.add_option(benchmark_options.warmup_iteration_count, "Number of times to run every benchmark before it is measured (default: 3)", "bench-warmup-iterations", {}, "count");
+    args_parser.add_option(benchmark_options.dump_op_counts, "Print how often every type of bytecode instruction ran during the measured runs of a benchmark", "bench-op-counts", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -837,6 +948,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.parse(arguments);
 
     [[maybe_unused]] bool syntax_highlight = !disable_syntax_highlight;
+    JS::Bytecode::g_optimize_bytecode = !disable_bytecode_optimizations;
 
     AK::set_debug_enabled(!disable_debug_printing);
     s_history_path = TRY(String::formatted("{}/.js-history", Core::StandardPaths::home_directory()));
@@ -866,6 +978,30 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     // FIXME: Figure out some way to interrupt the interpreter now that vm.exception() is gone.
 
+    if (benchmark) {
+        if (script_paths.is_empty())
+            return Error::from_string_literal("Benchmark mode requires at least one script");
+        if (benchmark_options.iteration_count == 0)
+            return Error::from_string_literal("Benchmark mode requires at least one iteration");
+        if (benchmark_options.dump_op_counts && !JS::Bytecode::Interpreter::has_op_counts()) {
+            warnln("Bytecode op counts are only available when LibJS is built with JS_BYTECODE_OP_COUNTS_DEBUG");
+            benchmark_options.dump_op_counts = false;
+        }
+
+        g_vm->heap().set_should_collect_on_every_allocation(gc_on_every_allocation);
+
+        bool all_succeeded = true;
+        for (auto path : script_paths) {
+            StringBuilder builder;
+            TRY(append_script_source(builder, path));
+
+            if (!TRY(run_benchmark(builder.string_view(), path, benchmark_options)))
+                all_succeeded = false;
+        }
+
+        return all_succeeded ? s_exit_code : 1;
+    }
+
     if (evaluate_script.is_empty() && script_paths.is_empty()) {
 #if defined(AK_OS_WINDOWS)
         dbgln("REPL functionality is not supported on Windows");
@@ -893,21 +1029,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             if (script_paths.size() > 1)
                 warnln("Warning: Multiple files supplied, this will concatenate the sources and resolve modules as if it was the first file");
 
-            for (auto& path : script_paths) {
-                auto file = TRY(Core::File::open(path, Core::File::OpenMode::Read));
-                auto file_contents = TRY(file->read_until_eof());
-                auto source = StringView { file_contents };
-
-                if (Utf8View { file_contents }.validate()) {
-                    builder.append(source);
-                } else {
-                    auto decoder = TextCodec::decoder_for("windows-1252"sv);
-                    VERIFY(decoder.has_value());
-
-                    auto utf8_source = TRY(TextCodec::convert_input_to_utf8_using_given_decoder_unless_there_is_a_byte_order_mark(*decoder, source));
-                    builder.append(utf8_source);
-                }
-            }
+            for (auto& path : script_paths)
+                TRY(append_script_source(builder, path));
 
             source_name = script_paths[0];
         } else {
@@ -917,7 +1040,32 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
+        OwnPtr<JS::SamplingProfiler> sampling_profiler;
+        if (!profile_path.is_empty()) {
+            sampling_profiler = JS::SamplingProfiler::create(*g_vm);
+            sampling_profiler->start();
+        }
+
+        auto success = TRY(parse_and_run(realm, builder.string_view(), source_name));
+
+        if (sampling_profiler) {
+            sampling_profiler->stop();
+
+            StringBuilder profile_builder;
+            sampling_profiler->write_folded_stacks(profile_builder);
+
+            auto profile_file = TRY(Core::File::open(profile_path, Core::File::OpenMode::Write));
+            TRY(profile_file->write_until_depleted(profile_builder.string_view().bytes()));
+            warnln("Wrote {} samples to {}", sampling_profiler->sample_count(), profile_path);
+        }
+
+        if (s_profile_bytecode) {
+            StringBuilder profile_builder;
+            g_vm->bytecode_interpreter().dump_profile(profile_builder);
+            warn("{}", profile_builder.string_view());
+        }
+
+        if (!success)
             return 1;
     }
 
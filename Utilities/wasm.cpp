@@ -492,6 +492,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
                 if (!function)
                     continue;
                 auto& expression = function->code().func().body();
+                expression.compile_instructions_if_needed();
                 if (expression.compiled_instructions.dispatches.is_empty())
                     continue;
 